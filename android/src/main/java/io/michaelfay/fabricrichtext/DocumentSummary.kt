@@ -0,0 +1,39 @@
+package io.michaelfay.fabricrichtext
+
+/**
+ * What the text of a state contains, from the C++ parse
+ * (cpp/parsing/DocumentSummary.h), so the view can skip link, direction and
+ * accessibility work the text does not need.
+ *
+ * States without a summary use UNKNOWN, which assumes every feature.
+ */
+data class DocumentSummary(
+    val features: Int,
+    val linkCount: Int,
+    val maxHeadingLevel: Int,
+    val fragmentCount: Int,
+    val textBytes: Int
+) {
+    val hasLinks: Boolean get() = features and FEATURE_LINKS != 0
+    val hasBidi: Boolean get() = features and FEATURE_BIDI != 0
+    val hasLists: Boolean get() = features and FEATURE_LISTS != 0
+    val isTruncated: Boolean get() = features and FEATURE_TRUNCATED != 0
+    val isDegraded: Boolean get() = features and FEATURE_DEGRADED != 0
+
+    companion object {
+        // DocumentFeature bits
+        const val FEATURE_LINKS = 1
+        const val FEATURE_BIDI = 1 shl 1
+        const val FEATURE_LISTS = 1 shl 2
+        const val FEATURE_TRUNCATED = 1 shl 3
+        const val FEATURE_DEGRADED = 1 shl 4
+
+        val UNKNOWN = DocumentSummary(
+            FEATURE_LINKS or FEATURE_BIDI or FEATURE_LISTS,
+            linkCount = 0,
+            maxHeadingLevel = 0,
+            fragmentCount = 0,
+            textBytes = 0
+        )
+    }
+}
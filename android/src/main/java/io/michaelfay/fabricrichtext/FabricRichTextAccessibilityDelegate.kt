@@ -110,8 +110,16 @@ class FabricRichTextAccessibilityDelegate(
     /**
      * Rebuilds the link cache from the current text content.
      * Should be called when text changes.
+     *
+     * @param mayHaveLinks False when the text is known to have no links,
+     *   which clears the cache without scanning the text for spans
      */
-    fun updateLinks() {
+    fun updateLinks(mayHaveLinks: Boolean = true) {
+        if (!mayHaveLinks) {
+            log("updateLinks: text has no links, clearing links")
+            accessibilityLinks = null
+            return
+        }
         val spannable = hostView.stateSpannable
             ?: (hostView.text as? Spannable)
             ?: run {
@@ -5,6 +5,8 @@ import android.graphics.Canvas
 import android.graphics.Typeface
 import android.text.Layout
 import android.text.Spannable
+import android.text.SpannableStringBuilder
+import android.text.Spanned
 import android.text.TextPaint
 import android.text.method.LinkMovementMethod
 import android.util.AttributeSet
@@ -73,6 +75,11 @@ class FabricRichTextView : AppCompatTextView, TextStyleApplier.StyleChangeListen
     internal var stateSpannable: Spannable? = null
     internal var customLayout: Layout? = null
 
+    // Text from state before link detection, and the content hash of the
+    // state it came from; state deltas against that hash are patched into it
+    private var stateBaseSpannable: SpannableStringBuilder? = null
+    private var stateContentHash: Long = 0L
+
     // Listeners
     var linkClickListener: LinkClickListener? = null
     var measurementListener: MeasurementListener? = null
@@ -85,6 +92,7 @@ class FabricRichTextView : AppCompatTextView, TextStyleApplier.StyleChangeListen
     private var numberOfLines: Int = 0
     private var isRTL: Boolean = false
     private var resolvedAccessibilityLabel: String? = null
+    private var documentSummary: DocumentSummary = DocumentSummary.UNKNOWN
 
     // Accessibility delegate
     private var accessibilityDelegate: FabricRichTextAccessibilityDelegate? = null
@@ -190,6 +198,14 @@ class FabricRichTextView : AppCompatTextView, TextStyleApplier.StyleChangeListen
         applyRTLState(rtl)
     }
 
+    /**
+     * What the text from state contains; set before the text itself, so
+     * link and direction work it does not need is skipped.
+     */
+    fun setDocumentSummary(summary: DocumentSummary) {
+        documentSummary = summary
+    }
+
     fun setResolvedAccessibilityLabel(label: String?) {
         resolvedAccessibilityLabel = label
         logA11y("setResolvedAccessibilityLabel: ${label?.length ?: 0} chars")
@@ -226,14 +242,53 @@ class FabricRichTextView : AppCompatTextView, TextStyleApplier.StyleChangeListen
 
     // MARK: - State-Based Rendering
 
-    fun setSpannableFromState(spannable: Spannable) {
+    fun setSpannableFromState(spannable: Spannable, contentHash: Long = 0L) {
         debugHelper.log("[State] setSpannableFromState: ${spannable.length} chars")
+        stateBaseSpannable = spannable as? SpannableStringBuilder
+        stateContentHash = if (stateBaseSpannable != null) contentHash else 0L
+        onStateSpannableChanged(spannable)
+    }
+
+    /**
+     * Content hash of the state the current text was built from, 0 if none.
+     */
+    fun getStateContentHash(): Long = stateContentHash
+
+    /**
+     * Replaces [start, start + removedLength) of the text from state with
+     * replacement, in place. Only applies while the view still shows the
+     * content with hash baseHash; returns false, leaving the text as is,
+     * otherwise.
+     */
+    fun patchSpannableFromState(
+        baseHash: Long,
+        start: Int,
+        removedLength: Int,
+        replacement: Spanned,
+        contentHash: Long
+    ): Boolean {
+        val base = stateBaseSpannable ?: return false
+        if (baseHash == 0L || baseHash != stateContentHash || start < 0 || removedLength < 0 ||
+            start + removedLength > base.length) {
+            return false
+        }
+        debugHelper.log("[State] patchSpannableFromState: [$start, ${start + removedLength}) -> ${replacement.length} chars")
+        if (removedLength > 0 || replacement.isNotEmpty()) {
+            base.replace(start, start + removedLength, replacement)
+        }
+        stateContentHash = contentHash
+        onStateSpannableChanged(base)
+        return true
+    }
+
+    private fun onStateSpannableChanged(spannable: Spannable) {
         stateSpannable = spannable
         hasStateSpannable = true
         customLayout = null
 
         applyDetectionIfNeeded()
-        accessibilityDelegate?.updateLinks()
+        // Detected links are spans of the text too
+        accessibilityDelegate?.updateLinks(documentSummary.hasLinks || linkDetectionManager.isDetectionEnabled())
         post { updateAccessibilityForTruncation() }
 
         invalidate()
@@ -315,7 +370,8 @@ class FabricRichTextView : AppCompatTextView, TextStyleApplier.StyleChangeListen
                     width - paddingLeft - paddingRight,
                     isRTL,
                     styleApplier.textAlign,
-                    numberOfLines
+                    numberOfLines,
+                    documentSummary.hasBidi
                 )
                 debugHelper.log("[Draw] Created custom layout: ${customLayout!!.width}x${customLayout!!.height}, lines: ${customLayout!!.lineCount}")
             }
@@ -414,7 +470,8 @@ class FabricRichTextView : AppCompatTextView, TextStyleApplier.StyleChangeListen
                 width - paddingLeft - paddingRight,
                 isRTL,
                 styleApplier.textAlign,
-                numberOfLines
+                numberOfLines,
+                documentSummary.hasBidi
             )
             return customLayout
         }
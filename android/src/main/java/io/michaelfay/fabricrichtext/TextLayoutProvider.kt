@@ -63,6 +63,8 @@ class TextLayoutProvider(
      * @param isRTL Explicit RTL setting from props
      * @param textAlign Text alignment setting ("left", "center", "right")
      * @param numberOfLines Maximum lines (0 = unlimited)
+     * @param mayContainRtl False when the text is known to have no RTL or
+     *   bidi control characters, which skips detecting its direction
      * @return A Layout (StaticLayout or BoringLayout) matching C++ measurement
      */
     fun createLayout(
@@ -70,10 +72,11 @@ class TextLayoutProvider(
         availableWidth: Int,
         isRTL: Boolean,
         textAlign: String?,
-        numberOfLines: Int
+        numberOfLines: Int,
+        mayContainRtl: Boolean = true
     ): Layout {
         // Determine effective RTL: explicit isRTL prop OR auto-detect from text content
-        val effectiveRTL = isRTL || detectTextDirectionRTL(text)
+        val effectiveRTL = isRTL || (mayContainRtl && detectTextDirectionRTL(text))
 
         if (DEBUG) {
             Log.d(TAG, "[Layout] isRTL=$isRTL, detectTextDirectionRTL=${detectTextDirectionRTL(text)}, effectiveRTL=$effectiveRTL")
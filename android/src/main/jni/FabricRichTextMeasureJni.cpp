@@ -0,0 +1,34 @@
+/**
+ * FabricRichTextMeasureJni.cpp
+ *
+ * JNI entry point of FabricRichTextMeasureModule: installs the batch
+ * measurement JSI function with the height estimator as measurer, and the
+ * pipeline metrics getter.
+ */
+
+#include <ReactCommon/CallInvokerHolder.h>
+#include <fbjni/fbjni.h>
+#include <jni.h>
+#include <jsi/jsi.h>
+
+#include "FabricBatchMeasureJSI.h"
+#include "FabricPipelineMetricsJSI.h"
+
+using namespace facebook;
+using namespace facebook::react;
+
+extern "C" JNIEXPORT void JNICALL
+Java_io_michaelfay_fabricrichtext_FabricRichTextMeasureModule_nativeInstall(
+    JNIEnv* /* env */,
+    jobject /* thiz */,
+    jlong runtimePointer,
+    jobject callInvokerHolder) {
+  auto* runtime = reinterpret_cast<jsi::Runtime*>(runtimePointer);
+  auto holder = jni::alias_ref<CallInvokerHolder::javaobject>{
+      static_cast<CallInvokerHolder::javaobject>(callInvokerHolder)};
+  auto jsInvoker = holder->cthis()->getCallInvoker();
+
+  // Called from install(), a synchronous method on the JS thread
+  installFabricBatchMeasure(*runtime, jsInvoker, std::make_shared<EstimatingTextMeasurer>());
+  installFabricPipelineMetrics(*runtime);
+}
@@ -0,0 +1,41 @@
+/**
+ * Custom ComponentDescriptors.h for FabricRichTextSpec
+ *
+ * This file overrides the codegen-generated ComponentDescriptors.h to provide
+ * a ComponentDescriptor that starts parsing markup when props are adopted.
+ *
+ * The include path for this file must have precedence over the codegen path.
+ */
+
+#pragma once
+
+#include <react/renderer/components/FabricRichTextSpec/ShadowNodes.h>
+#include <react/renderer/core/ConcreteComponentDescriptor.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+
+namespace facebook::react {
+
+/**
+ * Custom ComponentDescriptor for FabricRichText.
+ *
+ * adopt() runs for every new or cloned shadow node before layout. Parsing
+ * starts there, so measureContent() inside Yoga's layout pass only picks
+ * up the result. Clones with unchanged text and style do no parsing.
+ */
+class FabricRichTextComponentDescriptor final
+    : public ConcreteComponentDescriptor<FabricRichTextShadowNode> {
+ public:
+  using ConcreteComponentDescriptor::ConcreteComponentDescriptor;
+
+  void adopt(ShadowNode& shadowNode) const override {
+    ConcreteComponentDescriptor::adopt(shadowNode);
+
+    auto& richTextShadowNode = static_cast<FabricRichTextShadowNode&>(shadowNode);
+    richTextShadowNode.prepareContent();
+  }
+};
+
+void FabricRichTextSpec_registerComponentDescriptorsFromCodegen(
+    std::shared_ptr<const ComponentDescriptorProviderRegistry> registry);
+
+} // namespace facebook::react
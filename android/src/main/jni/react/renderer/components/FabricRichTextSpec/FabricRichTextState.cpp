@@ -2,14 +2,27 @@
  * FabricRichTextState.cpp
  *
  * Implementation of state serialization for FabricRichText.
- * Serializes AttributedString to MapBuffer for Kotlin consumption.
+ * Serializes AttributedString to MapBuffer for Kotlin consumption, either as
+ * one compact text layout or as RN's nested AttributedString MapBuffer.
  */
 
 #include "FabricRichTextState.h"
 
 #include <react/renderer/attributedstring/conversions.h>
 #include <android/log.h>
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <string>
+#include <vector>
+
+#include "parsing/AttributedStringBuilder.h"
+#include "parsing/CompactTextLayout.h"
+#include "parsing/PipelineMetrics.h"
+
+#ifndef FABRIC_RICH_TEXT_COMPACT_STATE
+#define FABRIC_RICH_TEXT_COMPACT_STATE 1
+#endif
 
 // Debug flag for verbose state logging.
 // Set to 1 to enable detailed logging for state serialization.
@@ -29,62 +42,180 @@ namespace facebook::react {
 constexpr static MapBuffer::Key HTML_STATE_KEY_ATTRIBUTED_STRING = 0;
 constexpr static MapBuffer::Key HTML_STATE_KEY_PARAGRAPH_ATTRIBUTES = 1;
 constexpr static MapBuffer::Key HTML_STATE_KEY_HASH = 2;
-constexpr static MapBuffer::Key HTML_STATE_KEY_LINK_URLS = 3;
+// Key 3 held per-fragment link URLs before links were interned
 constexpr static MapBuffer::Key HTML_STATE_KEY_NUMBER_OF_LINES = 4;
 constexpr static MapBuffer::Key HTML_STATE_KEY_ANIMATION_DURATION = 5;
 constexpr static MapBuffer::Key HTML_STATE_KEY_WRITING_DIRECTION = 6;
 constexpr static MapBuffer::Key HTML_STATE_KEY_ACCESSIBILITY_LABEL = 7;
+constexpr static MapBuffer::Key HTML_STATE_KEY_LINK_URLS = 8;
+constexpr static MapBuffer::Key HTML_STATE_KEY_LINK_RUNS = 9;
+constexpr static MapBuffer::Key HTML_STATE_KEY_COMPACT_LAYOUT = 10;
+constexpr static MapBuffer::Key HTML_STATE_KEY_CONTENT_HASH = 11;
+constexpr static MapBuffer::Key HTML_STATE_KEY_DELTA = 12;
+constexpr static MapBuffer::Key HTML_STATE_KEY_SUMMARY = 13;
 
-folly::dynamic FabricRichTextState::getDynamic() const {
-  // Not used for Kotlin serialization, but required by Fabric
-  return folly::dynamic::object();
+// Keys of HTML_STATE_KEY_SUMMARY
+constexpr static MapBuffer::Key SUMMARY_KEY_FEATURES = 0;
+constexpr static MapBuffer::Key SUMMARY_KEY_LINK_COUNT = 1;
+constexpr static MapBuffer::Key SUMMARY_KEY_MAX_HEADING_LEVEL = 2;
+constexpr static MapBuffer::Key SUMMARY_KEY_FRAGMENT_COUNT = 3;
+constexpr static MapBuffer::Key SUMMARY_KEY_TEXT_BYTES = 4;
+
+// Key of getDynamic() holding the full compact layout of a delta state
+constexpr static const char* DYNAMIC_KEY_COMPACT_LAYOUT = "compactLayout";
+
+// Keys of HTML_STATE_KEY_DELTA
+constexpr static MapBuffer::Key DELTA_KEY_BASE_HASH = 0;
+constexpr static MapBuffer::Key DELTA_KEY_UTF16_START = 1;
+constexpr static MapBuffer::Key DELTA_KEY_UTF16_REMOVED = 2;
+constexpr static MapBuffer::Key DELTA_KEY_LAYOUT = 3;
+
+// Keys of each entry of HTML_STATE_KEY_LINK_URLS
+constexpr static MapBuffer::Key LINK_URL_KEY_URL = 0;
+
+// Keys of each entry of HTML_STATE_KEY_LINK_RUNS
+constexpr static MapBuffer::Key LINK_RUN_KEY_FIRST_FRAGMENT = 0;
+constexpr static MapBuffer::Key LINK_RUN_KEY_FRAGMENT_COUNT = 1;
+constexpr static MapBuffer::Key LINK_RUN_KEY_URL_INDEX = 2;
+
+namespace {
+
+std::atomic<StateWireFormat> gWireFormat{
+    FABRIC_RICH_TEXT_COMPACT_STATE ? StateWireFormat::Compact : StateWireFormat::MapBuffer};
+
+// MapBuffer has no byte array value, so the layout travels as a base64 string
+std::string base64Encode(const std::vector<uint8_t>& bytes) {
+  static constexpr char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  std::string out;
+  out.reserve((bytes.size() + 2) / 3 * 4);
+  size_t i = 0;
+  for (; i + 3 <= bytes.size(); i += 3) {
+    uint32_t triple = bytes[i] << 16 | bytes[i + 1] << 8 | bytes[i + 2];
+    out.push_back(kAlphabet[triple >> 18 & 0x3F]);
+    out.push_back(kAlphabet[triple >> 12 & 0x3F]);
+    out.push_back(kAlphabet[triple >> 6 & 0x3F]);
+    out.push_back(kAlphabet[triple & 0x3F]);
+  }
+  if (i < bytes.size()) {
+    uint32_t triple = bytes[i] << 16 | (i + 1 < bytes.size() ? bytes[i + 1] << 8 : 0);
+    out.push_back(kAlphabet[triple >> 18 & 0x3F]);
+    out.push_back(kAlphabet[triple >> 12 & 0x3F]);
+    out.push_back(i + 1 < bytes.size() ? kAlphabet[triple >> 6 & 0x3F] : '=');
+    out.push_back('=');
+  }
+  return out;
 }
 
-MapBuffer FabricRichTextState::getMapBuffer() const {
-  auto builder = MapBufferBuilder();
+} // namespace
 
-  STATE_LOGD("getMapBuffer() called - attributedString has %zu fragments, linkUrls has %zu entries",
-             attributedString.getFragments().size(), linkUrls.size());
+void FabricRichTextState::setWireFormat(StateWireFormat format) {
+  gWireFormat.store(format, std::memory_order_relaxed);
+}
 
+StateWireFormat FabricRichTextState::wireFormat() {
+  return gWireFormat.load(std::memory_order_relaxed);
+}
+
+std::string FabricRichTextState::encodeCompactLayout() const {
+  auto layout = compactLayout ? compactLayout
+                              : std::make_shared<const parsing::CompactTextLayout>(attributedString, links);
+  return base64Encode(layout->serialize());
+}
+
+bool FabricRichTextState::sendsDeltaOnly() const {
+  return wireFormat() == StateWireFormat::Compact && delta && deltaLayout;
+}
+
+folly::dynamic FabricRichTextState::getDynamic() const {
+  // Required by Fabric. Kotlin only reads it when a delta-only state's base
+  // is not the text its view shows, so the full layout is encoded on demand.
+  auto data = folly::dynamic::object();
+  if (sendsDeltaOnly()) {
+    parsing::PhaseTimer timer(parsing::MetricPhase::Serialize, summary.textBytes);
+    data[DYNAMIC_KEY_COMPACT_LAYOUT] = encodeCompactLayout();
+  }
+  return data;
+}
+
+void FabricRichTextState::serializeAttributedString(MapBufferBuilder& builder) const {
   // Serialize the AttributedString (uses conversions.h toMapBuffer)
   auto attStringMapBuffer = toMapBuffer(attributedString);
   builder.putMapBuffer(HTML_STATE_KEY_ATTRIBUTED_STRING, attStringMapBuffer);
 
-  // Serialize paragraph attributes
-  auto paMapBuffer = toMapBuffer(paragraphAttributes);
-  builder.putMapBuffer(HTML_STATE_KEY_PARAGRAPH_ATTRIBUTES, paMapBuffer);
-
   // Include hash for change detection
   builder.putInt(HTML_STATE_KEY_HASH, attStringMapBuffer.getInt(0)); // AS_KEY_HASH = 0
 
-  // Serialize link URLs as a MapBuffer (index -> URL string)
+  // Serialize links as the interned URL table and the fragment runs that
+  // use it. Both are lists, so neither is limited to UINT16_MAX entries, and
+  // their size follows the number of links rather than fragments.
   // This enables Kotlin to create HrefClickableSpan for clickable links
-  STATE_LOGD("linkUrls.size()=%zu, linkUrls.empty()=%d", linkUrls.size(), linkUrls.empty() ? 1 : 0);
-  if (!linkUrls.empty()) {
-    STATE_LOGD("Serializing %zu linkUrls to MapBuffer", linkUrls.size());
-    auto linkUrlsBuilder = MapBufferBuilder();
-#if DEBUG_STATE_SERIALIZATION
-    int nonEmptyCount = 0;
-#endif
-    for (size_t i = 0; i < linkUrls.size(); i++) {
-      // MapBuffer::Key is uint16_t, so we can only store up to UINT16_MAX entries
-      if (i > UINT16_MAX) {
-        STATE_LOGD("Warning: linkUrls exceeds MapBuffer::Key capacity (%zu > %u), truncating", i, UINT16_MAX);
-        break;
-      }
-      STATE_LOGD("  linkUrls[%zu] = '%s' (empty=%d)", i, linkUrls[i].c_str(), linkUrls[i].empty() ? 1 : 0);
-      if (!linkUrls[i].empty()) {
-        linkUrlsBuilder.putString(static_cast<MapBuffer::Key>(i), linkUrls[i]);
-#if DEBUG_STATE_SERIALIZATION
-        nonEmptyCount++;
-#endif
-      }
+  STATE_LOGD("links: %zu urls, %zu runs", links.urls().size(), links.runs().size());
+  if (!links.empty()) {
+    std::vector<MapBuffer> urlBuffers;
+    urlBuffers.reserve(links.urls().size());
+    for (const auto& url : links.urls()) {
+      auto urlBuilder = MapBufferBuilder();
+      urlBuilder.putString(LINK_URL_KEY_URL, url);
+      urlBuffers.push_back(urlBuilder.build());
+    }
+
+    std::vector<MapBuffer> runBuffers;
+    runBuffers.reserve(links.runs().size());
+    for (const auto& run : links.runs()) {
+      auto runBuilder = MapBufferBuilder();
+      runBuilder.putInt(LINK_RUN_KEY_FIRST_FRAGMENT, static_cast<int32_t>(run.firstFragment));
+      runBuilder.putInt(LINK_RUN_KEY_FRAGMENT_COUNT, static_cast<int32_t>(run.fragmentCount));
+      runBuilder.putInt(LINK_RUN_KEY_URL_INDEX, static_cast<int32_t>(run.urlId));
+      runBuffers.push_back(runBuilder.build());
     }
-    STATE_LOGD("Added %d non-empty linkUrls to builder", nonEmptyCount);
-    builder.putMapBuffer(HTML_STATE_KEY_LINK_URLS, linkUrlsBuilder.build());
-    STATE_LOGD("Serialized linkUrls to key %d", HTML_STATE_KEY_LINK_URLS);
+
+    builder.putMapBufferList(HTML_STATE_KEY_LINK_URLS, urlBuffers);
+    builder.putMapBufferList(HTML_STATE_KEY_LINK_RUNS, runBuffers);
+    STATE_LOGD("Serialized links to keys %d and %d", HTML_STATE_KEY_LINK_URLS, HTML_STATE_KEY_LINK_RUNS);
   } else {
-    STATE_LOGD("No linkUrls to serialize");
+    STATE_LOGD("No links to serialize");
+  }
+}
+
+MapBuffer FabricRichTextState::getMapBuffer() const {
+  // The state no longer holds the markup, so its text's size stands in
+  size_t textBytes = summary.textBytes;
+  parsing::TraceScope trace(
+      "getMapBuffer", parsing::TraceArgs{contentHash, textBytes, attributedString.getFragments().size()});
+  parsing::PhaseTimer timer(parsing::MetricPhase::Serialize, textBytes);
+  auto builder = MapBufferBuilder();
+
+  STATE_LOGD("getMapBuffer() called - attributedString has %zu fragments, links has %zu runs",
+             attributedString.getFragments().size(), links.runs().size());
+
+  // Serialize paragraph attributes
+  auto paMapBuffer = toMapBuffer(paragraphAttributes);
+  builder.putMapBuffer(HTML_STATE_KEY_PARAGRAPH_ATTRIBUTES, paMapBuffer);
+
+  if (sendsDeltaOnly()) {
+    // A view still showing the delta's base splices in the changed runs;
+    // the full layout is only encoded if it does not (see getDynamic())
+    builder.putLong(HTML_STATE_KEY_CONTENT_HASH, static_cast<int64_t>(contentHash));
+    auto deltaBuilder = MapBufferBuilder();
+    deltaBuilder.putLong(DELTA_KEY_BASE_HASH, static_cast<int64_t>(delta->baseHash));
+    deltaBuilder.putInt(DELTA_KEY_UTF16_START, static_cast<int32_t>(delta->utf16Start));
+    deltaBuilder.putInt(DELTA_KEY_UTF16_REMOVED, static_cast<int32_t>(delta->utf16Removed));
+    deltaBuilder.putString(DELTA_KEY_LAYOUT, base64Encode(deltaLayout->serialize()));
+    builder.putMapBuffer(HTML_STATE_KEY_DELTA, deltaBuilder.build());
+    STATE_LOGD("Serialized delta: %zu runs replace %zu at UTF-16 offset %zu",
+               delta->inserted, delta->removed, delta->utf16Start);
+  } else if (wireFormat() == StateWireFormat::Compact) {
+    // Text, styles, runs and links as one flat buffer; Kotlin builds spans
+    // from it without a map lookup per fragment
+    auto encoded = encodeCompactLayout();
+    // Truncated content hash; hashing the encoding would be another pass over it
+    builder.putInt(HTML_STATE_KEY_HASH, static_cast<int32_t>(contentHash));
+    builder.putString(HTML_STATE_KEY_COMPACT_LAYOUT, encoded);
+    builder.putLong(HTML_STATE_KEY_CONTENT_HASH, static_cast<int64_t>(contentHash));
+    STATE_LOGD("Serialized compact layout: %zu bytes encoded", encoded.size());
+  } else {
+    serializeAttributedString(builder);
   }
 
   // Serialize numberOfLines
@@ -100,12 +231,25 @@ MapBuffer FabricRichTextState::getMapBuffer() const {
   builder.putInt(HTML_STATE_KEY_WRITING_DIRECTION, writingDirectionInt);
   STATE_LOGD("Serialized writingDirection=%d (RTL=%d)", writingDirectionInt, writingDirection == WritingDirectionState::RTL ? 1 : 0);
 
-  // Serialize accessibilityLabel (screen reader friendly text with pauses)
-  if (!accessibilityLabel.empty()) {
+  // Serialize accessibilityLabel (screen reader friendly text with pauses).
+  // Without pauses it equals the text, which Kotlin falls back to.
+  if (!accessibilityPauses.empty()) {
+    auto accessibilityLabel = parsing::buildAccessibilityLabel(attributedString, accessibilityPauses);
     builder.putString(HTML_STATE_KEY_ACCESSIBILITY_LABEL, accessibilityLabel);
     STATE_LOGD("Serialized accessibilityLabel (%zu chars)", accessibilityLabel.length());
   }
 
+  // Serialize the document summary, so Kotlin can skip passes the text does not need
+  auto summaryBuilder = MapBufferBuilder();
+  summaryBuilder.putInt(SUMMARY_KEY_FEATURES, summary.features);
+  summaryBuilder.putInt(SUMMARY_KEY_LINK_COUNT, static_cast<int32_t>(summary.linkCount));
+  summaryBuilder.putInt(SUMMARY_KEY_MAX_HEADING_LEVEL, summary.maxHeadingLevel);
+  summaryBuilder.putInt(SUMMARY_KEY_FRAGMENT_COUNT, static_cast<int32_t>(summary.fragmentCount));
+  summaryBuilder.putInt(SUMMARY_KEY_TEXT_BYTES, static_cast<int32_t>(std::min<uint32_t>(summary.textBytes, INT32_MAX)));
+  builder.putMapBuffer(HTML_STATE_KEY_SUMMARY, summaryBuilder.build());
+  STATE_LOGD("Serialized summary: features=0x%x links=%u fragments=%u",
+             summary.features, summary.linkCount, summary.fragmentCount);
+
   return builder.build();
 }
 
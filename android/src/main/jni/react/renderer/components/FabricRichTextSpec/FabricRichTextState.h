@@ -19,6 +19,16 @@
 #include <react/renderer/mapbuffer/MapBuffer.h>
 #include <react/renderer/mapbuffer/MapBufferBuilder.h>
 
+#include "parsing/CompactTextLayout.h"
+#include "parsing/DocumentSummary.h"
+#include "parsing/LinkTable.h"
+#include "parsing/TextDelta.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace facebook::react {
 
 /**
@@ -30,6 +40,14 @@ enum class WritingDirectionState {
   RTL    // Right-to-left
 };
 
+/**
+ * How getMapBuffer() serializes the attributed string and links.
+ */
+enum class StateWireFormat {
+  Compact,   // One CompactTextLayout buffer (default)
+  MapBuffer  // RN's AttributedString MapBuffer plus the link lists
+};
+
 /**
  * State class for FabricRichText.
  *
@@ -50,11 +68,10 @@ class FabricRichTextState final {
   ParagraphAttributes paragraphAttributes;
 
   /**
-   * Link URLs indexed by fragment position.
-   * Empty string for non-link fragments.
+   * Link URLs by fragment range.
    * This enables Kotlin to create HrefClickableSpan for link detection.
    */
-  std::vector<std::string> linkUrls;
+  parsing::LinkTable links;
 
   /**
    * Maximum number of lines to display (0 = no limit)
@@ -72,28 +89,56 @@ class FabricRichTextState final {
   WritingDirectionState writingDirection{WritingDirectionState::LTR};
 
   /**
-   * Screen reader friendly version of text with proper pauses between list items.
-   * Built by C++ parser, can be overridden by React accessibilityLabel prop.
+   * Where the screen reader label pauses between list items. The label is
+   * built from attributedString when serialized, and only if there are
+   * pauses; otherwise Kotlin uses the text. Can be overridden by React
+   * accessibilityLabel prop.
+   */
+  std::vector<uint32_t> accessibilityPauses;
+
+  /**
+   * What attributedString contains, so Kotlin can skip link, bidi and
+   * accessibility work the text does not need.
+   */
+  parsing::DocumentSummary summary;
+
+  /**
+   * contentHash() of attributedString and links; 0 when not computed.
+   */
+  uint64_t contentHash{0};
+
+  /**
+   * Compact layout of attributedString and links, built once in layout() and
+   * shared with the next state so its delta can be computed against it.
+   */
+  std::shared_ptr<const parsing::CompactTextLayout> compactLayout;
+
+  /**
+   * Run delta from the previous state (delta->baseHash) to this one, and the
+   * layout of the inserted runs. Unset for the first state of a view.
    */
-  std::string accessibilityLabel;
+  std::optional<parsing::TextDelta> delta;
+  std::shared_ptr<const parsing::CompactTextLayout> deltaLayout;
 
   FabricRichTextState() = default;
 
   FabricRichTextState(
       AttributedString attributedString,
       ParagraphAttributes paragraphAttributes,
-      std::vector<std::string> linkUrls = {},
+      parsing::LinkTable links = {},
       int numberOfLines = 0,
       Float animationDuration = 0.2f,
       WritingDirectionState writingDirection = WritingDirectionState::LTR,
-      std::string accessibilityLabel = "")
+      std::vector<uint32_t> accessibilityPauses = {},
+      parsing::DocumentSummary summary = {})
       : attributedString(std::move(attributedString)),
         paragraphAttributes(std::move(paragraphAttributes)),
-        linkUrls(std::move(linkUrls)),
+        links(std::move(links)),
         numberOfLines(numberOfLines),
         animationDuration(animationDuration),
         writingDirection(writingDirection),
-        accessibilityLabel(std::move(accessibilityLabel)) {}
+        accessibilityPauses(std::move(accessibilityPauses)),
+        summary(summary) {}
 
   /**
    * Constructor for state updates from JS (not supported for FabricRichText).
@@ -104,8 +149,40 @@ class FabricRichTextState final {
     react_native_assert(false && "Not supported");
   }
 
+  /**
+   * Empty, except for delta-only states: their full compact layout, for a
+   * view that does not show the delta's base.
+   */
   folly::dynamic getDynamic() const;
+
+  /**
+   * The delta alone when it applies, otherwise the full text.
+   */
   MapBuffer getMapBuffer() const;
+
+  /**
+   * Wire format for all states serialized after the call. Defaults to
+   * Compact unless built with FABRIC_RICH_TEXT_COMPACT_STATE=0; switching
+   * keeps the RN-compatible path available for A/B comparisons.
+   */
+  static void setWireFormat(StateWireFormat format);
+  static StateWireFormat wireFormat();
+
+ private:
+  /**
+   * StateWireFormat::MapBuffer: RN's AttributedString MapBuffer and links.
+   */
+  void serializeAttributedString(MapBufferBuilder& builder) const;
+
+  /**
+   * True if getMapBuffer() carries only the delta, not the full layout.
+   */
+  bool sendsDeltaOnly() const;
+
+  /**
+   * Base64 of compactLayout, or of a layout built from attributedString.
+   */
+  std::string encodeCompactLayout() const;
 };
 
 } // namespace facebook::react
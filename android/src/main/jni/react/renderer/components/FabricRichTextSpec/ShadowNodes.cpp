@@ -13,6 +13,7 @@
 
 #include <react/renderer/components/view/ViewShadowNode.h>
 #include <android/log.h>
+#include <optional>
 
 // Debug flag for verbose measurement logging.
 // Set to 1 to enable detailed logging for HTML parsing and layout measurement.
@@ -46,24 +47,16 @@ namespace {
 FabricRichTextShadowNode::FabricRichTextShadowNode(
     const ShadowNode& sourceShadowNode,
     const ShadowNodeFragment& fragment)
-    : ConcreteViewShadowNode(sourceShadowNode, fragment) {}
+    : ConcreteViewShadowNode(sourceShadowNode, fragment),
+      _parseSession(static_cast<const FabricRichTextShadowNode&>(sourceShadowNode)._parseSession),
+      _preparedMarkup(static_cast<const FabricRichTextShadowNode&>(sourceShadowNode)._preparedMarkup) {}
 
 std::string FabricRichTextShadowNode::stripHtmlTags(const std::string& html) {
   // Delegate to shared parser
   return FabricMarkupParser::stripMarkupTags(html);
 }
 
-// NOTE: This method modifies _linkUrls and _accessibilityLabel. It must only be called while holding _mutex.
-AttributedString FabricRichTextShadowNode::parseHtmlToAttributedString(
-    const std::string& html,
-    Float fontSizeMultiplier) const {
-
-  if (html.empty()) {
-    _linkUrls.clear();
-    _accessibilityLabel.clear();
-    return AttributedString{};
-  }
-
+StyleOptions FabricRichTextShadowNode::styleOptions(Float fontSizeMultiplier) const {
   const auto& props = getConcreteProps();
 
   // Extract props for the shared parser
@@ -72,36 +65,71 @@ AttributedString FabricRichTextShadowNode::parseHtmlToAttributedString(
     baseFontSize = props.fontSize;
   }
 
-  bool allowFontScaling = props.allowFontScaling;
-  Float maxFontSizeMultiplier = props.maxFontSizeMultiplier;
-  Float lineHeight = props.lineHeight;
-  int32_t color = props.color;
-
   if (DEBUG_CPP_MEASUREMENT) {
     LOGD("Props: fontSize=%f lineHeight=%f allowFontScaling=%d",
-         props.fontSize, props.lineHeight, allowFontScaling ? 1 : 0);
+         props.fontSize, props.lineHeight, props.allowFontScaling ? 1 : 0);
     LOGD("Props: color=0x%08X (decimal=%d)", props.color, props.color);
     LOGD("Props: tagStyles='%s'", props.tagStyles.substr(0, 100).c_str());
   }
 
-  // Call parser with all props - get link URLs and accessibility label too
-  auto parseResult = FabricMarkupParser::parseMarkupWithLinkUrls(
-      html,
-      baseFontSize,
-      fontSizeMultiplier,
-      allowFontScaling,
-      maxFontSizeMultiplier,
-      lineHeight,
-      props.fontWeight,
-      props.fontFamily,
-      props.fontStyle,
-      props.letterSpacing,
-      color,
-      props.tagStyles);
-
-  _linkUrls = std::move(parseResult.linkUrls);
-  _accessibilityLabel = std::move(parseResult.accessibilityLabel);
-  return parseResult.attributedString;
+  StyleOptions options;
+  options.baseFontSize = baseFontSize;
+  options.fontSizeMultiplier = fontSizeMultiplier;
+  options.allowFontScaling = props.allowFontScaling;
+  options.maxFontSizeMultiplier = props.maxFontSizeMultiplier;
+  options.lineHeight = props.lineHeight;
+  options.fontWeight = props.fontWeight;
+  options.fontFamily = props.fontFamily;
+  options.fontStyle = props.fontStyle;
+  options.letterSpacing = props.letterSpacing;
+  options.color = props.color;
+  options.tagStyles = props.tagStyles;
+  return options;
+}
+
+void FabricRichTextShadowNode::prepareContent() {
+  const auto& props = getConcreteProps();
+  auto options = styleOptions(FabricPreparedMarkup::predictedFontSizeMultiplier());
+
+  if (_preparedMarkup && _preparedMarkup->matches(props.text, options, props.numberOfLines)) {
+    return;
+  }
+
+  if (DEBUG_CPP_MEASUREMENT) {
+    LOGD("prepareContent() - parsing %zu bytes (%s)", props.text.length(),
+         _preparedMarkup ? "inline" : "background");
+  }
+
+  _preparedMarkup = FabricPreparedMarkup::prepare(
+      _preparedMarkup, _parseSession, props.text, options, props.numberOfLines);
+}
+
+// NOTE: Parses through the shared session. It must only be called while holding _mutex.
+FabricPreparedMarkup::ParseResultPtr FabricRichTextShadowNode::parseHtml(
+    const std::string& html,
+    Float fontSizeMultiplier,
+    const ContentBudget& budget) const {
+
+  if (html.empty()) {
+    static const auto empty = std::make_shared<const FabricMarkupParser::ParseResult>();
+    return empty;
+  }
+
+  auto options = styleOptions(fontSizeMultiplier);
+
+  // Pick up the result prepared when props were adopted. Nodes that were
+  // never adopted parse here, through the same incremental session.
+  auto parseResult = _preparedMarkup
+      ? _preparedMarkup->resolve(options, false, budget)
+      : std::make_shared<const FabricMarkupParser::ParseResult>(
+            FabricMarkupParser::parseMarkupIncremental(*_parseSession, html, options));
+
+  if (DEBUG_CPP_MEASUREMENT) {
+    LOGD("Incremental parse resumed: %d, truncated: %d",
+         _parseSession->lastUpdateResumed() ? 1 : 0, parseResult->isTruncated ? 1 : 0);
+  }
+
+  return parseResult;
 }
 
 Size FabricRichTextShadowNode::measureContent(
@@ -109,6 +137,7 @@ Size FabricRichTextShadowNode::measureContent(
     const LayoutConstraints& layoutConstraints) const {
 
   const auto& props = getConcreteProps();
+  TraceScope trace("measureContent", parsing::TraceArgs{0, props.text.size(), 0});
 
   Float fontSizeMultiplier = 1.0;
   if (layoutContext.fontSizeMultiplier > 0) {
@@ -124,14 +153,19 @@ Size FabricRichTextShadowNode::measureContent(
          layoutConstraints.minimumSize.height, layoutConstraints.maximumSize.height);
   }
 
-  // Parse HTML and cache result under mutex protection.
-  // Use local variable for measurement to minimize lock duration.
-  AttributedString localAttributedString;
+  // Take the prepared parse result and cache it under mutex protection.
+  // The result is immutable, so measure it outside the lock without copying.
+  // With numberOfLines, only the text the visible lines can hold at this
+  // width is parsed.
+  auto budget = ContentBudget::forLines(props.numberOfLines, layoutConstraints.maximumSize.width);
+  FabricPreparedMarkup::ParseResultPtr parsed;
   {
     std::lock_guard<std::mutex> lock(_mutex);
-    localAttributedString = parseHtmlToAttributedString(props.text, fontSizeMultiplier);
-    _attributedString = localAttributedString;
+    parsed = parseHtml(props.text, fontSizeMultiplier, budget);
+    _parseResult = parsed;
   }
+  const auto& localAttributedString = parsed->attributedString;
+  trace.args().fragments = localAttributedString.getFragments().size();
 
   if (localAttributedString.isEmpty()) {
     if (DEBUG_CPP_MEASUREMENT) {
@@ -180,11 +214,13 @@ Size FabricRichTextShadowNode::measureContent(
   const auto textLayoutManager = std::make_shared<const TextLayoutManager>(
       getContextContainer());
 
+  std::optional<PhaseTimer> measureTimer(std::in_place, MetricPhase::Measure, props.text.size());
   auto measuredSize = textLayoutManager->measure(
       AttributedStringBox{localAttributedString},
       paragraphAttributes,
       textLayoutContext,
       layoutConstraints);
+  measureTimer.reset();
 
   if (DEBUG_CPP_MEASUREMENT) {
     LOGW("TextLayoutManager result: %f x %f",
@@ -198,6 +234,7 @@ void FabricRichTextShadowNode::layout(LayoutContext layoutContext) {
   ensureUnsealed();
 
   const auto& props = getConcreteProps();
+  TraceScope trace("layout", parsing::TraceArgs{0, props.text.size(), 0});
 
   // Create paragraph attributes for state
   auto paragraphAttributes = ParagraphAttributes{};
@@ -205,16 +242,17 @@ void FabricRichTextShadowNode::layout(LayoutContext layoutContext) {
   paragraphAttributes.maximumNumberOfLines = (numberOfLines > 0) ? numberOfLines : 0;
   paragraphAttributes.ellipsizeMode = EllipsizeMode::Tail;
 
-  // Copy cached data under mutex protection to avoid data races.
-  AttributedString localAttributedString;
-  std::vector<std::string> localLinkUrls;
-  std::string localAccessibilityLabel;
+  // Take the measured result under mutex protection to avoid data races;
+  // state copies its fields once, below.
+  FabricPreparedMarkup::ParseResultPtr parsed;
   {
     std::lock_guard<std::mutex> lock(_mutex);
-    localAttributedString = _attributedString;
-    localLinkUrls = _linkUrls;
-    localAccessibilityLabel = _accessibilityLabel;
+    parsed = _parseResult;
   }
+  static const FabricMarkupParser::ParseResult kUnmeasured;
+  const auto& result = parsed ? *parsed : kUnmeasured;
+  const auto& localAttributedString = result.attributedString;
+  const auto& localLinks = result.links;
 
   // Get effective values for state
   int effectiveNumberOfLines = (props.numberOfLines > 0) ? props.numberOfLines : 0;
@@ -229,22 +267,54 @@ void FabricRichTextShadowNode::layout(LayoutContext layoutContext) {
     // "ltr" or any other value defaults to LTR
   }
 
-  // Set state with the parsed AttributedString, link URLs, and layout props
+  // Set state with the parsed AttributedString, links, and layout props
   // This passes the C++ parsed fragments to Kotlin via MapBuffer serialization,
   // eliminating the need for duplicate HTML parsing in the view layer.
-  setStateData(FabricRichTextState{
+  FabricRichTextState state{
       localAttributedString,
       paragraphAttributes,
-      localLinkUrls,
+      localLinks,
       effectiveNumberOfLines,
       animationDuration,
       writingDirection,
-      localAccessibilityLabel});
+      result.accessibilityPauses,
+      result.summary};
+
+  // The compact wire format also carries the run delta from the previous
+  // state, so a view still showing it only builds spans for changed runs
+  if (FabricRichTextState::wireFormat() == StateWireFormat::Compact) {
+    const auto& previous = getStateData();
+    if (previous.compactLayout && previous.attributedString == localAttributedString && previous.links == localLinks) {
+      state.contentHash = previous.contentHash;
+      state.compactLayout = previous.compactLayout;
+      state.delta = parsing::TextDelta{previous.contentHash};
+      state.deltaLayout = std::make_shared<const parsing::CompactTextLayout>(previous.compactLayout->slice(0, 0));
+    } else {
+      PhaseTimer timer(MetricPhase::Serialize, props.text.size());
+      state.contentHash = parsing::contentHash(localAttributedString, localLinks);
+      auto layout = std::make_shared<const parsing::CompactTextLayout>(localAttributedString, localLinks);
+      if (previous.compactLayout) {
+        state.delta = layout->diff(*previous.compactLayout);
+        state.delta->baseHash = previous.contentHash;
+        state.deltaLayout =
+            std::make_shared<const parsing::CompactTextLayout>(layout->slice(state.delta->first, state.delta->inserted));
+      }
+      state.compactLayout = std::move(layout);
+    }
+  }
+
+  {
+    TraceScope stateTrace("setStateData", parsing::TraceArgs{
+        state.contentHash, props.text.size(), localAttributedString.getFragments().size()});
+    trace.args().hash = state.contentHash;
+    trace.args().fragments = localAttributedString.getFragments().size();
+    setStateData(std::move(state));
+  }
 
   if (DEBUG_CPP_MEASUREMENT) {
-    LOGD("layout() - State set with %zu fragments, %zu linkUrls, numberOfLines=%d, writingDirection=%s, a11yLabel=%zu chars",
-         localAttributedString.getFragments().size(), localLinkUrls.size(),
-         effectiveNumberOfLines, props.writingDirection.c_str(), localAccessibilityLabel.length());
+    LOGD("layout() - State set with %zu fragments, %zu links, numberOfLines=%d, writingDirection=%s, a11yPauses=%zu",
+         localAttributedString.getFragments().size(), localLinks.runs().size(),
+         effectiveNumberOfLines, props.writingDirection.c_str(), getStateData().accessibilityPauses.size());
   }
 }
 
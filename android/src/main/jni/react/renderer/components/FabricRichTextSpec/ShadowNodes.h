@@ -19,7 +19,12 @@
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <jsi/jsi.h>
+#include <memory>
 #include <mutex>
+#include <vector>
+
+#include "FabricPreparedMarkup.h"
+#include "parsing/IncrementalParseSession.h"
 
 namespace facebook::react {
 
@@ -37,6 +42,9 @@ JSI_EXPORT extern const char FabricRichTextComponentName[];
  * Uses FabricRichTextState to pass parsed fragments to Kotlin via MapBuffer.
  * This ensures the view renders using the same data that was used for measurement,
  * eliminating measurement/rendering misalignment caused by duplicate parsing.
+ *
+ * Markup is parsed when props are adopted (see prepareContent()), so
+ * measureContent() only picks up the result.
  */
 class FabricRichTextShadowNode final : public ConcreteViewShadowNode<
     FabricRichTextComponentName,
@@ -59,23 +67,42 @@ class FabricRichTextShadowNode final : public ConcreteViewShadowNode<
 
   void layout(LayoutContext layoutContext) override;
 
+  /**
+   * Start parsing props.text for the current props.
+   * Called by FabricRichTextComponentDescriptor::adopt(); does nothing
+   * when text and style are unchanged from the source node.
+   */
+  void prepareContent();
+
   Size measureContent(
       const LayoutContext& layoutContext,
       const LayoutConstraints& layoutConstraints) const override;
 
  private:
-  AttributedString parseHtmlToAttributedString(
+  // Prepared markup shares its result rather than copying it per measure
+  FabricPreparedMarkup::ParseResultPtr parseHtml(
       const std::string& html,
-      Float fontSizeMultiplier) const;
+      Float fontSizeMultiplier,
+      const ContentBudget& budget = {}) const;
+
+  StyleOptions styleOptions(Float fontSizeMultiplier) const;
 
   static std::string stripHtmlTags(const std::string& html);
 
   // Mutex protecting mutable members from concurrent access.
   // measureContent() may be called concurrently by Fabric's layout system.
   mutable std::mutex _mutex;
-  mutable AttributedString _attributedString;
-  mutable std::vector<std::string> _linkUrls;
-  mutable std::string _accessibilityLabel;
+  // Last measured result, read by layout(); null until measured
+  mutable FabricPreparedMarkup::ParseResultPtr _parseResult;
+
+  // Incremental parser shared with clones of this node. When props.text grows
+  // by appends (streamed content), only the new tail is parsed.
+  std::shared_ptr<parsing::IncrementalParseSession> _parseSession =
+      std::make_shared<parsing::IncrementalParseSession>();
+
+  // Parse started by prepareContent(), shared with clones while text and
+  // style are unchanged.
+  std::shared_ptr<FabricPreparedMarkup> _preparedMarkup;
 };
 
 } // namespace facebook::react
@@ -3,13 +3,19 @@ package io.michaelfay.fabricrichtext
 import android.graphics.Typeface
 import android.text.Spannable
 import android.text.SpannableStringBuilder
+import android.text.Spanned
 import android.text.style.AbsoluteSizeSpan
 import android.text.style.StrikethroughSpan
 import android.text.style.StyleSpan
 import android.text.style.UnderlineSpan
+import android.util.Base64
 import android.util.Log
+import com.facebook.react.bridge.ReadableMap
 import com.facebook.react.common.mapbuffer.ReadableMapBuffer
 import com.facebook.react.uimanager.PixelUtil
+import java.nio.BufferUnderflowException
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
 
 /**
  * Represents a parsed text fragment from C++ AttributedString.
@@ -30,16 +36,45 @@ data class TextFragment(
     val linkUrl: String? = null  // href URL for <a> tags, null if not a link
 )
 
+/**
+ * Consecutive fragments [firstFragment, firstFragment + fragmentCount) that
+ * link to url. Runs arrive sorted by firstFragment and never overlap.
+ */
+data class LinkRun(
+    val firstFragment: Int,
+    val fragmentCount: Int,
+    val url: String
+)
+
+/**
+ * Replacement of [start, start + removedLength) in the text built from the
+ * state whose content hash is baseHash.
+ */
+data class SpannablePatch(
+    val baseHash: Long,
+    val start: Int,
+    val removedLength: Int,
+    val replacement: Spanned
+)
+
 /**
  * Result of parsing state from C++ MapBuffer.
  * Contains the Spannable and additional state fields.
+ *
+ * When the view already shows the base of the state's delta, only patch is
+ * built and spannable is null; rebuild() builds the full text if the patch
+ * can no longer be applied.
  */
 data class ParsedState(
-    val spannable: android.text.Spannable,
+    val spannable: android.text.Spannable?,
     val numberOfLines: Int,
     val animationDuration: Float,
     val isRTL: Boolean,
-    val accessibilityLabel: String? = null
+    val accessibilityLabel: String? = null,
+    val contentHash: Long = 0L,
+    val patch: SpannablePatch? = null,
+    val rebuild: () -> android.text.Spannable? = { spannable },
+    val summary: DocumentSummary = DocumentSummary.UNKNOWN
 )
 
 /**
@@ -73,6 +108,12 @@ data class ParsedState(
  * - TA_KEY_ALLOW_FONT_SCALING = 9
  * - TA_KEY_LETTER_SPACING = 10
  * - TA_KEY_LINE_HEIGHT = 11
+ *
+ * When the state carries HTML_STATE_KEY_COMPACT_LAYOUT instead, the text,
+ * styles, runs and links arrive as one base64 string holding the flat layout
+ * described in cpp/parsing/CompactTextLayout.h. States with a delta carry
+ * only the delta; their full layout is read from the state's dynamic data
+ * (DYNAMIC_KEY_COMPACT_LAYOUT), and only when the delta does not apply.
  */
 object FabricRichFragmentParser {
     private const val TAG = "FabricRichFragmentParser"
@@ -82,11 +123,50 @@ object FabricRichFragmentParser {
     private const val HTML_STATE_KEY_ATTRIBUTED_STRING = 0
     private const val HTML_STATE_KEY_PARAGRAPH_ATTRIBUTES = 1
     private const val HTML_STATE_KEY_HASH = 2
-    private const val HTML_STATE_KEY_LINK_URLS = 3
     private const val HTML_STATE_KEY_NUMBER_OF_LINES = 4
     private const val HTML_STATE_KEY_ANIMATION_DURATION = 5
     private const val HTML_STATE_KEY_WRITING_DIRECTION = 6
     private const val HTML_STATE_KEY_ACCESSIBILITY_LABEL = 7
+    private const val HTML_STATE_KEY_LINK_URLS = 8
+    private const val HTML_STATE_KEY_LINK_RUNS = 9
+    private const val HTML_STATE_KEY_COMPACT_LAYOUT = 10
+    private const val HTML_STATE_KEY_CONTENT_HASH = 11
+    private const val HTML_STATE_KEY_DELTA = 12
+    private const val HTML_STATE_KEY_SUMMARY = 13
+
+    // Full compact layout of a delta-only state, in StateWrapper.stateData
+    private const val DYNAMIC_KEY_COMPACT_LAYOUT = "compactLayout"
+
+    // Summary keys
+    private const val SUMMARY_KEY_FEATURES = 0
+    private const val SUMMARY_KEY_LINK_COUNT = 1
+    private const val SUMMARY_KEY_MAX_HEADING_LEVEL = 2
+    private const val SUMMARY_KEY_FRAGMENT_COUNT = 3
+    private const val SUMMARY_KEY_TEXT_BYTES = 4
+
+    // Delta keys
+    private const val DELTA_KEY_BASE_HASH = 0
+    private const val DELTA_KEY_UTF16_START = 1
+    private const val DELTA_KEY_UTF16_REMOVED = 2
+    private const val DELTA_KEY_LAYOUT = 3
+
+    // Compact text layout (cpp/parsing/CompactTextLayout.h)
+    private const val COMPACT_LAYOUT_MAGIC = 0x4C545246
+    private const val COMPACT_LAYOUT_VERSION = 1
+    private const val COMPACT_STYLE_HAS_FOREGROUND_COLOR = 1
+    private const val COMPACT_STYLE_HAS_BACKGROUND_COLOR = 1 shl 1
+    private const val COMPACT_STYLE_ITALIC = 1 shl 2
+    private const val COMPACT_STYLE_ALLOW_FONT_SCALING = 1 shl 3
+    private const val COMPACT_STYLE_HAS_FONT_SIZE = 1 shl 4
+    private val COMPACT_DECORATIONS = arrayOf(null, "underline", "strikethrough", "underline-strikethrough")
+
+    // Link URL table entry keys
+    private const val LINK_URL_KEY_URL = 0
+
+    // Link run keys
+    private const val LINK_RUN_KEY_FIRST_FRAGMENT = 0
+    private const val LINK_RUN_KEY_FRAGMENT_COUNT = 1
+    private const val LINK_RUN_KEY_URL_INDEX = 2
 
     // AttributedString keys (from conversions.h)
     private const val AS_KEY_HASH = 0
@@ -132,56 +212,66 @@ object FabricRichFragmentParser {
             return emptyList()
         }
 
-        // Extract link URLs if present (fragment index -> URL string)
-        // Keys are fragment indices (sparse), values are URL strings
-        val linkUrls = mutableMapOf<Int, String>()
-        if (stateMapBuffer.contains(HTML_STATE_KEY_LINK_URLS)) {
-            val linkUrlsBuffer = stateMapBuffer.getMapBuffer(HTML_STATE_KEY_LINK_URLS)
-            if (DEBUG) {
-                Log.d(TAG, "Found linkUrls MapBuffer with ${linkUrlsBuffer.count} entries")
-            }
-            // Iterate over the MapBuffer's entries using its iterator
-            // Each entry has a key (fragment index) and value (URL string)
-            val iterator = linkUrlsBuffer.iterator()
-            while (iterator.hasNext()) {
-                val entry = iterator.next()
-                val fragmentIndex = entry.key
-                try {
-                    val url = linkUrlsBuffer.getString(fragmentIndex)
-                    if (url.isNotEmpty()) {
-                        linkUrls[fragmentIndex] = url
-                        if (DEBUG) {
-                            Log.d(TAG, "  linkUrls[$fragmentIndex] = '$url'")
-                        }
-                    }
-                } catch (e: Exception) {
-                    // Key might not exist or be wrong type, skip
-                    if (DEBUG) {
-                        Log.d(TAG, "  linkUrls[$fragmentIndex] - error: ${e.message}")
-                    }
-                }
-            }
-        } else {
+        val linkRuns = parseLinkRuns(stateMapBuffer)
+
+        val attributedStringBuffer = stateMapBuffer.getMapBuffer(HTML_STATE_KEY_ATTRIBUTED_STRING)
+        return parseAttributedString(attributedStringBuffer, linkRuns)
+    }
+
+    /**
+     * Parses the interned link table: a list of URLs and the fragment runs
+     * that reference them by index.
+     */
+    private fun parseLinkRuns(stateMapBuffer: ReadableMapBuffer): List<LinkRun> {
+        if (!stateMapBuffer.contains(HTML_STATE_KEY_LINK_URLS) ||
+            !stateMapBuffer.contains(HTML_STATE_KEY_LINK_RUNS)) {
             if (DEBUG) {
-                Log.d(TAG, "No linkUrls in state")
+                Log.d(TAG, "No links in state")
             }
+            return emptyList()
         }
 
-        val attributedStringBuffer = stateMapBuffer.getMapBuffer(HTML_STATE_KEY_ATTRIBUTED_STRING)
-        return parseAttributedString(attributedStringBuffer, linkUrls)
+        val urls = stateMapBuffer.getMapBufferList(HTML_STATE_KEY_LINK_URLS).map { it.getString(LINK_URL_KEY_URL) }
+        val runs = mutableListOf<LinkRun>()
+        for (runBuffer in stateMapBuffer.getMapBufferList(HTML_STATE_KEY_LINK_RUNS)) {
+            val url = urls.getOrNull(runBuffer.getInt(LINK_RUN_KEY_URL_INDEX)) ?: continue
+            runs.add(
+                LinkRun(
+                    runBuffer.getInt(LINK_RUN_KEY_FIRST_FRAGMENT),
+                    runBuffer.getInt(LINK_RUN_KEY_FRAGMENT_COUNT),
+                    url
+                )
+            )
+        }
+
+        if (DEBUG) {
+            Log.d(TAG, "Found ${runs.size} link runs over ${urls.size} URLs")
+        }
+        return runs
     }
 
     /**
      * Parses the full state including fragments and layout props.
      * Returns a ParsedState containing the Spannable and additional state fields.
+     *
+     * @param currentContentHash Content hash of the text the view shows; when
+     *   it is the base of the state's delta, only the changed runs are built
+     * @param stateData Reads the state's dynamic data, which holds the full
+     *   layout of delta-only states
      */
-    fun parseFullState(stateMapBuffer: ReadableMapBuffer): ParsedState? {
-        val fragments = parseState(stateMapBuffer)
-        if (fragments.isEmpty()) {
-            return null
+    fun parseFullState(
+        stateMapBuffer: ReadableMapBuffer,
+        currentContentHash: Long = 0L,
+        stateData: () -> ReadableMap? = { null }
+    ): ParsedState? {
+        val contentHash = if (stateMapBuffer.contains(HTML_STATE_KEY_CONTENT_HASH)) {
+            stateMapBuffer.getLong(HTML_STATE_KEY_CONTENT_HASH)
+        } else {
+            0L
         }
-
-        val spannable = buildSpannableFromFragments(fragments)
+        val patch = if (currentContentHash != 0L) parsePatch(stateMapBuffer, currentContentHash) else null
+        val rebuild = { buildSpannableFromState(stateMapBuffer, stateData) }
+        val spannable = if (patch == null) rebuild() ?: return null else null
 
         // Extract numberOfLines (default 0 = no limit)
         val numberOfLines = if (stateMapBuffer.contains(HTML_STATE_KEY_NUMBER_OF_LINES)) {
@@ -211,11 +301,87 @@ object FabricRichFragmentParser {
             null
         }
 
+        val summary = parseSummary(stateMapBuffer)
+
         if (DEBUG) {
-            Log.d(TAG, "parseFullState: numberOfLines=$numberOfLines, animationDuration=$animationDuration, isRTL=$isRTL, a11yLabel=${accessibilityLabel?.length ?: 0} chars")
+            Log.d(TAG, "parseFullState: numberOfLines=$numberOfLines, animationDuration=$animationDuration, isRTL=$isRTL, a11yLabel=${accessibilityLabel?.length ?: 0} chars, summary=$summary")
         }
 
-        return ParsedState(spannable, numberOfLines, animationDuration, isRTL, accessibilityLabel)
+        return ParsedState(
+            spannable,
+            numberOfLines,
+            animationDuration,
+            isRTL,
+            accessibilityLabel,
+            contentHash,
+            patch,
+            if (spannable != null) ({ spannable }) else rebuild,
+            summary
+        )
+    }
+
+    /**
+     * Parses the document summary, or UNKNOWN for states without one.
+     */
+    private fun parseSummary(stateMapBuffer: ReadableMapBuffer): DocumentSummary {
+        if (!stateMapBuffer.contains(HTML_STATE_KEY_SUMMARY)) {
+            return DocumentSummary.UNKNOWN
+        }
+        val buffer = stateMapBuffer.getMapBuffer(HTML_STATE_KEY_SUMMARY)
+        return DocumentSummary(
+            buffer.getInt(SUMMARY_KEY_FEATURES),
+            buffer.getInt(SUMMARY_KEY_LINK_COUNT),
+            buffer.getInt(SUMMARY_KEY_MAX_HEADING_LEVEL),
+            buffer.getInt(SUMMARY_KEY_FRAGMENT_COUNT),
+            buffer.getInt(SUMMARY_KEY_TEXT_BYTES)
+        )
+    }
+
+    /**
+     * Builds the full text of the state, or null if it has none.
+     */
+    private fun buildSpannableFromState(stateMapBuffer: ReadableMapBuffer, stateData: () -> ReadableMap?): Spannable? {
+        val spannable = if (stateMapBuffer.contains(HTML_STATE_KEY_COMPACT_LAYOUT)) {
+            val bytes = Base64.decode(stateMapBuffer.getString(HTML_STATE_KEY_COMPACT_LAYOUT), Base64.DEFAULT)
+            buildSpannableFromCompactLayout(bytes)
+        } else if (stateMapBuffer.contains(HTML_STATE_KEY_DELTA)) {
+            if (DEBUG) {
+                Log.d(TAG, "Delta does not apply, reading the full layout")
+            }
+            val encoded = stateData()?.takeIf { it.hasKey(DYNAMIC_KEY_COMPACT_LAYOUT) }
+                ?.getString(DYNAMIC_KEY_COMPACT_LAYOUT) ?: return null
+            buildSpannableFromCompactLayout(Base64.decode(encoded, Base64.DEFAULT))
+        } else {
+            val fragments = parseState(stateMapBuffer)
+            if (fragments.isEmpty()) null else buildSpannableFromFragments(fragments)
+        }
+        return spannable?.takeIf { it.isNotEmpty() }
+    }
+
+    /**
+     * Builds the state's delta as a patch if its base is baseHash. The delta
+     * covers whole runs, so the replacement's spans never straddle the
+     * boundaries of the text it is spliced into.
+     */
+    private fun parsePatch(stateMapBuffer: ReadableMapBuffer, baseHash: Long): SpannablePatch? {
+        if (!stateMapBuffer.contains(HTML_STATE_KEY_DELTA)) {
+            return null
+        }
+        val delta = stateMapBuffer.getMapBuffer(HTML_STATE_KEY_DELTA)
+        if (delta.getLong(DELTA_KEY_BASE_HASH) != baseHash) {
+            if (DEBUG) {
+                Log.d(TAG, "Delta base does not match the shown text, rebuilding")
+            }
+            return null
+        }
+        val bytes = Base64.decode(delta.getString(DELTA_KEY_LAYOUT), Base64.DEFAULT)
+        val replacement = buildSpannableFromCompactLayout(bytes) ?: return null
+        return SpannablePatch(
+            baseHash,
+            delta.getInt(DELTA_KEY_UTF16_START),
+            delta.getInt(DELTA_KEY_UTF16_REMOVED),
+            replacement
+        )
     }
 
     /**
@@ -223,7 +389,7 @@ object FabricRichFragmentParser {
      */
     private fun parseAttributedString(
         buffer: ReadableMapBuffer,
-        linkUrls: Map<Int, String> = emptyMap()
+        linkRuns: List<LinkRun> = emptyList()
     ): List<TextFragment> {
         val fragments = mutableListOf<TextFragment>()
 
@@ -240,9 +406,15 @@ object FabricRichFragmentParser {
             Log.d(TAG, "Parsing $fragmentCount fragments, full string: '${fullString.take(50)}...'")
         }
 
+        // Runs are sorted, so one cursor finds the link of each fragment
+        var runIndex = 0
         for (i in 0 until fragmentCount) {
             val fragmentBuffer = fragmentsBuffer.getMapBuffer(i)
-            val linkUrl = linkUrls[i]  // Get link URL for this fragment index
+            while (runIndex < linkRuns.size &&
+                linkRuns[runIndex].firstFragment + linkRuns[runIndex].fragmentCount <= i) {
+                runIndex++
+            }
+            val linkUrl = linkRuns.getOrNull(runIndex)?.takeIf { it.firstFragment <= i }?.url
             val fragment = parseFragment(fragmentBuffer, linkUrl)
             if (fragment != null) {
                 fragments.add(fragment)
@@ -369,138 +541,241 @@ object FabricRichFragmentParser {
             val endPos = builder.length
 
             if (startPos < endPos) {
-                // Apply font size (use SP to match C++ TextLayoutManager measurement)
-                builder.setSpan(
-                    AbsoluteSizeSpan(fragment.fontSize.toInt(), true),
-                    startPos,
-                    endPos,
-                    Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
-                )
+                applySpans(builder, fragment, fragment.linkUrl, startPos, endPos)
+            }
+        }
 
-                // Apply font weight
-                val isBold = FabricGeneratedConstants.isBoldWeight(fragment.fontWeight)
-                val isItalic = FabricGeneratedConstants.isItalicStyle(fragment.fontStyle)
+        if (DEBUG) {
+            Log.d(TAG, "Built Spannable with ${builder.length} chars from ${fragments.size} fragments")
+        }
 
-                val style = when {
-                    isBold && isItalic -> Typeface.BOLD_ITALIC
-                    isBold -> Typeface.BOLD
-                    isItalic -> Typeface.ITALIC
-                    else -> null
-                }
+        return builder
+    }
 
-                if (style != null) {
-                    builder.setSpan(
-                        StyleSpan(style),
-                        startPos,
-                        endPos,
-                        Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
-                    )
-                }
+    /**
+     * Builds a Spannable from a compact text layout: the text is one string
+     * and each run applies a shared style, so no per-fragment lookups are made.
+     * Returns null for another layout version or a malformed buffer.
+     *
+     * @param bytes Layout bytes as written by CompactTextLayout::serialize()
+     */
+    fun buildSpannableFromCompactLayout(bytes: ByteArray): Spannable? {
+        val buffer = ByteBuffer.wrap(bytes).order(ByteOrder.LITTLE_ENDIAN)
+        try {
+            if (buffer.int != COMPACT_LAYOUT_MAGIC || buffer.short.toInt() != COMPACT_LAYOUT_VERSION) {
+                Log.w(TAG, "Unsupported compact layout")
+                return null
+            }
+            buffer.short // reserved
+            val length = buffer.int
+
+            val strings = Array(checkedCount(buffer, 4)) {
+                val byteLength = buffer.int
+                val string = String(bytes, buffer.position(), byteLength, Charsets.UTF_8)
+                buffer.position(buffer.position() + byteLength)
+                string
+            }
+            val text = strings.firstOrNull() ?: return null
+            if (text.length != length) {
+                Log.w(TAG, "Compact layout text length mismatch: ${text.length} != $length")
+                return null
+            }
 
-                // Apply line height via FabricCustomLineHeightSpan
-                // Uses React Native's PixelUtil for conversion - this is the exact same code path
-                // that TextLayoutManager uses for measurement, ensuring pixel-perfect alignment.
-                // - PixelUtil.toPixelFromSP() when allowFontScaling=true (respects font scale)
-                // - PixelUtil.toPixelFromDIP() when allowFontScaling=false (ignores font scale)
-                if (fragment.lineHeight > 0) {
-                    val lineHeightPx = if (fragment.allowFontScaling) {
-                        PixelUtil.toPixelFromSP(fragment.lineHeight)
-                    } else {
-                        PixelUtil.toPixelFromDIP(fragment.lineHeight)
-                    }
-                    if (DEBUG) {
-                        val unitName = if (fragment.allowFontScaling) "SP" else "DIP"
-                        Log.d(TAG, "Applying FabricCustomLineHeightSpan: ${fragment.lineHeight} ($unitName) -> ${lineHeightPx}px")
-                    }
-                    builder.setSpan(
-                        FabricCustomLineHeightSpan(lineHeightPx),
-                        startPos,
-                        endPos,
-                        Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
-                    )
-                }
+            // Each style becomes one TextFragment template shared by its runs
+            val styles = Array(checkedCount(buffer, 28)) {
+                val fontSize = buffer.float
+                val lineHeight = buffer.float
+                val letterSpacing = buffer.float
+                val foregroundColor = buffer.int
+                val backgroundColor = buffer.int
+                val fontWeight = buffer.short.toInt() and 0xFFFF
+                val flags = buffer.get().toInt() and 0xFF
+                val decoration = buffer.get().toInt() and 0xFF
+                val fontFamily = buffer.int
+                TextFragment(
+                    text = "",
+                    fontSize = if (flags and COMPACT_STYLE_HAS_FONT_SIZE != 0) fontSize else FabricGeneratedConstants.DEFAULT_FONT_SIZE,
+                    lineHeight = lineHeight,
+                    fontWeight = if (fontWeight != 0) fontWeight.toString() else null,
+                    fontStyle = if (flags and COMPACT_STYLE_ITALIC != 0) "italic" else null,
+                    fontFamily = strings.getOrNull(fontFamily),
+                    letterSpacing = letterSpacing,
+                    foregroundColor = if (flags and COMPACT_STYLE_HAS_FOREGROUND_COLOR != 0) foregroundColor else null,
+                    backgroundColor = if (flags and COMPACT_STYLE_HAS_BACKGROUND_COLOR != 0) backgroundColor else null,
+                    allowFontScaling = flags and COMPACT_STYLE_ALLOW_FONT_SCALING != 0,
+                    textDecorationLine = COMPACT_DECORATIONS.getOrNull(decoration)
+                )
+            }
 
-                // Apply foreground color if specified
-                if (fragment.foregroundColor != null) {
-                    if (DEBUG) {
-                        Log.d(TAG, "Applying ForegroundColorSpan: 0x${fragment.foregroundColor.toUInt().toString(16).uppercase()} to range [$startPos, $endPos] text='${fragment.text.take(20)}'")
-                    }
-                    builder.setSpan(
-                        android.text.style.ForegroundColorSpan(fragment.foregroundColor),
-                        startPos,
-                        endPos,
-                        Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
-                    )
-                } else {
-                    if (DEBUG) {
-                        Log.d(TAG, "No ForegroundColorSpan for range [$startPos, $endPos] text='${fragment.text.take(20)}'")
-                    }
+            val builder = SpannableStringBuilder(text)
+            val runCount = checkedCount(buffer, 16)
+            for (i in 0 until runCount) {
+                val start = buffer.int
+                val end = start + buffer.int
+                val style = styles[buffer.int]
+                val linkUrl = strings.getOrNull(buffer.int)
+                if (start < end) {
+                    applySpans(builder, style, linkUrl, start, end)
                 }
+            }
 
-                // Apply background color if specified
-                if (fragment.backgroundColor != null) {
-                    builder.setSpan(
-                        android.text.style.BackgroundColorSpan(fragment.backgroundColor),
-                        startPos,
-                        endPos,
-                        Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
-                    )
-                }
+            if (DEBUG) {
+                Log.d(TAG, "Built Spannable with ${builder.length} chars from $runCount runs over ${styles.size} styles")
+            }
+            return builder
+        } catch (e: BufferUnderflowException) {
+            Log.w(TAG, "Truncated compact layout", e)
+        } catch (e: IndexOutOfBoundsException) {
+            Log.w(TAG, "Malformed compact layout", e)
+        }
+        return null
+    }
 
-                // Apply text decoration (underline, strikethrough)
-                // Values from C++ toString(TextDecorationLineType): "none", "underline", "strikethrough", "underline-strikethrough"
-                when (fragment.textDecorationLine) {
-                    "underline" -> {
-                        builder.setSpan(
-                            UnderlineSpan(),
-                            startPos,
-                            endPos,
-                            Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
-                        )
-                    }
-                    "strikethrough" -> {
-                        builder.setSpan(
-                            StrikethroughSpan(),
-                            startPos,
-                            endPos,
-                            Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
-                        )
-                    }
-                    "underline-strikethrough" -> {
-                        builder.setSpan(
-                            UnderlineSpan(),
-                            startPos,
-                            endPos,
-                            Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
-                        )
-                        builder.setSpan(
-                            StrikethroughSpan(),
-                            startPos,
-                            endPos,
-                            Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
-                        )
-                    }
-                }
+    /**
+     * Reads a table count, rejecting counts the remaining bytes cannot hold.
+     */
+    private fun checkedCount(buffer: ByteBuffer, minRecordSize: Int): Int {
+        val count = buffer.int
+        if (count < 0 || count.toLong() * minRecordSize > buffer.remaining()) {
+            throw IndexOutOfBoundsException("Table of $count entries exceeds ${buffer.remaining()} bytes")
+        }
+        return count
+    }
 
-                // Apply link span for <a href="..."> tags
-                if (!fragment.linkUrl.isNullOrEmpty()) {
-                    if (DEBUG) {
-                        Log.d(TAG, "Creating HrefClickableSpan for linkUrl='${fragment.linkUrl}' at range [$startPos, $endPos]")
-                    }
-                    builder.setSpan(
-                        HrefClickableSpan(fragment.linkUrl),
-                        startPos,
-                        endPos,
-                        Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
-                    )
-                }
+    /**
+     * Applies the spans of one style to [startPos, endPos).
+     */
+    private fun applySpans(
+        builder: SpannableStringBuilder,
+        fragment: TextFragment,
+        linkUrl: String?,
+        startPos: Int,
+        endPos: Int
+    ) {
+        // Apply font size (use SP to match C++ TextLayoutManager measurement)
+        builder.setSpan(
+            AbsoluteSizeSpan(fragment.fontSize.toInt(), true),
+            startPos,
+            endPos,
+            Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
+        )
+
+        // Apply font weight
+        val isBold = FabricGeneratedConstants.isBoldWeight(fragment.fontWeight)
+        val isItalic = FabricGeneratedConstants.isItalicStyle(fragment.fontStyle)
+
+        val style = when {
+            isBold && isItalic -> Typeface.BOLD_ITALIC
+            isBold -> Typeface.BOLD
+            isItalic -> Typeface.ITALIC
+            else -> null
+        }
+
+        if (style != null) {
+            builder.setSpan(
+                StyleSpan(style),
+                startPos,
+                endPos,
+                Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
+            )
+        }
+
+        // Apply line height via FabricCustomLineHeightSpan
+        // Uses React Native's PixelUtil for conversion - this is the exact same code path
+        // that TextLayoutManager uses for measurement, ensuring pixel-perfect alignment.
+        // - PixelUtil.toPixelFromSP() when allowFontScaling=true (respects font scale)
+        // - PixelUtil.toPixelFromDIP() when allowFontScaling=false (ignores font scale)
+        if (fragment.lineHeight > 0) {
+            val lineHeightPx = if (fragment.allowFontScaling) {
+                PixelUtil.toPixelFromSP(fragment.lineHeight)
+            } else {
+                PixelUtil.toPixelFromDIP(fragment.lineHeight)
             }
+            if (DEBUG) {
+                val unitName = if (fragment.allowFontScaling) "SP" else "DIP"
+                Log.d(TAG, "Applying FabricCustomLineHeightSpan: ${fragment.lineHeight} ($unitName) -> ${lineHeightPx}px")
+            }
+            builder.setSpan(
+                FabricCustomLineHeightSpan(lineHeightPx),
+                startPos,
+                endPos,
+                Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
+            )
         }
 
-        if (DEBUG) {
-            Log.d(TAG, "Built Spannable with ${builder.length} chars from ${fragments.size} fragments")
+        // Apply foreground color if specified
+        if (fragment.foregroundColor != null) {
+            if (DEBUG) {
+                Log.d(TAG, "Applying ForegroundColorSpan: 0x${fragment.foregroundColor.toUInt().toString(16).uppercase()} to range [$startPos, $endPos]")
+            }
+            builder.setSpan(
+                android.text.style.ForegroundColorSpan(fragment.foregroundColor),
+                startPos,
+                endPos,
+                Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
+            )
+        } else {
+            if (DEBUG) {
+                Log.d(TAG, "No ForegroundColorSpan for range [$startPos, $endPos]")
+            }
         }
 
-        return builder
+        // Apply background color if specified
+        if (fragment.backgroundColor != null) {
+            builder.setSpan(
+                android.text.style.BackgroundColorSpan(fragment.backgroundColor),
+                startPos,
+                endPos,
+                Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
+            )
+        }
+
+        // Apply text decoration (underline, strikethrough)
+        // Values from C++ toString(TextDecorationLineType): "none", "underline", "strikethrough", "underline-strikethrough"
+        when (fragment.textDecorationLine) {
+            "underline" -> {
+                builder.setSpan(
+                    UnderlineSpan(),
+                    startPos,
+                    endPos,
+                    Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
+                )
+            }
+            "strikethrough" -> {
+                builder.setSpan(
+                    StrikethroughSpan(),
+                    startPos,
+                    endPos,
+                    Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
+                )
+            }
+            "underline-strikethrough" -> {
+                builder.setSpan(
+                    UnderlineSpan(),
+                    startPos,
+                    endPos,
+                    Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
+                )
+                builder.setSpan(
+                    StrikethroughSpan(),
+                    startPos,
+                    endPos,
+                    Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
+                )
+            }
+        }
+
+        // Apply link span for <a href="..."> tags
+        if (!linkUrl.isNullOrEmpty()) {
+            if (DEBUG) {
+                Log.d(TAG, "Creating HrefClickableSpan for linkUrl='$linkUrl' at range [$startPos, $endPos]")
+            }
+            builder.setSpan(
+                HrefClickableSpan(linkUrl),
+                startPos,
+                endPos,
+                Spannable.SPAN_EXCLUSIVE_EXCLUSIVE
+            )
+        }
     }
 }
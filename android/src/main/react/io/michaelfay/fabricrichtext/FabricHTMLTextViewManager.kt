@@ -243,8 +243,12 @@ class FabricRichTextViewManager : SimpleViewManager<FabricRichTextView>(),
         Log.d(TAG, "updateState: Received MapBuffer from C++")
       }
 
-      // Parse the full state including fragments and layout props
-      val parsedState = FabricRichFragmentParser.parseFullState(mapBuffer)
+      // Parse the full state including fragments and layout props. If the
+      // view still shows the base of the state's delta, only the changed
+      // runs are built; otherwise the full layout is read from stateData.
+      val parsedState = FabricRichFragmentParser.parseFullState(mapBuffer, view.getStateContentHash()) {
+        stateWrapper.stateData
+      }
 
       if (parsedState == null) {
         if (DEBUG_STATE) {
@@ -254,7 +258,7 @@ class FabricRichTextViewManager : SimpleViewManager<FabricRichTextView>(),
       }
 
       if (DEBUG_STATE) {
-        Log.d(TAG, "updateState: Built Spannable with ${parsedState.spannable.length} chars, " +
+        Log.d(TAG, "updateState: Built ${parsedState.spannable?.let { "Spannable with ${it.length} chars" } ?: "patch of ${parsedState.patch?.replacement?.length} chars"}, " +
             "numberOfLines=${parsedState.numberOfLines}, isRTL=${parsedState.isRTL}")
       }
 
@@ -279,7 +283,18 @@ class FabricRichTextViewManager : SimpleViewManager<FabricRichTextView>(),
       view.setAnimationDuration(extraData.animationDuration)
       view.setWritingDirectionFromState(extraData.isRTL)
       view.setResolvedAccessibilityLabel(extraData.accessibilityLabel)
-      view.setSpannableFromState(extraData.spannable)
+      view.setDocumentSummary(extraData.summary)
+      val patch = extraData.patch
+      val patched = patch != null && view.patchSpannableFromState(
+        patch.baseHash,
+        patch.start,
+        patch.removedLength,
+        patch.replacement,
+        extraData.contentHash
+      )
+      if (!patched) {
+        extraData.rebuild()?.let { view.setSpannableFromState(it, extraData.contentHash) }
+      }
     } else if (extraData is Spannable) {
       // Fallback for backward compatibility
       if (DEBUG_STATE) {
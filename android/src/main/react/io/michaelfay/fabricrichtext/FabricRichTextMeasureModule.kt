@@ -0,0 +1,35 @@
+package io.michaelfay.fabricrichtext
+
+import com.facebook.react.bridge.ReactApplicationContext
+import com.facebook.react.module.annotations.ReactModule
+import com.facebook.react.turbomodule.core.CallInvokerHolderImpl
+
+/**
+ * Installs measureRichTextBatch()'s JSI function.
+ *
+ * No platform text layout is reachable from the JS runtime's thread here,
+ * so batches are measured with the shared C++ height estimator.
+ */
+@ReactModule(name = FabricRichTextMeasureModule.NAME)
+class FabricRichTextMeasureModule(reactContext: ReactApplicationContext) :
+  NativeFabricRichTextMeasureSpec(reactContext) {
+
+  override fun getName(): String = NAME
+
+  override fun install(): Boolean {
+    val runtimePointer = reactApplicationContext.javaScriptContextHolder?.get() ?: 0L
+    val callInvokerHolder = reactApplicationContext.jsCallInvokerHolder as? CallInvokerHolderImpl
+    if (runtimePointer == 0L || callInvokerHolder == null) {
+      return false
+    }
+    nativeInstall(runtimePointer, callInvokerHolder)
+    return true
+  }
+
+  // Implemented in FabricRichTextMeasureJni.cpp, linked into the app's native library
+  private external fun nativeInstall(runtimePointer: Long, callInvokerHolder: CallInvokerHolderImpl)
+
+  companion object {
+    const val NAME = "FabricRichTextMeasure"
+  }
+}
@@ -1,6 +1,8 @@
 package io.michaelfay.fabricrichtext
 
 import android.graphics.Typeface
+import android.text.SpannableString
+import android.text.SpannableStringBuilder
 import android.text.Spanned
 import android.text.style.AbsoluteSizeSpan
 import android.text.style.StyleSpan
@@ -205,6 +207,40 @@ class FabricRichTextViewTest {
         assertTrue("Should have no bold spans after plain text", secondSpans.none { it.style == Typeface.BOLD })
     }
 
+    // ========== State Patching ==========
+
+    @Test
+    fun `patchSpannableFromState splices into text with matching hash`() {
+        view.setSpannableFromState(SpannableStringBuilder("First\nSecond"), contentHash = 42L)
+
+        val replacement = SpannableString("Bold")
+        replacement.setSpan(StyleSpan(Typeface.BOLD), 0, 4, Spanned.SPAN_EXCLUSIVE_EXCLUSIVE)
+        assertTrue(view.patchSpannableFromState(42L, 6, 6, replacement, contentHash = 43L))
+
+        val text = view.stateSpannable!!
+        assertEquals("First\nBold", text.toString())
+        val spans = text.getSpans(0, text.length, StyleSpan::class.java)
+        assertEquals(6, text.getSpanStart(spans.single { it.style == Typeface.BOLD }))
+        assertEquals(43L, view.getStateContentHash())
+    }
+
+    @Test
+    fun `patchSpannableFromState rejects a different base`() {
+        view.setSpannableFromState(SpannableStringBuilder("First"), contentHash = 42L)
+
+        assertFalse(view.patchSpannableFromState(7L, 0, 5, SpannableString("Other"), contentHash = 8L))
+        assertFalse(view.patchSpannableFromState(42L, 3, 5, SpannableString("Other"), contentHash = 8L))
+        assertEquals("First", view.stateSpannable.toString())
+        assertEquals(42L, view.getStateContentHash())
+    }
+
+    @Test
+    fun `patchSpannableFromState rejects text set without a hash`() {
+        view.setSpannableFromState(SpannableStringBuilder("First"))
+
+        assertFalse(view.patchSpannableFromState(0L, 0, 0, SpannableString("x"), contentHash = 8L))
+    }
+
     // ========== Performance ==========
 
     @Test
@@ -0,0 +1,86 @@
+/**
+ * FabricBatchMeasure.cpp
+ *
+ * Batch parse and measurement implementation.
+ */
+
+#include "FabricBatchMeasure.h"
+
+namespace facebook::react {
+
+EstimatingTextMeasurer::EstimatingTextMeasurer(HeightEstimator estimator)
+    : estimator_(std::move(estimator)) {}
+
+MeasuredText EstimatingTextMeasurer::measure(
+    const AttributedString& attributedString,
+    float width,
+    int numberOfLines) const {
+  auto estimate = estimator_.estimate(attributedString, width, numberOfLines);
+  return MeasuredText{estimate.width, estimate.height, estimate.lineCount};
+}
+
+MeasureKey FabricBatchMeasure::cacheKey(
+    const std::string& markup,
+    const StyleOptions& options,
+    float width,
+    int numberOfLines,
+    MeasureSource source,
+    float pointScaleFactor) {
+  return MeasureKey{
+      parsing::hashMarkupAndStyle(markup, options),
+      width,
+      pointScaleFactor,
+      numberOfLines > 0 ? numberOfLines : 0,
+      source};
+}
+
+std::vector<MeasuredText> FabricBatchMeasure::measure(
+    std::span<const Item> items,
+    float width,
+    const StyleOptions& options,
+    const TextMeasurer& measurer,
+    MeasureCache& cache) {
+  std::vector<MeasuredText> results(items.size());
+  std::vector<MeasureKey> keys(items.size());
+
+  // Full documents missing from the measure cache parse as one batch
+  std::vector<size_t> pending;
+  std::vector<FabricMarkupParser::BatchItem> batch;
+
+  for (size_t i = 0; i < items.size(); ++i) {
+    const auto& item = items[i];
+    if (item.markup.empty()) {
+      continue;
+    }
+    keys[i] = cacheKey(item.markup, options, width, item.numberOfLines, measurer.source(), measurer.pointScaleFactor());
+    if (auto cached = cache.find(keys[i])) {
+      results[i] = *cached;
+      continue;
+    }
+    if (item.numberOfLines > 0) {
+      auto parsed = FabricMarkupParser::parseMarkupWithinBudget(
+          item.markup, options, ContentBudget::forLines(item.numberOfLines, width));
+      {
+        PhaseTimer timer(MetricPhase::Measure, item.markup.size());
+        results[i] = measurer.measure(parsed.attributedString, width, item.numberOfLines);
+      }
+      cache.insert(keys[i], results[i]);
+      continue;
+    }
+    pending.push_back(i);
+    batch.emplace_back(item.markup, options);
+  }
+
+  auto parsed = FabricMarkupParser::parseBatch(batch);
+  for (size_t k = 0; k < pending.size(); ++k) {
+    size_t i = pending[k];
+    {
+      PhaseTimer timer(MetricPhase::Measure, items[i].markup.size());
+      results[i] = measurer.measure(parsed[k].attributedString, width, 0);
+    }
+    cache.insert(keys[i], results[i]);
+  }
+  return results;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,102 @@
+/**
+ * FabricBatchMeasure.h
+ *
+ * Parse and measure many documents at once, for lists that need row
+ * heights before rows mount. Backs the measureRichTextBatch() JSI function
+ * (FabricBatchMeasureJSI.h); this part has no JSI dependency.
+ */
+
+#pragma once
+
+#include "FabricMarkupParser.h"
+#include "parsing/MeasureCache.h"
+
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+using parsing::MeasureCache;
+using parsing::MeasuredText;
+using parsing::MeasureKey;
+using parsing::MeasureSource;
+
+/**
+ * Lays out parsed text at a width. Implementations must be thread-safe.
+ */
+class TextMeasurer {
+ public:
+  virtual ~TextMeasurer() = default;
+
+  /**
+   * @param numberOfLines Lines shown (0 = unlimited); lineCount ignores it
+   */
+  virtual MeasuredText measure(const AttributedString& attributedString, float width, int numberOfLines) const = 0;
+
+  virtual MeasureSource source() const = 0;
+
+  /**
+   * Pixel density the measurer rounds to.
+   */
+  virtual float pointScaleFactor() const {
+    return 1;
+  }
+};
+
+/**
+ * Measures with HeightEstimator, without platform text layout.
+ */
+class EstimatingTextMeasurer : public TextMeasurer {
+ public:
+  explicit EstimatingTextMeasurer(HeightEstimator estimator = {});
+
+  MeasuredText measure(const AttributedString& attributedString, float width, int numberOfLines) const override;
+
+  MeasureSource source() const override {
+    return MeasureSource::Estimate;
+  }
+
+ private:
+  HeightEstimator estimator_;
+};
+
+class FabricBatchMeasure {
+ public:
+  /**
+   * One document of a batch: props.text and props.numberOfLines.
+   */
+  struct Item {
+    std::string markup;
+    int numberOfLines = 0;
+  };
+
+  /**
+   * Measure items laid out at width with one style, in order.
+   *
+   * Parses through ParseCache::shared() (documents with numberOfLines only
+   * up to their line budget) and stores sizes in cache, so a row measured
+   * once is not laid out again while it stays cached; mounting the row
+   * picks up its parse result.
+   */
+  static std::vector<MeasuredText> measure(
+      std::span<const Item> items,
+      float width,
+      const StyleOptions& options,
+      const TextMeasurer& measurer,
+      MeasureCache& cache = MeasureCache::shared());
+
+  /**
+   * Measure cache key of markup laid out at width.
+   */
+  static MeasureKey cacheKey(
+      const std::string& markup,
+      const StyleOptions& options,
+      float width,
+      int numberOfLines,
+      MeasureSource source,
+      float pointScaleFactor);
+};
+
+} // namespace facebook::react
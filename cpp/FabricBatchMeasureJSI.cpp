@@ -0,0 +1,201 @@
+/**
+ * FabricBatchMeasureJSI.cpp
+ *
+ * JSI binding of batch measurement.
+ */
+
+#include "FabricBatchMeasureJSI.h"
+
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr const char* kGlobalName = "__fabricRichTextMeasureBatch";
+
+std::string stringProperty(jsi::Runtime& runtime, const jsi::Object& object, const char* name) {
+  auto value = object.getProperty(runtime, name);
+  return value.isString() ? value.getString(runtime).utf8(runtime) : std::string{};
+}
+
+double numberProperty(jsi::Runtime& runtime, const jsi::Object& object, const char* name, double fallback) {
+  auto value = object.getProperty(runtime, name);
+  return value.isNumber() ? value.getNumber() : fallback;
+}
+
+/**
+ * Same mapping as the shadow nodes' styleOptions() from props.
+ */
+StyleOptions styleOptionsFromValue(jsi::Runtime& runtime, const jsi::Value& value) {
+  StyleOptions options;
+  if (!value.isObject()) {
+    return options;
+  }
+  auto style = value.getObject(runtime);
+
+  double fontSize = numberProperty(runtime, style, "fontSize", NAN);
+  if (!std::isnan(fontSize) && fontSize > 0) {
+    options.baseFontSize = static_cast<float>(fontSize);
+  }
+  double fontScale = numberProperty(runtime, style, "fontScale", 1.0);
+  if (fontScale > 0) {
+    options.fontSizeMultiplier = static_cast<float>(fontScale);
+  }
+  auto allowFontScaling = style.getProperty(runtime, "allowFontScaling");
+  if (allowFontScaling.isBool()) {
+    options.allowFontScaling = allowFontScaling.getBool();
+  }
+  options.maxFontSizeMultiplier = static_cast<float>(numberProperty(runtime, style, "maxFontSizeMultiplier", NAN));
+  options.lineHeight = static_cast<float>(numberProperty(runtime, style, "lineHeight", NAN));
+  options.fontWeight = stringProperty(runtime, style, "fontWeight");
+  options.fontFamily = stringProperty(runtime, style, "fontFamily");
+  options.fontStyle = stringProperty(runtime, style, "fontStyle");
+  options.letterSpacing = static_cast<float>(numberProperty(runtime, style, "letterSpacing", NAN));
+  // processColor() yields unsigned ARGB on iOS and signed on Android
+  double color = numberProperty(runtime, style, "color", 0);
+  options.color = static_cast<int32_t>(static_cast<uint32_t>(static_cast<int64_t>(color)));
+  options.tagStyles = stringProperty(runtime, style, "tagStyles");
+  return options;
+}
+
+std::vector<FabricBatchMeasure::Item> itemsFromValue(jsi::Runtime& runtime, const jsi::Value& value) {
+  if (!value.isObject() || !value.getObject(runtime).isArray(runtime)) {
+    throw jsi::JSError(runtime, "measureRichTextBatch: items must be an array");
+  }
+  auto array = value.getObject(runtime).getArray(runtime);
+  size_t count = array.size(runtime);
+
+  std::vector<FabricBatchMeasure::Item> items(count);
+  for (size_t i = 0; i < count; ++i) {
+    auto element = array.getValueAtIndex(runtime, i);
+    if (element.isString()) {
+      items[i].markup = element.getString(runtime).utf8(runtime);
+    } else if (element.isObject()) {
+      auto object = element.getObject(runtime);
+      items[i].markup = stringProperty(runtime, object, "text");
+      items[i].numberOfLines = static_cast<int>(numberProperty(runtime, object, "numberOfLines", 0));
+    }
+  }
+  return items;
+}
+
+/**
+ * Promise callbacks of batches in progress, keyed by batch id. Only used
+ * on the JS thread and owned by the installed function, so JS values are
+ * created and destroyed there, and go away with the runtime; background
+ * work holds an id and a weak reference.
+ */
+struct PendingBatches {
+  struct Callbacks {
+    jsi::Value resolve;
+    jsi::Value reject;
+  };
+
+  uint64_t nextId = 0;
+  std::unordered_map<uint64_t, Callbacks> callbacks;
+};
+
+jsi::Array resultsToArray(jsi::Runtime& runtime, const std::vector<MeasuredText>& results) {
+  jsi::Array array(runtime, results.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    jsi::Object size(runtime);
+    size.setProperty(runtime, "width", static_cast<double>(results[i].width));
+    size.setProperty(runtime, "height", static_cast<double>(results[i].height));
+    size.setProperty(runtime, "lineCount", static_cast<double>(results[i].lineCount));
+    array.setValueAtIndex(runtime, i, std::move(size));
+  }
+  return array;
+}
+
+} // namespace
+
+void installFabricBatchMeasure(
+    jsi::Runtime& runtime,
+    std::shared_ptr<CallInvoker> jsInvoker,
+    std::shared_ptr<const TextMeasurer> measurer) {
+  auto pending = std::make_shared<PendingBatches>();
+  auto measureBatch = [jsInvoker, measurer, pending](
+                          jsi::Runtime& runtime,
+                          const jsi::Value&,
+                          const jsi::Value* args,
+                          size_t count) -> jsi::Value {
+    if (count < 2 || !args[1].isNumber()) {
+      throw jsi::JSError(runtime, "measureRichTextBatch: expected (items, width, style)");
+    }
+    auto items = itemsFromValue(runtime, args[0]);
+    auto width = static_cast<float>(args[1].getNumber());
+    auto options = count > 2 ? styleOptionsFromValue(runtime, args[2]) : StyleOptions{};
+
+    auto executor = [jsInvoker, measurer, pending, items = std::move(items), width, options](
+                        jsi::Runtime& runtime,
+                        const jsi::Value&,
+                        const jsi::Value* args,
+                        size_t) -> jsi::Value {
+      uint64_t id = pending->nextId++;
+      pending->callbacks.emplace(
+          id, PendingBatches::Callbacks{jsi::Value(runtime, args[0]), jsi::Value(runtime, args[1])});
+
+      // Arguments are copied; nothing below touches the runtime until the
+      // results are handed back on the JS thread. Batches share the parse
+      // scheduler's workers, behind content that is on screen.
+      std::weak_ptr<PendingBatches> weakPending = pending;
+      ParseScheduler::shared().post(
+          [jsInvoker, measurer, items, width, options, id, weakPending]() {
+            std::vector<MeasuredText> results;
+            std::optional<std::string> error;
+            try {
+              results = FabricBatchMeasure::measure(items, width, options, *measurer);
+            } catch (const std::exception& e) {
+              error = e.what();
+            }
+            jsInvoker->invokeAsync(
+                [weakPending, id, results = std::move(results), error](jsi::Runtime& runtime) {
+                  // Gone with the runtime's global if it was torn down
+                  auto pending = weakPending.lock();
+                  if (!pending) {
+                    return;
+                  }
+                  auto it = pending->callbacks.find(id);
+                  if (it == pending->callbacks.end()) {
+                    return;
+                  }
+                  auto callbacks = std::move(it->second);
+                  pending->callbacks.erase(it);
+                  if (error) {
+                    auto errorConstructor = runtime.global().getPropertyAsFunction(runtime, "Error");
+                    callbacks.reject.asObject(runtime).asFunction(runtime).call(
+                        runtime,
+                        errorConstructor.callAsConstructor(runtime, jsi::String::createFromUtf8(runtime, *error)));
+                    return;
+                  }
+                  callbacks.resolve.asObject(runtime).asFunction(runtime).call(
+                      runtime, resultsToArray(runtime, results));
+                });
+          },
+          ParseLane::Prefetch);
+      return jsi::Value::undefined();
+    };
+
+    auto promiseConstructor = runtime.global().getPropertyAsFunction(runtime, "Promise");
+    return promiseConstructor.callAsConstructor(
+        runtime,
+        jsi::Function::createFromHostFunction(
+            runtime, jsi::PropNameID::forAscii(runtime, "executor"), 2, std::move(executor)));
+  };
+
+  runtime.global().setProperty(
+      runtime,
+      kGlobalName,
+      jsi::Function::createFromHostFunction(
+          runtime, jsi::PropNameID::forAscii(runtime, kGlobalName), 3, std::move(measureBatch)));
+}
+
+} // namespace facebook::react
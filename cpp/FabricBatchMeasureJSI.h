@@ -0,0 +1,38 @@
+/**
+ * FabricBatchMeasureJSI.h
+ *
+ * JSI binding of FabricBatchMeasure, installed by the platform
+ * FabricRichTextMeasure modules and wrapped by measureRichTextBatch() in JS.
+ */
+
+#pragma once
+
+#include "FabricBatchMeasure.h"
+
+#include <ReactCommon/CallInvoker.h>
+#include <jsi/jsi.h>
+
+#include <memory>
+
+namespace facebook::react {
+
+/**
+ * Install global.__fabricRichTextMeasureBatch(items, width, style) into
+ * runtime. The function copies its arguments, parses and measures on a
+ * ParseScheduler worker in the Prefetch lane and returns a Promise of one
+ * { width, height, lineCount } per item. The Promise's callbacks stay on
+ * the JS thread; a batch finishing after the runtime is gone is dropped.
+ *
+ * items: strings, or { text, numberOfLines } objects
+ * style: { fontSize, lineHeight, fontWeight, fontFamily, fontStyle,
+ *          letterSpacing, color (processed), tagStyles (JSON string),
+ *          allowFontScaling, maxFontSizeMultiplier, fontScale }
+ *
+ * Must be called on the JS thread.
+ */
+void installFabricBatchMeasure(
+    jsi::Runtime& runtime,
+    std::shared_ptr<CallInvoker> jsInvoker,
+    std::shared_ptr<const TextMeasurer> measurer);
+
+} // namespace facebook::react
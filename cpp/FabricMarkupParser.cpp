@@ -8,10 +8,56 @@
 #include "FabricMarkupParser.h"
 #include "parsing/MarkupSegmentParser.h"
 #include "parsing/AttributedStringBuilder.h"
+#include "parsing/ParallelMarkupParser.h"
+#include "parsing/ParseStats.h"
+#include "parsing/PipelineMetrics.h"
 #include "parsing/TextNormalizer.h"
+#include "parsing/Utf8Validator.h"
+
+#include <algorithm>
+#include <optional>
 
 namespace facebook::react {
 
+namespace {
+
+// Markup fed between budget checks in parseMarkupWithinBudget()
+constexpr size_t kBudgetChunkSize = 2048;
+
+FabricMarkupParser::ParseResult toParseResult(const parsing::AttributedStringResult& built) {
+  FabricMarkupParser::ParseResult result;
+  result.attributedString = built.attributedString;
+  result.links = built.links;
+  result.accessibilityPauses = built.accessibilityPauses;
+  result.limitsHit = built.limitsHit;
+  result.summary = built.summary;
+  return result;
+}
+
+FabricMarkupParser::ParseResult toParseResult(parsing::AttributedStringResult&& built) {
+  FabricMarkupParser::ParseResult result;
+  result.attributedString = std::move(built.attributedString);
+  result.links = std::move(built.links);
+  result.accessibilityPauses = std::move(built.accessibilityPauses);
+  result.limitsHit = built.limitsHit;
+  result.summary = built.summary;
+  return result;
+}
+
+} // namespace
+
+std::string FabricMarkupParser::ParseResult::accessibilityLabel() const {
+  return parsing::buildAccessibilityLabel(attributedString, accessibilityPauses);
+}
+
+void FabricMarkupParser::buildUtf16Index(ParseResult& result, bool includeText) {
+  if (result.utf16Index) {
+    return;
+  }
+  result.utf16Index = std::make_shared<const Utf16TextIndex>(
+      result.attributedString, result.links, includeText);
+}
+
 std::string FabricMarkupParser::stripMarkupTags(const std::string& markup) {
   return parsing::stripMarkupTags(markup);
 }
@@ -42,33 +88,243 @@ FabricMarkupParser::ParseResult FabricMarkupParser::parseMarkupWithLinkUrls(
     Float letterSpacing,
     int32_t color,
     const std::string& tagStyles) {
+  StyleOptions options;
+  options.baseFontSize = baseFontSize;
+  options.fontSizeMultiplier = fontSizeMultiplier;
+  options.allowFontScaling = allowFontScaling;
+  options.maxFontSizeMultiplier = maxFontSizeMultiplier;
+  options.lineHeight = lineHeight;
+  options.fontWeight = fontWeight;
+  options.fontFamily = fontFamily;
+  options.fontStyle = fontStyle;
+  options.letterSpacing = letterSpacing;
+  options.color = color;
+  options.tagStyles = tagStyles;
+  return parseMarkupWithLinkUrls(markup, options);
+}
 
-  ParseResult result;
+FabricMarkupParser::ParseResult FabricMarkupParser::parseMarkupWithLinkUrls(
+    const std::string& markup,
+    const StyleOptions& options) {
 
   if (markup.empty()) {
-    return result;
+    return ParseResult{};
+  }
+
+  // Cached results and in-flight background parses are reused; otherwise
+  // parses on this thread. Markup is sanitized and inter-tag whitespace
+  // normalized inline, and large documents are split across threads at
+  // top-level blocks.
+  return toParseResult(*ParseScheduler::shared().parseNow(markup, options));
+}
+
+FabricMarkupParser::ParseResult FabricMarkupParser::parseMarkupWithinBudget(
+    const std::string& markup,
+    const StyleOptions& options,
+    const ContentBudget& budget) {
+
+  if (budget.isUnlimited()) {
+    return parseMarkupWithLinkUrls(markup, options);
+  }
+  if (markup.empty()) {
+    return ParseResult{};
   }
 
-  // Normalize inter-tag whitespace before parsing
-  std::string normalizedMarkup = normalizeInterTagWhitespace(markup);
+  // A full result parsed ahead of time costs nothing
+  auto& cache = ParseCache::shared();
+  if (auto cached = cache.find(markup, options)) {
+    return toParseResult(*cached);
+  }
 
-  auto segments = parsing::parseMarkupToSegments(normalizedMarkup);
+  parsing::recordParse(parsing::ParseKind::Budgeted);
+  parsing::TraceScope trace("parseMarkupWithinBudget", parsing::TraceArgs{0, markup.size(), 0});
+  if (trace.enabled()) {
+    trace.args().hash = parsing::hashMarkup(markup);
+  }
+  parsing::FragmentBuildContext context(options);
+  parsing::ContentBudgetMeter meter(budget, options, context);
+  parsing::MarkupSegmentParser parser(parsing::renderingParserOptions());
+  std::string_view input = markup;
+  std::string repairBuffer;
+  size_t offset = 0;
+  size_t measured = 0;
+  // Chunks are validated as they are fed, so validation counts as tokenizing
+  std::optional<parsing::PhaseTimer> tokenizeTimer(std::in_place, parsing::MetricPhase::Tokenize, markup.size());
+  while (offset < input.size() && !meter.exhausted()) {
+    // Chunks end on code point boundaries, so each validates on its own
+    auto chunk = input.substr(offset, kBudgetChunkSize);
+    if (offset + chunk.size() < input.size()) {
+      chunk.remove_suffix(parsing::incompleteUtf8Suffix(chunk));
+    }
+    parser.feed(parsing::ensureValidUtf8(chunk, repairBuffer));
+    offset += chunk.size();
 
-  if (segments.empty()) {
+    const auto& segments = parser.segments();
+    for (; measured < segments.size(); ++measured) {
+      meter.add(segments[measured]);
+    }
+  }
+  parser.finish();
+  tokenizeTimer.reset();
+
+  std::optional<parsing::PhaseTimer> buildTimer(std::in_place, parsing::MetricPhase::Build, markup.size());
+  auto built = parsing::buildAttributedString(parser.segments(), options, context);
+  built.limitsHit = parser.limitsHit();
+  built.summary.addLimitsHit(built.limitsHit);
+  buildTimer.reset();
+  trace.args().fragments = built.attributedString.getFragments().size();
+  if (offset < input.size()) {
+    auto result = toParseResult(std::move(built));
+    result.isTruncated = true;
+    result.summary.set(parsing::DocumentFeature::Truncated);
     return result;
   }
 
-  // Delegate to AttributedStringBuilder
-  auto buildResult = parsing::buildAttributedString(
-      segments, baseFontSize, fontSizeMultiplier, allowFontScaling,
-      maxFontSizeMultiplier, lineHeight, fontWeight, fontFamily,
-      fontStyle, letterSpacing, color, tagStyles);
+  // The whole document fit: share it like any full parse
+  auto shared = std::make_shared<const parsing::AttributedStringResult>(std::move(built));
+  cache.insert(markup, options, shared);
+  return toParseResult(*shared);
+}
+
+HeightEstimate FabricMarkupParser::estimateSize(
+    const std::string& markup,
+    const StyleOptions& options,
+    float width,
+    int numberOfLines,
+    const HeightEstimator& estimator) {
+  auto result = parseMarkupWithinBudget(markup, options, ContentBudget::forLines(numberOfLines, width));
+  return estimator.estimate(result.attributedString, width, numberOfLines);
+}
+
+std::vector<FabricMarkupParser::ParseResult> FabricMarkupParser::parseBatch(
+    std::span<const BatchItem> items) {
+  return parseBatch(items, BatchOptions{});
+}
 
-  result.attributedString = std::move(buildResult.attributedString);
-  result.linkUrls = std::move(buildResult.linkUrls);
-  result.accessibilityLabel = std::move(buildResult.accessibilityLabel);
+std::vector<FabricMarkupParser::ParseResult> FabricMarkupParser::parseBatch(
+    std::span<const BatchItem> items,
+    const BatchOptions& batchOptions) {
+  std::vector<ParseResult> results(items.size());
 
-  return result;
+  // Style setup is shared by all items with the same options
+  std::vector<const StyleOptions*> styles;
+  std::vector<parsing::FragmentBuildContext> contexts;
+  std::vector<size_t> styleIndex(items.size());
+  for (size_t i = 0; i < items.size(); ++i) {
+    const StyleOptions& options = items[i].second;
+    size_t index = 0;
+    while (index < styles.size() && *styles[index] != options) {
+      index++;
+    }
+    if (index == styles.size()) {
+      styles.push_back(&options);
+      contexts.emplace_back(options);
+    }
+    styleIndex[i] = index;
+  }
+
+  auto& cache = ParseCache::shared();
+  auto parseRange = [&](size_t begin, size_t end) {
+    parsing::MarkupSegmentParser parser(parsing::renderingParserOptions());
+    std::string repairBuffer;
+    for (size_t i = begin; i < end; ++i) {
+      const auto& [markup, options] = items[i];
+      if (markup.empty()) {
+        continue;
+      }
+      if (auto cached = cache.find(markup, options)) {
+        results[i] = toParseResult(*cached);
+        continue;
+      }
+
+      parsing::recordParse(parsing::ParseKind::Full);
+      parsing::TraceScope trace("parseMarkup", parsing::TraceArgs{0, markup.size(), 0});
+      if (trace.enabled()) {
+        trace.args().hash = parsing::hashMarkup(markup);
+      }
+      std::string_view input;
+      {
+        parsing::PhaseTimer timer(parsing::MetricPhase::Sanitize, markup.size());
+        input = parsing::ensureValidUtf8(markup, repairBuffer);
+      }
+      {
+        parsing::PhaseTimer timer(parsing::MetricPhase::Tokenize, markup.size());
+        parser.reset();
+        parser.feed(input);
+        parser.finish();
+      }
+      std::optional<parsing::PhaseTimer> buildTimer(std::in_place, parsing::MetricPhase::Build, markup.size());
+      auto built = parsing::buildAttributedString(parser.segments(), options, contexts[styleIndex[i]]);
+      built.limitsHit = parser.limitsHit();
+      built.summary.addLimitsHit(built.limitsHit);
+      buildTimer.reset();
+      trace.args().fragments = built.attributedString.getFragments().size();
+      if (batchOptions.populateCache) {
+        auto shared = std::make_shared<const parsing::AttributedStringResult>(std::move(built));
+        cache.insert(markup, options, shared);
+        results[i] = toParseResult(*shared);
+      } else {
+        results[i] = toParseResult(std::move(built));
+      }
+    }
+  };
+
+  if (batchOptions.pool != nullptr && items.size() > 1) {
+    // A few ranges per participant so stealing can even out long documents
+    size_t rangeCount = std::min(items.size(), (batchOptions.pool->workerCount() + 1) * 4);
+    batchOptions.pool->parallelFor(rangeCount, [&](size_t k) {
+      parseRange(k * items.size() / rangeCount, (k + 1) * items.size() / rangeCount);
+    });
+  } else {
+    parseRange(0, items.size());
+  }
+
+  return results;
+}
+
+FabricMarkupParser::ParseResult FabricMarkupParser::parseMarkupIncremental(
+    IncrementalParseSession& session,
+    const std::string& markup,
+    const StyleOptions& options) {
+
+  if (markup.empty()) {
+    session.reset();
+    return ParseResult{};
+  }
+
+  // A new component whose markup was parsed ahead of time (parseBatch,
+  // recycled list rows) needs no parse at all. The session adopts the
+  // parse kept with the result, so the first edit only parses the change.
+  bool firstParse = session.isEmpty();
+  auto& cache = ParseCache::shared();
+  if (firstParse) {
+    auto adopt = [&](const ParseScheduler::Result& result) {
+      if (result->snapshot != nullptr) {
+        session.adopt(result->snapshot);
+      }
+      return toParseResult(*result);
+    };
+    if (auto cached = cache.find(markup, options)) {
+      return adopt(cached);
+    }
+    // Scheduled ahead of time but not finished yet
+    if (auto joined = ParseScheduler::shared().join(markup, options)) {
+      return adopt(joined);
+    }
+    // The job may have finished between the two lookups
+    if (auto cached = cache.find(markup, options)) {
+      return adopt(cached);
+    }
+  }
+
+  auto buildResult = session.update(markup, options);
+  if (firstParse) {
+    auto shared = std::make_shared<parsing::AttributedStringResult>(buildResult);
+    shared->snapshot = session.snapshot();
+    cache.insert(markup, options, std::move(shared));
+  }
+
+  return toParseResult(std::move(buildResult));
 }
 
 AttributedString FabricMarkupParser::parseMarkupToAttributedString(
@@ -21,8 +21,27 @@
 #include "parsing/TextNormalizer.h"
 #include "parsing/MarkupSegmentParser.h"
 #include "parsing/AttributedStringBuilder.h"
+#include "parsing/IncrementalParseSession.h"
+#include "parsing/LinkTable.h"
+#include "parsing/ParallelMarkupParser.h"
+#include "parsing/ParseCache.h"
+#include "parsing/ParseScheduler.h"
+#include "parsing/Utf16TextIndex.h"
+#include "parsing/CompactTextLayout.h"
+#include "parsing/TextDelta.h"
+#include "parsing/ContentBudget.h"
+#include "parsing/DocumentSummary.h"
+#include "parsing/HeightEstimator.h"
+#include "parsing/ParseLimits.h"
+#include "parsing/ParseStats.h"
+#include "parsing/PipelineMetrics.h"
+#include "parsing/PipelinePhase.h"
+#include "parsing/PipelineTrace.h"
 
+#include <memory>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 #include <unordered_set>
 
@@ -41,6 +60,36 @@ using parsing::parseDirectionAttribute;
 using parsing::isStrongRTL;
 using parsing::isStrongLTR;
 
+using parsing::StyleOptions;
+using parsing::IncrementalParseSession;
+using parsing::ParseCache;
+using parsing::ParseScheduler;
+using parsing::ParseLane;
+using parsing::ParseGenerationToken;
+using parsing::Utf16TextIndex;
+using parsing::Utf16LinkRange;
+using parsing::LinkTable;
+using parsing::LinkRun;
+using parsing::CompactTextLayout;
+using parsing::TextDelta;
+using parsing::ContentBudget;
+using parsing::AdvanceWidthTable;
+using parsing::HeightEstimate;
+using parsing::HeightEstimator;
+using parsing::ParseStats;
+using parsing::PipelinePhase;
+using parsing::MetricPhase;
+using parsing::PhaseTimer;
+using parsing::PipelineMetrics;
+using parsing::TraceScope;
+using parsing::TraceSink;
+using parsing::ChromeTraceSink;
+using parsing::ParseLimit;
+using parsing::ParseLimits;
+using parsing::ParseLimitsHit;
+using parsing::DocumentFeature;
+using parsing::DocumentSummary;
+
 /**
  * Shared markup parser for cross-platform use.
  *
@@ -55,14 +104,29 @@ class FabricMarkupParser {
    */
   struct ParseResult {
     AttributedString attributedString;
-    std::vector<std::string> linkUrls;  // URLs indexed by fragment position
-    std::string accessibilityLabel;     // Screen reader friendly version with pauses between list items
+    LinkTable links;                    // Link URLs by fragment range
+    // Byte offsets of the pauses between list items in the accessibility label
+    std::vector<uint32_t> accessibilityPauses;
+    // UTF-16 offsets of fragments and links, set by buildUtf16Index()
+    std::shared_ptr<const Utf16TextIndex> utf16Index;
+    // Parsing stopped at a ContentBudget; the text is a prefix of the document's
+    bool isTruncated = false;
+    // ParseLimits the parse degraded at (see parsing/ParseLimits.h)
+    ParseLimitsHit limitsHit = 0;
+    // What the text contains, with Truncated and Degraded set from the above
+    DocumentSummary summary;
+
+    /**
+     * Screen reader friendly version of the text with pauses between list
+     * items. Built on each call, so measure-only callers never pay for it.
+     */
+    std::string accessibilityLabel() const;
   };
 
   /**
    * Parse markup string into an AttributedString.
    *
-   * @param markup The markup string to parse (should be pre-sanitized)
+   * @param markup The markup string to parse (sanitized against the allowlist while parsing)
    * @param baseFontSize Base font size in points
    * @param fontSizeMultiplier Accessibility scaling multiplier
    * @param allowFontScaling Whether to apply font scaling
@@ -108,9 +172,95 @@ class FabricMarkupParser {
       int32_t color,
       const std::string& tagStyles);
 
+  /**
+   * Parse markup string with full results, taking the base style as StyleOptions.
+   * Results are looked up in and stored to ParseCache::shared().
+   */
+  static ParseResult parseMarkupWithLinkUrls(
+      const std::string& markup,
+      const StyleOptions& options);
+
+  /**
+   * Parse only as much markup as a view showing budget.lines lines can
+   * display, for previews of long documents (numberOfLines). Parsing stops
+   * at the first chunk boundary past the budget and the result is marked
+   * isTruncated; the lines it shows, and their ellipsis, are the same as
+   * with the full text. An unlimited budget, a cached full result or a
+   * document that fits give the full parse.
+   */
+  static ParseResult parseMarkupWithinBudget(
+      const std::string& markup,
+      const StyleOptions& options,
+      const ContentBudget& budget);
+
+  /**
+   * Estimated size of markup laid out at width, without a platform text
+   * layout, for list rows that are not mounted yet. Parses through the
+   * parse cache; with numberOfLines, only the lines shown are parsed, so
+   * lineCount counts the parsed prefix.
+   */
+  static HeightEstimate estimateSize(
+      const std::string& markup,
+      const StyleOptions& options,
+      float width,
+      int numberOfLines,
+      const HeightEstimator& estimator);
+
+  /**
+   * One document of a parseBatch() call: markup and its base style.
+   */
+  using BatchItem = std::pair<std::string, StyleOptions>;
+
+  /**
+   * Options for parseBatch().
+   */
+  struct BatchOptions {
+    // Spread the batch across this pool (nullptr = parse on the calling thread)
+    parsing::ParseThreadPool* pool = nullptr;
+    // Store results in ParseCache::shared(), so components that later
+    // parse the same markup and style get them without parsing
+    bool populateCache = true;
+  };
+
+  /**
+   * Parse several documents ahead of time, e.g. the rows a list is about to
+   * mount. Equivalent to calling parseMarkupWithLinkUrls on each item, but
+   * the parser is reused across items and the style setup (including
+   * compiled tagStyles) is done once per distinct StyleOptions.
+   *
+   * @return Results in the order of items
+   */
+  static std::vector<ParseResult> parseBatch(
+      std::span<const BatchItem> items,
+      const BatchOptions& batchOptions);
+  static std::vector<ParseResult> parseBatch(std::span<const BatchItem> items);
+
+  /**
+   * Parse markup through an incremental session.
+   *
+   * When markup extends the markup last parsed by the session (streamed
+   * content), only the appended tail is parsed and built. Otherwise this is
+   * equivalent to parseMarkupWithLinkUrls. A session that has not parsed
+   * anything yet is served from ParseCache::shared() when possible, and
+   * resumes from the parse kept with the cached result.
+   */
+  static ParseResult parseMarkupIncremental(
+      IncrementalParseSession& session,
+      const std::string& markup,
+      const StyleOptions& options);
+
+  /**
+   * Attach a Utf16TextIndex to a parse result, for platforms that index
+   * text in UTF-16. Does nothing if the result already has one.
+   * @param includeText Also transcode the full text to UTF-16
+   */
+  static void buildUtf16Index(ParseResult& result, bool includeText = true);
+
   /**
    * Strip markup tags from a string, returning plain text content.
-   * Handles lists, line breaks, and basic formatting.
+   * Equal to the text of parseMarkupWithLinkUrls(markup, ...).attributedString
+   * for any style, but skips building styles; callers that parse anyway
+   * should read it from the parse result instead.
    */
   static std::string stripMarkupTags(const std::string& markup);
 
@@ -0,0 +1,93 @@
+/**
+ * FabricPipelineMetricsJSI.cpp
+ *
+ * JSI binding of pipeline metrics.
+ */
+
+#include "FabricPipelineMetricsJSI.h"
+
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr const char* kGlobalName = "__fabricRichTextMetrics";
+
+double milliseconds(uint64_t nanoseconds) {
+  return static_cast<double>(nanoseconds) / 1e6;
+}
+
+jsi::Object latencyToObject(jsi::Runtime& runtime, const parsing::LatencyHistogram& histogram) {
+  jsi::Object object(runtime);
+  object.setProperty(runtime, "count", static_cast<double>(histogram.count));
+  object.setProperty(runtime, "meanMs", milliseconds(histogram.meanNanoseconds()));
+  object.setProperty(runtime, "p50Ms", milliseconds(histogram.percentile(0.5)));
+  object.setProperty(runtime, "p99Ms", milliseconds(histogram.percentile(0.99)));
+  return object;
+}
+
+jsi::Object cacheToObject(jsi::Runtime& runtime, const parsing::CacheMetrics& cache) {
+  jsi::Object object(runtime);
+  object.setProperty(runtime, "hits", static_cast<double>(cache.hits));
+  object.setProperty(runtime, "misses", static_cast<double>(cache.misses));
+  object.setProperty(runtime, "hitRate", cache.hitRate());
+  object.setProperty(runtime, "entries", static_cast<double>(cache.entries));
+  object.setProperty(runtime, "bytes", static_cast<double>(cache.bytes));
+  return object;
+}
+
+jsi::Object metricsToObject(jsi::Runtime& runtime, const PipelineMetrics& metrics) {
+  jsi::Object parses(runtime);
+  parses.setProperty(runtime, "full", static_cast<double>(metrics.parses.full));
+  parses.setProperty(runtime, "incremental", static_cast<double>(metrics.parses.incremental));
+  parses.setProperty(runtime, "budgeted", static_cast<double>(metrics.parses.budgeted));
+
+  jsi::Object phases(runtime);
+  for (size_t p = 0; p < parsing::kMetricPhaseCount; ++p) {
+    auto phase = static_cast<MetricPhase>(p);
+    auto phaseObject = latencyToObject(runtime, metrics.latencyOf(phase));
+    phaseObject.setProperty(runtime, "bytes", static_cast<double>(metrics.bytes[p]));
+
+    jsi::Object bySize(runtime);
+    for (size_t s = 0; s < parsing::kDocumentSizeCount; ++s) {
+      auto size = static_cast<parsing::DocumentSize>(s);
+      const auto& histogram = metrics.latencyOf(phase, size);
+      if (histogram.count > 0) {
+        bySize.setProperty(runtime, parsing::documentSizeName(size), latencyToObject(runtime, histogram));
+      }
+    }
+    phaseObject.setProperty(runtime, "bySize", std::move(bySize));
+    phases.setProperty(runtime, parsing::metricPhaseName(phase), std::move(phaseObject));
+  }
+
+  jsi::Object caches(runtime);
+  caches.setProperty(runtime, "parse", cacheToObject(runtime, metrics.parseCache));
+  caches.setProperty(runtime, "measure", cacheToObject(runtime, metrics.measureCache));
+
+  jsi::Object object(runtime);
+  object.setProperty(runtime, "parses", std::move(parses));
+  object.setProperty(runtime, "phases", std::move(phases));
+  object.setProperty(runtime, "caches", std::move(caches));
+  return object;
+}
+
+} // namespace
+
+void installFabricPipelineMetrics(jsi::Runtime& runtime) {
+  auto getMetrics = [](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) -> jsi::Value {
+    auto metrics = parsing::pipelineMetrics();
+    if (count > 0 && args[0].isBool() && args[0].getBool()) {
+      parsing::resetPipelineMetrics();
+    }
+    return metricsToObject(runtime, metrics);
+  };
+
+  runtime.global().setProperty(
+      runtime,
+      kGlobalName,
+      jsi::Function::createFromHostFunction(
+          runtime, jsi::PropNameID::forAscii(runtime, kGlobalName), 1, std::move(getMetrics)));
+}
+
+} // namespace facebook::react
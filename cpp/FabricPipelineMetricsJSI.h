@@ -0,0 +1,34 @@
+/**
+ * FabricPipelineMetricsJSI.h
+ *
+ * JSI getter of PipelineMetrics, installed by the platform
+ * FabricRichTextMeasure modules and wrapped by getRichTextMetrics() in JS.
+ */
+
+#pragma once
+
+#include "FabricMarkupParser.h"
+
+#include <jsi/jsi.h>
+
+namespace facebook::react {
+
+/**
+ * Install global.__fabricRichTextMetrics(reset) into runtime. The function
+ * returns the metrics recorded since the last reset:
+ *
+ * { parses: { full, incremental, budgeted },
+ *   phases: { <phase>: { count, bytes, meanMs, p50Ms, p99Ms,
+ *                        bySize: { <size>: { count, meanMs, p50Ms, p99Ms } } } },
+ *   caches: { parse, measure: { hits, misses, hitRate, entries, bytes } } }
+ *
+ * Phases are sanitize, tokenize, build, measure and serialize; sizes are
+ * 1kb, 4kb, 16kb, 64kb, 256kb and larger (see documentSizeName()), and
+ * only sizes with samples are listed. With reset true, a new reporting
+ * window starts after the read.
+ *
+ * Must be called on the JS thread.
+ */
+void installFabricPipelineMetrics(jsi::Runtime& runtime);
+
+} // namespace facebook::react
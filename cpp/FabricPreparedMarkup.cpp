@@ -0,0 +1,98 @@
+/**
+ * FabricPreparedMarkup.cpp
+ *
+ * Adopt-time markup parsing implementation.
+ */
+
+#include "FabricPreparedMarkup.h"
+
+#include <atomic>
+
+namespace facebook::react {
+
+namespace {
+
+// Font scale changes rarely, so the last value seen at layout is a good guess
+std::atomic<Float> lastFontSizeMultiplier{1.0f};
+
+} // namespace
+
+std::shared_ptr<FabricPreparedMarkup> FabricPreparedMarkup::prepare(
+    const std::shared_ptr<FabricPreparedMarkup>& previous,
+    std::shared_ptr<IncrementalParseSession> session,
+    std::string markup,
+    const StyleOptions& options,
+    int numberOfLines) {
+  std::shared_ptr<FabricPreparedMarkup> prepared(new FabricPreparedMarkup());
+  prepared->session_ = std::move(session);
+  prepared->markup_ = std::move(markup);
+  prepared->preparedOptions_ = options;
+  prepared->numberOfLines_ = numberOfLines;
+
+  if (previous == nullptr) {
+    // New component: parse off the adopting thread. measureContent() joins
+    // the job if it has not finished, or runs it if it has not started.
+    // Previews parse at layout, where only the lines they show are parsed.
+    prepared->token_ = ParseGenerationToken::create();
+    if (!prepared->markup_.empty() && numberOfLines <= 0) {
+      ParseScheduler::shared().schedule(prepared->markup_, options, ParseLane::Visible, prepared->token_);
+    }
+    return prepared;
+  }
+
+  // Text changed before an earlier background parse ran: drop that parse
+  prepared->token_ = previous->token_;
+  prepared->token_.invalidate();
+  if (numberOfLines > 0) {
+    return prepared;
+  }
+
+  // Resume from the previous text; streamed and edited text parse only the change
+  prepared->result_ = std::make_shared<ParseResult>(FabricMarkupParser::parseMarkupIncremental(
+      *prepared->session_, prepared->markup_, options));
+  prepared->resolvedOptions_ = options;
+  prepared->resolved_ = true;
+  return prepared;
+}
+
+bool FabricPreparedMarkup::matches(const std::string& markup, const StyleOptions& options, int numberOfLines) const {
+  return markup_ == markup && preparedOptions_ == options && numberOfLines_ == numberOfLines;
+}
+
+FabricPreparedMarkup::ParseResultPtr FabricPreparedMarkup::resolve(
+    const StyleOptions& options,
+    bool withUtf16Index,
+    const ContentBudget& budget) {
+  lastFontSizeMultiplier.store(options.fontSizeMultiplier, std::memory_order_relaxed);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  bool coversBudget = result_ && (!result_->isTruncated || resolvedBudget_.covers(budget));
+  if (!resolved_ || resolvedOptions_ != options || !coversBudget) {
+    if (!resolved_ && options != preparedOptions_) {
+      // Font scale was mispredicted: drop the background parse if queued
+      token_.invalidate();
+    }
+    if (budget.isUnlimited()) {
+      result_ = std::make_shared<ParseResult>(FabricMarkupParser::parseMarkupIncremental(*session_, markup_, options));
+    } else {
+      result_ = std::make_shared<ParseResult>(FabricMarkupParser::parseMarkupWithinBudget(markup_, options, budget));
+    }
+    resolvedOptions_ = options;
+    resolvedBudget_ = budget;
+    resolved_ = true;
+  }
+  if (withUtf16Index && !result_->utf16Index) {
+    // Results already handed out are read without the lock; index a copy
+    if (result_.use_count() > 1) {
+      result_ = std::make_shared<ParseResult>(*result_);
+    }
+    FabricMarkupParser::buildUtf16Index(*result_);
+  }
+  return result_;
+}
+
+Float FabricPreparedMarkup::predictedFontSizeMultiplier() {
+  return lastFontSizeMultiplier.load(std::memory_order_relaxed);
+}
+
+} // namespace facebook::react
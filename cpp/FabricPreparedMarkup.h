@@ -0,0 +1,92 @@
+/**
+ * FabricPreparedMarkup.h
+ *
+ * Markup parse started when props are adopted, ahead of layout.
+ * Used by both Android and iOS shadow nodes so measureContent() picks up
+ * a parse result instead of parsing inside Yoga's layout pass.
+ */
+
+#pragma once
+
+#include "FabricMarkupParser.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace facebook::react {
+
+/**
+ * Parse result for a component's text.
+ *
+ * Created by the shadow node when its component descriptor adopts new props,
+ * and shared with clones while text and style are unchanged, so commits that
+ * don't touch text do no parsing. The first text of a component is parsed on
+ * ParseScheduler's Visible lane; later text goes through the component's
+ * IncrementalParseSession on the adopting thread, which only re-parses the
+ * appended or edited part. Text limited to numberOfLines is parsed at layout
+ * instead, where the width its line budget depends on is known.
+ *
+ * Thread-safe.
+ */
+class FabricPreparedMarkup {
+ public:
+  using ParseResult = FabricMarkupParser::ParseResult;
+  using ParseResultPtr = std::shared_ptr<const ParseResult>;
+
+  /**
+   * Start parsing markup for new props.
+   * @param previous Prepared markup of the node being replaced (nullptr for a new component)
+   * @param session The component's incremental parse session
+   * @param markup props.text
+   * @param options Style for the markup, with the predicted font scale
+   * @param numberOfLines props.numberOfLines (0 = unlimited)
+   */
+  static std::shared_ptr<FabricPreparedMarkup> prepare(
+      const std::shared_ptr<FabricPreparedMarkup>& previous,
+      std::shared_ptr<IncrementalParseSession> session,
+      std::string markup,
+      const StyleOptions& options,
+      int numberOfLines = 0);
+
+  /**
+   * Whether this was prepared for the same markup, style and line limit.
+   */
+  bool matches(const std::string& markup, const StyleOptions& options, int numberOfLines = 0) const;
+
+  /**
+   * Result for the style measured with. Picks up the prepared result or the
+   * background parse of it; re-parses only if layout's font scale differs
+   * from the predicted one, or if a truncated result falls short of budget.
+   * The result is shared, not copied, by every measure until it changes.
+   * @param withUtf16Index Attach a Utf16TextIndex, built once per result
+   * @param budget Lines the view shows at its measured width (unlimited = full text)
+   */
+  ParseResultPtr resolve(const StyleOptions& options, bool withUtf16Index = false, const ContentBudget& budget = {});
+
+  /**
+   * Font size multiplier to prepare with: the last one seen at layout.
+   */
+  static Float predictedFontSizeMultiplier();
+
+  FabricPreparedMarkup(const FabricPreparedMarkup&) = delete;
+  FabricPreparedMarkup& operator=(const FabricPreparedMarkup&) = delete;
+
+ private:
+  FabricPreparedMarkup() = default;
+
+  std::shared_ptr<IncrementalParseSession> session_;
+  ParseGenerationToken token_;
+  std::string markup_;
+  StyleOptions preparedOptions_;
+  int numberOfLines_ = 0;
+
+  mutable std::mutex mutex_;
+  bool resolved_ = false;
+  StyleOptions resolvedOptions_;
+  ContentBudget resolvedBudget_;
+  // Mutable while only this holds it (see resolve()); handed out as const
+  std::shared_ptr<ParseResult> result_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,231 @@
+/**
+ * AllocationCounter.cpp
+ *
+ * Replacement global operator new and delete. Every block carries a header
+ * recording the scope and phase it was allocated in, so a delete can tell
+ * whether it frees scratch memory of the active scope.
+ */
+
+#include "AllocationCounter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace facebook::react::headless {
+
+namespace {
+
+struct alignas(std::max_align_t) BlockHeader {
+  void* base;
+  uint32_t scope;
+  PipelinePhase phase;
+};
+
+static_assert(sizeof(BlockHeader) <= 2 * alignof(std::max_align_t));
+
+struct PhaseCounters {
+  std::atomic<uint64_t> allocations{0};
+  std::atomic<uint64_t> bytes{0};
+  std::atomic<uint64_t> scratch{0};
+};
+
+std::array<PhaseCounters, kPipelinePhaseCount> counters;
+std::atomic<uint32_t> activeScope{0};
+std::atomic<uint32_t> lastScope{0};
+
+void* allocate(std::size_t size, std::size_t alignment) {
+  alignment = std::max(alignment, alignof(BlockHeader));
+  std::size_t offset = (sizeof(BlockHeader) + alignment - 1) / alignment * alignment;
+  void* base = alignment > alignof(std::max_align_t)
+      ? std::aligned_alloc(alignment, (offset + size + alignment - 1) / alignment * alignment)
+      : std::malloc(offset + size);
+  if (base == nullptr) {
+    return nullptr;
+  }
+
+  uint32_t scope = activeScope.load(std::memory_order_relaxed);
+  PipelinePhase phase = parsing::currentPipelinePhase();
+  if (scope != 0) {
+    auto& phaseCounters = counters[static_cast<size_t>(phase)];
+    phaseCounters.allocations.fetch_add(1, std::memory_order_relaxed);
+    phaseCounters.bytes.fetch_add(size, std::memory_order_relaxed);
+  }
+
+  auto* pointer = static_cast<char*>(base) + offset;
+  auto* header = reinterpret_cast<BlockHeader*>(pointer) - 1;
+  header->base = base;
+  header->scope = scope;
+  header->phase = phase;
+  return pointer;
+}
+
+void* allocateOrThrow(std::size_t size, std::size_t alignment) {
+  void* pointer = allocate(size, alignment);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void deallocate(void* pointer) {
+  if (pointer == nullptr) {
+    return;
+  }
+  auto* header = static_cast<BlockHeader*>(pointer) - 1;
+  if (header->scope != 0 && header->scope == activeScope.load(std::memory_order_relaxed)) {
+    counters[static_cast<size_t>(header->phase)].scratch.fetch_add(1, std::memory_order_relaxed);
+  }
+  std::free(header->base);
+}
+
+} // namespace
+
+uint64_t AllocationCounts::allocations() const {
+  uint64_t total = 0;
+  for (const auto& phase : phases) {
+    total += phase.allocations;
+  }
+  return total;
+}
+
+uint64_t AllocationCounts::bytes() const {
+  uint64_t total = 0;
+  for (const auto& phase : phases) {
+    total += phase.bytes;
+  }
+  return total;
+}
+
+uint64_t AllocationCounts::scratch() const {
+  uint64_t total = 0;
+  for (const auto& phase : phases) {
+    total += phase.scratch;
+  }
+  return total;
+}
+
+void AllocationCounts::print() const {
+  for (size_t i = 0; i < kPipelinePhaseCount; ++i) {
+    const auto& phase = phases[i];
+    if (phase.allocations == 0 && phase.scratch == 0) {
+      continue;
+    }
+    std::printf(
+        "    %-14s %6llu allocations %9llu bytes %6llu scratch\n", parsing::pipelinePhaseName(static_cast<PipelinePhase>(i)),
+        static_cast<unsigned long long>(phase.allocations), static_cast<unsigned long long>(phase.bytes),
+        static_cast<unsigned long long>(phase.scratch));
+  }
+}
+
+AllocationScope::AllocationScope() {
+  for (auto& phase : counters) {
+    phase.allocations.store(0, std::memory_order_relaxed);
+    phase.bytes.store(0, std::memory_order_relaxed);
+    phase.scratch.store(0, std::memory_order_relaxed);
+  }
+  activeScope.store(lastScope.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+AllocationScope::~AllocationScope() {
+  activeScope.store(0, std::memory_order_release);
+}
+
+AllocationCounts AllocationScope::counts() const {
+  AllocationCounts counts;
+  for (size_t i = 0; i < kPipelinePhaseCount; ++i) {
+    counts.phases[i].allocations = counters[i].allocations.load(std::memory_order_relaxed);
+    counts.phases[i].bytes = counters[i].bytes.load(std::memory_order_relaxed);
+    counts.phases[i].scratch = counters[i].scratch.load(std::memory_order_relaxed);
+  }
+  return counts;
+}
+
+} // namespace facebook::react::headless
+
+using facebook::react::headless::allocate;
+using facebook::react::headless::allocateOrThrow;
+using facebook::react::headless::deallocate;
+
+void* operator new(std::size_t size) {
+  return allocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size) {
+  return allocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+  deallocate(pointer);
+}
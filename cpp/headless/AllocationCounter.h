@@ -0,0 +1,71 @@
+/**
+ * AllocationCounter.h
+ *
+ * Counts heap allocations by pipeline phase. AllocationCounter.cpp
+ * replaces the global operator new and delete, so it is linked only into
+ * allocation-tests, and the library is built with
+ * FABRIC_RICH_TEXT_PHASE_MARKERS so allocations are attributed to the
+ * phase marked on the allocating thread. See ci.sh.
+ */
+
+#pragma once
+
+#include "parsing/PipelinePhase.h"
+
+#include <array>
+#include <cstdint>
+
+namespace facebook::react::headless {
+
+using parsing::kPipelinePhaseCount;
+using parsing::PipelinePhase;
+
+struct PhaseAllocations {
+  uint64_t allocations = 0;
+  uint64_t bytes = 0;
+  // Allocations freed again before the counting scope ended
+  uint64_t scratch = 0;
+};
+
+struct AllocationCounts {
+  std::array<PhaseAllocations, kPipelinePhaseCount> phases{};
+
+  const PhaseAllocations& operator[](PipelinePhase phase) const {
+    return phases[static_cast<size_t>(phase)];
+  }
+
+  uint64_t allocations() const;
+  uint64_t bytes() const;
+  uint64_t scratch() const;
+
+  /**
+   * One line per phase that allocated.
+   */
+  void print() const;
+};
+
+/**
+ * Counts allocations made on any thread while alive. Scopes do not nest.
+ */
+class AllocationScope {
+ public:
+  AllocationScope();
+  ~AllocationScope();
+
+  AllocationScope(const AllocationScope&) = delete;
+  AllocationScope& operator=(const AllocationScope&) = delete;
+
+  /**
+   * Allocations so far. Scratch counts are final once work has returned.
+   */
+  AllocationCounts counts() const;
+};
+
+template <typename Work>
+AllocationCounts countAllocations(Work&& work) {
+  AllocationScope scope;
+  work();
+  return scope.counts();
+}
+
+} // namespace facebook::react::headless
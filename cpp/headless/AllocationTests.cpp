@@ -0,0 +1,147 @@
+/**
+ * AllocationTests.cpp
+ *
+ * Heap allocation budgets of the parse and measure paths, by pipeline
+ * phase. Allocations on the measure thread are the main source of its
+ * jitter: cold parses are held to a budget per KB of markup, and work
+ * served from an earlier parse must not allocate in the parse phases.
+ */
+
+#include "AllocationCounter.h"
+#include "MeasurePathHarness.h"
+
+using namespace facebook::react;
+using namespace facebook::react::headless;
+
+namespace {
+
+std::string sections(int count) {
+  std::string markup;
+  for (int i = 0; i < count; ++i) {
+    std::string n = std::to_string(i);
+    markup += "<h2>Section " + n + "</h2><p>Some <b>bold</b> and <i>italic</i> text with a <a href=\"https://example.com/" +
+        n + "\">link</a> in it.</p><ul><li>First point</li><li>Second point</li></ul>";
+  }
+  return markup;
+}
+
+StyleOptions baseOptions() {
+  StyleOptions options;
+  options.baseFontSize = 16;
+  return options;
+}
+
+uint64_t parsePhaseAllocations(const AllocationCounts& counts) {
+  return counts[PipelinePhase::Normalize].allocations + counts[PipelinePhase::Tokenize].allocations +
+      counts[PipelinePhase::Style].allocations + counts[PipelinePhase::Build].allocations +
+      counts[PipelinePhase::Accessibility].allocations;
+}
+
+/**
+ * Expect at most budgetPerKilobyte allocations per KB of markup in phase;
+ * prints the counts of every phase if not.
+ */
+void expectWithinBudget(const AllocationCounts& counts, PipelinePhase phase, double budgetPerKilobyte, size_t bytes) {
+  double actual = static_cast<double>(counts[phase].allocations) * 1024.0 / static_cast<double>(bytes);
+  if (actual > budgetPerKilobyte) {
+    std::printf(
+        "  %s: %.1f allocations/KB, budget %.1f\n", parsing::pipelinePhaseName(phase), actual, budgetPerKilobyte);
+    counts.print();
+  }
+  HEADLESS_EXPECT(actual <= budgetPerKilobyte);
+}
+
+} // namespace
+
+// Cold parses
+
+HEADLESS_TEST(testColdParseStaysWithinPhaseBudgets) {
+  auto markup = sections(40);
+  parsing::AttributedStringResult result;
+  auto counts = countAllocations([&] { result = parsing::parseAndBuildAttributedString(markup, baseOptions()); });
+
+  expectWithinBudget(counts, PipelinePhase::Tokenize, 72, markup.size());
+  expectWithinBudget(counts, PipelinePhase::Build, 28, markup.size());
+  expectWithinBudget(counts, PipelinePhase::Normalize, 8, markup.size());
+  HEADLESS_EXPECT_EQ(counts[PipelinePhase::Style].allocations, 0u);
+  HEADLESS_EXPECT(counts[PipelinePhase::Accessibility].allocations <= 1);
+  HEADLESS_EXPECT_EQ(counts[PipelinePhase::Serialize].allocations, 0u);
+}
+
+HEADLESS_TEST(testTagStylesAreCompiledOncePerParse) {
+  auto options = baseOptions();
+  options.tagStyles = R"({"h2":{"fontSize":24,"color":"#336699"},"a":{"textDecorationLine":"none"}})";
+
+  parsing::AttributedStringResult result;
+  auto small = countAllocations([&] { result = parsing::parseAndBuildAttributedString(sections(10), options); });
+  auto large = countAllocations([&] { result = parsing::parseAndBuildAttributedString(sections(40), options); });
+
+  HEADLESS_EXPECT(small[PipelinePhase::Style].allocations > 0);
+  HEADLESS_EXPECT_EQ(large[PipelinePhase::Style].allocations, small[PipelinePhase::Style].allocations);
+}
+
+HEADLESS_TEST(testCompactLayoutAllocatesPerStyleNotPerFragment) {
+  auto result = FabricMarkupParser::parseMarkupWithLinkUrls(sections(40), baseOptions());
+  size_t fragments = result.attributedString.getFragments().size();
+  size_t links = result.links.urls().size();
+
+  std::vector<uint8_t> bytes;
+  auto counts = countAllocations([&] { bytes = parsing::CompactTextLayout(result.attributedString, result.links).serialize(); });
+
+  // One string per link URL, the rest per distinct style or growth
+  HEADLESS_EXPECT(counts[PipelinePhase::Serialize].allocations <= links + 32);
+  HEADLESS_EXPECT(counts[PipelinePhase::Serialize].allocations < fragments);
+}
+
+// Warm paths
+
+HEADLESS_TEST(testWarmReparseHasNoScratchAllocations) {
+  auto markup = sections(40);
+  auto first = FabricMarkupParser::parseMarkupWithLinkUrls(markup, baseOptions());
+
+  FabricMarkupParser::ParseResult second;
+  auto counts = countAllocations([&] { second = FabricMarkupParser::parseMarkupWithLinkUrls(markup, baseOptions()); });
+
+  // Only the copy handed to the caller is allocated
+  HEADLESS_EXPECT_EQ(parsePhaseAllocations(counts), 0u);
+  HEADLESS_EXPECT_EQ(counts.scratch(), 0u);
+  HEADLESS_EXPECT_EQ(second.attributedString.getFragments().size(), first.attributedString.getFragments().size());
+}
+
+HEADLESS_TEST(testRepeatedMeasureDoesNotParse) {
+  auto markup = sections(20);
+  HeadlessComponent component(textProps(markup));
+  component.measure(320);
+  component.layout();
+
+  auto counts = countAllocations([&] { component.measure(300); });
+
+  HEADLESS_EXPECT_EQ(parsePhaseAllocations(counts), 0u);
+  HEADLESS_EXPECT_EQ(counts[PipelinePhase::Serialize].allocations, 0u);
+  // Copies of the result for the node and for the text layout
+  expectWithinBudget(counts, PipelinePhase::None, 24, markup.size());
+}
+
+HEADLESS_TEST(testAppendTokenizesOnlyTheAppendedText) {
+  auto appendCounts = [](int count) {
+    HeadlessComponent component(textProps(sections(count)));
+    component.measure(320);
+    component.layout();
+    return countAllocations([&] {
+      component.update([](FabricRichTextProps& props) { props.text += "<p>Second message</p>"; });
+      component.measure(320);
+      component.layout();
+    });
+  };
+  auto small = appendCounts(10);
+  auto large = appendCounts(40);
+
+  for (auto phase : {PipelinePhase::Tokenize, PipelinePhase::Normalize, PipelinePhase::Style}) {
+    HEADLESS_EXPECT(large[phase].allocations <= small[phase].allocations + 2);
+    HEADLESS_EXPECT(large[phase].allocations <= 8);
+  }
+}
+
+int main() {
+  return runHeadlessTests();
+}
@@ -0,0 +1,185 @@
+/**
+ * ComplexityTests.cpp
+ *
+ * Times each pipeline phase on the documents of PathologicalMarkup.h at
+ * n/8, n/4, n/2 and n, fits time = c * n^k and fails if k exceeds what
+ * O(n log n) work allows. One hostile message must not stall a commit.
+ */
+
+#include "MeasurePathHarness.h"
+#include "PathologicalMarkup.h"
+
+#include <algorithm>
+#include <chrono>
+#include <array>
+#include <cmath>
+
+using namespace facebook::react;
+using namespace facebook::react::headless;
+
+namespace {
+
+// n log n over an 8x range fits k of about 1.1; noise stays well under 2
+constexpr double kMaxExponent = 1.35;
+constexpr int kRepetitions = 3;
+
+enum Phase { Tokenize, Stream, Build, Serialize, Commit, kPhaseCount };
+const char* const kPhaseNames[kPhaseCount] = {"tokenize", "stream", "build", "serialize", "commit"};
+
+/**
+ * Fastest of kRepetitions runs of work, in seconds.
+ */
+template <typename Work>
+double fastest(Work&& work) {
+  double best = INFINITY;
+  for (int i = 0; i < kRepetitions; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+  }
+  return best;
+}
+
+std::array<double, kPhaseCount> timePhases(const PathologicalDocument& document) {
+  StyleOptions options;
+  options.baseFontSize = 16;
+  options.tagStyles = document.tagStyles;
+  std::array<double, kPhaseCount> times{};
+
+  parsing::MarkupSegmentParser parser(parsing::renderingParserOptions());
+  times[Tokenize] = fastest([&] {
+    parser = parsing::MarkupSegmentParser(parsing::renderingParserOptions());
+    parser.feed(document.markup);
+    parser.finish();
+  });
+
+  // Streamed in small chunks, as messages arrive
+  times[Stream] = fastest([&] {
+    IncrementalParseSession session;
+    std::string_view markup = document.markup;
+    for (size_t offset = 0; offset < markup.size(); offset += 256) {
+      session.append(markup.substr(offset, 256));
+    }
+    session.build(options);
+  });
+
+  parsing::AttributedStringResult result;
+  times[Build] = fastest([&] { result = parsing::buildAttributedString(parser.segments(), options); });
+
+  times[Serialize] = fastest([&] {
+    parsing::CompactTextLayout layout(result.attributedString, result.links);
+    layout.serialize();
+    parsing::contentHash(result.attributedString, result.links);
+    parsing::Utf16TextIndex index(result.attributedString, result.links, true);
+  });
+
+  auto props = textProps(document.markup);
+  props.tagStyles = document.tagStyles;
+  times[Commit] = fastest([&] {
+    ParseCache::shared().clear();
+    HeadlessComponent component(props);
+    component.measure(320);
+    component.layout();
+  });
+  return times;
+}
+
+/**
+ * Least squares slope of log(time) against log(n).
+ */
+double fitExponent(const std::vector<double>& sizes, const std::vector<double>& times) {
+  double meanX = 0;
+  double meanY = 0;
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    meanX += std::log(sizes[i]) / sizes.size();
+    meanY += std::log(std::max(times[i], 1e-9)) / sizes.size();
+  }
+  double covariance = 0;
+  double variance = 0;
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    double dx = std::log(sizes[i]) - meanX;
+    covariance += dx * (std::log(std::max(times[i], 1e-9)) - meanY);
+    variance += dx * dx;
+  }
+  return covariance / variance;
+}
+
+void expectNearLinear(const char* name) {
+  auto generators = pathologicalGenerators();
+  auto generator = std::find_if(generators.begin(), generators.end(), [&](const auto& g) {
+    return std::string(g.name) == name;
+  });
+  HEADLESS_EXPECT(generator != generators.end());
+  if (generator == generators.end()) {
+    return;
+  }
+
+  std::vector<double> sizes;
+  std::array<std::vector<double>, kPhaseCount> times;
+  for (size_t n = generator->largest / 8; n <= generator->largest; n *= 2) {
+    auto phaseTimes = timePhases(generator->generate(n));
+    sizes.push_back(static_cast<double>(n));
+    for (int phase = 0; phase < kPhaseCount; ++phase) {
+      times[phase].push_back(phaseTimes[phase]);
+    }
+  }
+
+  std::printf("  %-24s", name);
+  for (int phase = 0; phase < kPhaseCount; ++phase) {
+    std::printf(" %s %.2f (%.1f ms)", kPhaseNames[phase], fitExponent(sizes, times[phase]), times[phase].back() * 1e3);
+  }
+  std::printf("\n");
+  for (int phase = 0; phase < kPhaseCount; ++phase) {
+    double exponent = fitExponent(sizes, times[phase]);
+    if (exponent > kMaxExponent) {
+      std::printf("  %s: %s grows as n^%.2f\n", name, kPhaseNames[phase], exponent);
+    }
+    HEADLESS_EXPECT(exponent <= kMaxExponent);
+  }
+}
+
+} // namespace
+
+HEADLESS_TEST(testNestedSpansScale) {
+  expectNearLinear("nested spans");
+}
+
+HEADLESS_TEST(testSiblingBdiScale) {
+  expectNearLinear("sibling bdi");
+}
+
+HEADLESS_TEST(testNestedBdiScale) {
+  expectNearLinear("nested bdi");
+}
+
+HEADLESS_TEST(testUnclosedAutoDirectionScales) {
+  expectNearLinear("unclosed auto direction");
+}
+
+HEADLESS_TEST(testUnclosedTagsThenBlocksScale) {
+  expectNearLinear("unclosed then blocks");
+}
+
+HEADLESS_TEST(testMisnestedTagsScale) {
+  expectNearLinear("misnested tags");
+}
+
+HEADLESS_TEST(testListItemsScale) {
+  expectNearLinear("list items");
+}
+
+HEADLESS_TEST(testNestedListsScale) {
+  expectNearLinear("nested lists");
+}
+
+HEADLESS_TEST(testHugeTagStylesScale) {
+  expectNearLinear("huge tagStyles");
+}
+
+HEADLESS_TEST(testUnterminatedTagScales) {
+  expectNearLinear("unterminated tag");
+}
+
+int main() {
+  return runHeadlessTests();
+}
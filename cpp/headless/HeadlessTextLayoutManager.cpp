@@ -0,0 +1,86 @@
+/**
+ * HeadlessTextLayoutManager.cpp
+ *
+ * Deterministic stand-in text layout for the headless harness.
+ */
+
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+
+#include "parsing/HeightEstimator.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace facebook::react {
+
+namespace {
+
+// Atomics rather than a lock, so the stand-in adds no contention of its own
+std::atomic<Float> advance{headless::TextMetrics{}.advance};
+std::atomic<Float> lineHeight{headless::TextMetrics{}.lineHeight};
+std::atomic<int64_t> latencyMicroseconds{0};
+std::atomic<size_t> measurements{0};
+
+Float roundUpToPixel(Float value, Float pointScaleFactor) {
+  if (pointScaleFactor <= 0) {
+    return value;
+  }
+  return std::ceil(value * pointScaleFactor) / pointScaleFactor;
+}
+
+} // namespace
+
+TextLayoutManager::TextLayoutManager(const std::shared_ptr<const ContextContainer>& /* contextContainer */) {}
+
+TextMeasurement TextLayoutManager::measure(
+    const AttributedStringBox& attributedStringBox,
+    const ParagraphAttributes& paragraphAttributes,
+    const TextLayoutContext& layoutContext,
+    const LayoutConstraints& layoutConstraints) const {
+  measurements.fetch_add(1, std::memory_order_relaxed);
+  auto metrics = headless::textMetrics();
+
+  if (metrics.latency.count() > 0) {
+    auto deadline = std::chrono::steady_clock::now() + metrics.latency;
+    while (std::chrono::steady_clock::now() < deadline) {
+    }
+  }
+
+  parsing::HeightEstimator estimator;
+  estimator.setTable("", parsing::AdvanceWidthTable::monospace(metrics.advance, metrics.lineHeight));
+  auto estimate = estimator.estimate(
+      attributedStringBox.getValue(), layoutConstraints.maximumSize.width, paragraphAttributes.maximumNumberOfLines);
+
+  Size size{
+      roundUpToPixel(estimate.width, layoutContext.pointScaleFactor),
+      roundUpToPixel(estimate.height, layoutContext.pointScaleFactor)};
+  return TextMeasurement{layoutConstraints.clamp(size)};
+}
+
+namespace headless {
+
+void setTextMetrics(const TextMetrics& metrics) {
+  advance.store(metrics.advance, std::memory_order_relaxed);
+  lineHeight.store(metrics.lineHeight, std::memory_order_relaxed);
+  latencyMicroseconds.store(metrics.latency.count(), std::memory_order_relaxed);
+}
+
+TextMetrics textMetrics() {
+  return TextMetrics{
+      advance.load(std::memory_order_relaxed),
+      lineHeight.load(std::memory_order_relaxed),
+      std::chrono::microseconds(latencyMicroseconds.load(std::memory_order_relaxed))};
+}
+
+size_t measureCount() {
+  return measurements.load(std::memory_order_relaxed);
+}
+
+void resetMeasureCount() {
+  measurements.store(0, std::memory_order_relaxed);
+}
+
+} // namespace headless
+
+} // namespace facebook::react
@@ -0,0 +1,146 @@
+/**
+ * MeasurePathBench.cpp
+ *
+ * Throughput of measureContent() with a simulated text layout latency,
+ * from one thread and from several threads measuring the same node or
+ * separate rows. The time per measure above the simulated latency is the
+ * measure path's own cost, lock waits included. With --trace, the last
+ * spans of the run are written as Chrome trace-event JSON to open in
+ * chrome://tracing or Perfetto.
+ *
+ * Usage: measure-path-bench [--threads N] [--latency-us L] [--measures M] [--trace FILE]
+ */
+
+#include "MeasurePathHarness.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+using namespace facebook::react;
+using namespace facebook::react::headless;
+
+namespace {
+
+struct BenchOptions {
+  int threads = static_cast<int>(std::clamp(std::thread::hardware_concurrency(), 2u, 8u));
+  int latencyMicroseconds = 50;
+  int measuresPerThread = 200;
+  std::string tracePath;
+};
+
+BenchOptions parseArguments(int argc, char** argv) {
+  BenchOptions options;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    int value = std::atoi(argv[i + 1]);
+    if (std::strcmp(argv[i], "--threads") == 0) {
+      options.threads = std::max(1, value);
+    } else if (std::strcmp(argv[i], "--latency-us") == 0) {
+      options.latencyMicroseconds = std::max(0, value);
+    } else if (std::strcmp(argv[i], "--measures") == 0) {
+      options.measuresPerThread = std::max(1, value);
+    } else if (std::strcmp(argv[i], "--trace") == 0) {
+      options.tracePath = argv[i + 1];
+    }
+  }
+  return options;
+}
+
+std::string rowMarkup(int row) {
+  return "<p><b>Row " + std::to_string(row) + "</b> has a <a href=\"https://example.com/" + std::to_string(row) +
+      "\">link</a> and enough text to wrap onto a second line at list width.</p>";
+}
+
+/**
+ * Run measure(thread, i) for measuresPerThread iterations on each thread.
+ * @return Wall time in microseconds
+ */
+template <typename Measure>
+double runThreads(int threads, int measuresPerThread, Measure measure) {
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      for (int i = 0; i < measuresPerThread; ++i) {
+        measure(t, i);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* name, int threads, int measuresPerThread, double wallMicroseconds, const BenchOptions& options,
+            const PipelineCounts& work) {
+  double measures = static_cast<double>(threads) * measuresPerThread;
+  // Each thread spends measuresPerThread * latency in the stand-in layout
+  double perMeasure = wallMicroseconds / measuresPerThread;
+  double overhead = perMeasure - options.latencyMicroseconds;
+  std::printf(
+      "%-28s threads=%-2d %9.0f measures/s  %7.1f us/measure  %7.1f us overhead  parses=%llu measures=%zu\n",
+      name, threads, measures / (wallMicroseconds / 1e6), perMeasure, overhead,
+      static_cast<unsigned long long>(work.parses.total()), work.measures);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  auto options = parseArguments(argc, argv);
+  resetPipeline();
+  setTextMetrics(TextMetrics{0.5f, 1.2f, std::chrono::microseconds(options.latencyMicroseconds)});
+  std::printf("latency=%dus measures/thread=%d\n", options.latencyMicroseconds, options.measuresPerThread);
+  std::shared_ptr<ChromeTraceSink> trace;
+  if (!options.tracePath.empty()) {
+    trace = std::make_shared<ChromeTraceSink>();
+    parsing::setTraceSink(trace);
+  }
+
+  // One node measured repeatedly, as Yoga does for each layout pass
+  for (int threads : {1, options.threads}) {
+    HeadlessComponent component(textProps(rowMarkup(0)));
+    component.measure(320);
+    auto before = PipelineCounts::now();
+    double wall = runThreads(threads, options.measuresPerThread, [&](int, int) { component.measure(320); });
+    report("one node", threads, options.measuresPerThread, wall, options, PipelineCounts::now() - before);
+  }
+
+  // Rows of a list, each measured by its own thread
+  for (int threads : {1, options.threads}) {
+    ParseCache::shared().clear();
+    std::vector<std::unique_ptr<HeadlessComponent>> rows;
+    for (int t = 0; t < threads; ++t) {
+      rows.push_back(std::make_unique<HeadlessComponent>(textProps(rowMarkup(t + 1))));
+    }
+    auto before = PipelineCounts::now();
+    double wall = runThreads(threads, options.measuresPerThread, [&](int t, int) { rows[t]->measure(320); });
+    report("separate rows", threads, options.measuresPerThread, wall, options, PipelineCounts::now() - before);
+  }
+
+  // Commits that change text on every row, measured and laid out
+  for (int threads : {1, options.threads}) {
+    ParseCache::shared().clear();
+    std::vector<std::unique_ptr<HeadlessComponent>> rows;
+    for (int t = 0; t < threads; ++t) {
+      rows.push_back(std::make_unique<HeadlessComponent>(textProps(rowMarkup(t + 1))));
+    }
+    auto before = PipelineCounts::now();
+    double wall = runThreads(threads, options.measuresPerThread, [&](int t, int i) {
+      rows[t]->update([i](FabricRichTextProps& props) { props.text += "<p>" + std::to_string(i) + "</p>"; });
+      rows[t]->measure(320);
+      rows[t]->layout();
+    });
+    report("streamed commits", threads, options.measuresPerThread, wall, options, PipelineCounts::now() - before);
+  }
+
+  if (trace) {
+    parsing::setTraceSink(nullptr);
+    std::ofstream(options.tracePath) << trace->json();
+    std::printf("trace: %zu spans written to %s\n", trace->events().size(), options.tracePath.c_str());
+  }
+  return 0;
+}
@@ -0,0 +1,227 @@
+/**
+ * MeasurePathHarness.h
+ *
+ * Drives FabricRichTextShadowNode (ios/FabricRichTextShadowNode.mm, built
+ * as C++ against the stand-in headers in include/) through the commits
+ * React Native runs: create, clone, prop changes, measureContent() and
+ * layout(). Counts the parses, text measurements and state updates each
+ * step causes. See ci.sh.
+ */
+
+#pragma once
+
+#include "../../ios/FabricRichTextShadowNode.h"
+#include "FabricBatchMeasure.h"
+
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react::headless {
+
+/**
+ * Work done by the measure path, summed over all components.
+ */
+struct PipelineCounts {
+  ParseStats parses;
+  size_t measures = 0;
+  size_t stateUpdates = 0;
+
+  static PipelineCounts now() {
+    return PipelineCounts{
+        parsing::parseStats(), measureCount(), FabricRichTextShadowNode::stateUpdateCount()};
+  }
+
+  PipelineCounts operator-(const PipelineCounts& other) const {
+    return PipelineCounts{parses - other.parses, measures - other.measures, stateUpdates - other.stateUpdates};
+  }
+};
+
+/**
+ * Props with text and a 16pt font, the other props at codegen defaults.
+ */
+inline FabricRichTextProps textProps(const std::string& text) {
+  FabricRichTextProps props;
+  props.text = text;
+  props.fontSize = 16.0f;
+  props.allowFontScaling = true;
+  return props;
+}
+
+/**
+ * Style options the shadow node parses props with (see
+ * FabricRichTextShadowNode::styleOptions()).
+ */
+inline StyleOptions styleOptions(const FabricRichTextProps& props, Float fontSizeMultiplier = 1.0f) {
+  StyleOptions options;
+  if (!std::isnan(props.fontSize) && props.fontSize > 0) {
+    options.baseFontSize = props.fontSize;
+  }
+  options.fontSizeMultiplier = fontSizeMultiplier;
+  options.allowFontScaling = props.allowFontScaling;
+  options.maxFontSizeMultiplier = props.maxFontSizeMultiplier;
+  options.lineHeight = props.lineHeight;
+  options.fontWeight = props.fontWeight;
+  options.fontFamily = props.fontFamily;
+  options.fontStyle = props.fontStyle;
+  options.letterSpacing = props.letterSpacing;
+  options.color = props.color;
+  options.tagStyles = props.tagStyles;
+  return options;
+}
+
+/**
+ * Layout constraints of a view whose width is fixed and height grows with
+ * its content, as in a vertical list.
+ */
+inline LayoutConstraints widthConstraints(Float width) {
+  LayoutConstraints constraints;
+  constraints.maximumSize.width = width;
+  return constraints;
+}
+
+/**
+ * One mounted FabricRichText across commits. Each commit clones the
+ * current node, and the component descriptor's adopt() prepares it,
+ * before Yoga measures and lays it out.
+ */
+class HeadlessComponent {
+ public:
+  explicit HeadlessComponent(const FabricRichTextProps& props) {
+    node_ = std::make_shared<FabricRichTextShadowNode>(
+        ShadowNodeFragment{std::make_shared<const FabricRichTextProps>(props)});
+    node_->prepareContent();
+  }
+
+  /**
+   * Commit that leaves this component's props unchanged.
+   */
+  void clone() {
+    commit(ShadowNodeFragment{});
+  }
+
+  /**
+   * Commit with new props.
+   */
+  void update(const std::function<void(FabricRichTextProps&)>& change) {
+    auto props = node_->getConcreteProps();
+    change(props);
+    commit(ShadowNodeFragment{std::make_shared<const FabricRichTextProps>(props)});
+  }
+
+  Size measure(Float width, Float fontSizeMultiplier = 1.0f, Float pointScaleFactor = 3.0f) const {
+    return measure(widthConstraints(width), fontSizeMultiplier, pointScaleFactor);
+  }
+
+  Size measure(const LayoutConstraints& constraints, Float fontSizeMultiplier = 1.0f, Float pointScaleFactor = 3.0f)
+      const {
+    LayoutContext context;
+    context.fontSizeMultiplier = fontSizeMultiplier;
+    context.pointScaleFactor = pointScaleFactor;
+    return node_->measureContent(context, constraints);
+  }
+
+  void layout(Float fontSizeMultiplier = 1.0f, Float pointScaleFactor = 3.0f) {
+    LayoutContext context;
+    context.fontSizeMultiplier = fontSizeMultiplier;
+    context.pointScaleFactor = pointScaleFactor;
+    node_->layout(context);
+  }
+
+  const FabricRichTextShadowNode& node() const {
+    return *node_;
+  }
+
+ private:
+  void commit(const ShadowNodeFragment& fragment) {
+    node_->seal();
+    node_ = std::make_shared<FabricRichTextShadowNode>(*node_, fragment);
+    node_->prepareContent();
+  }
+
+  std::shared_ptr<FabricRichTextShadowNode> node_;
+};
+
+/**
+ * Empty the caches the measure path reads, reset the stand-in text
+ * metrics and measure at the default font scale, so the font scale
+ * prepareContent() predicts is 1.
+ */
+inline void resetPipeline() {
+  setTextMetrics(TextMetrics{});
+  HeadlessComponent reset(textProps("<p>reset</p>"));
+  reset.measure(320);
+  ParseCache::shared().clear();
+  MeasureCache::shared().clear();
+  resetMeasureCount();
+}
+
+// Minimal test registry; tests run in declaration order
+
+struct HeadlessTest {
+  const char* name;
+  void (*run)();
+};
+
+inline std::vector<HeadlessTest>& headlessTests() {
+  static std::vector<HeadlessTest> tests;
+  return tests;
+}
+
+inline int& headlessFailures() {
+  static int failures = 0;
+  return failures;
+}
+
+struct HeadlessTestRegistration {
+  HeadlessTestRegistration(const char* name, void (*run)()) {
+    headlessTests().push_back(HeadlessTest{name, run});
+  }
+};
+
+inline int runHeadlessTests() {
+  int failed = 0;
+  for (const auto& test : headlessTests()) {
+    int before = headlessFailures();
+    resetPipeline();
+    test.run();
+    bool passed = headlessFailures() == before;
+    failed += passed ? 0 : 1;
+    std::printf("%s %s\n", passed ? "[  OK  ]" : "[ FAIL ]", test.name);
+  }
+  std::printf("%zu tests, %d failed\n", headlessTests().size(), failed);
+  return failed == 0 ? 0 : 1;
+}
+
+} // namespace facebook::react::headless
+
+#define HEADLESS_TEST(name)                                                             \
+  static void name();                                                                   \
+  static ::facebook::react::headless::HeadlessTestRegistration name##Registration{#name, \
+                                                                                 name}; \
+  static void name()
+
+#define HEADLESS_EXPECT(condition)                                                   \
+  do {                                                                               \
+    if (!(condition)) {                                                              \
+      ::facebook::react::headless::headlessFailures()++;                             \
+      std::printf("  %s:%d: expected %s\n", __FILE__, __LINE__, #condition);         \
+    }                                                                                \
+  } while (0)
+
+#define HEADLESS_EXPECT_EQ(actual, expected)                                                      \
+  do {                                                                                            \
+    auto actualValue = (actual);                                                                  \
+    auto expectedValue = (expected);                                                              \
+    if (!(actualValue == expectedValue)) {                                                        \
+      ::facebook::react::headless::headlessFailures()++;                                          \
+      std::printf(                                                                                \
+          "  %s:%d: expected %s == %s (%g vs %g)\n", __FILE__, __LINE__, #actual, #expected,      \
+          static_cast<double>(actualValue), static_cast<double>(expectedValue));                  \
+    }                                                                                             \
+  } while (0)
@@ -0,0 +1,432 @@
+/**
+ * MeasurePathTests.cpp
+ *
+ * Parse, measure and state update counts of the shadow node's measure
+ * path across commits.
+ */
+
+#include "MeasurePathHarness.h"
+
+#include <algorithm>
+#include <thread>
+
+using namespace facebook::react;
+using namespace facebook::react::headless;
+
+namespace {
+
+const std::string kArticle =
+    "<h2>Release notes</h2><p>Parsing now starts when props are adopted, so "
+    "<b>measureContent</b> only picks up the result.</p><ul><li>Faster lists</li>"
+    "<li>Fewer parses</li></ul>";
+
+std::string longParagraphs(int count) {
+  std::string markup;
+  for (int i = 0; i < count; ++i) {
+    markup += "<p>Paragraph " + std::to_string(i) + " repeats words to fill several lines of text.</p>";
+  }
+  return markup;
+}
+
+} // namespace
+
+// Sizes
+
+HEADLESS_TEST(testStandInSizesAreDeterministic) {
+  // 16pt at half an em per glyph: 8pt per glyph; lines are 16 + 4 tall
+  HeadlessComponent component(textProps("<p>abcd</p>"));
+  auto size = component.measure(320);
+  HEADLESS_EXPECT_EQ(size.width, 32.0f);
+  HEADLESS_EXPECT_EQ(size.height, 20.0f);
+
+  HeadlessComponent wrapped(textProps("<p>abcd efgh</p>"));
+  size = wrapped.measure(40);
+  HEADLESS_EXPECT_EQ(size.width, 32.0f);
+  HEADLESS_EXPECT_EQ(size.height, 40.0f);
+}
+
+HEADLESS_TEST(testEmptyTextDoesNoWork) {
+  auto before = PipelineCounts::now();
+  HeadlessComponent component(textProps(""));
+  auto size = component.measure(320);
+  component.layout();
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(size.height, 0.0f);
+  HEADLESS_EXPECT_EQ(work.parses.total(), 0u);
+  HEADLESS_EXPECT_EQ(work.measures, 0u);
+  HEADLESS_EXPECT_EQ(work.stateUpdates, 1u);
+}
+
+// Commits
+
+HEADLESS_TEST(testFirstCommitParsesOnce) {
+  auto before = PipelineCounts::now();
+  HeadlessComponent component(textProps(kArticle));
+  component.measure(320);
+  component.layout();
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.full, 1u);
+  HEADLESS_EXPECT_EQ(work.parses.total(), 1u);
+  HEADLESS_EXPECT_EQ(work.measures, 1u);
+  HEADLESS_EXPECT_EQ(work.stateUpdates, 1u);
+}
+
+HEADLESS_TEST(testCloneWithoutPropChangesDoesNotParse) {
+  HeadlessComponent component(textProps(kArticle));
+  auto first = component.measure(320);
+  component.layout();
+  auto firstHash = component.node().getStateData().contentHash;
+
+  auto before = PipelineCounts::now();
+  component.clone();
+  auto second = component.measure(320);
+  component.layout();
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.total(), 0u);
+  HEADLESS_EXPECT_EQ(work.measures, 1u);
+  HEADLESS_EXPECT_EQ(work.stateUpdates, 1u);
+  HEADLESS_EXPECT(first == second);
+
+  // Unchanged content is sent as an empty delta against the same hash
+  const auto& state = component.node().getStateData();
+  HEADLESS_EXPECT_EQ(state.contentHash, firstHash);
+  HEADLESS_EXPECT(state.delta.has_value() && state.delta->empty());
+}
+
+HEADLESS_TEST(testUnrelatedPropChangeDoesNotParse) {
+  HeadlessComponent component(textProps(kArticle));
+  component.measure(320);
+  component.layout();
+
+  auto before = PipelineCounts::now();
+  component.update([](FabricRichTextProps& props) { props.animationDuration = 0.5f; });
+  component.measure(320);
+  component.layout();
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.total(), 0u);
+  HEADLESS_EXPECT_EQ(work.stateUpdates, 1u);
+}
+
+HEADLESS_TEST(testAppendedTextParsesIncrementally) {
+  HeadlessComponent component(textProps("<p>First message</p><p>Second message</p>"));
+  component.measure(320);
+  component.layout();
+
+  // First edit after mount
+  auto before = PipelineCounts::now();
+  component.update([](FabricRichTextProps& props) { props.text += "<p>Third message</p>"; });
+  component.measure(320);
+  component.layout();
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.incremental, 1u);
+  HEADLESS_EXPECT_EQ(work.parses.full, 0u);
+  HEADLESS_EXPECT_EQ(work.measures, 1u);
+
+  // Appended paragraphs leave the earlier fragments in place
+  const auto& state = component.node().getStateData();
+  HEADLESS_EXPECT(state.delta.has_value() && state.delta->first > 0);
+}
+
+HEADLESS_TEST(testStyleChangeParsesOnce) {
+  HeadlessComponent component(textProps(kArticle));
+  component.measure(320);
+  component.layout();
+
+  auto before = PipelineCounts::now();
+  component.update([](FabricRichTextProps& props) { props.color = static_cast<int>(0xFF336699); });
+  component.measure(320);
+  component.measure(240);
+  component.layout();
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.total(), 1u);
+  HEADLESS_EXPECT_EQ(work.measures, 2u);
+}
+
+HEADLESS_TEST(testFontScaleChangeParsesOnceAndIsPredicted) {
+  HeadlessComponent component(textProps(kArticle));
+  auto normal = component.measure(320);
+  component.layout();
+
+  auto before = PipelineCounts::now();
+  auto scaled = component.measure(320, 1.5f);
+  component.measure(320, 1.5f);
+  component.layout(1.5f);
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.total(), 1u);
+  HEADLESS_EXPECT(scaled.height > normal.height);
+
+  // Props adopted after the change are prepared at the new scale
+  before = PipelineCounts::now();
+  component.update([](FabricRichTextProps& props) { props.text += "<p>More</p>"; });
+  component.measure(320, 1.5f);
+  component.layout(1.5f);
+
+  work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.total(), 1u);
+}
+
+// numberOfLines
+
+HEADLESS_TEST(testPreviewParsesPrefixAtMeasure) {
+  auto props = textProps(longParagraphs(200));
+  props.numberOfLines = 2;
+
+  auto before = PipelineCounts::now();
+  HeadlessComponent component(props);
+  HEADLESS_EXPECT_EQ((PipelineCounts::now() - before).parses.total(), 0u);
+
+  auto size = component.measure(320);
+  component.measure(320);
+  component.layout();
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.budgeted, 1u);
+  HEADLESS_EXPECT_EQ(work.parses.total(), 1u);
+  HEADLESS_EXPECT_EQ(size.height, 40.0f);
+}
+
+HEADLESS_TEST(testClearingNumberOfLinesParsesFullText) {
+  auto props = textProps(longParagraphs(50));
+  props.numberOfLines = 2;
+  HeadlessComponent component(props);
+  auto preview = component.measure(320);
+  component.layout();
+
+  auto before = PipelineCounts::now();
+  component.update([](FabricRichTextProps& props) { props.numberOfLines = 0; });
+  auto full = component.measure(320);
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.budgeted, 0u);
+  HEADLESS_EXPECT_EQ(work.parses.total(), 1u);
+  HEADLESS_EXPECT(full.height > preview.height);
+}
+
+// Measure Cache
+
+HEADLESS_TEST(testBatchMeasuredRowSkipsTextLayout) {
+  auto props = textProps(kArticle);
+  auto key = FabricBatchMeasure::cacheKey(
+      props.text, styleOptions(props), 320, 0, MeasureSource::Platform, 3.0f);
+  MeasureCache::shared().insert(key, MeasuredText{300, 123, 6});
+
+  auto before = PipelineCounts::now();
+  HeadlessComponent component(props);
+  auto size = component.measure(320);
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.measures, 0u);
+  HEADLESS_EXPECT_EQ(size.height, 123.0f);
+
+  // A height constraint could clamp the size, so the cache is not used
+  auto constraints = widthConstraints(320);
+  constraints.maximumSize.height = 100;
+  component.measure(constraints);
+  HEADLESS_EXPECT_EQ((PipelineCounts::now() - before).measures, 1u);
+}
+
+HEADLESS_TEST(testEstimatedSizesAreNotUsedForLayout) {
+  auto props = textProps(kArticle);
+  auto key = FabricBatchMeasure::cacheKey(
+      props.text, styleOptions(props), 320, 0, MeasureSource::Estimate, 3.0f);
+  MeasureCache::shared().insert(key, MeasuredText{300, 123, 6});
+
+  auto before = PipelineCounts::now();
+  HeadlessComponent component(props);
+  component.measure(320);
+  HEADLESS_EXPECT_EQ((PipelineCounts::now() - before).measures, 1u);
+}
+
+// Metrics
+
+HEADLESS_TEST(testCommitRecordsPhaseMetrics) {
+  parsing::resetPipelineMetrics();
+  HeadlessComponent component(textProps(kArticle));
+  component.measure(320);
+  component.layout();
+  component.update([](FabricRichTextProps& props) { props.text += "<p>More</p>"; });
+  component.measure(320);
+  component.layout();
+
+  auto metrics = parsing::pipelineMetrics();
+  auto size = parsing::documentSizeOf(kArticle.size());
+  HEADLESS_EXPECT_EQ(metrics.parses.total(), 2u);
+  HEADLESS_EXPECT_EQ(metrics.latencyOf(MetricPhase::Tokenize, size).count, 2u);
+  HEADLESS_EXPECT_EQ(metrics.latencyOf(MetricPhase::Build, size).count, 2u);
+  HEADLESS_EXPECT_EQ(metrics.latencyOf(MetricPhase::Measure).count, 2u);
+  HEADLESS_EXPECT_EQ(metrics.latencyOf(MetricPhase::Serialize).count, 2u);
+  HEADLESS_EXPECT(metrics.latencyOf(MetricPhase::Tokenize).percentile(0.99) > 0);
+
+  // A clone without prop changes neither parses nor serializes
+  parsing::resetPipelineMetrics();
+  component.clone();
+  component.measure(320);
+  component.layout();
+  metrics = parsing::pipelineMetrics();
+  HEADLESS_EXPECT_EQ(metrics.parses.total(), 0u);
+  HEADLESS_EXPECT_EQ(metrics.latencyOf(MetricPhase::Tokenize).count, 0u);
+  HEADLESS_EXPECT_EQ(metrics.latencyOf(MetricPhase::Serialize).count, 0u);
+}
+
+HEADLESS_TEST(testCommitTracesSpans) {
+  auto sink = std::make_shared<ChromeTraceSink>();
+  parsing::setTraceSink(sink);
+  HeadlessComponent component(textProps(kArticle));
+  component.measure(320);
+  component.layout();
+  parsing::setTraceSink(nullptr);
+
+  auto events = sink->events();
+  auto find = [&](const std::string& name) {
+    return std::find_if(events.begin(), events.end(), [&](const auto& event) { return event.name == name; });
+  };
+  auto parse = find("parseMarkup");
+  auto measure = find("measureContent");
+  auto layout = find("layout");
+  auto setState = find("setStateData");
+  HEADLESS_EXPECT(parse != events.end() && measure != events.end());
+  HEADLESS_EXPECT(layout != events.end() && setState != events.end());
+  HEADLESS_EXPECT(find("tokenize") != events.end());
+  if (parse == events.end() || layout == events.end() || setState == events.end()) {
+    return;
+  }
+  HEADLESS_EXPECT_EQ(parse->args.hash, parsing::hashMarkup(kArticle));
+  HEADLESS_EXPECT_EQ(parse->args.bytes, kArticle.size());
+  HEADLESS_EXPECT_EQ(parse->args.fragments, component.node().getStateData().attributedString.getFragments().size());
+  HEADLESS_EXPECT_EQ(setState->args.hash, component.node().getStateData().contentHash);
+  // setStateData runs inside layout, on the same thread
+  HEADLESS_EXPECT_EQ(setState->thread, layout->thread);
+  HEADLESS_EXPECT(setState->startMicroseconds >= layout->startMicroseconds);
+  HEADLESS_EXPECT(setState->startMicroseconds + setState->durationMicroseconds <=
+                  layout->startMicroseconds + layout->durationMicroseconds);
+  HEADLESS_EXPECT(sink->json().rfind("{\"traceEvents\":[", 0) == 0);
+
+  // Without a sink, nothing more is recorded
+  component.update([](FabricRichTextProps& props) { props.text += "<p>More</p>"; });
+  component.layout();
+  HEADLESS_EXPECT_EQ(sink->events().size(), events.size());
+}
+
+HEADLESS_TEST(testStateCarriesDocumentSummary) {
+  HeadlessComponent component(textProps(kArticle));
+  component.measure(320);
+  component.layout();
+  auto summary = component.node().getStateData().summary;
+  HEADLESS_EXPECT(summary.has(DocumentFeature::Lists));
+  HEADLESS_EXPECT(!summary.has(DocumentFeature::Links));
+  HEADLESS_EXPECT(!summary.has(DocumentFeature::Bidi));
+  HEADLESS_EXPECT_EQ(summary.maxHeadingLevel, 2);
+  HEADLESS_EXPECT_EQ(summary.fragmentCount, component.node().getStateData().attributedString.getFragments().size());
+
+  component.update([](FabricRichTextProps& props) {
+    props.text = "<p><a href=\"https://example.com\">Link</a> \xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D</p>";
+  });
+  component.measure(320);
+  component.layout();
+  summary = component.node().getStateData().summary;
+  HEADLESS_EXPECT(summary.has(DocumentFeature::Links));
+  HEADLESS_EXPECT(summary.has(DocumentFeature::Bidi));
+  HEADLESS_EXPECT(!summary.has(DocumentFeature::Lists));
+  HEADLESS_EXPECT_EQ(summary.linkCount, 1u);
+  HEADLESS_EXPECT_EQ(summary.maxHeadingLevel, 0);
+}
+
+// Concurrency
+
+HEADLESS_TEST(testConcurrentMeasuresOfOneNodeParseOnce) {
+  constexpr int kThreads = 8;
+  constexpr int kMeasuresPerThread = 25;
+  setTextMetrics(TextMetrics{0.5f, 1.2f, std::chrono::microseconds(20)});
+
+  auto before = PipelineCounts::now();
+  HeadlessComponent component(textProps(kArticle));
+  std::vector<Size> sizes(kThreads * kMeasuresPerThread);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < kMeasuresPerThread; ++i) {
+        sizes[t * kMeasuresPerThread + i] = component.measure(320);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  component.layout();
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.total(), 1u);
+  HEADLESS_EXPECT_EQ(work.measures, static_cast<size_t>(kThreads * kMeasuresPerThread));
+  for (const auto& size : sizes) {
+    HEADLESS_EXPECT(size == sizes.front());
+  }
+}
+
+HEADLESS_TEST(testRowsWithSameTextShareOneParse) {
+  constexpr int kRows = 16;
+
+  auto before = PipelineCounts::now();
+  std::vector<std::unique_ptr<HeadlessComponent>> rows;
+  for (int i = 0; i < kRows; ++i) {
+    rows.push_back(std::make_unique<HeadlessComponent>(textProps(kArticle)));
+  }
+  std::vector<std::thread> threads;
+  for (auto& row : rows) {
+    threads.emplace_back([&row] {
+      row->measure(320);
+      row->layout();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.total(), 1u);
+  HEADLESS_EXPECT_EQ(work.measures, static_cast<size_t>(kRows));
+  HEADLESS_EXPECT_EQ(work.stateUpdates, static_cast<size_t>(kRows));
+}
+
+HEADLESS_TEST(testFirstAppendAfterCachedMountResumes) {
+  auto options = styleOptions(textProps(kArticle));
+  FabricMarkupParser::parseMarkupWithLinkUrls(kArticle, options);
+
+  // Served from the cache, then extended by the first streamed chunk
+  IncrementalParseSession session;
+  FabricMarkupParser::parseMarkupIncremental(session, kArticle, options);
+  const std::string chunk = "<p>Streamed reply</p>";
+  auto appended = FabricMarkupParser::parseMarkupIncremental(session, kArticle + chunk, options);
+
+  HEADLESS_EXPECT(session.lastUpdateResumed());
+  HEADLESS_EXPECT(session.lastUpdateParsedBytes() < kArticle.size());
+  auto full = FabricMarkupParser::parseMarkupWithLinkUrls(kArticle + chunk, options);
+  HEADLESS_EXPECT(appended.attributedString == full.attributedString);
+}
+
+HEADLESS_TEST(testRowMountedFromSharedParseAppendsIncrementally) {
+  HeadlessComponent first(textProps(kArticle));
+  first.measure(320);
+  HeadlessComponent second(textProps(kArticle));
+  second.measure(320);
+  second.layout();
+
+  auto before = PipelineCounts::now();
+  second.update([](FabricRichTextProps& props) { props.text += "<p>Streamed reply</p>"; });
+  second.measure(320);
+  second.layout();
+
+  auto work = PipelineCounts::now() - before;
+  HEADLESS_EXPECT_EQ(work.parses.incremental, 1u);
+  HEADLESS_EXPECT_EQ(work.parses.full, 0u);
+}
+
+int main() {
+  return runHeadlessTests();
+}
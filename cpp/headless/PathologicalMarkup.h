@@ -0,0 +1,194 @@
+/**
+ * PathologicalMarkup.h
+ *
+ * Generators of hostile documents whose size grows with n, for checking
+ * that parsing scales no worse than O(n log n). Each targets a code path
+ * whose work could grow with the depth or number of open elements.
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace facebook::react::headless {
+
+/**
+ * A document of size n, and the tagStyles to parse it with.
+ */
+struct PathologicalDocument {
+  std::string markup;
+  std::string tagStyles;
+};
+
+struct PathologicalGenerator {
+  const char* name;
+  std::function<PathologicalDocument(size_t n)> generate;
+  // Largest n to generate
+  size_t largest;
+};
+
+namespace pathological {
+
+// "Arabic" in Arabic, a strong right-to-left run
+inline const std::string kArabicWord = "\xD8\xB9\xD8\xB1\xD8\xA8\xD9\x8A";
+
+/**
+ * n nested inline elements around one run of text.
+ */
+inline PathologicalDocument nestedSpans(size_t n) {
+  static const char* const kTags[] = {"span", "b", "i", "u", "s"};
+  PathologicalDocument document;
+  document.markup = "<p>";
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += std::string("<") + kTags[i % 5] + ">x";
+  }
+  for (size_t i = n; i > 0; --i) {
+    document.markup += std::string("</") + kTags[(i - 1) % 5] + ">";
+  }
+  document.markup += "</p>";
+  return document;
+}
+
+/**
+ * n sibling <bdi> elements whose direction comes from their content.
+ */
+inline PathologicalDocument siblingBdi(size_t n) {
+  PathologicalDocument document;
+  document.markup = "<p>";
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += "<bdi>" + std::to_string(i) + " " + kArabicWord + "</bdi> ";
+  }
+  document.markup += "</p>";
+  return document;
+}
+
+/**
+ * n nested <bdi> elements, each starting with neutral text; the first
+ * strong character is in the innermost one.
+ */
+inline PathologicalDocument nestedBdi(size_t n) {
+  PathologicalDocument document;
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += "<bdi>1 ";
+  }
+  document.markup += kArabicWord;
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += "</bdi>";
+  }
+  return document;
+}
+
+/**
+ * n <bdi> and dir="auto" elements that are never closed, holding only
+ * neutral text, so no lookahead finds a closing tag or a strong character.
+ */
+inline PathologicalDocument unclosedAutoDirection(size_t n) {
+  PathologicalDocument document;
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += i % 2 == 0 ? "<bdi>12 " : "<span dir=\"auto\">34 ";
+  }
+  return document;
+}
+
+/**
+ * n inline elements that are never closed, followed by n paragraphs that
+ * each record a block boundary with every element still open.
+ */
+inline PathologicalDocument unclosedThenBlocks(size_t n) {
+  PathologicalDocument document;
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += i % 2 == 0 ? "<b>a" : "<span>b";
+  }
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += "<p>Paragraph " + std::to_string(i) + "</p>";
+  }
+  return document;
+}
+
+/**
+ * n pairs of mis-nested elements; closes that don't match the innermost
+ * element are ignored, so every pair stays open.
+ */
+inline PathologicalDocument misnestedTags(size_t n) {
+  PathologicalDocument document;
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += "<b><i>x</b></i>";
+  }
+  return document;
+}
+
+/**
+ * A list of n items.
+ */
+inline PathologicalDocument listItems(size_t n) {
+  PathologicalDocument document;
+  document.markup = "<ul>";
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += "<li>Item " + std::to_string(i) + "</li>";
+  }
+  document.markup += "</ul>";
+  return document;
+}
+
+/**
+ * n nested lists of one item each.
+ */
+inline PathologicalDocument nestedLists(size_t n) {
+  PathologicalDocument document;
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += "<ol><li>Level " + std::to_string(i);
+  }
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += "</li></ol>";
+  }
+  return document;
+}
+
+/**
+ * tagStyles with n entries, most for tags the document does not use,
+ * and a document of n styled segments.
+ */
+inline PathologicalDocument hugeTagStyles(size_t n) {
+  PathologicalDocument document;
+  document.tagStyles = "{";
+  for (size_t i = 0; i < n; ++i) {
+    document.tagStyles += "\"x" + std::to_string(i) + "\":{\"color\":\"#112233\",\"fontSize\":12},";
+  }
+  document.tagStyles += "\"b\":{\"color\":\"#336699\"},\"i\":{\"fontStyle\":\"normal\"}}";
+  document.markup = "<p>";
+  for (size_t i = 0; i < n; ++i) {
+    document.markup += i % 2 == 0 ? "<b>bold</b> " : "<i>italic</i> ";
+  }
+  document.markup += "</p>";
+  return document;
+}
+
+/**
+ * One open tag of n bytes that never ends.
+ */
+inline PathologicalDocument unterminatedTag(size_t n) {
+  PathologicalDocument document;
+  document.markup = "<p>Text <a href=\"" + std::string(n, 'x');
+  return document;
+}
+
+} // namespace pathological
+
+inline std::vector<PathologicalGenerator> pathologicalGenerators() {
+  return {
+      {"nested spans", pathological::nestedSpans, 10000},
+      {"sibling bdi", pathological::siblingBdi, 10000},
+      {"nested bdi", pathological::nestedBdi, 10000},
+      {"unclosed auto direction", pathological::unclosedAutoDirection, 10000},
+      {"unclosed then blocks", pathological::unclosedThenBlocks, 10000},
+      {"misnested tags", pathological::misnestedTags, 10000},
+      {"list items", pathological::listItems, 100000},
+      {"nested lists", pathological::nestedLists, 10000},
+      {"huge tagStyles", pathological::hugeTagStyles, 10000},
+      {"unterminated tag", pathological::unterminatedTag, 1000000},
+  };
+}
+
+} // namespace facebook::react::headless
@@ -0,0 +1,67 @@
+#!/bin/bash
+set -euo pipefail
+
+# Builds the shared C++ and the iOS shadow node against the stand-in React
+# Native headers in include/, with pipeline phase markers on, then runs the
+# measure path, allocation and scaling tests.
+#
+#   ./cpp/headless/ci.sh           # tests
+#   ./cpp/headless/ci.sh --bench   # tests, then the benchmark, tracing it
+#                                  # to build/measure-path-bench.trace.json
+#
+# CXX selects the compiler, CXXFLAGS adds flags (e.g. -fsanitize=thread).
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+CPP_DIR="$(cd "$SCRIPT_DIR/.." && pwd)"
+PACKAGE_DIR="$(cd "$CPP_DIR/.." && pwd)"
+BUILD_DIR="${BUILD_DIR:-$SCRIPT_DIR/build}"
+
+CXX="${CXX:-c++}"
+FLAGS=(-std=c++20 -O2 -g -pthread -Wall -Wno-deprecated -DFABRIC_RICH_TEXT_PHASE_MARKERS
+  -I"$SCRIPT_DIR/include" -I"$CPP_DIR")
+read -r -a EXTRA_FLAGS <<< "${CXXFLAGS:-}"
+
+echo "=== Headless Measure Path ==="
+echo "Compiler: $CXX"
+mkdir -p "$BUILD_DIR"
+
+OBJECTS=()
+compile() {
+  local source="$1"
+  local object="$BUILD_DIR/$(basename "$source").o"
+  shift
+  "$CXX" "${FLAGS[@]}" "${EXTRA_FLAGS[@]}" "$@" -c "$source" -o "$object"
+  OBJECTS+=("$object")
+}
+
+# The JSI binding needs a JS runtime; everything else in cpp/ is plain C++
+for source in "$CPP_DIR"/*.cpp "$CPP_DIR"/parsing/*.cpp; do
+  case "$source" in
+    *JSI.cpp) continue ;;
+  esac
+  compile "$source"
+done
+compile "$PACKAGE_DIR/ios/FabricRichTextShadowNode.mm" -x c++
+compile "$SCRIPT_DIR/HeadlessTextLayoutManager.cpp"
+
+"$CXX" "${FLAGS[@]}" "${EXTRA_FLAGS[@]}" "$SCRIPT_DIR/MeasurePathTests.cpp" "${OBJECTS[@]}" \
+  -o "$BUILD_DIR/measure-path-tests"
+"$CXX" "${FLAGS[@]}" "${EXTRA_FLAGS[@]}" "$SCRIPT_DIR/MeasurePathBench.cpp" "${OBJECTS[@]}" \
+  -o "$BUILD_DIR/measure-path-bench"
+# Replaces the global operator new, so it is linked into this binary only
+"$CXX" "${FLAGS[@]}" "${EXTRA_FLAGS[@]}" "$SCRIPT_DIR/AllocationTests.cpp" "$SCRIPT_DIR/AllocationCounter.cpp" \
+  "${OBJECTS[@]}" -o "$BUILD_DIR/allocation-tests"
+"$CXX" "${FLAGS[@]}" "${EXTRA_FLAGS[@]}" "$SCRIPT_DIR/ComplexityTests.cpp" "${OBJECTS[@]}" \
+  -o "$BUILD_DIR/complexity-tests"
+
+echo ""
+echo "=== Running Tests ==="
+"$BUILD_DIR/measure-path-tests"
+"$BUILD_DIR/allocation-tests"
+"$BUILD_DIR/complexity-tests"
+
+if [[ "${1:-}" == "--bench" ]]; then
+  echo ""
+  echo "=== Running Benchmark ==="
+  "$BUILD_DIR/measure-path-bench" --trace "$BUILD_DIR/measure-path-bench.trace.json" "${@:2}"
+fi
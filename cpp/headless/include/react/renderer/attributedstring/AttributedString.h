@@ -0,0 +1,72 @@
+/**
+ * AttributedString.h
+ *
+ * Headless stand-in for React Native's
+ * react/renderer/attributedstring/AttributedString.h.
+ */
+
+#pragma once
+
+#include <react/renderer/attributedstring/TextAttributes.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+class AttributedString {
+ public:
+  class Fragment {
+   public:
+    std::string string;
+    TextAttributes textAttributes;
+
+    bool operator==(const Fragment& other) const {
+      return string == other.string && textAttributes == other.textAttributes;
+    }
+  };
+
+  using Fragments = std::vector<Fragment>;
+
+  void appendFragment(Fragment&& fragment) {
+    if (!fragment.string.empty()) {
+      fragments_.push_back(std::move(fragment));
+    }
+  }
+
+  void appendFragment(const Fragment& fragment) {
+    if (!fragment.string.empty()) {
+      fragments_.push_back(fragment);
+    }
+  }
+
+  const Fragments& getFragments() const {
+    return fragments_;
+  }
+
+  Fragments& getFragments() {
+    return fragments_;
+  }
+
+  std::string getString() const {
+    std::string string;
+    for (const auto& fragment : fragments_) {
+      string += fragment.string;
+    }
+    return string;
+  }
+
+  bool isEmpty() const {
+    return fragments_.empty();
+  }
+
+  bool operator==(const AttributedString& other) const {
+    return fragments_ == other.fragments_;
+  }
+
+ private:
+  Fragments fragments_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,20 @@
+/**
+ * ParagraphAttributes.h
+ *
+ * Headless stand-in for React Native's
+ * react/renderer/attributedstring/ParagraphAttributes.h.
+ */
+
+#pragma once
+
+#include <react/renderer/attributedstring/primitives.h>
+
+namespace facebook::react {
+
+class ParagraphAttributes {
+ public:
+  int maximumNumberOfLines{};
+  EllipsizeMode ellipsizeMode{};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,53 @@
+/**
+ * TextAttributes.h
+ *
+ * Headless stand-in for React Native's
+ * react/renderer/attributedstring/TextAttributes.h (the attributes the
+ * shared parser sets).
+ */
+
+#pragma once
+
+#include <react/renderer/attributedstring/primitives.h>
+#include <react/renderer/graphics/Color.h>
+
+#include <cmath>
+#include <optional>
+#include <string>
+
+namespace facebook::react {
+
+class TextAttributes {
+ public:
+  SharedColor foregroundColor{};
+  SharedColor backgroundColor{};
+  std::string fontFamily{};
+  Float fontSize{NAN};
+  std::optional<FontWeight> fontWeight{};
+  std::optional<FontStyle> fontStyle{};
+  std::optional<bool> allowFontScaling{};
+  Float letterSpacing{NAN};
+  Float lineHeight{NAN};
+  std::optional<TextDecorationLineType> textDecorationLineType{};
+
+  static TextAttributes defaultTextAttributes() {
+    TextAttributes attributes;
+    attributes.fontSize = 14.0f;
+    return attributes;
+  }
+
+  bool operator==(const TextAttributes& other) const {
+    return foregroundColor == other.foregroundColor && backgroundColor == other.backgroundColor &&
+        fontFamily == other.fontFamily && floatEquals(fontSize, other.fontSize) &&
+        fontWeight == other.fontWeight && fontStyle == other.fontStyle &&
+        allowFontScaling == other.allowFontScaling && floatEquals(letterSpacing, other.letterSpacing) &&
+        floatEquals(lineHeight, other.lineHeight) && textDecorationLineType == other.textDecorationLineType;
+  }
+
+ private:
+  static bool floatEquals(Float a, Float b) {
+    return (std::isnan(a) && std::isnan(b)) || a == b;
+  }
+};
+
+} // namespace facebook::react
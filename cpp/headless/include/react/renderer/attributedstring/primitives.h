@@ -0,0 +1,25 @@
+/**
+ * primitives.h
+ *
+ * Headless stand-in for React Native's
+ * react/renderer/attributedstring/primitives.h (the values the shared
+ * parser uses).
+ */
+
+#pragma once
+
+#include <react/renderer/graphics/Float.h>
+
+namespace facebook::react {
+
+enum class WritingDirection { Natural, LeftToRight, RightToLeft };
+
+enum class FontWeight : int { Regular = 400, Bold = 700 };
+
+enum class FontStyle { Normal, Italic, Oblique };
+
+enum class TextDecorationLineType { None, Underline, Strikethrough, UnderlineStrikethrough };
+
+enum class EllipsizeMode { Clip, Head, Tail, Middle };
+
+} // namespace facebook::react
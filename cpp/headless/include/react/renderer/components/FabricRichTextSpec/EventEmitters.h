@@ -0,0 +1,13 @@
+/**
+ * EventEmitters.h
+ *
+ * Headless stand-in for the codegen event emitter of FabricRichText.
+ */
+
+#pragma once
+
+namespace facebook::react {
+
+class FabricRichTextEventEmitter {};
+
+} // namespace facebook::react
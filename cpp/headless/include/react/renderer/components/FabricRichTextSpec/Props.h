@@ -0,0 +1,35 @@
+/**
+ * Props.h
+ *
+ * Headless stand-in for the codegen props of src/FabricRichTextNativeComponent.ts,
+ * with codegen's defaults. Only the props shadow nodes read are declared.
+ */
+
+#pragma once
+
+#include <react/renderer/components/view/ConcreteViewShadowNode.h>
+#include <react/renderer/graphics/Float.h>
+
+#include <string>
+
+namespace facebook::react {
+
+class FabricRichTextProps final : public ViewProps {
+ public:
+  std::string text{};
+  std::string tagStyles{};
+  Float fontSize{0.0};
+  Float lineHeight{0.0};
+  std::string fontWeight{};
+  std::string fontFamily{};
+  std::string fontStyle{};
+  Float letterSpacing{0.0};
+  bool allowFontScaling{false};
+  Float maxFontSizeMultiplier{0.0};
+  int color{0};
+  int numberOfLines{0};
+  Float animationDuration{0.0};
+  std::string writingDirection{};
+};
+
+} // namespace facebook::react
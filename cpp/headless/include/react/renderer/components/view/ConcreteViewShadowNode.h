@@ -0,0 +1,81 @@
+/**
+ * ConcreteViewShadowNode.h
+ *
+ * Headless stand-in for React Native's
+ * react/renderer/components/view/ConcreteViewShadowNode.h. State data is
+ * carried over to clones (as if the previous state was committed) and
+ * setStateData() calls are counted.
+ */
+
+#pragma once
+
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/graphics/Size.h>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace facebook::react {
+
+class ViewProps : public Props {};
+
+template <const char* concreteComponentName, typename PropsT, typename EventEmitterT, typename StateDataT>
+class ConcreteViewShadowNode : public ShadowNode {
+ public:
+  using ConcreteProps = PropsT;
+  using ConcreteStateData = StateDataT;
+
+  explicit ConcreteViewShadowNode(const ShadowNodeFragment& fragment) : ShadowNode(fragment) {}
+
+  ConcreteViewShadowNode(const ShadowNode& sourceShadowNode, const ShadowNodeFragment& fragment)
+      : ShadowNode(sourceShadowNode, fragment),
+        stateData_(static_cast<const ConcreteViewShadowNode&>(sourceShadowNode).stateData_) {}
+
+  static ShadowNodeTraits BaseTraits() {
+    return ShadowNodeTraits{};
+  }
+
+  static const char* Name() {
+    return concreteComponentName;
+  }
+
+  const PropsT& getConcreteProps() const {
+    return static_cast<const PropsT&>(*props_);
+  }
+
+  const StateDataT& getStateData() const {
+    static const StateDataT initialData{};
+    return stateData_ ? *stateData_ : initialData;
+  }
+
+  void setStateData(StateDataT&& data) {
+    stateData_ = std::make_shared<const StateDataT>(std::move(data));
+    stateUpdates().fetch_add(1, std::memory_order_relaxed);
+  }
+
+  virtual void layout(LayoutContext /* layoutContext */) {}
+
+  virtual Size measureContent(
+      const LayoutContext& /* layoutContext */,
+      const LayoutConstraints& /* layoutConstraints */) const {
+    return Size{};
+  }
+
+  /**
+   * setStateData() calls on nodes of this type since the process started.
+   */
+  static size_t stateUpdateCount() {
+    return stateUpdates().load(std::memory_order_relaxed);
+  }
+
+ private:
+  static std::atomic<size_t>& stateUpdates() {
+    static std::atomic<size_t> count{0};
+    return count;
+  }
+
+  std::shared_ptr<const StateDataT> stateData_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,10 @@
+/**
+ * ViewShadowNode.h
+ *
+ * Headless stand-in for React Native's
+ * react/renderer/components/view/ViewShadowNode.h.
+ */
+
+#pragma once
+
+#include <react/renderer/components/view/ConcreteViewShadowNode.h>
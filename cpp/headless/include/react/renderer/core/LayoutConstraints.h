@@ -0,0 +1,28 @@
+/**
+ * LayoutConstraints.h
+ *
+ * Headless stand-in for React Native's
+ * react/renderer/core/LayoutConstraints.h.
+ */
+
+#pragma once
+
+#include <react/renderer/graphics/Size.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace facebook::react {
+
+struct LayoutConstraints {
+  Size minimumSize{0, 0};
+  Size maximumSize{std::numeric_limits<Float>::infinity(), std::numeric_limits<Float>::infinity()};
+
+  Size clamp(const Size& size) const {
+    return Size{
+        std::max(minimumSize.width, std::min(maximumSize.width, size.width)),
+        std::max(minimumSize.height, std::min(maximumSize.height, size.height))};
+  }
+};
+
+} // namespace facebook::react
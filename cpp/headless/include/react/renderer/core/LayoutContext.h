@@ -0,0 +1,18 @@
+/**
+ * LayoutContext.h
+ *
+ * Headless stand-in for React Native's react/renderer/core/LayoutContext.h.
+ */
+
+#pragma once
+
+#include <react/renderer/graphics/Float.h>
+
+namespace facebook::react {
+
+struct LayoutContext {
+  Float pointScaleFactor{1.0};
+  Float fontSizeMultiplier{1.0};
+};
+
+} // namespace facebook::react
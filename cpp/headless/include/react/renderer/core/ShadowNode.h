@@ -0,0 +1,87 @@
+/**
+ * ShadowNode.h
+ *
+ * Headless stand-in for React Native's react/renderer/core/ShadowNode.h:
+ * immutable props, cloning, sealing and traits, without families, children
+ * or Yoga.
+ */
+
+#pragma once
+
+#include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/core/LayoutContext.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+namespace facebook::react {
+
+class ContextContainer {};
+
+class Props {
+ public:
+  virtual ~Props() = default;
+};
+
+struct ShadowNodeFragment {
+  // nullptr keeps the source node's props when cloning
+  std::shared_ptr<const Props> props;
+};
+
+class ShadowNodeTraits {
+ public:
+  enum class Trait : uint32_t {
+    None = 0,
+    LeafYogaNode = 1 << 0,
+    MeasurableYogaNode = 1 << 1,
+  };
+
+  void set(Trait trait) {
+    traits_ |= static_cast<uint32_t>(trait);
+  }
+
+  bool check(Trait trait) const {
+    return (traits_ & static_cast<uint32_t>(trait)) != 0;
+  }
+
+ private:
+  uint32_t traits_ = 0;
+};
+
+class ShadowNode {
+ public:
+  explicit ShadowNode(const ShadowNodeFragment& fragment) : props_(fragment.props) {}
+
+  ShadowNode(const ShadowNode& sourceShadowNode, const ShadowNodeFragment& fragment)
+      : props_(fragment.props ? fragment.props : sourceShadowNode.props_),
+        contextContainer_(sourceShadowNode.contextContainer_) {}
+
+  virtual ~ShadowNode() = default;
+
+  /**
+   * Called once a node is committed; layout() must not run after.
+   */
+  void seal() const {
+    sealed_ = true;
+  }
+
+  void ensureUnsealed() const {
+    if (sealed_) {
+      throw std::logic_error("Attempt to mutate a sealed shadow node");
+    }
+  }
+
+  std::shared_ptr<const ContextContainer> getContextContainer() const {
+    return contextContainer_;
+  }
+
+ protected:
+  std::shared_ptr<const Props> props_;
+
+ private:
+  std::shared_ptr<const ContextContainer> contextContainer_ = std::make_shared<const ContextContainer>();
+  mutable bool sealed_ = false;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,55 @@
+/**
+ * Color.h
+ *
+ * Headless stand-in for React Native's react/renderer/graphics/Color.h:
+ * an optional ARGB value, with the conversions the shared parser uses.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::react {
+
+class SharedColor {
+ public:
+  SharedColor() = default;
+  SharedColor(int32_t color) : color_(color), isSet_(true) {}
+
+  int32_t operator*() const {
+    return color_;
+  }
+
+  explicit operator bool() const {
+    return isSet_;
+  }
+
+  bool operator==(const SharedColor& other) const = default;
+
+ private:
+  int32_t color_ = 0;
+  bool isSet_ = false;
+};
+
+struct ColorComponents {
+  float red = 0;
+  float green = 0;
+  float blue = 0;
+  float alpha = 0;
+};
+
+inline SharedColor colorFromRGBA(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+  return SharedColor(static_cast<int32_t>(
+      static_cast<uint32_t>(a) << 24 | static_cast<uint32_t>(r) << 16 | static_cast<uint32_t>(g) << 8 | b));
+}
+
+inline ColorComponents colorComponentsFromColor(SharedColor color) {
+  auto argb = static_cast<uint32_t>(*color);
+  return ColorComponents{
+      ((argb >> 16) & 0xFF) / 255.0f,
+      ((argb >> 8) & 0xFF) / 255.0f,
+      (argb & 0xFF) / 255.0f,
+      ((argb >> 24) & 0xFF) / 255.0f};
+}
+
+} // namespace facebook::react
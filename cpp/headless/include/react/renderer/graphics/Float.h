@@ -0,0 +1,13 @@
+/**
+ * Float.h
+ *
+ * Headless stand-in for React Native's react/renderer/graphics/Float.h.
+ */
+
+#pragma once
+
+namespace facebook::react {
+
+using Float = float;
+
+} // namespace facebook::react
@@ -0,0 +1,20 @@
+/**
+ * Size.h
+ *
+ * Headless stand-in for React Native's react/renderer/graphics/Size.h.
+ */
+
+#pragma once
+
+#include <react/renderer/graphics/Float.h>
+
+namespace facebook::react {
+
+struct Size {
+  Float width{0};
+  Float height{0};
+
+  bool operator==(const Size& other) const = default;
+};
+
+} // namespace facebook::react
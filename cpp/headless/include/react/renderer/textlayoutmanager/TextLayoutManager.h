@@ -0,0 +1,83 @@
+/**
+ * TextLayoutManager.h
+ *
+ * Headless stand-in for React Native's
+ * react/renderer/textlayoutmanager/TextLayoutManager.h. Lays text out with
+ * HeightEstimator over a monospace advance width table, so sizes are
+ * deterministic and can be worked out by hand, and can simulate the
+ * latency of platform text layout. Measurements are counted.
+ */
+
+#pragma once
+
+#include <react/renderer/attributedstring/AttributedString.h>
+#include <react/renderer/attributedstring/ParagraphAttributes.h>
+#include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/graphics/Size.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace facebook::react {
+
+class AttributedStringBox {
+ public:
+  explicit AttributedStringBox(const AttributedString& value) : value_(value) {}
+
+  const AttributedString& getValue() const {
+    return value_;
+  }
+
+ private:
+  AttributedString value_;
+};
+
+struct TextLayoutContext {
+  Float pointScaleFactor{1.0};
+};
+
+struct TextMeasurement {
+  Size size;
+};
+
+class TextLayoutManager {
+ public:
+  explicit TextLayoutManager(const std::shared_ptr<const ContextContainer>& contextContainer);
+
+  TextMeasurement measure(
+      const AttributedStringBox& attributedStringBox,
+      const ParagraphAttributes& paragraphAttributes,
+      const TextLayoutContext& layoutContext,
+      const LayoutConstraints& layoutConstraints) const;
+};
+
+namespace headless {
+
+/**
+ * Metrics of the stand-in text layout. Process-wide; set before measuring.
+ */
+struct TextMetrics {
+  // Advance of every glyph, in ems
+  Float advance = 0.5f;
+  // Line height as a multiple of the font size, for fragments without one
+  Float lineHeight = 1.2f;
+  // Time each measurement takes, spent busy like real text layout
+  std::chrono::microseconds latency{0};
+};
+
+void setTextMetrics(const TextMetrics& metrics);
+
+TextMetrics textMetrics();
+
+/**
+ * TextLayoutManager::measure() calls since the last reset.
+ */
+size_t measureCount();
+
+void resetMeasureCount();
+
+} // namespace headless
+
+} // namespace facebook::react
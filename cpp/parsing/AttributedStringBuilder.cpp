@@ -5,45 +5,166 @@
  */
 
 #include "AttributedStringBuilder.h"
+#include "ParallelMarkupParser.h"
+#include "ParseStats.h"
+#include "PipelineMetrics.h"
+#include "PipelinePhase.h"
 #include "StyleParser.h"
 #include "TextNormalizer.h"
+#include "UnicodeUtils.h"
+#include "Utf8Validator.h"
 
 #include <react/renderer/graphics/Color.h>
 #include <cmath>
 #include <cctype>
+#include <limits>
 
 namespace facebook::react::parsing {
 
-std::string buildAccessibilityLabel(const std::string& plainText) {
-  std::string a11yLabel;
-  a11yLabel.reserve(plainText.size() + 20);
-
-  for (size_t i = 0; i < plainText.size(); ++i) {
-    char c = plainText[i];
-
-    // Check for newline followed by list item marker (digit+period or bullet)
-    if (c == '\n' && i + 1 < plainText.size()) {
-      char next = plainText[i + 1];
-      bool isListMarker = (std::isdigit(static_cast<unsigned char>(next)) ||
-                           // Check for bullet character (UTF-8: E2 80 A2)
-                           (i + 3 < plainText.size() &&
-                            static_cast<unsigned char>(next) == 0xE2 &&
-                            static_cast<unsigned char>(plainText[i + 2]) == 0x80 &&
-                            static_cast<unsigned char>(plainText[i + 3]) == 0xA2));
-
-      if (isListMarker && !a11yLabel.empty()) {
-        // Check if we need to add a period before the newline
-        char lastChar = a11yLabel.back();
-        if (lastChar != '.' && lastChar != '!' && lastChar != '?' &&
-            lastChar != ':' && lastChar != ';') {
-          a11yLabel += '.';
-        }
+namespace {
+
+/**
+ * Finds accessibility pauses in text fed in pieces. A line break is a pause
+ * if the bytes after it start a list marker; the marker may continue in a
+ * later piece.
+ */
+class AccessibilityPauseScanner {
+ public:
+  void feed(std::string_view text) {
+    for (char c : text) {
+      auto byte = static_cast<unsigned char>(c);
+      if (matched_ >= 0 && !continuesMarker(byte)) {
+        matched_ = -1;
       }
+      if (c == '\n' && offset_ > 0 && !isPausePunctuation(previous_)) {
+        // Candidate pause before this line break
+        candidate_ = offset_;
+        matched_ = 0;
+      }
+      previous_ = c;
+      offset_++;
+    }
+  }
+
+  std::vector<uint32_t> take() && {
+    return std::move(pauses_);
+  }
+
+ private:
+  static bool isPausePunctuation(char c) {
+    return c == '.' || c == '!' || c == '?' || c == ':' || c == ';';
+  }
+
+  // Digit, or the next byte of a bullet (UTF-8: E2 80 A2)
+  bool continuesMarker(unsigned char byte) {
+    static constexpr unsigned char kBullet[] = {0xE2, 0x80, 0xA2};
+    if (matched_ == 0 && std::isdigit(byte)) {
+      pauses_.push_back(candidate_);
+      return false;
+    }
+    if (byte != kBullet[matched_]) {
+      return false;
+    }
+    if (++matched_ < 3) {
+      return true;
+    }
+    pauses_.push_back(candidate_);
+    return false;
+  }
+
+  std::vector<uint32_t> pauses_;
+  uint32_t offset_ = 0;
+  uint32_t candidate_ = 0;
+  int matched_ = -1;  // Bytes of the marker after candidate_ seen, -1 = none
+  char previous_ = 0;
+};
+
+std::string insertPauses(std::string text, const std::vector<uint32_t>& pauses) {
+  if (pauses.empty()) {
+    return text;
+  }
+  std::string label;
+  label.reserve(text.size() + pauses.size());
+  size_t copied = 0;
+  for (uint32_t pause : pauses) {
+    label.append(text, copied, pause - copied);
+    label += '.';
+    copied = pause;
+  }
+  label.append(text, copied, std::string::npos);
+  return label;
+}
+
+} // namespace
+
+std::vector<uint32_t> findAccessibilityPauses(const AttributedString& attributedString) {
+  PipelinePhaseScope phase(PipelinePhase::Accessibility);
+  AccessibilityPauseScanner scanner;
+  for (const auto& fragment : attributedString.getFragments()) {
+    scanner.feed(fragment.string);
+  }
+  return std::move(scanner).take();
+}
+
+std::string buildAccessibilityLabel(
+    const AttributedString& attributedString,
+    const std::vector<uint32_t>& pauses) {
+  PipelinePhaseScope phase(PipelinePhase::Accessibility);
+  std::string label;
+  size_t size = pauses.size();
+  for (const auto& fragment : attributedString.getFragments()) {
+    size += fragment.string.size();
+  }
+  label.reserve(size);
+
+  // Pauses are ascending, so one pass over the fragments places them all
+  auto pause = pauses.begin();
+  size_t offset = 0;
+  for (const auto& fragment : attributedString.getFragments()) {
+    size_t copied = 0;
+    while (pause != pauses.end() && *pause < offset + fragment.string.size()) {
+      label.append(fragment.string, copied, *pause - offset - copied);
+      label += '.';
+      copied = *pause - offset;
+      ++pause;
     }
-    a11yLabel += c;
+    label.append(fragment.string, copied, std::string::npos);
+    offset += fragment.string.size();
   }
+  return label;
+}
 
-  return a11yLabel;
+std::string buildAccessibilityLabel(const std::string& plainText) {
+  PipelinePhaseScope phase(PipelinePhase::Accessibility);
+  AccessibilityPauseScanner scanner;
+  scanner.feed(plainText);
+  return insertPauses(plainText, std::move(scanner).take());
+}
+
+std::string AttributedStringResult::accessibilityLabel() const {
+  return buildAccessibilityLabel(attributedString, accessibilityPauses);
+}
+
+namespace {
+
+bool sameFloat(float a, float b) {
+  return (std::isnan(a) && std::isnan(b)) || a == b;
+}
+
+} // namespace
+
+bool StyleOptions::operator==(const StyleOptions& other) const {
+  return sameFloat(baseFontSize, other.baseFontSize) &&
+         sameFloat(fontSizeMultiplier, other.fontSizeMultiplier) &&
+         allowFontScaling == other.allowFontScaling &&
+         sameFloat(maxFontSizeMultiplier, other.maxFontSizeMultiplier) &&
+         sameFloat(lineHeight, other.lineHeight) &&
+         fontWeight == other.fontWeight &&
+         fontFamily == other.fontFamily &&
+         fontStyle == other.fontStyle &&
+         sameFloat(letterSpacing, other.letterSpacing) &&
+         color == other.color &&
+         tagStyles == other.tagStyles;
 }
 
 AttributedStringResult buildAttributedString(
@@ -59,187 +180,318 @@ AttributedStringResult buildAttributedString(
     float letterSpacing,
     int32_t color,
     const std::string& tagStyles) {
+  StyleOptions options;
+  options.baseFontSize = baseFontSize;
+  options.fontSizeMultiplier = fontSizeMultiplier;
+  options.allowFontScaling = allowFontScaling;
+  options.maxFontSizeMultiplier = maxFontSizeMultiplier;
+  options.lineHeight = lineHeight;
+  options.fontWeight = fontWeight;
+  options.fontFamily = fontFamily;
+  options.fontStyle = fontStyle;
+  options.letterSpacing = letterSpacing;
+  options.color = color;
+  options.tagStyles = tagStyles;
+  return buildAttributedString(segments, options);
+}
 
-  AttributedStringResult result;
-
-  if (segments.empty()) {
-    return result;
+AttributedStringResult parseAndBuildAttributedString(
+    std::string_view markup,
+    const StyleOptions& options) {
+  if (markup.empty()) {
+    return AttributedStringResult{};
+  }
+  recordParse(ParseKind::Full);
+  TraceScope trace("parseMarkup", TraceArgs{0, markup.size(), 0});
+  if (trace.enabled()) {
+    trace.args().hash = hashMarkup(markup);
+  }
+  std::string repairBuffer;
+  std::string_view input;
+  {
+    PhaseTimer timer(MetricPhase::Sanitize, markup.size());
+    input = ensureValidUtf8(markup, repairBuffer);
   }
+  MarkupSegmentParser parser;
+  {
+    // Inter-tag whitespace is normalized and markup sanitized inline while parsing
+    PhaseTimer timer(MetricPhase::Tokenize, markup.size());
+    parser = parseMarkupParallel(input, renderingParserOptions());
+    parser.finish();
+  }
+  PhaseTimer timer(MetricPhase::Build, markup.size());
+  auto result = buildAttributedString(parser.segments(), options);
+  result.limitsHit = parser.limitsHit();
+  result.summary.addLimitsHit(result.limitsHit);
+  trace.args().fragments = result.attributedString.getFragments().size();
+  return result;
+}
 
-  // Make a copy of segments to allow trimming
-  auto workingSegments = segments;
+void summarizeFragment(DocumentSummary& summary, const FabricRichTextSegment& segment, std::string_view text) {
+  summary.fragmentCount++;
+  summary.textBytes = static_cast<uint32_t>(
+      std::min<size_t>(std::numeric_limits<uint32_t>::max(), summary.textBytes + text.size()));
+  summary.maxHeadingLevel = std::max(summary.maxHeadingLevel, segment.headingLevel);
+  if (segment.hasListMarker) {
+    summary.set(DocumentFeature::Lists);
+  }
+  if (!summary.has(DocumentFeature::Bidi) &&
+      (segment.writingDirection == WritingDirection::RightToLeft || segment.isBdiIsolated ||
+       segment.isBdoOverride || containsBidi(text))) {
+    summary.set(DocumentFeature::Bidi);
+  }
+}
 
-  // Trim trailing paragraph break segments
-  while (!workingSegments.empty()) {
-    const auto& last = workingSegments.back();
-    if (isParagraphBreak(last.text)) {
-      workingSegments.pop_back();
-    } else {
-      break;
-    }
+void finishSummary(AttributedStringResult& result) {
+  auto& summary = result.summary;
+  summary.linkCount = static_cast<uint32_t>(result.links.runs().size());
+  if (summary.linkCount > 0) {
+    summary.set(DocumentFeature::Links);
   }
+}
 
-  if (workingSegments.empty()) {
-    return result;
+size_t countSegmentsToBuild(const std::vector<FabricRichTextSegment>& segments) {
+  // Trim trailing paragraph break segments
+  size_t count = segments.size();
+  while (count > 0 && isParagraphBreak(segments[count - 1].text)) {
+    count--;
   }
+  return count;
+}
 
+float effectiveFontSizeMultiplier(const StyleOptions& options) {
   // Apply font scaling with max multiplier cap
-  float effectiveMultiplier = fontSizeMultiplier;
-  if (allowFontScaling) {
-    if (!std::isnan(maxFontSizeMultiplier) && maxFontSizeMultiplier > 0) {
-      effectiveMultiplier = std::min(fontSizeMultiplier, maxFontSizeMultiplier);
+  float effectiveMultiplier = options.fontSizeMultiplier;
+  if (options.allowFontScaling) {
+    if (!std::isnan(options.maxFontSizeMultiplier) && options.maxFontSizeMultiplier > 0) {
+      effectiveMultiplier = std::min(options.fontSizeMultiplier, options.maxFontSizeMultiplier);
     }
   } else {
     effectiveMultiplier = 1.0f;
   }
+  return effectiveMultiplier;
+}
 
-  for (size_t segIdx = 0; segIdx < workingSegments.size(); ++segIdx) {
-    const auto& segment = workingSegments[segIdx];
-    bool isBreak = isParagraphBreak(segment.text);
-    std::string normalizedText = normalizeSegmentText(
-        segment.text, isBreak, segment.followsInlineElement);
+FragmentBuildContext::FragmentBuildContext(const StyleOptions& options)
+    : effectiveMultiplier(effectiveFontSizeMultiplier(options)),
+      tagStyles(options.tagStyles) {}
 
-    // Trim trailing whitespace from the last segment
-    if (segIdx == workingSegments.size() - 1) {
-      while (!normalizedText.empty() &&
-             std::isspace(static_cast<unsigned char>(normalizedText.back()))) {
-        normalizedText.pop_back();
-      }
-    }
+AttributedStringResult buildAttributedString(
+    const std::vector<FabricRichTextSegment>& segments,
+    const StyleOptions& options) {
+  return buildAttributedString(segments, options, FragmentBuildContext(options));
+}
+
+AttributedStringResult buildAttributedString(
+    const std::vector<FabricRichTextSegment>& segments,
+    const StyleOptions& options,
+    const FragmentBuildContext& context) {
+  PipelinePhaseScope phase(PipelinePhase::Build);
+  AttributedStringResult result;
+
+  size_t segmentCount = countSegmentsToBuild(segments);
+  if (segmentCount == 0) {
+    return result;
+  }
 
-    if (normalizedText.empty()) {
+  LinkTableBuilder links;
+  for (size_t segIdx = 0; segIdx < segmentCount; ++segIdx) {
+    const auto& segment = segments[segIdx];
+    AttributedString::Fragment fragment;
+    if (!buildFragment(segment, options, context, segIdx == segmentCount - 1, fragment)) {
       continue;
     }
+    summarizeFragment(result.summary, segment, fragment.string);
+    links.add(result.attributedString.getFragments().size(), segment.linkUrl);
+    result.attributedString.appendFragment(std::move(fragment));
+  }
+  result.links = std::move(links).build();
 
-    auto fragment = AttributedString::Fragment{};
-    auto textAttributes = TextAttributes::defaultTextAttributes();
+  // Only where the accessibility label pauses is kept; the label itself is
+  // built when a consumer asks for it
+  result.accessibilityPauses = findAccessibilityPauses(result.attributedString);
+  finishSummary(result);
 
-    textAttributes.allowFontScaling = allowFontScaling;
+  return result;
+}
 
-    // Get tagStyles for this segment's parent tag
-    FabricRichTagStyle tagStyle;
-    if (!segment.parentTag.empty() && !tagStyles.empty()) {
-      tagStyle = getStyleFromTagStyles(tagStyles, segment.parentTag);
-    }
+float segmentFontSize(
+    const FabricRichTextSegment& segment,
+    const StyleOptions& options,
+    const FragmentBuildContext& context) {
+  // tagStyles overrides the heading scale
+  const FabricRichTagStyle& tagStyle = context.tagStyles.styleFor(segment.parentTag);
+  if (!std::isnan(tagStyle.fontSize) && tagStyle.fontSize > 0) {
+    return tagStyle.fontSize * context.effectiveMultiplier;
+  }
+  return options.baseFontSize * segment.fontScale * context.effectiveMultiplier;
+}
 
-    // Calculate fontSize - tagStyles overrides segment fontSize
-    float segmentFontSize = baseFontSize * segment.fontScale * effectiveMultiplier;
-    if (!std::isnan(tagStyle.fontSize) && tagStyle.fontSize > 0) {
-      segmentFontSize = tagStyle.fontSize * effectiveMultiplier;
-    }
-    textAttributes.fontSize = segmentFontSize;
-
-    // Apply lineHeight
-    float minLineHeight = segmentFontSize + LINE_HEIGHT_BUFFER_DEFAULT;
-    if (!std::isnan(lineHeight) && lineHeight > 0) {
-      textAttributes.lineHeight = std::max(lineHeight, minLineHeight);
-    } else {
-      textAttributes.lineHeight = minLineHeight;
-    }
+bool buildSegmentText(const FabricRichTextSegment& segment, bool isLast, std::string& text) {
+  PipelinePhaseScope phase(PipelinePhase::Normalize);
+  bool isBreak = isParagraphBreak(segment.text);
+  text = normalizeSegmentText(segment.text, isBreak, segment.followsInlineElement);
 
-    // Apply fontWeight
-    bool isBold = segment.isBold;
-    if (!tagStyle.fontWeight.empty()) {
-      isBold = (tagStyle.fontWeight == "bold" || tagStyle.fontWeight == "700" ||
-                tagStyle.fontWeight == "800" || tagStyle.fontWeight == "900");
-    }
-    if (isBold) {
-      textAttributes.fontWeight = FontWeight::Bold;
-    } else if (!fontWeight.empty()) {
-      if (fontWeight == "bold" || fontWeight == "700" ||
-          fontWeight == "800" || fontWeight == "900") {
-        textAttributes.fontWeight = FontWeight::Bold;
-      }
+  // Trim trailing whitespace from the last segment
+  if (isLast) {
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+      text.pop_back();
     }
+  }
 
-    // Apply fontFamily
-    if (!fontFamily.empty()) {
-      textAttributes.fontFamily = fontFamily;
-    }
+  return !text.empty();
+}
 
-    // Apply fontStyle
-    bool isItalic = segment.isItalic;
-    if (!tagStyle.fontStyle.empty()) {
-      isItalic = (tagStyle.fontStyle == "italic");
-    }
-    if (isItalic) {
-      textAttributes.fontStyle = FontStyle::Italic;
-    } else if (!fontStyle.empty()) {
-      if (fontStyle == "italic") {
-        textAttributes.fontStyle = FontStyle::Italic;
-      }
+std::string buildPlainText(const std::vector<FabricRichTextSegment>& segments) {
+  std::string plainText;
+  std::string text;
+  size_t segmentCount = countSegmentsToBuild(segments);
+  for (size_t segIdx = 0; segIdx < segmentCount; ++segIdx) {
+    if (buildSegmentText(segments[segIdx], segIdx == segmentCount - 1, text)) {
+      plainText += text;
     }
+  }
+  return plainText;
+}
 
-    // Apply letterSpacing
-    if (!std::isnan(letterSpacing)) {
-      textAttributes.letterSpacing = letterSpacing;
-    }
+std::string stripMarkupTags(const std::string& markup) {
+  if (markup.empty()) {
+    return {};
+  }
+  std::string repairBuffer;
+  auto parser = parseMarkupParallel(ensureValidUtf8(markup, repairBuffer), renderingParserOptions());
+  parser.finish();
+  return buildPlainText(parser.segments());
+}
 
-    // Apply textDecorationLine
-    bool hasUnderline = segment.isUnderline;
-    bool hasStrikethrough = segment.isStrikethrough;
-
-    if (!tagStyle.textDecorationLine.empty()) {
-      if (tagStyle.textDecorationLine == "underline") {
-        hasUnderline = true;
-        hasStrikethrough = false;
-      } else if (tagStyle.textDecorationLine == "line-through") {
-        hasUnderline = false;
-        hasStrikethrough = true;
-      } else if (tagStyle.textDecorationLine == "underline line-through" ||
-                 tagStyle.textDecorationLine == "line-through underline") {
-        hasUnderline = true;
-        hasStrikethrough = true;
-      } else if (tagStyle.textDecorationLine == "none") {
-        hasUnderline = false;
-        hasStrikethrough = false;
-      }
-    }
+bool buildFragment(
+    const FabricRichTextSegment& segment,
+    const StyleOptions& options,
+    const FragmentBuildContext& context,
+    bool isLast,
+    AttributedString::Fragment& fragment) {
+  bool allowFontScaling = options.allowFontScaling;
+  float lineHeight = options.lineHeight;
+  const auto& fontWeight = options.fontWeight;
+  const auto& fontFamily = options.fontFamily;
+  const auto& fontStyle = options.fontStyle;
+  float letterSpacing = options.letterSpacing;
+  int32_t color = options.color;
+
+  std::string normalizedText;
+  if (!buildSegmentText(segment, isLast, normalizedText)) {
+    return false;
+  }
+
+  PipelinePhaseScope phase(PipelinePhase::Style);
+  auto textAttributes = TextAttributes::defaultTextAttributes();
+
+  textAttributes.allowFontScaling = allowFontScaling;
+
+  // Get tagStyles for this segment's parent tag
+  const FabricRichTagStyle& tagStyle = context.tagStyles.styleFor(segment.parentTag);
 
-    if (hasUnderline && hasStrikethrough) {
-      textAttributes.textDecorationLineType = TextDecorationLineType::UnderlineStrikethrough;
-    } else if (hasUnderline) {
-      textAttributes.textDecorationLineType = TextDecorationLineType::Underline;
-    } else if (hasStrikethrough) {
-      textAttributes.textDecorationLineType = TextDecorationLineType::Strikethrough;
+  float fontSize = segmentFontSize(segment, options, context);
+  textAttributes.fontSize = fontSize;
+
+  // Apply lineHeight
+  float minLineHeight = fontSize + LINE_HEIGHT_BUFFER_DEFAULT;
+  if (!std::isnan(lineHeight) && lineHeight > 0) {
+    textAttributes.lineHeight = std::max(lineHeight, minLineHeight);
+  } else {
+    textAttributes.lineHeight = minLineHeight;
+  }
+
+  // Apply fontWeight
+  bool isBold = segment.isBold;
+  if (!tagStyle.fontWeight.empty()) {
+    isBold = (tagStyle.fontWeight == "bold" || tagStyle.fontWeight == "700" ||
+              tagStyle.fontWeight == "800" || tagStyle.fontWeight == "900");
+  }
+  if (isBold) {
+    textAttributes.fontWeight = FontWeight::Bold;
+  } else if (!fontWeight.empty()) {
+    if (fontWeight == "bold" || fontWeight == "700" ||
+        fontWeight == "800" || fontWeight == "900") {
+      textAttributes.fontWeight = FontWeight::Bold;
     }
+  }
 
-    // Apply foreground color
-    // Priority: tagStyle.color > default link color (for links with href) > base color
-    int32_t colorToApply = tagStyle.color;
-    if (colorToApply == 0) {
-      if (segment.isLink) {
-        colorToApply = DEFAULT_LINK_COLOR;
-      } else if (color != 0) {
-        colorToApply = color;
-      }
+  // Apply fontFamily
+  if (!fontFamily.empty()) {
+    textAttributes.fontFamily = fontFamily;
+  }
+
+  // Apply fontStyle
+  bool isItalic = segment.isItalic;
+  if (!tagStyle.fontStyle.empty()) {
+    isItalic = (tagStyle.fontStyle == "italic");
+  }
+  if (isItalic) {
+    textAttributes.fontStyle = FontStyle::Italic;
+  } else if (!fontStyle.empty()) {
+    if (fontStyle == "italic") {
+      textAttributes.fontStyle = FontStyle::Italic;
     }
+  }
+
+  // Apply letterSpacing
+  if (!std::isnan(letterSpacing)) {
+    textAttributes.letterSpacing = letterSpacing;
+  }
 
-    if (colorToApply != 0) {
-      uint8_t a = (colorToApply >> 24) & 0xFF;
-      uint8_t r = (colorToApply >> 16) & 0xFF;
-      uint8_t g = (colorToApply >> 8) & 0xFF;
-      uint8_t b = colorToApply & 0xFF;
-      textAttributes.foregroundColor = colorFromRGBA(r, g, b, a);
+  // Apply textDecorationLine
+  bool hasUnderline = segment.isUnderline;
+  bool hasStrikethrough = segment.isStrikethrough;
+
+  if (!tagStyle.textDecorationLine.empty()) {
+    if (tagStyle.textDecorationLine == "underline") {
+      hasUnderline = true;
+      hasStrikethrough = false;
+    } else if (tagStyle.textDecorationLine == "line-through") {
+      hasUnderline = false;
+      hasStrikethrough = true;
+    } else if (tagStyle.textDecorationLine == "underline line-through" ||
+               tagStyle.textDecorationLine == "line-through underline") {
+      hasUnderline = true;
+      hasStrikethrough = true;
+    } else if (tagStyle.textDecorationLine == "none") {
+      hasUnderline = false;
+      hasStrikethrough = false;
     }
+  }
 
-    fragment.string = normalizedText;
-    fragment.textAttributes = textAttributes;
+  if (hasUnderline && hasStrikethrough) {
+    textAttributes.textDecorationLineType = TextDecorationLineType::UnderlineStrikethrough;
+  } else if (hasUnderline) {
+    textAttributes.textDecorationLineType = TextDecorationLineType::Underline;
+  } else if (hasStrikethrough) {
+    textAttributes.textDecorationLineType = TextDecorationLineType::Strikethrough;
+  }
 
-    result.attributedString.appendFragment(std::move(fragment));
-    result.linkUrls.push_back(segment.linkUrl);
+  // Apply foreground color
+  // Priority: tagStyle.color > default link color (for links with href) > base color
+  int32_t colorToApply = tagStyle.color;
+  if (colorToApply == 0) {
+    if (segment.isLink) {
+      colorToApply = DEFAULT_LINK_COLOR;
+    } else if (color != 0) {
+      colorToApply = color;
+    }
   }
 
-  // Build accessibility label with proper pauses between list items
-  // Get the plain text from the attributed string
-  std::string plainText;
-  for (const auto& fragment : result.attributedString.getFragments()) {
-    plainText += fragment.string;
+  if (colorToApply != 0) {
+    uint8_t a = (colorToApply >> 24) & 0xFF;
+    uint8_t r = (colorToApply >> 16) & 0xFF;
+    uint8_t g = (colorToApply >> 8) & 0xFF;
+    uint8_t b = colorToApply & 0xFF;
+    textAttributes.foregroundColor = colorFromRGBA(r, g, b, a);
   }
 
-  result.accessibilityLabel = buildAccessibilityLabel(plainText);
+  fragment.string = std::move(normalizedText);
+  fragment.textAttributes = textAttributes;
 
-  return result;
+  return true;
 }
 
 } // namespace facebook::react::parsing
@@ -7,25 +7,63 @@
 
 #pragma once
 
+#include "DocumentSummary.h"
+#include "LinkTable.h"
 #include "MarkupSegmentParser.h"
 #include "StyleParser.h"
 #include "TextNormalizer.h"
 
 #include <react/renderer/attributedstring/AttributedString.h>
 
+#include <cmath>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace facebook::react::parsing {
 
+struct ParseSnapshot;
+
 /**
- * Result of building attributed string, containing the string, link URLs,
- * and accessibility label.
+ * Result of building attributed string, containing the string, links,
+ * and where the accessibility label pauses.
  */
 struct AttributedStringResult {
   AttributedString attributedString;
-  std::vector<std::string> linkUrls;  // URLs indexed by fragment position
-  std::string accessibilityLabel;     // Screen reader friendly version with pauses
+  LinkTable links;                           // Link URLs by fragment range
+  std::vector<uint32_t> accessibilityPauses; // See findAccessibilityPauses()
+  ParseLimitsHit limitsHit = 0;              // ParseLimits the parse degraded at
+  DocumentSummary summary;                   // What the text contains; see finishSummary()
+  std::shared_ptr<const ParseSnapshot> snapshot; // Parse a session can resume from, if kept
+
+  /**
+   * Screen reader friendly version of the text with pauses between list
+   * items. Built on each call; the result only keeps the pause offsets.
+   */
+  std::string accessibilityLabel() const;
+};
+
+/**
+ * Base text style applied when building fragments from segments.
+ * Mirrors the style-related props of the FabricRichText component.
+ */
+struct StyleOptions {
+  float baseFontSize = 14.0f;
+  float fontSizeMultiplier = 1.0f;
+  bool allowFontScaling = true;
+  float maxFontSizeMultiplier = NAN;  // NAN or 0 = no limit
+  float lineHeight = NAN;             // NAN = auto
+  std::string fontWeight;
+  std::string fontFamily;
+  std::string fontStyle;
+  float letterSpacing = NAN;
+  int32_t color = 0;                  // ARGB, 0 = default
+  std::string tagStyles;              // JSON string of per-tag style overrides
+
+  bool operator==(const StyleOptions& other) const;
+  bool operator!=(const StyleOptions& other) const { return !(*this == other); }
 };
 
 // Default buffer added to fontSize when lineHeight is not specified
@@ -66,6 +104,132 @@ AttributedStringResult buildAttributedString(
     int32_t color,
     const std::string& tagStyles);
 
+/**
+ * Build an AttributedString from parsed markup segments using StyleOptions.
+ */
+AttributedStringResult buildAttributedString(
+    const std::vector<FabricRichTextSegment>& segments,
+    const StyleOptions& options);
+
+/**
+ * Parse markup and build its AttributedString in one step: the pipeline
+ * behind FabricMarkupParser::parseMarkupWithLinkUrls, without caching.
+ * Large documents are parsed block-parallel (see parseMarkupParallel).
+ */
+AttributedStringResult parseAndBuildAttributedString(
+    std::string_view markup,
+    const StyleOptions& options);
+
+/**
+ * Font size multiplier after applying allowFontScaling and maxFontSizeMultiplier.
+ */
+float effectiveFontSizeMultiplier(const StyleOptions& options);
+
+/**
+ * Setup derived from StyleOptions once and shared by every fragment built
+ * with them: the effective font size multiplier and the compiled tagStyles.
+ */
+struct FragmentBuildContext {
+  FragmentBuildContext() = default;
+  explicit FragmentBuildContext(const StyleOptions& options);
+
+  float effectiveMultiplier = 1.0f;
+  CompiledTagStyles tagStyles;
+};
+
+/**
+ * Build an AttributedString from parsed markup segments, reusing a
+ * FragmentBuildContext created from the same options.
+ */
+AttributedStringResult buildAttributedString(
+    const std::vector<FabricRichTextSegment>& segments,
+    const StyleOptions& options,
+    const FragmentBuildContext& context);
+
+/**
+ * Font size of the fragment buildFragment() makes from a segment: the
+ * segment's tagStyles font size, or the base size times its heading scale,
+ * after font scaling.
+ */
+float segmentFontSize(
+    const FabricRichTextSegment& segment,
+    const StyleOptions& options,
+    const FragmentBuildContext& context);
+
+/**
+ * Text of the fragment buildFragment() makes from a segment: whitespace
+ * normalized, and trailing whitespace trimmed for the last segment.
+ * @return False if the segment produces no fragment
+ */
+bool buildSegmentText(const FabricRichTextSegment& segment, bool isLast, std::string& text);
+
+/**
+ * Text of the AttributedString buildAttributedString() would make from
+ * segments, without resolving any style.
+ */
+std::string buildPlainText(const std::vector<FabricRichTextSegment>& segments);
+
+/**
+ * Strip markup tags from a string, returning plain text content: the text
+ * of the AttributedString that parsing it with any style produces, from
+ * the same tokenizer (sanitized, character references decoded).
+ * @param markup Markup string to strip
+ * @return Plain text content
+ */
+std::string stripMarkupTags(const std::string& markup);
+
+/**
+ * Build the fragment for a single segment.
+ *
+ * @param segment Segment to convert
+ * @param options Base text style
+ * @param context FragmentBuildContext created from options
+ * @param isLast Whether this is the last segment of the document (trailing whitespace is trimmed)
+ * @param fragment Receives the fragment
+ * @return false if the segment produces no visible text and should be skipped
+ */
+bool buildFragment(
+    const FabricRichTextSegment& segment,
+    const StyleOptions& options,
+    const FragmentBuildContext& context,
+    bool isLast,
+    AttributedString::Fragment& fragment);
+
+/**
+ * Count the fragment built from segment, with text, in summary. It needs
+ * bidi handling if the segment is right-to-left, isolated or overridden,
+ * or the text has RTL or bidi control characters.
+ */
+void summarizeFragment(DocumentSummary& summary, const FabricRichTextSegment& segment, std::string_view text);
+
+/**
+ * Complete result.summary once each fragment was counted with
+ * summarizeFragment(): its links, from result.links.
+ */
+void finishSummary(AttributedStringResult& result);
+
+/**
+ * Number of leading segments that produce fragments, i.e. segments with
+ * trailing paragraph-break-only segments removed.
+ */
+size_t countSegmentsToBuild(const std::vector<FabricRichTextSegment>& segments);
+
+/**
+ * Byte offsets into the text of attributedString where the accessibility
+ * label inserts a period: line breaks before a list marker (digit or
+ * bullet) that do not already follow punctuation. Scans the fragments in
+ * place, without joining their text.
+ */
+std::vector<uint32_t> findAccessibilityPauses(const AttributedString& attributedString);
+
+/**
+ * Accessibility label of attributedString: its text with a period inserted
+ * at each offset of pauses (from findAccessibilityPauses()).
+ */
+std::string buildAccessibilityLabel(
+    const AttributedString& attributedString,
+    const std::vector<uint32_t>& pauses);
+
 /**
  * Build accessibility label from plain text with proper pauses between list items.
  * Inserts periods before list markers for screen reader pauses.
@@ -0,0 +1,498 @@
+/**
+ * CompactTextLayout.cpp
+ *
+ * Compact text layout encoding and decoding.
+ */
+
+#include "CompactTextLayout.h"
+
+#include "PipelinePhase.h"
+#include "Utf16TextIndex.h"
+
+#include <react/renderer/graphics/Color.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+constexpr size_t kHeaderSize = 12;
+
+int32_t packColor(const SharedColor& color) {
+  auto components = colorComponentsFromColor(color);
+  auto channel = [](float value) {
+    return static_cast<uint32_t>(std::lround(std::fmin(std::fmax(value, 0.0f), 1.0f) * 255.0f));
+  };
+  return static_cast<int32_t>(
+      channel(components.alpha) << 24 | channel(components.red) << 16 | channel(components.green) << 8 |
+      channel(components.blue));
+}
+
+uint8_t decorationOf(const std::optional<TextDecorationLineType>& type) {
+  if (!type.has_value()) {
+    return CompactTextStyle::DecorationNone;
+  }
+  switch (*type) {
+    case TextDecorationLineType::Underline:
+      return CompactTextStyle::DecorationUnderline;
+    case TextDecorationLineType::Strikethrough:
+      return CompactTextStyle::DecorationStrikethrough;
+    case TextDecorationLineType::UnderlineStrikethrough:
+      return CompactTextStyle::DecorationUnderlineStrikethrough;
+    default:
+      return CompactTextStyle::DecorationNone;
+  }
+}
+
+class Writer {
+ public:
+  explicit Writer(std::vector<uint8_t>& out) : out_(out) {}
+
+  void u8(uint8_t value) {
+    out_.push_back(value);
+  }
+
+  void u16(uint16_t value) {
+    out_.push_back(static_cast<uint8_t>(value));
+    out_.push_back(static_cast<uint8_t>(value >> 8));
+  }
+
+  void u32(uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+      out_.push_back(static_cast<uint8_t>(value >> shift));
+    }
+  }
+
+  void i32(int32_t value) {
+    u32(static_cast<uint32_t>(value));
+  }
+
+  void f32(float value) {
+    u32(std::bit_cast<uint32_t>(value));
+  }
+
+  void bytes(std::string_view value) {
+    out_.insert(out_.end(), value.begin(), value.end());
+  }
+
+ private:
+  std::vector<uint8_t>& out_;
+};
+
+class Reader {
+ public:
+  Reader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+  bool has(size_t count) const {
+    return count <= size_ - pos_;
+  }
+
+  uint8_t u8() {
+    return data_[pos_++];
+  }
+
+  uint16_t u16() {
+    uint16_t value = static_cast<uint16_t>(data_[pos_] | data_[pos_ + 1] << 8);
+    pos_ += 2;
+    return value;
+  }
+
+  uint32_t u32() {
+    uint32_t value = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+      value |= static_cast<uint32_t>(data_[pos_++]) << shift;
+    }
+    return value;
+  }
+
+  int32_t i32() {
+    return static_cast<int32_t>(u32());
+  }
+
+  float f32() {
+    return std::bit_cast<float>(u32());
+  }
+
+  std::string bytes(size_t count) {
+    std::string value(reinterpret_cast<const char*>(data_ + pos_), count);
+    pos_ += count;
+    return value;
+  }
+
+  bool atEnd() const {
+    return pos_ == size_;
+  }
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t pos_ = 0;
+};
+
+void writeStyle(Writer& writer, const CompactTextStyle& style) {
+  writer.f32(style.fontSize);
+  writer.f32(style.lineHeight);
+  writer.f32(style.letterSpacing);
+  writer.i32(style.foregroundColor);
+  writer.i32(style.backgroundColor);
+  writer.u16(style.fontWeight);
+  writer.u8(style.flags);
+  writer.u8(style.textDecoration);
+  writer.i32(style.fontFamily);
+}
+
+struct StyleKeyHash {
+  using is_transparent = void;
+
+  size_t operator()(std::string_view key) const {
+    return std::hash<std::string_view>{}(key);
+  }
+};
+
+} // namespace
+
+CompactTextStyle CompactTextStyle::fromTextAttributes(const TextAttributes& attributes) {
+  CompactTextStyle style;
+  if (!std::isnan(attributes.fontSize)) {
+    style.fontSize = attributes.fontSize;
+    style.flags |= CompactTextStyle::HasFontSize;
+  }
+  style.lineHeight = std::isnan(attributes.lineHeight) ? 0 : attributes.lineHeight;
+  style.letterSpacing = std::isnan(attributes.letterSpacing) ? 0 : attributes.letterSpacing;
+  if (attributes.foregroundColor) {
+    style.foregroundColor = packColor(attributes.foregroundColor);
+    style.flags |= CompactTextStyle::HasForegroundColor;
+  }
+  if (attributes.backgroundColor) {
+    style.backgroundColor = packColor(attributes.backgroundColor);
+    style.flags |= CompactTextStyle::HasBackgroundColor;
+  }
+  if (attributes.fontWeight.has_value()) {
+    style.fontWeight = static_cast<uint16_t>(*attributes.fontWeight);
+  }
+  if (attributes.fontStyle == FontStyle::Italic) {
+    style.flags |= CompactTextStyle::Italic;
+  }
+  if (!attributes.allowFontScaling.value_or(true)) {
+    style.flags &= ~CompactTextStyle::AllowFontScaling;
+  }
+  style.textDecoration = decorationOf(attributes.textDecorationLineType);
+  return style;
+}
+
+CompactTextLayout::CompactTextLayout(const AttributedString& attributedString, const LinkTable& links) {
+  PipelinePhaseScope phase(PipelinePhase::Serialize);
+  const auto& fragments = attributedString.getFragments();
+  strings_.reserve(1 + links.urls().size());
+  strings_.emplace_back();
+
+  // Link URLs keep their interned order, so link index = 1 + urlId
+  for (const auto& url : links.urls()) {
+    strings_.push_back(url);
+  }
+
+  // Looked up by the record bytes, so fragments sharing a style don't
+  // allocate a key
+  std::unordered_map<std::string, int32_t> familyIds;
+  std::unordered_map<std::string, uint32_t, StyleKeyHash, std::equal_to<>> styleIds;
+  std::vector<uint8_t> styleKey;
+  styleKey.reserve(kStyleRecordSize);
+
+  size_t textBytes = 0;
+  for (const auto& fragment : fragments) {
+    textBytes += fragment.string.size();
+  }
+  std::string text;
+  text.reserve(textBytes);
+  const auto& linkRuns = links.runs();
+  size_t linkRun = 0;
+
+  for (size_t i = 0; i < fragments.size(); ++i) {
+    const auto& fragment = fragments[i];
+    uint32_t fragmentLength = static_cast<uint32_t>(utf16Length(fragment.string));
+    if (fragmentLength == 0) {
+      continue;
+    }
+    text += fragment.string;
+
+    // Runs are sorted, so one cursor finds the link of each fragment
+    while (linkRun < linkRuns.size() && linkRuns[linkRun].endFragment() <= i) {
+      linkRun++;
+    }
+    int32_t link = -1;
+    if (linkRun < linkRuns.size() && linkRuns[linkRun].firstFragment <= i) {
+      link = static_cast<int32_t>(1 + linkRuns[linkRun].urlId);
+    }
+
+    const auto& attributes = fragment.textAttributes;
+    auto style = CompactTextStyle::fromTextAttributes(attributes);
+    if (!attributes.fontFamily.empty()) {
+      auto [it, inserted] = familyIds.try_emplace(attributes.fontFamily, static_cast<int32_t>(strings_.size()));
+      if (inserted) {
+        strings_.push_back(attributes.fontFamily);
+      }
+      style.fontFamily = it->second;
+    }
+
+    styleKey.clear();
+    Writer keyWriter(styleKey);
+    writeStyle(keyWriter, style);
+    std::string_view key(reinterpret_cast<const char*>(styleKey.data()), styleKey.size());
+    auto styleIt = styleIds.find(key);
+    if (styleIt == styleIds.end()) {
+      styleIt = styleIds.emplace(std::string(key), static_cast<uint32_t>(styles_.size())).first;
+      styles_.push_back(style);
+    }
+
+    if (!runs_.empty() && runs_.back().style == styleIt->second && runs_.back().link == link) {
+      runs_.back().length += fragmentLength;
+    } else {
+      runs_.push_back(CompactTextRun{length_, fragmentLength, styleIt->second, link});
+    }
+    length_ += fragmentLength;
+  }
+
+  strings_[0] = std::move(text);
+}
+
+std::vector<size_t> CompactTextLayout::runByteStarts() const {
+  std::vector<size_t> starts;
+  starts.reserve(runs_.size() + 1);
+  const std::string& text = strings_[0];
+  size_t byte = 0;
+  // Runs cover the text in order and without gaps
+  for (const auto& run : runs_) {
+    starts.push_back(byte);
+    for (uint32_t units = 0; units < run.length && byte < text.size();) {
+      auto lead = static_cast<unsigned char>(text[byte]);
+      size_t width = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+      units += width == 4 ? 2 : 1;
+      byte += width;
+    }
+  }
+  starts.push_back(text.size());
+  return starts;
+}
+
+TextDelta CompactTextLayout::diff(const CompactTextLayout& base) const {
+  PipelinePhaseScope phase(PipelinePhase::Serialize);
+  auto baseStarts = base.runByteStarts();
+  auto targetStarts = runByteStarts();
+
+  auto sameRun = [&](size_t baseIndex, size_t targetIndex) {
+    const auto& a = base.runs_[baseIndex];
+    const auto& b = runs_[targetIndex];
+    if (a.length != b.length || (a.link == -1) != (b.link == -1)) {
+      return false;
+    }
+    if (a.link != -1 && base.strings_[a.link] != strings_[b.link]) {
+      return false;
+    }
+    CompactTextStyle aStyle = base.styles_[a.style];
+    CompactTextStyle bStyle = styles_[b.style];
+    if ((aStyle.fontFamily == -1) != (bStyle.fontFamily == -1) ||
+        (aStyle.fontFamily != -1 && base.strings_[aStyle.fontFamily] != strings_[bStyle.fontFamily])) {
+      return false;
+    }
+    aStyle.fontFamily = bStyle.fontFamily;
+    if (!(aStyle == bStyle)) {
+      return false;
+    }
+    std::string_view aText(base.strings_[0]);
+    std::string_view bText(strings_[0]);
+    return aText.substr(baseStarts[baseIndex], baseStarts[baseIndex + 1] - baseStarts[baseIndex]) ==
+        bText.substr(targetStarts[targetIndex], targetStarts[targetIndex + 1] - targetStarts[targetIndex]);
+  };
+
+  size_t common = std::min(base.runs_.size(), runs_.size());
+  size_t prefix = 0;
+  while (prefix < common && sameRun(prefix, prefix)) {
+    prefix++;
+  }
+  size_t suffix = 0;
+  while (suffix < common - prefix && sameRun(base.runs_.size() - 1 - suffix, runs_.size() - 1 - suffix)) {
+    suffix++;
+  }
+
+  TextDelta delta;
+  delta.first = prefix;
+  delta.removed = base.runs_.size() - prefix - suffix;
+  delta.inserted = runs_.size() - prefix - suffix;
+
+  // Runs cover the text without gaps, so run offsets give the ranges
+  auto rangeStart = [](const CompactTextLayout& layout, size_t run) {
+    return run < layout.runs_.size() ? layout.runs_[run].start : layout.length_;
+  };
+  delta.utf16Start = rangeStart(base, prefix);
+  delta.utf16Removed = rangeStart(base, prefix + delta.removed) - delta.utf16Start;
+  delta.utf16Inserted = rangeStart(*this, prefix + delta.inserted) - rangeStart(*this, prefix);
+  return delta;
+}
+
+CompactTextLayout CompactTextLayout::slice(size_t firstRun, size_t runCount) const {
+  PipelinePhaseScope phase(PipelinePhase::Serialize);
+  CompactTextLayout layout;
+  runCount = std::min(runCount, runs_.size() - std::min(firstRun, runs_.size()));
+  if (runCount == 0) {
+    layout.strings_.emplace_back();
+    return layout;
+  }
+
+  auto starts = runByteStarts();
+  layout.strings_.push_back(strings_[0].substr(starts[firstRun], starts[firstRun + runCount] - starts[firstRun]));
+
+  std::unordered_map<int32_t, int32_t> stringIds;
+  std::unordered_map<uint32_t, uint32_t> styleIds;
+  auto mapString = [&](int32_t index) {
+    if (index == -1) {
+      return -1;
+    }
+    auto [it, inserted] = stringIds.try_emplace(index, static_cast<int32_t>(layout.strings_.size()));
+    if (inserted) {
+      layout.strings_.push_back(strings_[index]);
+    }
+    return it->second;
+  };
+
+  uint32_t offset = runs_[firstRun].start;
+  for (size_t i = firstRun; i < firstRun + runCount; ++i) {
+    auto run = runs_[i];
+    auto [styleIt, styleInserted] = styleIds.try_emplace(run.style, static_cast<uint32_t>(layout.styles_.size()));
+    if (styleInserted) {
+      auto style = styles_[run.style];
+      style.fontFamily = mapString(style.fontFamily);
+      layout.styles_.push_back(style);
+    }
+    run.style = styleIt->second;
+    run.link = mapString(run.link);
+    run.start -= offset;
+    layout.runs_.push_back(run);
+  }
+  layout.length_ = layout.runs_.back().start + layout.runs_.back().length;
+  return layout;
+}
+
+std::vector<uint8_t> CompactTextLayout::serialize() const {
+  PipelinePhaseScope phase(PipelinePhase::Serialize);
+  size_t size = kHeaderSize + 12 + styles_.size() * kStyleRecordSize + runs_.size() * kRunRecordSize;
+  for (const auto& string : strings_) {
+    size += 4 + string.size();
+  }
+
+  std::vector<uint8_t> out;
+  out.reserve(size);
+  Writer writer(out);
+
+  writer.u32(kMagic);
+  writer.u16(kVersion);
+  writer.u16(0);
+  writer.u32(length_);
+
+  writer.u32(static_cast<uint32_t>(strings_.size()));
+  for (const auto& string : strings_) {
+    writer.u32(static_cast<uint32_t>(string.size()));
+    writer.bytes(string);
+  }
+
+  writer.u32(static_cast<uint32_t>(styles_.size()));
+  for (const auto& style : styles_) {
+    writeStyle(writer, style);
+  }
+
+  writer.u32(static_cast<uint32_t>(runs_.size()));
+  for (const auto& run : runs_) {
+    writer.u32(run.start);
+    writer.u32(run.length);
+    writer.u32(run.style);
+    writer.i32(run.link);
+  }
+
+  return out;
+}
+
+std::optional<CompactTextLayout> CompactTextLayout::deserialize(const uint8_t* data, size_t size) {
+  Reader reader(data, size);
+  if (!reader.has(kHeaderSize) || reader.u32() != kMagic || reader.u16() != kVersion) {
+    return std::nullopt;
+  }
+  reader.u16();
+
+  CompactTextLayout layout;
+  layout.length_ = reader.u32();
+
+  if (!reader.has(4)) {
+    return std::nullopt;
+  }
+  uint32_t stringCount = reader.u32();
+  for (uint32_t i = 0; i < stringCount; ++i) {
+    if (!reader.has(4)) {
+      return std::nullopt;
+    }
+    uint32_t byteLength = reader.u32();
+    if (!reader.has(byteLength)) {
+      return std::nullopt;
+    }
+    layout.strings_.push_back(reader.bytes(byteLength));
+  }
+  if (layout.strings_.empty()) {
+    return std::nullopt;
+  }
+  auto isString = [&](int32_t index) {
+    return index == -1 || (index > 0 && static_cast<size_t>(index) < layout.strings_.size());
+  };
+
+  if (!reader.has(4)) {
+    return std::nullopt;
+  }
+  uint32_t styleCount = reader.u32();
+  if (!reader.has(static_cast<size_t>(styleCount) * kStyleRecordSize)) {
+    return std::nullopt;
+  }
+  layout.styles_.resize(styleCount);
+  for (auto& style : layout.styles_) {
+    style.fontSize = reader.f32();
+    style.lineHeight = reader.f32();
+    style.letterSpacing = reader.f32();
+    style.foregroundColor = reader.i32();
+    style.backgroundColor = reader.i32();
+    style.fontWeight = reader.u16();
+    style.flags = reader.u8();
+    style.textDecoration = reader.u8();
+    style.fontFamily = reader.i32();
+    if (!isString(style.fontFamily)) {
+      return std::nullopt;
+    }
+  }
+
+  if (!reader.has(4)) {
+    return std::nullopt;
+  }
+  uint32_t runCount = reader.u32();
+  if (!reader.has(static_cast<size_t>(runCount) * kRunRecordSize)) {
+    return std::nullopt;
+  }
+  layout.runs_.resize(runCount);
+  for (auto& run : layout.runs_) {
+    run.start = reader.u32();
+    run.length = reader.u32();
+    run.style = reader.u32();
+    run.link = reader.i32();
+    if (run.style >= styleCount || !isString(run.link) ||
+        static_cast<uint64_t>(run.start) + run.length > layout.length_) {
+      return std::nullopt;
+    }
+  }
+
+  if (!reader.atEnd()) {
+    return std::nullopt;
+  }
+  return layout;
+}
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,162 @@
+/**
+ * CompactTextLayout.h
+ *
+ * Flat, versioned encoding of a parse result for crossing into Kotlin as one
+ * byte buffer: a string table, a deduplicated style table and packed runs.
+ * Replaces the nested MapBuffer per fragment that RN's AttributedString
+ * serialization produces.
+ *
+ * Wire format v1, little-endian:
+ *
+ *   header   u32 magic 'FRTL'  u16 version  u16 reserved  u32 utf16Length
+ *   strings  u32 count, then per string: u32 byteLength, UTF-8 bytes
+ *            (string 0 is the full text)
+ *   styles   u32 count, then 28-byte records:
+ *            f32 fontSize  f32 lineHeight  f32 letterSpacing
+ *            i32 foregroundColor  i32 backgroundColor (ARGB)
+ *            u16 fontWeight (0 = unset)  u8 flags  u8 textDecoration
+ *            i32 fontFamily (string index, -1 = none)
+ *   runs     u32 count, then 16-byte records:
+ *            u32 start  u32 length (UTF-16 code units of string 0)
+ *            u32 style  i32 link (string index, -1 = none)
+ */
+
+#pragma once
+
+#include "LinkTable.h"
+#include "TextDelta.h"
+
+#include <react/renderer/attributedstring/AttributedString.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace facebook::react::parsing {
+
+/**
+ * One entry of the style table. Unset floats are stored as 0 and
+ * flagged, so records compare and deduplicate bytewise.
+ */
+struct CompactTextStyle {
+  enum Flags : uint8_t {
+    HasForegroundColor = 1 << 0,
+    HasBackgroundColor = 1 << 1,
+    Italic = 1 << 2,
+    AllowFontScaling = 1 << 3,
+    HasFontSize = 1 << 4,
+  };
+
+  enum Decoration : uint8_t {
+    DecorationNone = 0,
+    DecorationUnderline = 1,
+    DecorationStrikethrough = 2,
+    DecorationUnderlineStrikethrough = 3,
+  };
+
+  float fontSize = 0;
+  float lineHeight = 0;
+  float letterSpacing = 0;
+  int32_t foregroundColor = 0;
+  int32_t backgroundColor = 0;
+  uint16_t fontWeight = 0;
+  uint8_t flags = AllowFontScaling;
+  uint8_t textDecoration = DecorationNone;
+  int32_t fontFamily = -1;
+
+  /**
+   * Style record of text attributes. fontFamily is left at -1: its string
+   * index depends on the layout the record is added to.
+   */
+  static CompactTextStyle fromTextAttributes(const TextAttributes& attributes);
+
+  bool operator==(const CompactTextStyle& other) const = default;
+};
+
+/**
+ * Text of string 0 in [start, start + length) drawn with styles()[style],
+ * linking to strings()[link] unless link is -1.
+ */
+struct CompactTextRun {
+  uint32_t start = 0;
+  uint32_t length = 0;
+  uint32_t style = 0;
+  int32_t link = -1;
+
+  bool operator==(const CompactTextRun& other) const = default;
+};
+
+class CompactTextLayout {
+ public:
+  static constexpr uint32_t kMagic = 0x4C545246; // "FRTL" in little-endian
+  static constexpr uint16_t kVersion = 1;
+  static constexpr size_t kStyleRecordSize = 28;
+  static constexpr size_t kRunRecordSize = 16;
+
+  CompactTextLayout() = default;
+
+  /**
+   * Adjacent fragments with the same style and link become one run.
+   */
+  CompactTextLayout(const AttributedString& attributedString, const LinkTable& links);
+
+  /**
+   * String 0 is the full text; link URLs and font families follow.
+   */
+  const std::vector<std::string>& strings() const {
+    return strings_;
+  }
+
+  const std::vector<CompactTextStyle>& styles() const {
+    return styles_;
+  }
+
+  const std::vector<CompactTextRun>& runs() const {
+    return runs_;
+  }
+
+  /**
+   * Length of the full text in UTF-16 code units.
+   */
+  uint32_t length() const {
+    return length_;
+  }
+
+  /**
+   * Run delta from base to this layout: the longest common prefix and
+   * suffix of runs with the same text, style and link are kept. The
+   * replaced range starts and ends on run boundaries of both layouts, so a
+   * renderer that styles per run can splice in slice(first, inserted).
+   * baseHash is left for the caller to fill in.
+   */
+  TextDelta diff(const CompactTextLayout& base) const;
+
+  /**
+   * Layout of runs [firstRun, firstRun + runCount) alone: offsets count
+   * from the first run, and only the styles and strings it uses are kept.
+   */
+  CompactTextLayout slice(size_t firstRun, size_t runCount) const;
+
+  std::vector<uint8_t> serialize() const;
+
+  /**
+   * Inverse of serialize(). Returns nullopt for another version or a
+   * buffer whose tables or runs are out of bounds.
+   */
+  static std::optional<CompactTextLayout> deserialize(const uint8_t* data, size_t size);
+
+  bool operator==(const CompactTextLayout& other) const = default;
+
+ private:
+  // UTF-8 offset of each run in strings()[0], followed by its size
+  std::vector<size_t> runByteStarts() const;
+
+  std::vector<std::string> strings_;
+  std::vector<CompactTextStyle> styles_;
+  std::vector<CompactTextRun> runs_;
+  uint32_t length_ = 0;
+};
+
+} // namespace facebook::react::parsing
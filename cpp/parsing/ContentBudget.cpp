@@ -0,0 +1,73 @@
+/**
+ * ContentBudget.cpp
+ *
+ * Line budgets for numberOfLines previews.
+ */
+
+#include "ContentBudget.h"
+
+#include <algorithm>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+// Narrowest ASCII glyph advance assumed, in ems ('i', 'l' and '\'' are
+// around 0.2em in common fonts)
+constexpr double kMinAdvanceEm = 0.1;
+
+// Lines parsed past numberOfLines: twice the visible lines, plus a few
+constexpr int kMarginLines = 4;
+
+} // namespace
+
+ContentBudget ContentBudget::forLines(int numberOfLines, float width) {
+  ContentBudget budget;
+  if (numberOfLines > 0) {
+    budget.lines = numberOfLines * 2 + kMarginLines;
+    budget.width = (std::isnan(width) || width <= 0) ? INFINITY : width;
+  }
+  return budget;
+}
+
+bool ContentBudget::covers(const ContentBudget& other) const {
+  if (isUnlimited()) {
+    return true;
+  }
+  // A wider view fits more text per line
+  return !other.isUnlimited() && lines >= other.lines && width >= other.width;
+}
+
+ContentBudgetMeter::ContentBudgetMeter(
+    const ContentBudget& budget,
+    const StyleOptions& options,
+    const FragmentBuildContext& context)
+    : budget_(budget), options_(options), context_(context) {}
+
+void ContentBudgetMeter::add(const FabricRichTextSegment& segment) {
+  if (exhausted_ || budget_.isUnlimited() || !buildSegmentText(segment, false, text_)) {
+    return;
+  }
+
+  size_t graphic = 0;
+  for (char c : text_) {
+    if (c == '\n') {
+      lineBreaks_++;
+    } else if (c > ' ' && c < 0x7F) {
+      graphic++;
+    }
+  }
+
+  // Negative letter spacing narrows every glyph
+  double glyphAdvance = segmentFontSize(segment, options_, context_) * kMinAdvanceEm;
+  if (!std::isnan(options_.letterSpacing)) {
+    glyphAdvance += options_.letterSpacing;
+  }
+  advance_ += graphic * std::max(glyphAdvance, 0.0);
+
+  double wrappedLines = std::isinf(budget_.width) ? 0 : advance_ / budget_.width;
+  double lines = std::max(static_cast<double>(lineBreaks_ + 1), wrappedLines);
+  exhausted_ = lines > budget_.lines;
+}
+
+} // namespace facebook::react::parsing
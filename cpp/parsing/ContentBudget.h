@@ -0,0 +1,80 @@
+/**
+ * ContentBudget.h
+ *
+ * How much text a view limited to numberOfLines can show, so previews of
+ * long documents only parse a prefix of them.
+ */
+
+#pragma once
+
+#include "AttributedStringBuilder.h"
+#include "MarkupSegmentParser.h"
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+namespace facebook::react::parsing {
+
+/**
+ * Lines of content to parse at least, and the width they wrap at. The
+ * budget is exhausted once the parsed text is certain to fill more lines
+ * than that, whatever the font; parsing can stop there without changing
+ * what a view showing numberOfLines lines draws, ellipsis included.
+ */
+struct ContentBudget {
+  // Lines to fill, 0 = unlimited
+  int lines = 0;
+  // Wrapping width in points, infinite if unconstrained
+  float width = INFINITY;
+
+  /**
+   * Budget for a view limited to numberOfLines (0 = unlimited) at width,
+   * with a safety margin of extra lines.
+   */
+  static ContentBudget forLines(int numberOfLines, float width);
+
+  bool isUnlimited() const {
+    return lines <= 0;
+  }
+
+  /**
+   * Whether text parsed within this budget also satisfies other.
+   */
+  bool covers(const ContentBudget& other) const;
+
+  bool operator==(const ContentBudget& other) const = default;
+};
+
+/**
+ * Lower bound on the lines segments fill, accumulated segment by segment.
+ *
+ * Line breaks each start a line; wrapped lines are bounded from the
+ * advance of ASCII graphic characters only, at a fraction of an em no
+ * common font goes below. Other characters (spaces, marks, scripts whose
+ * width is unknown) count as zero width, so the bound never overestimates.
+ */
+class ContentBudgetMeter {
+ public:
+  ContentBudgetMeter(const ContentBudget& budget, const StyleOptions& options, const FragmentBuildContext& context);
+
+  void add(const FabricRichTextSegment& segment);
+
+  /**
+   * Whether the segments added so far fill more lines than the budget.
+   */
+  bool exhausted() const {
+    return exhausted_;
+  }
+
+ private:
+  ContentBudget budget_;
+  const StyleOptions& options_;
+  const FragmentBuildContext& context_;
+  std::string text_;
+  size_t lineBreaks_ = 0;
+  double advance_ = 0;
+  bool exhausted_ = false;
+};
+
+} // namespace facebook::react::parsing
@@ -60,6 +60,8 @@ struct DirectionContext {
    * Check if currently inside a bdo override scope.
    */
   bool isOverride() const { return overrideDepth > 0; }
+
+  bool operator==(const DirectionContext& other) const = default;
 };
 
 } // namespace facebook::react::parsing
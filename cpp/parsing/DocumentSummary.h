@@ -0,0 +1,60 @@
+/**
+ * DocumentSummary.h
+ *
+ * What a parsed document contains, collected while its fragments are
+ * built (see summarizeFragment()), so renderers can skip the link, bidi and accessibility passes a
+ * document does not need, and apps can pick a cheaper path for huge ones.
+ */
+
+#pragma once
+
+#include "ParseLimits.h"
+
+#include <cstdint>
+
+namespace facebook::react::parsing {
+
+/**
+ * A feature of a document, as a bit of DocumentFeatures.
+ */
+enum class DocumentFeature : uint8_t {
+  Links = 1 << 0,      // Has <a href> links
+  Bidi = 1 << 1,       // Has RTL text, dir="rtl", <bdi>/<bdo> or bidi control characters
+  Lists = 1 << 2,      // Has list items (the accessibility label pauses between them)
+  Truncated = 1 << 3,  // Parsing stopped at a ContentBudget; the text is a prefix
+  Degraded = 1 << 4,   // A ParseLimit was hit (see ParseLimits.h)
+};
+
+/**
+ * Set of DocumentFeature bits.
+ */
+using DocumentFeatures = uint8_t;
+
+struct DocumentSummary {
+  DocumentFeatures features = 0;
+  uint8_t maxHeadingLevel = 0;  // Deepest <hN> with text, 0 without headings
+  uint32_t linkCount = 0;       // Link runs (see LinkTable::runs())
+  uint32_t fragmentCount = 0;
+  uint32_t textBytes = 0;       // UTF-8 bytes of text over all fragments
+
+  bool has(DocumentFeature feature) const {
+    return (features & static_cast<DocumentFeatures>(feature)) != 0;
+  }
+
+  void set(DocumentFeature feature) {
+    features |= static_cast<DocumentFeatures>(feature);
+  }
+
+  /**
+   * Mark the document Degraded if the parse hit any limit.
+   */
+  void addLimitsHit(ParseLimitsHit limitsHit) {
+    if (limitsHit != 0) {
+      set(DocumentFeature::Degraded);
+    }
+  }
+
+  bool operator==(const DocumentSummary& other) const = default;
+};
+
+} // namespace facebook::react::parsing
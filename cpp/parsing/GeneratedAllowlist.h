@@ -0,0 +1,63 @@
+// DO NOT EDIT - Generated by scripts/codegen-allowlist.js
+// Source of truth: src/core/constants.ts
+// Run: yarn codegen:allowlist
+
+#pragma once
+
+#include <array>
+#include <string_view>
+
+namespace facebook::react::parsing {
+
+// Tags kept by the sanitizer (ALLOWED_TAGS)
+inline constexpr std::array<std::string_view, 25> kAllowedTags = {
+    "p",
+    "div",
+    "h1",
+    "h2",
+    "h3",
+    "h4",
+    "h5",
+    "h6",
+    "strong",
+    "b",
+    "em",
+    "i",
+    "u",
+    "s",
+    "del",
+    "span",
+    "br",
+    "a",
+    "bdi",
+    "bdo",
+    "blockquote",
+    "pre",
+    "ul",
+    "ol",
+    "li",
+};
+
+// Attributes read from allowed tags (ALLOWED_ATTRIBUTES)
+inline constexpr std::array<std::string_view, 3> kAllowedAttributes = {
+    "href",
+    "class",
+    "dir",
+};
+
+// URL schemes allowed in href (ALLOWED_PROTOCOLS)
+inline constexpr std::array<std::string_view, 4> kAllowedProtocols = {
+    "http",
+    "https",
+    "mailto",
+    "tel",
+};
+
+// Values allowed for the dir attribute (ALLOWED_DIR_VALUES)
+inline constexpr std::array<std::string_view, 3> kAllowedDirValues = {
+    "ltr",
+    "rtl",
+    "auto",
+};
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,2051 @@
+// DO NOT EDIT - Generated by scripts/codegen-entities.js
+// Source of truth: scripts/data/html-entities.json (WHATWG named character references)
+// Run: yarn codegen:entities
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace facebook::react::parsing {
+
+// One trie node per entity name prefix. Children of a node are stored
+// contiguously from firstChild, sorted by label. value is a 1-based index
+// into kEntityValues for names ending at this node, 0 otherwise.
+struct EntityTrieNode {
+  char label;
+  uint8_t childCount;
+  uint16_t firstChild;
+  uint16_t value;
+};
+
+// Longest entity name, excluding the leading '&' (2231 names)
+inline constexpr size_t kMaxEntityNameLength = 32;
+
+// Most children of any node (52)
+inline constexpr size_t kMaxEntityTrieChildren = 52;
+
+// Code points of each entity; the second is 0 for single code point entities
+inline constexpr char32_t kEntityValues[2231][2] = {
+    {0xC6, 0x0}, {0xC6, 0x0}, {0x26, 0x0}, {0x26, 0x0}, {0xC1, 0x0}, {0xC1, 0x0},
+    {0x102, 0x0}, {0xC2, 0x0}, {0xC2, 0x0}, {0x410, 0x0}, {0x1D504, 0x0}, {0xC0, 0x0},
+    {0xC0, 0x0}, {0x391, 0x0}, {0x100, 0x0}, {0x2A53, 0x0}, {0x104, 0x0}, {0x1D538, 0x0},
+    {0x2061, 0x0}, {0xC5, 0x0}, {0xC5, 0x0}, {0x1D49C, 0x0}, {0x2254, 0x0}, {0xC3, 0x0},
+    {0xC3, 0x0}, {0xC4, 0x0}, {0xC4, 0x0}, {0x2216, 0x0}, {0x2AE7, 0x0}, {0x2306, 0x0},
+    {0x411, 0x0}, {0x2235, 0x0}, {0x212C, 0x0}, {0x392, 0x0}, {0x1D505, 0x0}, {0x1D539, 0x0},
+    {0x2D8, 0x0}, {0x212C, 0x0}, {0x224E, 0x0}, {0x427, 0x0}, {0xA9, 0x0}, {0xA9, 0x0},
+    {0x106, 0x0}, {0x22D2, 0x0}, {0x2145, 0x0}, {0x212D, 0x0}, {0x10C, 0x0}, {0xC7, 0x0},
+    {0xC7, 0x0}, {0x108, 0x0}, {0x2230, 0x0}, {0x10A, 0x0}, {0xB8, 0x0}, {0xB7, 0x0},
+    {0x212D, 0x0}, {0x3A7, 0x0}, {0x2299, 0x0}, {0x2296, 0x0}, {0x2295, 0x0}, {0x2297, 0x0},
+    {0x2232, 0x0}, {0x201D, 0x0}, {0x2019, 0x0}, {0x2237, 0x0}, {0x2A74, 0x0}, {0x2261, 0x0},
+    {0x222F, 0x0}, {0x222E, 0x0}, {0x2102, 0x0}, {0x2210, 0x0}, {0x2233, 0x0}, {0x2A2F, 0x0},
+    {0x1D49E, 0x0}, {0x22D3, 0x0}, {0x224D, 0x0}, {0x2145, 0x0}, {0x2911, 0x0}, {0x402, 0x0},
+    {0x405, 0x0}, {0x40F, 0x0}, {0x2021, 0x0}, {0x21A1, 0x0}, {0x2AE4, 0x0}, {0x10E, 0x0},
+    {0x414, 0x0}, {0x2207, 0x0}, {0x394, 0x0}, {0x1D507, 0x0}, {0xB4, 0x0}, {0x2D9, 0x0},
+    {0x2DD, 0x0}, {0x60, 0x0}, {0x2DC, 0x0}, {0x22C4, 0x0}, {0x2146, 0x0}, {0x1D53B, 0x0},
+    {0xA8, 0x0}, {0x20DC, 0x0}, {0x2250, 0x0}, {0x222F, 0x0}, {0xA8, 0x0}, {0x21D3, 0x0},
+    {0x21D0, 0x0}, {0x21D4, 0x0}, {0x2AE4, 0x0}, {0x27F8, 0x0}, {0x27FA, 0x0}, {0x27F9, 0x0},
+    {0x21D2, 0x0}, {0x22A8, 0x0}, {0x21D1, 0x0}, {0x21D5, 0x0}, {0x2225, 0x0}, {0x2193, 0x0},
+    {0x2913, 0x0}, {0x21F5, 0x0}, {0x311, 0x0}, {0x2950, 0x0}, {0x295E, 0x0}, {0x21BD, 0x0},
+    {0x2956, 0x0}, {0x295F, 0x0}, {0x21C1, 0x0}, {0x2957, 0x0}, {0x22A4, 0x0}, {0x21A7, 0x0},
+    {0x21D3, 0x0}, {0x1D49F, 0x0}, {0x110, 0x0}, {0x14A, 0x0}, {0xD0, 0x0}, {0xD0, 0x0},
+    {0xC9, 0x0}, {0xC9, 0x0}, {0x11A, 0x0}, {0xCA, 0x0}, {0xCA, 0x0}, {0x42D, 0x0},
+    {0x116, 0x0}, {0x1D508, 0x0}, {0xC8, 0x0}, {0xC8, 0x0}, {0x2208, 0x0}, {0x112, 0x0},
+    {0x25FB, 0x0}, {0x25AB, 0x0}, {0x118, 0x0}, {0x1D53C, 0x0}, {0x395, 0x0}, {0x2A75, 0x0},
+    {0x2242, 0x0}, {0x21CC, 0x0}, {0x2130, 0x0}, {0x2A73, 0x0}, {0x397, 0x0}, {0xCB, 0x0},
+    {0xCB, 0x0}, {0x2203, 0x0}, {0x2147, 0x0}, {0x424, 0x0}, {0x1D509, 0x0}, {0x25FC, 0x0},
+    {0x25AA, 0x0}, {0x1D53D, 0x0}, {0x2200, 0x0}, {0x2131, 0x0}, {0x2131, 0x0}, {0x403, 0x0},
+    {0x3E, 0x0}, {0x3E, 0x0}, {0x393, 0x0}, {0x3DC, 0x0}, {0x11E, 0x0}, {0x122, 0x0},
+    {0x11C, 0x0}, {0x413, 0x0}, {0x120, 0x0}, {0x1D50A, 0x0}, {0x22D9, 0x0}, {0x1D53E, 0x0},
+    {0x2265, 0x0}, {0x22DB, 0x0}, {0x2267, 0x0}, {0x2AA2, 0x0}, {0x2277, 0x0}, {0x2A7E, 0x0},
+    {0x2273, 0x0}, {0x1D4A2, 0x0}, {0x226B, 0x0}, {0x42A, 0x0}, {0x2C7, 0x0}, {0x5E, 0x0},
+    {0x124, 0x0}, {0x210C, 0x0}, {0x210B, 0x0}, {0x210D, 0x0}, {0x2500, 0x0}, {0x210B, 0x0},
+    {0x126, 0x0}, {0x224E, 0x0}, {0x224F, 0x0}, {0x415, 0x0}, {0x132, 0x0}, {0x401, 0x0},
+    {0xCD, 0x0}, {0xCD, 0x0}, {0xCE, 0x0}, {0xCE, 0x0}, {0x418, 0x0}, {0x130, 0x0},
+    {0x2111, 0x0}, {0xCC, 0x0}, {0xCC, 0x0}, {0x2111, 0x0}, {0x12A, 0x0}, {0x2148, 0x0},
+    {0x21D2, 0x0}, {0x222C, 0x0}, {0x222B, 0x0}, {0x22C2, 0x0}, {0x2063, 0x0}, {0x2062, 0x0},
+    {0x12E, 0x0}, {0x1D540, 0x0}, {0x399, 0x0}, {0x2110, 0x0}, {0x128, 0x0}, {0x406, 0x0},
+    {0xCF, 0x0}, {0xCF, 0x0}, {0x134, 0x0}, {0x419, 0x0}, {0x1D50D, 0x0}, {0x1D541, 0x0},
+    {0x1D4A5, 0x0}, {0x408, 0x0}, {0x404, 0x0}, {0x425, 0x0}, {0x40C, 0x0}, {0x39A, 0x0},
+    {0x136, 0x0}, {0x41A, 0x0}, {0x1D50E, 0x0}, {0x1D542, 0x0}, {0x1D4A6, 0x0}, {0x409, 0x0},
+    {0x3C, 0x0}, {0x3C, 0x0}, {0x139, 0x0}, {0x39B, 0x0}, {0x27EA, 0x0}, {0x2112, 0x0},
+    {0x219E, 0x0}, {0x13D, 0x0}, {0x13B, 0x0}, {0x41B, 0x0}, {0x27E8, 0x0}, {0x2190, 0x0},
+    {0x21E4, 0x0}, {0x21C6, 0x0}, {0x2308, 0x0}, {0x27E6, 0x0}, {0x2961, 0x0}, {0x21C3, 0x0},
+    {0x2959, 0x0}, {0x230A, 0x0}, {0x2194, 0x0}, {0x294E, 0x0}, {0x22A3, 0x0}, {0x21A4, 0x0},
+    {0x295A, 0x0}, {0x22B2, 0x0}, {0x29CF, 0x0}, {0x22B4, 0x0}, {0x2951, 0x0}, {0x2960, 0x0},
+    {0x21BF, 0x0}, {0x2958, 0x0}, {0x21BC, 0x0}, {0x2952, 0x0}, {0x21D0, 0x0}, {0x21D4, 0x0},
+    {0x22DA, 0x0}, {0x2266, 0x0}, {0x2276, 0x0}, {0x2AA1, 0x0}, {0x2A7D, 0x0}, {0x2272, 0x0},
+    {0x1D50F, 0x0}, {0x22D8, 0x0}, {0x21DA, 0x0}, {0x13F, 0x0}, {0x27F5, 0x0}, {0x27F7, 0x0},
+    {0x27F6, 0x0}, {0x27F8, 0x0}, {0x27FA, 0x0}, {0x27F9, 0x0}, {0x1D543, 0x0}, {0x2199, 0x0},
+    {0x2198, 0x0}, {0x2112, 0x0}, {0x21B0, 0x0}, {0x141, 0x0}, {0x226A, 0x0}, {0x2905, 0x0},
+    {0x41C, 0x0}, {0x205F, 0x0}, {0x2133, 0x0}, {0x1D510, 0x0}, {0x2213, 0x0}, {0x1D544, 0x0},
+    {0x2133, 0x0}, {0x39C, 0x0}, {0x40A, 0x0}, {0x143, 0x0}, {0x147, 0x0}, {0x145, 0x0},
+    {0x41D, 0x0}, {0x200B, 0x0}, {0x200B, 0x0}, {0x200B, 0x0}, {0x200B, 0x0}, {0x226B, 0x0},
+    {0x226A, 0x0}, {0xA, 0x0}, {0x1D511, 0x0}, {0x2060, 0x0}, {0xA0, 0x0}, {0x2115, 0x0},
+    {0x2AEC, 0x0}, {0x2262, 0x0}, {0x226D, 0x0}, {0x2226, 0x0}, {0x2209, 0x0}, {0x2260, 0x0},
+    {0x2242, 0x338}, {0x2204, 0x0}, {0x226F, 0x0}, {0x2271, 0x0}, {0x2267, 0x338}, {0x226B, 0x338},
+    {0x2279, 0x0}, {0x2A7E, 0x338}, {0x2275, 0x0}, {0x224E, 0x338}, {0x224F, 0x338}, {0x22EA, 0x0},
+    {0x29CF, 0x338}, {0x22EC, 0x0}, {0x226E, 0x0}, {0x2270, 0x0}, {0x2278, 0x0}, {0x226A, 0x338},
+    {0x2A7D, 0x338}, {0x2274, 0x0}, {0x2AA2, 0x338}, {0x2AA1, 0x338}, {0x2280, 0x0}, {0x2AAF, 0x338},
+    {0x22E0, 0x0}, {0x220C, 0x0}, {0x22EB, 0x0}, {0x29D0, 0x338}, {0x22ED, 0x0}, {0x228F, 0x338},
+    {0x22E2, 0x0}, {0x2290, 0x338}, {0x22E3, 0x0}, {0x2282, 0x20D2}, {0x2288, 0x0}, {0x2281, 0x0},
+    {0x2AB0, 0x338}, {0x22E1, 0x0}, {0x227F, 0x338}, {0x2283, 0x20D2}, {0x2289, 0x0}, {0x2241, 0x0},
+    {0x2244, 0x0}, {0x2247, 0x0}, {0x2249, 0x0}, {0x2224, 0x0}, {0x1D4A9, 0x0}, {0xD1, 0x0},
+    {0xD1, 0x0}, {0x39D, 0x0}, {0x152, 0x0}, {0xD3, 0x0}, {0xD3, 0x0}, {0xD4, 0x0},
+    {0xD4, 0x0}, {0x41E, 0x0}, {0x150, 0x0}, {0x1D512, 0x0}, {0xD2, 0x0}, {0xD2, 0x0},
+    {0x14C, 0x0}, {0x3A9, 0x0}, {0x39F, 0x0}, {0x1D546, 0x0}, {0x201C, 0x0}, {0x2018, 0x0},
+    {0x2A54, 0x0}, {0x1D4AA, 0x0}, {0xD8, 0x0}, {0xD8, 0x0}, {0xD5, 0x0}, {0xD5, 0x0},
+    {0x2A37, 0x0}, {0xD6, 0x0}, {0xD6, 0x0}, {0x203E, 0x0}, {0x23DE, 0x0}, {0x23B4, 0x0},
+    {0x23DC, 0x0}, {0x2202, 0x0}, {0x41F, 0x0}, {0x1D513, 0x0}, {0x3A6, 0x0}, {0x3A0, 0x0},
+    {0xB1, 0x0}, {0x210C, 0x0}, {0x2119, 0x0}, {0x2ABB, 0x0}, {0x227A, 0x0}, {0x2AAF, 0x0},
+    {0x227C, 0x0}, {0x227E, 0x0}, {0x2033, 0x0}, {0x220F, 0x0}, {0x2237, 0x0}, {0x221D, 0x0},
+    {0x1D4AB, 0x0}, {0x3A8, 0x0}, {0x22, 0x0}, {0x22, 0x0}, {0x1D514, 0x0}, {0x211A, 0x0},
+    {0x1D4AC, 0x0}, {0x2910, 0x0}, {0xAE, 0x0}, {0xAE, 0x0}, {0x154, 0x0}, {0x27EB, 0x0},
+    {0x21A0, 0x0}, {0x2916, 0x0}, {0x158, 0x0}, {0x156, 0x0}, {0x420, 0x0}, {0x211C, 0x0},
+    {0x220B, 0x0}, {0x21CB, 0x0}, {0x296F, 0x0}, {0x211C, 0x0}, {0x3A1, 0x0}, {0x27E9, 0x0},
+    {0x2192, 0x0}, {0x21E5, 0x0}, {0x21C4, 0x0}, {0x2309, 0x0}, {0x27E7, 0x0}, {0x295D, 0x0},
+    {0x21C2, 0x0}, {0x2955, 0x0}, {0x230B, 0x0}, {0x22A2, 0x0}, {0x21A6, 0x0}, {0x295B, 0x0},
+    {0x22B3, 0x0}, {0x29D0, 0x0}, {0x22B5, 0x0}, {0x294F, 0x0}, {0x295C, 0x0}, {0x21BE, 0x0},
+    {0x2954, 0x0}, {0x21C0, 0x0}, {0x2953, 0x0}, {0x21D2, 0x0}, {0x211D, 0x0}, {0x2970, 0x0},
+    {0x21DB, 0x0}, {0x211B, 0x0}, {0x21B1, 0x0}, {0x29F4, 0x0}, {0x429, 0x0}, {0x428, 0x0},
+    {0x42C, 0x0}, {0x15A, 0x0}, {0x2ABC, 0x0}, {0x160, 0x0}, {0x15E, 0x0}, {0x15C, 0x0},
+    {0x421, 0x0}, {0x1D516, 0x0}, {0x2193, 0x0}, {0x2190, 0x0}, {0x2192, 0x0}, {0x2191, 0x0},
+    {0x3A3, 0x0}, {0x2218, 0x0}, {0x1D54A, 0x0}, {0x221A, 0x0}, {0x25A1, 0x0}, {0x2293, 0x0},
+    {0x228F, 0x0}, {0x2291, 0x0}, {0x2290, 0x0}, {0x2292, 0x0}, {0x2294, 0x0}, {0x1D4AE, 0x0},
+    {0x22C6, 0x0}, {0x22D0, 0x0}, {0x22D0, 0x0}, {0x2286, 0x0}, {0x227B, 0x0}, {0x2AB0, 0x0},
+    {0x227D, 0x0}, {0x227F, 0x0}, {0x220B, 0x0}, {0x2211, 0x0}, {0x22D1, 0x0}, {0x2283, 0x0},
+    {0x2287, 0x0}, {0x22D1, 0x0}, {0xDE, 0x0}, {0xDE, 0x0}, {0x2122, 0x0}, {0x40B, 0x0},
+    {0x426, 0x0}, {0x9, 0x0}, {0x3A4, 0x0}, {0x164, 0x0}, {0x162, 0x0}, {0x422, 0x0},
+    {0x1D517, 0x0}, {0x2234, 0x0}, {0x398, 0x0}, {0x205F, 0x200A}, {0x2009, 0x0}, {0x223C, 0x0},
+    {0x2243, 0x0}, {0x2245, 0x0}, {0x2248, 0x0}, {0x1D54B, 0x0}, {0x20DB, 0x0}, {0x1D4AF, 0x0},
+    {0x166, 0x0}, {0xDA, 0x0}, {0xDA, 0x0}, {0x219F, 0x0}, {0x2949, 0x0}, {0x40E, 0x0},
+    {0x16C, 0x0}, {0xDB, 0x0}, {0xDB, 0x0}, {0x423, 0x0}, {0x170, 0x0}, {0x1D518, 0x0},
+    {0xD9, 0x0}, {0xD9, 0x0}, {0x16A, 0x0}, {0x5F, 0x0}, {0x23DF, 0x0}, {0x23B5, 0x0},
+    {0x23DD, 0x0}, {0x22C3, 0x0}, {0x228E, 0x0}, {0x172, 0x0}, {0x1D54C, 0x0}, {0x2191, 0x0},
+    {0x2912, 0x0}, {0x21C5, 0x0}, {0x2195, 0x0}, {0x296E, 0x0}, {0x22A5, 0x0}, {0x21A5, 0x0},
+    {0x21D1, 0x0}, {0x21D5, 0x0}, {0x2196, 0x0}, {0x2197, 0x0}, {0x3D2, 0x0}, {0x3A5, 0x0},
+    {0x16E, 0x0}, {0x1D4B0, 0x0}, {0x168, 0x0}, {0xDC, 0x0}, {0xDC, 0x0}, {0x22AB, 0x0},
+    {0x2AEB, 0x0}, {0x412, 0x0}, {0x22A9, 0x0}, {0x2AE6, 0x0}, {0x22C1, 0x0}, {0x2016, 0x0},
+    {0x2016, 0x0}, {0x2223, 0x0}, {0x7C, 0x0}, {0x2758, 0x0}, {0x2240, 0x0}, {0x200A, 0x0},
+    {0x1D519, 0x0}, {0x1D54D, 0x0}, {0x1D4B1, 0x0}, {0x22AA, 0x0}, {0x174, 0x0}, {0x22C0, 0x0},
+    {0x1D51A, 0x0}, {0x1D54E, 0x0}, {0x1D4B2, 0x0}, {0x1D51B, 0x0}, {0x39E, 0x0}, {0x1D54F, 0x0},
+    {0x1D4B3, 0x0}, {0x42F, 0x0}, {0x407, 0x0}, {0x42E, 0x0}, {0xDD, 0x0}, {0xDD, 0x0},
+    {0x176, 0x0}, {0x42B, 0x0}, {0x1D51C, 0x0}, {0x1D550, 0x0}, {0x1D4B4, 0x0}, {0x178, 0x0},
+    {0x416, 0x0}, {0x179, 0x0}, {0x17D, 0x0}, {0x417, 0x0}, {0x17B, 0x0}, {0x200B, 0x0},
+    {0x396, 0x0}, {0x2128, 0x0}, {0x2124, 0x0}, {0x1D4B5, 0x0}, {0xE1, 0x0}, {0xE1, 0x0},
+    {0x103, 0x0}, {0x223E, 0x0}, {0x223E, 0x333}, {0x223F, 0x0}, {0xE2, 0x0}, {0xE2, 0x0},
+    {0xB4, 0x0}, {0xB4, 0x0}, {0x430, 0x0}, {0xE6, 0x0}, {0xE6, 0x0}, {0x2061, 0x0},
+    {0x1D51E, 0x0}, {0xE0, 0x0}, {0xE0, 0x0}, {0x2135, 0x0}, {0x2135, 0x0}, {0x3B1, 0x0},
+    {0x101, 0x0}, {0x2A3F, 0x0}, {0x26, 0x0}, {0x26, 0x0}, {0x2227, 0x0}, {0x2A55, 0x0},
+    {0x2A5C, 0x0}, {0x2A58, 0x0}, {0x2A5A, 0x0}, {0x2220, 0x0}, {0x29A4, 0x0}, {0x2220, 0x0},
+    {0x2221, 0x0}, {0x29A8, 0x0}, {0x29A9, 0x0}, {0x29AA, 0x0}, {0x29AB, 0x0}, {0x29AC, 0x0},
+    {0x29AD, 0x0}, {0x29AE, 0x0}, {0x29AF, 0x0}, {0x221F, 0x0}, {0x22BE, 0x0}, {0x299D, 0x0},
+    {0x2222, 0x0}, {0xC5, 0x0}, {0x237C, 0x0}, {0x105, 0x0}, {0x1D552, 0x0}, {0x2248, 0x0},
+    {0x2A70, 0x0}, {0x2A6F, 0x0}, {0x224A, 0x0}, {0x224B, 0x0}, {0x27, 0x0}, {0x2248, 0x0},
+    {0x224A, 0x0}, {0xE5, 0x0}, {0xE5, 0x0}, {0x1D4B6, 0x0}, {0x2A, 0x0}, {0x2248, 0x0},
+    {0x224D, 0x0}, {0xE3, 0x0}, {0xE3, 0x0}, {0xE4, 0x0}, {0xE4, 0x0}, {0x2233, 0x0},
+    {0x2A11, 0x0}, {0x2AED, 0x0}, {0x224C, 0x0}, {0x3F6, 0x0}, {0x2035, 0x0}, {0x223D, 0x0},
+    {0x22CD, 0x0}, {0x22BD, 0x0}, {0x2305, 0x0}, {0x2305, 0x0}, {0x23B5, 0x0}, {0x23B6, 0x0},
+    {0x224C, 0x0}, {0x431, 0x0}, {0x201E, 0x0}, {0x2235, 0x0}, {0x2235, 0x0}, {0x29B0, 0x0},
+    {0x3F6, 0x0}, {0x212C, 0x0}, {0x3B2, 0x0}, {0x2136, 0x0}, {0x226C, 0x0}, {0x1D51F, 0x0},
+    {0x22C2, 0x0}, {0x25EF, 0x0}, {0x22C3, 0x0}, {0x2A00, 0x0}, {0x2A01, 0x0}, {0x2A02, 0x0},
+    {0x2A06, 0x0}, {0x2605, 0x0}, {0x25BD, 0x0}, {0x25B3, 0x0}, {0x2A04, 0x0}, {0x22C1, 0x0},
+    {0x22C0, 0x0}, {0x290D, 0x0}, {0x29EB, 0x0}, {0x25AA, 0x0}, {0x25B4, 0x0}, {0x25BE, 0x0},
+    {0x25C2, 0x0}, {0x25B8, 0x0}, {0x2423, 0x0}, {0x2592, 0x0}, {0x2591, 0x0}, {0x2593, 0x0},
+    {0x2588, 0x0}, {0x3D, 0x20E5}, {0x2261, 0x20E5}, {0x2310, 0x0}, {0x1D553, 0x0}, {0x22A5, 0x0},
+    {0x22A5, 0x0}, {0x22C8, 0x0}, {0x2557, 0x0}, {0x2554, 0x0}, {0x2556, 0x0}, {0x2553, 0x0},
+    {0x2550, 0x0}, {0x2566, 0x0}, {0x2569, 0x0}, {0x2564, 0x0}, {0x2567, 0x0}, {0x255D, 0x0},
+    {0x255A, 0x0}, {0x255C, 0x0}, {0x2559, 0x0}, {0x2551, 0x0}, {0x256C, 0x0}, {0x2563, 0x0},
+    {0x2560, 0x0}, {0x256B, 0x0}, {0x2562, 0x0}, {0x255F, 0x0}, {0x29C9, 0x0}, {0x2555, 0x0},
+    {0x2552, 0x0}, {0x2510, 0x0}, {0x250C, 0x0}, {0x2500, 0x0}, {0x2565, 0x0}, {0x2568, 0x0},
+    {0x252C, 0x0}, {0x2534, 0x0}, {0x229F, 0x0}, {0x229E, 0x0}, {0x22A0, 0x0}, {0x255B, 0x0},
+    {0x2558, 0x0}, {0x2518, 0x0}, {0x2514, 0x0}, {0x2502, 0x0}, {0x256A, 0x0}, {0x2561, 0x0},
+    {0x255E, 0x0}, {0x253C, 0x0}, {0x2524, 0x0}, {0x251C, 0x0}, {0x2035, 0x0}, {0x2D8, 0x0},
+    {0xA6, 0x0}, {0xA6, 0x0}, {0x1D4B7, 0x0}, {0x204F, 0x0}, {0x223D, 0x0}, {0x22CD, 0x0},
+    {0x5C, 0x0}, {0x29C5, 0x0}, {0x27C8, 0x0}, {0x2022, 0x0}, {0x2022, 0x0}, {0x224E, 0x0},
+    {0x2AAE, 0x0}, {0x224F, 0x0}, {0x224F, 0x0}, {0x107, 0x0}, {0x2229, 0x0}, {0x2A44, 0x0},
+    {0x2A49, 0x0}, {0x2A4B, 0x0}, {0x2A47, 0x0}, {0x2A40, 0x0}, {0x2229, 0xFE00}, {0x2041, 0x0},
+    {0x2C7, 0x0}, {0x2A4D, 0x0}, {0x10D, 0x0}, {0xE7, 0x0}, {0xE7, 0x0}, {0x109, 0x0},
+    {0x2A4C, 0x0}, {0x2A50, 0x0}, {0x10B, 0x0}, {0xB8, 0x0}, {0xB8, 0x0}, {0x29B2, 0x0},
+    {0xA2, 0x0}, {0xA2, 0x0}, {0xB7, 0x0}, {0x1D520, 0x0}, {0x447, 0x0}, {0x2713, 0x0},
+    {0x2713, 0x0}, {0x3C7, 0x0}, {0x25CB, 0x0}, {0x29C3, 0x0}, {0x2C6, 0x0}, {0x2257, 0x0},
+    {0x21BA, 0x0}, {0x21BB, 0x0}, {0xAE, 0x0}, {0x24C8, 0x0}, {0x229B, 0x0}, {0x229A, 0x0},
+    {0x229D, 0x0}, {0x2257, 0x0}, {0x2A10, 0x0}, {0x2AEF, 0x0}, {0x29C2, 0x0}, {0x2663, 0x0},
+    {0x2663, 0x0}, {0x3A, 0x0}, {0x2254, 0x0}, {0x2254, 0x0}, {0x2C, 0x0}, {0x40, 0x0},
+    {0x2201, 0x0}, {0x2218, 0x0}, {0x2201, 0x0}, {0x2102, 0x0}, {0x2245, 0x0}, {0x2A6D, 0x0},
+    {0x222E, 0x0}, {0x1D554, 0x0}, {0x2210, 0x0}, {0xA9, 0x0}, {0xA9, 0x0}, {0x2117, 0x0},
+    {0x21B5, 0x0}, {0x2717, 0x0}, {0x1D4B8, 0x0}, {0x2ACF, 0x0}, {0x2AD1, 0x0}, {0x2AD0, 0x0},
+    {0x2AD2, 0x0}, {0x22EF, 0x0}, {0x2938, 0x0}, {0x2935, 0x0}, {0x22DE, 0x0}, {0x22DF, 0x0},
+    {0x21B6, 0x0}, {0x293D, 0x0}, {0x222A, 0x0}, {0x2A48, 0x0}, {0x2A46, 0x0}, {0x2A4A, 0x0},
+    {0x228D, 0x0}, {0x2A45, 0x0}, {0x222A, 0xFE00}, {0x21B7, 0x0}, {0x293C, 0x0}, {0x22DE, 0x0},
+    {0x22DF, 0x0}, {0x22CE, 0x0}, {0x22CF, 0x0}, {0xA4, 0x0}, {0xA4, 0x0}, {0x21B6, 0x0},
+    {0x21B7, 0x0}, {0x22CE, 0x0}, {0x22CF, 0x0}, {0x2232, 0x0}, {0x2231, 0x0}, {0x232D, 0x0},
+    {0x21D3, 0x0}, {0x2965, 0x0}, {0x2020, 0x0}, {0x2138, 0x0}, {0x2193, 0x0}, {0x2010, 0x0},
+    {0x22A3, 0x0}, {0x290F, 0x0}, {0x2DD, 0x0}, {0x10F, 0x0}, {0x434, 0x0}, {0x2146, 0x0},
+    {0x2021, 0x0}, {0x21CA, 0x0}, {0x2A77, 0x0}, {0xB0, 0x0}, {0xB0, 0x0}, {0x3B4, 0x0},
+    {0x29B1, 0x0}, {0x297F, 0x0}, {0x1D521, 0x0}, {0x21C3, 0x0}, {0x21C2, 0x0}, {0x22C4, 0x0},
+    {0x22C4, 0x0}, {0x2666, 0x0}, {0x2666, 0x0}, {0xA8, 0x0}, {0x3DD, 0x0}, {0x22F2, 0x0},
+    {0xF7, 0x0}, {0xF7, 0x0}, {0xF7, 0x0}, {0x22C7, 0x0}, {0x22C7, 0x0}, {0x452, 0x0},
+    {0x231E, 0x0}, {0x230D, 0x0}, {0x24, 0x0}, {0x1D555, 0x0}, {0x2D9, 0x0}, {0x2250, 0x0},
+    {0x2251, 0x0}, {0x2238, 0x0}, {0x2214, 0x0}, {0x22A1, 0x0}, {0x2306, 0x0}, {0x2193, 0x0},
+    {0x21CA, 0x0}, {0x21C3, 0x0}, {0x21C2, 0x0}, {0x2910, 0x0}, {0x231F, 0x0}, {0x230C, 0x0},
+    {0x1D4B9, 0x0}, {0x455, 0x0}, {0x29F6, 0x0}, {0x111, 0x0}, {0x22F1, 0x0}, {0x25BF, 0x0},
+    {0x25BE, 0x0}, {0x21F5, 0x0}, {0x296F, 0x0}, {0x29A6, 0x0}, {0x45F, 0x0}, {0x27FF, 0x0},
+    {0x2A77, 0x0}, {0x2251, 0x0}, {0xE9, 0x0}, {0xE9, 0x0}, {0x2A6E, 0x0}, {0x11B, 0x0},
+    {0x2256, 0x0}, {0xEA, 0x0}, {0xEA, 0x0}, {0x2255, 0x0}, {0x44D, 0x0}, {0x117, 0x0},
+    {0x2147, 0x0}, {0x2252, 0x0}, {0x1D522, 0x0}, {0x2A9A, 0x0}, {0xE8, 0x0}, {0xE8, 0x0},
+    {0x2A96, 0x0}, {0x2A98, 0x0}, {0x2A99, 0x0}, {0x23E7, 0x0}, {0x2113, 0x0}, {0x2A95, 0x0},
+    {0x2A97, 0x0}, {0x113, 0x0}, {0x2205, 0x0}, {0x2205, 0x0}, {0x2205, 0x0}, {0x2004, 0x0},
+    {0x2005, 0x0}, {0x2003, 0x0}, {0x14B, 0x0}, {0x2002, 0x0}, {0x119, 0x0}, {0x1D556, 0x0},
+    {0x22D5, 0x0}, {0x29E3, 0x0}, {0x2A71, 0x0}, {0x3B5, 0x0}, {0x3B5, 0x0}, {0x3F5, 0x0},
+    {0x2256, 0x0}, {0x2255, 0x0}, {0x2242, 0x0}, {0x2A96, 0x0}, {0x2A95, 0x0}, {0x3D, 0x0},
+    {0x225F, 0x0}, {0x2261, 0x0}, {0x2A78, 0x0}, {0x29E5, 0x0}, {0x2253, 0x0}, {0x2971, 0x0},
+    {0x212F, 0x0}, {0x2250, 0x0}, {0x2242, 0x0}, {0x3B7, 0x0}, {0xF0, 0x0}, {0xF0, 0x0},
+    {0xEB, 0x0}, {0xEB, 0x0}, {0x20AC, 0x0}, {0x21, 0x0}, {0x2203, 0x0}, {0x2130, 0x0},
+    {0x2147, 0x0}, {0x2252, 0x0}, {0x444, 0x0}, {0x2640, 0x0}, {0xFB03, 0x0}, {0xFB00, 0x0},
+    {0xFB04, 0x0}, {0x1D523, 0x0}, {0xFB01, 0x0}, {0x66, 0x6A}, {0x266D, 0x0}, {0xFB02, 0x0},
+    {0x25B1, 0x0}, {0x192, 0x0}, {0x1D557, 0x0}, {0x2200, 0x0}, {0x22D4, 0x0}, {0x2AD9, 0x0},
+    {0x2A0D, 0x0}, {0xBD, 0x0}, {0xBD, 0x0}, {0x2153, 0x0}, {0xBC, 0x0}, {0xBC, 0x0},
+    {0x2155, 0x0}, {0x2159, 0x0}, {0x215B, 0x0}, {0x2154, 0x0}, {0x2156, 0x0}, {0xBE, 0x0},
+    {0xBE, 0x0}, {0x2157, 0x0}, {0x215C, 0x0}, {0x2158, 0x0}, {0x215A, 0x0}, {0x215D, 0x0},
+    {0x215E, 0x0}, {0x2044, 0x0}, {0x2322, 0x0}, {0x1D4BB, 0x0}, {0x2267, 0x0}, {0x2A8C, 0x0},
+    {0x1F5, 0x0}, {0x3B3, 0x0}, {0x3DD, 0x0}, {0x2A86, 0x0}, {0x11F, 0x0}, {0x11D, 0x0},
+    {0x433, 0x0}, {0x121, 0x0}, {0x2265, 0x0}, {0x22DB, 0x0}, {0x2265, 0x0}, {0x2267, 0x0},
+    {0x2A7E, 0x0}, {0x2A7E, 0x0}, {0x2AA9, 0x0}, {0x2A80, 0x0}, {0x2A82, 0x0}, {0x2A84, 0x0},
+    {0x22DB, 0xFE00}, {0x2A94, 0x0}, {0x1D524, 0x0}, {0x226B, 0x0}, {0x22D9, 0x0}, {0x2137, 0x0},
+    {0x453, 0x0}, {0x2277, 0x0}, {0x2A92, 0x0}, {0x2AA5, 0x0}, {0x2AA4, 0x0}, {0x2269, 0x0},
+    {0x2A8A, 0x0}, {0x2A8A, 0x0}, {0x2A88, 0x0}, {0x2A88, 0x0}, {0x2269, 0x0}, {0x22E7, 0x0},
+    {0x1D558, 0x0}, {0x60, 0x0}, {0x210A, 0x0}, {0x2273, 0x0}, {0x2A8E, 0x0}, {0x2A90, 0x0},
+    {0x3E, 0x0}, {0x3E, 0x0}, {0x2AA7, 0x0}, {0x2A7A, 0x0}, {0x22D7, 0x0}, {0x2995, 0x0},
+    {0x2A7C, 0x0}, {0x2A86, 0x0}, {0x2978, 0x0}, {0x22D7, 0x0}, {0x22DB, 0x0}, {0x2A8C, 0x0},
+    {0x2277, 0x0}, {0x2273, 0x0}, {0x2269, 0xFE00}, {0x2269, 0xFE00}, {0x21D4, 0x0}, {0x200A, 0x0},
+    {0xBD, 0x0}, {0x210B, 0x0}, {0x44A, 0x0}, {0x2194, 0x0}, {0x2948, 0x0}, {0x21AD, 0x0},
+    {0x210F, 0x0}, {0x125, 0x0}, {0x2665, 0x0}, {0x2665, 0x0}, {0x2026, 0x0}, {0x22B9, 0x0},
+    {0x1D525, 0x0}, {0x2925, 0x0}, {0x2926, 0x0}, {0x21FF, 0x0}, {0x223B, 0x0}, {0x21A9, 0x0},
+    {0x21AA, 0x0}, {0x1D559, 0x0}, {0x2015, 0x0}, {0x1D4BD, 0x0}, {0x210F, 0x0}, {0x127, 0x0},
+    {0x2043, 0x0}, {0x2010, 0x0}, {0xED, 0x0}, {0xED, 0x0}, {0x2063, 0x0}, {0xEE, 0x0},
+    {0xEE, 0x0}, {0x438, 0x0}, {0x435, 0x0}, {0xA1, 0x0}, {0xA1, 0x0}, {0x21D4, 0x0},
+    {0x1D526, 0x0}, {0xEC, 0x0}, {0xEC, 0x0}, {0x2148, 0x0}, {0x2A0C, 0x0}, {0x222D, 0x0},
+    {0x29DC, 0x0}, {0x2129, 0x0}, {0x133, 0x0}, {0x12B, 0x0}, {0x2111, 0x0}, {0x2110, 0x0},
+    {0x2111, 0x0}, {0x131, 0x0}, {0x22B7, 0x0}, {0x1B5, 0x0}, {0x2208, 0x0}, {0x2105, 0x0},
+    {0x221E, 0x0}, {0x29DD, 0x0}, {0x131, 0x0}, {0x222B, 0x0}, {0x22BA, 0x0}, {0x2124, 0x0},
+    {0x22BA, 0x0}, {0x2A17, 0x0}, {0x2A3C, 0x0}, {0x451, 0x0}, {0x12F, 0x0}, {0x1D55A, 0x0},
+    {0x3B9, 0x0}, {0x2A3C, 0x0}, {0xBF, 0x0}, {0xBF, 0x0}, {0x1D4BE, 0x0}, {0x2208, 0x0},
+    {0x22F9, 0x0}, {0x22F5, 0x0}, {0x22F4, 0x0}, {0x22F3, 0x0}, {0x2208, 0x0}, {0x2062, 0x0},
+    {0x129, 0x0}, {0x456, 0x0}, {0xEF, 0x0}, {0xEF, 0x0}, {0x135, 0x0}, {0x439, 0x0},
+    {0x1D527, 0x0}, {0x237, 0x0}, {0x1D55B, 0x0}, {0x1D4BF, 0x0}, {0x458, 0x0}, {0x454, 0x0},
+    {0x3BA, 0x0}, {0x3F0, 0x0}, {0x137, 0x0}, {0x43A, 0x0}, {0x1D528, 0x0}, {0x138, 0x0},
+    {0x445, 0x0}, {0x45C, 0x0}, {0x1D55C, 0x0}, {0x1D4C0, 0x0}, {0x21DA, 0x0}, {0x21D0, 0x0},
+    {0x291B, 0x0}, {0x290E, 0x0}, {0x2266, 0x0}, {0x2A8B, 0x0}, {0x2962, 0x0}, {0x13A, 0x0},
+    {0x29B4, 0x0}, {0x2112, 0x0}, {0x3BB, 0x0}, {0x27E8, 0x0}, {0x2991, 0x0}, {0x27E8, 0x0},
+    {0x2A85, 0x0}, {0xAB, 0x0}, {0xAB, 0x0}, {0x2190, 0x0}, {0x21E4, 0x0}, {0x291F, 0x0},
+    {0x291D, 0x0}, {0x21A9, 0x0}, {0x21AB, 0x0}, {0x2939, 0x0}, {0x2973, 0x0}, {0x21A2, 0x0},
+    {0x2AAB, 0x0}, {0x2919, 0x0}, {0x2AAD, 0x0}, {0x2AAD, 0xFE00}, {0x290C, 0x0}, {0x2772, 0x0},
+    {0x7B, 0x0}, {0x5B, 0x0}, {0x298B, 0x0}, {0x298F, 0x0}, {0x298D, 0x0}, {0x13E, 0x0},
+    {0x13C, 0x0}, {0x2308, 0x0}, {0x7B, 0x0}, {0x43B, 0x0}, {0x2936, 0x0}, {0x201C, 0x0},
+    {0x201E, 0x0}, {0x2967, 0x0}, {0x294B, 0x0}, {0x21B2, 0x0}, {0x2264, 0x0}, {0x2190, 0x0},
+    {0x21A2, 0x0}, {0x21BD, 0x0}, {0x21BC, 0x0}, {0x21C7, 0x0}, {0x2194, 0x0}, {0x21C6, 0x0},
+    {0x21CB, 0x0}, {0x21AD, 0x0}, {0x22CB, 0x0}, {0x22DA, 0x0}, {0x2264, 0x0}, {0x2266, 0x0},
+    {0x2A7D, 0x0}, {0x2A7D, 0x0}, {0x2AA8, 0x0}, {0x2A7F, 0x0}, {0x2A81, 0x0}, {0x2A83, 0x0},
+    {0x22DA, 0xFE00}, {0x2A93, 0x0}, {0x2A85, 0x0}, {0x22D6, 0x0}, {0x22DA, 0x0}, {0x2A8B, 0x0},
+    {0x2276, 0x0}, {0x2272, 0x0}, {0x297C, 0x0}, {0x230A, 0x0}, {0x1D529, 0x0}, {0x2276, 0x0},
+    {0x2A91, 0x0}, {0x21BD, 0x0}, {0x21BC, 0x0}, {0x296A, 0x0}, {0x2584, 0x0}, {0x459, 0x0},
+    {0x226A, 0x0}, {0x21C7, 0x0}, {0x231E, 0x0}, {0x296B, 0x0}, {0x25FA, 0x0}, {0x140, 0x0},
+    {0x23B0, 0x0}, {0x23B0, 0x0}, {0x2268, 0x0}, {0x2A89, 0x0}, {0x2A89, 0x0}, {0x2A87, 0x0},
+    {0x2A87, 0x0}, {0x2268, 0x0}, {0x22E6, 0x0}, {0x27EC, 0x0}, {0x21FD, 0x0}, {0x27E6, 0x0},
+    {0x27F5, 0x0}, {0x27F7, 0x0}, {0x27FC, 0x0}, {0x27F6, 0x0}, {0x21AB, 0x0}, {0x21AC, 0x0},
+    {0x2985, 0x0}, {0x1D55D, 0x0}, {0x2A2D, 0x0}, {0x2A34, 0x0}, {0x2217, 0x0}, {0x5F, 0x0},
+    {0x25CA, 0x0}, {0x25CA, 0x0}, {0x29EB, 0x0}, {0x28, 0x0}, {0x2993, 0x0}, {0x21C6, 0x0},
+    {0x231F, 0x0}, {0x21CB, 0x0}, {0x296D, 0x0}, {0x200E, 0x0}, {0x22BF, 0x0}, {0x2039, 0x0},
+    {0x1D4C1, 0x0}, {0x21B0, 0x0}, {0x2272, 0x0}, {0x2A8D, 0x0}, {0x2A8F, 0x0}, {0x5B, 0x0},
+    {0x2018, 0x0}, {0x201A, 0x0}, {0x142, 0x0}, {0x3C, 0x0}, {0x3C, 0x0}, {0x2AA6, 0x0},
+    {0x2A79, 0x0}, {0x22D6, 0x0}, {0x22CB, 0x0}, {0x22C9, 0x0}, {0x2976, 0x0}, {0x2A7B, 0x0},
+    {0x2996, 0x0}, {0x25C3, 0x0}, {0x22B4, 0x0}, {0x25C2, 0x0}, {0x294A, 0x0}, {0x2966, 0x0},
+    {0x2268, 0xFE00}, {0x2268, 0xFE00}, {0x223A, 0x0}, {0xAF, 0x0}, {0xAF, 0x0}, {0x2642, 0x0},
+    {0x2720, 0x0}, {0x2720, 0x0}, {0x21A6, 0x0}, {0x21A6, 0x0}, {0x21A7, 0x0}, {0x21A4, 0x0},
+    {0x21A5, 0x0}, {0x25AE, 0x0}, {0x2A29, 0x0}, {0x43C, 0x0}, {0x2014, 0x0}, {0x2221, 0x0},
+    {0x1D52A, 0x0}, {0x2127, 0x0}, {0xB5, 0x0}, {0xB5, 0x0}, {0x2223, 0x0}, {0x2A, 0x0},
+    {0x2AF0, 0x0}, {0xB7, 0x0}, {0xB7, 0x0}, {0x2212, 0x0}, {0x229F, 0x0}, {0x2238, 0x0},
+    {0x2A2A, 0x0}, {0x2ADB, 0x0}, {0x2026, 0x0}, {0x2213, 0x0}, {0x22A7, 0x0}, {0x1D55E, 0x0},
+    {0x2213, 0x0}, {0x1D4C2, 0x0}, {0x223E, 0x0}, {0x3BC, 0x0}, {0x22B8, 0x0}, {0x22B8, 0x0},
+    {0x22D9, 0x338}, {0x226B, 0x20D2}, {0x226B, 0x338}, {0x21CD, 0x0}, {0x21CE, 0x0}, {0x22D8, 0x338},
+    {0x226A, 0x20D2}, {0x226A, 0x338}, {0x21CF, 0x0}, {0x22AF, 0x0}, {0x22AE, 0x0}, {0x2207, 0x0},
+    {0x144, 0x0}, {0x2220, 0x20D2}, {0x2249, 0x0}, {0x2A70, 0x338}, {0x224B, 0x338}, {0x149, 0x0},
+    {0x2249, 0x0}, {0x266E, 0x0}, {0x266E, 0x0}, {0x2115, 0x0}, {0xA0, 0x0}, {0xA0, 0x0},
+    {0x224E, 0x338}, {0x224F, 0x338}, {0x2A43, 0x0}, {0x148, 0x0}, {0x146, 0x0}, {0x2247, 0x0},
+    {0x2A6D, 0x338}, {0x2A42, 0x0}, {0x43D, 0x0}, {0x2013, 0x0}, {0x2260, 0x0}, {0x21D7, 0x0},
+    {0x2924, 0x0}, {0x2197, 0x0}, {0x2197, 0x0}, {0x2250, 0x338}, {0x2262, 0x0}, {0x2928, 0x0},
+    {0x2242, 0x338}, {0x2204, 0x0}, {0x2204, 0x0}, {0x1D52B, 0x0}, {0x2267, 0x338}, {0x2271, 0x0},
+    {0x2271, 0x0}, {0x2267, 0x338}, {0x2A7E, 0x338}, {0x2A7E, 0x338}, {0x2275, 0x0}, {0x226F, 0x0},
+    {0x226F, 0x0}, {0x21CE, 0x0}, {0x21AE, 0x0}, {0x2AF2, 0x0}, {0x220B, 0x0}, {0x22FC, 0x0},
+    {0x22FA, 0x0}, {0x220B, 0x0}, {0x45A, 0x0}, {0x21CD, 0x0}, {0x2266, 0x338}, {0x219A, 0x0},
+    {0x2025, 0x0}, {0x2270, 0x0}, {0x219A, 0x0}, {0x21AE, 0x0}, {0x2270, 0x0}, {0x2266, 0x338},
+    {0x2A7D, 0x338}, {0x2A7D, 0x338}, {0x226E, 0x0}, {0x2274, 0x0}, {0x226E, 0x0}, {0x22EA, 0x0},
+    {0x22EC, 0x0}, {0x2224, 0x0}, {0x1D55F, 0x0}, {0xAC, 0x0}, {0xAC, 0x0}, {0x2209, 0x0},
+    {0x22F9, 0x338}, {0x22F5, 0x338}, {0x2209, 0x0}, {0x22F7, 0x0}, {0x22F6, 0x0}, {0x220C, 0x0},
+    {0x220C, 0x0}, {0x22FE, 0x0}, {0x22FD, 0x0}, {0x2226, 0x0}, {0x2226, 0x0}, {0x2AFD, 0x20E5},
+    {0x2202, 0x338}, {0x2A14, 0x0}, {0x2280, 0x0}, {0x22E0, 0x0}, {0x2AAF, 0x338}, {0x2280, 0x0},
+    {0x2AAF, 0x338}, {0x21CF, 0x0}, {0x219B, 0x0}, {0x2933, 0x338}, {0x219D, 0x338}, {0x219B, 0x0},
+    {0x22EB, 0x0}, {0x22ED, 0x0}, {0x2281, 0x0}, {0x22E1, 0x0}, {0x2AB0, 0x338}, {0x1D4C3, 0x0},
+    {0x2224, 0x0}, {0x2226, 0x0}, {0x2241, 0x0}, {0x2244, 0x0}, {0x2244, 0x0}, {0x2224, 0x0},
+    {0x2226, 0x0}, {0x22E2, 0x0}, {0x22E3, 0x0}, {0x2284, 0x0}, {0x2AC5, 0x338}, {0x2288, 0x0},
+    {0x2282, 0x20D2}, {0x2288, 0x0}, {0x2AC5, 0x338}, {0x2281, 0x0}, {0x2AB0, 0x338}, {0x2285, 0x0},
+    {0x2AC6, 0x338}, {0x2289, 0x0}, {0x2283, 0x20D2}, {0x2289, 0x0}, {0x2AC6, 0x338}, {0x2279, 0x0},
+    {0xF1, 0x0}, {0xF1, 0x0}, {0x2278, 0x0}, {0x22EA, 0x0}, {0x22EC, 0x0}, {0x22EB, 0x0},
+    {0x22ED, 0x0}, {0x3BD, 0x0}, {0x23, 0x0}, {0x2116, 0x0}, {0x2007, 0x0}, {0x22AD, 0x0},
+    {0x2904, 0x0}, {0x224D, 0x20D2}, {0x22AC, 0x0}, {0x2265, 0x20D2}, {0x3E, 0x20D2}, {0x29DE, 0x0},
+    {0x2902, 0x0}, {0x2264, 0x20D2}, {0x3C, 0x20D2}, {0x22B4, 0x20D2}, {0x2903, 0x0}, {0x22B5, 0x20D2},
+    {0x223C, 0x20D2}, {0x21D6, 0x0}, {0x2923, 0x0}, {0x2196, 0x0}, {0x2196, 0x0}, {0x2927, 0x0},
+    {0x24C8, 0x0}, {0xF3, 0x0}, {0xF3, 0x0}, {0x229B, 0x0}, {0x229A, 0x0}, {0xF4, 0x0},
+    {0xF4, 0x0}, {0x43E, 0x0}, {0x229D, 0x0}, {0x151, 0x0}, {0x2A38, 0x0}, {0x2299, 0x0},
+    {0x29BC, 0x0}, {0x153, 0x0}, {0x29BF, 0x0}, {0x1D52C, 0x0}, {0x2DB, 0x0}, {0xF2, 0x0},
+    {0xF2, 0x0}, {0x29C1, 0x0}, {0x29B5, 0x0}, {0x3A9, 0x0}, {0x222E, 0x0}, {0x21BA, 0x0},
+    {0x29BE, 0x0}, {0x29BB, 0x0}, {0x203E, 0x0}, {0x29C0, 0x0}, {0x14D, 0x0}, {0x3C9, 0x0},
+    {0x3BF, 0x0}, {0x29B6, 0x0}, {0x2296, 0x0}, {0x1D560, 0x0}, {0x29B7, 0x0}, {0x29B9, 0x0},
+    {0x2295, 0x0}, {0x2228, 0x0}, {0x21BB, 0x0}, {0x2A5D, 0x0}, {0x2134, 0x0}, {0x2134, 0x0},
+    {0xAA, 0x0}, {0xAA, 0x0}, {0xBA, 0x0}, {0xBA, 0x0}, {0x22B6, 0x0}, {0x2A56, 0x0},
+    {0x2A57, 0x0}, {0x2A5B, 0x0}, {0x2134, 0x0}, {0xF8, 0x0}, {0xF8, 0x0}, {0x2298, 0x0},
+    {0xF5, 0x0}, {0xF5, 0x0}, {0x2297, 0x0}, {0x2A36, 0x0}, {0xF6, 0x0}, {0xF6, 0x0},
+    {0x233D, 0x0}, {0x2225, 0x0}, {0xB6, 0x0}, {0xB6, 0x0}, {0x2225, 0x0}, {0x2AF3, 0x0},
+    {0x2AFD, 0x0}, {0x2202, 0x0}, {0x43F, 0x0}, {0x25, 0x0}, {0x2E, 0x0}, {0x2030, 0x0},
+    {0x22A5, 0x0}, {0x2031, 0x0}, {0x1D52D, 0x0}, {0x3C6, 0x0}, {0x3D5, 0x0}, {0x2133, 0x0},
+    {0x260E, 0x0}, {0x3C0, 0x0}, {0x22D4, 0x0}, {0x3D6, 0x0}, {0x210F, 0x0}, {0x210E, 0x0},
+    {0x210F, 0x0}, {0x2B, 0x0}, {0x2A23, 0x0}, {0x229E, 0x0}, {0x2A22, 0x0}, {0x2214, 0x0},
+    {0x2A25, 0x0}, {0x2A72, 0x0}, {0xB1, 0x0}, {0xB1, 0x0}, {0x2A26, 0x0}, {0x2A27, 0x0},
+    {0xB1, 0x0}, {0x2A15, 0x0}, {0x1D561, 0x0}, {0xA3, 0x0}, {0xA3, 0x0}, {0x227A, 0x0},
+    {0x2AB3, 0x0}, {0x2AB7, 0x0}, {0x227C, 0x0}, {0x2AAF, 0x0}, {0x227A, 0x0}, {0x2AB7, 0x0},
+    {0x227C, 0x0}, {0x2AAF, 0x0}, {0x2AB9, 0x0}, {0x2AB5, 0x0}, {0x22E8, 0x0}, {0x227E, 0x0},
+    {0x2032, 0x0}, {0x2119, 0x0}, {0x2AB5, 0x0}, {0x2AB9, 0x0}, {0x22E8, 0x0}, {0x220F, 0x0},
+    {0x232E, 0x0}, {0x2312, 0x0}, {0x2313, 0x0}, {0x221D, 0x0}, {0x221D, 0x0}, {0x227E, 0x0},
+    {0x22B0, 0x0}, {0x1D4C5, 0x0}, {0x3C8, 0x0}, {0x2008, 0x0}, {0x1D52E, 0x0}, {0x2A0C, 0x0},
+    {0x1D562, 0x0}, {0x2057, 0x0}, {0x1D4C6, 0x0}, {0x210D, 0x0}, {0x2A16, 0x0}, {0x3F, 0x0},
+    {0x225F, 0x0}, {0x22, 0x0}, {0x22, 0x0}, {0x21DB, 0x0}, {0x21D2, 0x0}, {0x291C, 0x0},
+    {0x290F, 0x0}, {0x2964, 0x0}, {0x223D, 0x331}, {0x155, 0x0}, {0x221A, 0x0}, {0x29B3, 0x0},
+    {0x27E9, 0x0}, {0x2992, 0x0}, {0x29A5, 0x0}, {0x27E9, 0x0}, {0xBB, 0x0}, {0xBB, 0x0},
+    {0x2192, 0x0}, {0x2975, 0x0}, {0x21E5, 0x0}, {0x2920, 0x0}, {0x2933, 0x0}, {0x291E, 0x0},
+    {0x21AA, 0x0}, {0x21AC, 0x0}, {0x2945, 0x0}, {0x2974, 0x0}, {0x21A3, 0x0}, {0x219D, 0x0},
+    {0x291A, 0x0}, {0x2236, 0x0}, {0x211A, 0x0}, {0x290D, 0x0}, {0x2773, 0x0}, {0x7D, 0x0},
+    {0x5D, 0x0}, {0x298C, 0x0}, {0x298E, 0x0}, {0x2990, 0x0}, {0x159, 0x0}, {0x157, 0x0},
+    {0x2309, 0x0}, {0x7D, 0x0}, {0x440, 0x0}, {0x2937, 0x0}, {0x2969, 0x0}, {0x201D, 0x0},
+    {0x201D, 0x0}, {0x21B3, 0x0}, {0x211C, 0x0}, {0x211B, 0x0}, {0x211C, 0x0}, {0x211D, 0x0},
+    {0x25AD, 0x0}, {0xAE, 0x0}, {0xAE, 0x0}, {0x297D, 0x0}, {0x230B, 0x0}, {0x1D52F, 0x0},
+    {0x21C1, 0x0}, {0x21C0, 0x0}, {0x296C, 0x0}, {0x3C1, 0x0}, {0x3F1, 0x0}, {0x2192, 0x0},
+    {0x21A3, 0x0}, {0x21C1, 0x0}, {0x21C0, 0x0}, {0x21C4, 0x0}, {0x21CC, 0x0}, {0x21C9, 0x0},
+    {0x219D, 0x0}, {0x22CC, 0x0}, {0x2DA, 0x0}, {0x2253, 0x0}, {0x21C4, 0x0}, {0x21CC, 0x0},
+    {0x200F, 0x0}, {0x23B1, 0x0}, {0x23B1, 0x0}, {0x2AEE, 0x0}, {0x27ED, 0x0}, {0x21FE, 0x0},
+    {0x27E7, 0x0}, {0x2986, 0x0}, {0x1D563, 0x0}, {0x2A2E, 0x0}, {0x2A35, 0x0}, {0x29, 0x0},
+    {0x2994, 0x0}, {0x2A12, 0x0}, {0x21C9, 0x0}, {0x203A, 0x0}, {0x1D4C7, 0x0}, {0x21B1, 0x0},
+    {0x5D, 0x0}, {0x2019, 0x0}, {0x2019, 0x0}, {0x22CC, 0x0}, {0x22CA, 0x0}, {0x25B9, 0x0},
+    {0x22B5, 0x0}, {0x25B8, 0x0}, {0x29CE, 0x0}, {0x2968, 0x0}, {0x211E, 0x0}, {0x15B, 0x0},
+    {0x201A, 0x0}, {0x227B, 0x0}, {0x2AB4, 0x0}, {0x2AB8, 0x0}, {0x161, 0x0}, {0x227D, 0x0},
+    {0x2AB0, 0x0}, {0x15F, 0x0}, {0x15D, 0x0}, {0x2AB6, 0x0}, {0x2ABA, 0x0}, {0x22E9, 0x0},
+    {0x2A13, 0x0}, {0x227F, 0x0}, {0x441, 0x0}, {0x22C5, 0x0}, {0x22A1, 0x0}, {0x2A66, 0x0},
+    {0x21D8, 0x0}, {0x2925, 0x0}, {0x2198, 0x0}, {0x2198, 0x0}, {0xA7, 0x0}, {0xA7, 0x0},
+    {0x3B, 0x0}, {0x2929, 0x0}, {0x2216, 0x0}, {0x2216, 0x0}, {0x2736, 0x0}, {0x1D530, 0x0},
+    {0x2322, 0x0}, {0x266F, 0x0}, {0x449, 0x0}, {0x448, 0x0}, {0x2223, 0x0}, {0x2225, 0x0},
+    {0xAD, 0x0}, {0xAD, 0x0}, {0x3C3, 0x0}, {0x3C2, 0x0}, {0x3C2, 0x0}, {0x223C, 0x0},
+    {0x2A6A, 0x0}, {0x2243, 0x0}, {0x2243, 0x0}, {0x2A9E, 0x0}, {0x2AA0, 0x0}, {0x2A9D, 0x0},
+    {0x2A9F, 0x0}, {0x2246, 0x0}, {0x2A24, 0x0}, {0x2972, 0x0}, {0x2190, 0x0}, {0x2216, 0x0},
+    {0x2A33, 0x0}, {0x29E4, 0x0}, {0x2223, 0x0}, {0x2323, 0x0}, {0x2AAA, 0x0}, {0x2AAC, 0x0},
+    {0x2AAC, 0xFE00}, {0x44C, 0x0}, {0x2F, 0x0}, {0x29C4, 0x0}, {0x233F, 0x0}, {0x1D564, 0x0},
+    {0x2660, 0x0}, {0x2660, 0x0}, {0x2225, 0x0}, {0x2293, 0x0}, {0x2293, 0xFE00}, {0x2294, 0x0},
+    {0x2294, 0xFE00}, {0x228F, 0x0}, {0x2291, 0x0}, {0x228F, 0x0}, {0x2291, 0x0}, {0x2290, 0x0},
+    {0x2292, 0x0}, {0x2290, 0x0}, {0x2292, 0x0}, {0x25A1, 0x0}, {0x25A1, 0x0}, {0x25AA, 0x0},
+    {0x25AA, 0x0}, {0x2192, 0x0}, {0x1D4C8, 0x0}, {0x2216, 0x0}, {0x2323, 0x0}, {0x22C6, 0x0},
+    {0x2606, 0x0}, {0x2605, 0x0}, {0x3F5, 0x0}, {0x3D5, 0x0}, {0xAF, 0x0}, {0x2282, 0x0},
+    {0x2AC5, 0x0}, {0x2ABD, 0x0}, {0x2286, 0x0}, {0x2AC3, 0x0}, {0x2AC1, 0x0}, {0x2ACB, 0x0},
+    {0x228A, 0x0}, {0x2ABF, 0x0}, {0x2979, 0x0}, {0x2282, 0x0}, {0x2286, 0x0}, {0x2AC5, 0x0},
+    {0x228A, 0x0}, {0x2ACB, 0x0}, {0x2AC7, 0x0}, {0x2AD5, 0x0}, {0x2AD3, 0x0}, {0x227B, 0x0},
+    {0x2AB8, 0x0}, {0x227D, 0x0}, {0x2AB0, 0x0}, {0x2ABA, 0x0}, {0x2AB6, 0x0}, {0x22E9, 0x0},
+    {0x227F, 0x0}, {0x2211, 0x0}, {0x266A, 0x0}, {0xB9, 0x0}, {0xB9, 0x0}, {0xB2, 0x0},
+    {0xB2, 0x0}, {0xB3, 0x0}, {0xB3, 0x0}, {0x2283, 0x0}, {0x2AC6, 0x0}, {0x2ABE, 0x0},
+    {0x2AD8, 0x0}, {0x2287, 0x0}, {0x2AC4, 0x0}, {0x27C9, 0x0}, {0x2AD7, 0x0}, {0x297B, 0x0},
+    {0x2AC2, 0x0}, {0x2ACC, 0x0}, {0x228B, 0x0}, {0x2AC0, 0x0}, {0x2283, 0x0}, {0x2287, 0x0},
+    {0x2AC6, 0x0}, {0x228B, 0x0}, {0x2ACC, 0x0}, {0x2AC8, 0x0}, {0x2AD4, 0x0}, {0x2AD6, 0x0},
+    {0x21D9, 0x0}, {0x2926, 0x0}, {0x2199, 0x0}, {0x2199, 0x0}, {0x292A, 0x0}, {0xDF, 0x0},
+    {0xDF, 0x0}, {0x2316, 0x0}, {0x3C4, 0x0}, {0x23B4, 0x0}, {0x165, 0x0}, {0x163, 0x0},
+    {0x442, 0x0}, {0x20DB, 0x0}, {0x2315, 0x0}, {0x1D531, 0x0}, {0x2234, 0x0}, {0x2234, 0x0},
+    {0x3B8, 0x0}, {0x3D1, 0x0}, {0x3D1, 0x0}, {0x2248, 0x0}, {0x223C, 0x0}, {0x2009, 0x0},
+    {0x2248, 0x0}, {0x223C, 0x0}, {0xFE, 0x0}, {0xFE, 0x0}, {0x2DC, 0x0}, {0xD7, 0x0},
+    {0xD7, 0x0}, {0x22A0, 0x0}, {0x2A31, 0x0}, {0x2A30, 0x0}, {0x222D, 0x0}, {0x2928, 0x0},
+    {0x22A4, 0x0}, {0x2336, 0x0}, {0x2AF1, 0x0}, {0x1D565, 0x0}, {0x2ADA, 0x0}, {0x2929, 0x0},
+    {0x2034, 0x0}, {0x2122, 0x0}, {0x25B5, 0x0}, {0x25BF, 0x0}, {0x25C3, 0x0}, {0x22B4, 0x0},
+    {0x225C, 0x0}, {0x25B9, 0x0}, {0x22B5, 0x0}, {0x25EC, 0x0}, {0x225C, 0x0}, {0x2A3A, 0x0},
+    {0x2A39, 0x0}, {0x29CD, 0x0}, {0x2A3B, 0x0}, {0x23E2, 0x0}, {0x1D4C9, 0x0}, {0x446, 0x0},
+    {0x45B, 0x0}, {0x167, 0x0}, {0x226C, 0x0}, {0x219E, 0x0}, {0x21A0, 0x0}, {0x21D1, 0x0},
+    {0x2963, 0x0}, {0xFA, 0x0}, {0xFA, 0x0}, {0x2191, 0x0}, {0x45E, 0x0}, {0x16D, 0x0},
+    {0xFB, 0x0}, {0xFB, 0x0}, {0x443, 0x0}, {0x21C5, 0x0}, {0x171, 0x0}, {0x296E, 0x0},
+    {0x297E, 0x0}, {0x1D532, 0x0}, {0xF9, 0x0}, {0xF9, 0x0}, {0x21BF, 0x0}, {0x21BE, 0x0},
+    {0x2580, 0x0}, {0x231C, 0x0}, {0x231C, 0x0}, {0x230F, 0x0}, {0x25F8, 0x0}, {0x16B, 0x0},
+    {0xA8, 0x0}, {0xA8, 0x0}, {0x173, 0x0}, {0x1D566, 0x0}, {0x2191, 0x0}, {0x2195, 0x0},
+    {0x21BF, 0x0}, {0x21BE, 0x0}, {0x228E, 0x0}, {0x3C5, 0x0}, {0x3D2, 0x0}, {0x3C5, 0x0},
+    {0x21C8, 0x0}, {0x231D, 0x0}, {0x231D, 0x0}, {0x230E, 0x0}, {0x16F, 0x0}, {0x25F9, 0x0},
+    {0x1D4CA, 0x0}, {0x22F0, 0x0}, {0x169, 0x0}, {0x25B5, 0x0}, {0x25B4, 0x0}, {0x21C8, 0x0},
+    {0xFC, 0x0}, {0xFC, 0x0}, {0x29A7, 0x0}, {0x21D5, 0x0}, {0x2AE8, 0x0}, {0x2AE9, 0x0},
+    {0x22A8, 0x0}, {0x299C, 0x0}, {0x3F5, 0x0}, {0x3F0, 0x0}, {0x2205, 0x0}, {0x3D5, 0x0},
+    {0x3D6, 0x0}, {0x221D, 0x0}, {0x2195, 0x0}, {0x3F1, 0x0}, {0x3C2, 0x0}, {0x228A, 0xFE00},
+    {0x2ACB, 0xFE00}, {0x228B, 0xFE00}, {0x2ACC, 0xFE00}, {0x3D1, 0x0}, {0x22B2, 0x0}, {0x22B3, 0x0},
+    {0x432, 0x0}, {0x22A2, 0x0}, {0x2228, 0x0}, {0x22BB, 0x0}, {0x225A, 0x0}, {0x22EE, 0x0},
+    {0x7C, 0x0}, {0x7C, 0x0}, {0x1D533, 0x0}, {0x22B2, 0x0}, {0x2282, 0x20D2}, {0x2283, 0x20D2},
+    {0x1D567, 0x0}, {0x221D, 0x0}, {0x22B3, 0x0}, {0x1D4CB, 0x0}, {0x2ACB, 0xFE00}, {0x228A, 0xFE00},
+    {0x2ACC, 0xFE00}, {0x228B, 0xFE00}, {0x299A, 0x0}, {0x175, 0x0}, {0x2A5F, 0x0}, {0x2227, 0x0},
+    {0x2259, 0x0}, {0x2118, 0x0}, {0x1D534, 0x0}, {0x1D568, 0x0}, {0x2118, 0x0}, {0x2240, 0x0},
+    {0x2240, 0x0}, {0x1D4CC, 0x0}, {0x22C2, 0x0}, {0x25EF, 0x0}, {0x22C3, 0x0}, {0x25BD, 0x0},
+    {0x1D535, 0x0}, {0x27FA, 0x0}, {0x27F7, 0x0}, {0x3BE, 0x0}, {0x27F8, 0x0}, {0x27F5, 0x0},
+    {0x27FC, 0x0}, {0x22FB, 0x0}, {0x2A00, 0x0}, {0x1D569, 0x0}, {0x2A01, 0x0}, {0x2A02, 0x0},
+    {0x27F9, 0x0}, {0x27F6, 0x0}, {0x1D4CD, 0x0}, {0x2A06, 0x0}, {0x2A04, 0x0}, {0x25B3, 0x0},
+    {0x22C1, 0x0}, {0x22C0, 0x0}, {0xFD, 0x0}, {0xFD, 0x0}, {0x44F, 0x0}, {0x177, 0x0},
+    {0x44B, 0x0}, {0xA5, 0x0}, {0xA5, 0x0}, {0x1D536, 0x0}, {0x457, 0x0}, {0x1D56A, 0x0},
+    {0x1D4CE, 0x0}, {0x44E, 0x0}, {0xFF, 0x0}, {0xFF, 0x0}, {0x17A, 0x0}, {0x17E, 0x0},
+    {0x437, 0x0}, {0x17C, 0x0}, {0x2128, 0x0}, {0x3B6, 0x0}, {0x1D537, 0x0}, {0x436, 0x0},
+    {0x21DD, 0x0}, {0x1D56B, 0x0}, {0x1D4CF, 0x0}, {0x200D, 0x0}, {0x200C, 0x0},
+};
+
+// Node 0 is the root
+inline constexpr EntityTrieNode kEntityTrie[9854] = {
+    {'\0', 52, 1, 0}, {'A', 16, 53, 0}, {'B', 8, 69, 0}, {'C', 14, 77, 0}, {'D', 11, 91, 0}, {'E', 16, 102, 0},
+    {'F', 5, 118, 0}, {'G', 12, 123, 0}, {'H', 8, 135, 0}, {'I', 14, 143, 0}, {'J', 5, 157, 0}, {'K', 7, 162, 0},
+    {'L', 11, 169, 0}, {'M', 8, 180, 0}, {'N', 9, 188, 0}, {'O', 14, 197, 0}, {'P', 9, 211, 0}, {'Q', 4, 220, 0},
+    {'R', 12, 224, 0}, {'S', 13, 236, 0}, {'T', 11, 249, 0}, {'U', 14, 260, 0}, {'V', 9, 274, 0}, {'W', 5, 283, 0},
+    {'X', 4, 288, 0}, {'Y', 9, 292, 0}, {'Z', 8, 301, 0}, {'a', 16, 309, 0}, {'b', 16, 325, 0}, {'c', 15, 341, 0},
+    {'d', 19, 356, 0}, {'e', 18, 375, 0}, {'f', 12, 393, 0}, {'g', 17, 405, 0}, {'h', 10, 422, 0}, {'i', 15, 432, 0},
+    {'j', 6, 447, 0}, {'k', 8, 453, 0}, {'l', 23, 461, 0}, {'m', 14, 484, 0}, {'n', 24, 498, 0}, {'o', 18, 522, 0},
+    {'p', 12, 540, 0}, {'q', 6, 552, 0}, {'r', 21, 558, 0}, {'s', 19, 579, 0}, {'t', 13, 598, 0}, {'u', 18, 611, 0},
+    {'v', 15, 629, 0}, {'w', 7, 644, 0}, {'x', 14, 651, 0}, {'y', 8, 665, 0}, {'z', 10, 673, 0}, {'E', 1, 683, 0},
+    {'M', 1, 684, 0}, {'a', 1, 685, 0}, {'b', 1, 686, 0}, {'c', 2, 687, 0}, {'f', 1, 689, 0}, {'g', 1, 690, 0},
+    {'l', 1, 691, 0}, {'m', 1, 692, 0}, {'n', 1, 693, 0}, {'o', 2, 694, 0}, {'p', 1, 696, 0}, {'r', 1, 697, 0},
+    {'s', 2, 698, 0}, {'t', 1, 700, 0}, {'u', 1, 701, 0}, {'a', 2, 702, 0}, {'c', 1, 704, 0}, {'e', 3, 705, 0},
+    {'f', 1, 708, 0}, {'o', 1, 709, 0}, {'r', 1, 710, 0}, {'s', 1, 711, 0}, {'u', 1, 712, 0}, {'H', 1, 713, 0},
+    {'O', 1, 714, 0}, {'a', 3, 715, 0}, {'c', 4, 718, 0}, {'d', 1, 722, 0}, {'e', 2, 723, 0}, {'f', 1, 725, 0},
+    {'h', 1, 726, 0}, {'i', 1, 727, 0}, {'l', 1, 728, 0}, {'o', 4, 729, 0}, {'r', 1, 733, 0}, {'s', 1, 734, 0},
+    {'u', 1, 735, 0}, {'D', 2, 736, 0}, {'J', 1, 738, 0}, {'S', 1, 739, 0}, {'Z', 1, 740, 0}, {'a', 3, 741, 0},
+    {'c', 2, 744, 0}, {'e', 1, 746, 0}, {'f', 1, 747, 0}, {'i', 2, 748, 0}, {'o', 4, 750, 0}, {'s', 2, 754, 0},
+    {'N', 1, 756, 0}, {'T', 1, 757, 0}, {'a', 1, 758, 0}, {'c', 3, 759, 0}, {'d', 1, 762, 0}, {'f', 1, 763, 0},
+    {'g', 1, 764, 0}, {'l', 1, 765, 0}, {'m', 2, 766, 0}, {'o', 2, 768, 0}, {'p', 1, 770, 0}, {'q', 1, 771, 0},
+    {'s', 2, 772, 0}, {'t', 1, 774, 0}, {'u', 1, 775, 0}, {'x', 2, 776, 0}, {'c', 1, 778, 0}, {'f', 1, 779, 0},
+    {'i', 1, 780, 0}, {'o', 3, 781, 0}, {'s', 1, 784, 0}, {'J', 1, 785, 0}, {'T', 1, 786, 169}, {'a', 1, 787, 0},
+    {'b', 1, 788, 0}, {'c', 3, 789, 0}, {'d', 1, 792, 0}, {'f', 1, 793, 0}, {'g', 1, 794, 0}, {'o', 1, 795, 0},
+    {'r', 1, 796, 0}, {'s', 1, 797, 0}, {'t', 1, 798, 0}, {'A', 1, 799, 0}, {'a', 2, 800, 0}, {'c', 1, 802, 0},
+    {'f', 1, 803, 0}, {'i', 1, 804, 0}, {'o', 2, 805, 0}, {'s', 2, 807, 0}, {'u', 1, 809, 0}, {'E', 1, 810, 0},
+    {'J', 1, 811, 0}, {'O', 1, 812, 0}, {'a', 1, 813, 0}, {'c', 2, 814, 0}, {'d', 1, 816, 0}, {'f', 1, 817, 0},
+    {'g', 1, 818, 0}, {'m', 3, 819, 0}, {'n', 2, 822, 0}, {'o', 3, 824, 0}, {'s', 1, 827, 0}, {'t', 1, 828, 0},
+    {'u', 2, 829, 0}, {'c', 2, 831, 0}, {'f', 1, 833, 0}, {'o', 1, 834, 0}, {'s', 2, 835, 0}, {'u', 1, 837, 0},
+    {'H', 1, 838, 0}, {'J', 1, 839, 0}, {'a', 1, 840, 0}, {'c', 2, 841, 0}, {'f', 1, 843, 0}, {'o', 1, 844, 0},
+    {'s', 1, 845, 0}, {'J', 1, 846, 0}, {'T', 1, 847, 247}, {'a', 5, 848, 0}, {'c', 3, 853, 0}, {'e', 2, 856, 0},
+    {'f', 1, 858, 0}, {'l', 2, 859, 0}, {'m', 1, 861, 0}, {'o', 3, 862, 0}, {'s', 3, 865, 0}, {'t', 1, 868, 0},
+    {'a', 1, 869, 0}, {'c', 1, 870, 0}, {'e', 2, 871, 0}, {'f', 1, 873, 0}, {'i', 1, 874, 0}, {'o', 1, 875, 0},
+    {'s', 1, 876, 0}, {'u', 1, 877, 0}, {'J', 1, 878, 0}, {'a', 1, 879, 0}, {'c', 3, 880, 0}, {'e', 3, 883, 0},
+    {'f', 1, 886, 0}, {'o', 4, 887, 0}, {'s', 1, 891, 0}, {'t', 1, 892, 0}, {'u', 1, 893, 0}, {'E', 1, 894, 0},
+    {'a', 1, 895, 0}, {'c', 2, 896, 0}, {'d', 1, 898, 0}, {'f', 1, 899, 0}, {'g', 1, 900, 0}, {'m', 3, 901, 0},
+    {'o', 1, 904, 0}, {'p', 1, 905, 0}, {'r', 1, 906, 0}, {'s', 2, 907, 0}, {'t', 1, 909, 0}, {'u', 1, 910, 0},
+    {'v', 1, 911, 0}, {'a', 1, 912, 0}, {'c', 1, 913, 0}, {'f', 1, 914, 0}, {'h', 1, 915, 0}, {'i', 1, 916, 0},
+    {'l', 1, 917, 0}, {'o', 2, 918, 0}, {'r', 4, 920, 0}, {'s', 2, 924, 0}, {'U', 1, 926, 0}, {'f', 1, 927, 0},
+    {'o', 1, 928, 0}, {'s', 1, 929, 0}, {'B', 1, 930, 0}, {'E', 1, 931, 0}, {'a', 3, 932, 0}, {'c', 3, 935, 0},
+    {'e', 2, 938, 0}, {'f', 1, 940, 0}, {'h', 1, 941, 0}, {'i', 1, 942, 0}, {'o', 2, 943, 0}, {'r', 1, 945, 0},
+    {'s', 2, 946, 0}, {'u', 1, 948, 0}, {'H', 2, 949, 0}, {'O', 1, 951, 0}, {'a', 1, 952, 0}, {'c', 5, 953, 0},
+    {'f', 1, 958, 0}, {'h', 1, 959, 0}, {'i', 1, 960, 0}, {'m', 1, 961, 0}, {'o', 1, 962, 0}, {'q', 2, 963, 0},
+    {'s', 1, 965, 0}, {'t', 1, 966, 0}, {'u', 4, 967, 0}, {'H', 1, 971, 0}, {'R', 1, 972, 0}, {'S', 2, 973, 0},
+    {'a', 2, 975, 0}, {'c', 3, 977, 0}, {'f', 1, 980, 0}, {'h', 2, 981, 0}, {'i', 1, 983, 0}, {'o', 1, 984, 0},
+    {'r', 1, 985, 0}, {'s', 2, 986, 0}, {'a', 2, 988, 0}, {'b', 1, 990, 0}, {'c', 2, 991, 0}, {'d', 1, 993, 0},
+    {'f', 1, 994, 0}, {'g', 1, 995, 0}, {'m', 1, 996, 0}, {'n', 2, 997, 0}, {'o', 2, 999, 0}, {'p', 8, 1001, 0},
+    {'r', 1, 1009, 0}, {'s', 1, 1010, 0}, {'t', 1, 1011, 0}, {'u', 1, 1012, 0}, {'D', 1, 1013, 0}, {'b', 1, 1014, 0},
+    {'c', 1, 1015, 0}, {'d', 1, 1016, 0}, {'e', 2, 1017, 0}, {'f', 1, 1019, 0}, {'o', 1, 1020, 0}, {'s', 1, 1021, 0},
+    {'v', 1, 1022, 0}, {'c', 1, 1023, 0}, {'e', 1, 1024, 0}, {'f', 1, 1025, 0}, {'o', 1, 1026, 0}, {'s', 1, 1027, 0},
+    {'f', 1, 1028, 0}, {'i', 1, 1029, 0}, {'o', 1, 1030, 0}, {'s', 1, 1031, 0}, {'A', 1, 1032, 0}, {'I', 1, 1033, 0},
+    {'U', 1, 1034, 0}, {'a', 1, 1035, 0}, {'c', 2, 1036, 0}, {'f', 1, 1038, 0}, {'o', 1, 1039, 0}, {'s', 1, 1040, 0},
+    {'u', 1, 1041, 0}, {'H', 1, 1042, 0}, {'a', 1, 1043, 0}, {'c', 2, 1044, 0}, {'d', 1, 1046, 0}, {'e', 2, 1047, 0},
+    {'f', 1, 1049, 0}, {'o', 1, 1050, 0}, {'s', 1, 1051, 0}, {'a', 1, 1052, 0}, {'b', 1, 1053, 0}, {'c', 6, 1054, 0},
+    {'e', 1, 1060, 0}, {'f', 2, 1061, 0}, {'g', 1, 1063, 0}, {'l', 2, 1064, 0}, {'m', 2, 1066, 0}, {'n', 2, 1068, 0},
+    {'o', 2, 1070, 0}, {'p', 7, 1072, 0}, {'r', 1, 1079, 0}, {'s', 3, 1080, 0}, {'t', 1, 1083, 0}, {'u', 1, 1084, 0},
+    {'w', 2, 1085, 0}, {'N', 1, 1087, 0}, {'a', 2, 1088, 0}, {'b', 1, 1090, 0}, {'c', 2, 1091, 0}, {'d', 1, 1093, 0},
+    {'e', 5, 1094, 0}, {'f', 1, 1099, 0}, {'i', 1, 1100, 0}, {'k', 1, 1101, 0}, {'l', 3, 1102, 0}, {'n', 2, 1105, 0},
+    {'o', 4, 1107, 0}, {'p', 1, 1111, 0}, {'r', 2, 1112, 0}, {'s', 4, 1114, 0}, {'u', 2, 1118, 0}, {'a', 3, 1120, 0},
+    {'c', 4, 1123, 0}, {'d', 1, 1127, 0}, {'e', 3, 1128, 0}, {'f', 1, 1131, 0}, {'h', 3, 1132, 0}, {'i', 1, 1135, 0},
+    {'l', 1, 1136, 0}, {'o', 4, 1137, 0}, {'r', 2, 1141, 0}, {'s', 2, 1143, 0}, {'t', 1, 1145, 0}, {'u', 7, 1146, 0},
+    {'w', 2, 1153, 0}, {'y', 1, 1155, 0}, {'A', 1, 1156, 0}, {'H', 1, 1157, 0}, {'a', 4, 1158, 0}, {'b', 2, 1162, 0},
+    {'c', 2, 1164, 0}, {'d', 3, 1166, 0}, {'e', 3, 1169, 0}, {'f', 2, 1172, 0}, {'h', 1, 1174, 0}, {'i', 5, 1175, 0},
+    {'j', 1, 1180, 0}, {'l', 1, 1181, 0}, {'o', 5, 1182, 0}, {'r', 2, 1187, 0}, {'s', 3, 1189, 0}, {'t', 2, 1192, 0},
+    {'u', 2, 1194, 0}, {'w', 1, 1196, 0}, {'z', 2, 1197, 0}, {'D', 2, 1199, 0}, {'a', 2, 1201, 0}, {'c', 4, 1203, 0},
+    {'d', 1, 1207, 0}, {'e', 1, 1208, 0}, {'f', 2, 1209, 0}, {'g', 3, 1211, 0}, {'l', 4, 1214, 0}, {'m', 3, 1218, 0},
+    {'n', 2, 1221, 0}, {'o', 2, 1223, 0}, {'p', 3, 1225, 0}, {'q', 4, 1228, 0}, {'r', 2, 1232, 0}, {'s', 3, 1234, 0},
+    {'t', 2, 1237, 0}, {'u', 2, 1239, 0}, {'x', 3, 1241, 0}, {'a', 1, 1244, 0}, {'c', 1, 1245, 0}, {'e', 1, 1246, 0},
+    {'f', 3, 1247, 0}, {'i', 1, 1250, 0}, {'j', 1, 1251, 0}, {'l', 3, 1252, 0}, {'n', 1, 1255, 0}, {'o', 2, 1256, 0},
+    {'p', 1, 1258, 0}, {'r', 2, 1259, 0}, {'s', 1, 1261, 0}, {'E', 2, 1262, 0}, {'a', 3, 1264, 0}, {'b', 1, 1267, 0},
+    {'c', 2, 1268, 0}, {'d', 1, 1270, 0}, {'e', 4, 1271, 0}, {'f', 1, 1275, 0}, {'g', 2, 1276, 0}, {'i', 1, 1278, 0},
+    {'j', 1, 1279, 0}, {'l', 4, 1280, 0}, {'n', 4, 1284, 0}, {'o', 1, 1288, 0}, {'r', 1, 1289, 0}, {'s', 2, 1290, 0},
+    {'t', 6, 1292, 1135}, {'v', 2, 1298, 0}, {'A', 1, 1300, 0}, {'a', 4, 1301, 0}, {'b', 1, 1305, 0}, {'c', 1, 1306, 0},
+    {'e', 3, 1307, 0}, {'f', 1, 1310, 0}, {'k', 1, 1311, 0}, {'o', 5, 1312, 0}, {'s', 3, 1317, 0}, {'y', 2, 1320, 0},
+    {'a', 1, 1322, 0}, {'c', 3, 1323, 0}, {'e', 2, 1326, 0}, {'f', 2, 1328, 0}, {'g', 1, 1330, 0}, {'i', 4, 1331, 0},
+    {'j', 1, 1335, 0}, {'m', 3, 1336, 0}, {'n', 5, 1339, 0}, {'o', 4, 1344, 0}, {'p', 1, 1348, 0}, {'q', 1, 1349, 0},
+    {'s', 2, 1350, 0}, {'t', 2, 1352, 0}, {'u', 2, 1354, 0}, {'c', 2, 1356, 0}, {'f', 1, 1358, 0}, {'m', 1, 1359, 0},
+    {'o', 1, 1360, 0}, {'s', 2, 1361, 0}, {'u', 1, 1363, 0}, {'a', 1, 1364, 0}, {'c', 2, 1365, 0}, {'f', 1, 1367, 0},
+    {'g', 1, 1368, 0}, {'h', 1, 1369, 0}, {'j', 1, 1370, 0}, {'o', 1, 1371, 0}, {'s', 1, 1372, 0}, {'A', 3, 1373, 0},
+    {'B', 1, 1376, 0}, {'E', 2, 1377, 0}, {'H', 1, 1379, 0}, {'a', 9, 1380, 0}, {'b', 3, 1389, 0}, {'c', 4, 1392, 0},
+    {'d', 4, 1396, 0}, {'e', 5, 1400, 0}, {'f', 3, 1405, 0}, {'g', 2, 1408, 0}, {'h', 2, 1410, 0}, {'j', 1, 1412, 0},
+    {'l', 5, 1413, 0}, {'m', 2, 1418, 0}, {'n', 4, 1420, 0}, {'o', 8, 1424, 0}, {'p', 1, 1432, 0}, {'r', 5, 1433, 0},
+    {'s', 6, 1438, 0}, {'t', 8, 1444, 1390}, {'u', 1, 1452, 0}, {'v', 2, 1453, 0}, {'D', 1, 1455, 0}, {'a', 4, 1456, 0},
+    {'c', 2, 1460, 0}, {'d', 1, 1462, 0}, {'e', 1, 1463, 0}, {'f', 1, 1464, 0}, {'h', 1, 1465, 0}, {'i', 3, 1466, 0},
+    {'l', 2, 1469, 0}, {'n', 1, 1471, 0}, {'o', 2, 1472, 0}, {'p', 1, 1474, 0}, {'s', 2, 1475, 0}, {'u', 3, 1477, 0},
+    {'G', 2, 1480, 0}, {'L', 3, 1482, 0}, {'R', 1, 1485, 0}, {'V', 2, 1486, 0}, {'a', 5, 1488, 0}, {'b', 2, 1493, 0},
+    {'c', 5, 1495, 0}, {'d', 1, 1500, 0}, {'e', 7, 1501, 0}, {'f', 1, 1508, 0}, {'g', 4, 1509, 0}, {'h', 3, 1513, 0},
+    {'i', 3, 1516, 0}, {'j', 1, 1519, 0}, {'l', 7, 1520, 0}, {'m', 1, 1527, 0}, {'o', 2, 1528, 0}, {'p', 3, 1530, 0},
+    {'r', 4, 1533, 0}, {'s', 7, 1537, 0}, {'t', 4, 1544, 0}, {'u', 2, 1548, 0}, {'v', 9, 1550, 0}, {'w', 3, 1559, 0},
+    {'S', 1, 1562, 0}, {'a', 2, 1563, 0}, {'c', 2, 1565, 0}, {'d', 5, 1567, 0}, {'e', 1, 1572, 0}, {'f', 2, 1573, 0},
+    {'g', 3, 1575, 0}, {'h', 2, 1578, 0}, {'i', 1, 1580, 0}, {'l', 4, 1581, 0}, {'m', 3, 1585, 0}, {'o', 1, 1588, 0},
+    {'p', 3, 1589, 0}, {'r', 7, 1592, 0}, {'s', 3, 1599, 0}, {'t', 1, 1602, 0}, {'u', 1, 1603, 0}, {'v', 1, 1604, 0},
+    {'a', 1, 1605, 0}, {'c', 1, 1606, 0}, {'e', 1, 1607, 0}, {'f', 1, 1608, 0}, {'h', 3, 1609, 0}, {'i', 3, 1612, 0},
+    {'l', 2, 1615, 0}, {'m', 1, 1617, 0}, {'o', 3, 1618, 0}, {'r', 10, 1621, 0}, {'s', 2, 1631, 0}, {'u', 1, 1633, 0},
+    {'f', 1, 1634, 0}, {'i', 1, 1635, 0}, {'o', 1, 1636, 0}, {'p', 1, 1637, 0}, {'s', 1, 1638, 0}, {'u', 3, 1639, 0},
+    {'A', 3, 1642, 0}, {'B', 1, 1645, 0}, {'H', 1, 1646, 0}, {'a', 7, 1647, 0}, {'b', 3, 1654, 0}, {'c', 4, 1657, 0},
+    {'d', 4, 1661, 0}, {'e', 3, 1665, 0}, {'f', 3, 1668, 0}, {'h', 2, 1671, 0}, {'i', 3, 1673, 0}, {'l', 3, 1676, 0},
+    {'m', 1, 1679, 0}, {'n', 1, 1680, 0}, {'o', 4, 1681, 0}, {'p', 2, 1685, 0}, {'r', 1, 1687, 0}, {'s', 4, 1688, 0},
+    {'t', 3, 1692, 0}, {'u', 1, 1695, 0}, {'x', 1, 1696, 0}, {'a', 1, 1697, 0}, {'b', 1, 1698, 0}, {'c', 10, 1699, 0},
+    {'d', 1, 1709, 0}, {'e', 7, 1710, 0}, {'f', 1, 1717, 0}, {'h', 4, 1718, 0}, {'i', 2, 1722, 0}, {'l', 1, 1724, 0},
+    {'m', 4, 1725, 0}, {'o', 3, 1729, 0}, {'p', 1, 1732, 0}, {'q', 3, 1733, 0}, {'r', 1, 1736, 0}, {'s', 4, 1737, 0},
+    {'t', 2, 1741, 0}, {'u', 5, 1743, 0}, {'w', 3, 1748, 0}, {'z', 1, 1751, 0}, {'a', 2, 1752, 0}, {'b', 1, 1754, 0},
+    {'c', 3, 1755, 0}, {'d', 1, 1758, 0}, {'e', 1, 1759, 0}, {'f', 1, 1760, 0}, {'h', 4, 1761, 0}, {'i', 3, 1765, 0},
+    {'o', 3, 1768, 0}, {'p', 1, 1771, 0}, {'r', 3, 1772, 0}, {'s', 3, 1775, 0}, {'w', 2, 1778, 0}, {'A', 1, 1780, 0},
+    {'H', 1, 1781, 0}, {'a', 2, 1782, 0}, {'b', 1, 1784, 0}, {'c', 2, 1785, 0}, {'d', 3, 1787, 0}, {'f', 2, 1790, 0},
+    {'g', 1, 1792, 0}, {'h', 2, 1793, 0}, {'l', 2, 1795, 0}, {'m', 2, 1797, 0}, {'o', 2, 1799, 0}, {'p', 6, 1801, 0},
+    {'r', 3, 1807, 0}, {'s', 1, 1810, 0}, {'t', 3, 1811, 0}, {'u', 2, 1814, 0}, {'w', 1, 1816, 0}, {'A', 1, 1817, 0},
+    {'B', 1, 1818, 0}, {'D', 1, 1819, 0}, {'a', 2, 1820, 0}, {'c', 1, 1822, 0}, {'d', 1, 1823, 0}, {'e', 3, 1824, 0},
+    {'f', 1, 1827, 0}, {'l', 1, 1828, 0}, {'n', 1, 1829, 0}, {'o', 1, 1830, 0}, {'p', 1, 1831, 0}, {'r', 1, 1832, 0},
+    {'s', 2, 1833, 0}, {'z', 1, 1835, 0}, {'c', 1, 1836, 0}, {'e', 2, 1837, 0}, {'f', 1, 1839, 0}, {'o', 1, 1840, 0},
+    {'p', 1, 1841, 0}, {'r', 2, 1842, 0}, {'s', 1, 1844, 0}, {'c', 3, 1845, 0}, {'d', 1, 1848, 0}, {'f', 1, 1849, 0},
+    {'h', 2, 1850, 0}, {'i', 1, 1852, 0}, {'l', 2, 1853, 0}, {'m', 1, 1855, 0}, {'n', 1, 1856, 0}, {'o', 3, 1857, 0},
+    {'r', 2, 1860, 0}, {'s', 2, 1862, 0}, {'u', 2, 1864, 0}, {'v', 1, 1866, 0}, {'w', 1, 1867, 0}, {'a', 1, 1868, 0},
+    {'c', 2, 1869, 0}, {'e', 1, 1871, 0}, {'f', 1, 1872, 0}, {'i', 1, 1873, 0}, {'o', 1, 1874, 0}, {'s', 1, 1875, 0},
+    {'u', 2, 1876, 0}, {'a', 1, 1878, 0}, {'c', 2, 1879, 0}, {'d', 1, 1881, 0}, {'e', 2, 1882, 0}, {'f', 1, 1884, 0},
+    {'h', 1, 1885, 0}, {'i', 1, 1886, 0}, {'o', 1, 1887, 0}, {'s', 1, 1888, 0}, {'w', 2, 1889, 0}, {'l', 1, 1891, 0},
+    {'P', 1, 1892, 3}, {'c', 1, 1893, 0}, {'r', 1, 1894, 0}, {'i', 1, 1895, 0}, {'y', 1, 1896, 0}, {'r', 1, 1897, 0},
+    {'r', 1, 1898, 0}, {'p', 1, 1899, 0}, {'a', 1, 1900, 0}, {'d', 1, 1901, 0}, {'g', 1, 1902, 0}, {'p', 1, 1903, 0},
+    {'p', 1, 1904, 0}, {'i', 1, 1905, 0}, {'c', 1, 1906, 0}, {'s', 1, 1907, 0}, {'i', 1, 1908, 0}, {'m', 1, 1909, 0},
+    {'c', 1, 1910, 0}, {'r', 2, 1911, 0}, {'y', 1, 1913, 0}, {'c', 1, 1914, 0}, {'r', 1, 1915, 0}, {'t', 1, 1916, 0},
+    {'r', 1, 1917, 0}, {'p', 1, 1918, 0}, {'e', 1, 1919, 0}, {'c', 1, 1920, 0}, {'m', 1, 1921, 0}, {'c', 1, 1922, 0},
+    {'P', 1, 1923, 0}, {'c', 1, 1924, 0}, {'p', 2, 1925, 0}, {'y', 1, 1927, 0}, {'a', 1, 1928, 0}, {'e', 1, 1929, 0},
+    {'i', 1, 1930, 0}, {'o', 1, 1931, 0}, {'o', 1, 1932, 0}, {'d', 1, 1933, 0}, {'n', 1, 1934, 0}, {'r', 1, 1935, 0},
+    {'i', 1, 1936, 0}, {'r', 1, 1937, 0}, {'o', 2, 1938, 0}, {'l', 1, 1940, 0}, {'n', 3, 1941, 0}, {'p', 2, 1944, 0},
+    {'u', 1, 1946, 0}, {'o', 1, 1947, 0}, {'c', 1, 1948, 0}, {'p', 2, 1949, 0}, {';', 0, 1951, 76}, {'o', 1, 1951, 0},
+    {'c', 1, 1952, 0}, {'c', 1, 1953, 0}, {'c', 1, 1954, 0}, {'g', 1, 1955, 0}, {'r', 1, 1956, 0}, {'s', 1, 1957, 0},
+    {'a', 1, 1958, 0}, {'y', 1, 1959, 0}, {'l', 2, 1960, 0}, {'r', 1, 1962, 0}, {'a', 2, 1963, 0}, {'f', 1, 1965, 0},
+    {'p', 1, 1966, 0}, {'t', 3, 1967, 0}, {'u', 1, 1970, 0}, {'w', 1, 1971, 0}, {'c', 1, 1972, 0}, {'t', 1, 1973, 0},
+    {'G', 1, 1974, 0}, {'H', 1, 1975, 131}, {'c', 1, 1976, 0}, {'a', 1, 1977, 0}, {'i', 1, 1978, 0}, {'y', 1, 1979, 0},
+    {'o', 1, 1980, 0}, {'r', 1, 1981, 0}, {'r', 1, 1982, 0}, {'e', 1, 1983, 0}, {'a', 1, 1984, 0}, {'p', 1, 1985, 0},
+    {'g', 1, 1986, 0}, {'p', 1, 1987, 0}, {'s', 1, 1988, 0}, {'u', 2, 1989, 0}, {'c', 1, 1991, 0}, {'i', 1, 1992, 0},
+    {'a', 1, 1993, 0}, {'m', 1, 1994, 0}, {'i', 1, 1995, 0}, {'p', 1, 1996, 0}, {'y', 1, 1997, 0}, {'r', 1, 1998, 0},
+    {'l', 1, 1999, 0}, {'p', 1, 2000, 0}, {'r', 1, 2001, 0}, {'u', 1, 2002, 0}, {'c', 1, 2003, 0}, {'c', 1, 2004, 0},
+    {';', 0, 2005, 170}, {'m', 1, 2005, 0}, {'r', 1, 2006, 0}, {'e', 1, 2007, 0}, {'i', 1, 2008, 0}, {'y', 1, 2009, 0},
+    {'o', 1, 2010, 0}, {'r', 1, 2011, 0}, {';', 0, 2012, 179}, {'p', 1, 2012, 0}, {'e', 1, 2013, 0}, {'c', 1, 2014, 0},
+    {';', 0, 2015, 189}, {'R', 1, 2015, 0}, {'c', 1, 2016, 0}, {'t', 1, 2017, 0}, {'i', 1, 2018, 0}, {'r', 1, 2019, 0},
+    {'l', 1, 2020, 0}, {'p', 1, 2021, 0}, {'r', 1, 2022, 0}, {'c', 1, 2023, 0}, {'t', 1, 2024, 0}, {'m', 1, 2025, 0},
+    {'c', 1, 2026, 0}, {'l', 1, 2027, 0}, {'c', 1, 2028, 0}, {'c', 1, 2029, 0}, {'i', 1, 2030, 0}, {'y', 1, 2031, 0},
+    {'o', 1, 2032, 0}, {'r', 1, 2033, 0}, {'r', 1, 2034, 0}, {';', 0, 2035, 214}, {'a', 2, 2035, 0}, {'p', 1, 2037, 0},
+    {'t', 2, 2038, 0}, {'v', 1, 2040, 0}, {'g', 1, 2041, 0}, {'p', 1, 2042, 0}, {'t', 1, 2043, 0}, {'c', 1, 2044, 0},
+    {'i', 1, 2045, 0}, {'k', 1, 2046, 0}, {'m', 1, 2047, 0}, {'i', 1, 2048, 0}, {'y', 1, 2049, 0}, {'r', 1, 2050, 0},
+    {'p', 1, 2051, 0}, {'c', 1, 2052, 0}, {'e', 1, 2053, 0}, {'k', 1, 2054, 0}, {'c', 1, 2055, 0}, {'c', 1, 2056, 0},
+    {'p', 1, 2057, 0}, {'e', 1, 2058, 0}, {'y', 1, 2059, 0}, {'r', 1, 2060, 0}, {'p', 1, 2061, 0}, {'c', 1, 2062, 0},
+    {'c', 1, 2063, 0}, {';', 0, 2064, 248}, {'c', 1, 2064, 0}, {'m', 1, 2065, 0}, {'n', 1, 2066, 0}, {'p', 1, 2067, 0},
+    {'r', 1, 2068, 0}, {'a', 1, 2069, 0}, {'e', 1, 2070, 0}, {'y', 1, 2071, 0}, {'f', 1, 2072, 0}, {'s', 1, 2073, 0},
+    {'r', 1, 2074, 0}, {';', 0, 2075, 290}, {'e', 1, 2075, 0}, {'i', 1, 2076, 0}, {'n', 1, 2077, 0}, {'p', 1, 2078, 0},
+    {'w', 1, 2079, 0}, {'c', 1, 2080, 0}, {'h', 1, 2081, 0}, {'t', 1, 2082, 0}, {';', 0, 2083, 305}, {'p', 1, 2083, 0},
+    {'y', 1, 2084, 0}, {'d', 1, 2085, 0}, {'l', 1, 2086, 0}, {'r', 1, 2087, 0}, {'n', 1, 2088, 0}, {'p', 1, 2089, 0},
+    {'c', 1, 2090, 0}, {';', 0, 2091, 314}, {'c', 1, 2091, 0}, {'c', 1, 2092, 0}, {'a', 1, 2093, 0}, {'e', 1, 2094, 0},
+    {'y', 1, 2095, 0}, {'g', 1, 2096, 0}, {'s', 1, 2097, 0}, {'w', 1, 2098, 0}, {'r', 1, 2099, 0}, {'B', 1, 2100, 0},
+    {'n', 1, 2101, 0}, {'p', 1, 2102, 0}, {'t', 13, 2103, 0}, {'c', 1, 2116, 0}, {'i', 1, 2117, 0}, {';', 0, 2118, 386},
+    {'l', 1, 2118, 0}, {'c', 1, 2119, 0}, {'i', 1, 2120, 0}, {'y', 1, 2121, 0}, {'b', 1, 2122, 0}, {'r', 1, 2123, 0},
+    {'r', 1, 2124, 0}, {'a', 1, 2125, 0}, {'e', 1, 2126, 0}, {'i', 1, 2127, 0}, {'p', 1, 2128, 0}, {'e', 1, 2129, 0},
+    {';', 0, 2130, 403}, {'c', 1, 2130, 0}, {'l', 1, 2131, 0}, {'i', 2, 2132, 0}, {'m', 1, 2134, 0}, {'e', 1, 2135, 0},
+    {'r', 1, 2136, 0}, {'y', 1, 2137, 0}, {'r', 1, 2138, 0}, {'i', 1, 2139, 0}, {';', 0, 2140, 420}, {'u', 1, 2140, 0},
+    {'i', 1, 2141, 0}, {'p', 1, 2142, 0}, {';', 0, 2143, 424}, {'e', 1, 2143, 0}, {'i', 1, 2144, 0}, {'o', 2, 2145, 0},
+    {'c', 1, 2147, 0}, {'i', 1, 2148, 0}, {'O', 1, 2149, 0}, {'r', 1, 2150, 0}, {'p', 1, 2151, 0}, {'c', 1, 2152, 0},
+    {'a', 1, 2153, 0}, {'G', 1, 2154, 441}, {'c', 1, 2155, 0}, {'n', 1, 2156, 0}, {'r', 1, 2157, 0}, {'a', 1, 2158, 0},
+    {'e', 1, 2159, 0}, {'y', 1, 2160, 0}, {';', 0, 2161, 450}, {'v', 1, 2161, 0}, {'r', 1, 2162, 0}, {'o', 1, 2163, 0},
+    {'g', 1, 2164, 0}, {'p', 1, 2165, 0}, {'u', 1, 2166, 0}, {'i', 1, 2167, 0}, {'c', 1, 2168, 0}, {'h', 1, 2169, 0},
+    {'l', 1, 2170, 0}, {'C', 1, 2171, 0}, {'c', 1, 2172, 0}, {'F', 1, 2173, 0}, {'c', 1, 2174, 0}, {';', 0, 2175, 489},
+    {'a', 1, 2175, 0}, {'e', 1, 2176, 0}, {'i', 1, 2177, 0}, {'y', 1, 2178, 0}, {'r', 1, 2179, 0}, {'o', 1, 2180, 0},
+    {'g', 1, 2181, 0}, {'a', 1, 2182, 0}, {'p', 1, 2183, 0}, {'r', 1, 2184, 0}, {'u', 1, 2185, 0}, {'c', 1, 2186, 0},
+    {'a', 1, 2187, 0}, {'b', 2, 2188, 0}, {'c', 2, 2190, 0}, {'m', 1, 2192, 0}, {'p', 3, 2193, 0}, {'O', 1, 2196, 0},
+    {'A', 1, 2197, 0}, {'H', 1, 2198, 0}, {'c', 1, 2199, 0}, {'b', 1, 2200, 0}, {'u', 1, 2201, 0}, {'a', 1, 2202, 0},
+    {'e', 1, 2203, 0}, {'y', 1, 2204, 0}, {'r', 1, 2205, 0}, {'e', 2, 2206, 0}, {'i', 2, 2208, 0}, {'l', 1, 2210, 0},
+    {'p', 1, 2211, 0}, {'i', 1, 2212, 0}, {'c', 1, 2213, 0}, {'t', 1, 2214, 0}, {'c', 1, 2215, 0}, {'r', 1, 2216, 0},
+    {'r', 2, 2217, 0}, {'i', 1, 2219, 0}, {'y', 1, 2220, 0}, {'b', 1, 2221, 0}, {'r', 1, 2222, 0}, {'r', 1, 2223, 0},
+    {'a', 1, 2224, 0}, {'d', 1, 2225, 0}, {'i', 1, 2226, 0}, {'g', 1, 2227, 0}, {'p', 1, 2228, 0}, {'A', 1, 2229, 0},
+    {'D', 1, 2230, 0}, {'E', 1, 2231, 0}, {'T', 1, 2232, 0}, {'a', 1, 2233, 0}, {'d', 1, 2234, 0}, {'p', 1, 2235, 0},
+    {'s', 1, 2236, 0}, {'i', 1, 2237, 0}, {'c', 1, 2238, 0}, {'i', 1, 2239, 0}, {'m', 1, 2240, 0}, {'a', 1, 2241, 0},
+    {'a', 1, 2242, 0}, {'y', 1, 2243, 0}, {'a', 1, 2244, 0}, {'e', 1, 2245, 0}, {'r', 3, 2246, 0}, {'r', 1, 2249, 0},
+    {'p', 1, 2250, 0}, {'c', 1, 2251, 0}, {'d', 1, 2252, 0}, {'i', 1, 2253, 0}, {'d', 1, 2254, 0}, {'r', 1, 2255, 0},
+    {'p', 1, 2256, 0}, {'c', 1, 2257, 0}, {'r', 1, 2258, 0}, {';', 0, 2259, 611}, {'p', 1, 2259, 0}, {'c', 1, 2260, 0},
+    {'c', 1, 2261, 0}, {'c', 1, 2262, 0}, {'c', 1, 2263, 0}, {'c', 1, 2264, 0}, {'i', 1, 2265, 0}, {'y', 1, 2266, 0},
+    {'r', 1, 2267, 0}, {'p', 1, 2268, 0}, {'c', 1, 2269, 0}, {'m', 1, 2270, 0}, {'c', 1, 2271, 0}, {'c', 1, 2272, 0},
+    {'a', 1, 2273, 0}, {'y', 1, 2274, 0}, {'o', 1, 2275, 0}, {'r', 1, 2276, 0}, {'t', 1, 2277, 0}, {'r', 1, 2278, 0},
+    {'p', 1, 2279, 0}, {'c', 1, 2280, 0}, {'c', 1, 2281, 0}, {'r', 1, 2282, 0}, {';', 0, 2283, 638}, {'E', 1, 2283, 0},
+    {'d', 1, 2284, 0}, {'i', 1, 2285, 0}, {'u', 1, 2286, 0}, {'y', 1, 2287, 0}, {'l', 1, 2288, 0}, {';', 0, 2289, 648},
+    {'r', 1, 2289, 0}, {'r', 1, 2290, 0}, {'e', 2, 2291, 0}, {'p', 1, 2293, 0}, {'a', 2, 2294, 0}, {'p', 1, 2296, 657},
+    {'d', 5, 2297, 0}, {'g', 7, 2302, 0}, {'g', 1, 2309, 0}, {'p', 1, 2310, 0}, {';', 0, 2311, 684}, {'E', 1, 2311, 0},
+    {'a', 1, 2312, 0}, {'e', 1, 2313, 0}, {'i', 1, 2314, 0}, {'o', 1, 2315, 0}, {'p', 1, 2316, 0}, {'i', 1, 2317, 0},
+    {'c', 1, 2318, 0}, {'t', 1, 2319, 0}, {'y', 1, 2320, 0}, {'i', 1, 2321, 0}, {'m', 1, 2322, 0}, {'c', 1, 2323, 0},
+    {'i', 1, 2324, 0}, {'o', 1, 2325, 0}, {'c', 1, 2326, 0}, {'r', 2, 2327, 0}, {'r', 1, 2329, 0}, {'o', 1, 2330, 0},
+    {'y', 1, 2331, 0}, {'q', 1, 2332, 0}, {'c', 1, 2333, 0}, {'m', 1, 2334, 0}, {'p', 1, 2335, 0}, {'r', 1, 2336, 0},
+    {'t', 3, 2337, 0}, {'r', 1, 2340, 0}, {'g', 7, 2341, 0}, {'a', 1, 2348, 0}, {'a', 2, 2349, 0}, {'k', 2, 2351, 0},
+    {'o', 1, 2353, 0}, {'e', 2, 2354, 0}, {'o', 1, 2356, 0}, {'p', 1, 2357, 0}, {'t', 2, 2358, 0}, {'w', 1, 2360, 0},
+    {'x', 12, 2361, 0}, {'r', 1, 2373, 0}, {'e', 1, 2374, 0}, {'v', 1, 2375, 0}, {'c', 1, 2376, 0}, {'e', 1, 2377, 0},
+    {'i', 1, 2378, 0}, {'o', 1, 2379, 0}, {'l', 1, 2380, 0}, {'m', 1, 2381, 0}, {'c', 1, 2382, 0}, {'p', 6, 2383, 0},
+    {'r', 2, 2389, 0}, {'a', 2, 2391, 0}, {'e', 1, 2393, 0}, {'i', 1, 2394, 0}, {'u', 1, 2395, 0}, {'o', 1, 2396, 0},
+    {'d', 1, 2397, 0}, {'m', 1, 2398, 0}, {'n', 1, 2399, 0}, {'r', 1, 2400, 0}, {'c', 1, 2401, 0}, {'e', 1, 2402, 0},
+    {'i', 1, 2403, 0}, {'r', 7, 2404, 0}, {'u', 1, 2411, 0}, {'l', 1, 2412, 0}, {'m', 2, 2413, 0}, {'n', 2, 2415, 0},
+    {'p', 3, 2417, 0}, {'a', 1, 2420, 0}, {'o', 1, 2421, 0}, {'c', 1, 2422, 0}, {'u', 2, 2423, 0}, {'d', 1, 2425, 0},
+    {'d', 1, 2426, 0}, {'e', 2, 2427, 0}, {'l', 1, 2429, 0}, {'p', 6, 2430, 0}, {'r', 4, 2436, 0}, {'v', 1, 2440, 0},
+    {'w', 1, 2441, 0}, {'c', 1, 2442, 0}, {'i', 1, 2443, 0}, {'l', 1, 2444, 0}, {'r', 1, 2445, 0}, {'a', 1, 2446, 0},
+    {'g', 1, 2447, 0}, {'l', 1, 2448, 0}, {'r', 1, 2449, 0}, {'s', 1, 2450, 0}, {'k', 1, 2451, 0}, {'l', 1, 2452, 0},
+    {'a', 1, 2453, 0}, {'y', 1, 2454, 0}, {';', 0, 2455, 930}, {'a', 2, 2455, 0}, {'o', 1, 2457, 0}, {'g', 1, 2458, 934},
+    {'l', 1, 2459, 0}, {'m', 1, 2460, 0}, {'i', 1, 2461, 0}, {'r', 1, 2462, 0}, {'a', 1, 2463, 0}, {'a', 1, 2464, 0},
+    {'e', 1, 2465, 0}, {'g', 1, 2466, 0}, {'s', 1, 2467, 0}, {'v', 3, 2468, 0}, {'c', 1, 2471, 0}, {'c', 2, 2472, 0},
+    {'l', 1, 2474, 0}, {'p', 1, 2475, 0}, {'t', 5, 2476, 0}, {'u', 1, 2481, 0}, {'w', 1, 2482, 0}, {'b', 1, 2483, 0},
+    {'c', 2, 2484, 0}, {'c', 2, 2486, 0}, {'o', 1, 2488, 0}, {'t', 1, 2489, 0}, {'d', 1, 2490, 0}, {'r', 1, 2491, 0},
+    {'a', 1, 2492, 0}, {'h', 1, 2493, 0}, {'a', 1, 2494, 0}, {'c', 1, 2495, 0}, {'i', 1, 2496, 0}, {'D', 1, 2497, 0},
+    {'o', 1, 2498, 0}, {'c', 1, 2499, 0}, {'s', 1, 2500, 0}, {'a', 1, 2501, 0}, {'i', 1, 2502, 0}, {'o', 1, 2503, 0},
+    {'y', 1, 2504, 0}, {'o', 1, 2505, 0}, {';', 0, 2506, 997}, {'D', 1, 2506, 0}, {'r', 1, 2507, 0}, {';', 0, 2508, 1000},
+    {'r', 1, 2508, 0}, {'s', 2, 2509, 0}, {';', 0, 2511, 1005}, {'i', 1, 2511, 0}, {'l', 1, 2512, 0}, {'s', 2, 2513, 0},
+    {'a', 1, 2515, 0}, {'p', 1, 2516, 0}, {'s', 1, 2517, 0}, {'g', 1, 2518, 0}, {'s', 1, 2519, 0}, {'g', 1, 2520, 0},
+    {'p', 1, 2521, 0}, {'a', 1, 2522, 0}, {'l', 1, 2523, 0}, {'s', 1, 2524, 0}, {'c', 2, 2525, 0}, {'s', 2, 2527, 0},
+    {'u', 3, 2529, 0}, {'v', 1, 2532, 0}, {'D', 1, 2533, 0}, {'a', 1, 2534, 0}, {'c', 1, 2535, 0}, {'d', 1, 2536, 0},
+    {'i', 1, 2537, 0}, {'a', 1, 2538, 0}, {'h', 1, 2539, 1043}, {'m', 1, 2540, 0}, {'r', 1, 2541, 0}, {'c', 1, 2542, 0},
+    {'i', 1, 2543, 0}, {'p', 2, 2544, 0}, {'l', 1, 2546, 0}, {'y', 1, 2547, 0}, {'m', 1, 2548, 0}, {'i', 1, 2549, 0},
+    {'l', 2, 2550, 0}, {'r', 1, 2552, 0}, {'l', 1, 2553, 0}, {'l', 1, 2554, 0}, {'a', 1, 2555, 0}, {'l', 1, 2556, 0},
+    {'t', 1, 2557, 0}, {'o', 1, 2558, 0}, {'p', 1, 2559, 0}, {'r', 2, 2560, 0}, {'a', 1, 2562, 0}, {'a', 2, 2563, 0},
+    {'o', 1, 2565, 0}, {'c', 1, 2566, 0}, {';', 0, 2567, 1091}, {'l', 1, 2567, 0}, {'c', 1, 2568, 0}, {'m', 1, 2569, 0},
+    {'p', 1, 2570, 0}, {'r', 1, 2571, 0}, {'i', 1, 2572, 0}, {'y', 1, 2573, 0}, {'o', 1, 2574, 0}, {';', 0, 2575, 1101},
+    {'l', 1, 2575, 0}, {'q', 3, 2576, 0}, {'s', 4, 2579, 0}, {'r', 1, 2583, 0}, {';', 0, 2584, 1114}, {'g', 1, 2584, 0},
+    {'m', 1, 2585, 0}, {'c', 1, 2586, 0}, {';', 0, 2587, 1118}, {'E', 1, 2587, 0}, {'a', 1, 2588, 0}, {'j', 1, 2589, 0},
+    {'E', 1, 2590, 0}, {'a', 1, 2591, 0}, {'e', 2, 2592, 0}, {'s', 1, 2594, 0}, {'p', 1, 2595, 0}, {'a', 1, 2596, 0},
+    {'c', 1, 2597, 0}, {'i', 1, 2598, 0}, {';', 0, 2599, 1136}, {'c', 2, 2599, 0}, {'d', 1, 2601, 0}, {'l', 1, 2602, 0},
+    {'q', 1, 2603, 0}, {'r', 5, 2604, 0}, {'e', 1, 2609, 0}, {'n', 1, 2610, 0}, {'r', 1, 2611, 0}, {'i', 1, 2612, 0},
+    {'l', 1, 2613, 0}, {'m', 1, 2614, 0}, {'r', 2, 2615, 0}, {'a', 1, 2617, 0}, {'i', 1, 2618, 0}, {'a', 1, 2619, 0},
+    {'l', 1, 2620, 0}, {'r', 1, 2621, 0}, {'r', 1, 2622, 0}, {'s', 2, 2623, 0}, {'a', 1, 2625, 0}, {'m', 1, 2626, 0},
+    {'o', 1, 2627, 0}, {'p', 1, 2628, 0}, {'r', 1, 2629, 0}, {'c', 1, 2630, 0}, {'l', 1, 2631, 0}, {'t', 1, 2632, 0},
+    {'b', 1, 2633, 0}, {'p', 1, 2634, 0}, {'c', 1, 2635, 0}, {';', 0, 2636, 1181}, {'i', 1, 2636, 0}, {'y', 1, 2637, 0},
+    {'c', 1, 2638, 0}, {'x', 1, 2639, 0}, {'f', 1, 2640, 0}, {'r', 1, 2641, 0}, {'r', 1, 2642, 0}, {';', 0, 2643, 1192},
+    {'i', 2, 2643, 0}, {'n', 1, 2645, 0}, {'o', 1, 2646, 0}, {'l', 1, 2647, 0}, {'a', 3, 2648, 0}, {'o', 1, 2651, 0},
+    {'p', 1, 2652, 0}, {';', 0, 2653, 1205}, {'c', 1, 2653, 0}, {'f', 1, 2654, 0}, {'o', 1, 2655, 0}, {'t', 5, 2656, 0},
+    {'c', 1, 2661, 0}, {'g', 1, 2662, 0}, {'p', 1, 2663, 0}, {'t', 1, 2664, 0}, {'r', 1, 2665, 0}, {'u', 1, 2666, 0},
+    {'c', 1, 2667, 0}, {'i', 1, 2668, 0}, {';', 0, 2669, 1230}, {'i', 1, 2669, 0}, {'k', 1, 2670, 0}, {'m', 1, 2671, 0},
+    {'i', 1, 2672, 0}, {'y', 1, 2673, 0}, {'r', 1, 2674, 0}, {'a', 1, 2675, 0}, {'p', 1, 2676, 0}, {'c', 1, 2677, 0},
+    {'e', 1, 2678, 0}, {'k', 1, 2679, 0}, {'p', 1, 2680, 0}, {'e', 1, 2681, 0}, {'y', 1, 2682, 0}, {'r', 1, 2683, 0},
+    {'r', 1, 2684, 0}, {'c', 1, 2685, 0}, {'c', 1, 2686, 0}, {'p', 1, 2687, 0}, {'c', 1, 2688, 0}, {'a', 1, 2689, 0},
+    {'r', 1, 2690, 0}, {'t', 1, 2691, 0}, {'a', 1, 2692, 0}, {';', 0, 2693, 1257}, {'g', 1, 2693, 0}, {'a', 1, 2694, 0},
+    {'c', 1, 2695, 0}, {'e', 1, 2696, 0}, {'g', 1, 2697, 0}, {'m', 1, 2698, 0}, {'n', 1, 2699, 0}, {'p', 1, 2700, 0},
+    {'q', 1, 2701, 0}, {'r', 1, 2702, 0}, {'t', 3, 2703, 0}, {'a', 1, 2706, 0}, {'b', 1, 2707, 0}, {'r', 2, 2708, 0},
+    {'a', 1, 2710, 0}, {'e', 2, 2711, 0}, {'u', 1, 2713, 0}, {'y', 1, 2714, 0}, {'c', 1, 2715, 0}, {'q', 1, 2716, 0},
+    {'r', 2, 2717, 0}, {'s', 1, 2719, 0}, {';', 0, 2720, 1301}, {'f', 1, 2720, 0}, {'g', 1, 2721, 0}, {'q', 3, 2722, 0},
+    {'s', 5, 2725, 0}, {'i', 1, 2730, 0}, {'l', 1, 2731, 0}, {'r', 1, 2732, 0}, {';', 0, 2733, 1332}, {'E', 1, 2733, 0},
+    {'a', 1, 2734, 0}, {'b', 1, 2735, 0}, {'c', 1, 2736, 0}, {';', 0, 2737, 1339}, {'a', 1, 2737, 0}, {'c', 1, 2738, 0},
+    {'h', 1, 2739, 0}, {'t', 1, 2740, 0}, {'i', 1, 2741, 0}, {'o', 1, 2742, 0}, {'E', 1, 2743, 0}, {'a', 1, 2744, 0},
+    {'e', 2, 2745, 0}, {'s', 1, 2747, 0}, {'a', 2, 2748, 0}, {'b', 1, 2750, 0}, {'n', 1, 2751, 0}, {'o', 1, 2752, 0},
+    {'p', 3, 2753, 0}, {'t', 1, 2756, 0}, {'w', 2, 2757, 0}, {'z', 3, 2759, 0}, {'a', 1, 2762, 0}, {'a', 1, 2763, 0},
+    {'c', 1, 2764, 0}, {'h', 1, 2765, 0}, {'m', 1, 2766, 0}, {'t', 1, 2767, 0}, {'a', 1, 2768, 0}, {'c', 1, 2769, 0},
+    {'h', 1, 2770, 0}, {'i', 1, 2771, 0}, {'q', 2, 2772, 0}, {'t', 1, 2774, 0}, {';', 0, 2775, 1391}, {'c', 2, 2775, 0},
+    {'d', 1, 2777, 0}, {'h', 1, 2778, 0}, {'i', 1, 2779, 0}, {'l', 1, 2780, 0}, {'q', 1, 2781, 0}, {'r', 2, 2782, 0},
+    {'r', 2, 2784, 0}, {'e', 1, 2786, 0}, {'n', 1, 2787, 0}, {'D', 1, 2788, 0}, {'c', 1, 2789, 0}, {'l', 2, 2790, 0},
+    {'p', 2, 2792, 0}, {'r', 1, 2794, 0}, {'o', 1, 2795, 0}, {'y', 1, 2796, 0}, {'a', 1, 2797, 0}, {'a', 1, 2798, 0},
+    {'r', 1, 2799, 0}, {'o', 1, 2800, 0}, {'c', 1, 2801, 0}, {'d', 4, 2802, 0}, {'n', 1, 2806, 0}, {'c', 1, 2807, 0},
+    {'d', 1, 2808, 0}, {'p', 1, 2809, 0}, {'d', 1, 2810, 0}, {'p', 1, 2811, 0}, {';', 0, 2812, 1441}, {'c', 1, 2812, 0},
+    {'t', 1, 2813, 0}, {';', 0, 2814, 1444}, {'l', 1, 2814, 0}, {'m', 1, 2815, 0}, {'g', 1, 2816, 0}, {'t', 2, 2817, 0},
+    {'e', 1, 2819, 0}, {'l', 1, 2820, 0}, {'t', 2, 2821, 0}, {'i', 1, 2823, 0}, {'D', 1, 2824, 0}, {'d', 1, 2825, 0},
+    {'b', 1, 2826, 0}, {'c', 1, 2827, 0}, {'n', 1, 2828, 0}, {'p', 5, 2829, 0}, {'t', 1, 2834, 0}, {'s', 1, 2835, 0},
+    {'u', 1, 2836, 0}, {'a', 2, 2837, 0}, {'e', 1, 2839, 0}, {'o', 1, 2840, 0}, {'u', 1, 2841, 0}, {'y', 1, 2842, 0},
+    {'a', 1, 2843, 0}, {';', 0, 2844, 1481}, {'A', 1, 2844, 0}, {'a', 1, 2845, 0}, {'d', 1, 2846, 0}, {'q', 1, 2847, 0},
+    {'s', 2, 2848, 0}, {'x', 1, 2850, 0}, {'r', 1, 2851, 0}, {'E', 1, 2852, 0}, {'e', 3, 2853, 0}, {'s', 1, 2856, 0},
+    {'t', 2, 2857, 0}, {'A', 1, 2859, 0}, {'a', 1, 2860, 0}, {'p', 1, 2861, 0}, {';', 0, 2862, 1505}, {'s', 2, 2862, 0},
+    {'v', 1, 2864, 0}, {'c', 1, 2865, 0}, {'A', 1, 2866, 0}, {'E', 1, 2867, 0}, {'a', 1, 2868, 0}, {'d', 1, 2869, 0},
+    {'e', 4, 2870, 0}, {'s', 1, 2874, 0}, {'t', 2, 2875, 0}, {'i', 1, 2877, 0}, {'p', 1, 2878, 0}, {'t', 3, 2879, 1528},
+    {'a', 1, 2882, 0}, {'o', 1, 2883, 0}, {'r', 3, 2884, 0}, {'A', 1, 2887, 0}, {'a', 1, 2888, 0}, {'i', 1, 2889, 0},
+    {'t', 1, 2890, 0}, {'c', 4, 2891, 0}, {'h', 1, 2895, 0}, {'i', 1, 2896, 0}, {'m', 1, 2897, 0}, {'p', 1, 2898, 0},
+    {'q', 1, 2899, 0}, {'u', 3, 2900, 0}, {'g', 1, 2903, 0}, {'i', 1, 2904, 0}, {'l', 1, 2905, 0}, {'r', 1, 2906, 0},
+    {';', 0, 2907, 1592}, {'m', 3, 2907, 0}, {'D', 1, 2910, 0}, {'H', 1, 2911, 0}, {'a', 1, 2912, 0}, {'d', 1, 2913, 0},
+    {'g', 2, 2914, 0}, {'i', 1, 2916, 0}, {'l', 3, 2917, 0}, {'r', 2, 2920, 0}, {'s', 1, 2922, 0}, {'A', 1, 2923, 0},
+    {'a', 1, 2924, 0}, {'n', 1, 2925, 0}, {';', 0, 2926, 1615}, {'c', 1, 2926, 0}, {'s', 1, 2927, 0}, {'i', 1, 2928, 0},
+    {'y', 1, 2929, 0}, {'a', 1, 2930, 0}, {'b', 1, 2931, 0}, {'i', 1, 2932, 0}, {'o', 1, 2933, 0}, {'s', 1, 2934, 0},
+    {'l', 1, 2935, 0}, {'c', 1, 2936, 0}, {'r', 1, 2937, 0}, {'o', 1, 2938, 0}, {'r', 1, 2939, 0}, {'t', 1, 2940, 0},
+    {'b', 1, 2941, 0}, {'m', 1, 2942, 0}, {'n', 1, 2943, 0}, {'a', 1, 2944, 0}, {'c', 2, 2945, 0}, {'i', 1, 2947, 0},
+    {'t', 1, 2948, 0}, {'a', 1, 2949, 0}, {'e', 1, 2950, 0}, {'i', 3, 2951, 0}, {'p', 1, 2954, 0}, {'a', 1, 2955, 0},
+    {'e', 1, 2956, 0}, {'l', 1, 2957, 0}, {';', 0, 2958, 1652}, {'a', 1, 2958, 0}, {'d', 4, 2959, 0}, {'i', 1, 2963, 0},
+    {'o', 1, 2964, 0}, {'s', 1, 2965, 0}, {'v', 1, 2966, 0}, {'c', 1, 2967, 0}, {'l', 1, 2968, 0}, {'o', 1, 2969, 0},
+    {'i', 2, 2970, 0}, {'m', 1, 2972, 0}, {'b', 1, 2973, 0}, {'r', 4, 2974, 0}, {'y', 1, 2978, 0}, {'r', 5, 2979, 0},
+    {'r', 1, 2984, 0}, {'i', 2, 2985, 0}, {'m', 1, 2987, 0}, {'o', 1, 2988, 0}, {';', 0, 2989, 1694}, {'t', 1, 2989, 0},
+    {'v', 1, 2990, 0}, {'a', 1, 2991, 0}, {'u', 1, 2992, 0}, {';', 0, 2993, 1711}, {'i', 1, 2993, 0}, {'p', 1, 2994, 0},
+    {'u', 1, 2995, 0}, {';', 0, 2996, 1716}, {'E', 1, 2996, 0}, {'a', 1, 2997, 0}, {'c', 1, 2998, 0}, {'e', 2, 2999, 0},
+    {'i', 1, 3001, 0}, {'n', 3, 3002, 0}, {'o', 3, 3005, 0}, {'s', 1, 3008, 0}, {'u', 1, 3009, 0}, {'c', 1, 3010, 0},
+    {'i', 1, 3011, 0}, {'n', 1, 3012, 0}, {'r', 1, 3013, 0}, {'n', 1, 3014, 0}, {'p', 1, 3015, 0}, {'r', 1, 3016, 0},
+    {'c', 1, 3017, 0}, {'a', 1, 3018, 0}, {'e', 1, 3019, 0}, {'o', 1, 3020, 0}, {'a', 1, 3021, 0}, {'r', 1, 3022, 0},
+    {'t', 1, 3023, 0}, {'a', 1, 3024, 0}, {'a', 1, 3025, 0}, {'c', 2, 3026, 0}, {'d', 1, 3028, 0}, {'e', 1, 3029, 0},
+    {'n', 1, 3030, 0}, {'q', 1, 3031, 0}, {'r', 1, 3032, 0}, {'t', 2, 3033, 0}, {'a', 1, 3035, 0}, {'b', 1, 3036, 0},
+    {'r', 2, 3037, 0}, {'a', 1, 3039, 0}, {'e', 2, 3040, 0}, {'u', 1, 3042, 0}, {'y', 1, 3043, 0}, {'c', 1, 3044, 0},
+    {'l', 1, 3045, 0}, {'q', 1, 3046, 0}, {'s', 1, 3047, 0}, {'a', 1, 3048, 0}, {'c', 1, 3049, 0}, {'g', 1, 3050, 1808},
+    {'i', 1, 3051, 0}, {'l', 1, 3052, 0}, {'r', 1, 3053, 0}, {'a', 1, 3054, 0}, {'o', 2, 3055, 0}, {'g', 1, 3057, 0},
+    {'n', 1, 3058, 0}, {'s', 1, 3059, 0}, {'a', 1, 3060, 0}, {'h', 1, 3061, 0}, {'m', 1, 3062, 0}, {'o', 1, 3063, 0},
+    {'m', 1, 3064, 0}, {'a', 2, 3065, 0}, {'b', 1, 3067, 0}, {'p', 3, 3068, 0}, {'t', 1, 3071, 0}, {'a', 1, 3072, 0},
+    {'p', 1, 3073, 0}, {'a', 1, 3074, 0}, {'a', 1, 3075, 0}, {'c', 1, 3076, 0}, {'h', 1, 3077, 0}, {'q', 2, 3078, 0},
+    {'h', 1, 3080, 0}, {'i', 1, 3081, 0}, {'r', 1, 3082, 0}, {'l', 1, 3083, 0}, {';', 0, 3084, 1859}, {'c', 1, 3084, 0},
+    {'q', 1, 3085, 0}, {';', 0, 3086, 1862}, {'E', 1, 3086, 0}, {'a', 2, 3087, 0}, {'c', 1, 3089, 0}, {'e', 2, 3090, 0},
+    {'i', 1, 3092, 0}, {'n', 3, 3093, 0}, {'p', 1, 3096, 0}, {'s', 1, 3097, 0}, {'y', 1, 3098, 0}, {'o', 1, 3099, 0},
+    {'A', 1, 3100, 0}, {'a', 1, 3101, 0}, {'c', 1, 3102, 0}, {'m', 1, 3103, 0}, {'s', 1, 3104, 0}, {'t', 1, 3105, 0},
+    {'x', 1, 3106, 0}, {'r', 2, 3107, 0}, {'a', 1, 3109, 0}, {'c', 2, 3110, 0}, {'o', 1, 3112, 0}, {'y', 1, 3113, 1897},
+    {'g', 1, 3114, 0}, {'m', 8, 3115, 0}, {'a', 1, 3123, 0}, {'a', 2, 3124, 0}, {'e', 1, 3126, 0}, {'i', 2, 3127, 0},
+    {'t', 2, 3129, 0}, {'f', 1, 3131, 0}, {'l', 2, 3132, 0}, {'p', 1, 3134, 0}, {'a', 2, 3135, 0}, {'c', 2, 3137, 0},
+    {'s', 1, 3139, 0}, {'u', 3, 3140, 0}, {'a', 1, 3143, 0}, {'c', 1, 3144, 0}, {'e', 1, 3145, 0}, {'m', 1, 3146, 0},
+    {'t', 1, 3147, 0}, {'a', 1, 3148, 0}, {'r', 2, 3149, 0}, {'b', 9, 3151, 0}, {'c', 1, 3160, 0}, {'m', 1, 3161, 0},
+    {'n', 1, 3162, 0}, {'p', 13, 3163, 0}, {'A', 1, 3176, 0}, {'a', 1, 3177, 0}, {'n', 1, 3178, 0}, {'l', 1, 3179, 0},
+    {'r', 1, 3180, 0}, {'u', 1, 3181, 0}, {'r', 1, 3182, 0}, {'a', 1, 3183, 0}, {'e', 1, 3184, 0}, {'y', 1, 3185, 0},
+    {'o', 1, 3186, 0}, {'l', 1, 3187, 0}, {'r', 1, 3188, 0}, {'e', 2, 3189, 0}, {'i', 2, 3191, 0}, {'k', 2, 3193, 0},
+    {'o', 1, 3195, 0}, {'l', 1, 3196, 0}, {'m', 1, 3197, 0}, {'n', 1, 3198, 0}, {'e', 1, 3199, 0}, {'p', 4, 3200, 0},
+    {'s', 1, 3204, 0}, {'r', 1, 3205, 0}, {'a', 1, 3206, 0}, {'i', 7, 3207, 0}, {'p', 1, 3214, 0}, {'c', 2, 3215, 0},
+    {'h', 1, 3217, 0}, {'t', 1, 3218, 0}, {'i', 1, 3219, 0}, {'o', 1, 3220, 0}, {'r', 1, 3221, 0}, {'a', 1, 3222, 0},
+    {'c', 1, 3223, 0}, {'r', 1, 3224, 0}, {'r', 2, 3225, 0}, {'i', 1, 3227, 0}, {'y', 1, 3228, 0}, {'a', 1, 3229, 0},
+    {'b', 1, 3230, 0}, {'h', 1, 3231, 0}, {'i', 1, 3232, 0}, {'r', 1, 3233, 0}, {'r', 1, 3234, 0}, {'a', 1, 3235, 0},
+    {'b', 1, 3236, 0}, {'c', 2, 3237, 0}, {'t', 1, 3239, 0}, {'a', 1, 3240, 0}, {'l', 1, 3241, 2101}, {'g', 1, 3242, 0},
+    {'p', 1, 3243, 0}, {'a', 1, 3244, 0}, {'d', 1, 3245, 0}, {'h', 1, 3246, 0}, {'l', 1, 3247, 0}, {'s', 1, 3248, 0},
+    {'u', 1, 3249, 0}, {'c', 2, 3250, 0}, {'i', 1, 3252, 0}, {'t', 1, 3253, 0}, {'c', 1, 3254, 0}, {'d', 1, 3255, 0},
+    {'i', 1, 3256, 0}, {'r', 1, 3257, 0}, {'a', 1, 3258, 0}, {'m', 1, 3259, 0}, {'a', 1, 3260, 0}, {'r', 1, 3261, 0},
+    {'a', 1, 3262, 0}, {'a', 1, 3263, 0}, {'n', 1, 3264, 0}, {'r', 7, 3265, 0}, {'y', 1, 3272, 0}, {'a', 1, 3273, 0},
+    {'e', 3, 3274, 0}, {'l', 1, 3277, 0}, {'r', 2, 3278, 0}, {'r', 1, 3280, 0}, {'t', 1, 3281, 0}, {'s', 1, 3282, 0},
+    {'p', 1, 3283, 0}, {'r', 1, 3284, 0}, {'t', 1, 3285, 0}, {'c', 1, 3286, 0}, {'u', 2, 3287, 0}, {'i', 1, 3289, 0},
+    {'i', 1, 3290, 0}, {'d', 2, 3291, 0}, {'i', 1, 3293, 0}, {'r', 1, 3294, 0}, {'p', 1, 3295, 0}, {';', 0, 3296, 2177},
+    {';', 0, 3296, 2178}, {'e', 1, 3296, 0}, {'c', 1, 3297, 0}, {'a', 1, 3298, 0}, {'i', 1, 3299, 0}, {'u', 1, 3300, 0},
+    {'t', 1, 3301, 0}, {'r', 1, 3302, 0}, {'A', 1, 3303, 0}, {'a', 1, 3304, 0}, {';', 0, 3305, 2188}, {'A', 1, 3305, 0},
+    {'a', 1, 3306, 0}, {'a', 1, 3307, 0}, {'i', 1, 3308, 0}, {'d', 1, 3309, 0}, {'p', 2, 3310, 0}, {'t', 1, 3312, 0},
+    {'A', 1, 3313, 0}, {'a', 1, 3314, 0}, {'c', 1, 3315, 0}, {'q', 1, 3316, 0}, {'p', 1, 3317, 0}, {'t', 1, 3318, 0},
+    {'e', 1, 3319, 0}, {'e', 1, 3320, 0}, {'c', 2, 3321, 0}, {'i', 1, 3323, 0}, {'y', 1, 3324, 0}, {'n', 1, 3325, 2210},
+    {'r', 1, 3326, 0}, {'c', 1, 3327, 0}, {'p', 1, 3328, 0}, {'c', 1, 3329, 0}, {'c', 1, 3330, 0}, {'m', 1, 3331, 0},
+    {'c', 1, 3332, 0}, {'a', 1, 3333, 0}, {'y', 1, 3334, 0}, {'o', 1, 3335, 0}, {'e', 1, 3336, 0}, {'t', 1, 3337, 0},
+    {'r', 1, 3338, 0}, {'c', 1, 3339, 0}, {'g', 1, 3340, 0}, {'p', 1, 3341, 0}, {'c', 1, 3342, 0}, {'j', 1, 3343, 0},
+    {'n', 1, 3344, 0}, {'i', 1, 3345, 0}, {';', 0, 3346, 4}, {'u', 1, 3346, 0}, {'e', 1, 3347, 0}, {'r', 1, 3348, 0},
+    {';', 0, 3349, 10}, {';', 0, 3349, 11}, {'a', 1, 3349, 0}, {'h', 1, 3350, 0}, {'c', 1, 3351, 0}, {';', 0, 3352, 16},
+    {'o', 1, 3352, 0}, {'f', 1, 3353, 0}, {'l', 1, 3354, 0}, {'n', 1, 3355, 0}, {'r', 1, 3356, 0}, {'i', 1, 3357, 0},
+    {'l', 1, 3358, 0}, {'l', 1, 3359, 26}, {'k', 1, 3360, 0}, {'v', 1, 3361, 0}, {'w', 1, 3362, 0}, {';', 0, 3363, 31},
+    {'a', 1, 3363, 0}, {'n', 1, 3364, 0}, {'a', 1, 3365, 0}, {';', 0, 3366, 35}, {'f', 1, 3366, 0}, {'v', 1, 3367, 0},
+    {'r', 1, 3368, 0}, {'p', 1, 3369, 0}, {'y', 1, 3370, 0}, {'Y', 1, 3371, 41}, {'u', 1, 3372, 0}, {';', 0, 3373, 44},
+    {'i', 1, 3373, 0}, {'l', 1, 3374, 0}, {'r', 1, 3375, 0}, {'d', 1, 3376, 0}, {'r', 1, 3377, 0}, {'n', 1, 3378, 0},
+    {'t', 1, 3379, 0}, {'i', 1, 3380, 0}, {'t', 1, 3381, 0}, {';', 0, 3382, 55}, {';', 0, 3382, 56}, {'c', 1, 3382, 0},
+    {'c', 1, 3383, 0}, {'s', 1, 3384, 0}, {'o', 1, 3385, 0}, {'g', 1, 3386, 0}, {'i', 1, 3387, 0}, {'t', 1, 3388, 0},
+    {'f', 1, 3389, 0}, {'r', 1, 3390, 0}, {'n', 1, 3391, 0}, {'s', 1, 3392, 0}, {'r', 1, 3393, 0}, {';', 0, 3394, 74},
+    {'C', 1, 3394, 0}, {'t', 1, 3395, 0}, {'y', 1, 3396, 0}, {'y', 1, 3397, 0}, {'y', 1, 3398, 0}, {'g', 1, 3399, 0},
+    {'r', 1, 3400, 0}, {'h', 1, 3401, 0}, {'r', 1, 3402, 0}, {';', 0, 3403, 85}, {';', 0, 3403, 86}, {'t', 1, 3403, 0},
+    {';', 0, 3404, 88}, {'c', 1, 3404, 0}, {'m', 1, 3405, 0}, {'f', 1, 3406, 0}, {'f', 1, 3407, 0}, {';', 0, 3408, 97},
+    {'D', 1, 3408, 0}, {'E', 1, 3409, 0}, {'b', 1, 3410, 0}, {'n', 6, 3411, 0}, {'r', 1, 3417, 0}, {'r', 1, 3418, 0},
+    {';', 0, 3419, 130}, {';', 0, 3419, 132}, {'u', 1, 3419, 0}, {'r', 1, 3420, 0}, {'r', 1, 3421, 0}, {';', 0, 3422, 138},
+    {'t', 1, 3422, 0}, {';', 0, 3423, 140}, {'a', 1, 3423, 0}, {'m', 1, 3424, 0}, {'c', 1, 3425, 0}, {'t', 1, 3426, 0},
+    {'o', 1, 3427, 0}, {'f', 1, 3428, 0}, {'i', 1, 3429, 0}, {'a', 1, 3430, 0}, {'i', 1, 3431, 0}, {'r', 1, 3432, 0},
+    {'m', 1, 3433, 0}, {';', 0, 3434, 155}, {'l', 1, 3434, 156}, {'s', 1, 3435, 0}, {'o', 1, 3436, 0}, {';', 0, 3437, 160},
+    {';', 0, 3437, 161}, {'l', 1, 3437, 0}, {'f', 1, 3438, 0}, {'A', 1, 3439, 0}, {'r', 1, 3440, 0}, {'r', 1, 3441, 0},
+    {'y', 1, 3442, 0}, {'m', 1, 3443, 0}, {'e', 1, 3444, 0}, {'d', 1, 3445, 0}, {'r', 1, 3446, 0}, {';', 0, 3447, 176},
+    {'t', 1, 3447, 0}, {';', 0, 3448, 178}, {'f', 1, 3448, 0}, {'a', 1, 3449, 0}, {'r', 1, 3450, 0}, {'D', 1, 3451, 0},
+    {'e', 1, 3452, 0}, {';', 0, 3453, 192}, {'r', 1, 3453, 0}, {';', 0, 3454, 194}, {'b', 1, 3454, 0}, {'f', 1, 3455, 0},
+    {'i', 1, 3456, 0}, {'r', 1, 3457, 0}, {'r', 1, 3458, 0}, {'p', 2, 3459, 0}, {'y', 1, 3461, 0}, {'i', 1, 3462, 0},
+    {'y', 1, 3463, 0}, {'u', 1, 3464, 0}, {'r', 1, 3465, 0}, {';', 0, 3466, 209}, {'t', 1, 3466, 0}, {';', 0, 3467, 211},
+    {'a', 1, 3467, 0}, {'c', 1, 3468, 0}, {'g', 1, 3469, 0}, {'l', 1, 3470, 0}, {';', 0, 3471, 218}, {'e', 2, 3471, 0},
+    {'i', 1, 3473, 0}, {'o', 1, 3474, 0}, {'f', 1, 3475, 0}, {'a', 1, 3476, 0}, {'r', 1, 3477, 0}, {'l', 1, 3478, 0},
+    {'c', 1, 3479, 0}, {'l', 1, 3480, 229}, {'r', 1, 3481, 0}, {';', 0, 3482, 232}, {';', 0, 3482, 233}, {'f', 1, 3482, 0},
+    {'r', 1, 3483, 0}, {'r', 1, 3484, 0}, {'c', 1, 3485, 0}, {'y', 1, 3486, 0}, {'y', 1, 3487, 0}, {'p', 1, 3488, 0},
+    {'d', 1, 3489, 0}, {';', 0, 3490, 242}, {';', 0, 3490, 243}, {'f', 1, 3490, 0}, {'r', 1, 3491, 0}, {'y', 1, 3492, 0},
+    {'u', 1, 3493, 0}, {'b', 1, 3494, 0}, {'g', 1, 3495, 0}, {'l', 1, 3496, 0}, {'r', 1, 3497, 0}, {'r', 1, 3498, 0},
+    {'d', 1, 3499, 0}, {';', 0, 3500, 256}, {'t', 10, 3500, 0}, {'s', 6, 3510, 0}, {';', 0, 3516, 289}, {'f', 1, 3516, 0},
+    {'d', 1, 3517, 0}, {'g', 4, 3518, 0}, {'f', 1, 3522, 0}, {'e', 1, 3523, 0}, {'r', 1, 3524, 0}, {';', 0, 3525, 303},
+    {'r', 1, 3525, 0}, {';', 0, 3526, 306}, {';', 0, 3526, 307}, {'i', 1, 3526, 0}, {'l', 1, 3527, 0}, {';', 0, 3528, 310},
+    {'u', 1, 3528, 0}, {'f', 1, 3529, 0}, {'r', 1, 3530, 0}, {'y', 1, 3531, 0}, {'u', 1, 3532, 0}, {'r', 1, 3533, 0},
+    {'d', 1, 3534, 0}, {';', 0, 3535, 319}, {'a', 1, 3535, 0}, {'t', 1, 3536, 0}, {'L', 1, 3537, 0}, {';', 0, 3538, 327},
+    {'r', 1, 3538, 0}, {'B', 1, 3539, 0}, {'f', 1, 3540, 0}, {';', 0, 3541, 331}, {'C', 2, 3541, 0}, {'D', 1, 3543, 0},
+    {'E', 3, 3544, 0}, {'G', 1, 3547, 0}, {'H', 1, 3548, 0}, {'L', 1, 3549, 0}, {'N', 1, 3550, 0}, {'P', 1, 3551, 0},
+    {'R', 2, 3552, 0}, {'S', 2, 3554, 0}, {'T', 1, 3556, 0}, {'V', 1, 3557, 0}, {'r', 1, 3558, 0}, {'l', 1, 3559, 0},
+    {'i', 1, 3560, 0}, {'u', 1, 3561, 0}, {'r', 1, 3562, 0}, {';', 0, 3563, 392}, {'l', 1, 3563, 0}, {';', 0, 3564, 394},
+    {'a', 1, 3564, 0}, {'c', 1, 3565, 0}, {'g', 1, 3566, 0}, {'c', 1, 3567, 0}, {'f', 1, 3568, 0}, {'n', 1, 3569, 0},
+    {'r', 1, 3570, 0}, {'a', 1, 3571, 0}, {'l', 1, 3572, 0}, {'m', 1, 3573, 0}, {'l', 1, 3574, 410}, {'r', 2, 3575, 0},
+    {'t', 1, 3577, 0}, {';', 0, 3578, 417}, {';', 0, 3578, 418}, {';', 0, 3578, 419}, {'s', 1, 3578, 0}, {'n', 1, 3579, 0},
+    {'f', 1, 3580, 0}, {'c', 1, 3581, 0}, {'m', 1, 3582, 0}, {'d', 1, 3583, 0}, {'p', 1, 3584, 0}, {'r', 1, 3585, 0},
+    {';', 0, 3586, 434}, {'T', 1, 3586, 435}, {';', 0, 3587, 437}, {'f', 1, 3587, 0}, {'r', 1, 3588, 0}, {'r', 1, 3589, 0},
+    {';', 0, 3590, 442}, {'u', 1, 3590, 0}, {'g', 1, 3591, 0}, {'r', 2, 3592, 0}, {'r', 1, 3594, 0}, {'d', 1, 3595, 0},
+    {';', 0, 3596, 449}, {'e', 1, 3596, 0}, {';', 0, 3597, 454}, {';', 0, 3597, 455}, {'h', 1, 3597, 0}, {'f', 1, 3598, 0},
+    {'n', 1, 3599, 0}, {'g', 1, 3600, 0}, {'r', 1, 3601, 0}, {';', 0, 3602, 483}, {'e', 1, 3602, 0}, {'H', 1, 3603, 0},
+    {'y', 1, 3604, 0}, {'T', 1, 3605, 0}, {'u', 1, 3606, 0}, {'r', 1, 3607, 0}, {'d', 1, 3608, 0}, {'r', 1, 3609, 0},
+    {';', 0, 3610, 493}, {';', 0, 3610, 494}, {'r', 1, 3610, 0}, {'m', 1, 3611, 0}, {'l', 1, 3612, 0}, {'f', 1, 3613, 0},
+    {'t', 1, 3614, 0}, {'a', 1, 3615, 0}, {'r', 1, 3616, 0}, {'r', 1, 3617, 0}, {';', 0, 3618, 512}, {'s', 1, 3618, 0},
+    {'c', 1, 3619, 0}, {'h', 1, 3620, 0}, {';', 0, 3621, 520}, {';', 0, 3621, 521}, {'e', 1, 3621, 0}, {'s', 1, 3622, 0},
+    {'R', 1, 3623, 0}, {'D', 1, 3624, 0}, {'c', 1, 3625, 0}, {'y', 1, 3626, 0}, {';', 0, 3627, 530}, {';', 0, 3627, 531},
+    {'r', 1, 3627, 0}, {'d', 1, 3628, 0}, {';', 0, 3629, 534}, {';', 0, 3629, 535}, {'r', 1, 3629, 0}, {'t', 1, 3630, 0},
+    {'c', 1, 3631, 0}, {'n', 1, 3632, 0}, {'d', 1, 3633, 0}, {'f', 1, 3634, 0}, {'p', 1, 3635, 0}, {'r', 1, 3636, 0},
+    {'r', 1, 3637, 0}, {'u', 1, 3638, 0}, {'r', 2, 3639, 0}, {'c', 1, 3641, 0}, {'e', 1, 3642, 0}, {'r', 1, 3643, 0},
+    {';', 0, 3644, 556}, {'l', 1, 3644, 0}, {';', 0, 3645, 558}, {'a', 1, 3645, 0}, {'c', 1, 3646, 0}, {'e', 1, 3647, 0},
+    {'o', 1, 3648, 0}, {'o', 1, 3649, 0}, {'f', 1, 3650, 0}, {'r', 1, 3651, 0}, {'o', 1, 3652, 0}, {'q', 1, 3653, 0},
+    {'e', 1, 3654, 0}, {'r', 1, 3655, 0}, {'o', 1, 3656, 0}, {'e', 1, 3657, 0}, {'i', 2, 3658, 0}, {'n', 1, 3660, 0},
+    {'r', 1, 3661, 0}, {'l', 1, 3662, 0}, {'l', 1, 3663, 586}, {'s', 1, 3664, 0}, {'r', 1, 3665, 0}, {';', 0, 3666, 590},
+    {'s', 1, 3666, 0}, {';', 0, 3667, 593}, {'b', 1, 3667, 0}, {'t', 2, 3668, 0}, {'y', 1, 3670, 0}, {';', 0, 3671, 601},
+    {'f', 1, 3671, 0}, {'r', 1, 3672, 0}, {'a', 1, 3673, 0}, {'r', 1, 3674, 0}, {'g', 1, 3675, 0}, {';', 0, 3676, 607},
+    {'f', 1, 3676, 0}, {'r', 1, 3677, 0}, {';', 0, 3678, 610}, {'f', 1, 3678, 0}, {'r', 1, 3679, 0}, {'y', 1, 3680, 0},
+    {'y', 1, 3681, 0}, {'y', 1, 3682, 0}, {'u', 1, 3683, 0}, {'r', 1, 3684, 0}, {';', 0, 3685, 620}, {';', 0, 3685, 621},
+    {'f', 1, 3685, 0}, {'r', 1, 3686, 0}, {'l', 1, 3687, 0}, {'y', 1, 3688, 0}, {'u', 1, 3689, 0}, {'r', 1, 3690, 0},
+    {';', 0, 3691, 628}, {'t', 1, 3691, 0}, {'o', 1, 3692, 0}, {'a', 1, 3693, 0}, {';', 0, 3694, 632}, {'f', 1, 3694, 0},
+    {'r', 1, 3695, 0}, {'u', 1, 3696, 0}, {'e', 1, 3697, 0}, {';', 0, 3698, 639}, {';', 0, 3698, 640}, {'r', 1, 3698, 0},
+    {'t', 1, 3699, 0}, {';', 0, 3700, 645}, {'i', 1, 3700, 0}, {';', 0, 3701, 649}, {'a', 1, 3701, 0}, {'f', 1, 3702, 0},
+    {'p', 1, 3703, 0}, {'h', 1, 3704, 0}, {'c', 1, 3705, 0}, {'l', 1, 3706, 0}, {';', 0, 3707, 658}, {';', 0, 3707, 659},
+    {'a', 1, 3707, 0}, {'d', 1, 3708, 0}, {'s', 1, 3709, 0}, {'v', 1, 3710, 0}, {';', 0, 3711, 664}, {'e', 1, 3711, 0},
+    {'l', 1, 3712, 0}, {'m', 1, 3713, 0}, {'r', 1, 3714, 0}, {'s', 2, 3715, 0}, {'z', 1, 3717, 0}, {'o', 1, 3718, 0},
+    {'f', 1, 3719, 0}, {';', 0, 3720, 685}, {'c', 1, 3720, 0}, {';', 0, 3721, 687}, {'d', 1, 3721, 0}, {'s', 1, 3722, 0},
+    {'r', 1, 3723, 0}, {'n', 1, 3724, 0}, {'r', 1, 3725, 0}, {';', 0, 3726, 695}, {'m', 1, 3726, 0}, {'l', 1, 3727, 0},
+    {'l', 1, 3728, 700}, {'o', 1, 3729, 0}, {'n', 1, 3730, 0}, {'t', 1, 3731, 0}, {'k', 4, 3732, 0}, {'v', 1, 3736, 0},
+    {'w', 1, 3737, 0}, {'k', 2, 3738, 0}, {'n', 1, 3740, 0}, {';', 0, 3741, 716}, {'u', 1, 3741, 0}, {'a', 1, 3742, 0},
+    {'p', 1, 3743, 0}, {'s', 1, 3744, 0}, {'n', 1, 3745, 0}, {'a', 1, 3746, 0}, {'h', 1, 3747, 0}, {'w', 1, 3748, 0},
+    {';', 0, 3749, 726}, {'c', 3, 3749, 0}, {'o', 3, 3752, 0}, {'s', 2, 3755, 0}, {'t', 1, 3757, 0}, {'u', 1, 3758, 0},
+    {'v', 1, 3759, 0}, {'w', 1, 3760, 0}, {'r', 1, 3761, 0}, {'c', 1, 3762, 0}, {'n', 1, 3763, 0}, {'1', 2, 3764, 0},
+    {'3', 1, 3766, 0}, {'c', 1, 3767, 0}, {';', 0, 3768, 752}, {'q', 1, 3768, 0}, {'t', 1, 3769, 0}, {'f', 1, 3770, 0},
+    {';', 0, 3771, 756}, {'t', 1, 3771, 0}, {'t', 1, 3772, 0}, {'D', 4, 3773, 0}, {'H', 5, 3777, 0}, {'U', 4, 3782, 0},
+    {'V', 7, 3786, 0}, {'b', 1, 3793, 0}, {'d', 4, 3794, 0}, {'h', 5, 3798, 0}, {'m', 1, 3803, 0}, {'p', 1, 3804, 0},
+    {'t', 1, 3805, 0}, {'u', 4, 3806, 0}, {'v', 7, 3810, 0}, {'i', 1, 3817, 0}, {'v', 1, 3818, 0}, {'b', 1, 3819, 0},
+    {'r', 1, 3820, 0}, {'m', 1, 3821, 0}, {'m', 2, 3822, 0}, {'l', 3, 3824, 0}, {'l', 2, 3827, 0}, {'p', 3, 3829, 0},
+    {'u', 1, 3832, 0}, {';', 0, 3833, 821}, {'a', 1, 3833, 0}, {'b', 1, 3834, 0}, {'c', 2, 3835, 0}, {'d', 1, 3837, 0},
+    {'s', 1, 3838, 0}, {'e', 1, 3839, 0}, {'o', 1, 3840, 0}, {'p', 1, 3841, 0}, {'r', 1, 3842, 0}, {'d', 1, 3843, 0},
+    {'r', 1, 3844, 0}, {'p', 1, 3845, 0}, {'t', 1, 3846, 0}, {'i', 1, 3847, 0}, {'p', 1, 3848, 0}, {'t', 2, 3849, 841},
+    {';', 0, 3851, 844}, {'y', 1, 3851, 0}, {'c', 1, 3852, 0}, {';', 0, 3853, 848}, {';', 0, 3853, 849}, {'E', 1, 3853, 0},
+    {'c', 3, 3854, 0}, {'e', 1, 3857, 0}, {'f', 1, 3858, 0}, {'m', 1, 3859, 0}, {'s', 1, 3860, 0}, {'b', 1, 3861, 0},
+    {'o', 1, 3862, 0}, {'m', 1, 3863, 0}, {'p', 3, 3864, 0}, {'g', 2, 3867, 0}, {'i', 1, 3869, 0}, {'f', 1, 3870, 0},
+    {'r', 1, 3871, 0}, {'y', 2, 3872, 880}, {'r', 1, 3874, 0}, {'s', 1, 3875, 0}, {'r', 1, 3876, 0}, {'b', 2, 3877, 0},
+    {'p', 2, 3879, 0}, {'o', 1, 3881, 0}, {'a', 1, 3882, 0}, {'p', 1, 3883, 0}, {'s', 1, 3884, 0}, {'a', 1, 3885, 0},
+    {';', 0, 3886, 897}, {'b', 1, 3886, 0}, {'c', 2, 3887, 0}, {'d', 1, 3889, 0}, {'o', 1, 3890, 0}, {'s', 1, 3891, 0},
+    {'a', 1, 3892, 0}, {'l', 1, 3893, 0}, {'r', 1, 3894, 0}, {'v', 1, 3895, 0}, {'e', 1, 3896, 0}, {'e', 1, 3897, 0},
+    {'o', 1, 3898, 0}, {'n', 1, 3899, 0}, {'c', 1, 3900, 0}, {'r', 1, 3901, 0}, {'r', 1, 3902, 0}, {'g', 1, 3903, 0},
+    {'e', 1, 3904, 0}, {'r', 1, 3905, 0}, {'h', 2, 3906, 0}, {'a', 1, 3908, 0}, {'a', 1, 3909, 0}, {'r', 1, 3910, 0},
+    {';', 0, 3911, 929}, {'g', 1, 3911, 0}, {'r', 1, 3912, 0}, {'t', 1, 3913, 0}, {';', 0, 3914, 935}, {'t', 1, 3914, 0},
+    {'p', 1, 3915, 0}, {'s', 1, 3916, 0}, {';', 0, 3917, 939}, {'r', 2, 3917, 0}, {'m', 3, 3919, 0}, {';', 0, 3922, 946},
+    {'a', 1, 3922, 0}, {'i', 1, 3923, 0}, {';', 0, 3924, 949}, {'i', 1, 3924, 0}, {'o', 1, 3925, 0}, {'y', 1, 3926, 0},
+    {'o', 1, 3927, 0}, {'r', 1, 3928, 0}, {'l', 1, 3929, 0}, {'f', 1, 3930, 0}, {';', 0, 3931, 959}, {'e', 1, 3931, 0},
+    {'m', 1, 3932, 0}, {'p', 1, 3933, 0}, {'s', 1, 3934, 0}, {'b', 1, 3935, 0}, {'n', 3, 3936, 0}, {'k', 1, 3939, 0},
+    {'o', 1, 3940, 0}, {'r', 1, 3941, 0}, {'r', 1, 3942, 0}, {'y', 1, 3943, 0}, {'l', 1, 3944, 0}, {'r', 1, 3945, 0},
+    {'o', 1, 3946, 0}, {'i', 2, 3947, 0}, {'r', 1, 3949, 0}, {'a', 1, 3950, 0}, {'n', 1, 3951, 0}, {'y', 1, 3952, 0},
+    {'g', 1, 3953, 0}, {'o', 1, 3954, 0}, {'t', 1, 3955, 0}, {'u', 1, 3956, 0}, {'t', 1, 3957, 0}, {'r', 1, 3958, 0},
+    {'r', 2, 3959, 0}, {'l', 1, 3961, 0}, {';', 0, 3962, 995}, {'t', 1, 3962, 0}, {'o', 1, 3963, 0}, {';', 0, 3964, 999},
+    {'a', 1, 3964, 0}, {';', 0, 3965, 1003}, {'d', 1, 3965, 0}, {'n', 1, 3966, 0}, {';', 0, 3967, 1007}, {';', 0, 3967, 1008},
+    {'d', 1, 3967, 0}, {'c', 1, 3968, 0}, {'t', 1, 3969, 0}, {'p', 2, 3970, 0}, {';', 0, 3972, 1017}, {'p', 1, 3972, 0},
+    {'o', 1, 3973, 0}, {'f', 1, 3974, 0}, {'r', 2, 3975, 0}, {'u', 1, 3977, 0}, {'i', 3, 3978, 0}, {'i', 1, 3981, 0},
+    {'o', 1, 3982, 0}, {'i', 1, 3983, 0}, {'l', 1, 3984, 0}, {'a', 1, 3985, 0}, {'e', 1, 3986, 0}, {'i', 1, 3987, 0},
+    {'p', 1, 3988, 0}, {'o', 1, 3989, 0}, {'r', 1, 3990, 0}, {'r', 1, 3991, 0}, {'o', 1, 3992, 0}, {'m', 1, 3993, 0},
+    {';', 0, 3994, 1042}, {';', 0, 3994, 1044}, {'l', 1, 3994, 1045}, {'o', 1, 3995, 0}, {'l', 1, 3996, 0}, {'s', 1, 3997, 0},
+    {'e', 1, 3998, 0}, {'o', 1, 3999, 0}, {'l', 1, 4000, 0}, {';', 0, 4001, 1053}, {'a', 1, 4001, 0}, {'l', 1, 4002, 0},
+    {'i', 1, 4003, 0}, {'l', 1, 4004, 0}, {';', 0, 4005, 1058}, {'i', 1, 4005, 0}, {'i', 1, 4006, 0}, {'t', 1, 4007, 0},
+    {'i', 1, 4008, 0}, {'n', 1, 4009, 0}, {'f', 1, 4010, 0}, {'f', 1, 4011, 0}, {'a', 1, 4012, 0}, {'k', 2, 4013, 0},
+    {'r', 1, 4015, 0}, {'c', 6, 4016, 0}, {'s', 1, 4022, 0}, {'w', 1, 4023, 0}, {'r', 1, 4024, 0}, {';', 0, 4025, 1092},
+    {'u', 1, 4025, 0}, {'m', 1, 4026, 0}, {';', 0, 4027, 1096}, {'e', 1, 4027, 0}, {'r', 1, 4028, 0}, {';', 0, 4029, 1099},
+    {'t', 1, 4029, 0}, {';', 0, 4030, 1102}, {';', 0, 4030, 1103}, {'q', 1, 4030, 0}, {'s', 1, 4031, 0}, {';', 0, 4032, 1106},
+    {'c', 1, 4032, 0}, {'d', 1, 4033, 0}, {'l', 2, 4034, 0}, {';', 0, 4036, 1113}, {';', 0, 4036, 1115}, {'e', 1, 4036, 0},
+    {'y', 1, 4037, 0}, {';', 0, 4038, 1119}, {';', 0, 4038, 1120}, {';', 0, 4038, 1121}, {';', 0, 4038, 1122}, {'p', 2, 4038, 0},
+    {';', 0, 4040, 1125}, {'q', 2, 4040, 0}, {'i', 1, 4042, 0}, {'f', 1, 4043, 0}, {'v', 1, 4044, 0}, {'r', 1, 4045, 0},
+    {'m', 3, 4046, 0}, {'c', 1, 4049, 0}, {'i', 1, 4050, 0}, {'o', 1, 4051, 0}, {'P', 1, 4052, 0}, {'u', 1, 4053, 0},
+    {'a', 2, 4054, 0}, {'d', 1, 4056, 0}, {'e', 1, 4057, 0}, {'l', 1, 4058, 0}, {'s', 1, 4059, 0}, {'r', 1, 4060, 0},
+    {'E', 1, 4061, 0}, {'r', 1, 4062, 0}, {'r', 1, 4063, 0}, {'f', 1, 4064, 0}, {'i', 1, 4065, 0}, {'d', 1, 4066, 0},
+    {'r', 3, 4067, 0}, {'r', 1, 4070, 0}, {'r', 1, 4071, 0}, {'r', 1, 4072, 0}, {'l', 1, 4073, 0}, {'c', 1, 4074, 0},
+    {';', 0, 4075, 1165}, {'e', 1, 4075, 0}, {'w', 1, 4076, 0}, {'r', 1, 4077, 0}, {'t', 1, 4078, 0}, {'k', 2, 4079, 0},
+    {'f', 1, 4081, 0}, {'b', 1, 4082, 0}, {'r', 1, 4083, 0}, {'a', 1, 4084, 0}, {'r', 1, 4085, 0}, {'u', 1, 4086, 0},
+    {'h', 1, 4087, 0}, {'u', 1, 4088, 0}, {'r', 1, 4089, 0}, {';', 0, 4090, 1184}, {'y', 1, 4090, 0}, {'c', 1, 4091, 0},
+    {';', 0, 4092, 1188}, {';', 0, 4092, 1189}, {'a', 1, 4092, 0}, {'i', 1, 4093, 0}, {'n', 1, 4094, 0}, {'f', 1, 4095, 0},
+    {'t', 1, 4096, 0}, {'i', 1, 4097, 0}, {'c', 1, 4098, 0}, {'g', 3, 4099, 0}, {'t', 1, 4102, 0}, {'f', 1, 4103, 0},
+    {'e', 1, 4104, 0}, {'a', 1, 4105, 0}, {'i', 1, 4106, 0}, {'d', 1, 4107, 0}, {';', 0, 4108, 1210}, {'c', 1, 4108, 0},
+    {'e', 2, 4109, 0}, {'l', 1, 4111, 0}, {'p', 1, 4112, 0}, {'y', 1, 4113, 0}, {'o', 1, 4114, 0}, {'f', 1, 4115, 0},
+    {'a', 1, 4116, 0}, {'o', 1, 4117, 0}, {'e', 1, 4118, 0}, {'r', 1, 4119, 0}, {'n', 5, 4120, 0}, {'l', 1, 4125, 0},
+    {'c', 1, 4126, 0}, {'l', 1, 4127, 1233}, {'r', 1, 4128, 0}, {';', 0, 4129, 1236}, {';', 0, 4129, 1237}, {'t', 1, 4129, 0},
+    {'f', 1, 4130, 0}, {'r', 1, 4131, 0}, {'r', 1, 4132, 0}, {'c', 1, 4133, 0}, {'p', 1, 4134, 0}, {'d', 1, 4135, 0},
+    {';', 0, 4136, 1246}, {';', 0, 4136, 1247}, {'e', 1, 4136, 0}, {'y', 1, 4137, 0}, {'y', 1, 4138, 0}, {'f', 1, 4139, 0},
+    {'r', 1, 4140, 0}, {'r', 1, 4141, 0}, {'r', 1, 4142, 0}, {'a', 1, 4143, 0}, {'r', 1, 4144, 0}, {';', 0, 4145, 1258},
+    {'r', 1, 4145, 0}, {'u', 1, 4146, 0}, {'m', 1, 4147, 0}, {'r', 1, 4148, 0}, {'b', 1, 4149, 0}, {'g', 3, 4150, 0},
+    {';', 0, 4153, 1267}, {'u', 1, 4153, 0}, {'r', 8, 4154, 0}, {';', 0, 4162, 1279}, {'a', 1, 4162, 0}, {'e', 2, 4163, 0},
+    {'r', 1, 4165, 0}, {'r', 1, 4166, 0}, {'a', 1, 4167, 0}, {'k', 2, 4168, 0}, {'r', 1, 4170, 0}, {'d', 1, 4171, 0},
+    {'i', 1, 4172, 0}, {'b', 1, 4173, 0}, {';', 0, 4174, 1294}, {'a', 1, 4174, 0}, {'u', 1, 4175, 0}, {'d', 1, 4176, 0},
+    {'u', 1, 4177, 0}, {'h', 1, 4178, 0}, {'t', 5, 4179, 0}, {';', 0, 4184, 1312}, {';', 0, 4184, 1313}, {'q', 1, 4184, 0},
+    {'s', 1, 4185, 0}, {';', 0, 4186, 1316}, {'c', 1, 4186, 0}, {'d', 1, 4187, 0}, {'g', 2, 4188, 0}, {'s', 5, 4190, 0},
+    {'s', 1, 4195, 0}, {'o', 1, 4196, 0}, {';', 0, 4197, 1331}, {';', 0, 4197, 1333}, {'r', 2, 4197, 0}, {'l', 1, 4199, 0},
+    {'y', 1, 4200, 0}, {'r', 1, 4201, 0}, {'o', 1, 4202, 0}, {'a', 1, 4203, 0}, {'r', 1, 4204, 0}, {'d', 1, 4205, 0},
+    {'u', 1, 4206, 0}, {';', 0, 4207, 1347}, {'p', 2, 4207, 0}, {';', 0, 4209, 1350}, {'q', 2, 4209, 0}, {'i', 1, 4211, 0},
+    {'n', 1, 4212, 0}, {'r', 1, 4213, 0}, {'r', 1, 4214, 0}, {'g', 3, 4215, 0}, {'p', 1, 4218, 0}, {'a', 1, 4219, 0},
+    {'f', 1, 4220, 0}, {'l', 1, 4221, 0}, {'i', 1, 4222, 0}, {'a', 1, 4223, 0}, {'b', 1, 4224, 0}, {';', 0, 4225, 1369},
+    {'e', 1, 4225, 0}, {'f', 1, 4226, 0}, {'r', 2, 4227, 0}, {'r', 1, 4229, 0}, {'o', 1, 4230, 0}, {'a', 1, 4231, 0},
+    {';', 0, 4232, 1378}, {'r', 1, 4232, 0}, {'q', 1, 4233, 0}, {'r', 1, 4234, 0}, {';', 0, 4235, 1382}, {'m', 3, 4235, 0},
+    {'b', 1, 4238, 0}, {'u', 1, 4239, 0}, {'r', 1, 4240, 0}, {'c', 1, 4241, 0}, {'i', 1, 4242, 0}, {'o', 1, 4243, 0},
+    {'r', 1, 4244, 0}, {'m', 1, 4245, 0}, {'a', 1, 4246, 0}, {'u', 1, 4247, 0}, {'P', 1, 4248, 0}, {'i', 3, 4249, 0},
+    {'d', 1, 4252, 0}, {'u', 1, 4253, 0}, {'r', 1, 4254, 0}, {'E', 1, 4255, 0}, {'o', 1, 4256, 0}, {'r', 1, 4257, 1408},
+    {'e', 1, 4258, 0}, {'t', 2, 4259, 0}, {';', 0, 4261, 1413}, {'s', 1, 4261, 0}, {'k', 1, 4262, 0}, {'m', 1, 4263, 0},
+    {';', 0, 4264, 1420}, {'s', 1, 4264, 0}, {'s', 1, 4265, 0}, {';', 0, 4266, 1423}, {';', 0, 4266, 1424}, {'r', 1, 4266, 0},
+    {';', 0, 4267, 1427}, {'a', 1, 4267, 0}, {'c', 1, 4268, 0}, {'d', 1, 4269, 0}, {'u', 1, 4270, 0}, {'p', 1, 4271, 0},
+    {'r', 1, 4272, 0}, {'l', 1, 4273, 0}, {'e', 1, 4274, 0}, {'f', 1, 4275, 0}, {'r', 1, 4276, 0}, {'p', 1, 4277, 0},
+    {'t', 1, 4278, 0}, {'a', 1, 4279, 0}, {';', 0, 4280, 1447}, {';', 0, 4280, 1448}, {'v', 1, 4280, 0}, {'f', 1, 4281, 0},
+    {';', 0, 4282, 1452}, {';', 0, 4282, 1453}, {'v', 1, 4282, 0}, {'g', 1, 4283, 0}, {'a', 1, 4284, 0}, {'a', 1, 4285, 0},
+    {'l', 1, 4286, 0}, {'u', 1, 4287, 0}, {'g', 1, 4288, 0}, {';', 0, 4289, 1461}, {'E', 1, 4289, 0}, {'i', 1, 4290, 0},
+    {'o', 1, 4291, 0}, {'p', 1, 4292, 0}, {'u', 1, 4293, 0}, {'p', 1, 4294, 1469}, {'m', 1, 4295, 0}, {'p', 1, 4296, 0},
+    {'r', 1, 4297, 0}, {'d', 1, 4298, 0}, {'n', 1, 4299, 0}, {'p', 1, 4300, 0}, {';', 0, 4301, 1479}, {'s', 1, 4301, 0},
+    {'r', 1, 4302, 0}, {'r', 2, 4303, 0}, {'o', 1, 4305, 0}, {'u', 1, 4306, 0}, {'e', 1, 4307, 0}, {'i', 1, 4308, 0},
+    {'i', 1, 4309, 0}, {';', 0, 4310, 1492}, {';', 0, 4310, 1493}, {';', 0, 4310, 1494}, {'q', 3, 4310, 0}, {'s', 1, 4313, 0},
+    {'i', 1, 4314, 0}, {';', 0, 4315, 1500}, {'r', 1, 4315, 0}, {'r', 1, 4316, 0}, {'r', 1, 4317, 0}, {'a', 1, 4318, 0},
+    {';', 0, 4319, 1506}, {'d', 1, 4319, 0}, {';', 0, 4320, 1508}, {'y', 1, 4320, 0}, {'r', 1, 4321, 0}, {';', 0, 4322, 1511},
+    {'r', 1, 4322, 0}, {'r', 1, 4323, 0}, {';', 0, 4324, 1514}, {'f', 1, 4324, 0}, {'q', 3, 4325, 0}, {'s', 2, 4328, 0},
+    {'i', 1, 4330, 0}, {';', 0, 4331, 1523}, {'r', 1, 4331, 0}, {'d', 1, 4332, 0}, {'f', 1, 4333, 0}, {';', 0, 4334, 1529},
+    {'i', 1, 4334, 0}, {'n', 1, 4335, 0}, {'r', 4, 4336, 0}, {'l', 1, 4340, 0}, {';', 0, 4341, 1545}, {'c', 1, 4341, 0},
+    {'e', 2, 4342, 0}, {'r', 1, 4344, 0}, {'r', 1, 4345, 0}, {'g', 1, 4346, 0}, {'r', 1, 4347, 0}, {';', 0, 4348, 1557},
+    {'c', 1, 4348, 0}, {'e', 1, 4349, 0}, {'r', 1, 4350, 0}, {'o', 1, 4351, 0}, {'m', 2, 4352, 0}, {'i', 1, 4354, 0},
+    {'a', 1, 4355, 0}, {'s', 1, 4356, 0}, {'b', 4, 4357, 0}, {'c', 1, 4361, 0}, {'p', 4, 4362, 0}, {'l', 1, 4366, 0},
+    {'l', 1, 4367, 0}, {'g', 1, 4368, 0}, {'i', 1, 4369, 0}, {';', 0, 4370, 1593}, {'e', 1, 4370, 0}, {'s', 1, 4371, 0},
+    {'a', 1, 4372, 0}, {'a', 1, 4373, 0}, {'p', 1, 4374, 0}, {'a', 1, 4375, 0}, {'e', 1, 4376, 0}, {'t', 1, 4377, 0},
+    {'n', 1, 4378, 0}, {'A', 1, 4379, 0}, {'e', 1, 4380, 0}, {'t', 2, 4381, 0}, {'A', 1, 4383, 0}, {'t', 1, 4384, 0},
+    {'i', 1, 4385, 0}, {'r', 1, 4386, 0}, {'r', 2, 4387, 0}, {'e', 1, 4389, 0}, {'u', 1, 4390, 0}, {'t', 1, 4391, 0},
+    {'r', 2, 4392, 0}, {';', 0, 4394, 1622}, {'s', 1, 4394, 0}, {'l', 1, 4395, 0}, {'v', 1, 4396, 0}, {'t', 1, 4397, 0},
+    {'o', 1, 4398, 0}, {'i', 1, 4399, 0}, {'i', 1, 4400, 0}, {';', 0, 4401, 1630}, {'n', 1, 4401, 0}, {'a', 1, 4402, 0},
+    {';', 0, 4403, 1634}, {'a', 1, 4403, 0}, {';', 0, 4404, 1636}, {'t', 1, 4404, 0}, {'r', 1, 4405, 0}, {'i', 1, 4406, 0},
+    {'r', 1, 4407, 0}, {'n', 1, 4408, 0}, {';', 0, 4409, 1642}, {'c', 1, 4409, 0}, {'g', 1, 4410, 0}, {'c', 1, 4411, 0},
+    {'d', 1, 4412, 0}, {'n', 1, 4413, 0}, {'f', 1, 4414, 0}, {'r', 1, 4415, 0}, {'r', 1, 4416, 0}, {'u', 1, 4417, 0},
+    {'r', 1, 4418, 0}, {';', 0, 4419, 1654}, {'e', 1, 4419, 0}, {'f', 1, 4420, 1657}, {'m', 1, 4421, 1659}, {'g', 1, 4422, 0},
+    {'r', 1, 4423, 0}, {'l', 1, 4424, 0}, {';', 0, 4425, 1664}, {'r', 1, 4425, 0}, {'a', 1, 4426, 0}, {'l', 1, 4427, 0},
+    {'l', 1, 4428, 0}, {'m', 1, 4429, 0}, {'l', 1, 4430, 1673}, {'a', 1, 4431, 0}, {';', 0, 4432, 1676}, {'a', 2, 4432, 1677},
+    {'s', 2, 4434, 0}, {'t', 1, 4436, 0}, {';', 0, 4437, 1683}, {'c', 1, 4437, 0}, {'i', 1, 4438, 0}, {'m', 1, 4439, 0},
+    {'p', 1, 4440, 0}, {'t', 1, 4441, 0}, {';', 0, 4442, 1689}, {';', 0, 4442, 1690}, {'v', 1, 4442, 0}, {'m', 1, 4443, 0},
+    {'n', 1, 4444, 0}, {'c', 1, 4445, 0}, {';', 0, 4446, 1696}, {'n', 2, 4446, 0}, {'s', 9, 4448, 0}, {'n', 1, 4457, 0},
+    {'f', 1, 4458, 0}, {'n', 1, 4459, 0}, {';', 0, 4460, 1717}, {'p', 1, 4460, 0}, {'u', 1, 4461, 0}, {';', 0, 4462, 1720},
+    {'c', 6, 4462, 0}, {'m', 1, 4468, 0}, {'E', 1, 4469, 0}, {'a', 1, 4470, 0}, {'s', 1, 4471, 0}, {'d', 1, 4472, 0},
+    {'f', 3, 4473, 0}, {'p', 2, 4476, 0}, {'i', 1, 4478, 0}, {'r', 1, 4479, 0}, {'r', 1, 4480, 0}, {';', 0, 4481, 1743},
+    {'c', 1, 4481, 0}, {';', 0, 4482, 1745}, {'t', 1, 4482, 0}, {'f', 1, 4483, 0}, {'i', 1, 4484, 0}, {'r', 1, 4485, 0},
+    {'t', 2, 4486, 0}, {'s', 1, 4488, 0}, {'t', 1, 4489, 1754}, {'r', 1, 4490, 0}, {'r', 1, 4491, 0}, {'a', 1, 4492, 0},
+    {'r', 1, 4493, 0}, {'r', 1, 4494, 0}, {'e', 1, 4495, 0}, {'u', 1, 4496, 0}, {'i', 1, 4497, 0}, {'m', 1, 4498, 0},
+    {'g', 4, 4499, 0}, {'u', 1, 4503, 0}, {'r', 11, 4504, 0}, {'a', 1, 4515, 0}, {'i', 1, 4516, 0}, {'r', 1, 4517, 0},
+    {'r', 1, 4518, 0}, {'a', 1, 4519, 0}, {'k', 2, 4520, 0}, {'r', 1, 4522, 0}, {'d', 1, 4523, 0}, {'i', 1, 4524, 0},
+    {'b', 1, 4525, 0}, {';', 0, 4526, 1797}, {'a', 1, 4526, 0}, {'d', 1, 4527, 0}, {'u', 1, 4528, 0}, {'h', 1, 4529, 0},
+    {'l', 4, 4530, 0}, {'t', 1, 4534, 0}, {';', 0, 4535, 1809}, {'s', 1, 4535, 0}, {'o', 1, 4536, 0}, {';', 0, 4537, 1812},
+    {'r', 2, 4537, 0}, {';', 0, 4539, 1816}, {'v', 1, 4539, 0}, {'h', 1, 4540, 0}, {'g', 1, 4541, 0}, {'i', 1, 4542, 0},
+    {'r', 1, 4543, 0}, {'a', 1, 4544, 0}, {';', 0, 4545, 1831}, {'u', 1, 4545, 0}, {'i', 1, 4546, 0}, {'n', 1, 4547, 0},
+    {'r', 1, 4548, 0}, {'r', 1, 4549, 0}, {'a', 1, 4550, 0}, {'f', 1, 4551, 0}, {'l', 1, 4552, 0}, {'i', 1, 4553, 0},
+    {'r', 2, 4554, 0}, {'o', 1, 4556, 0}, {'r', 1, 4557, 0}, {'q', 1, 4558, 0}, {'r', 1, 4559, 0}, {';', 0, 4560, 1848},
+    {'b', 1, 4560, 0}, {'u', 1, 4561, 0}, {'r', 1, 4562, 0}, {'m', 1, 4563, 0}, {'i', 4, 4564, 0}, {'u', 1, 4568, 0},
+    {'u', 1, 4569, 0}, {'u', 1, 4570, 0}, {';', 0, 4571, 1863}, {'p', 1, 4571, 0}, {'r', 1, 4572, 0}, {'u', 1, 4573, 0},
+    {';', 0, 4574, 1867}, {'d', 1, 4574, 0}, {'r', 1, 4575, 0}, {'E', 1, 4576, 0}, {'a', 1, 4577, 0}, {'s', 1, 4578, 0},
+    {'o', 1, 4579, 0}, {'i', 1, 4580, 0}, {';', 0, 4581, 1875}, {'t', 3, 4581, 0}, {'r', 1, 4584, 0}, {'r', 2, 4585, 0},
+    {'t', 1, 4587, 1883}, {'i', 1, 4588, 0}, {'w', 1, 4589, 0}, {'m', 2, 4590, 0}, {'t', 1, 4592, 0}, {';', 0, 4593, 1890},
+    {'o', 1, 4593, 0}, {'r', 1, 4594, 0}, {'h', 1, 4595, 0}, {'y', 1, 4596, 0}, {'r', 1, 4597, 0}, {';', 0, 4598, 1898},
+    {'m', 1, 4598, 0}, {';', 0, 4599, 1902}, {'d', 1, 4599, 0}, {'e', 2, 4600, 0}, {'g', 2, 4602, 0}, {'l', 2, 4604, 0},
+    {'n', 1, 4606, 0}, {'p', 1, 4607, 0}, {'r', 1, 4608, 0}, {'r', 1, 4609, 0}, {'l', 1, 4610, 0}, {'s', 1, 4611, 0},
+    {'p', 1, 4612, 0}, {'d', 1, 4613, 0}, {'l', 1, 4614, 0}, {';', 0, 4615, 1919}, {'e', 2, 4615, 0}, {'t', 1, 4617, 0},
+    {';', 0, 4618, 1923}, {'b', 2, 4618, 0}, {'f', 1, 4620, 0}, {'d', 1, 4621, 0}, {'r', 1, 4622, 0}, {'a', 1, 4623, 0},
+    {'u', 1, 4624, 0}, {'u', 2, 4625, 0}, {';', 0, 4627, 1942}, {'a', 1, 4627, 0}, {'f', 1, 4628, 0}, {'r', 1, 4629, 0},
+    {'r', 1, 4630, 0}, {'t', 1, 4631, 0}, {'i', 1, 4632, 0}, {'a', 1, 4633, 0}, {'r', 2, 4634, 0}, {'a', 1, 4636, 0},
+    {'n', 1, 4637, 0}, {';', 0, 4638, 1956}, {'E', 1, 4638, 0}, {'d', 1, 4639, 0}, {'e', 2, 4640, 0}, {'m', 1, 4642, 0},
+    {'n', 2, 4643, 0}, {'p', 1, 4645, 0}, {'r', 1, 4646, 0}, {'s', 3, 4647, 0}, {'c', 6, 4650, 0}, {';', 0, 4656, 1982},
+    {'g', 1, 4656, 0}, {'1', 1, 4657, 1984}, {'2', 1, 4658, 1986}, {'3', 1, 4659, 1988}, {';', 0, 4660, 1990}, {'E', 1, 4660, 0},
+    {'d', 2, 4661, 0}, {'e', 2, 4663, 0}, {'h', 1, 4665, 0}, {'l', 1, 4666, 0}, {'m', 1, 4667, 0}, {'n', 2, 4668, 0},
+    {'p', 1, 4670, 0}, {'s', 3, 4671, 0}, {'r', 1, 4674, 0}, {'r', 2, 4675, 0}, {'w', 1, 4677, 0}, {'i', 1, 4678, 0},
+    {'g', 1, 4679, 0}, {';', 0, 4680, 2019}, {'k', 1, 4680, 0}, {'r', 1, 4681, 0}, {'d', 1, 4682, 0}, {';', 0, 4683, 2023},
+    {'t', 1, 4683, 0}, {'r', 1, 4684, 0}, {';', 0, 4685, 2026}, {'r', 1, 4685, 0}, {'t', 1, 4686, 0}, {'c', 1, 4687, 0},
+    {'n', 1, 4688, 0}, {'a', 1, 4689, 0}, {'s', 1, 4690, 0}, {'r', 1, 4691, 0}, {'d', 1, 4692, 0}, {'e', 1, 4693, 0},
+    {'t', 1, 4694, 0}, {'a', 1, 4695, 0}, {';', 0, 4696, 2047}, {'b', 1, 4696, 0}, {'c', 1, 4697, 0}, {'f', 2, 4698, 0},
+    {'a', 1, 4700, 0}, {'i', 1, 4701, 0}, {'d', 1, 4702, 0}, {'a', 1, 4703, 0}, {'d', 1, 4704, 0}, {'e', 1, 4705, 0},
+    {'m', 1, 4706, 0}, {'p', 1, 4707, 0}, {'s', 1, 4708, 0}, {'t', 1, 4709, 0}, {'e', 1, 4710, 0}, {'r', 1, 4711, 0},
+    {'y', 1, 4712, 0}, {'c', 1, 4713, 0}, {'r', 1, 4714, 0}, {'x', 1, 4715, 0}, {'h', 1, 4716, 0}, {'r', 1, 4717, 0},
+    {'r', 1, 4718, 0}, {'u', 1, 4719, 0}, {'r', 1, 4720, 0}, {'c', 1, 4721, 0}, {'e', 1, 4722, 0}, {'r', 1, 4723, 0},
+    {';', 0, 4724, 2085}, {'r', 1, 4724, 0}, {'l', 1, 4725, 0}, {'a', 1, 4726, 0}, {'s', 1, 4727, 0}, {';', 0, 4728, 2090},
+    {'a', 1, 4728, 0}, {'r', 2, 4729, 0}, {'l', 1, 4731, 0}, {'o', 1, 4732, 0}, {'r', 1, 4733, 0}, {'r', 1, 4734, 0},
+    {'c', 1, 4735, 0}, {';', 0, 4736, 2102}, {'o', 1, 4736, 0}, {'f', 1, 4737, 0}, {'r', 1, 4738, 0}, {'o', 1, 4739, 0},
+    {'a', 1, 4740, 0}, {'u', 1, 4741, 0}, {'i', 3, 4742, 0}, {'p', 1, 4745, 0}, {'o', 1, 4746, 0}, {'r', 1, 4747, 0},
+    {'n', 1, 4748, 0}, {'r', 1, 4749, 0}, {'r', 1, 4750, 0}, {'o', 1, 4751, 0}, {'l', 1, 4752, 0}, {'i', 2, 4753, 0},
+    {'r', 1, 4755, 0}, {'l', 1, 4756, 2125}, {'n', 1, 4757, 0}, {'r', 1, 4758, 0}, {'r', 2, 4759, 0}, {'s', 1, 4761, 0},
+    {'g', 1, 4762, 0}, {'e', 1, 4763, 0}, {'k', 1, 4764, 0}, {'n', 1, 4765, 0}, {'p', 3, 4766, 0}, {'r', 2, 4769, 0},
+    {'s', 2, 4771, 0}, {'t', 2, 4773, 0}, {';', 0, 4775, 2149}, {'s', 1, 4775, 0}, {';', 0, 4776, 2151}, {'b', 1, 4776, 0},
+    {'e', 1, 4777, 0}, {'l', 1, 4778, 0}, {'b', 1, 4779, 0}, {'t', 1, 4780, 0}, {';', 0, 4781, 2157}, {'r', 1, 4781, 0},
+    {'u', 2, 4782, 0}, {'f', 1, 4784, 0}, {'o', 1, 4785, 0}, {'r', 1, 4786, 0}, {'r', 1, 4787, 0}, {'b', 1, 4788, 0},
+    {'p', 1, 4789, 0}, {'g', 1, 4790, 0}, {'r', 1, 4791, 0}, {'b', 1, 4792, 0}, {'g', 1, 4793, 0}, {'e', 1, 4794, 0},
+    {';', 0, 4795, 2175}, {'f', 1, 4795, 0}, {'a', 1, 4796, 0}, {'r', 1, 4797, 0}, {'p', 1, 4798, 0}, {'r', 1, 4799, 0},
+    {'p', 1, 4800, 0}, {'r', 1, 4801, 0}, {';', 0, 4802, 2185}, {'r', 1, 4802, 0}, {'r', 1, 4803, 0}, {'r', 1, 4804, 0},
+    {'r', 1, 4805, 0}, {'p', 1, 4806, 0}, {'s', 1, 4807, 0}, {'o', 1, 4808, 0}, {'f', 1, 4809, 0}, {'l', 1, 4810, 0},
+    {'i', 1, 4811, 0}, {'r', 1, 4812, 0}, {'r', 1, 4813, 0}, {'r', 1, 4814, 0}, {'c', 1, 4815, 0}, {'l', 1, 4816, 0},
+    {'r', 1, 4817, 0}, {'e', 1, 4818, 0}, {'d', 1, 4819, 0}, {'u', 1, 4820, 0}, {'y', 1, 4821, 0}, {'r', 1, 4822, 0},
+    {';', 0, 4823, 2209}, {';', 0, 4823, 2211}, {';', 0, 4823, 2212}, {'y', 1, 4823, 0}, {'f', 1, 4824, 0}, {'r', 1, 4825, 0},
+    {'y', 1, 4826, 0}, {'l', 1, 4827, 2217}, {'u', 1, 4828, 0}, {'r', 1, 4829, 0}, {';', 0, 4830, 2221}, {'t', 1, 4830, 0},
+    {'t', 1, 4831, 0}, {'a', 1, 4832, 0}, {';', 0, 4833, 2225}, {'y', 1, 4833, 0}, {'r', 1, 4834, 0}, {'f', 1, 4835, 0},
+    {'r', 1, 4836, 0}, {';', 0, 4837, 2230}, {'j', 1, 4837, 0}, {'g', 1, 4838, 1}, {'t', 1, 4839, 0}, {'v', 1, 4840, 0},
+    {'c', 1, 4841, 8}, {'v', 1, 4842, 0}, {'a', 1, 4843, 0}, {'r', 1, 4844, 0}, {'n', 1, 4845, 0}, {';', 0, 4846, 18},
+    {'y', 1, 4846, 0}, {'g', 1, 4847, 20}, {';', 0, 4848, 22}, {'g', 1, 4848, 0}, {'d', 1, 4849, 0}, {';', 0, 4850, 27},
+    {'s', 1, 4850, 0}, {';', 0, 4851, 29}, {'e', 1, 4851, 0}, {'u', 1, 4852, 0}, {'o', 1, 4853, 0}, {';', 0, 4854, 34},
+    {';', 0, 4854, 36}, {'e', 1, 4854, 0}, {';', 0, 4855, 38}, {'e', 1, 4855, 0}, {';', 0, 4856, 40}, {';', 0, 4856, 42},
+    {'t', 1, 4856, 0}, {'t', 1, 4857, 0}, {'e', 1, 4858, 0}, {'o', 1, 4859, 0}, {'i', 1, 4860, 0}, {'c', 1, 4861, 0},
+    {'i', 1, 4862, 0}, {';', 0, 4863, 52}, {'l', 1, 4863, 0}, {'e', 1, 4864, 0}, {'l', 1, 4865, 0}, {'k', 1, 4866, 0},
+    {'e', 1, 4867, 0}, {'n', 2, 4868, 0}, {'r', 1, 4870, 0}, {'n', 1, 4871, 0}, {'o', 1, 4872, 0}, {';', 0, 4873, 69},
+    {'o', 1, 4873, 0}, {'t', 1, 4874, 0}, {'s', 1, 4875, 0}, {';', 0, 4876, 73}, {'a', 1, 4876, 0}, {'r', 1, 4877, 0},
+    {';', 0, 4878, 78}, {';', 0, 4878, 79}, {';', 0, 4878, 80}, {'e', 1, 4878, 0}, {';', 0, 4879, 82}, {'v', 1, 4879, 0},
+    {'o', 1, 4880, 0}, {'a', 1, 4881, 0}, {'r', 1, 4882, 0}, {'o', 1, 4883, 0}, {'e', 1, 4884, 0}, {';', 0, 4885, 96},
+    {'o', 1, 4885, 0}, {'q', 1, 4886, 0}, {'l', 1, 4887, 0}, {'A', 1, 4888, 0}, {'B', 1, 4889, 0}, {'L', 1, 4890, 0},
+    {'R', 1, 4891, 0}, {'T', 1, 4892, 0}, {'a', 1, 4893, 0}, {';', 0, 4894, 128}, {'o', 1, 4894, 0}, {'t', 1, 4895, 0},
+    {'o', 1, 4896, 0}, {'c', 1, 4897, 136}, {';', 0, 4898, 139}, {'v', 1, 4898, 0}, {'e', 1, 4899, 0}, {'r', 1, 4900, 0},
+    {'y', 2, 4901, 0}, {'n', 1, 4903, 0}, {';', 0, 4904, 148}, {'l', 1, 4904, 0}, {'l', 2, 4905, 0}, {'l', 1, 4907, 0},
+    {';', 0, 4908, 153}, {';', 0, 4908, 154}, {';', 0, 4908, 157}, {'t', 1, 4908, 0}, {'n', 1, 4909, 0}, {'e', 1, 4910, 0},
+    {';', 0, 4911, 164}, {'l', 1, 4911, 0}, {'i', 1, 4912, 0}, {';', 0, 4913, 167}, {';', 0, 4913, 168}, {'a', 2, 4913, 0},
+    {'v', 1, 4915, 0}, {'i', 1, 4916, 0}, {'c', 1, 4917, 0}, {';', 0, 4918, 177}, {';', 0, 4918, 180}, {'t', 1, 4918, 0},
+    {';', 0, 4919, 188}, {'c', 1, 4919, 0}, {'k', 1, 4920, 0}, {'c', 1, 4921, 0}, {'e', 1, 4922, 0}, {';', 0, 4923, 196},
+    {'z', 1, 4923, 0}, {';', 0, 4924, 198}, {'o', 1, 4924, 0}, {'D', 1, 4925, 0}, {'E', 1, 4926, 0}, {';', 0, 4927, 202},
+    {'g', 1, 4927, 0}, {';', 0, 4928, 204}, {'t', 1, 4928, 0}, {'c', 1, 4929, 207}, {';', 0, 4930, 210}, {'v', 1, 4930, 0},
+    {'r', 1, 4931, 0}, {'i', 1, 4932, 0}, {'i', 1, 4933, 0}, {'g', 1, 4934, 0}, {'r', 1, 4935, 0}, {'s', 1, 4936, 0},
+    {'n', 1, 4937, 0}, {';', 0, 4938, 224}, {';', 0, 4938, 225}, {';', 0, 4938, 226}, {'d', 1, 4938, 0}, {'y', 1, 4939, 0},
+    {';', 0, 4940, 230}, {'c', 1, 4940, 0}, {';', 0, 4941, 234}, {';', 0, 4941, 235}, {'c', 1, 4941, 0}, {'y', 1, 4942, 0},
+    {';', 0, 4943, 238}, {';', 0, 4943, 239}, {'a', 1, 4943, 0}, {'i', 1, 4944, 0}, {';', 0, 4945, 244}, {';', 0, 4945, 245},
+    {';', 0, 4945, 246}, {'t', 1, 4945, 0}, {'d', 1, 4946, 0}, {';', 0, 4947, 251}, {'a', 1, 4947, 0}, {';', 0, 4948, 253},
+    {'o', 1, 4948, 0}, {'i', 1, 4949, 0}, {'A', 2, 4950, 0}, {'C', 1, 4952, 0}, {'D', 1, 4953, 0}, {'F', 1, 4954, 0},
+    {'R', 1, 4955, 0}, {'T', 2, 4956, 0}, {'U', 1, 4958, 0}, {'V', 1, 4959, 0}, {'a', 1, 4960, 0}, {'r', 1, 4961, 0},
+    {'E', 1, 4962, 0}, {'F', 1, 4963, 0}, {'G', 1, 4964, 0}, {'L', 1, 4965, 0}, {'S', 1, 4966, 0}, {'T', 1, 4967, 0},
+    {'t', 1, 4968, 0}, {'o', 1, 4969, 0}, {'L', 1, 4970, 0}, {'R', 1, 4971, 0}, {'l', 1, 4972, 0}, {'r', 1, 4973, 0},
+    {';', 0, 4974, 299}, {'r', 2, 4974, 0}, {';', 0, 4976, 302}, {'o', 1, 4976, 0}, {'u', 1, 4977, 0}, {'i', 1, 4978, 0},
+    {'s', 1, 4979, 0}, {';', 0, 4980, 312}, {';', 0, 4980, 313}, {';', 0, 4980, 315}, {'t', 1, 4980, 0}, {'o', 1, 4981, 0},
+    {'i', 1, 4982, 0}, {'t', 1, 4983, 0}, {'e', 1, 4984, 0}, {'i', 1, 4985, 0}, {'e', 1, 4986, 0}, {'r', 1, 4987, 0},
+    {';', 0, 4988, 330}, {'o', 1, 4988, 0}, {'u', 1, 4989, 0}, {'o', 1, 4990, 0}, {'l', 1, 4991, 0}, {'q', 1, 4992, 0},
+    {'x', 1, 4993, 0}, {'r', 1, 4994, 0}, {'u', 1, 4995, 0}, {'e', 2, 4996, 0}, {'e', 1, 4998, 0}, {'r', 1, 4999, 0},
+    {'e', 1, 5000, 0}, {'i', 1, 5001, 0}, {'q', 1, 5002, 0}, {'u', 3, 5003, 0}, {'i', 1, 5006, 0}, {'e', 1, 5007, 0},
+    {';', 0, 5008, 383}, {'d', 1, 5008, 0}, {'g', 1, 5009, 0}, {'t', 1, 5010, 0}, {'c', 1, 5011, 390}, {'a', 1, 5012, 0},
+    {'v', 1, 5013, 0}, {'r', 1, 5014, 0}, {'a', 1, 5015, 0}, {'r', 1, 5016, 0}, {';', 0, 5017, 400}, {'C', 1, 5017, 0},
+    {';', 0, 5018, 404}, {'s', 1, 5018, 0}, {'d', 1, 5019, 0}, {'e', 1, 5020, 0}, {';', 0, 5021, 411}, {'B', 2, 5021, 0},
+    {'P', 1, 5023, 0}, {'i', 1, 5024, 0}, {'M', 1, 5025, 0}, {'c', 1, 5026, 0}, {';', 0, 5027, 423}, {'e', 1, 5027, 0},
+    {'e', 1, 5028, 0}, {'u', 1, 5029, 0}, {'o', 1, 5030, 0}, {';', 0, 5031, 433}, {';', 0, 5031, 436}, {';', 0, 5031, 438},
+    {';', 0, 5031, 439}, {'r', 1, 5031, 0}, {'t', 1, 5032, 0}, {';', 0, 5033, 444}, {';', 0, 5033, 445}, {'t', 1, 5033, 0},
+    {'o', 1, 5034, 0}, {'i', 1, 5035, 0}, {'r', 1, 5036, 0}, {'t', 8, 5037, 0}, {';', 0, 5045, 479}, {'d', 1, 5045, 0},
+    {'h', 1, 5046, 0}, {';', 0, 5047, 482}, {'D', 1, 5047, 0}, {'c', 1, 5048, 0}, {';', 0, 5049, 486}, {'c', 1, 5049, 0},
+    {'t', 1, 5050, 0}, {'o', 1, 5051, 0}, {'i', 1, 5052, 0}, {'c', 1, 5053, 0}, {'t', 4, 5054, 0}, {'a', 1, 5058, 0},
+    {'l', 1, 5059, 0}, {';', 0, 5060, 501}, {';', 0, 5060, 502}, {'r', 1, 5060, 0}, {';', 0, 5061, 510}, {';', 0, 5061, 511},
+    {'e', 1, 5061, 0}, {'e', 1, 5062, 0}, {'T', 1, 5063, 0}, {'r', 1, 5064, 0}, {'e', 1, 5065, 0}, {'N', 1, 5066, 525},
+    {'E', 1, 5067, 0}, {'y', 1, 5068, 0}, {';', 0, 5069, 529}, {'o', 1, 5069, 0}, {'i', 1, 5070, 0}, {'e', 1, 5071, 0},
+    {'a', 1, 5072, 0}, {'k', 1, 5073, 0}, {'S', 1, 5074, 0}, {'e', 4, 5075, 0}, {';', 0, 5079, 544}, {'l', 1, 5079, 0},
+    {';', 0, 5080, 546}, {'o', 1, 5080, 0}, {'t', 1, 5081, 0}, {';', 0, 5082, 550}, {'o', 1, 5082, 0}, {'y', 1, 5083, 0},
+    {'v', 1, 5084, 0}, {'c', 1, 5085, 554}, {'a', 1, 5086, 0}, {'v', 1, 5087, 0}, {'r', 1, 5088, 0}, {'r', 2, 5089, 0},
+    {'n', 2, 5091, 0}, {'n', 1, 5093, 0}, {';', 0, 5094, 569}, {'r', 1, 5094, 0}, {'w', 1, 5095, 0}, {'u', 1, 5096, 0},
+    {'e', 2, 5097, 0}, {'r', 1, 5099, 0}, {'w', 1, 5100, 0}, {'r', 2, 5101, 0}, {';', 0, 5103, 581}, {'l', 1, 5103, 0},
+    {'g', 1, 5104, 0}, {';', 0, 5105, 584}, {'d', 1, 5105, 0}, {';', 0, 5106, 587}, {'h', 1, 5106, 0}, {';', 0, 5107, 589},
+    {'h', 2, 5107, 0}, {'a', 1, 5109, 0}, {';', 0, 5110, 595}, {'i', 1, 5110, 0}, {'T', 1, 5111, 0}, {';', 0, 5112, 602},
+    {';', 0, 5112, 603}, {'s', 1, 5112, 0}, {'c', 1, 5113, 0}, {'e', 1, 5114, 0}, {';', 0, 5115, 608}, {';', 0, 5115, 609},
+    {';', 0, 5115, 612}, {';', 0, 5115, 613}, {';', 0, 5115, 614}, {';', 0, 5115, 615}, {';', 0, 5115, 616}, {'t', 1, 5115, 0},
+    {'c', 1, 5116, 0}, {';', 0, 5117, 622}, {';', 0, 5117, 623}, {';', 0, 5117, 624}, {';', 0, 5117, 625}, {'t', 1, 5117, 0},
+    {'o', 1, 5118, 0}, {';', 0, 5119, 629}, {'W', 1, 5119, 0}, {';', 0, 5120, 631}, {';', 0, 5120, 633}, {';', 0, 5120, 634},
+    {'t', 1, 5120, 0}, {'v', 1, 5121, 0}, {'c', 1, 5122, 641}, {'e', 1, 5123, 643}, {'g', 1, 5124, 646}, {'v', 1, 5125, 0},
+    {'s', 1, 5126, 0}, {'h', 1, 5127, 0}, {'a', 1, 5128, 0}, {'r', 1, 5129, 0}, {'g', 1, 5130, 0}, {'n', 1, 5131, 0},
+    {';', 0, 5132, 661}, {'l', 1, 5132, 0}, {';', 0, 5133, 663}, {';', 0, 5133, 665}, {'e', 1, 5133, 0}, {'s', 1, 5134, 0},
+    {'t', 2, 5135, 0}, {'p', 1, 5137, 0}, {'t', 1, 5138, 0}, {'a', 1, 5139, 0}, {'n', 1, 5140, 0}, {';', 0, 5141, 683},
+    {'i', 1, 5141, 0}, {';', 0, 5142, 688}, {';', 0, 5142, 689}, {'o', 1, 5142, 0}, {'g', 1, 5143, 692}, {';', 0, 5144, 694},
+    {'p', 2, 5144, 0}, {'d', 1, 5146, 0}, {';', 0, 5147, 701}, {'n', 1, 5147, 0}, {'t', 1, 5148, 0}, {';', 0, 5149, 704},
+    {'c', 1, 5149, 0}, {'e', 1, 5150, 0}, {'p', 1, 5151, 0}, {'s', 1, 5152, 0}, {'e', 1, 5153, 0}, {'e', 1, 5154, 0},
+    {';', 0, 5155, 713}, {'t', 1, 5155, 0}, {'g', 1, 5156, 0}, {'o', 1, 5157, 0}, {'u', 1, 5158, 0}, {'t', 1, 5159, 0},
+    {'i', 1, 5160, 0}, {'o', 1, 5161, 0}, {';', 0, 5162, 723}, {';', 0, 5162, 724}, {'e', 1, 5162, 0}, {'a', 1, 5163, 0},
+    {'i', 1, 5164, 0}, {'u', 1, 5165, 0}, {'d', 1, 5166, 0}, {'p', 1, 5167, 0}, {'t', 1, 5168, 0}, {'q', 1, 5169, 0},
+    {'t', 1, 5170, 0}, {'r', 1, 5171, 0}, {'p', 1, 5172, 0}, {'e', 1, 5173, 0}, {'e', 1, 5174, 0}, {'o', 1, 5175, 0},
+    {'k', 3, 5176, 0}, {'k', 1, 5179, 0}, {'2', 1, 5180, 0}, {'4', 1, 5181, 0}, {'4', 1, 5182, 0}, {'k', 1, 5183, 0},
+    {'u', 1, 5184, 0}, {';', 0, 5185, 754}, {';', 0, 5185, 755}, {'o', 1, 5185, 0}, {'i', 1, 5186, 0}, {'L', 1, 5187, 0},
+    {'R', 1, 5188, 0}, {'l', 1, 5189, 0}, {'r', 1, 5190, 0}, {';', 0, 5191, 763}, {'D', 1, 5191, 0}, {'U', 1, 5192, 0},
+    {'d', 1, 5193, 0}, {'u', 1, 5194, 0}, {'L', 1, 5195, 0}, {'R', 1, 5196, 0}, {'l', 1, 5197, 0}, {'r', 1, 5198, 0},
+    {';', 0, 5199, 772}, {'H', 1, 5199, 0}, {'L', 1, 5200, 0}, {'R', 1, 5201, 0}, {'h', 1, 5202, 0}, {'l', 1, 5203, 0},
+    {'r', 1, 5204, 0}, {'o', 1, 5205, 0}, {'L', 1, 5206, 0}, {'R', 1, 5207, 0}, {'l', 1, 5208, 0}, {'r', 1, 5209, 0},
+    {';', 0, 5210, 784}, {'D', 1, 5210, 0}, {'U', 1, 5211, 0}, {'d', 1, 5212, 0}, {'u', 1, 5213, 0}, {'i', 1, 5214, 0},
+    {'l', 1, 5215, 0}, {'i', 1, 5216, 0}, {'L', 1, 5217, 0}, {'R', 1, 5218, 0}, {'l', 1, 5219, 0}, {'r', 1, 5220, 0},
+    {';', 0, 5221, 796}, {'H', 1, 5221, 0}, {'L', 1, 5222, 0}, {'R', 1, 5223, 0}, {'h', 1, 5224, 0}, {'l', 1, 5225, 0},
+    {'r', 1, 5226, 0}, {'m', 1, 5227, 0}, {'e', 1, 5228, 0}, {'a', 1, 5229, 0}, {';', 0, 5230, 807}, {'i', 1, 5230, 0},
+    {';', 0, 5231, 809}, {'e', 1, 5231, 0}, {';', 0, 5232, 811}, {'b', 1, 5232, 0}, {'h', 1, 5233, 0}, {';', 0, 5234, 814},
+    {'e', 1, 5234, 0}, {';', 0, 5235, 816}, {'E', 1, 5235, 0}, {'e', 2, 5236, 0}, {'t', 1, 5238, 0}, {'n', 1, 5239, 0},
+    {'r', 1, 5240, 0}, {'a', 1, 5241, 0}, {'u', 1, 5242, 0}, {'o', 1, 5243, 0}, {';', 0, 5244, 827}, {'t', 1, 5244, 0},
+    {'n', 1, 5245, 0}, {'s', 1, 5246, 0}, {'o', 1, 5247, 0}, {'i', 1, 5248, 0}, {'c', 1, 5249, 0}, {'s', 2, 5250, 0},
+    {';', 0, 5252, 837}, {'l', 1, 5252, 838}, {'t', 1, 5253, 0}, {';', 0, 5254, 842}, {'e', 1, 5254, 0}, {';', 0, 5255, 845},
+    {'k', 2, 5255, 0}, {';', 0, 5257, 850}, {';', 0, 5257, 851}, {'e', 1, 5257, 0}, {'l', 1, 5258, 0}, {';', 0, 5259, 860},
+    {'n', 1, 5259, 0}, {'i', 1, 5260, 0}, {'c', 1, 5261, 0}, {'s', 2, 5262, 0}, {'n', 2, 5264, 0}, {'a', 2, 5266, 0},
+    {';', 0, 5268, 871}, {'f', 1, 5268, 0}, {'l', 1, 5269, 0}, {';', 0, 5270, 875}, {'d', 1, 5270, 0}, {'n', 1, 5271, 0},
+    {';', 0, 5272, 878}, {'o', 1, 5272, 0}, {';', 0, 5273, 881}, {'s', 1, 5273, 0}, {'r', 1, 5274, 0}, {'s', 1, 5275, 0},
+    {';', 0, 5276, 885}, {';', 0, 5276, 886}, {'e', 1, 5276, 0}, {';', 0, 5277, 888}, {'e', 1, 5277, 0}, {'t', 1, 5278, 0},
+    {'r', 1, 5279, 0}, {'r', 1, 5280, 0}, {'c', 1, 5281, 0}, {'r', 1, 5282, 0}, {'r', 1, 5283, 0}, {'a', 1, 5284, 0},
+    {'u', 1, 5285, 0}, {'o', 1, 5286, 0}, {'r', 1, 5287, 0}, {';', 0, 5288, 903}, {'r', 1, 5288, 0}, {'y', 3, 5289, 0},
+    {'e', 1, 5292, 0}, {'e', 1, 5293, 0}, {'e', 1, 5294, 0}, {'d', 1, 5295, 0}, {'n', 1, 5296, 0}, {'t', 1, 5297, 0},
+    {'t', 1, 5298, 0}, {';', 0, 5299, 919}, {';', 0, 5299, 920}, {'e', 1, 5299, 0}, {'t', 1, 5300, 0}, {';', 0, 5301, 923},
+    {';', 0, 5301, 924}, {'v', 1, 5301, 0}, {'r', 1, 5302, 0}, {'c', 1, 5303, 0}, {'o', 1, 5304, 0}, {'g', 1, 5305, 0},
+    {'r', 1, 5306, 0}, {'s', 1, 5307, 0}, {'a', 1, 5308, 0}, {'t', 1, 5309, 0}, {'h', 1, 5310, 0}, {'l', 1, 5311, 0},
+    {'r', 1, 5312, 0}, {';', 0, 5313, 942}, {'o', 1, 5313, 0}, {'s', 1, 5314, 0}, {'m', 1, 5315, 0}, {'n', 1, 5316, 0},
+    {'d', 1, 5317, 0}, {'n', 1, 5318, 0}, {';', 0, 5319, 954}, {'r', 1, 5319, 0}, {'o', 1, 5320, 0}, {'a', 1, 5321, 0},
+    {';', 0, 5322, 958}, {'q', 2, 5322, 0}, {'i', 1, 5324, 0}, {'l', 1, 5325, 0}, {'q', 1, 5326, 0}, {'l', 1, 5327, 0},
+    {'a', 1, 5328, 0}, {'d', 1, 5329, 0}, {'h', 1, 5330, 0}, {'a', 1, 5331, 0}, {'r', 1, 5332, 0}, {'o', 1, 5333, 0},
+    {';', 0, 5334, 973}, {';', 0, 5334, 974}, {';', 0, 5334, 975}, {'o', 1, 5334, 0}, {'t', 1, 5335, 0}, {';', 0, 5336, 978},
+    {'f', 1, 5336, 0}, {'r', 1, 5337, 0}, {'r', 1, 5338, 0}, {'g', 1, 5339, 0}, {';', 0, 5340, 983}, {'r', 1, 5340, 0},
+    {'t', 1, 5341, 0}, {';', 0, 5342, 986}, {'t', 1, 5342, 0}, {'e', 1, 5343, 0}, {'o', 1, 5344, 0}, {';', 0, 5345, 991},
+    {'c', 1, 5345, 992}, {'o', 1, 5346, 0}, {';', 0, 5347, 996}, {'t', 1, 5347, 0}, {'v', 1, 5348, 0}, {'o', 1, 5349, 0},
+    {'t', 1, 5350, 0}, {'o', 1, 5351, 0}, {'r', 1, 5352, 0}, {'y', 3, 5353, 0}, {'1', 2, 5356, 0}, {';', 0, 5358, 1016},
+    {';', 0, 5358, 1018}, {'n', 1, 5358, 0}, {';', 0, 5359, 1020}, {';', 0, 5359, 1021}, {'s', 1, 5359, 0}, {'s', 1, 5360, 0},
+    {';', 0, 5361, 1024}, {'l', 1, 5361, 0}, {'v', 1, 5362, 0}, {'r', 1, 5363, 0}, {'l', 1, 5364, 0}, {'m', 1, 5365, 0},
+    {'a', 1, 5366, 0}, {'l', 1, 5367, 0}, {'s', 1, 5368, 0}, {'v', 2, 5369, 0}, {'a', 1, 5371, 0}, {'t', 1, 5372, 0},
+    {'r', 1, 5373, 0}, {';', 0, 5374, 1039}, {'t', 1, 5374, 0}, {';', 0, 5375, 1041}, {';', 0, 5375, 1046}, {';', 0, 5375, 1047},
+    {';', 0, 5375, 1048}, {'t', 1, 5375, 0}, {'c', 1, 5376, 0}, {'n', 1, 5377, 0}, {'i', 1, 5378, 0}, {'l', 1, 5379, 0},
+    {'i', 1, 5380, 0}, {'g', 1, 5381, 0}, {'i', 1, 5382, 0}, {'g', 1, 5383, 0}, {'g', 1, 5384, 0}, {';', 0, 5385, 1061},
+    {'g', 1, 5385, 0}, {'s', 1, 5386, 0}, {';', 0, 5387, 1064}, {';', 0, 5387, 1065}, {'l', 1, 5387, 0}, {';', 0, 5388, 1067},
+    {'v', 1, 5388, 0}, {'t', 1, 5389, 0}, {'1', 6, 5390, 0}, {'2', 2, 5396, 0}, {'3', 3, 5398, 0}, {'4', 1, 5401, 0},
+    {'5', 2, 5402, 0}, {'7', 1, 5404, 0}, {'l', 1, 5405, 0}, {'n', 1, 5406, 0}, {';', 0, 5407, 1090}, {'t', 1, 5407, 0},
+    {'a', 2, 5408, 0}, {'v', 1, 5410, 0}, {'c', 1, 5411, 0}, {';', 0, 5412, 1100}, {';', 0, 5412, 1104}, {'l', 1, 5412, 0},
+    {'c', 1, 5413, 0}, {'o', 1, 5414, 0}, {';', 0, 5415, 1111}, {'e', 1, 5415, 0}, {'l', 1, 5416, 0}, {';', 0, 5417, 1117},
+    {';', 0, 5417, 1123}, {'p', 1, 5417, 0}, {';', 0, 5418, 1126}, {'q', 1, 5418, 0}, {'m', 1, 5419, 0}, {';', 0, 5420, 1129},
+    {'e', 1, 5420, 0}, {';', 0, 5421, 1131}, {';', 0, 5421, 1132}, {'e', 1, 5421, 0}, {'l', 1, 5422, 0}, {';', 0, 5423, 1137},
+    {'r', 1, 5423, 0}, {'t', 1, 5424, 0}, {'a', 1, 5425, 0}, {'e', 1, 5426, 0}, {'p', 1, 5427, 0}, {'r', 1, 5428, 0},
+    {'o', 1, 5429, 0}, {'q', 2, 5430, 0}, {'e', 1, 5432, 0}, {'i', 1, 5433, 0}, {'t', 1, 5434, 0}, {';', 0, 5435, 1150},
+    {';', 0, 5435, 1151}, {'s', 1, 5435, 0}, {';', 0, 5436, 1153}, {'l', 1, 5436, 0}, {'c', 1, 5437, 0}, {';', 0, 5438, 1156},
+    {'c', 1, 5438, 0}, {'w', 1, 5439, 0}, {';', 0, 5440, 1159}, {'c', 1, 5440, 0}, {'t', 1, 5441, 0}, {'i', 1, 5442, 0},
+    {'o', 1, 5443, 0}, {'a', 1, 5444, 0}, {'a', 1, 5445, 0}, {'r', 1, 5446, 0}, {'h', 1, 5447, 0}, {'l', 1, 5448, 0},
+    {'r', 1, 5449, 0}, {';', 0, 5450, 1172}, {'a', 1, 5450, 0}, {';', 0, 5451, 1174}, {'s', 1, 5451, 0}, {'o', 1, 5452, 0},
+    {'l', 1, 5453, 0}, {'e', 1, 5454, 0}, {'t', 1, 5455, 0}, {'c', 1, 5456, 1182}, {';', 0, 5457, 1185}, {'l', 1, 5457, 1186},
+    {'v', 1, 5458, 0}, {'n', 1, 5459, 0}, {'t', 1, 5460, 0}, {'i', 1, 5461, 0}, {'a', 1, 5462, 0}, {'g', 1, 5463, 0},
+    {'r', 1, 5464, 0}, {'e', 1, 5465, 0}, {'l', 1, 5466, 0}, {'p', 1, 5467, 0}, {'h', 1, 5468, 0}, {';', 0, 5469, 1203},
+    {'d', 1, 5469, 0}, {'r', 1, 5470, 0}, {'n', 2, 5471, 0}, {'o', 1, 5473, 0}, {'a', 1, 5474, 0}, {'g', 1, 5475, 0},
+    {'r', 1, 5476, 0}, {'a', 1, 5477, 0}, {'r', 1, 5478, 0}, {';', 0, 5479, 1216}, {'n', 1, 5479, 0}, {';', 0, 5480, 1218},
+    {';', 0, 5480, 1219}, {'d', 1, 5480, 0}, {'s', 1, 5481, 0}, {';', 0, 5482, 1223}, {';', 0, 5482, 1224}, {'E', 1, 5482, 0},
+    {'d', 1, 5483, 0}, {'s', 2, 5484, 0}, {'v', 1, 5486, 0}, {'d', 1, 5487, 0}, {'y', 1, 5488, 0}, {';', 0, 5489, 1234},
+    {'c', 1, 5489, 0}, {'h', 1, 5490, 0}, {';', 0, 5491, 1239}, {';', 0, 5491, 1240}, {'c', 1, 5491, 0}, {'y', 1, 5492, 0},
+    {'a', 2, 5493, 0}, {'i', 1, 5495, 0}, {'e', 1, 5496, 0}, {';', 0, 5497, 1249}, {';', 0, 5497, 1250}, {';', 0, 5497, 1251},
+    {';', 0, 5497, 1252}, {'r', 1, 5497, 0}, {';', 0, 5498, 1254}, {'i', 1, 5498, 0}, {'r', 1, 5499, 0}, {';', 0, 5500, 1259},
+    {'t', 1, 5500, 0}, {'p', 1, 5501, 0}, {'a', 1, 5502, 0}, {'d', 1, 5503, 0}, {';', 0, 5504, 1264}, {'d', 1, 5504, 0},
+    {'l', 1, 5505, 0}, {'o', 1, 5506, 1268}, {';', 0, 5507, 1270}, {'b', 2, 5507, 0}, {'f', 1, 5509, 0}, {'h', 1, 5510, 0},
+    {'l', 1, 5511, 0}, {'p', 1, 5512, 0}, {'s', 1, 5513, 0}, {'t', 1, 5514, 0}, {'i', 1, 5515, 0}, {';', 0, 5516, 1281},
+    {'s', 1, 5516, 0}, {'r', 1, 5517, 0}, {'k', 1, 5518, 0}, {'c', 2, 5519, 0}, {'e', 1, 5521, 0}, {'s', 1, 5522, 0},
+    {'o', 1, 5523, 0}, {'i', 1, 5524, 0}, {'l', 1, 5525, 0}, {';', 0, 5526, 1293}, {';', 0, 5526, 1295}, {'o', 2, 5526, 0},
+    {'h', 1, 5528, 0}, {'s', 1, 5529, 0}, {';', 0, 5530, 1300}, {'a', 1, 5530, 0}, {'h', 1, 5531, 0}, {'l', 1, 5532, 0},
+    {'r', 1, 5533, 0}, {'t', 1, 5534, 0}, {';', 0, 5535, 1314}, {'l', 1, 5535, 0}, {'c', 1, 5536, 0}, {'o', 1, 5537, 0},
+    {';', 0, 5538, 1321}, {'e', 1, 5538, 0}, {'a', 1, 5539, 0}, {'d', 1, 5540, 0}, {'e', 1, 5541, 0}, {'g', 1, 5542, 0},
+    {'s', 1, 5543, 0}, {'h', 1, 5544, 0}, {'o', 1, 5545, 0}, {'d', 1, 5546, 0}, {'u', 2, 5547, 0}, {'k', 1, 5549, 0},
+    {';', 0, 5550, 1338}, {'r', 1, 5550, 0}, {'r', 1, 5551, 0}, {'r', 1, 5552, 0}, {'i', 1, 5553, 0}, {'o', 1, 5554, 0},
+    {'s', 1, 5555, 0}, {';', 0, 5556, 1348}, {'p', 1, 5556, 0}, {';', 0, 5557, 1351}, {'q', 1, 5557, 0}, {'m', 1, 5558, 0},
+    {'g', 1, 5559, 0}, {'r', 1, 5560, 0}, {'k', 1, 5561, 0}, {'l', 1, 5562, 0}, {'m', 1, 5563, 0}, {'r', 1, 5564, 0},
+    {'a', 1, 5565, 0}, {'r', 1, 5566, 0}, {';', 0, 5567, 1364}, {'u', 1, 5567, 0}, {'m', 1, 5568, 0}, {'s', 1, 5569, 0},
+    {'a', 1, 5570, 0}, {'n', 1, 5571, 0}, {';', 0, 5572, 1371}, {';', 0, 5572, 1372}, {'l', 1, 5572, 0}, {'r', 1, 5573, 0},
+    {'r', 1, 5574, 0}, {'r', 2, 5575, 0}, {'i', 1, 5577, 0}, {'u', 1, 5578, 0}, {';', 0, 5579, 1381}, {';', 0, 5579, 1383},
+    {'e', 1, 5579, 0}, {'g', 1, 5580, 0}, {';', 0, 5581, 1386}, {'o', 2, 5581, 0}, {'o', 1, 5583, 0}, {';', 0, 5584, 1392},
+    {'r', 1, 5584, 0}, {'t', 1, 5585, 0}, {'e', 1, 5586, 0}, {'e', 1, 5587, 0}, {'r', 1, 5588, 0}, {'e', 1, 5589, 0},
+    {'a', 1, 5590, 0}, {';', 0, 5591, 1400}, {'e', 1, 5591, 0}, {'f', 1, 5592, 0}, {'s', 1, 5593, 0}, {'h', 1, 5594, 0},
+    {'t', 1, 5595, 0}, {';', 0, 5596, 1406}, {'t', 1, 5596, 0}, {';', 0, 5597, 1409}, {';', 0, 5597, 1410}, {';', 0, 5597, 1411},
+    {'e', 1, 5597, 0}, {'t', 1, 5598, 0}, {'e', 1, 5599, 0}, {'m', 1, 5600, 0}, {'h', 1, 5601, 0}, {'u', 1, 5602, 0},
+    {'o', 1, 5603, 1425}, {'s', 1, 5604, 0}, {'i', 1, 5605, 0}, {'o', 1, 5606, 0}, {'s', 3, 5607, 0}, {';', 0, 5610, 1436},
+    {';', 0, 5610, 1437}, {'u', 1, 5610, 0}, {'l', 1, 5611, 0}, {';', 0, 5612, 1440}, {';', 0, 5612, 1442}, {'o', 1, 5612, 0},
+    {'i', 1, 5613, 0}, {'p', 1, 5614, 0}, {';', 0, 5615, 1449}, {'t', 2, 5615, 0}, {';', 0, 5617, 1454}, {'h', 1, 5617, 0},
+    {'s', 1, 5618, 0}, {'s', 1, 5619, 0}, {'a', 1, 5620, 0}, {'t', 1, 5621, 0}, {';', 0, 5622, 1460}, {';', 0, 5622, 1462},
+    {'d', 1, 5622, 0}, {'s', 1, 5623, 0}, {'r', 1, 5624, 0}, {'r', 2, 5625, 0}, {';', 0, 5627, 1470}, {'p', 2, 5627, 0},
+    {';', 0, 5629, 1473}, {'o', 1, 5629, 0}, {'i', 1, 5630, 0}, {'g', 2, 5631, 0}, {';', 0, 5633, 1478}, {'h', 1, 5633, 0},
+    {'r', 1, 5634, 0}, {'h', 1, 5635, 0}, {'r', 2, 5636, 0}, {'t', 1, 5638, 0}, {'i', 1, 5639, 0}, {'a', 1, 5640, 0},
+    {'m', 1, 5641, 0}, {'s', 1, 5642, 0}, {';', 0, 5643, 1495}, {'q', 1, 5643, 0}, {'s', 1, 5644, 0}, {';', 0, 5645, 1498},
+    {'m', 1, 5645, 0}, {';', 0, 5646, 1501}, {'r', 1, 5646, 0}, {'r', 1, 5647, 0}, {'r', 1, 5648, 0}, {';', 0, 5649, 1507},
+    {';', 0, 5649, 1509}, {'r', 1, 5649, 0}, {'r', 1, 5650, 0}, {';', 0, 5651, 1513}, {'t', 2, 5651, 0}, {';', 0, 5653, 1517},
+    {'q', 1, 5653, 0}, {'s', 1, 5654, 0}, {';', 0, 5655, 1520}, {'s', 1, 5655, 0}, {'m', 1, 5656, 0}, {'i', 2, 5657, 0},
+    {';', 0, 5659, 1526}, {';', 0, 5659, 1527}, {'n', 4, 5659, 0}, {'i', 2, 5663, 0}, {';', 0, 5665, 1540}, {'a', 1, 5665, 0},
+    {'s', 1, 5666, 0}, {'t', 1, 5667, 0}, {'i', 1, 5668, 0}, {'u', 1, 5669, 0}, {';', 0, 5670, 1547}, {'c', 2, 5670, 0},
+    {'r', 1, 5672, 0}, {'r', 3, 5673, 0}, {'h', 1, 5676, 0}, {'i', 2, 5677, 0}, {'u', 1, 5679, 0}, {';', 0, 5680, 1559},
+    {';', 0, 5680, 1560}, {'r', 1, 5680, 0}, {';', 0, 5681, 1563}, {'e', 2, 5681, 0}, {'d', 1, 5683, 0}, {'r', 1, 5684, 0},
+    {'u', 2, 5685, 0}, {';', 0, 5687, 1570}, {'E', 1, 5687, 0}, {'e', 1, 5688, 0}, {'s', 1, 5689, 0}, {'c', 2, 5690, 0},
+    {';', 0, 5692, 1578}, {'E', 1, 5692, 0}, {'e', 1, 5693, 0}, {'s', 1, 5694, 0}, {';', 0, 5695, 1584}, {'d', 1, 5695, 0},
+    {';', 0, 5696, 1587}, {'a', 1, 5696, 0}, {'r', 1, 5697, 0}, {'p', 1, 5698, 0}, {'s', 1, 5699, 0}, {'r', 1, 5700, 0},
+    {';', 0, 5701, 1598}, {'s', 1, 5701, 0}, {';', 0, 5702, 1600}, {';', 0, 5702, 1601}, {'f', 1, 5702, 0}, {'r', 1, 5703, 0},
+    {';', 0, 5704, 1604}, {';', 0, 5704, 1605}, {'r', 1, 5704, 0}, {'r', 1, 5705, 0}, {'r', 1, 5706, 0}, {'m', 1, 5707, 0},
+    {'r', 1, 5708, 0}, {'h', 1, 5709, 0}, {'r', 2, 5710, 0}, {'a', 1, 5712, 0}, {'t', 1, 5713, 0}, {';', 0, 5714, 1618},
+    {';', 0, 5714, 1619}, {'c', 1, 5714, 1620}, {'h', 1, 5715, 0}, {'a', 1, 5716, 0}, {';', 0, 5717, 1625}, {';', 0, 5717, 1626},
+    {'l', 1, 5717, 0}, {'g', 1, 5718, 0}, {'r', 1, 5719, 0}, {';', 0, 5720, 1631}, {'v', 1, 5720, 0}, {'r', 1, 5721, 0},
+    {';', 0, 5722, 1637}, {'r', 1, 5722, 0}, {'r', 1, 5723, 0}, {'o', 1, 5724, 0}, {'e', 1, 5725, 0}, {'r', 1, 5726, 0},
+    {'a', 1, 5727, 0}, {'r', 1, 5728, 0}, {';', 0, 5729, 1646}, {'u', 1, 5729, 0}, {';', 0, 5730, 1648}, {';', 0, 5730, 1649},
+    {'p', 1, 5730, 0}, {'s', 1, 5731, 0}, {'r', 1, 5732, 0}, {'r', 2, 5733, 0}, {';', 0, 5735, 1658}, {';', 0, 5735, 1660},
+    {'o', 1, 5735, 0}, {';', 0, 5736, 1662}, {'o', 1, 5736, 0}, {';', 0, 5737, 1665}, {'s', 1, 5737, 0}, {';', 0, 5738, 1668},
+    {'d', 1, 5738, 0}, {'e', 1, 5739, 0}, {';', 0, 5740, 1674}, {'r', 1, 5740, 0}, {';', 0, 5741, 1678}, {'l', 1, 5741, 0},
+    {'i', 1, 5742, 0}, {'l', 1, 5743, 0}, {';', 0, 5744, 1682}, {'n', 1, 5744, 0}, {'o', 1, 5745, 0}, {'i', 1, 5746, 0},
+    {';', 0, 5747, 1687}, {'e', 1, 5747, 0}, {';', 0, 5748, 1691}, {'a', 1, 5748, 0}, {'e', 1, 5749, 0}, {'h', 1, 5750, 0},
+    {'c', 1, 5751, 0}, {'k', 1, 5752, 0}, {';', 0, 5753, 1700}, {'a', 1, 5753, 0}, {'b', 1, 5754, 0}, {'c', 1, 5755, 0},
+    {'d', 2, 5756, 0}, {'e', 1, 5758, 0}, {'m', 1, 5759, 0}, {'s', 1, 5760, 0}, {'t', 1, 5761, 0}, {'t', 1, 5762, 0},
+    {';', 0, 5763, 1713}, {'d', 1, 5763, 1714}, {';', 0, 5764, 1718}, {'e', 1, 5764, 0}, {';', 0, 5765, 1721}, {'a', 1, 5765, 0},
+    {'c', 1, 5766, 0}, {'e', 1, 5767, 0}, {'n', 3, 5768, 0}, {'s', 1, 5771, 0}, {'e', 2, 5772, 0}, {';', 0, 5774, 1731},
+    {'p', 1, 5774, 0}, {'i', 1, 5775, 0}, {';', 0, 5776, 1734}, {'a', 1, 5776, 0}, {'l', 1, 5777, 0}, {'s', 1, 5778, 0},
+    {';', 0, 5779, 1738}, {'t', 1, 5779, 0}, {'m', 1, 5780, 0}, {'e', 1, 5781, 0}, {';', 0, 5782, 1742}, {'s', 1, 5782, 0},
+    {';', 0, 5783, 1746}, {';', 0, 5783, 1747}, {'m', 1, 5783, 0}, {';', 0, 5784, 1749}, {'e', 1, 5784, 0}, {'i', 1, 5785, 0},
+    {'t', 2, 5786, 0}, {';', 0, 5788, 1755}, {'r', 1, 5788, 0}, {';', 0, 5789, 1757}, {'i', 1, 5789, 0}, {'r', 1, 5790, 0},
+    {';', 0, 5791, 1760}, {';', 0, 5791, 1761}, {'t', 1, 5791, 0}, {'c', 1, 5792, 0}, {'p', 1, 5793, 0}, {';', 0, 5794, 1765},
+    {'d', 1, 5794, 0}, {'e', 1, 5795, 0}, {'l', 1, 5796, 0}, {'o', 1, 5797, 1769}, {';', 0, 5798, 1771}, {'a', 1, 5798, 0},
+    {'b', 2, 5799, 0}, {'c', 1, 5801, 0}, {'f', 1, 5802, 0}, {'h', 1, 5803, 0}, {'l', 1, 5804, 0}, {'p', 1, 5805, 0},
+    {'s', 1, 5806, 0}, {'t', 1, 5807, 0}, {'w', 1, 5808, 0}, {'i', 1, 5809, 0}, {'o', 2, 5810, 0}, {'r', 1, 5812, 0},
+    {'k', 1, 5813, 0}, {'c', 2, 5814, 0}, {'e', 1, 5816, 0}, {'s', 1, 5817, 0}, {'o', 1, 5818, 0}, {'i', 1, 5819, 0},
+    {'l', 1, 5820, 0}, {';', 0, 5821, 1796}, {';', 0, 5821, 1798}, {'h', 1, 5821, 0}, {'o', 2, 5822, 0}, {';', 0, 5824, 1802},
+    {';', 0, 5824, 1803}, {'i', 1, 5824, 0}, {'p', 1, 5825, 0}, {'s', 1, 5826, 0}, {';', 0, 5827, 1807}, {'h', 1, 5827, 0},
+    {'o', 1, 5828, 0}, {'d', 1, 5829, 0}, {'u', 2, 5830, 0}, {';', 0, 5832, 1817}, {'t', 6, 5832, 0}, {';', 0, 5838, 1827},
+    {'n', 1, 5838, 0}, {'r', 1, 5839, 0}, {'r', 1, 5840, 0}, {'s', 1, 5841, 0}, {'d', 1, 5842, 0}, {'g', 1, 5843, 0},
+    {'r', 1, 5844, 0}, {'k', 1, 5845, 0}, {'r', 1, 5846, 0}, {';', 0, 5847, 1839}, {'u', 1, 5847, 0}, {'m', 1, 5848, 0},
+    {';', 0, 5849, 1842}, {'g', 1, 5849, 0}, {'l', 1, 5850, 0}, {'r', 1, 5851, 0}, {'u', 1, 5852, 0}, {';', 0, 5853, 1847},
+    {';', 0, 5853, 1849}, {'o', 2, 5853, 0}, {'e', 1, 5855, 0}, {'e', 1, 5856, 0}, {';', 0, 5857, 1854}, {'e', 1, 5857, 0},
+    {'f', 1, 5858, 0}, {'l', 1, 5859, 0}, {'h', 1, 5860, 0}, {'t', 1, 5861, 0}, {'o', 1, 5862, 0}, {';', 0, 5863, 1864},
+    {'o', 1, 5863, 0}, {'e', 1, 5864, 0}, {'i', 1, 5865, 0}, {'c', 1, 5866, 0}, {';', 0, 5867, 1870}, {'p', 1, 5867, 0},
+    {'i', 1, 5868, 0}, {'l', 1, 5869, 0}, {'m', 1, 5870, 0}, {';', 0, 5871, 1876}, {'b', 1, 5871, 0}, {'e', 1, 5872, 0},
+    {'r', 1, 5873, 0}, {'h', 1, 5874, 0}, {'r', 2, 5875, 0}, {';', 0, 5877, 1884}, {';', 0, 5877, 1885}, {'a', 1, 5877, 0},
+    {'i', 1, 5878, 0}, {'n', 1, 5879, 0}, {';', 0, 5880, 1889}, {'w', 1, 5880, 0}, {'p', 1, 5881, 0}, {'c', 1, 5882, 0},
+    {';', 0, 5883, 1894}, {'t', 2, 5883, 0}, {'a', 3, 5885, 0}, {'o', 1, 5888, 0}, {';', 0, 5889, 1904}, {'q', 1, 5889, 0},
+    {';', 0, 5890, 1906}, {'E', 1, 5890, 0}, {';', 0, 5891, 1908}, {'E', 1, 5891, 0}, {'e', 1, 5892, 0}, {'l', 1, 5893, 0},
+    {'a', 1, 5894, 0}, {'r', 1, 5895, 0}, {'l', 1, 5896, 0}, {'h', 1, 5897, 0}, {'a', 1, 5898, 0}, {';', 0, 5899, 1917},
+    {'e', 1, 5899, 0}, {';', 0, 5900, 1920}, {'s', 1, 5900, 0}, {'c', 1, 5901, 0}, {';', 0, 5902, 1924}, {'a', 1, 5902, 0},
+    {';', 0, 5903, 1926}, {'e', 1, 5903, 0}, {';', 0, 5904, 1929}, {'p', 2, 5904, 0}, {'p', 2, 5906, 0}, {'b', 3, 5908, 0},
+    {'p', 3, 5911, 0}, {'r', 2, 5914, 0}, {';', 0, 5916, 1945}, {'r', 1, 5916, 0}, {';', 0, 5917, 1947}, {'m', 1, 5917, 0},
+    {'l', 1, 5918, 0}, {'r', 1, 5919, 0}, {';', 0, 5920, 1951}, {'f', 1, 5920, 0}, {'i', 1, 5921, 0}, {'s', 1, 5922, 0},
+    {';', 0, 5923, 1957}, {'o', 1, 5923, 0}, {';', 0, 5924, 1959}, {'d', 1, 5924, 0}, {'u', 1, 5925, 0}, {'E', 1, 5926, 0},
+    {'e', 1, 5927, 0}, {'l', 1, 5928, 0}, {'a', 1, 5929, 0}, {'e', 1, 5930, 0}, {'i', 1, 5931, 0}, {'u', 2, 5932, 0},
+    {';', 0, 5934, 1974}, {'a', 1, 5934, 0}, {'c', 1, 5935, 0}, {'e', 1, 5936, 0}, {'n', 3, 5937, 0}, {'s', 1, 5940, 0},
+    {';', 0, 5941, 1983}, {';', 0, 5941, 1985}, {';', 0, 5941, 1987}, {';', 0, 5941, 1989}, {';', 0, 5941, 1991}, {'o', 1, 5941, 0},
+    {'s', 1, 5942, 0}, {';', 0, 5943, 1994}, {'d', 1, 5943, 0}, {'s', 2, 5944, 0}, {'a', 1, 5946, 0}, {'u', 1, 5947, 0},
+    {'E', 1, 5948, 0}, {'e', 1, 5949, 0}, {'l', 1, 5950, 0}, {'e', 1, 5951, 0}, {'i', 1, 5952, 0}, {'u', 2, 5953, 0},
+    {'r', 1, 5955, 0}, {'h', 1, 5956, 0}, {'r', 2, 5957, 0}, {'a', 1, 5959, 0}, {'g', 1, 5960, 2016}, {'e', 1, 5961, 0},
+    {';', 0, 5962, 2020}, {'o', 1, 5962, 0}, {'i', 1, 5963, 0}, {';', 0, 5964, 2024}, {'e', 1, 5964, 0}, {'e', 2, 5965, 0},
+    {'a', 3, 5967, 0}, {'k', 2, 5970, 0}, {'s', 1, 5972, 0}, {'p', 1, 5973, 0}, {'i', 1, 5974, 0}, {'n', 1, 5975, 2037},
+    {'e', 1, 5976, 0}, {'s', 3, 5977, 2040}, {';', 0, 5980, 2045}, {';', 0, 5980, 2046}, {'o', 1, 5980, 0}, {'i', 1, 5981, 0},
+    {';', 0, 5982, 2050}, {'o', 1, 5982, 0}, {';', 0, 5983, 2052}, {'m', 1, 5983, 0}, {'e', 1, 5984, 0}, {'n', 1, 5985, 0},
+    {'o', 1, 5986, 0}, {';', 0, 5987, 2063}, {'i', 1, 5987, 0}, {'l', 1, 5988, 0}, {'b', 1, 5989, 0}, {'i', 1, 5990, 0},
+    {'z', 1, 5991, 0}, {';', 0, 5992, 2069}, {';', 0, 5992, 2070}, {'y', 1, 5992, 0}, {'o', 1, 5993, 0}, {'t', 1, 5994, 0},
+    {'e', 1, 5995, 0}, {';', 0, 5996, 2076}, {';', 0, 5996, 2077}, {'t', 1, 5996, 0}, {';', 0, 5997, 2080}, {'y', 1, 5997, 0},
+    {'v', 1, 5998, 0}, {'c', 1, 5999, 2083}, {'r', 1, 6000, 0}, {'a', 1, 6001, 0}, {'r', 1, 6002, 0}, {'h', 1, 6003, 0},
+    {'v', 1, 6004, 0}, {'l', 1, 6005, 0}, {'r', 1, 6006, 0}, {'k', 1, 6007, 0}, {'r', 1, 6008, 0}, {'o', 1, 6009, 0},
+    {'i', 1, 6010, 0}, {'r', 1, 6011, 0}, {'n', 1, 6012, 0}, {';', 0, 6013, 2104}, {'r', 1, 6013, 0}, {'w', 1, 6014, 0},
+    {'r', 1, 6015, 0}, {'s', 1, 6016, 0}, {';', 0, 6017, 2110}, {'h', 1, 6017, 0}, {'l', 1, 6018, 0}, {'a', 1, 6019, 0},
+    {'r', 1, 6020, 0}, {'o', 1, 6021, 0}, {'g', 1, 6022, 0}, {'i', 1, 6023, 0}, {';', 0, 6024, 2119}, {'t', 1, 6024, 0},
+    {'d', 1, 6025, 0}, {';', 0, 6026, 2122}, {'f', 1, 6026, 0}, {'r', 1, 6027, 0}, {';', 0, 6028, 2126}, {'g', 1, 6028, 0},
+    {';', 0, 6029, 2128}, {';', 0, 6029, 2129}, {'v', 1, 6029, 0}, {'h', 1, 6030, 0}, {'r', 1, 6031, 0}, {'p', 1, 6032, 0},
+    {'a', 1, 6033, 0}, {'o', 1, 6034, 0}, {'h', 1, 6035, 0}, {'i', 1, 6036, 0}, {'r', 1, 6037, 0}, {';', 0, 6038, 2139},
+    {'h', 1, 6038, 0}, {'i', 1, 6039, 0}, {'u', 2, 6040, 0}, {'h', 1, 6042, 0}, {'r', 1, 6043, 0}, {'h', 1, 6044, 0},
+    {'a', 1, 6045, 0}, {'q', 1, 6046, 0}, {'i', 1, 6047, 0}, {'a', 1, 6048, 0}, {';', 0, 6049, 2156}, {'i', 1, 6049, 0},
+    {'b', 1, 6050, 0}, {'p', 1, 6051, 0}, {';', 0, 6052, 2161}, {'p', 1, 6052, 0}, {'i', 1, 6053, 0}, {';', 0, 6054, 2164},
+    {'n', 2, 6054, 0}, {'n', 2, 6056, 0}, {'z', 1, 6058, 0}, {'c', 1, 6059, 0}, {'a', 1, 6060, 0}, {'e', 2, 6061, 0},
+    {'r', 1, 6063, 0}, {';', 0, 6064, 2176}, {'t', 1, 6064, 0}, {';', 0, 6065, 2180}, {';', 0, 6065, 2181}, {'c', 1, 6065, 0},
+    {';', 0, 6066, 2183}, {'i', 1, 6066, 0}, {'r', 1, 6067, 0}, {'r', 1, 6068, 0}, {'r', 1, 6069, 0}, {'r', 1, 6070, 0},
+    {';', 0, 6071, 2191}, {';', 0, 6071, 2192}, {'t', 1, 6071, 0}, {';', 0, 6072, 2194}, {'u', 1, 6072, 0}, {'m', 1, 6073, 0},
+    {'r', 1, 6074, 0}, {'r', 1, 6075, 0}, {';', 0, 6076, 2199}, {'u', 1, 6076, 0}, {'u', 1, 6077, 0}, {'i', 1, 6078, 0},
+    {';', 0, 6079, 2203}, {'g', 1, 6079, 0}, {'t', 1, 6080, 0}, {';', 0, 6081, 2207}, {'c', 1, 6081, 0}, {';', 0, 6082, 2213},
+    {';', 0, 6082, 2214}, {';', 0, 6082, 2215}, {';', 0, 6082, 2216}, {';', 0, 6082, 2218}, {'t', 1, 6082, 0}, {'o', 1, 6083, 0},
+    {';', 0, 6084, 2222}, {'r', 1, 6084, 0}, {';', 0, 6085, 2224}, {';', 0, 6085, 2226}, {'a', 1, 6085, 0}, {';', 0, 6086, 2228},
+    {';', 0, 6086, 2229}, {';', 0, 6086, 2231}, {';', 0, 6086, 2}, {'e', 1, 6086, 5}, {'e', 1, 6087, 0}, {';', 0, 6088, 9},
+    {'e', 1, 6088, 12}, {';', 0, 6089, 14}, {';', 0, 6089, 15}, {';', 0, 6089, 17}, {'F', 1, 6089, 0}, {';', 0, 6090, 21},
+    {'n', 1, 6090, 0}, {'e', 1, 6091, 24}, {'l', 1, 6092, 0}, {'d', 1, 6093, 0}, {'s', 1, 6094, 0}, {'u', 1, 6095, 0},
+    {';', 0, 6096, 37}, {'q', 1, 6096, 0}, {'e', 1, 6097, 0}, {'a', 1, 6098, 0}, {'y', 1, 6099, 0}, {'n', 1, 6100, 0},
+    {'l', 1, 6101, 48}, {';', 0, 6102, 50}, {'n', 1, 6102, 0}, {'l', 1, 6103, 0}, {'r', 1, 6104, 0}, {'e', 4, 6105, 0},
+    {'w', 1, 6109, 0}, {'C', 1, 6110, 0}, {';', 0, 6111, 64}, {'e', 1, 6111, 0}, {'u', 1, 6112, 0}, {'t', 1, 6113, 0},
+    {'u', 1, 6114, 0}, {'d', 1, 6115, 0}, {'e', 1, 6116, 0}, {';', 0, 6117, 72}, {'p', 1, 6117, 0}, {'a', 1, 6118, 0},
+    {'r', 1, 6119, 0}, {';', 0, 6120, 83}, {'n', 1, 6120, 0}, {';', 0, 6121, 87}, {'i', 1, 6121, 0}, {'n', 1, 6122, 0},
+    {'r', 1, 6123, 0}, {'t', 1, 6124, 0}, {'u', 1, 6125, 0}, {'e', 6, 6126, 0}, {'r', 1, 6132, 0}, {'r', 1, 6133, 0},
+    {'e', 1, 6134, 0}, {'i', 1, 6135, 0}, {'e', 1, 6136, 0}, {'r', 1, 6137, 0}, {'k', 1, 6138, 0}, {'e', 1, 6139, 133},
+    {'n', 1, 6140, 0}, {';', 0, 6141, 137}, {'e', 1, 6141, 141}, {'n', 1, 6142, 0}, {';', 0, 6143, 144}, {'S', 1, 6143, 0},
+    {'V', 1, 6144, 0}, {';', 0, 6145, 147}, {'o', 1, 6145, 0}, {';', 0, 6146, 150}, {'T', 1, 6146, 0}, {'i', 1, 6147, 0},
+    {'s', 1, 6148, 0}, {'e', 1, 6149, 0}, {'d', 2, 6150, 0}, {'l', 1, 6152, 0}, {'e', 1, 6153, 0}, {';', 0, 6154, 171},
+    {'d', 1, 6154, 0}, {'e', 1, 6155, 0}, {'l', 1, 6156, 0}, {';', 0, 6157, 175}, {'e', 1, 6157, 0}, {'y', 1, 6158, 0},
+    {';', 0, 6159, 191}, {';', 0, 6159, 193}, {'r', 1, 6159, 0}, {'o', 1, 6160, 0}, {'k', 1, 6161, 0}, {'o', 1, 6162, 0},
+    {'q', 1, 6163, 0}, {';', 0, 6164, 203}, {'e', 1, 6164, 205}, {';', 0, 6165, 208}, {'e', 1, 6165, 212}, {';', 0, 6166, 215},
+    {'n', 1, 6166, 0}, {'e', 1, 6167, 0}, {'r', 1, 6168, 0}, {'s', 1, 6169, 0}, {'i', 1, 6170, 0}, {';', 0, 6171, 223},
+    {'e', 1, 6171, 0}, {';', 0, 6172, 228}, {';', 0, 6172, 231}, {'y', 1, 6172, 0}, {';', 0, 6173, 237}, {';', 0, 6173, 240},
+    {'l', 1, 6173, 0}, {'e', 1, 6174, 0}, {'a', 1, 6175, 0}, {'c', 1, 6176, 0}, {'n', 1, 6177, 0}, {'l', 1, 6178, 0},
+    {'n', 1, 6179, 0}, {'r', 1, 6180, 0}, {'e', 1, 6181, 0}, {'o', 2, 6182, 0}, {'l', 1, 6184, 0}, {'i', 1, 6185, 0},
+    {'e', 1, 6186, 0}, {'r', 1, 6187, 0}, {'p', 3, 6188, 0}, {'e', 1, 6191, 0}, {'r', 1, 6192, 0}, {'i', 1, 6193, 0},
+    {'q', 1, 6194, 0}, {'u', 1, 6195, 0}, {'r', 1, 6196, 0}, {'e', 1, 6197, 0}, {'l', 1, 6198, 0}, {'i', 1, 6199, 0},
+    {'a', 1, 6200, 0}, {'t', 1, 6201, 0}, {'e', 1, 6202, 0}, {'i', 1, 6203, 0}, {'e', 1, 6204, 0}, {'i', 1, 6205, 0},
+    {'L', 1, 6206, 0}, {'R', 1, 6207, 0}, {'k', 1, 6208, 0}, {'m', 1, 6209, 0}, {'n', 1, 6210, 0}, {'P', 1, 6211, 0},
+    {'e', 1, 6212, 0}, {'n', 1, 6213, 0}, {'l', 1, 6214, 0}, {'i', 1, 6215, 0}, {'d', 2, 6216, 0}, {'n', 1, 6218, 0},
+    {'a', 1, 6219, 0}, {'e', 1, 6220, 0}, {'n', 1, 6221, 0}, {'p', 1, 6222, 0}, {'u', 1, 6223, 0}, {'e', 1, 6224, 0},
+    {'u', 1, 6225, 0}, {'i', 1, 6226, 0}, {'e', 1, 6227, 0}, {'m', 1, 6228, 0}, {'f', 1, 6229, 0}, {'s', 1, 6230, 0},
+    {'s', 1, 6231, 0}, {'e', 1, 6232, 0}, {'v', 1, 6233, 0}, {'g', 1, 6234, 0}, {'u', 1, 6235, 0}, {'b', 1, 6236, 0},
+    {'c', 1, 6237, 0}, {'p', 1, 6238, 0}, {'l', 1, 6239, 0}, {'r', 1, 6240, 0}, {'e', 1, 6241, 384}, {';', 0, 6242, 387},
+    {'e', 1, 6242, 388}, {';', 0, 6243, 391}, {'c', 1, 6243, 0}, {'e', 1, 6244, 395}, {';', 0, 6245, 397}, {';', 0, 6245, 398},
+    {'o', 1, 6245, 0}, {'u', 1, 6246, 0}, {'h', 1, 6247, 405}, {'e', 1, 6248, 407}, {'s', 1, 6249, 0}, {'a', 1, 6250, 0},
+    {'r', 1, 6251, 0}, {'a', 1, 6252, 0}, {'a', 1, 6253, 0}, {'i', 1, 6254, 0}, {'a', 1, 6255, 0}, {'d', 1, 6256, 0},
+    {';', 0, 6257, 429}, {'c', 1, 6257, 0}, {'r', 1, 6258, 0}, {';', 0, 6259, 440}, {'e', 1, 6259, 0}, {'l', 1, 6260, 0},
+    {'n', 1, 6261, 0}, {'l', 1, 6262, 0}, {'s', 1, 6263, 0}, {'A', 2, 6264, 0}, {'C', 1, 6266, 0}, {'D', 1, 6267, 0},
+    {'F', 1, 6268, 0}, {'T', 2, 6269, 0}, {'U', 1, 6271, 0}, {'V', 1, 6272, 0}, {'a', 1, 6273, 0}, {'I', 1, 6274, 0},
+    {'t', 1, 6275, 0}, {'e', 1, 6276, 0}, {'y', 1, 6277, 0}, {'y', 1, 6278, 0}, {'e', 1, 6279, 0}, {'n', 1, 6280, 0},
+    {'l', 1, 6281, 0}, {';', 0, 6282, 492}, {'D', 1, 6282, 0}, {'L', 1, 6283, 0}, {'R', 1, 6284, 0}, {'U', 1, 6285, 0},
+    {';', 0, 6286, 499}, {'C', 1, 6286, 0}, {'e', 4, 6287, 0}, {'t', 2, 6291, 0}, {'e', 1, 6293, 0}, {'h', 1, 6294, 0},
+    {'s', 1, 6295, 0}, {'t', 1, 6296, 0}, {';', 0, 6297, 526}, {';', 0, 6297, 527}, {';', 0, 6297, 528}, {'n', 1, 6297, 0},
+    {'l', 1, 6298, 0}, {'f', 1, 6299, 0}, {';', 0, 6300, 537}, {'S', 1, 6300, 0}, {'p', 1, 6301, 0}, {';', 0, 6302, 540},
+    {'E', 1, 6302, 0}, {'F', 1, 6303, 0}, {'T', 1, 6304, 0}, {'e', 1, 6305, 0}, {'k', 1, 6306, 0}, {'e', 1, 6307, 548},
+    {'c', 1, 6308, 0}, {';', 0, 6309, 552}, {'e', 1, 6309, 0}, {';', 0, 6310, 555}, {'c', 1, 6310, 0}, {'e', 1, 6311, 559},
+    {';', 0, 6312, 561}, {'B', 2, 6312, 0}, {'P', 1, 6314, 0}, {';', 0, 6315, 566}, {'P', 1, 6315, 0}, {';', 0, 6316, 568},
+    {'o', 1, 6316, 0}, {'n', 1, 6317, 0}, {'i', 1, 6318, 0}, {';', 0, 6319, 575}, {'A', 1, 6319, 0}, {'o', 1, 6320, 0},
+    {'n', 1, 6321, 0}, {'L', 1, 6322, 0}, {'R', 1, 6323, 0}, {'o', 1, 6324, 0}, {';', 0, 6325, 583}, {'e', 1, 6325, 0},
+    {';', 0, 6326, 588}, {';', 0, 6326, 591}, {'l', 1, 6326, 0}, {'r', 1, 6327, 0}, {'c', 1, 6328, 0}, {'h', 1, 6329, 0},
+    {'h', 1, 6330, 0}, {';', 0, 6331, 605}, {';', 0, 6331, 606}, {'e', 1, 6331, 617}, {';', 0, 6332, 619}, {'e', 1, 6332, 0},
+    {'n', 1, 6333, 0}, {'i', 1, 6334, 0}, {'e', 1, 6335, 635}, {'e', 1, 6336, 0}, {';', 0, 6337, 642}, {';', 0, 6337, 644},
+    {';', 0, 6337, 647}, {'e', 1, 6337, 650}, {'y', 1, 6338, 0}, {';', 0, 6339, 653}, {';', 0, 6339, 654}, {';', 0, 6339, 655},
+    {';', 0, 6339, 656}, {'d', 1, 6339, 0}, {'o', 1, 6340, 0}, {';', 0, 6341, 666}, {'d', 2, 6341, 0}, {';', 0, 6343, 676},
+    {'v', 1, 6343, 0}, {'h', 1, 6344, 0}, {';', 0, 6345, 680}, {'r', 1, 6345, 0}, {';', 0, 6346, 682}, {'r', 1, 6346, 0},
+    {'x', 2, 6347, 0}, {';', 0, 6349, 693}, {';', 0, 6349, 696}, {'e', 1, 6349, 0}, {'e', 1, 6350, 698}, {'i', 1, 6351, 0},
+    {';', 0, 6352, 703}, {'o', 1, 6352, 0}, {'p', 1, 6353, 0}, {'r', 1, 6354, 0}, {'i', 1, 6355, 0}, {'e', 1, 6356, 0},
+    {'d', 2, 6357, 0}, {'b', 1, 6359, 0}, {';', 0, 6360, 715}, {';', 0, 6360, 717}, {'s', 2, 6360, 0}, {'y', 1, 6362, 0},
+    {';', 0, 6363, 721}, {'u', 1, 6363, 0}, {'e', 1, 6364, 0}, {'p', 1, 6365, 0}, {'r', 1, 6366, 0}, {'p', 1, 6367, 0},
+    {'o', 1, 6368, 0}, {'l', 1, 6369, 0}, {'i', 1, 6370, 0}, {'c', 1, 6371, 0}, {'a', 1, 6372, 0}, {'i', 1, 6373, 0},
+    {'l', 1, 6374, 0}, {'e', 1, 6375, 0}, {'d', 1, 6376, 0}, {'w', 1, 6377, 0}, {'l', 1, 6378, 0}, {'s', 1, 6379, 0},
+    {'t', 1, 6380, 0}, {';', 0, 6381, 747}, {';', 0, 6381, 748}, {';', 0, 6381, 749}, {';', 0, 6381, 750}, {';', 0, 6381, 751},
+    {'i', 1, 6381, 0}, {'m', 1, 6382, 0}, {'e', 1, 6383, 0}, {';', 0, 6384, 759}, {';', 0, 6384, 760}, {';', 0, 6384, 761},
+    {';', 0, 6384, 762}, {';', 0, 6384, 764}, {';', 0, 6384, 765}, {';', 0, 6384, 766}, {';', 0, 6384, 767}, {';', 0, 6384, 768},
+    {';', 0, 6384, 769}, {';', 0, 6384, 770}, {';', 0, 6384, 771}, {';', 0, 6384, 773}, {';', 0, 6384, 774}, {';', 0, 6384, 775},
+    {';', 0, 6384, 776}, {';', 0, 6384, 777}, {';', 0, 6384, 778}, {'x', 1, 6384, 0}, {';', 0, 6385, 780}, {';', 0, 6385, 781},
+    {';', 0, 6385, 782}, {';', 0, 6385, 783}, {';', 0, 6385, 785}, {';', 0, 6385, 786}, {';', 0, 6385, 787}, {';', 0, 6385, 788},
+    {'n', 1, 6385, 0}, {'u', 1, 6386, 0}, {'m', 1, 6387, 0}, {';', 0, 6388, 792}, {';', 0, 6388, 793}, {';', 0, 6388, 794},
+    {';', 0, 6388, 795}, {';', 0, 6388, 797}, {';', 0, 6388, 798}, {';', 0, 6388, 799}, {';', 0, 6388, 800}, {';', 0, 6388, 801},
+    {';', 0, 6388, 802}, {'e', 1, 6388, 0}, {';', 0, 6389, 804}, {'r', 1, 6389, 805}, {';', 0, 6390, 808}, {';', 0, 6390, 810},
+    {';', 0, 6390, 812}, {'s', 1, 6390, 0}, {'t', 1, 6391, 0}, {';', 0, 6392, 817}, {';', 0, 6392, 818}, {'q', 1, 6392, 0},
+    {'e', 1, 6393, 0}, {'d', 1, 6394, 0}, {'c', 1, 6395, 0}, {'p', 1, 6396, 0}, {'p', 1, 6397, 0}, {'t', 1, 6398, 0},
+    {';', 0, 6399, 828}, {';', 0, 6399, 829}, {';', 0, 6399, 830}, {'n', 1, 6399, 0}, {'l', 1, 6400, 832}, {';', 0, 6401, 834},
+    {';', 0, 6401, 835}, {'s', 1, 6401, 0}, {';', 0, 6402, 839}, {'y', 1, 6402, 0}, {'r', 1, 6403, 0}, {';', 0, 6404, 846},
+    {'m', 1, 6404, 0}, {'q', 1, 6405, 0}, {'e', 2, 6406, 0}, {'i', 1, 6408, 0}, {'d', 1, 6409, 0}, {'i', 1, 6410, 0},
+    {';', 0, 6411, 864}, {'u', 1, 6411, 0}, {';', 0, 6412, 866}, {'e', 2, 6412, 0}, {';', 0, 6414, 869}, {'t', 1, 6414, 0},
+    {'n', 1, 6415, 0}, {'e', 2, 6416, 0}, {'o', 1, 6418, 0}, {'t', 1, 6419, 0}, {'d', 1, 6420, 0}, {'r', 1, 6421, 0},
+    {';', 0, 6422, 883}, {';', 0, 6422, 884}, {';', 0, 6422, 887}, {';', 0, 6422, 889}, {';', 0, 6422, 890}, {'r', 2, 6422, 0},
+    {';', 0, 6424, 893}, {';', 0, 6424, 894}, {'r', 2, 6424, 0}, {'c', 1, 6426, 0}, {'p', 1, 6427, 0}, {'p', 1, 6428, 0},
+    {'t', 1, 6429, 0}, {';', 0, 6430, 902}, {'r', 2, 6430, 0}, {'e', 1, 6432, 0}, {'v', 1, 6433, 0}, {'w', 1, 6434, 0},
+    {'n', 1, 6435, 910}, {'a', 1, 6436, 0}, {';', 0, 6437, 914}, {';', 0, 6437, 915}, {'i', 1, 6437, 0}, {';', 0, 6438, 917},
+    {'y', 1, 6438, 0}, {'r', 1, 6439, 0}, {'h', 1, 6440, 0}, {';', 0, 6441, 925}, {'o', 1, 6441, 0}, {';', 0, 6442, 927},
+    {'n', 1, 6442, 0}, {'e', 1, 6443, 0}, {';', 0, 6444, 932}, {'e', 1, 6444, 0}, {';', 0, 6445, 936}, {'y', 1, 6445, 0},
+    {'t', 1, 6446, 0}, {';', 0, 6447, 940}, {';', 0, 6447, 941}, {'n', 1, 6447, 0}, {';', 0, 6448, 945}, {'m', 1, 6448, 0},
+    {';', 0, 6449, 948}, {'e', 2, 6449, 950}, {'x', 1, 6451, 0}, {'n', 1, 6452, 0}, {'p', 1, 6453, 0}, {'r', 1, 6454, 0},
+    {';', 0, 6455, 960}, {'d', 1, 6455, 0}, {'n', 1, 6456, 0}, {'u', 1, 6457, 0}, {'u', 1, 6458, 0}, {'e', 1, 6459, 0},
+    {'r', 1, 6460, 0}, {'o', 1, 6461, 0}, {'a', 1, 6462, 0}, {'r', 1, 6463, 0}, {'n', 1, 6464, 0}, {'p', 1, 6465, 0},
+    {'k', 1, 6466, 0}, {';', 0, 6467, 977}, {';', 0, 6467, 979}, {';', 0, 6467, 980}, {';', 0, 6467, 981}, {'l', 1, 6467, 0},
+    {'a', 1, 6468, 0}, {';', 0, 6469, 985}, {'e', 1, 6469, 987}, {'r', 1, 6470, 0}, {'n', 1, 6471, 0}, {';', 0, 6472, 993},
+    {'n', 1, 6472, 0}, {';', 0, 6473, 998}, {'e', 1, 6473, 1001}, {'t', 1, 6474, 0}, {'e', 1, 6475, 0}, {'t', 1, 6476, 0},
+    {';', 0, 6477, 1010}, {';', 0, 6477, 1011}, {'s', 1, 6477, 0}, {'v', 1, 6478, 0}, {'3', 1, 6479, 0}, {'4', 1, 6480, 0},
+    {';', 0, 6481, 1019}, {'l', 1, 6481, 0}, {';', 0, 6482, 1023}, {'o', 1, 6482, 0}, {';', 0, 6483, 1026}, {'c', 1, 6483, 0},
+    {'o', 1, 6484, 0}, {';', 0, 6485, 1029}, {'n', 1, 6485, 0}, {'s', 1, 6486, 0}, {'t', 1, 6487, 0}, {';', 0, 6488, 1034},
+    {'D', 1, 6488, 0}, {'r', 1, 6489, 0}, {';', 0, 6490, 1037}, {';', 0, 6490, 1038}, {';', 0, 6490, 1040}, {';', 0, 6490, 1049},
+    {'t', 1, 6490, 0}, {'e', 1, 6491, 0}, {'n', 1, 6492, 0}, {'e', 1, 6493, 0}, {'g', 1, 6494, 0}, {';', 0, 6495, 1056},
+    {'g', 1, 6495, 0}, {';', 0, 6496, 1059}, {';', 0, 6496, 1060}, {';', 0, 6496, 1062}, {';', 0, 6496, 1063}, {'l', 1, 6496, 0},
+    {';', 0, 6497, 1068}, {'i', 1, 6497, 0}, {'2', 1, 6498, 1070}, {'3', 1, 6499, 0}, {'4', 1, 6500, 1073}, {'5', 1, 6501, 0},
+    {'6', 1, 6502, 0}, {'8', 1, 6503, 0}, {'3', 1, 6504, 0}, {'5', 1, 6505, 0}, {'4', 1, 6506, 1080}, {'5', 1, 6507, 0},
+    {'8', 1, 6508, 0}, {'5', 1, 6509, 0}, {'6', 1, 6510, 0}, {'8', 1, 6511, 0}, {'8', 1, 6512, 0}, {';', 0, 6513, 1088},
+    {';', 0, 6513, 1089}, {'e', 1, 6513, 0}, {';', 0, 6514, 1094}, {'d', 1, 6514, 0}, {'e', 1, 6515, 0}, {';', 0, 6516, 1098},
+    {'a', 1, 6516, 0}, {';', 0, 6517, 1107}, {'t', 2, 6517, 0}, {'s', 1, 6519, 0}, {';', 0, 6520, 1116}, {'r', 1, 6520, 0},
+    {';', 0, 6521, 1127}, {';', 0, 6521, 1128}, {';', 0, 6521, 1130}, {';', 0, 6521, 1133}, {';', 0, 6521, 1134}, {';', 0, 6521, 1138},
+    {';', 0, 6521, 1139}, {'r', 1, 6521, 0}, {'s', 1, 6522, 0}, {'p', 1, 6523, 0}, {'r', 1, 6524, 0}, {'t', 1, 6525, 0},
+    {'l', 1, 6526, 0}, {'q', 1, 6527, 0}, {'s', 1, 6528, 0}, {'m', 1, 6529, 0}, {'n', 1, 6530, 0}, {'p', 1, 6531, 0},
+    {'t', 1, 6532, 0}, {'y', 1, 6533, 0}, {'i', 1, 6534, 0}, {';', 0, 6535, 1158}, {';', 0, 6535, 1160}, {'s', 2, 6535, 0},
+    {'p', 1, 6537, 0}, {'n', 1, 6538, 0}, {'r', 1, 6539, 0}, {'r', 1, 6540, 0}, {';', 0, 6541, 1168}, {'t', 1, 6541, 0},
+    {'e', 1, 6542, 0}, {'i', 1, 6543, 0}, {'r', 1, 6544, 0}, {'h', 1, 6545, 0}, {'k', 1, 6546, 0}, {'l', 1, 6547, 0},
+    {'n', 1, 6548, 0}, {'e', 1, 6549, 1179}, {';', 0, 6550, 1183}, {';', 0, 6550, 1187}, {'e', 1, 6550, 1190}, {'t', 1, 6551, 0},
+    {';', 0, 6552, 1194}, {'n', 1, 6552, 0}, {';', 0, 6553, 1196}, {';', 0, 6553, 1197}, {';', 0, 6553, 1198}, {';', 0, 6553, 1199},
+    {'i', 1, 6553, 0}, {'a', 1, 6554, 0}, {';', 0, 6555, 1202}, {';', 0, 6555, 1204}, {'e', 1, 6555, 0}, {';', 0, 6556, 1207},
+    {'t', 1, 6556, 0}, {'t', 1, 6557, 0}, {'l', 1, 6558, 0}, {'e', 1, 6559, 0}, {'c', 1, 6560, 0}, {'r', 1, 6561, 0},
+    {'o', 1, 6562, 0}, {';', 0, 6563, 1217}, {';', 0, 6563, 1220}, {'t', 1, 6563, 1221}, {';', 0, 6564, 1225}, {'o', 1, 6564, 0},
+    {';', 0, 6565, 1227}, {'v', 1, 6565, 0}, {';', 0, 6566, 1229}, {'e', 1, 6566, 0}, {';', 0, 6567, 1232}, {';', 0, 6567, 1235},
+    {';', 0, 6567, 1238}, {'y', 1, 6567, 0}, {';', 0, 6568, 1242}, {';', 0, 6568, 1243}, {'v', 1, 6568, 0}, {'l', 1, 6569, 0},
+    {'n', 1, 6570, 0}, {';', 0, 6571, 1253}, {'l', 1, 6571, 0}, {';', 0, 6572, 1256}, {'e', 1, 6572, 0}, {'t', 1, 6573, 0},
+    {'n', 1, 6574, 0}, {'a', 1, 6575, 0}, {';', 0, 6576, 1265}, {'e', 1, 6576, 0}, {';', 0, 6577, 1269}, {';', 0, 6577, 1271},
+    {'f', 1, 6577, 0}, {'s', 1, 6578, 0}, {'k', 1, 6579, 0}, {'p', 1, 6580, 0}, {'l', 1, 6581, 0}, {'i', 1, 6582, 0},
+    {'l', 1, 6583, 0}, {'l', 1, 6584, 0}, {';', 0, 6585, 1282}, {';', 0, 6585, 1283}, {';', 0, 6585, 1284}, {'e', 1, 6585, 0},
+    {'k', 1, 6586, 0}, {';', 0, 6587, 1287}, {'l', 2, 6587, 0}, {'n', 1, 6589, 0}, {'l', 1, 6590, 0}, {';', 0, 6591, 1292},
+    {';', 0, 6591, 1296}, {'r', 1, 6591, 0}, {'a', 1, 6592, 0}, {'h', 1, 6593, 0}, {'r', 1, 6594, 0}, {'a', 1, 6595, 0},
+    {'e', 1, 6596, 0}, {'i', 1, 6597, 0}, {'h', 1, 6598, 0}, {'a', 1, 6599, 0}, {';', 0, 6600, 1317}, {'t', 2, 6600, 0},
+    {'s', 1, 6602, 0}, {'p', 1, 6603, 0}, {'o', 1, 6604, 0}, {'q', 2, 6605, 0}, {'t', 1, 6607, 0}, {'i', 1, 6608, 0},
+    {'t', 1, 6609, 0}, {'r', 1, 6610, 0}, {';', 0, 6611, 1334}, {';', 0, 6611, 1335}, {'l', 1, 6611, 0}, {';', 0, 6612, 1337},
+    {';', 0, 6612, 1340}, {'n', 1, 6612, 0}, {'d', 1, 6613, 0}, {';', 0, 6614, 1343}, {'t', 1, 6614, 0}, {'t', 2, 6615, 0},
+    {'r', 1, 6617, 0}, {';', 0, 6618, 1352}, {';', 0, 6618, 1353}, {';', 0, 6618, 1354}, {';', 0, 6618, 1355}, {';', 0, 6618, 1356},
+    {'e', 1, 6618, 0}, {'a', 1, 6619, 0}, {'i', 1, 6620, 0}, {'r', 1, 6621, 0}, {';', 0, 6622, 1363}, {'s', 1, 6622, 0},
+    {'e', 1, 6623, 0}, {'t', 1, 6624, 0}, {'r', 1, 6625, 0}, {'g', 1, 6626, 0}, {'t', 1, 6627, 0}, {';', 0, 6628, 1374},
+    {'n', 1, 6628, 0}, {';', 0, 6629, 1376}, {'d', 1, 6629, 0}, {';', 0, 6630, 1379}, {'o', 1, 6630, 0}, {';', 0, 6631, 1384},
+    {';', 0, 6631, 1385}, {';', 0, 6631, 1387}, {'r', 1, 6631, 0}, {'k', 1, 6632, 0}, {';', 0, 6633, 1393}, {';', 0, 6633, 1394},
+    {'e', 1, 6633, 0}, {'s', 1, 6634, 0}, {'r', 1, 6635, 0}, {'s', 1, 6636, 0}, {'r', 1, 6637, 0}, {';', 0, 6638, 1401},
+    {';', 0, 6638, 1402}, {'h', 1, 6638, 0}, {'a', 1, 6639, 0}, {'n', 1, 6640, 0}, {';', 0, 6641, 1407}, {'s', 1, 6641, 0},
+    {'o', 4, 6642, 0}, {'r', 1, 6646, 0}, {'a', 1, 6647, 0}, {';', 0, 6648, 1421}, {'r', 1, 6648, 0}, {';', 0, 6649, 1426},
+    {'t', 1, 6649, 0}, {'r', 1, 6650, 0}, {'t', 1, 6651, 1430}, {';', 0, 6652, 1432}, {'b', 1, 6652, 0}, {'d', 2, 6653, 0},
+    {'s', 1, 6655, 0}, {'s', 1, 6656, 0}, {'s', 1, 6657, 0}, {'m', 1, 6658, 0}, {';', 0, 6659, 1446}, {'a', 1, 6659, 0},
+    {'r', 1, 6660, 0}, {'t', 1, 6661, 0}, {'h', 1, 6662, 0}, {'h', 1, 6663, 0}, {';', 0, 6664, 1458}, {'e', 1, 6664, 0},
+    {';', 0, 6665, 1463}, {';', 0, 6665, 1464}, {'o', 1, 6665, 0}, {';', 0, 6666, 1466}, {'a', 1, 6666, 0}, {';', 0, 6667, 1471},
+    {'e', 1, 6667, 0}, {'n', 1, 6668, 0}, {'l', 1, 6669, 0}, {';', 0, 6670, 1476}, {'d', 1, 6670, 0}, {';', 0, 6671, 1480},
+    {';', 0, 6671, 1482}, {'k', 1, 6671, 0}, {';', 0, 6672, 1484}, {'o', 1, 6672, 0}, {';', 0, 6673, 1486}, {'v', 1, 6673, 0},
+    {'r', 1, 6674, 0}, {';', 0, 6675, 1489}, {'t', 2, 6675, 0}, {';', 0, 6677, 1496}, {'l', 1, 6677, 0}, {';', 0, 6678, 1499},
+    {';', 0, 6678, 1502}, {';', 0, 6678, 1503}, {';', 0, 6678, 1504}, {';', 0, 6678, 1510}, {';', 0, 6678, 1512}, {'a', 1, 6678, 0},
+    {'r', 1, 6679, 0}, {';', 0, 6680, 1518}, {'l', 1, 6680, 0}, {';', 0, 6681, 1521}, {';', 0, 6681, 1522}, {';', 0, 6681, 1524},
+    {'e', 1, 6681, 0}, {';', 0, 6682, 1530}, {'E', 1, 6682, 0}, {'d', 1, 6683, 0}, {'v', 3, 6684, 0}, {';', 0, 6687, 1536},
+    {'v', 3, 6687, 0}, {'l', 1, 6690, 0}, {'l', 1, 6691, 0}, {';', 0, 6692, 1543}, {'n', 1, 6692, 0}, {'e', 1, 6693, 0},
+    {';', 0, 6694, 1548}, {'e', 1, 6694, 0}, {';', 0, 6695, 1550}, {';', 0, 6695, 1551}, {'c', 1, 6695, 0}, {'w', 1, 6696, 0},
+    {'t', 1, 6697, 0}, {';', 0, 6698, 1555}, {'e', 1, 6698, 0}, {'e', 1, 6699, 0}, {'t', 2, 6700, 0}, {';', 0, 6702, 1564},
+    {'q', 1, 6702, 0}, {';', 0, 6703, 1566}, {';', 0, 6703, 1567}, {'b', 1, 6703, 0}, {'p', 1, 6704, 0}, {';', 0, 6705, 1571},
+    {';', 0, 6705, 1572}, {'e', 1, 6705, 0}, {';', 0, 6706, 1576}, {'e', 1, 6706, 0}, {';', 0, 6707, 1579}, {';', 0, 6707, 1580},
+    {'e', 1, 6707, 0}, {'e', 1, 6708, 1585}, {'n', 1, 6709, 0}, {'o', 1, 6710, 0}, {';', 0, 6711, 1595}, {'h', 1, 6711, 0},
+    {'r', 1, 6712, 0}, {'h', 1, 6713, 0}, {'i', 1, 6714, 0}, {'r', 1, 6715, 0}, {'i', 1, 6716, 0}, {'r', 1, 6717, 0},
+    {'i', 1, 6718, 0}, {';', 0, 6719, 1609}, {';', 0, 6719, 1610}, {'k', 1, 6719, 0}, {';', 0, 6720, 1612}, {'o', 1, 6720, 0},
+    {'r', 1, 6721, 0}, {'e', 1, 6722, 1616}, {';', 0, 6723, 1621}, {';', 0, 6723, 1623}, {'c', 1, 6723, 0}, {'d', 1, 6724, 0},
+    {';', 0, 6725, 1628}, {';', 0, 6725, 1629}, {'e', 1, 6725, 1632}, {';', 0, 6726, 1635}, {';', 0, 6726, 1638}, {';', 0, 6726, 1639},
+    {'s', 1, 6726, 0}, {';', 0, 6727, 1641}, {';', 0, 6727, 1643}, {';', 0, 6727, 1644}, {'o', 1, 6727, 0}, {'s', 1, 6728, 0},
+    {';', 0, 6729, 1650}, {';', 0, 6729, 1651}, {';', 0, 6729, 1653}, {';', 0, 6729, 1655}, {'o', 1, 6729, 0}, {'f', 1, 6730, 0},
+    {'p', 1, 6731, 0}, {'h', 1, 6732, 1666}, {'e', 1, 6733, 1669}, {'s', 2, 6734, 0}, {';', 0, 6736, 1675}, {'l', 1, 6736, 0},
+    {'m', 1, 6737, 0}, {';', 0, 6738, 1681}, {'t', 1, 6738, 0}, {'d', 1, 6739, 0}, {'l', 1, 6740, 0}, {'n', 1, 6741, 0},
+    {'t', 1, 6742, 0}, {';', 0, 6743, 1693}, {'f', 1, 6743, 0}, {'k', 2, 6744, 0}, {'v', 1, 6746, 0}, {'c', 1, 6747, 0},
+    {';', 0, 6748, 1702}, {'i', 1, 6748, 0}, {'o', 1, 6749, 0}, {'u', 1, 6750, 0}, {';', 0, 6751, 1706}, {'n', 1, 6751, 1707},
+    {'i', 1, 6752, 0}, {'w', 1, 6753, 0}, {'i', 1, 6754, 0}, {';', 0, 6755, 1715}, {';', 0, 6755, 1719}, {'p', 1, 6755, 0},
+    {'u', 1, 6756, 0}, {'q', 1, 6757, 0}, {'a', 1, 6758, 0}, {'e', 1, 6759, 0}, {'s', 1, 6760, 0}, {'i', 1, 6761, 0},
+    {';', 0, 6762, 1729}, {'s', 1, 6762, 0}, {';', 0, 6763, 1732}, {'m', 1, 6763, 0}, {'l', 1, 6764, 0}, {'i', 1, 6765, 0},
+    {'u', 1, 6766, 0}, {'o', 1, 6767, 0}, {';', 0, 6768, 1740}, {'l', 1, 6768, 0}, {'p', 1, 6769, 0}, {'e', 1, 6770, 0},
+    {'r', 1, 6771, 0}, {'n', 1, 6772, 0}, {';', 0, 6773, 1752}, {'e', 1, 6773, 0}, {';', 0, 6774, 1756}, {'l', 1, 6774, 0},
+    {';', 0, 6775, 1759}, {'e', 1, 6775, 0}, {';', 0, 6776, 1763}, {'t', 1, 6776, 0}, {';', 0, 6777, 1766}, {';', 0, 6777, 1767},
+    {'e', 1, 6777, 0}, {';', 0, 6778, 1770}, {'p', 1, 6778, 0}, {';', 0, 6779, 1773}, {'f', 1, 6779, 0}, {';', 0, 6780, 1775},
+    {'s', 1, 6780, 0}, {'k', 1, 6781, 0}, {'p', 1, 6782, 0}, {'l', 1, 6783, 0}, {'i', 1, 6784, 0}, {'l', 1, 6785, 0},
+    {';', 0, 6786, 1782}, {'l', 1, 6786, 0}, {';', 0, 6787, 1784}, {'n', 1, 6787, 0}, {';', 0, 6788, 1786}, {';', 0, 6788, 1787},
+    {'e', 1, 6788, 0}, {'k', 1, 6789, 0}, {';', 0, 6790, 1790}, {'l', 2, 6790, 0}, {'n', 1, 6792, 0}, {'l', 1, 6793, 0},
+    {';', 0, 6794, 1795}, {'a', 1, 6794, 0}, {';', 0, 6795, 1800}, {'r', 1, 6795, 0}, {'n', 1, 6796, 0}, {'a', 1, 6797, 0},
+    {';', 0, 6798, 1806}, {'t', 1, 6798, 0}, {'r', 1, 6799, 0}, {';', 0, 6800, 1813}, {';', 0, 6800, 1814}, {'l', 1, 6800, 0},
+    {'a', 1, 6801, 0}, {'h', 1, 6802, 0}, {'l', 1, 6803, 0}, {'r', 1, 6804, 0}, {'s', 1, 6805, 0}, {'t', 1, 6806, 0},
+    {'g', 1, 6807, 0}, {';', 0, 6808, 1829}, {';', 0, 6808, 1830}, {'t', 2, 6808, 0}, {';', 0, 6810, 1834}, {';', 0, 6810, 1835},
+    {';', 0, 6810, 1836}, {';', 0, 6810, 1837}, {';', 0, 6810, 1838}, {'s', 1, 6810, 0}, {'e', 1, 6811, 0}, {'t', 1, 6812, 0},
+    {'i', 1, 6813, 0}, {';', 0, 6814, 1845}, {'o', 1, 6814, 0}, {';', 0, 6815, 1850}, {'r', 1, 6815, 0}, {'e', 1, 6816, 0},
+    {'s', 1, 6817, 0}, {';', 0, 6818, 1855}, {';', 0, 6818, 1856}, {'t', 1, 6818, 0}, {'a', 1, 6819, 0}, {'e', 1, 6820, 0},
+    {';', 0, 6821, 1861}, {'n', 1, 6821, 0}, {';', 0, 6822, 1866}, {'l', 1, 6822, 0}, {';', 0, 6823, 1869}, {';', 0, 6823, 1871},
+    {'m', 1, 6823, 0}, {'i', 1, 6824, 0}, {';', 0, 6825, 1874}, {';', 0, 6825, 1877}, {';', 0, 6825, 1878}, {';', 0, 6825, 1879},
+    {'k', 1, 6825, 0}, {';', 0, 6826, 1881}, {'o', 1, 6826, 0}, {'r', 1, 6827, 0}, {'n', 1, 6828, 0}, {';', 0, 6829, 1888},
+    {'n', 1, 6829, 0}, {';', 0, 6830, 1892}, {'y', 1, 6830, 0}, {'m', 1, 6831, 0}, {'p', 1, 6832, 0}, {';', 0, 6833, 1899},
+    {'f', 1, 6833, 0}, {'v', 1, 6834, 0}, {'t', 1, 6835, 0}, {';', 0, 6836, 1905}, {';', 0, 6836, 1907}, {';', 0, 6836, 1909},
+    {';', 0, 6836, 1910}, {'u', 1, 6836, 0}, {'r', 1, 6837, 0}, {';', 0, 6838, 1913}, {'s', 1, 6838, 0}, {'p', 1, 6839, 0},
+    {'r', 1, 6840, 0}, {';', 0, 6841, 1918}, {';', 0, 6841, 1921}, {'y', 1, 6841, 0}, {'r', 1, 6842, 0}, {'s', 2, 6843, 0},
+    {';', 0, 6845, 1930}, {'s', 1, 6845, 0}, {';', 0, 6846, 1932}, {'s', 1, 6846, 0}, {';', 0, 6847, 1934}, {'e', 1, 6847, 0},
+    {'s', 1, 6848, 0}, {';', 0, 6849, 1938}, {'e', 1, 6849, 0}, {'s', 1, 6850, 0}, {'e', 1, 6851, 0}, {'f', 1, 6852, 0},
+    {';', 0, 6853, 1946}, {'n', 1, 6853, 0}, {'e', 1, 6854, 0}, {'f', 1, 6855, 0}, {';', 0, 6856, 1952}, {'g', 1, 6856, 0},
+    {';', 0, 6857, 1955}, {'t', 1, 6857, 0}, {'o', 1, 6858, 0}, {'l', 1, 6859, 0}, {';', 0, 6860, 1962}, {';', 0, 6860, 1963},
+    {'u', 1, 6860, 0}, {'r', 1, 6861, 0}, {'t', 3, 6862, 0}, {'m', 1, 6865, 0}, {'b', 1, 6866, 0}, {'p', 1, 6867, 0},
+    {'p', 1, 6868, 0}, {'u', 1, 6869, 0}, {'q', 1, 6870, 0}, {'a', 1, 6871, 0}, {'e', 1, 6872, 0}, {'s', 1, 6873, 0},
+    {'i', 1, 6874, 0}, {'t', 1, 6875, 0}, {'u', 1, 6876, 0}, {'o', 1, 6877, 0}, {'o', 1, 6878, 0}, {'u', 1, 6879, 0},
+    {'r', 1, 6880, 0}, {'l', 1, 6881, 0}, {';', 0, 6882, 2000}, {';', 0, 6882, 2001}, {'u', 1, 6882, 0}, {'t', 3, 6883, 0},
+    {'m', 1, 6886, 0}, {'b', 1, 6887, 0}, {'p', 1, 6888, 0}, {';', 0, 6889, 2011}, {'k', 1, 6889, 0}, {';', 0, 6890, 2013},
+    {'o', 1, 6890, 0}, {'r', 1, 6891, 0}, {';', 0, 6892, 2017}, {'t', 1, 6892, 0}, {'n', 1, 6893, 0}, {'l', 1, 6894, 0},
+    {'c', 1, 6895, 0}, {'4', 1, 6896, 0}, {'f', 1, 6897, 0}, {';', 0, 6898, 2029}, {'s', 1, 6898, 0}, {'v', 1, 6899, 0},
+    {'a', 1, 6900, 0}, {'s', 1, 6901, 0}, {'p', 1, 6902, 0}, {';', 0, 6903, 2035}, {'m', 1, 6903, 0}, {';', 0, 6904, 2038},
+    {';', 0, 6904, 2039}, {';', 0, 6904, 2041}, {'b', 2, 6904, 0}, {'d', 1, 6906, 0}, {'t', 1, 6907, 0}, {'r', 1, 6908, 0},
+    {'r', 1, 6909, 0}, {'e', 1, 6910, 0}, {';', 0, 6911, 2054}, {'g', 1, 6911, 0}, {'t', 1, 6912, 0}, {'n', 1, 6913, 0},
+    {'u', 1, 6914, 0}, {';', 0, 6915, 2066}, {'m', 1, 6915, 0}, {'i', 1, 6916, 0}, {';', 0, 6917, 2071}, {'k', 1, 6917, 0},
+    {';', 0, 6918, 2073}, {'a', 1, 6918, 0}, {'e', 1, 6919, 2078}, {';', 0, 6920, 2081}, {'e', 1, 6920, 0}, {';', 0, 6921, 2084},
+    {';', 0, 6921, 2086}, {'c', 1, 6921, 0}, {';', 0, 6922, 2088}, {'t', 1, 6922, 0}, {'e', 1, 6923, 2091}, {';', 0, 6924, 2093},
+    {';', 0, 6924, 2094}, {';', 0, 6924, 2095}, {'n', 2, 6924, 0}, {'p', 1, 6926, 0}, {';', 0, 6927, 2099}, {';', 0, 6927, 2100},
+    {';', 0, 6927, 2103}, {'o', 1, 6927, 0}, {'n', 1, 6928, 0}, {'p', 1, 6929, 0}, {';', 0, 6930, 2109}, {';', 0, 6930, 2111},
+    {'o', 1, 6930, 0}, {'r', 1, 6931, 0}, {'n', 2, 6932, 0}, {'p', 1, 6934, 0}, {';', 0, 6935, 2117}, {';', 0, 6935, 2118},
+    {';', 0, 6935, 2120}, {'e', 1, 6935, 0}, {';', 0, 6936, 2123}, {';', 0, 6936, 2124}, {'l', 1, 6936, 0}, {';', 0, 6937, 2130},
+    {';', 0, 6937, 2131}, {'t', 1, 6937, 0}, {'s', 1, 6938, 0}, {'p', 1, 6939, 0}, {'t', 1, 6940, 0}, {'i', 1, 6941, 0},
+    {';', 0, 6942, 2137}, {'o', 1, 6942, 0}, {'o', 1, 6943, 0}, {'g', 1, 6944, 0}, {'b', 1, 6945, 0}, {'p', 1, 6946, 0},
+    {'e', 1, 6947, 0}, {'i', 1, 6948, 0}, {';', 0, 6949, 2150}, {'r', 1, 6949, 0}, {';', 0, 6950, 2153}, {'p', 1, 6950, 0},
+    {'r', 1, 6951, 0}, {';', 0, 6952, 2158}, {';', 0, 6952, 2159}, {';', 0, 6952, 2160}, {';', 0, 6952, 2162}, {';', 0, 6952, 2163},
+    {'E', 1, 6952, 0}, {'e', 1, 6953, 0}, {'E', 1, 6954, 0}, {'e', 1, 6955, 0}, {'a', 1, 6956, 0}, {';', 0, 6957, 2170},
+    {'r', 1, 6957, 0}, {';', 0, 6958, 2172}, {'q', 1, 6958, 0}, {'p', 1, 6959, 0}, {'h', 1, 6960, 0}, {';', 0, 6961, 2182},
+    {';', 0, 6961, 2184}, {';', 0, 6961, 2186}, {';', 0, 6961, 2187}, {';', 0, 6961, 2189}, {';', 0, 6961, 2190}, {';', 0, 6961, 2193},
+    {'s', 1, 6961, 0}, {'e', 1, 6962, 0}, {';', 0, 6963, 2197}, {';', 0, 6963, 2198}, {'p', 1, 6963, 0}, {'s', 1, 6964, 0},
+    {';', 0, 6965, 2202}, {'e', 1, 6965, 0}, {'e', 1, 6966, 2205}, {';', 0, 6967, 2208}, {'e', 1, 6967, 0}, {'n', 1, 6968, 0},
+    {'f', 1, 6969, 0}, {'r', 1, 6970, 0}, {';', 0, 6971, 6}, {';', 0, 6971, 7}, {';', 0, 6971, 13}, {'u', 1, 6971, 0},
+    {';', 0, 6972, 23}, {';', 0, 6972, 25}, {'a', 1, 6972, 0}, {';', 0, 6973, 30}, {'e', 1, 6973, 0}, {'l', 1, 6974, 0},
+    {';', 0, 6975, 39}, {';', 0, 6975, 43}, {'l', 1, 6975, 0}, {'s', 1, 6976, 0}, {';', 0, 6977, 47}, {';', 0, 6977, 49},
+    {'t', 1, 6977, 0}, {'a', 1, 6978, 0}, {'D', 1, 6979, 0}, {'D', 1, 6980, 0}, {'M', 1, 6981, 0}, {'P', 1, 6982, 0},
+    {'T', 1, 6983, 0}, {'i', 1, 6984, 0}, {'u', 1, 6985, 0}, {';', 0, 6986, 65}, {'e', 1, 6986, 0}, {';', 0, 6987, 67},
+    {'r', 1, 6987, 0}, {'u', 1, 6988, 0}, {'r', 1, 6989, 0}, {';', 0, 6990, 75}, {'h', 1, 6990, 0}, {';', 0, 6991, 81},
+    {';', 0, 6991, 84}, {'t', 1, 6991, 0}, {'d', 1, 6992, 0}, {'e', 1, 6993, 0}, {';', 0, 6994, 98}, {'a', 1, 6994, 0},
+    {'C', 1, 6995, 0}, {'D', 1, 6996, 0}, {'L', 2, 6997, 0}, {'R', 1, 6999, 0}, {'U', 1, 7000, 0}, {'V', 1, 7001, 0},
+    {'r', 1, 7002, 0}, {'e', 1, 7003, 0}, {'f', 1, 7004, 0}, {'g', 1, 7005, 0}, {'e', 2, 7006, 0}, {'r', 1, 7008, 0},
+    {';', 0, 7009, 129}, {';', 0, 7009, 134}, {';', 0, 7009, 135}, {';', 0, 7009, 142}, {'t', 1, 7009, 0}, {'m', 1, 7010, 0},
+    {'e', 1, 7011, 0}, {'n', 1, 7012, 0}, {'i', 1, 7013, 0}, {'b', 1, 7014, 0}, {';', 0, 7015, 158}, {'n', 1, 7015, 0},
+    {'S', 1, 7016, 0}, {'V', 1, 7017, 0}, {';', 0, 7018, 165}, {'r', 1, 7018, 0}, {';', 0, 7019, 172}, {';', 0, 7019, 173},
+    {';', 0, 7019, 174}, {'r', 6, 7019, 0}, {';', 0, 7025, 190}, {'t', 1, 7025, 0}, {'n', 1, 7026, 0}, {';', 0, 7027, 199},
+    {'w', 1, 7027, 0}, {'u', 1, 7028, 0}, {';', 0, 7029, 206}, {';', 0, 7029, 213}, {'a', 1, 7029, 0}, {'s', 1, 7030, 0},
+    {'a', 1, 7031, 0}, {'e', 1, 7032, 0}, {'b', 1, 7033, 0}, {';', 0, 7034, 227}, {';', 0, 7034, 236}, {';', 0, 7034, 241},
+    {';', 0, 7034, 249}, {';', 0, 7034, 250}, {'e', 1, 7034, 0}, {';', 0, 7035, 254}, {';', 0, 7035, 255}, {'g', 1, 7035, 0},
+    {'r', 1, 7036, 0}, {'i', 1, 7037, 0}, {'u', 1, 7038, 0}, {'w', 1, 7039, 0}, {'o', 1, 7040, 0}, {'g', 1, 7041, 0},
+    {'e', 3, 7042, 0}, {'i', 1, 7045, 0}, {'D', 1, 7046, 0}, {'T', 1, 7047, 0}, {'V', 1, 7048, 0}, {'c', 1, 7049, 0},
+    {'r', 1, 7050, 0}, {'g', 1, 7051, 0}, {'u', 1, 7052, 0}, {'l', 1, 7053, 0}, {'e', 1, 7054, 0}, {'s', 1, 7055, 0},
+    {'a', 1, 7056, 0}, {'l', 1, 7057, 0}, {'r', 1, 7058, 0}, {';', 0, 7059, 292}, {'f', 1, 7059, 0}, {'g', 1, 7060, 0},
+    {'f', 1, 7061, 0}, {'g', 1, 7062, 0}, {'e', 1, 7063, 0}, {'i', 1, 7064, 0}, {';', 0, 7065, 304}, {'S', 1, 7065, 0},
+    {'t', 1, 7066, 0}, {'l', 1, 7067, 0}, {';', 0, 7068, 316}, {';', 0, 7068, 317}, {';', 0, 7068, 318}, {'v', 1, 7068, 0},
+    {'G', 1, 7069, 0}, {'L', 1, 7070, 0}, {'e', 1, 7071, 0}, {'k', 1, 7072, 0}, {'a', 1, 7073, 0}, {'g', 1, 7074, 0},
+    {'C', 1, 7075, 0}, {'b', 1, 7076, 0}, {'m', 1, 7077, 0}, {'a', 1, 7078, 0}, {'s', 1, 7079, 0}, {'a', 1, 7080, 0},
+    {'p', 2, 7081, 0}, {'t', 1, 7083, 0}, {'s', 6, 7084, 0}, {'t', 1, 7090, 0}, {'c', 1, 7091, 0}, {'e', 1, 7092, 0},
+    {'h', 1, 7093, 0}, {'a', 1, 7094, 0}, {'s', 1, 7095, 0}, {'c', 1, 7096, 0}, {'e', 1, 7097, 0}, {'d', 1, 7098, 0},
+    {'t', 1, 7099, 0}, {';', 0, 7100, 385}, {';', 0, 7100, 389}, {';', 0, 7100, 393}, {';', 0, 7100, 396}, {'n', 1, 7100, 0},
+    {'r', 1, 7101, 0}, {';', 0, 7102, 406}, {';', 0, 7102, 408}, {';', 0, 7102, 409}, {'r', 1, 7102, 0}, {'a', 1, 7103, 0},
+    {'r', 1, 7104, 0}, {'l', 1, 7105, 0}, {'n', 1, 7106, 0}, {'r', 1, 7107, 0}, {'e', 1, 7108, 0}, {'t', 1, 7109, 0},
+    {'t', 1, 7110, 0}, {';', 0, 7111, 443}, {';', 0, 7111, 446}, {';', 0, 7111, 447}, {';', 0, 7111, 448}, {'e', 2, 7111, 0},
+    {'n', 1, 7113, 0}, {'r', 1, 7114, 0}, {'e', 1, 7115, 0}, {'o', 2, 7116, 0}, {'l', 1, 7118, 0}, {'e', 1, 7119, 0},
+    {'r', 1, 7120, 0}, {'p', 3, 7121, 0}, {'e', 1, 7124, 0}, {'r', 1, 7125, 0}, {'m', 1, 7126, 0}, {'a', 1, 7127, 0},
+    {'l', 1, 7128, 0}, {';', 0, 7129, 485}, {';', 0, 7129, 487}, {';', 0, 7129, 488}, {';', 0, 7129, 490}, {';', 0, 7129, 491},
+    {'o', 1, 7129, 0}, {'e', 1, 7130, 0}, {'i', 1, 7131, 0}, {'p', 1, 7132, 0}, {'i', 1, 7133, 0}, {';', 0, 7134, 503},
+    {'I', 1, 7134, 0}, {'S', 1, 7135, 0}, {'U', 1, 7136, 0}, {';', 0, 7137, 513}, {'E', 1, 7137, 0}, {'d', 1, 7138, 0},
+    {'a', 1, 7139, 0}, {'e', 1, 7140, 0}, {';', 0, 7141, 524}, {';', 0, 7141, 532}, {';', 0, 7141, 533}, {'o', 1, 7141, 0},
+    {'p', 1, 7142, 0}, {'a', 1, 7143, 0}, {'q', 1, 7144, 0}, {'u', 1, 7145, 0}, {'i', 1, 7146, 0}, {'D', 1, 7147, 0},
+    {';', 0, 7148, 547}, {';', 0, 7148, 549}, {'i', 1, 7148, 0}, {';', 0, 7149, 553}, {';', 0, 7149, 557}, {';', 0, 7149, 560},
+    {'a', 1, 7149, 0}, {'r', 1, 7150, 0}, {'a', 1, 7151, 0}, {'l', 1, 7152, 0}, {'w', 3, 7153, 0}, {'A', 1, 7156, 0},
+    {'l', 1, 7157, 0}, {'r', 1, 7158, 0}, {'w', 1, 7159, 0}, {'a', 1, 7160, 0}, {'e', 1, 7161, 0}, {'i', 1, 7162, 0},
+    {'n', 1, 7163, 0}, {';', 0, 7164, 585}, {';', 0, 7164, 592}, {';', 0, 7164, 594}, {'a', 1, 7164, 0}, {'i', 1, 7165, 0},
+    {';', 0, 7166, 604}, {';', 0, 7166, 618}, {';', 0, 7166, 626}, {';', 0, 7166, 627}, {'d', 1, 7166, 0}, {';', 0, 7167, 636},
+    {';', 0, 7167, 637}, {';', 0, 7167, 651}, {'m', 1, 7167, 0}, {';', 0, 7168, 660}, {'p', 1, 7168, 0}, {';', 0, 7169, 667},
+    {'a', 8, 7169, 0}, {'b', 2, 7177, 0}, {';', 0, 7179, 679}, {'r', 1, 7179, 0}, {';', 0, 7180, 686}, {';', 0, 7180, 690},
+    {'e', 1, 7180, 0}, {'q', 1, 7181, 0}, {';', 0, 7182, 699}, {'n', 1, 7182, 0}, {'n', 1, 7183, 0}, {'s', 1, 7184, 0},
+    {'i', 1, 7185, 0}, {'m', 2, 7186, 0}, {';', 0, 7188, 710}, {';', 0, 7188, 711}, {'g', 1, 7188, 0}, {'r', 1, 7189, 0},
+    {';', 0, 7190, 718}, {'e', 1, 7190, 0}, {'v', 1, 7191, 0}, {';', 0, 7192, 722}, {'n', 1, 7192, 0}, {';', 0, 7193, 727},
+    {'c', 1, 7193, 0}, {';', 0, 7194, 729}, {'t', 1, 7194, 0}, {'u', 1, 7195, 0}, {'m', 1, 7196, 0}, {'u', 1, 7197, 0},
+    {'r', 1, 7198, 0}, {'a', 1, 7199, 0}, {'u', 1, 7200, 0}, {';', 0, 7201, 738}, {'g', 1, 7201, 0}, {';', 0, 7202, 740},
+    {'o', 1, 7202, 0}, {'q', 1, 7203, 0}, {'r', 1, 7204, 0}, {'v', 1, 7205, 0}, {';', 0, 7206, 757}, {';', 0, 7206, 758},
+    {';', 0, 7206, 779}, {'u', 1, 7206, 0}, {'s', 1, 7207, 0}, {'e', 1, 7208, 0}, {';', 0, 7209, 803}, {';', 0, 7209, 806},
+    {'u', 1, 7209, 0}, {';', 0, 7210, 815}, {';', 0, 7210, 819}, {';', 0, 7210, 820}, {';', 0, 7210, 822}, {'u', 1, 7210, 0},
+    {';', 0, 7211, 824}, {';', 0, 7211, 825}, {';', 0, 7211, 826}, {';', 0, 7211, 831}, {';', 0, 7211, 833}, {'m', 1, 7211, 0},
+    {'v', 1, 7212, 0}, {'d', 1, 7213, 0}, {'a', 1, 7214, 0}, {';', 0, 7215, 852}, {'a', 1, 7215, 0}, {'d', 5, 7216, 0},
+    {'n', 1, 7221, 0}, {';', 0, 7222, 862}, {'r', 1, 7222, 0}, {'i', 1, 7223, 0}, {';', 0, 7224, 867}, {'q', 1, 7224, 0},
+    {';', 0, 7225, 870}, {';', 0, 7225, 872}, {'m', 1, 7225, 0}, {'x', 1, 7226, 0}, {'t', 1, 7227, 0}, {';', 0, 7228, 877},
+    {';', 0, 7228, 879}, {';', 0, 7228, 882}, {'l', 1, 7228, 0}, {'r', 1, 7229, 0}, {';', 0, 7230, 895}, {'p', 1, 7230, 0},
+    {'a', 1, 7231, 0}, {';', 0, 7232, 899}, {';', 0, 7232, 900}, {';', 0, 7232, 901}, {';', 0, 7232, 904}, {'m', 1, 7232, 0},
+    {'q', 2, 7233, 0}, {'e', 1, 7235, 0}, {'e', 1, 7236, 0}, {';', 0, 7237, 911}, {'r', 1, 7237, 0}, {'n', 1, 7238, 0},
+    {';', 0, 7239, 918}, {';', 0, 7239, 921}, {';', 0, 7239, 922}, {'w', 1, 7239, 0}, {';', 0, 7240, 928}, {'r', 1, 7240, 0},
+    {'q', 1, 7241, 0}, {'v', 1, 7242, 0}, {';', 0, 7243, 938}, {'d', 2, 7243, 0}, {'a', 1, 7245, 0}, {';', 0, 7246, 951},
+    {'o', 1, 7246, 0}, {';', 0, 7247, 953}, {';', 0, 7247, 955}, {';', 0, 7247, 956}, {';', 0, 7247, 957}, {'o', 1, 7247, 0},
+    {'u', 1, 7248, 0}, {'s', 1, 7249, 0}, {'a', 1, 7250, 0}, {'b', 1, 7251, 0}, {'r', 1, 7252, 0}, {'w', 1, 7253, 0},
+    {'r', 1, 7254, 0}, {'o', 1, 7255, 0}, {';', 0, 7256, 971}, {';', 0, 7256, 972}, {';', 0, 7256, 976}, {'e', 1, 7256, 0},
+    {'r', 1, 7257, 0}, {';', 0, 7258, 988}, {';', 0, 7258, 989}, {';', 0, 7258, 990}, {';', 0, 7258, 994}, {';', 0, 7258, 1002},
+    {';', 0, 7258, 1004}, {'r', 1, 7258, 0}, {';', 0, 7259, 1009}, {'e', 1, 7259, 0}, {';', 0, 7260, 1013}, {';', 0, 7260, 1014},
+    {';', 0, 7260, 1015}, {';', 0, 7260, 1022}, {'n', 1, 7260, 0}, {';', 0, 7261, 1027}, {'n', 1, 7261, 0}, {'t', 2, 7262, 0},
+    {';', 0, 7264, 1032}, {';', 0, 7264, 1033}, {'D', 1, 7264, 0}, {'s', 1, 7265, 0}, {'a', 1, 7266, 0}, {'n', 1, 7267, 0},
+    {'g', 1, 7268, 0}, {';', 0, 7269, 1054}, {';', 0, 7269, 1055}, {';', 0, 7269, 1057}, {';', 0, 7269, 1066}, {'n', 1, 7269, 0},
+    {';', 0, 7270, 1071}, {';', 0, 7270, 1072}, {';', 0, 7270, 1074}, {';', 0, 7270, 1075}, {';', 0, 7270, 1076}, {';', 0, 7270, 1077},
+    {';', 0, 7270, 1078}, {';', 0, 7270, 1079}, {';', 0, 7270, 1081}, {';', 0, 7270, 1082}, {';', 0, 7270, 1083}, {';', 0, 7270, 1084},
+    {';', 0, 7270, 1085}, {';', 0, 7270, 1086}, {';', 0, 7270, 1087}, {';', 0, 7270, 1093}, {';', 0, 7270, 1095}, {';', 0, 7270, 1097},
+    {'n', 1, 7270, 0}, {';', 0, 7271, 1108}, {'o', 2, 7271, 0}, {';', 0, 7273, 1112}, {'o', 1, 7273, 0}, {';', 0, 7274, 1140},
+    {'t', 1, 7274, 0}, {'r', 1, 7275, 0}, {';', 0, 7276, 1143}, {';', 0, 7276, 1144}, {'e', 1, 7276, 0}, {'l', 1, 7277, 0},
+    {'s', 1, 7278, 0}, {';', 0, 7279, 1148}, {'e', 1, 7279, 0}, {';', 0, 7280, 1152}, {';', 0, 7280, 1154}, {';', 0, 7280, 1155},
+    {'r', 1, 7280, 0}, {';', 0, 7281, 1161}, {'u', 1, 7281, 0}, {';', 0, 7282, 1163}, {';', 0, 7282, 1164}, {'o', 1, 7282, 0},
+    {'o', 1, 7283, 0}, {';', 0, 7284, 1169}, {'f', 1, 7284, 0}, {'g', 1, 7285, 0}, {';', 0, 7286, 1173}, {';', 0, 7286, 1175},
+    {';', 0, 7286, 1176}, {';', 0, 7286, 1177}, {';', 0, 7286, 1178}, {';', 0, 7286, 1180}, {';', 0, 7286, 1191}, {';', 0, 7286, 1193},
+    {';', 0, 7286, 1195}, {'n', 1, 7286, 0}, {'r', 1, 7287, 0}, {';', 0, 7288, 1206}, {'i', 1, 7288, 0}, {';', 0, 7289, 1209},
+    {';', 0, 7289, 1211}, {'r', 1, 7289, 0}, {'a', 1, 7290, 0}, {'h', 1, 7291, 0}, {'d', 1, 7292, 0}, {';', 0, 7293, 1222},
+    {'t', 1, 7293, 0}, {';', 0, 7294, 1228}, {';', 0, 7294, 1231}, {';', 0, 7294, 1241}, {';', 0, 7294, 1244}, {';', 0, 7294, 1245},
+    {';', 0, 7294, 1248}, {';', 0, 7294, 1255}, {';', 0, 7294, 1260}, {'y', 1, 7294, 0}, {';', 0, 7295, 1262}, {';', 0, 7295, 1263},
+    {';', 0, 7295, 1266}, {'s', 1, 7295, 0}, {';', 0, 7296, 1273}, {';', 0, 7296, 1274}, {';', 0, 7296, 1275}, {';', 0, 7296, 1276},
+    {'m', 1, 7296, 0}, {';', 0, 7297, 1278}, {';', 0, 7297, 1280}, {';', 0, 7297, 1285}, {';', 0, 7297, 1286}, {'d', 1, 7297, 0},
+    {'u', 1, 7298, 0}, {';', 0, 7299, 1290}, {';', 0, 7299, 1291}, {';', 0, 7299, 1297}, {'r', 1, 7299, 0}, {'a', 1, 7300, 0},
+    {'r', 1, 7301, 0}, {'r', 1, 7302, 0}, {'f', 1, 7303, 0}, {'g', 1, 7304, 0}, {'r', 1, 7305, 0}, {'n', 1, 7306, 0},
+    {';', 0, 7307, 1318}, {'o', 2, 7307, 0}, {';', 0, 7309, 1322}, {'p', 1, 7309, 0}, {'t', 1, 7310, 0}, {'g', 1, 7311, 0},
+    {'q', 1, 7312, 0}, {'r', 1, 7313, 0}, {'m', 1, 7314, 0}, {';', 0, 7315, 1329}, {';', 0, 7315, 1330}, {';', 0, 7315, 1336},
+    {'e', 1, 7315, 0}, {';', 0, 7316, 1342}, {';', 0, 7316, 1344}, {';', 0, 7316, 1345}, {'a', 1, 7316, 0}, {'o', 1, 7317, 0},
+    {'f', 1, 7318, 0}, {'p', 1, 7319, 0}, {'g', 1, 7320, 0}, {'r', 1, 7321, 0}, {';', 0, 7322, 1365}, {'s', 1, 7322, 0},
+    {';', 0, 7323, 1367}, {';', 0, 7323, 1368}, {'e', 1, 7323, 0}, {';', 0, 7324, 1373}, {'e', 1, 7324, 0}, {';', 0, 7325, 1377},
+    {';', 0, 7325, 1380}, {';', 0, 7325, 1388}, {';', 0, 7325, 1389}, {';', 0, 7325, 1395}, {';', 0, 7325, 1396}, {';', 0, 7325, 1397},
+    {'t', 1, 7325, 0}, {';', 0, 7326, 1399}, {'a', 1, 7326, 0}, {'r', 1, 7327, 0}, {'e', 1, 7328, 0}, {'e', 1, 7329, 0},
+    {';', 0, 7330, 1414}, {'d', 1, 7330, 0}, {'l', 1, 7331, 0}, {'u', 1, 7332, 0}, {';', 0, 7333, 1418}, {';', 0, 7333, 1419},
+    {'e', 1, 7333, 0}, {';', 0, 7334, 1428}, {';', 0, 7334, 1429}, {';', 0, 7334, 1431}, {';', 0, 7334, 1433}, {';', 0, 7334, 1434},
+    {'u', 1, 7334, 0}, {';', 0, 7335, 1438}, {';', 0, 7335, 1439}, {';', 0, 7335, 1443}, {'a', 1, 7335, 0}, {'r', 1, 7336, 0},
+    {'i', 1, 7337, 0}, {'a', 1, 7338, 0}, {';', 0, 7339, 1456}, {';', 0, 7339, 1457}, {';', 0, 7339, 1459}, {'x', 1, 7339, 0},
+    {'l', 2, 7340, 0}, {';', 0, 7342, 1472}, {';', 0, 7342, 1474}, {';', 0, 7342, 1475}, {'o', 1, 7342, 0}, {';', 0, 7343, 1483},
+    {'w', 1, 7343, 0}, {';', 0, 7344, 1487}, {';', 0, 7344, 1488}, {';', 0, 7344, 1490}, {'s', 1, 7344, 0}, {'a', 1, 7345, 0},
+    {'r', 1, 7346, 0}, {'i', 1, 7347, 0}, {'a', 1, 7348, 0}, {';', 0, 7349, 1525}, {';', 0, 7349, 1531}, {'o', 1, 7349, 0},
+    {'a', 1, 7350, 0}, {'b', 1, 7351, 0}, {'c', 1, 7352, 0}, {'a', 1, 7353, 0}, {'b', 1, 7354, 0}, {'c', 1, 7355, 0},
+    {'l', 1, 7356, 0}, {';', 0, 7357, 1542}, {'t', 1, 7357, 0}, {';', 0, 7358, 1546}, {'q', 1, 7358, 0}, {';', 0, 7359, 1552},
+    {';', 0, 7359, 1553}, {'a', 1, 7359, 0}, {';', 0, 7360, 1556}, {';', 0, 7360, 1558}, {'m', 1, 7360, 0}, {'p', 1, 7361, 0},
+    {';', 0, 7362, 1565}, {'e', 1, 7362, 0}, {'e', 1, 7363, 0}, {'t', 2, 7364, 0}, {'q', 1, 7366, 0}, {'t', 2, 7367, 0},
+    {';', 0, 7369, 1586}, {'g', 1, 7369, 0}, {';', 0, 7370, 1594}, {';', 0, 7370, 1596}, {';', 0, 7370, 1597}, {';', 0, 7370, 1599},
+    {'n', 1, 7370, 0}, {';', 0, 7371, 1603}, {'e', 1, 7371, 0}, {';', 0, 7372, 1607}, {'e', 1, 7372, 0}, {';', 0, 7373, 1611},
+    {'w', 1, 7373, 0}, {';', 0, 7374, 1614}, {';', 0, 7374, 1617}, {';', 0, 7374, 1624}, {';', 0, 7374, 1627}, {';', 0, 7374, 1633},
+    {'s', 1, 7374, 0}, {'n', 1, 7375, 0}, {';', 0, 7376, 1647}, {'f', 1, 7376, 0}, {';', 0, 7377, 1661}, {'e', 1, 7377, 0},
+    {';', 0, 7378, 1667}, {';', 0, 7378, 1670}, {';', 0, 7378, 1671}, {'a', 1, 7378, 0}, {'e', 1, 7379, 0}, {';', 0, 7380, 1680},
+    {';', 0, 7380, 1684}, {';', 0, 7380, 1685}, {';', 0, 7380, 1686}, {'k', 1, 7380, 0}, {';', 0, 7381, 1692}, {'o', 1, 7381, 0},
+    {';', 0, 7382, 1697}, {'h', 1, 7382, 0}, {';', 0, 7383, 1699}, {'i', 1, 7383, 0}, {'r', 1, 7384, 0}, {';', 0, 7385, 1704},
+    {';', 0, 7385, 1705}, {';', 0, 7385, 1708}, {'m', 1, 7385, 0}, {'o', 1, 7386, 0}, {'n', 1, 7387, 0}, {'p', 1, 7388, 0},
+    {'r', 1, 7389, 0}, {';', 0, 7390, 1724}, {'p', 1, 7390, 0}, {'q', 1, 7391, 0}, {'i', 1, 7392, 0}, {'m', 1, 7393, 0},
+    {';', 0, 7394, 1730}, {';', 0, 7394, 1733}, {'a', 1, 7394, 0}, {'n', 1, 7395, 0}, {'r', 1, 7396, 0}, {';', 0, 7397, 1739},
+    {';', 0, 7397, 1741}, {';', 0, 7397, 1744}, {';', 0, 7397, 1748}, {'n', 1, 7397, 0}, {'t', 1, 7398, 0}, {'q', 1, 7399, 0},
+    {';', 0, 7400, 1758}, {';', 0, 7400, 1762}, {'y', 1, 7400, 0}, {';', 0, 7401, 1768}, {';', 0, 7401, 1772}, {'s', 1, 7401, 0},
+    {';', 0, 7402, 1776}, {';', 0, 7402, 1777}, {';', 0, 7402, 1778}, {';', 0, 7402, 1779}, {'m', 1, 7402, 0}, {';', 0, 7403, 1781},
+    {';', 0, 7403, 1783}, {'a', 1, 7403, 0}, {';', 0, 7404, 1788}, {';', 0, 7404, 1789}, {'d', 1, 7404, 0}, {'u', 1, 7405, 0},
+    {';', 0, 7406, 1793}, {';', 0, 7406, 1794}, {'r', 1, 7406, 0}, {';', 0, 7407, 1801}, {'e', 1, 7407, 0}, {'r', 1, 7408, 0},
+    {';', 0, 7409, 1810}, {';', 0, 7409, 1811}, {';', 0, 7409, 1815}, {'r', 1, 7409, 0}, {'a', 1, 7410, 0}, {'e', 1, 7411, 0},
+    {'i', 1, 7412, 0}, {'q', 1, 7413, 0}, {'h', 1, 7414, 0}, {'d', 1, 7415, 0}, {';', 0, 7416, 1832}, {'a', 1, 7416, 0},
+    {';', 0, 7417, 1840}, {'s', 1, 7417, 0}, {';', 0, 7418, 1843}, {'n', 1, 7418, 0}, {';', 0, 7419, 1846}, {';', 0, 7419, 1851},
+    {';', 0, 7419, 1852}, {';', 0, 7419, 1853}, {'r', 1, 7419, 0}, {'r', 1, 7420, 0}, {';', 0, 7421, 1860}, {';', 0, 7421, 1865},
+    {';', 0, 7421, 1868}, {';', 0, 7421, 1872}, {'n', 1, 7421, 0}, {';', 0, 7422, 1880}, {'w', 1, 7422, 0}, {';', 0, 7423, 1886},
+    {'u', 1, 7423, 0}, {';', 0, 7424, 1891}, {';', 0, 7424, 1893}, {'i', 1, 7424, 0}, {'a', 1, 7425, 0}, {';', 0, 7426, 1900},
+    {';', 0, 7426, 1901}, {';', 0, 7426, 1903}, {'s', 1, 7426, 0}, {'r', 1, 7427, 0}, {'e', 1, 7428, 0}, {';', 0, 7429, 1915},
+    {'s', 1, 7429, 0}, {';', 0, 7430, 1922}, {';', 0, 7430, 1925}, {';', 0, 7430, 1927}, {'u', 1, 7430, 0}, {';', 0, 7431, 1931},
+    {';', 0, 7431, 1933}, {';', 0, 7431, 1935}, {'e', 1, 7431, 0}, {';', 0, 7432, 1939}, {'e', 1, 7432, 0}, {';', 0, 7433, 1943},
+    {';', 0, 7433, 1944}, {';', 0, 7433, 1948}, {';', 0, 7433, 1949}, {';', 0, 7433, 1950}, {'h', 1, 7433, 0}, {';', 0, 7434, 1958},
+    {'t', 1, 7434, 0}, {'t', 1, 7435, 0}, {'s', 1, 7436, 0}, {'r', 1, 7437, 0}, {';', 0, 7438, 1966}, {'e', 1, 7438, 0},
+    {'n', 1, 7439, 0}, {';', 0, 7440, 1971}, {';', 0, 7440, 1972}, {';', 0, 7440, 1973}, {'p', 1, 7440, 0}, {'r', 1, 7441, 0},
+    {';', 0, 7442, 1977}, {'p', 1, 7442, 0}, {'q', 1, 7443, 0}, {'i', 1, 7444, 0}, {'m', 1, 7445, 0}, {';', 0, 7446, 1992},
+    {'b', 1, 7446, 0}, {'t', 1, 7447, 0}, {'l', 1, 7448, 0}, {'b', 1, 7449, 0}, {'r', 1, 7450, 0}, {'t', 1, 7451, 0},
+    {'s', 1, 7452, 0}, {';', 0, 7453, 2003}, {'e', 1, 7453, 0}, {'n', 1, 7454, 0}, {';', 0, 7455, 2008}, {';', 0, 7455, 2009},
+    {';', 0, 7455, 2010}, {';', 0, 7455, 2012}, {'w', 1, 7455, 0}, {';', 0, 7456, 2015}, {';', 0, 7456, 2018}, {';', 0, 7456, 2021},
+    {';', 0, 7456, 2022}, {';', 0, 7456, 2025}, {';', 0, 7456, 2027}, {'o', 1, 7456, 0}, {'y', 1, 7457, 0}, {';', 0, 7458, 2031},
+    {'p', 1, 7458, 0}, {'i', 1, 7459, 0}, {';', 0, 7460, 2034}, {';', 0, 7460, 2036}, {';', 0, 7460, 2042}, {'a', 1, 7460, 0},
+    {';', 0, 7461, 2044}, {';', 0, 7461, 2048}, {';', 0, 7461, 2049}, {'k', 1, 7461, 0}, {';', 0, 7462, 2053}, {'l', 1, 7462, 0},
+    {';', 0, 7463, 2062}, {'u', 1, 7463, 0}, {'s', 1, 7464, 0}, {'e', 1, 7465, 0}, {'u', 1, 7466, 0}, {';', 0, 7467, 2072},
+    {'d', 2, 7467, 0}, {';', 0, 7469, 2079}, {';', 0, 7469, 2082}, {';', 0, 7469, 2087}, {';', 0, 7469, 2089}, {';', 0, 7469, 2092},
+    {';', 0, 7469, 2096}, {'e', 1, 7469, 0}, {';', 0, 7470, 2098}, {'w', 1, 7470, 0}, {'a', 1, 7471, 0}, {'o', 1, 7472, 0},
+    {'n', 1, 7473, 0}, {'r', 1, 7474, 0}, {';', 0, 7475, 2114}, {'e', 1, 7475, 0}, {';', 0, 7476, 2116}, {';', 0, 7476, 2121},
+    {'e', 1, 7476, 0}, {';', 0, 7477, 2132}, {'i', 1, 7477, 0}, {'p', 1, 7478, 0}, {'h', 1, 7479, 0}, {';', 0, 7480, 2136},
+    {'p', 1, 7480, 0}, {';', 0, 7481, 2140}, {'m', 1, 7481, 0}, {'s', 1, 7482, 0}, {'s', 1, 7483, 0}, {'t', 1, 7484, 0},
+    {'a', 1, 7485, 0}, {';', 0, 7486, 2152}, {';', 0, 7486, 2154}, {';', 0, 7486, 2155}, {';', 0, 7486, 2165}, {';', 0, 7486, 2166},
+    {';', 0, 7486, 2167}, {';', 0, 7486, 2168}, {'g', 1, 7486, 0}, {';', 0, 7487, 2171}, {';', 0, 7487, 2173}, {';', 0, 7487, 2174},
+    {';', 0, 7487, 2179}, {';', 0, 7487, 2195}, {';', 0, 7487, 2196}, {';', 0, 7487, 2200}, {';', 0, 7487, 2201}, {';', 0, 7487, 2204},
+    {';', 0, 7487, 2206}, {';', 0, 7487, 2219}, {';', 0, 7487, 2220}, {';', 0, 7487, 2223}, {'r', 1, 7487, 0}, {'n', 1, 7488, 0},
+    {'s', 1, 7489, 0}, {';', 0, 7490, 32}, {'l', 1, 7490, 0}, {'D', 1, 7491, 0}, {';', 0, 7492, 46}, {';', 0, 7492, 51},
+    {';', 0, 7492, 53}, {'o', 1, 7492, 0}, {'o', 1, 7493, 0}, {'i', 1, 7494, 0}, {'l', 1, 7495, 0}, {'i', 1, 7496, 0},
+    {'s', 1, 7497, 0}, {'r', 1, 7498, 0}, {'n', 1, 7499, 0}, {'I', 1, 7500, 0}, {'c', 1, 7501, 0}, {'C', 1, 7502, 0},
+    {'d', 1, 7503, 0}, {'i', 1, 7504, 0}, {';', 0, 7505, 94}, {'n', 1, 7505, 0}, {'l', 1, 7506, 0}, {'o', 1, 7507, 0},
+    {'o', 2, 7508, 0}, {'e', 1, 7510, 0}, {'o', 1, 7511, 0}, {'i', 1, 7512, 0}, {'p', 2, 7513, 0}, {'e', 1, 7515, 0},
+    {'o', 1, 7516, 0}, {'v', 1, 7517, 0}, {'t', 3, 7518, 0}, {'h', 1, 7521, 0}, {';', 0, 7522, 125}, {'A', 1, 7522, 0},
+    {'o', 1, 7523, 0}, {';', 0, 7524, 143}, {'a', 1, 7524, 0}, {'r', 1, 7525, 0}, {';', 0, 7526, 149}, {'l', 1, 7526, 0},
+    {'r', 1, 7527, 0}, {'t', 1, 7528, 0}, {'m', 1, 7529, 0}, {'e', 1, 7530, 0}, {'t', 1, 7531, 0}, {'E', 1, 7532, 0},
+    {'F', 1, 7533, 0}, {'G', 1, 7534, 0}, {'L', 1, 7535, 0}, {'S', 1, 7536, 0}, {'T', 1, 7537, 0}, {'S', 1, 7538, 0},
+    {'t', 1, 7539, 0}, {'n', 1, 7540, 0}, {'a', 1, 7541, 0}, {'r', 1, 7542, 0}, {';', 0, 7543, 217}, {'l', 1, 7543, 0},
+    {'c', 1, 7544, 0}, {'l', 1, 7545, 0}, {'t', 1, 7546, 0}, {'l', 1, 7547, 0}, {'o', 1, 7548, 0}, {'l', 1, 7549, 0},
+    {'b', 1, 7550, 0}, {'n', 2, 7551, 0}, {'o', 1, 7553, 0}, {'h', 1, 7554, 0}, {';', 0, 7555, 269}, {'A', 1, 7555, 0},
+    {'V', 1, 7556, 0}, {'a', 1, 7557, 0}, {'o', 1, 7558, 0}, {'e', 1, 7559, 0}, {'e', 1, 7560, 0}, {'t', 1, 7561, 0},
+    {'o', 1, 7562, 0}, {'h', 1, 7563, 0}, {'a', 1, 7564, 0}, {'l', 1, 7565, 0}, {'a', 1, 7566, 0}, {'s', 1, 7567, 0},
+    {'n', 1, 7568, 0}, {'d', 1, 7569, 0}, {'r', 1, 7570, 0}, {'t', 2, 7571, 0}, {'h', 1, 7573, 0}, {'t', 2, 7574, 0},
+    {'h', 1, 7576, 0}, {'f', 1, 7577, 0}, {'g', 1, 7578, 0}, {'p', 1, 7579, 0}, {'r', 1, 7580, 0}, {'u', 1, 7581, 0},
+    {'e', 3, 7582, 0}, {'r', 1, 7585, 0}, {'e', 1, 7586, 0}, {';', 0, 7587, 326}, {';', 0, 7587, 328}, {'k', 1, 7587, 0},
+    {'r', 1, 7588, 0}, {'a', 1, 7589, 0}, {'l', 1, 7590, 0}, {'e', 1, 7591, 0}, {'l', 2, 7592, 0}, {'t', 1, 7594, 0},
+    {'t', 1, 7595, 0}, {'D', 1, 7596, 0}, {'E', 1, 7597, 0}, {'T', 1, 7598, 0}, {';', 0, 7599, 351}, {'E', 1, 7599, 0},
+    {'G', 1, 7600, 0}, {'L', 1, 7601, 0}, {'S', 1, 7602, 0}, {'T', 1, 7603, 0}, {'e', 1, 7604, 0}, {'e', 1, 7605, 0},
+    {'r', 1, 7606, 0}, {'t', 1, 7607, 0}, {'r', 1, 7608, 0}, {'e', 1, 7609, 0}, {'e', 1, 7610, 0}, {'r', 1, 7611, 0},
+    {'e', 4, 7612, 0}, {'i', 1, 7616, 0}, {';', 0, 7617, 399}, {'l', 1, 7617, 0}, {';', 0, 7618, 412}, {'c', 2, 7618, 0},
+    {'e', 1, 7620, 0}, {'D', 1, 7621, 0}, {'u', 1, 7622, 0}, {'e', 1, 7623, 0}, {'s', 4, 7624, 0}, {';', 0, 7628, 430},
+    {'i', 1, 7628, 0}, {'E', 2, 7629, 0}, {'U', 1, 7631, 0}, {'g', 1, 7632, 0}, {'r', 1, 7633, 0}, {'i', 1, 7634, 0},
+    {'u', 1, 7635, 0}, {'w', 1, 7636, 0}, {'o', 1, 7637, 0}, {'e', 3, 7638, 0}, {'i', 1, 7641, 0}, {'D', 1, 7642, 0},
+    {'T', 1, 7643, 0}, {'V', 1, 7644, 0}, {'c', 1, 7645, 0}, {'r', 1, 7646, 0}, {'p', 1, 7647, 0}, {'r', 1, 7648, 0},
+    {'a', 1, 7649, 0}, {'w', 1, 7650, 0}, {'f', 1, 7651, 0}, {'g', 1, 7652, 0}, {'A', 1, 7653, 0}, {'r', 1, 7654, 0},
+    {'n', 1, 7655, 0}, {'u', 2, 7656, 0}, {'n', 1, 7658, 0}, {'q', 1, 7659, 0}, {'s', 4, 7660, 0}, {'t', 1, 7664, 0},
+    {'t', 2, 7665, 0}, {'r', 1, 7667, 0}, {'a', 1, 7668, 0}, {'c', 1, 7669, 0}, {'u', 1, 7670, 0}, {'l', 1, 7671, 0},
+    {'l', 1, 7672, 0}, {'o', 1, 7673, 0}, {'r', 1, 7674, 0}, {'r', 1, 7675, 0}, {'a', 1, 7676, 0}, {'r', 1, 7677, 0},
+    {'u', 1, 7678, 0}, {';', 0, 7679, 570}, {'B', 1, 7679, 0}, {'D', 1, 7680, 0}, {'r', 1, 7681, 0}, {'i', 1, 7682, 0},
+    {'r', 1, 7683, 0}, {';', 0, 7684, 577}, {'r', 1, 7684, 0}, {'f', 1, 7685, 0}, {'g', 1, 7686, 0}, {';', 0, 7687, 582},
+    {'l', 4, 7687, 0}, {'n', 1, 7691, 0}, {'t', 1, 7692, 0}, {';', 0, 7693, 652}, {'e', 1, 7693, 0}, {'a', 1, 7694, 0},
+    {'b', 1, 7695, 0}, {'c', 1, 7696, 0}, {'d', 1, 7697, 0}, {'e', 1, 7698, 0}, {'f', 1, 7699, 0}, {'g', 1, 7700, 0},
+    {'h', 1, 7701, 0}, {';', 0, 7702, 677}, {'d', 1, 7702, 0}, {';', 0, 7703, 681}, {'q', 1, 7703, 0}, {';', 0, 7704, 697},
+    {'t', 1, 7704, 0}, {'g', 1, 7705, 0}, {'i', 1, 7706, 0}, {'m', 1, 7707, 0}, {';', 0, 7708, 708}, {'e', 1, 7708, 0},
+    {'e', 1, 7709, 0}, {'k', 1, 7710, 0}, {';', 0, 7711, 719}, {';', 0, 7711, 720}, {';', 0, 7711, 725}, {';', 0, 7711, 728},
+    {';', 0, 7711, 730}, {'s', 1, 7711, 0}, {'e', 1, 7712, 0}, {'p', 1, 7713, 0}, {';', 0, 7714, 734}, {'n', 1, 7714, 0},
+    {'s', 1, 7715, 0}, {'e', 1, 7716, 0}, {'z', 1, 7717, 0}, {'u', 1, 7718, 0}, {'i', 1, 7719, 0}, {';', 0, 7720, 753},
+    {'s', 1, 7720, 0}, {';', 0, 7721, 790}, {'s', 1, 7721, 0}, {'b', 1, 7722, 0}, {'p', 1, 7723, 0}, {';', 0, 7724, 836},
+    {';', 0, 7724, 840}, {'o', 1, 7724, 0}, {'r', 1, 7725, 0}, {'r', 1, 7726, 0}, {'R', 1, 7727, 0}, {'S', 1, 7728, 0},
+    {'a', 1, 7729, 0}, {'c', 1, 7730, 0}, {'d', 1, 7731, 0}, {'t', 1, 7732, 0}, {';', 0, 7733, 863}, {'t', 1, 7733, 0},
+    {';', 0, 7734, 868}, {'e', 1, 7734, 0}, {'e', 1, 7735, 0}, {';', 0, 7736, 876}, {';', 0, 7736, 891}, {';', 0, 7736, 892},
+    {';', 0, 7736, 896}, {'p', 1, 7736, 0}, {';', 0, 7737, 905}, {'p', 1, 7737, 0}, {'s', 1, 7738, 0}, {'e', 1, 7739, 0},
+    {'d', 1, 7740, 0}, {'r', 1, 7741, 0}, {'t', 1, 7742, 0}, {';', 0, 7743, 926}, {';', 0, 7743, 931}, {';', 0, 7743, 933},
+    {';', 0, 7743, 937}, {';', 0, 7743, 943}, {'s', 1, 7743, 0}, {';', 0, 7744, 947}, {'n', 1, 7744, 0}, {'t', 1, 7745, 0},
+    {'s', 1, 7746, 0}, {';', 0, 7747, 963}, {'r', 1, 7747, 0}, {'a', 1, 7748, 0}, {'o', 1, 7749, 0}, {'n', 1, 7750, 0},
+    {'p', 1, 7751, 0}, {'w', 1, 7752, 0}, {';', 0, 7753, 982}, {'r', 1, 7753, 0}, {'s', 1, 7754, 0}, {'t', 1, 7755, 0},
+    {';', 0, 7756, 1025}, {';', 0, 7756, 1028}, {'g', 1, 7756, 0}, {'l', 1, 7757, 0}, {';', 0, 7758, 1035}, {'l', 1, 7758, 0},
+    {'t', 1, 7759, 0}, {'t', 1, 7760, 0}, {'d', 1, 7761, 0}, {'t', 1, 7762, 0}, {'t', 1, 7763, 0}, {';', 0, 7764, 1109},
+    {'l', 1, 7764, 0}, {'x', 1, 7765, 0}, {';', 0, 7766, 1141}, {'o', 1, 7766, 0}, {'s', 1, 7767, 0}, {'e', 1, 7768, 0},
+    {';', 0, 7769, 1147}, {'q', 1, 7769, 0}, {';', 0, 7770, 1157}, {'i', 1, 7770, 0}, {'w', 1, 7771, 0}, {'w', 1, 7772, 0},
+    {'t', 1, 7773, 0}, {'h', 1, 7774, 0}, {'e', 1, 7775, 0}, {'t', 1, 7776, 0}, {'e', 1, 7777, 0}, {'s', 1, 7778, 0},
+    {'l', 1, 7779, 0}, {'k', 1, 7780, 0}, {';', 0, 7781, 1215}, {';', 0, 7781, 1226}, {'v', 1, 7781, 0}, {';', 0, 7782, 1272},
+    {';', 0, 7782, 1277}, {';', 0, 7782, 1288}, {';', 0, 7782, 1289}, {';', 0, 7782, 1298}, {'r', 1, 7782, 0}, {'o', 1, 7783, 0},
+    {'p', 1, 7784, 0}, {'t', 1, 7785, 0}, {'h', 1, 7786, 0}, {'e', 1, 7787, 0}, {'t', 1, 7788, 0}, {';', 0, 7789, 1319},
+    {'r', 1, 7789, 0}, {'r', 1, 7790, 0}, {';', 0, 7791, 1324}, {'t', 1, 7791, 0}, {'g', 1, 7792, 0}, {';', 0, 7793, 1327},
+    {';', 0, 7793, 1328}, {'r', 1, 7793, 0}, {'c', 1, 7794, 0}, {'x', 1, 7795, 0}, {'t', 2, 7796, 0}, {'s', 1, 7798, 0},
+    {'h', 1, 7799, 0}, {'o', 1, 7800, 0}, {';', 0, 7801, 1366}, {';', 0, 7801, 1370}, {'r', 1, 7801, 0}, {';', 0, 7802, 1398},
+    {'r', 1, 7802, 0}, {';', 0, 7803, 1404}, {'q', 1, 7803, 0}, {';', 0, 7804, 1412}, {'o', 1, 7804, 0}, {'e', 1, 7805, 0},
+    {'p', 1, 7806, 0}, {'d', 1, 7807, 0}, {';', 0, 7808, 1435}, {'p', 1, 7808, 0}, {'r', 1, 7809, 0}, {'g', 1, 7810, 0},
+    {'r', 1, 7811, 0}, {';', 0, 7812, 1465}, {';', 0, 7812, 1467}, {'s', 1, 7812, 0}, {'t', 1, 7813, 0}, {';', 0, 7814, 1485},
+    {';', 0, 7814, 1491}, {'n', 1, 7814, 0}, {'r', 1, 7815, 0}, {'g', 1, 7816, 0}, {'n', 1, 7817, 0}, {'t', 1, 7818, 0},
+    {';', 0, 7819, 1533}, {';', 0, 7819, 1534}, {';', 0, 7819, 1535}, {';', 0, 7819, 1537}, {';', 0, 7819, 1538}, {';', 0, 7819, 1539},
+    {'e', 1, 7819, 0}, {';', 0, 7820, 1544}, {';', 0, 7820, 1549}, {'r', 1, 7820, 0}, {'i', 1, 7821, 0}, {'a', 1, 7822, 0},
+    {';', 0, 7823, 1568}, {';', 0, 7823, 1569}, {';', 0, 7823, 1573}, {'e', 1, 7823, 0}, {';', 0, 7824, 1577}, {';', 0, 7824, 1581},
+    {'e', 1, 7824, 0}, {'l', 1, 7825, 0}, {';', 0, 7826, 1602}, {';', 0, 7826, 1606}, {';', 0, 7826, 1608}, {';', 0, 7826, 1613},
+    {';', 0, 7826, 1640}, {';', 0, 7826, 1645}, {';', 0, 7826, 1656}, {';', 0, 7826, 1663}, {'s', 1, 7826, 0}, {'l', 1, 7827, 0},
+    {';', 0, 7828, 1688}, {'r', 1, 7828, 0}, {';', 0, 7829, 1698}, {'r', 1, 7829, 0}, {';', 0, 7830, 1703}, {';', 0, 7830, 1709},
+    {';', 0, 7830, 1710}, {'t', 1, 7830, 0}, {'r', 1, 7831, 0}, {'l', 1, 7832, 0}, {'p', 1, 7833, 0}, {'q', 1, 7834, 0},
+    {'m', 1, 7835, 0}, {';', 0, 7836, 1728}, {'r', 1, 7836, 0}, {'e', 1, 7837, 0}, {'f', 1, 7838, 0}, {'i', 1, 7839, 0},
+    {';', 0, 7840, 1751}, {';', 0, 7840, 1753}, {'v', 1, 7840, 0}, {';', 0, 7841, 1774}, {';', 0, 7841, 1780}, {'l', 1, 7841, 0},
+    {';', 0, 7842, 1791}, {';', 0, 7842, 1792}, {';', 0, 7842, 1799}, {';', 0, 7842, 1804}, {'t', 1, 7842, 0}, {'r', 1, 7843, 0},
+    {'r', 1, 7844, 0}, {'f', 1, 7845, 0}, {'g', 1, 7846, 0}, {'u', 1, 7847, 0}, {'r', 1, 7848, 0}, {'o', 1, 7849, 0},
+    {'c', 1, 7850, 0}, {';', 0, 7851, 1841}, {'t', 1, 7851, 0}, {'i', 1, 7852, 0}, {';', 0, 7853, 1858}, {'t', 1, 7853, 0},
+    {';', 0, 7854, 1882}, {'s', 1, 7854, 0}, {'d', 1, 7855, 0}, {'r', 1, 7856, 0}, {';', 0, 7857, 1911}, {';', 0, 7857, 1912},
+    {'t', 1, 7857, 0}, {'l', 1, 7858, 0}, {'i', 1, 7859, 0}, {'t', 2, 7860, 0}, {'t', 2, 7862, 0}, {'t', 2, 7864, 0},
+    {';', 0, 7866, 1960}, {';', 0, 7866, 1961}, {';', 0, 7866, 1964}, {';', 0, 7866, 1965}, {'q', 2, 7866, 0}, {'e', 1, 7868, 0},
+    {'r', 1, 7869, 0}, {'l', 1, 7870, 0}, {'p', 1, 7871, 0}, {'q', 1, 7872, 0}, {'m', 1, 7873, 0}, {';', 0, 7874, 1981},
+    {';', 0, 7874, 1993}, {';', 0, 7874, 1995}, {';', 0, 7874, 1996}, {';', 0, 7874, 1997}, {';', 0, 7874, 1998}, {';', 0, 7874, 1999},
+    {';', 0, 7874, 2002}, {'q', 2, 7874, 0}, {'e', 1, 7876, 0}, {';', 0, 7877, 2014}, {'r', 1, 7877, 0}, {'m', 1, 7878, 0},
+    {'p', 1, 7879, 0}, {'m', 1, 7880, 0}, {'r', 1, 7881, 0}, {';', 0, 7882, 2051}, {'e', 5, 7882, 0}, {'s', 1, 7887, 0},
+    {';', 0, 7888, 2065}, {';', 0, 7888, 2067}, {'m', 1, 7888, 0}, {'l', 1, 7889, 0}, {'r', 1, 7890, 0}, {'r', 1, 7891, 0},
+    {';', 0, 7892, 2105}, {'r', 1, 7892, 0}, {'o', 1, 7893, 0}, {';', 0, 7894, 2112}, {'o', 1, 7894, 0}, {'r', 1, 7895, 0},
+    {';', 0, 7896, 2127}, {'l', 1, 7896, 0}, {'a', 1, 7897, 0}, {'i', 1, 7898, 0}, {'t', 1, 7899, 0}, {'a', 1, 7900, 0},
+    {'e', 1, 7901, 0}, {'e', 1, 7902, 0}, {'a', 1, 7903, 0}, {'n', 1, 7904, 0}, {';', 0, 7905, 2169}, {';', 0, 7905, 2227},
+    {'c', 1, 7905, 0}, {'h', 1, 7906, 0}, {'i', 1, 7907, 0}, {'i', 1, 7908, 0}, {'t', 1, 7909, 0}, {'t', 1, 7910, 0},
+    {'n', 1, 7911, 0}, {'u', 1, 7912, 0}, {'m', 1, 7913, 0}, {'e', 1, 7914, 0}, {'l', 1, 7915, 0}, {'t', 1, 7916, 0},
+    {'n', 1, 7917, 0}, {'t', 1, 7918, 0}, {'l', 1, 7919, 0}, {';', 0, 7920, 77}, {'c', 1, 7920, 0}, {'t', 1, 7921, 0},
+    {';', 0, 7922, 99}, {'n', 1, 7922, 0}, {'t', 1, 7923, 0}, {'w', 1, 7924, 0}, {'f', 1, 7925, 0}, {'n', 1, 7926, 0},
+    {'g', 1, 7927, 0}, {'A', 1, 7928, 0}, {'D', 1, 7929, 0}, {'r', 1, 7930, 0}, {'w', 3, 7931, 0}, {'e', 1, 7934, 0},
+    {'R', 1, 7935, 0}, {'T', 1, 7936, 0}, {'V', 1, 7937, 0}, {'t', 2, 7938, 0}, {'r', 1, 7940, 0}, {'w', 1, 7941, 0},
+    {'l', 1, 7942, 0}, {'y', 1, 7943, 0}, {'d', 1, 7944, 0}, {'i', 1, 7945, 0}, {'i', 1, 7946, 0}, {'a', 1, 7947, 0},
+    {'r', 1, 7948, 0}, {'r', 1, 7949, 0}, {'q', 1, 7950, 0}, {'u', 1, 7951, 0}, {'r', 1, 7952, 0}, {'e', 1, 7953, 0},
+    {'l', 1, 7954, 0}, {'i', 1, 7955, 0}, {'p', 1, 7956, 0}, {'a', 1, 7957, 0}, {'H', 1, 7958, 0}, {'l', 1, 7959, 0},
+    {'y', 1, 7960, 0}, {';', 0, 7961, 219}, {'t', 1, 7961, 0}, {'e', 2, 7962, 0}, {'r', 1, 7964, 0}, {'e', 1, 7965, 0},
+    {'w', 3, 7966, 0}, {'i', 1, 7969, 0}, {'l', 1, 7970, 0}, {'T', 1, 7971, 0}, {'V', 1, 7972, 0}, {'r', 1, 7973, 0},
+    {'t', 2, 7974, 0}, {'r', 1, 7976, 0}, {'e', 1, 7977, 0}, {'n', 1, 7978, 0}, {'w', 1, 7979, 0}, {'e', 1, 7980, 0},
+    {'c', 1, 7981, 0}, {'o', 1, 7982, 0}, {'w', 1, 7983, 0}, {'t', 1, 7984, 0}, {'l', 1, 7985, 0}, {'E', 1, 7986, 0},
+    {'t', 1, 7987, 0}, {';', 0, 7988, 286}, {'t', 1, 7988, 0}, {'e', 1, 7989, 0}, {'o', 1, 7990, 0}, {'A', 1, 7991, 0},
+    {'R', 1, 7992, 0}, {'t', 1, 7993, 0}, {'a', 1, 7994, 0}, {'r', 1, 7995, 0}, {'t', 1, 7996, 0}, {'t', 1, 7997, 0},
+    {'h', 1, 7998, 0}, {'a', 1, 7999, 0}, {'f', 1, 8000, 0}, {'s', 1, 8001, 0}, {'M', 1, 8002, 0}, {'T', 1, 8003, 0},
+    {'V', 1, 8004, 0}, {'e', 1, 8005, 0}, {'s', 1, 8006, 0}, {'i', 1, 8007, 0}, {'u', 1, 8008, 0}, {'p', 1, 8009, 0},
+    {'e', 1, 8010, 0}, {'n', 1, 8011, 0}, {';', 0, 8012, 336}, {'T', 1, 8012, 0}, {'s', 1, 8013, 0}, {'e', 1, 8014, 0},
+    {'o', 1, 8015, 0}, {'q', 1, 8016, 0}, {'r', 1, 8017, 0}, {'q', 1, 8018, 0}, {'r', 1, 8019, 0}, {'e', 1, 8020, 0},
+    {'l', 1, 8021, 0}, {'i', 1, 8022, 0}, {'d', 2, 8023, 0}, {'d', 1, 8025, 0}, {'s', 1, 8026, 0}, {'T', 1, 8027, 0},
+    {'e', 1, 8028, 0}, {'t', 2, 8029, 0}, {'e', 1, 8031, 0}, {'s', 1, 8032, 0}, {';', 0, 8033, 378}, {'E', 1, 8033, 0},
+    {'F', 1, 8034, 0}, {'T', 1, 8035, 0}, {'c', 1, 8036, 0}, {'y', 2, 8037, 0}, {'e', 1, 8039, 0}, {'k', 1, 8040, 0},
+    {'n', 1, 8041, 0}, {';', 0, 8042, 416}, {'s', 1, 8042, 0}, {'p', 1, 8043, 0}, {';', 0, 8044, 425}, {'E', 1, 8044, 0},
+    {'S', 1, 8045, 0}, {'T', 1, 8046, 0}, {'o', 1, 8047, 0}, {'l', 1, 8048, 0}, {'q', 1, 8049, 0}, {'p', 1, 8050, 0},
+    {'l', 1, 8051, 0}, {'o', 1, 8052, 0}, {'l', 1, 8053, 0}, {'b', 1, 8054, 0}, {'n', 2, 8055, 0}, {'o', 1, 8057, 0},
+    {';', 0, 8058, 466}, {'A', 1, 8058, 0}, {'V', 1, 8059, 0}, {'a', 1, 8060, 0}, {'o', 1, 8061, 0}, {'e', 1, 8062, 0},
+    {'e', 1, 8063, 0}, {'t', 1, 8064, 0}, {'o', 1, 8065, 0}, {'l', 1, 8066, 0}, {'r', 1, 8067, 0}, {'y', 1, 8068, 0},
+    {'n', 1, 8069, 0}, {'t', 1, 8070, 0}, {'h', 1, 8071, 0}, {'r', 1, 8072, 0}, {'c', 1, 8073, 0}, {'t', 1, 8074, 0},
+    {'b', 1, 8075, 0}, {'p', 1, 8076, 0}, {'i', 1, 8077, 0}, {'u', 1, 8078, 0}, {';', 0, 8079, 515}, {'E', 1, 8079, 0},
+    {'S', 1, 8080, 0}, {'T', 1, 8081, 0}, {';', 0, 8082, 519}, {';', 0, 8082, 522}, {'E', 1, 8082, 0}, {'e', 1, 8083, 0},
+    {'c', 1, 8084, 0}, {'e', 1, 8085, 0}, {'a', 1, 8086, 0}, {'l', 1, 8087, 0}, {'d', 1, 8088, 0}, {'t', 1, 8089, 0},
+    {';', 0, 8090, 551}, {';', 0, 8090, 562}, {'c', 2, 8090, 0}, {'e', 1, 8092, 0}, {'s', 1, 8093, 0}, {'a', 1, 8094, 0},
+    {'o', 1, 8095, 0}, {'r', 1, 8096, 0}, {'b', 1, 8097, 0}, {'o', 1, 8098, 0}, {'r', 1, 8099, 0}, {'t', 1, 8100, 0},
+    {'h', 1, 8101, 0}, {'B', 1, 8102, 0}, {'L', 1, 8103, 0}, {'S', 1, 8104, 0}, {'T', 1, 8105, 0}, {'S', 1, 8106, 0},
+    {'h', 1, 8107, 0}, {';', 0, 8108, 662}, {';', 0, 8108, 668}, {';', 0, 8108, 669}, {';', 0, 8108, 670}, {';', 0, 8108, 671},
+    {';', 0, 8108, 672}, {';', 0, 8108, 673}, {';', 0, 8108, 674}, {';', 0, 8108, 675}, {';', 0, 8108, 678}, {';', 0, 8108, 691},
+    {';', 0, 8108, 702}, {';', 0, 8108, 705}, {'l', 1, 8108, 0}, {'e', 1, 8109, 0}, {'q', 1, 8110, 0}, {';', 0, 8111, 712},
+    {';', 0, 8111, 714}, {';', 0, 8111, 731}, {'s', 1, 8111, 0}, {';', 0, 8112, 733}, {'g', 1, 8112, 0}, {';', 0, 8113, 737},
+    {';', 0, 8113, 739}, {'e', 1, 8113, 0}, {'a', 1, 8114, 0}, {'a', 1, 8115, 0}, {';', 0, 8116, 789}, {';', 0, 8116, 791},
+    {';', 0, 8116, 813}, {';', 0, 8116, 823}, {'t', 1, 8116, 0}, {'k', 1, 8117, 0}, {'r', 1, 8118, 0}, {';', 0, 8119, 855},
+    {';', 0, 8119, 856}, {'s', 1, 8119, 0}, {'i', 1, 8120, 0}, {'a', 1, 8121, 0}, {';', 0, 8122, 861}, {';', 0, 8122, 865},
+    {'n', 1, 8122, 0}, {'s', 1, 8123, 0}, {';', 0, 8124, 898}, {'r', 1, 8124, 0}, {'u', 1, 8125, 0}, {';', 0, 8126, 908},
+    {'g', 1, 8126, 0}, {'o', 1, 8127, 0}, {';', 0, 8128, 916}, {'u', 1, 8128, 0}, {'t', 1, 8129, 0}, {';', 0, 8130, 961},
+    {';', 0, 8130, 962}, {'e', 1, 8130, 0}, {'r', 1, 8131, 0}, {'w', 1, 8132, 0}, {'a', 1, 8133, 0}, {'o', 1, 8134, 0},
+    {';', 0, 8135, 970}, {';', 0, 8135, 984}, {';', 0, 8135, 1006}, {';', 0, 8135, 1012}, {'t', 1, 8135, 0}, {'e', 1, 8136, 0},
+    {';', 0, 8137, 1036}, {'i', 1, 8137, 0}, {'i', 1, 8138, 0}, {'o', 1, 8139, 0}, {';', 0, 8140, 1069}, {';', 0, 8140, 1105},
+    {';', 0, 8140, 1110}, {';', 0, 8140, 1124}, {'x', 1, 8140, 0}, {'s', 1, 8141, 0}, {'s', 1, 8142, 0}, {'q', 1, 8143, 0},
+    {'t', 1, 8144, 0}, {';', 0, 8145, 1166}, {';', 0, 8145, 1167}, {'a', 1, 8145, 0}, {'t', 1, 8146, 0}, {';', 0, 8147, 1200},
+    {';', 0, 8147, 1201}, {';', 0, 8147, 1208}, {';', 0, 8147, 1212}, {';', 0, 8147, 1213}, {';', 0, 8147, 1214}, {';', 0, 8147, 1261},
+    {';', 0, 8147, 1299}, {'w', 2, 8147, 0}, {'o', 1, 8149, 0}, {'a', 1, 8150, 0}, {'t', 3, 8151, 0}, {'e', 1, 8154, 0},
+    {';', 0, 8155, 1315}, {';', 0, 8155, 1320}, {'o', 1, 8155, 0}, {'r', 1, 8156, 0}, {'t', 1, 8157, 0}, {';', 0, 8158, 1341},
+    {'h', 1, 8158, 0}, {';', 0, 8159, 1349}, {'a', 1, 8159, 0}, {'r', 1, 8160, 0}, {'t', 1, 8161, 0}, {'t', 1, 8162, 0},
+    {'w', 2, 8163, 0}, {';', 0, 8165, 1375}, {';', 0, 8165, 1403}, {'q', 1, 8165, 0}, {'w', 1, 8166, 0}, {'f', 1, 8167, 0},
+    {';', 0, 8168, 1417}, {'a', 1, 8168, 0}, {';', 0, 8169, 1445}, {'o', 1, 8169, 0}, {'h', 1, 8170, 0}, {'r', 1, 8171, 0},
+    {';', 0, 8172, 1468}, {';', 0, 8172, 1477}, {'t', 1, 8172, 0}, {'o', 1, 8173, 0}, {'h', 1, 8174, 0}, {'t', 1, 8175, 0},
+    {';', 0, 8176, 1532}, {'l', 1, 8176, 0}, {'r', 1, 8177, 0}, {'d', 1, 8178, 0}, {'r', 1, 8179, 0}, {'q', 2, 8180, 0},
+    {'q', 2, 8182, 0}, {'e', 2, 8184, 0}, {';', 0, 8186, 1672}, {';', 0, 8186, 1679}, {'k', 1, 8186, 0}, {';', 0, 8187, 1701},
+    {';', 0, 8187, 1712}, {'o', 1, 8187, 0}, {'y', 1, 8188, 0}, {'r', 1, 8189, 0}, {';', 0, 8190, 1726}, {';', 0, 8190, 1727},
+    {';', 0, 8190, 1735}, {';', 0, 8190, 1736}, {';', 0, 8190, 1737}, {'o', 1, 8190, 0}, {';', 0, 8191, 1764}, {'s', 1, 8191, 0},
+    {';', 0, 8192, 1805}, {'o', 1, 8192, 0}, {'p', 1, 8193, 0}, {'t', 2, 8194, 0}, {'h', 1, 8196, 0}, {'i', 1, 8197, 0},
+    {'e', 1, 8198, 0}, {'t', 1, 8199, 0}, {'h', 1, 8200, 0}, {';', 0, 8201, 1844}, {';', 0, 8201, 1857}, {';', 0, 8201, 1873},
+    {';', 0, 8201, 1887}, {';', 0, 8201, 1895}, {'a', 1, 8201, 0}, {'m', 1, 8202, 0}, {';', 0, 8203, 1916}, {'t', 1, 8203, 0},
+    {';', 0, 8204, 1936}, {'e', 1, 8204, 0}, {';', 0, 8205, 1940}, {'e', 1, 8205, 0}, {'e', 1, 8206, 0}, {'p', 1, 8207, 0},
+    {';', 0, 8208, 1967}, {'q', 1, 8208, 0}, {'q', 2, 8209, 0}, {'o', 1, 8211, 0}, {'y', 1, 8212, 0}, {'r', 1, 8213, 0},
+    {';', 0, 8214, 1979}, {';', 0, 8214, 1980}, {';', 0, 8214, 2004}, {'q', 1, 8214, 0}, {'q', 2, 8215, 0}, {'e', 1, 8217, 0},
+    {';', 0, 8218, 2030}, {'r', 1, 8218, 0}, {';', 0, 8219, 2033}, {';', 0, 8219, 2043}, {';', 0, 8219, 2055}, {'d', 1, 8219, 0},
+    {'l', 1, 8220, 0}, {'q', 1, 8221, 0}, {'r', 1, 8222, 0}, {';', 0, 8223, 2064}, {';', 0, 8223, 2068}, {'e', 1, 8223, 0},
+    {'i', 1, 8224, 0}, {';', 0, 8225, 2097}, {'r', 1, 8225, 0}, {'n', 2, 8226, 0}, {'w', 1, 8228, 0}, {';', 0, 8229, 2115},
+    {'o', 1, 8229, 0}, {';', 0, 8230, 2134}, {'n', 1, 8230, 0}, {'o', 1, 8231, 0}, {';', 0, 8232, 2141}, {'t', 1, 8232, 0},
+    {'t', 1, 8233, 0}, {';', 0, 8234, 2146}, {'g', 1, 8234, 0}, {'t', 1, 8235, 0}, {';', 0, 8236, 28}, {'s', 1, 8236, 0},
+    {'f', 1, 8237, 0}, {';', 0, 8238, 54}, {';', 0, 8238, 57}, {'u', 1, 8238, 0}, {'s', 1, 8239, 0}, {'e', 1, 8240, 0},
+    {'C', 1, 8241, 0}, {'y', 2, 8242, 0}, {';', 0, 8244, 66}, {'t', 1, 8244, 0}, {';', 0, 8245, 70}, {'o', 1, 8245, 0},
+    {'a', 1, 8246, 0}, {'i', 1, 8247, 0}, {'t', 1, 8248, 0}, {';', 0, 8249, 101}, {'n', 1, 8249, 0}, {'t', 3, 8250, 0},
+    {'g', 2, 8253, 0}, {'h', 1, 8255, 0}, {'r', 1, 8256, 0}, {'o', 1, 8257, 0}, {'t', 1, 8258, 0}, {';', 0, 8259, 114},
+    {'B', 1, 8259, 0}, {'U', 1, 8260, 0}, {';', 0, 8261, 117}, {'i', 1, 8261, 0}, {'e', 1, 8262, 0}, {'e', 1, 8263, 0},
+    {'T', 1, 8264, 0}, {'V', 1, 8265, 0}, {'r', 1, 8266, 0}, {';', 0, 8267, 127}, {'l', 1, 8267, 0}, {'S', 1, 8268, 0},
+    {'e', 1, 8269, 0}, {'u', 1, 8270, 0}, {'a', 1, 8271, 0}, {'l', 1, 8272, 0}, {'y', 1, 8273, 0}, {'f', 1, 8274, 0},
+    {'u', 1, 8275, 0}, {'l', 1, 8276, 0}, {'e', 1, 8277, 0}, {'s', 1, 8278, 0}, {'a', 1, 8279, 0}, {'l', 1, 8280, 0},
+    {'a', 1, 8281, 0}, {'l', 1, 8282, 0}, {'u', 1, 8283, 0}, {';', 0, 8284, 201}, {'I', 1, 8284, 0}, {'i', 1, 8285, 0},
+    {'C', 1, 8286, 0}, {'T', 1, 8287, 0}, {'f', 1, 8288, 0}, {'B', 1, 8289, 0}, {';', 0, 8290, 258}, {'B', 1, 8290, 0},
+    {'R', 1, 8291, 0}, {'n', 1, 8292, 0}, {'e', 1, 8293, 0}, {'e', 1, 8294, 0}, {'e', 1, 8295, 0}, {';', 0, 8296, 266},
+    {'A', 1, 8296, 0}, {'V', 1, 8297, 0}, {'r', 1, 8298, 0}, {'c', 1, 8299, 0}, {'g', 1, 8300, 0}, {'n', 1, 8301, 0},
+    {'V', 1, 8302, 0}, {'t', 1, 8303, 0}, {'r', 2, 8304, 0}, {';', 0, 8306, 281}, {'a', 1, 8306, 0}, {'G', 1, 8307, 0},
+    {'q', 1, 8308, 0}, {'e', 1, 8309, 0}, {'E', 1, 8310, 0}, {';', 0, 8311, 288}, {'w', 1, 8311, 0}, {'r', 1, 8312, 0},
+    {'i', 1, 8313, 0}, {'A', 1, 8314, 0}, {'r', 1, 8315, 0}, {'i', 1, 8316, 0}, {'a', 1, 8317, 0}, {'A', 1, 8318, 0},
+    {'t', 1, 8319, 0}, {'c', 1, 8320, 0}, {';', 0, 8321, 309}, {';', 0, 8321, 311}, {'e', 1, 8321, 0}, {'h', 1, 8322, 0},
+    {'e', 1, 8323, 0}, {'a', 1, 8324, 0}, {'s', 1, 8325, 0}, {'n', 1, 8326, 0}, {'e', 1, 8327, 0}, {';', 0, 8328, 333},
+    {'V', 1, 8328, 0}, {'t', 1, 8329, 0}, {'i', 1, 8330, 0}, {';', 0, 8331, 338}, {'r', 7, 8331, 0}, {'w', 1, 8338, 0},
+    {'u', 1, 8339, 0}, {'i', 1, 8340, 0}, {'u', 1, 8341, 0}, {'e', 1, 8342, 0}, {'s', 1, 8343, 0}, {'a', 1, 8344, 0},
+    {'l', 1, 8345, 0}, {'G', 1, 8346, 0}, {'L', 1, 8347, 0}, {'e', 1, 8348, 0}, {'e', 1, 8349, 0}, {'r', 1, 8350, 0},
+    {'S', 1, 8351, 0}, {';', 0, 8352, 370}, {'E', 1, 8352, 0}, {'d', 1, 8353, 0}, {'e', 1, 8354, 0}, {'q', 1, 8355, 0},
+    {'u', 1, 8356, 0}, {'i', 1, 8357, 0}, {'a', 1, 8358, 0}, {'D', 1, 8359, 0}, {'Q', 1, 8360, 0}, {';', 0, 8361, 413},
+    {'e', 1, 8361, 0}, {'t', 1, 8362, 0}, {';', 0, 8363, 421}, {'l', 1, 8363, 0}, {'q', 1, 8364, 0}, {'l', 1, 8365, 0},
+    {'i', 1, 8366, 0}, {'n', 2, 8367, 0}, {'e', 1, 8369, 0}, {'u', 1, 8370, 0}, {'E', 1, 8371, 0}, {'e', 1, 8372, 0},
+    {'w', 3, 8373, 0}, {'i', 1, 8376, 0}, {'l', 1, 8377, 0}, {'T', 1, 8378, 0}, {'V', 1, 8379, 0}, {'r', 1, 8380, 0},
+    {'r', 1, 8381, 0}, {'e', 1, 8382, 0}, {'n', 1, 8383, 0}, {'w', 1, 8384, 0}, {'e', 1, 8385, 0}, {'c', 1, 8386, 0},
+    {'o', 1, 8387, 0}, {'w', 1, 8388, 0}, {'i', 1, 8389, 0}, {'o', 1, 8390, 0}, {'e', 1, 8391, 0}, {'A', 1, 8392, 0},
+    {'A', 1, 8393, 0}, {'t', 1, 8394, 0}, {'r', 1, 8395, 0}, {'l', 1, 8396, 0}, {'e', 1, 8397, 0}, {'s', 1, 8398, 0},
+    {'e', 1, 8399, 0}, {'o', 1, 8400, 0}, {'a', 1, 8401, 0}, {'q', 1, 8402, 0}, {'l', 1, 8403, 0}, {'i', 1, 8404, 0},
+    {'q', 1, 8405, 0}, {';', 0, 8406, 536}, {'e', 1, 8406, 0}, {';', 0, 8407, 539}, {'l', 1, 8407, 0}, {'E', 1, 8408, 0},
+    {'e', 1, 8409, 0}, {';', 0, 8410, 545}, {'e', 1, 8410, 0}, {'k', 1, 8411, 0}, {'n', 1, 8412, 0}, {';', 0, 8413, 567},
+    {'r', 1, 8413, 0}, {'w', 1, 8414, 0}, {'o', 1, 8415, 0}, {'r', 1, 8416, 0}, {'w', 1, 8417, 0}, {'o', 1, 8418, 0},
+    {'A', 1, 8419, 0}, {'t', 1, 8420, 0}, {'a', 1, 8421, 0}, {'i', 1, 8422, 0}, {'e', 1, 8423, 0}, {'i', 1, 8424, 0},
+    {'p', 1, 8425, 0}, {'S', 1, 8426, 0}, {'o', 1, 8427, 0}, {';', 0, 8428, 707}, {';', 0, 8428, 709}, {';', 0, 8428, 732},
+    {'l', 1, 8428, 0}, {'n', 1, 8429, 0}, {'r', 1, 8430, 0}, {'n', 1, 8431, 0}, {';', 0, 8432, 843}, {';', 0, 8432, 847},
+    {'o', 1, 8432, 0}, {'t', 1, 8433, 0}, {'r', 1, 8434, 0}, {'s', 1, 8435, 0}, {'t', 1, 8436, 0}, {';', 0, 8437, 874},
+    {'e', 1, 8437, 0}, {'c', 1, 8438, 0}, {'e', 1, 8439, 0}, {'w', 2, 8440, 0}, {'i', 1, 8442, 0}, {'i', 1, 8443, 0},
+    {';', 0, 8444, 964}, {'w', 1, 8444, 0}, {';', 0, 8445, 966}, {'r', 1, 8445, 0}, {'o', 1, 8446, 0}, {'r', 1, 8447, 0},
+    {'s', 1, 8448, 0}, {'o', 1, 8449, 0}, {'a', 1, 8450, 0}, {'t', 1, 8451, 0}, {';', 0, 8452, 1142}, {';', 0, 8452, 1145},
+    {'s', 1, 8452, 0}, {';', 0, 8453, 1149}, {';', 0, 8453, 1162}, {'r', 1, 8453, 0}, {'a', 1, 8454, 0}, {';', 0, 8455, 1302},
+    {'t', 1, 8455, 0}, {'o', 1, 8456, 0}, {'r', 1, 8457, 0}, {'a', 1, 8458, 0}, {'h', 1, 8459, 0}, {'s', 1, 8460, 0},
+    {'t', 1, 8461, 0}, {'x', 1, 8462, 0}, {';', 0, 8463, 1325}, {'r', 1, 8463, 0}, {'e', 1, 8464, 0}, {'r', 1, 8465, 0},
+    {'i', 1, 8466, 0}, {'o', 1, 8467, 0}, {'a', 1, 8468, 0}, {'l', 1, 8469, 0}, {'r', 1, 8470, 0}, {';', 0, 8471, 1405},
+    {'n', 1, 8471, 0}, {'t', 1, 8472, 0}, {'n', 1, 8473, 0}, {'w', 1, 8474, 0}, {'t', 1, 8475, 0}, {'o', 1, 8476, 0},
+    {';', 0, 8477, 1497}, {'w', 1, 8477, 0}, {'t', 1, 8478, 0}, {';', 0, 8479, 1519}, {';', 0, 8479, 1541}, {'o', 1, 8479, 0},
+    {';', 0, 8480, 1561}, {'a', 1, 8480, 0}, {';', 0, 8481, 1574}, {'q', 1, 8481, 0}, {';', 0, 8482, 1582}, {'q', 1, 8482, 0},
+    {'l', 1, 8483, 0}, {'r', 1, 8484, 0}, {';', 0, 8485, 1695}, {'x', 1, 8485, 0}, {'e', 1, 8486, 0}, {'o', 1, 8487, 0},
+    {'n', 1, 8488, 0}, {';', 0, 8489, 1785}, {'w', 2, 8489, 0}, {'o', 1, 8491, 0}, {'a', 1, 8492, 0}, {'h', 1, 8493, 0},
+    {'t', 1, 8494, 0}, {'g', 1, 8495, 0}, {'e', 1, 8496, 0}, {'s', 1, 8497, 0}, {'e', 1, 8498, 0}, {'l', 1, 8499, 0},
+    {'i', 1, 8500, 0}, {';', 0, 8501, 1928}, {'q', 1, 8501, 0}, {'q', 1, 8502, 0}, {'p', 1, 8503, 0}, {'h', 1, 8504, 0},
+    {';', 0, 8505, 1968}, {';', 0, 8505, 1969}, {'q', 1, 8505, 0}, {'x', 1, 8506, 0}, {'e', 1, 8507, 0}, {'o', 1, 8508, 0},
+    {';', 0, 8509, 2005}, {';', 0, 8509, 2006}, {'q', 1, 8509, 0}, {';', 0, 8510, 2028}, {'o', 1, 8510, 0}, {'o', 1, 8511, 0},
+    {'e', 1, 8512, 0}, {';', 0, 8513, 2059}, {'i', 1, 8513, 0}, {'f', 1, 8514, 0}, {'g', 1, 8515, 0}, {'o', 1, 8516, 0},
+    {'l', 1, 8517, 0}, {'r', 1, 8518, 0}, {'s', 1, 8519, 0}, {'n', 1, 8520, 0}, {'g', 1, 8521, 0}, {';', 0, 8522, 2138},
+    {'n', 1, 8522, 0}, {'n', 1, 8523, 0}, {'l', 1, 8524, 0}, {'i', 1, 8525, 0}, {';', 0, 8526, 33}, {'f', 1, 8526, 0},
+    {'s', 1, 8527, 0}, {';', 0, 8528, 59}, {'s', 1, 8528, 0}, {'o', 1, 8529, 0}, {'D', 1, 8530, 0}, {'Q', 1, 8531, 0},
+    {'e', 1, 8532, 0}, {'c', 1, 8533, 0}, {'l', 4, 8534, 0}, {'a', 1, 8538, 0}, {'o', 1, 8539, 0}, {'A', 1, 8540, 0},
+    {'A', 1, 8541, 0}, {'R', 1, 8542, 0}, {'T', 1, 8543, 0}, {'L', 1, 8544, 0}, {'R', 1, 8545, 0}, {'t', 2, 8546, 0},
+    {'r', 1, 8548, 0}, {'w', 1, 8549, 0}, {'i', 1, 8550, 0}, {'a', 1, 8551, 0}, {'p', 1, 8552, 0}, {'g', 1, 8553, 0},
+    {'e', 1, 8554, 0}, {'c', 1, 8555, 0}, {'e', 1, 8556, 0}, {'e', 1, 8557, 0}, {'o', 1, 8558, 0}, {'S', 1, 8559, 0},
+    {'m', 1, 8560, 0}, {';', 0, 8561, 151}, {'m', 1, 8561, 0}, {'l', 1, 8562, 0}, {'l', 1, 8563, 0}, {'S', 1, 8564, 0},
+    {';', 0, 8565, 166}, {'a', 1, 8565, 0}, {'l', 1, 8566, 0}, {'a', 1, 8567, 0}, {'s', 1, 8568, 0}, {'n', 1, 8569, 0},
+    {'d', 1, 8570, 0}, {'c', 1, 8571, 0}, {'L', 1, 8572, 0}, {'m', 1, 8573, 0}, {';', 0, 8574, 216}, {'o', 1, 8574, 0},
+    {'o', 1, 8575, 0}, {'i', 1, 8576, 0}, {';', 0, 8577, 252}, {'r', 1, 8577, 0}, {'a', 1, 8578, 0}, {'i', 1, 8579, 0},
+    {'g', 1, 8580, 0}, {'B', 1, 8581, 0}, {'e', 1, 8582, 0}, {'c', 1, 8583, 0}, {'r', 1, 8584, 0}, {'e', 1, 8585, 0},
+    {'o', 1, 8586, 0}, {'t', 1, 8587, 0}, {'l', 1, 8588, 0}, {'V', 1, 8589, 0}, {'e', 1, 8590, 0}, {'o', 1, 8591, 0},
+    {';', 0, 8592, 279}, {'B', 1, 8592, 0}, {'r', 1, 8593, 0}, {'r', 1, 8594, 0}, {'u', 1, 8595, 0}, {'r', 1, 8596, 0},
+    {'q', 1, 8597, 0}, {';', 0, 8598, 291}, {'r', 1, 8598, 0}, {'g', 1, 8599, 0}, {'r', 1, 8600, 0}, {'r', 1, 8601, 0},
+    {'g', 1, 8602, 0}, {'r', 1, 8603, 0}, {'r', 1, 8604, 0}, {'A', 1, 8605, 0}, {'e', 1, 8606, 0}, {'d', 1, 8607, 0},
+    {'i', 2, 8608, 0}, {'r', 1, 8610, 0}, {'t', 1, 8611, 0}, {'L', 1, 8612, 0}, {'g', 1, 8613, 0}, {'n', 1, 8614, 0},
+    {'e', 1, 8615, 0}, {';', 0, 8616, 335}, {'l', 1, 8616, 0}, {';', 0, 8617, 339}, {'E', 1, 8617, 0}, {'F', 1, 8618, 0},
+    {'G', 1, 8619, 0}, {'L', 1, 8620, 0}, {'S', 1, 8621, 0}, {'T', 1, 8622, 0}, {'n', 1, 8623, 0}, {'a', 1, 8624, 0},
+    {'a', 1, 8625, 0}, {'a', 1, 8626, 0}, {'a', 1, 8627, 0}, {'s', 1, 8628, 0}, {'n', 1, 8629, 0}, {'d', 1, 8630, 0},
+    {'r', 1, 8631, 0}, {'e', 1, 8632, 0}, {'s', 3, 8633, 0}, {'E', 1, 8636, 0}, {'i', 1, 8637, 0}, {'u', 2, 8638, 0},
+    {'q', 1, 8640, 0}, {'s', 4, 8641, 0}, {'t', 2, 8645, 0}, {'u', 1, 8647, 0}, {'l', 1, 8648, 0}, {'l', 1, 8649, 0},
+    {'l', 1, 8650, 0}, {'o', 1, 8651, 0}, {'u', 1, 8652, 0}, {'t', 1, 8653, 0}, {'h', 1, 8654, 0}, {'a', 1, 8655, 0},
+    {'u', 1, 8656, 0}, {'a', 1, 8657, 0}, {'l', 1, 8658, 0}, {';', 0, 8659, 431}, {'a', 1, 8659, 0}, {'m', 1, 8660, 0},
+    {'i', 1, 8661, 0}, {'q', 1, 8662, 0}, {'B', 1, 8663, 0}, {';', 0, 8664, 457}, {'B', 1, 8664, 0}, {'L', 1, 8665, 0},
+    {'n', 1, 8666, 0}, {'e', 1, 8667, 0}, {'e', 1, 8668, 0}, {'e', 1, 8669, 0}, {';', 0, 8670, 465}, {'r', 1, 8670, 0},
+    {'c', 1, 8671, 0}, {'g', 1, 8672, 0}, {'n', 1, 8673, 0}, {'V', 1, 8674, 0}, {'t', 1, 8675, 0}, {'r', 2, 8676, 0},
+    {';', 0, 8678, 478}, {'e', 1, 8678, 0}, {'w', 1, 8679, 0}, {'d', 1, 8680, 0}, {'r', 1, 8681, 0}, {'r', 1, 8682, 0},
+    {'A', 1, 8683, 0}, {'o', 1, 8684, 0}, {'e', 1, 8685, 0}, {'r', 1, 8686, 0}, {'e', 1, 8687, 0}, {'r', 1, 8688, 0},
+    {'n', 1, 8689, 0}, {'l', 1, 8690, 0}, {'u', 1, 8691, 0}, {'a', 1, 8692, 0}, {'l', 1, 8693, 0}, {'u', 1, 8694, 0},
+    {';', 0, 8695, 538}, {';', 0, 8695, 541}, {'q', 1, 8695, 0}, {';', 0, 8696, 543}, {';', 0, 8696, 563}, {'e', 1, 8696, 0},
+    {'t', 1, 8697, 0}, {';', 0, 8698, 571}, {'n', 1, 8698, 0}, {'w', 1, 8699, 0}, {'i', 1, 8700, 0}, {';', 0, 8701, 576},
+    {'w', 1, 8701, 0}, {'r', 1, 8702, 0}, {'A', 1, 8703, 0}, {'r', 1, 8704, 0}, {'n', 1, 8705, 0}, {'p', 1, 8706, 0},
+    {'l', 1, 8707, 0}, {'a', 1, 8708, 0}, {'p', 1, 8709, 0}, {'n', 1, 8710, 0}, {'e', 2, 8711, 0}, {'g', 1, 8713, 0},
+    {'e', 1, 8714, 0}, {'g', 1, 8715, 0}, {'w', 2, 8716, 0}, {';', 0, 8718, 857}, {'c', 1, 8718, 0}, {'h', 1, 8719, 0},
+    {';', 0, 8720, 873}, {'c', 1, 8720, 0}, {'c', 1, 8721, 0}, {';', 0, 8722, 909}, {'l', 1, 8722, 0}, {'r', 1, 8723, 0},
+    {'t', 1, 8724, 0}, {'m', 1, 8725, 0}, {'e', 1, 8726, 0}, {'r', 1, 8727, 0}, {'n', 2, 8728, 0}, {';', 0, 8730, 1030},
+    {'s', 1, 8730, 0}, {'n', 1, 8731, 0}, {'l', 1, 8732, 0}, {'s', 1, 8733, 0}, {';', 0, 8734, 1146}, {'r', 1, 8734, 0},
+    {'r', 1, 8735, 0}, {'a', 1, 8736, 0}, {'n', 2, 8737, 0}, {'r', 1, 8739, 0}, {'r', 1, 8740, 0}, {'a', 1, 8741, 0},
+    {'q', 1, 8742, 0}, {'i', 1, 8743, 0}, {';', 0, 8744, 1323}, {';', 0, 8744, 1326}, {';', 0, 8744, 1346}, {'r', 1, 8744, 0},
+    {'g', 1, 8745, 0}, {';', 0, 8746, 1359}, {'r', 1, 8746, 0}, {'e', 1, 8747, 0}, {'i', 1, 8748, 0}, {';', 0, 8749, 1415},
+    {';', 0, 8749, 1416}, {'g', 1, 8749, 0}, {';', 0, 8750, 1450}, {'a', 1, 8750, 0}, {'w', 1, 8751, 0}, {';', 0, 8752, 1515},
+    {'a', 1, 8752, 0}, {'w', 1, 8753, 0}, {'l', 1, 8754, 0}, {';', 0, 8755, 1575}, {';', 0, 8755, 1583}, {'e', 1, 8755, 0},
+    {'i', 1, 8756, 0}, {';', 0, 8757, 1722}, {'q', 1, 8757, 0}, {'x', 1, 8758, 0}, {'s', 1, 8759, 0}, {';', 0, 8760, 1818},
+    {'t', 1, 8760, 0}, {'o', 1, 8761, 0}, {'r', 1, 8762, 0}, {'a', 1, 8763, 0}, {'a', 1, 8764, 0}, {'a', 1, 8765, 0},
+    {'t', 1, 8766, 0}, {'e', 1, 8767, 0}, {';', 0, 8768, 1833}, {'l', 1, 8768, 0}, {'n', 1, 8769, 0}, {';', 0, 8770, 1937},
+    {';', 0, 8770, 1941}, {'s', 1, 8770, 0}, {'i', 1, 8771, 0}, {';', 0, 8772, 1970}, {';', 0, 8772, 1975}, {'q', 1, 8772, 0},
+    {'x', 1, 8773, 0}, {';', 0, 8774, 2007}, {'x', 1, 8774, 0}, {'w', 1, 8775, 0}, {'f', 1, 8776, 0}, {'g', 1, 8777, 0},
+    {'t', 1, 8778, 0}, {'h', 1, 8779, 0}, {'w', 1, 8780, 0}, {'e', 1, 8781, 0}, {'i', 1, 8782, 0}, {';', 0, 8783, 2113},
+    {';', 0, 8783, 2133}, {';', 0, 8783, 2135}, {'e', 1, 8783, 0}, {'e', 1, 8784, 0}, {'e', 2, 8785, 0}, {'o', 1, 8787, 0},
+    {'e', 1, 8788, 0}, {';', 0, 8789, 58}, {';', 0, 8789, 60}, {'n', 1, 8789, 0}, {'o', 1, 8790, 0}, {'u', 1, 8791, 0},
+    {'g', 1, 8792, 0}, {'k', 1, 8793, 0}, {'A', 1, 8794, 0}, {'D', 1, 8795, 0}, {'G', 1, 8796, 0}, {'T', 1, 8797, 0},
+    {'l', 1, 8798, 0}, {'u', 1, 8799, 0}, {'r', 1, 8800, 0}, {'r', 1, 8801, 0}, {'i', 1, 8802, 0}, {'e', 1, 8803, 0},
+    {'e', 1, 8804, 0}, {'i', 1, 8805, 0}, {'A', 1, 8806, 0}, {'T', 1, 8807, 0}, {'o', 1, 8808, 0}, {'n', 1, 8809, 0},
+    {'c', 1, 8810, 0}, {'r', 1, 8811, 0}, {'A', 1, 8812, 0}, {'h', 1, 8813, 0}, {'V', 1, 8814, 0}, {'t', 1, 8815, 0},
+    {'e', 1, 8816, 0}, {'c', 1, 8817, 0}, {'w', 1, 8818, 0}, {'q', 1, 8819, 0}, {'a', 1, 8820, 0}, {';', 0, 8821, 152},
+    {'E', 1, 8821, 0}, {'S', 1, 8822, 0}, {'m', 1, 8823, 0}, {'l', 2, 8824, 0}, {'E', 1, 8826, 0}, {'t', 1, 8827, 0},
+    {';', 0, 8828, 185}, {'t', 1, 8828, 0}, {'e', 1, 8829, 0}, {'e', 1, 8830, 0}, {'i', 1, 8831, 0}, {'p', 1, 8832, 0},
+    {'n', 1, 8833, 0}, {'m', 1, 8834, 0}, {'m', 1, 8835, 0}, {'a', 1, 8836, 0}, {'r', 1, 8837, 0}, {'g', 1, 8838, 0},
+    {';', 0, 8839, 261}, {'r', 1, 8839, 0}, {'V', 1, 8840, 0}, {'t', 1, 8841, 0}, {'r', 1, 8842, 0}, {'c', 1, 8843, 0},
+    {'w', 1, 8844, 0}, {'o', 1, 8845, 0}, {'e', 3, 8846, 0}, {'e', 1, 8849, 0}, {'c', 1, 8850, 0}, {'r', 2, 8851, 0},
+    {'a', 1, 8853, 0}, {'r', 1, 8854, 0}, {'e', 1, 8855, 0}, {'a', 1, 8856, 0}, {';', 0, 8857, 285}, {'u', 1, 8857, 0},
+    {'o', 1, 8858, 0}, {'h', 1, 8859, 0}, {'r', 1, 8860, 0}, {'o', 1, 8861, 0}, {'h', 1, 8862, 0}, {'r', 1, 8863, 0},
+    {'r', 1, 8864, 0}, {'r', 1, 8865, 0}, {';', 0, 8866, 308}, {'i', 1, 8866, 0}, {'c', 1, 8867, 0}, {'n', 1, 8868, 0},
+    {'y', 1, 8869, 0}, {'e', 1, 8870, 0}, {'e', 1, 8871, 0}, {'S', 1, 8872, 0}, {'t', 1, 8873, 0}, {'r', 1, 8874, 0},
+    {'d', 1, 8875, 0}, {'q', 1, 8876, 0}, {'u', 1, 8877, 0}, {'r', 1, 8878, 0}, {'e', 1, 8879, 0}, {'l', 1, 8880, 0},
+    {'i', 1, 8881, 0}, {'H', 1, 8882, 0}, {'l', 1, 8883, 0}, {'n', 1, 8884, 0}, {'l', 1, 8885, 0}, {'t', 1, 8886, 0},
+    {';', 0, 8887, 354}, {'t', 1, 8887, 0}, {'e', 1, 8888, 0}, {'e', 1, 8889, 0}, {'s', 1, 8890, 0}, {';', 0, 8891, 359},
+    {'E', 1, 8891, 0}, {'S', 1, 8892, 0}, {'l', 1, 8893, 0}, {'a', 1, 8894, 0}, {'b', 1, 8895, 0}, {'p', 1, 8896, 0},
+    {'u', 1, 8897, 0}, {';', 0, 8898, 372}, {'E', 1, 8898, 0}, {'S', 1, 8899, 0}, {'T', 1, 8900, 0}, {';', 0, 8901, 376},
+    {'E', 1, 8901, 0}, {'a', 1, 8902, 0}, {'l', 1, 8903, 0}, {'d', 1, 8904, 0}, {'B', 1, 8905, 0}, {'u', 1, 8906, 0},
+    {'o', 1, 8907, 0}, {';', 0, 8908, 414}, {'e', 1, 8908, 0}, {'n', 1, 8909, 0}, {'a', 1, 8910, 0}, {'n', 1, 8911, 0},
+    {'d', 1, 8912, 0}, {'l', 1, 8913, 0}, {'e', 1, 8914, 0}, {'l', 1, 8915, 0}, {'u', 1, 8916, 0}, {'r', 1, 8917, 0},
+    {'a', 1, 8918, 0}, {'e', 1, 8919, 0}, {'g', 1, 8920, 0}, {'B', 1, 8921, 0}, {'e', 1, 8922, 0}, {'c', 1, 8923, 0},
+    {'o', 1, 8924, 0}, {'t', 1, 8925, 0}, {'l', 1, 8926, 0}, {'V', 1, 8927, 0}, {'e', 1, 8928, 0}, {'o', 1, 8929, 0},
+    {';', 0, 8930, 476}, {'B', 1, 8930, 0}, {'s', 1, 8931, 0}, {';', 0, 8932, 481}, {';', 0, 8932, 484}, {'r', 1, 8932, 0},
+    {'r', 1, 8933, 0}, {'r', 1, 8934, 0}, {'w', 1, 8935, 0}, {';', 0, 8936, 500}, {'s', 1, 8936, 0}, {'t', 2, 8937, 0},
+    {'s', 1, 8939, 0}, {';', 0, 8940, 509}, {';', 0, 8940, 514}, {'a', 1, 8940, 0}, {'n', 1, 8941, 0}, {'d', 1, 8942, 0},
+    {'a', 1, 8943, 0}, {'u', 1, 8944, 0}, {'t', 1, 8945, 0}, {'h', 1, 8946, 0}, {'A', 1, 8947, 0}, {';', 0, 8948, 573},
+    {'u', 1, 8948, 0}, {';', 0, 8949, 578}, {'r', 1, 8949, 0}, {'r', 1, 8950, 0}, {';', 0, 8951, 596}, {'e', 1, 8951, 0},
+    {'a', 1, 8952, 0}, {'d', 1, 8953, 0}, {'c', 1, 8954, 0}, {'a', 1, 8955, 0}, {';', 0, 8956, 706}, {'d', 1, 8956, 0},
+    {'u', 1, 8957, 0}, {'e', 1, 8958, 0}, {';', 0, 8959, 742}, {'l', 1, 8959, 0}, {'l', 1, 8960, 0}, {'r', 1, 8961, 0},
+    {';', 0, 8962, 858}, {';', 0, 8962, 859}, {';', 0, 8962, 906}, {';', 0, 8962, 907}, {'e', 1, 8962, 0}, {'i', 1, 8963, 0},
+    {';', 0, 8964, 944}, {'e', 1, 8964, 0}, {'d', 1, 8965, 0}, {'o', 1, 8966, 0}, {'l', 1, 8967, 0}, {'r', 1, 8968, 0},
+    {';', 0, 8969, 1031}, {';', 0, 8969, 1050}, {'e', 1, 8969, 0}, {'e', 1, 8970, 0}, {'o', 1, 8971, 0}, {'r', 1, 8972, 0},
+    {'i', 1, 8973, 0}, {'d', 1, 8974, 0}, {'u', 1, 8975, 0}, {'o', 1, 8976, 0}, {'r', 1, 8977, 0}, {'r', 1, 8978, 0},
+    {'u', 1, 8979, 0}, {'m', 1, 8980, 0}, {'o', 1, 8981, 0}, {'h', 1, 8982, 0}, {'r', 1, 8983, 0}, {'f', 1, 8984, 0},
+    {'g', 1, 8985, 0}, {'l', 1, 8986, 0}, {'r', 1, 8987, 0}, {';', 0, 8988, 1455}, {'r', 1, 8988, 0}, {';', 0, 8989, 1554},
+    {'l', 1, 8989, 0}, {'f', 1, 8990, 0}, {'g', 1, 8991, 0}, {';', 0, 8992, 1723}, {';', 0, 8992, 1725}, {';', 0, 8992, 1750},
+    {'a', 1, 8992, 0}, {'n', 2, 8993, 0}, {'r', 1, 8995, 0}, {'r', 1, 8996, 0}, {'r', 1, 8997, 0}, {'r', 1, 8998, 0},
+    {'i', 1, 8999, 0}, {'q', 1, 9000, 0}, {'e', 1, 9001, 0}, {'u', 1, 9002, 0}, {'i', 1, 9003, 0}, {';', 0, 9004, 1954},
+    {';', 0, 9004, 1976}, {';', 0, 9004, 1978}, {';', 0, 9004, 2032}, {'n', 1, 9004, 0}, {'t', 2, 9005, 0}, {'h', 1, 9007, 0},
+    {'a', 1, 9008, 0}, {'t', 1, 9009, 0}, {';', 0, 9010, 2106}, {'f', 1, 9010, 0}, {'g', 1, 9011, 0}, {'q', 2, 9012, 0},
+    {'q', 2, 9014, 0}, {'l', 1, 9016, 0}, {'r', 1, 9017, 0}, {'n', 1, 9018, 0}, {'r', 1, 9019, 0}, {'t', 1, 9020, 0},
+    {'u', 1, 9021, 0}, {'o', 1, 9022, 0}, {'r', 1, 9023, 0}, {'w', 1, 9024, 0}, {'c', 1, 9025, 0}, {'o', 2, 9026, 0},
+    {'r', 1, 9028, 0}, {'i', 1, 9029, 0}, {'D', 1, 9030, 0}, {'r', 1, 9031, 0}, {'r', 1, 9032, 0}, {'r', 1, 9033, 0},
+    {'g', 1, 9034, 0}, {'e', 1, 9035, 0}, {'f', 1, 9036, 0}, {'g', 1, 9037, 0}, {'r', 1, 9038, 0}, {'e', 1, 9039, 0},
+    {'w', 1, 9040, 0}, {'A', 1, 9041, 0}, {'a', 1, 9042, 0}, {';', 0, 9043, 115}, {'r', 1, 9043, 0}, {'t', 1, 9044, 0},
+    {'e', 1, 9045, 0}, {'o', 1, 9046, 0}, {'V', 1, 9047, 0}, {'t', 1, 9048, 0}, {';', 0, 9049, 126}, {'u', 1, 9049, 0},
+    {'l', 1, 9050, 0}, {';', 0, 9051, 159}, {'q', 1, 9051, 0}, {'a', 1, 9052, 0}, {';', 0, 9053, 181}, {'L', 1, 9053, 0},
+    {'q', 1, 9054, 0}, {'e', 1, 9055, 0}, {'E', 1, 9056, 0}, {';', 0, 9057, 187}, {';', 0, 9057, 195}, {'n', 1, 9057, 0},
+    {';', 0, 9058, 200}, {';', 0, 9058, 220}, {'m', 1, 9058, 0}, {'e', 1, 9059, 0}, {'c', 1, 9060, 0}, {';', 0, 9061, 259},
+    {'h', 1, 9061, 0}, {'a', 1, 9062, 0}, {'e', 1, 9063, 0}, {'o', 1, 9064, 0}, {'o', 1, 9065, 0}, {'t', 1, 9066, 0},
+    {';', 0, 9067, 270}, {'r', 1, 9067, 0}, {';', 0, 9068, 272}, {'B', 1, 9068, 0}, {'E', 1, 9069, 0}, {'c', 1, 9070, 0},
+    {'t', 1, 9071, 0}, {';', 0, 9072, 277}, {'B', 1, 9072, 0}, {'r', 1, 9073, 0}, {'o', 1, 9074, 0}, {'a', 1, 9075, 0},
+    {'l', 1, 9076, 0}, {'a', 1, 9077, 0}, {'w', 1, 9078, 0}, {'t', 1, 9079, 0}, {'o', 1, 9080, 0}, {'w', 1, 9081, 0},
+    {'t', 1, 9082, 0}, {'o', 1, 9083, 0}, {'o', 1, 9084, 0}, {'r', 1, 9085, 0}, {'u', 1, 9086, 0}, {'k', 1, 9087, 0},
+    {'S', 1, 9088, 0}, {'T', 1, 9089, 0}, {'r', 1, 9090, 0}, {'s', 1, 9091, 0}, {'p', 1, 9092, 0}, {';', 0, 9093, 332},
+    {'t', 1, 9093, 0}, {'e', 1, 9094, 0}, {'u', 1, 9095, 0}, {'l', 1, 9096, 0}, {'e', 1, 9097, 0}, {'s', 1, 9098, 0},
+    {'a', 1, 9099, 0}, {'l', 1, 9100, 0}, {'u', 1, 9101, 0}, {';', 0, 9102, 347}, {'g', 1, 9102, 0}, {';', 0, 9103, 352},
+    {'e', 1, 9103, 0}, {'E', 1, 9104, 0}, {';', 0, 9105, 356}, {'a', 1, 9105, 0}, {'s', 1, 9106, 0}, {'q', 1, 9107, 0},
+    {'l', 1, 9108, 0}, {'e', 1, 9109, 0}, {'n', 1, 9110, 0}, {'s', 1, 9111, 0}, {'e', 1, 9112, 0}, {'a', 1, 9113, 0},
+    {'q', 1, 9114, 0}, {'l', 1, 9115, 0}, {'i', 1, 9116, 0}, {'q', 1, 9117, 0}, {'l', 1, 9118, 0}, {'E', 1, 9119, 0},
+    {'e', 1, 9120, 0}, {'a', 1, 9121, 0}, {'b', 1, 9122, 0}, {'t', 1, 9123, 0}, {'s', 1, 9124, 0}, {'e', 1, 9125, 0},
+    {'l', 1, 9126, 0}, {'t', 1, 9127, 0}, {'e', 1, 9128, 0}, {';', 0, 9129, 432}, {'n', 1, 9129, 0}, {'i', 1, 9130, 0},
+    {'i', 1, 9131, 0}, {'a', 1, 9132, 0}, {'r', 1, 9133, 0}, {'f', 1, 9134, 0}, {';', 0, 9135, 460}, {'r', 1, 9135, 0},
+    {'V', 1, 9136, 0}, {'t', 1, 9137, 0}, {'w', 1, 9138, 0}, {'o', 1, 9139, 0}, {'e', 3, 9140, 0}, {'e', 1, 9143, 0},
+    {'c', 1, 9144, 0}, {'r', 2, 9145, 0}, {'a', 1, 9147, 0}, {';', 0, 9148, 480}, {'o', 1, 9148, 0}, {'o', 1, 9149, 0},
+    {'r', 1, 9150, 0}, {';', 0, 9151, 498}, {'e', 1, 9151, 0}, {';', 0, 9152, 505}, {'E', 1, 9152, 0}, {'e', 1, 9153, 0},
+    {'l', 1, 9154, 0}, {'t', 1, 9155, 0}, {'e', 1, 9156, 0}, {'l', 1, 9157, 0}, {'a', 1, 9158, 0}, {';', 0, 9159, 564},
+    {'e', 1, 9159, 0}, {'r', 1, 9160, 0}, {'m', 1, 9161, 0}, {'o', 1, 9162, 0}, {'r', 1, 9163, 0}, {';', 0, 9164, 597},
+    {'r', 1, 9164, 0}, {'e', 1, 9165, 0}, {'e', 1, 9166, 0}, {'c', 1, 9167, 0}, {'o', 1, 9168, 0}, {'p', 1, 9169, 0},
+    {';', 0, 9170, 741}, {'e', 4, 9170, 0}, {'e', 1, 9174, 0}, {'i', 1, 9175, 0}, {'f', 1, 9176, 0}, {'g', 1, 9177, 0},
+    {'s', 1, 9178, 0}, {'g', 1, 9179, 0}, {'w', 1, 9180, 0}, {'e', 1, 9181, 0}, {'i', 1, 9182, 0}, {';', 0, 9183, 1051},
+    {'q', 1, 9183, 0}, {'w', 1, 9184, 0}, {'o', 1, 9185, 0}, {'l', 1, 9186, 0}, {'o', 1, 9187, 0}, {'p', 1, 9188, 0},
+    {'w', 1, 9189, 0}, {'o', 1, 9190, 0}, {'p', 1, 9191, 0}, {'i', 1, 9192, 0}, {'e', 1, 9193, 0}, {'w', 1, 9194, 0},
+    {'t', 1, 9195, 0}, {'o', 1, 9196, 0}, {'t', 1, 9197, 0}, {'h', 1, 9198, 0}, {'e', 1, 9199, 0}, {'r', 1, 9200, 0},
+    {'r', 1, 9201, 0}, {'e', 1, 9202, 0}, {'t', 2, 9203, 0}, {'h', 1, 9205, 0}, {'i', 1, 9206, 0}, {'d', 1, 9207, 0},
+    {'u', 1, 9208, 0}, {'o', 1, 9209, 0}, {'p', 1, 9210, 0}, {'r', 1, 9211, 0}, {'r', 1, 9212, 0}, {'m', 1, 9213, 0},
+    {';', 0, 9214, 1828}, {'l', 1, 9214, 0}, {'s', 1, 9215, 0}, {'l', 1, 9216, 0}, {';', 0, 9217, 2056}, {';', 0, 9217, 2057},
+    {'e', 1, 9217, 0}, {'t', 2, 9218, 0}, {'r', 1, 9220, 0}, {'a', 1, 9221, 0}, {'t', 1, 9222, 0}, {'h', 1, 9223, 0},
+    {';', 0, 9224, 2142}, {'q', 1, 9224, 0}, {';', 0, 9225, 2144}, {'q', 1, 9225, 0}, {'e', 1, 9226, 0}, {'i', 1, 9227, 0},
+    {';', 0, 9228, 19}, {'e', 1, 9228, 0}, {'o', 1, 9229, 0}, {'b', 1, 9230, 0}, {'t', 1, 9231, 0}, {'a', 1, 9232, 0},
+    {'i', 1, 9233, 0}, {'u', 1, 9234, 0}, {'t', 1, 9235, 0}, {'u', 1, 9236, 0}, {'a', 1, 9237, 0}, {'l', 1, 9238, 0},
+    {';', 0, 9239, 95}, {'I', 1, 9239, 0}, {'o', 1, 9240, 0}, {'o', 1, 9241, 0}, {'h', 1, 9242, 0}, {';', 0, 9243, 105},
+    {'t', 2, 9243, 0}, {'h', 1, 9245, 0}, {'r', 1, 9246, 0}, {'e', 1, 9247, 0}, {';', 0, 9248, 111}, {'r', 1, 9248, 0},
+    {'l', 1, 9249, 0}, {'r', 1, 9250, 0}, {'V', 1, 9251, 0}, {'c', 1, 9252, 0}, {'r', 2, 9253, 0}, {'e', 1, 9255, 0},
+    {'o', 1, 9256, 0}, {'a', 1, 9257, 0}, {'l', 1, 9258, 0}, {'u', 1, 9259, 0}, {'l', 1, 9260, 0}, {'e', 1, 9261, 0},
+    {'u', 1, 9262, 0}, {'r', 1, 9263, 0}, {'q', 1, 9264, 0}, {'e', 1, 9265, 0}, {'a', 1, 9266, 0}, {'s', 1, 9267, 0},
+    {'k', 1, 9268, 0}, {'t', 1, 9269, 0}, {'c', 1, 9270, 0}, {'c', 1, 9271, 0}, {'r', 2, 9272, 0}, {'w', 1, 9274, 0},
+    {'o', 1, 9275, 0}, {';', 0, 9276, 271}, {'a', 1, 9276, 0}, {'q', 1, 9277, 0}, {'t', 1, 9278, 0}, {'o', 1, 9279, 0},
+    {'a', 1, 9280, 0}, {';', 0, 9281, 280}, {'w', 1, 9281, 0}, {'t', 1, 9282, 0}, {';', 0, 9283, 284}, {'l', 1, 9283, 0},
+    {';', 0, 9284, 293}, {'A', 1, 9284, 0}, {'w', 1, 9285, 0}, {';', 0, 9286, 296}, {'a', 1, 9286, 0}, {'w', 1, 9287, 0},
+    {'w', 1, 9288, 0}, {'o', 1, 9289, 0}, {'m', 1, 9290, 0}, {'S', 1, 9291, 0}, {'p', 1, 9292, 0}, {'h', 1, 9293, 0},
+    {'G', 1, 9294, 0}, {'s', 1, 9295, 0}, {'a', 1, 9296, 0}, {'i', 1, 9297, 0}, {';', 0, 9298, 337}, {'a', 1, 9298, 0},
+    {'l', 1, 9299, 0}, {'a', 1, 9300, 0}, {'s', 1, 9301, 0}, {'n', 1, 9302, 0}, {'d', 1, 9303, 0}, {'m', 1, 9304, 0},
+    {'l', 1, 9305, 0}, {'r', 1, 9306, 0}, {'q', 1, 9307, 0}, {'t', 1, 9308, 0}, {'L', 1, 9309, 0}, {'u', 1, 9310, 0},
+    {'a', 1, 9311, 0}, {'m', 1, 9312, 0}, {'g', 1, 9313, 0}, {'e', 1, 9314, 0}, {'r', 1, 9315, 0}, {'l', 1, 9316, 0},
+    {'u', 1, 9317, 0}, {'a', 1, 9318, 0}, {'l', 1, 9319, 0}, {'u', 1, 9320, 0}, {';', 0, 9321, 379}, {'q', 1, 9321, 0},
+    {';', 0, 9322, 381}, {'r', 1, 9322, 0}, {'l', 1, 9323, 0}, {'e', 1, 9324, 0}, {'i', 1, 9325, 0}, {';', 0, 9326, 422},
+    {';', 0, 9326, 426}, {'E', 1, 9326, 0}, {';', 0, 9327, 428}, {'t', 1, 9327, 0}, {'b', 1, 9328, 0}, {'l', 1, 9329, 0},
+    {'c', 1, 9330, 0}, {';', 0, 9331, 458}, {'t', 1, 9331, 0}, {'a', 1, 9332, 0}, {'e', 1, 9333, 0}, {'o', 1, 9334, 0},
+    {';', 0, 9335, 467}, {'r', 1, 9335, 0}, {';', 0, 9336, 469}, {'B', 1, 9336, 0}, {'E', 1, 9337, 0}, {'c', 1, 9338, 0},
+    {'t', 1, 9339, 0}, {';', 0, 9340, 474}, {'B', 1, 9340, 0}, {'r', 1, 9341, 0}, {'w', 1, 9342, 0}, {'w', 1, 9343, 0},
+    {'o', 1, 9344, 0}, {'c', 1, 9345, 0}, {'q', 1, 9346, 0}, {'t', 2, 9347, 0}, {';', 0, 9349, 516}, {'E', 1, 9349, 0},
+    {';', 0, 9350, 518}, {';', 0, 9350, 523}, {'l', 1, 9350, 0}, {'s', 1, 9351, 0}, {'r', 1, 9352, 0}, {';', 0, 9353, 574},
+    {'w', 1, 9353, 0}, {'o', 1, 9354, 0}, {'a', 1, 9355, 0}, {';', 0, 9356, 599}, {';', 0, 9356, 600}, {'e', 1, 9356, 0},
+    {'w', 1, 9357, 0}, {';', 0, 9358, 736}, {';', 0, 9358, 743}, {'d', 1, 9358, 0}, {'l', 1, 9359, 0}, {'r', 1, 9360, 0},
+    {'f', 1, 9361, 0}, {'g', 1, 9362, 0}, {'t', 1, 9363, 0}, {'h', 1, 9364, 0}, {';', 0, 9365, 952}, {'e', 1, 9365, 0},
+    {'s', 1, 9366, 0}, {'f', 1, 9367, 0}, {'g', 1, 9368, 0}, {';', 0, 9369, 1052}, {';', 0, 9369, 1170}, {'w', 1, 9369, 0},
+    {';', 0, 9370, 1303}, {'w', 1, 9370, 0}, {';', 0, 9371, 1305}, {'s', 1, 9371, 0}, {'w', 2, 9372, 0}, {'o', 1, 9374, 0},
+    {'g', 1, 9375, 0}, {'s', 1, 9376, 0}, {';', 0, 9377, 1357}, {'a', 1, 9377, 0}, {'w', 1, 9378, 0}, {';', 0, 9379, 1361},
+    {'t', 1, 9379, 0}, {';', 0, 9380, 1422}, {'o', 1, 9380, 0}, {'o', 1, 9381, 0}, {'l', 1, 9382, 0}, {';', 0, 9383, 1588},
+    {'e', 1, 9383, 0}, {'t', 2, 9384, 0}, {'l', 1, 9386, 0}, {'o', 1, 9387, 0}, {'p', 1, 9388, 0}, {'w', 1, 9389, 0},
+    {'o', 1, 9390, 0}, {'o', 1, 9391, 0}, {'o', 1, 9392, 0}, {'e', 1, 9393, 0}, {';', 0, 9394, 1896}, {';', 0, 9394, 1914},
+    {'o', 1, 9394, 0}, {'q', 1, 9395, 0}, {';', 0, 9396, 2060}, {'e', 1, 9396, 0}, {'r', 1, 9397, 0}, {'r', 1, 9398, 0},
+    {';', 0, 9399, 2107}, {'t', 1, 9399, 0}, {';', 0, 9400, 2143}, {';', 0, 9400, 2145}, {'f', 1, 9400, 0}, {'g', 1, 9401, 0},
+    {'n', 1, 9402, 0}, {'u', 1, 9403, 0}, {'l', 1, 9404, 0}, {'e', 1, 9405, 0}, {'l', 1, 9406, 0}, {'s', 1, 9407, 0},
+    {'t', 1, 9408, 0}, {';', 0, 9409, 90}, {'b', 1, 9409, 0}, {'v', 1, 9410, 0}, {'d', 1, 9411, 0}, {'n', 1, 9412, 0},
+    {'w', 1, 9413, 0}, {'w', 1, 9414, 0}, {'t', 1, 9415, 0}, {'A', 1, 9416, 0}, {'R', 1, 9417, 0}, {'t', 1, 9418, 0},
+    {'o', 1, 9419, 0}, {';', 0, 9420, 110}, {'r', 1, 9420, 0}, {'B', 1, 9421, 0}, {'o', 1, 9422, 0}, {'e', 1, 9423, 0},
+    {'t', 1, 9424, 0}, {';', 0, 9425, 120}, {'B', 1, 9425, 0}, {'c', 1, 9426, 0}, {'r', 2, 9427, 0}, {'r', 1, 9429, 0},
+    {'S', 1, 9430, 0}, {'a', 1, 9431, 0}, {'l', 1, 9432, 0}, {'s', 1, 9433, 0}, {'a', 1, 9434, 0}, {';', 0, 9435, 184},
+    {'u', 1, 9435, 0}, {';', 0, 9436, 197}, {';', 0, 9436, 221}, {';', 0, 9436, 222}, {'e', 1, 9436, 0}, {'A', 1, 9437, 0},
+    {'k', 1, 9438, 0}, {'t', 1, 9439, 0}, {';', 0, 9440, 264}, {'B', 1, 9440, 0}, {';', 0, 9441, 267}, {'r', 1, 9441, 0},
+    {'r', 1, 9442, 0}, {'u', 1, 9443, 0}, {'o', 1, 9444, 0}, {'r', 1, 9445, 0}, {'r', 1, 9446, 0}, {';', 0, 9447, 282},
+    {'e', 1, 9447, 0}, {';', 0, 9448, 287}, {'r', 1, 9448, 0}, {';', 0, 9449, 295}, {'r', 1, 9449, 0}, {';', 0, 9450, 298},
+    {';', 0, 9450, 300}, {'w', 1, 9450, 0}, {'S', 1, 9451, 0}, {'p', 1, 9452, 0}, {'a', 1, 9453, 0}, {'i', 1, 9454, 0},
+    {'r', 1, 9455, 0}, {';', 0, 9456, 325}, {'c', 1, 9456, 0}, {'c', 1, 9457, 0}, {'l', 1, 9458, 0}, {'E', 1, 9459, 0},
+    {'t', 1, 9460, 0}, {';', 0, 9461, 343}, {'t', 1, 9461, 0}, {'e', 1, 9462, 0}, {'p', 1, 9463, 0}, {'e', 3, 9464, 0},
+    {';', 0, 9467, 353}, {'u', 1, 9467, 0}, {'e', 1, 9468, 0}, {'e', 1, 9469, 0}, {'a', 1, 9470, 0}, {'n', 1, 9471, 0},
+    {'e', 1, 9472, 0}, {'l', 1, 9473, 0}, {'t', 2, 9474, 0}, {'s', 1, 9476, 0}, {';', 0, 9477, 371}, {'a', 1, 9477, 0},
+    {'n', 1, 9478, 0}, {'d', 1, 9479, 0}, {'a', 1, 9480, 0}, {'u', 1, 9481, 0}, {';', 0, 9482, 382}, {'e', 1, 9482, 0},
+    {';', 0, 9483, 402}, {'s', 1, 9483, 0}, {'q', 1, 9484, 0}, {';', 0, 9485, 451}, {'r', 1, 9485, 0}, {'i', 1, 9486, 0},
+    {'k', 1, 9487, 0}, {'A', 1, 9488, 0}, {'c', 1, 9489, 0}, {'c', 1, 9490, 0}, {'r', 2, 9491, 0}, {';', 0, 9493, 468},
+    {'a', 1, 9493, 0}, {'q', 1, 9494, 0}, {'t', 1, 9495, 0}, {'o', 1, 9496, 0}, {'a', 1, 9497, 0}, {';', 0, 9498, 477},
+    {';', 0, 9498, 495}, {';', 0, 9498, 496}, {'w', 1, 9498, 0}, {'t', 1, 9499, 0}, {'u', 1, 9500, 0}, {';', 0, 9501, 507},
+    {'E', 1, 9501, 0}, {'q', 1, 9502, 0}, {';', 0, 9503, 542}, {'i', 1, 9503, 0}, {'o', 1, 9504, 0}, {';', 0, 9505, 579},
+    {'w', 1, 9505, 0}, {'t', 1, 9506, 0}, {';', 0, 9507, 630}, {'n', 1, 9507, 0}, {'o', 1, 9508, 0}, {'e', 1, 9509, 0},
+    {'i', 1, 9510, 0}, {'t', 1, 9511, 0}, {'h', 1, 9512, 0}, {';', 0, 9513, 912}, {'t', 1, 9513, 0}, {';', 0, 9514, 965},
+    {';', 0, 9514, 967}, {'t', 1, 9514, 0}, {'h', 1, 9515, 0}, {';', 0, 9516, 1171}, {'n', 1, 9516, 0}, {';', 0, 9517, 1306},
+    {';', 0, 9517, 1307}, {'s', 1, 9517, 0}, {'o', 1, 9518, 0}, {'a', 1, 9519, 0}, {';', 0, 9520, 1311}, {'r', 1, 9520, 0},
+    {';', 0, 9521, 1360}, {';', 0, 9521, 1362}, {'w', 1, 9521, 0}, {'w', 1, 9522, 0}, {';', 0, 9523, 1562}, {'q', 1, 9523, 0},
+    {';', 0, 9524, 1590}, {'e', 1, 9524, 0}, {';', 0, 9525, 1819}, {'w', 1, 9525, 0}, {';', 0, 9526, 1821}, {'s', 1, 9526, 0},
+    {'o', 1, 9527, 0}, {'w', 1, 9528, 0}, {'w', 1, 9529, 0}, {'s', 1, 9530, 0}, {'n', 1, 9531, 0}, {';', 0, 9532, 2058},
+    {'q', 1, 9532, 0}, {'o', 1, 9533, 0}, {'r', 1, 9534, 0}, {';', 0, 9535, 2108}, {'t', 1, 9535, 0}, {'h', 1, 9536, 0},
+    {'t', 1, 9537, 0}, {'r', 1, 9538, 0}, {'e', 1, 9539, 0}, {';', 0, 9540, 63}, {';', 0, 9540, 68}, {'e', 1, 9540, 0},
+    {'e', 1, 9541, 0}, {'l', 1, 9542, 0}, {'e', 1, 9543, 0}, {'e', 1, 9544, 0}, {'t', 1, 9545, 0}, {';', 0, 9546, 102},
+    {';', 0, 9546, 103}, {'A', 1, 9546, 0}, {'r', 1, 9547, 0}, {'i', 1, 9548, 0}, {'A', 1, 9549, 0}, {'w', 1, 9550, 0},
+    {'o', 1, 9551, 0}, {'a', 1, 9552, 0}, {'w', 1, 9553, 0}, {'c', 1, 9554, 0}, {'o', 1, 9555, 0}, {'a', 1, 9556, 0},
+    {'t', 1, 9557, 0}, {';', 0, 9558, 123}, {'B', 1, 9558, 0}, {'e', 1, 9559, 0}, {'q', 1, 9560, 0}, {'r', 1, 9561, 0},
+    {'S', 1, 9562, 0}, {'s', 1, 9563, 0}, {'l', 1, 9564, 0}, {'a', 1, 9565, 0}, {'t', 1, 9566, 0}, {'r', 1, 9567, 0},
+    {'e', 1, 9568, 0}, {'o', 1, 9569, 0}, {'a', 1, 9570, 0}, {';', 0, 9571, 268}, {';', 0, 9571, 273}, {'a', 1, 9571, 0},
+    {'r', 1, 9572, 0}, {';', 0, 9573, 276}, {';', 0, 9573, 278}, {'r', 1, 9573, 0}, {'r', 1, 9574, 0}, {'r', 1, 9575, 0},
+    {';', 0, 9576, 301}, {'p', 1, 9576, 0}, {'a', 1, 9577, 0}, {'c', 1, 9578, 0}, {'n', 1, 9579, 0}, {'e', 1, 9580, 0},
+    {'e', 1, 9581, 0}, {'a', 1, 9582, 0}, {';', 0, 9583, 340}, {'q', 1, 9583, 0}, {'e', 1, 9584, 0}, {'E', 1, 9585, 0},
+    {';', 0, 9586, 345}, {';', 0, 9586, 346}, {';', 0, 9586, 348}, {'B', 1, 9586, 0}, {'E', 1, 9587, 0}, {'a', 1, 9588, 0},
+    {'r', 1, 9589, 0}, {'s', 1, 9590, 0}, {'l', 1, 9591, 0}, {'t', 1, 9592, 0}, {'n', 1, 9593, 0}, {'e', 3, 9594, 0},
+    {';', 0, 9597, 366}, {'E', 1, 9597, 0}, {'e', 1, 9598, 0}, {'l', 1, 9599, 0}, {'t', 1, 9600, 0}, {'e', 1, 9601, 0},
+    {'l', 1, 9602, 0}, {'a', 1, 9603, 0}, {'Q', 1, 9604, 0}, {';', 0, 9605, 415}, {'u', 1, 9605, 0}, {'i', 1, 9606, 0},
+    {'b', 1, 9607, 0}, {'e', 1, 9608, 0}, {'r', 1, 9609, 0}, {'k', 1, 9610, 0}, {'t', 1, 9611, 0}, {';', 0, 9612, 463},
+    {'B', 1, 9612, 0}, {'r', 1, 9613, 0}, {'u', 1, 9614, 0}, {'o', 1, 9615, 0}, {'r', 1, 9616, 0}, {'r', 1, 9617, 0},
+    {';', 0, 9618, 497}, {'i', 1, 9618, 0}, {'a', 1, 9619, 0}, {'q', 1, 9620, 0}, {'u', 1, 9621, 0}, {'s', 1, 9622, 0},
+    {'w', 1, 9623, 0}, {';', 0, 9624, 580}, {'o', 1, 9624, 0}, {';', 0, 9625, 735}, {'w', 1, 9625, 0}, {'f', 1, 9626, 0},
+    {'g', 1, 9627, 0}, {';', 0, 9628, 853}, {'t', 1, 9628, 0}, {';', 0, 9629, 913}, {';', 0, 9629, 968}, {'t', 1, 9629, 0},
+    {';', 0, 9630, 1304}, {';', 0, 9630, 1308}, {'n', 1, 9630, 0}, {'r', 1, 9631, 0}, {'r', 1, 9632, 0}, {';', 0, 9633, 1451},
+    {';', 0, 9633, 1516}, {';', 0, 9633, 1589}, {'q', 1, 9633, 0}, {'n', 1, 9634, 0}, {';', 0, 9635, 1822}, {'n', 1, 9635, 0},
+    {'s', 1, 9636, 0}, {';', 0, 9637, 1825}, {';', 0, 9637, 1826}, {';', 0, 9637, 1953}, {';', 0, 9637, 2061}, {'w', 1, 9637, 0},
+    {'o', 1, 9638, 0}, {';', 0, 9639, 2147}, {'t', 1, 9639, 0}, {'i', 1, 9640, 0}, {'I', 1, 9641, 0}, {'Q', 1, 9642, 0},
+    {'C', 1, 9643, 0}, {';', 0, 9644, 89}, {'e', 1, 9644, 0}, {';', 0, 9645, 92}, {';', 0, 9645, 93}, {'e', 1, 9645, 0},
+    {'r', 1, 9646, 0}, {'r', 1, 9647, 0}, {'g', 1, 9648, 0}, {'r', 1, 9649, 0}, {';', 0, 9650, 109}, {'w', 1, 9650, 0},
+    {'r', 1, 9651, 0}, {';', 0, 9652, 116}, {'t', 1, 9652, 0}, {'r', 1, 9653, 0}, {'r', 1, 9654, 0}, {'o', 1, 9655, 0},
+    {'a', 1, 9656, 0}, {';', 0, 9657, 145}, {'u', 1, 9657, 0}, {'e', 1, 9658, 0}, {'q', 1, 9659, 0}, {';', 0, 9660, 182},
+    {';', 0, 9660, 183}, {'l', 1, 9660, 0}, {';', 0, 9661, 257}, {'r', 1, 9661, 0}, {'t', 1, 9662, 0}, {'r', 1, 9663, 0},
+    {'r', 1, 9664, 0}, {'l', 1, 9665, 0}, {';', 0, 9666, 275}, {';', 0, 9666, 283}, {'o', 1, 9666, 0}, {'o', 1, 9667, 0},
+    {'a', 1, 9668, 0}, {'c', 1, 9669, 0}, {'e', 1, 9670, 0}, {'S', 1, 9671, 0}, {'a', 1, 9672, 0}, {';', 0, 9673, 329},
+    {'l', 1, 9673, 0}, {'u', 1, 9674, 0}, {'r', 1, 9675, 0}, {'q', 1, 9676, 0}, {'a', 1, 9677, 0}, {'q', 1, 9678, 0},
+    {'l', 1, 9679, 0}, {'G', 1, 9680, 0}, {'s', 1, 9681, 0}, {';', 0, 9682, 360}, {'E', 1, 9682, 0}, {'t', 1, 9683, 0},
+    {';', 0, 9684, 363}, {'B', 1, 9684, 0}, {'E', 1, 9685, 0}, {'q', 1, 9686, 0}, {'t', 2, 9687, 0}, {';', 0, 9689, 373},
+    {'E', 1, 9689, 0}, {';', 0, 9690, 375}, {';', 0, 9690, 377}, {'l', 1, 9690, 0}, {'u', 1, 9691, 0}, {'a', 1, 9692, 0},
+    {'u', 1, 9693, 0}, {'r', 1, 9694, 0}, {'t', 1, 9695, 0}, {'r', 1, 9696, 0}, {'e', 1, 9697, 0}, {'o', 1, 9698, 0},
+    {'a', 1, 9699, 0}, {';', 0, 9700, 470}, {'a', 1, 9700, 0}, {'r', 1, 9701, 0}, {';', 0, 9702, 473}, {';', 0, 9702, 475},
+    {'o', 1, 9702, 0}, {'l', 1, 9703, 0}, {'u', 1, 9704, 0}, {'a', 1, 9705, 0}, {';', 0, 9706, 565}, {';', 0, 9706, 572},
+    {'r', 1, 9706, 0}, {'n', 1, 9707, 0}, {'t', 1, 9708, 0}, {'h', 1, 9709, 0}, {';', 0, 9710, 854}, {';', 0, 9710, 969},
+    {'s', 1, 9710, 0}, {'r', 1, 9711, 0}, {'o', 1, 9712, 0}, {';', 0, 9713, 1591}, {';', 0, 9713, 1820}, {'s', 1, 9713, 0},
+    {';', 0, 9714, 1824}, {';', 0, 9714, 2074}, {'w', 1, 9714, 0}, {';', 0, 9715, 2148}, {'a', 1, 9715, 0}, {'n', 1, 9716, 0},
+    {'u', 1, 9717, 0}, {'o', 1, 9718, 0}, {'A', 1, 9719, 0}, {'g', 1, 9720, 0}, {'r', 1, 9721, 0}, {'o', 1, 9722, 0},
+    {'h', 1, 9723, 0}, {'r', 1, 9724, 0}, {';', 0, 9725, 112}, {';', 0, 9725, 113}, {'o', 1, 9725, 0}, {';', 0, 9726, 119},
+    {';', 0, 9726, 121}, {'r', 1, 9726, 0}, {'r', 1, 9727, 0}, {'a', 1, 9728, 0}, {';', 0, 9729, 162}, {'u', 1, 9729, 0},
+    {';', 0, 9730, 186}, {'o', 1, 9730, 0}, {';', 0, 9731, 262}, {';', 0, 9731, 263}, {';', 0, 9731, 265}, {';', 0, 9731, 274},
+    {'w', 1, 9731, 0}, {'w', 1, 9732, 0}, {'c', 1, 9733, 0}, {'e', 1, 9734, 0}, {';', 0, 9735, 322}, {'p', 1, 9735, 0},
+    {'t', 1, 9736, 0}, {'B', 1, 9737, 0}, {'a', 1, 9738, 0}, {';', 0, 9739, 342}, {'u', 1, 9739, 0}, {'r', 1, 9740, 0},
+    {'u', 1, 9741, 0}, {';', 0, 9742, 355}, {'r', 1, 9742, 0}, {';', 0, 9743, 358}, {'q', 1, 9743, 0}, {';', 0, 9744, 362},
+    {'a', 1, 9744, 0}, {'q', 1, 9745, 0}, {'u', 1, 9746, 0}, {';', 0, 9747, 368}, {'E', 1, 9747, 0}, {'q', 1, 9748, 0},
+    {';', 0, 9749, 380}, {'o', 1, 9749, 0}, {'l', 1, 9750, 0}, {'m', 1, 9751, 0}, {'i', 1, 9752, 0}, {';', 0, 9753, 456},
+    {'o', 1, 9753, 0}, {'t', 1, 9754, 0}, {'r', 1, 9755, 0}, {'r', 1, 9756, 0}, {'l', 1, 9757, 0}, {';', 0, 9758, 472},
+    {'n', 1, 9758, 0}, {';', 0, 9759, 506}, {'a', 1, 9759, 0}, {'l', 1, 9760, 0}, {';', 0, 9761, 598}, {';', 0, 9761, 744},
+    {';', 0, 9761, 745}, {'t', 1, 9761, 0}, {';', 0, 9762, 1309}, {'o', 1, 9762, 0}, {'w', 1, 9763, 0}, {';', 0, 9764, 1823},
+    {';', 0, 9764, 2075}, {'l', 1, 9764, 0}, {'t', 1, 9765, 0}, {'o', 1, 9766, 0}, {'n', 1, 9767, 0}, {'c', 1, 9768, 0},
+    {'r', 1, 9769, 0}, {'o', 1, 9770, 0}, {'w', 1, 9771, 0}, {'t', 1, 9772, 0}, {'o', 1, 9773, 0}, {'r', 1, 9774, 0},
+    {';', 0, 9775, 122}, {';', 0, 9775, 124}, {'r', 1, 9775, 0}, {'a', 1, 9776, 0}, {'w', 1, 9777, 0}, {';', 0, 9778, 294},
+    {';', 0, 9778, 297}, {'e', 1, 9778, 0}, {';', 0, 9779, 321}, {'a', 1, 9779, 0}, {'e', 1, 9780, 0}, {'a', 1, 9781, 0},
+    {'l', 1, 9782, 0}, {'a', 1, 9783, 0}, {';', 0, 9784, 349}, {'a', 1, 9784, 0}, {'e', 1, 9785, 0}, {'u', 1, 9786, 0},
+    {'r', 1, 9787, 0}, {'u', 1, 9788, 0}, {'a', 1, 9789, 0}, {'q', 1, 9790, 0}, {'u', 1, 9791, 0}, {'t', 1, 9792, 0},
+    {';', 0, 9793, 427}, {';', 0, 9793, 452}, {'u', 1, 9793, 0}, {'w', 1, 9794, 0}, {';', 0, 9795, 461}, {';', 0, 9795, 462},
+    {';', 0, 9795, 464}, {';', 0, 9795, 471}, {';', 0, 9795, 504}, {'l', 1, 9795, 0}, {';', 0, 9796, 517}, {';', 0, 9796, 746},
+    {'w', 1, 9796, 0}, {';', 0, 9797, 1358}, {'D', 1, 9797, 0}, {'e', 1, 9798, 0}, {'t', 1, 9799, 0}, {'t', 1, 9800, 0},
+    {'u', 1, 9801, 0}, {'a', 1, 9802, 0}, {'w', 1, 9803, 0}, {';', 0, 9804, 106}, {'A', 1, 9804, 0}, {'w', 1, 9805, 0},
+    {';', 0, 9806, 118}, {'e', 1, 9806, 0}, {'r', 1, 9807, 0}, {';', 0, 9808, 260}, {';', 0, 9808, 320}, {'c', 1, 9808, 0},
+    {'r', 1, 9809, 0}, {'r', 1, 9810, 0}, {';', 0, 9811, 341}, {'l', 1, 9811, 0}, {'l', 1, 9812, 0}, {'a', 1, 9813, 0},
+    {'a', 1, 9814, 0}, {';', 0, 9815, 364}, {'a', 1, 9815, 0}, {'l', 1, 9816, 0}, {'u', 1, 9817, 0}, {'a', 1, 9818, 0},
+    {'e', 1, 9819, 0}, {'m', 1, 9820, 0}, {';', 0, 9821, 459}, {';', 0, 9821, 508}, {';', 0, 9821, 1310}, {';', 0, 9821, 45},
+    {'g', 1, 9821, 0}, {'e', 1, 9822, 0}, {'o', 1, 9823, 0}, {'t', 1, 9824, 0}, {'l', 1, 9825, 0}, {';', 0, 9826, 104},
+    {'r', 1, 9826, 0}, {';', 0, 9827, 108}, {';', 0, 9827, 146}, {'e', 1, 9827, 0}, {'e', 1, 9828, 0}, {';', 0, 9829, 324},
+    {';', 0, 9829, 334}, {';', 0, 9829, 344}, {';', 0, 9829, 350}, {'t', 1, 9829, 0}, {'l', 1, 9830, 0}, {'l', 1, 9831, 0},
+    {';', 0, 9832, 367}, {'a', 1, 9832, 0}, {'l', 1, 9833, 0}, {';', 0, 9834, 401}, {';', 0, 9834, 453}, {'r', 1, 9834, 0},
+    {';', 0, 9835, 62}, {'u', 1, 9835, 0}, {'e', 1, 9836, 0}, {';', 0, 9837, 100}, {'r', 1, 9837, 0}, {';', 0, 9838, 163},
+    {';', 0, 9838, 323}, {'e', 1, 9838, 0}, {';', 0, 9839, 361}, {';', 0, 9839, 365}, {'l', 1, 9839, 0}, {';', 0, 9840, 374},
+    {'a', 1, 9840, 0}, {'r', 1, 9841, 0}, {';', 0, 9842, 91}, {'o', 1, 9842, 0}, {'r', 1, 9843, 0}, {';', 0, 9844, 369},
+    {'l', 1, 9844, 0}, {'I', 1, 9845, 0}, {'w', 1, 9846, 0}, {';', 0, 9847, 357}, {';', 0, 9847, 61}, {'n', 1, 9847, 0},
+    {';', 0, 9848, 107}, {'t', 1, 9848, 0}, {'e', 1, 9849, 0}, {'g', 1, 9850, 0}, {'r', 1, 9851, 0}, {'a', 1, 9852, 0},
+    {'l', 1, 9853, 0}, {';', 0, 9854, 71},
+};
+
+} // namespace facebook::react::parsing
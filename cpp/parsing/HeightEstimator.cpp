@@ -0,0 +1,259 @@
+/**
+ * HeightEstimator.cpp
+ *
+ * Greedy line breaking over advance width tables.
+ */
+
+#include "HeightEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+// React Native's font size when none is set
+constexpr float kDefaultFontSize = 14.0f;
+
+// Helvetica widths of ' ' through '~', per 1000 em
+constexpr std::array<uint16_t, 95> kHelveticaWidths = {
+    278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333, 278, 278, // ' ' to '/'
+    556, 556, 556, 556, 556, 556, 556, 556, 556, 556,                               // '0' to '9'
+    278, 278, 584, 584, 584, 556, 1015,                                             // ':' to '@'
+    667, 667, 722, 722, 667, 611, 778, 722, 278, 500, 667, 556, 833,                // 'A' to 'M'
+    722, 778, 667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611,                // 'N' to 'Z'
+    278, 278, 278, 469, 556, 333,                                                   // '[' to '`'
+    556, 556, 500, 556, 556, 278, 556, 556, 222, 222, 500, 222, 833,                // 'a' to 'm'
+    556, 556, 556, 556, 333, 500, 278, 556, 500, 722, 500, 500, 500,                // 'n' to 'z'
+    334, 260, 334, 584,                                                             // '{' to '~'
+};
+
+bool isWide(char32_t c) {
+  return (c >= 0x1100 && c <= 0x115F) ||   // Hangul Jamo
+      (c >= 0x2E80 && c <= 0xA4CF) ||      // CJK radicals through Yi
+      (c >= 0xAC00 && c <= 0xD7A3) ||      // Hangul syllables
+      (c >= 0xF900 && c <= 0xFAFF) ||      // CJK compatibility ideographs
+      (c >= 0xFE30 && c <= 0xFE4F) ||      // CJK compatibility forms
+      (c >= 0xFF00 && c <= 0xFF60) ||      // Fullwidth forms
+      (c >= 0xFFE0 && c <= 0xFFE6) ||
+      (c >= 0x1F300 && c <= 0x1F64F) ||    // Pictographs and emoticons
+      (c >= 0x1F900 && c <= 0x1F9FF) ||
+      (c >= 0x20000 && c <= 0x3FFFD);      // CJK extensions
+}
+
+bool isZeroWidth(char32_t c) {
+  return (c >= 0x0300 && c <= 0x036F) ||   // Combining diacritics
+      (c >= 0x200B && c <= 0x200F) ||      // Zero-width space and joiners, LRM/RLM
+      (c >= 0x202A && c <= 0x202E) ||      // Bidi embeddings
+      (c >= 0x2066 && c <= 0x2069) ||      // Bidi isolates
+      (c >= 0xFE00 && c <= 0xFE0F) ||      // Variation selectors
+      c == 0xFEFF;
+}
+
+/**
+ * Greedy line breaker. Text since the last break opportunity is the
+ * pending word; it moves to a new line as a whole when it overflows.
+ */
+class LineBreaker {
+ public:
+  LineBreaker(float width, int numberOfLines)
+      : width_(width > 0 && !std::isnan(width) ? width : INFINITY),
+        maxLines_(numberOfLines > 0 ? static_cast<size_t>(numberOfLines) : 0) {}
+
+  void addGlyph(float advance, float lineHeight) {
+    if (lineWidth_ + wordWidth_ + advance > width_) {
+      if (lineWidth_ > 0) {
+        endLine(lineInk_, lineHeight_);
+      }
+      if (wordWidth_ > 0 && wordWidth_ + advance > width_) {
+        endLine(wordWidth_, wordHeight_);
+        wordWidth_ = 0;
+        wordHeight_ = 0;
+      }
+    }
+    wordWidth_ += advance;
+    wordHeight_ = std::max(wordHeight_, lineHeight);
+  }
+
+  // Break opportunity after the glyph just added
+  void commitWord() {
+    lineWidth_ += wordWidth_;
+    lineInk_ = lineWidth_;
+    lineHeight_ = std::max(lineHeight_, wordHeight_);
+    wordWidth_ = 0;
+    wordHeight_ = 0;
+  }
+
+  // Spaces hang past the line end instead of wrapping
+  void addSpace(float advance, float lineHeight) {
+    commitWord();
+    lineWidth_ += advance;
+    lineHeight_ = std::max(lineHeight_, lineHeight);
+  }
+
+  void addLineBreak(float lineHeight) {
+    commitWord();
+    endLine(lineInk_, std::max(lineHeight_, lineHeight));
+  }
+
+  HeightEstimate finish() {
+    commitWord();
+    if (lineWidth_ > 0 || lineHeight_ > 0) {
+      endLine(lineInk_, lineHeight_);
+    }
+    return estimate_;
+  }
+
+ private:
+  void endLine(float ink, float height) {
+    estimate_.lineCount++;
+    if (maxLines_ == 0 || estimate_.lineCount <= maxLines_) {
+      estimate_.visibleLineCount++;
+      estimate_.height += height;
+      estimate_.width = std::max(estimate_.width, ink);
+    }
+    lineWidth_ = 0;
+    lineInk_ = 0;
+    lineHeight_ = 0;
+  }
+
+  const float width_;
+  const size_t maxLines_;
+  HeightEstimate estimate_;
+  // Committed words and spaces of the current line
+  float lineWidth_ = 0;
+  float lineInk_ = 0;
+  float lineHeight_ = 0;
+  // Pending word
+  float wordWidth_ = 0;
+  float wordHeight_ = 0;
+};
+
+} // namespace
+
+const AdvanceWidthTable& AdvanceWidthTable::systemDefault() {
+  static const AdvanceWidthTable table = [] {
+    AdvanceWidthTable helvetica;
+    for (size_t i = 0; i < kHelveticaWidths.size(); ++i) {
+      helvetica.ascii[i] = kHelveticaWidths[i] / 1000.0f;
+    }
+    return helvetica;
+  }();
+  return table;
+}
+
+AdvanceWidthTable AdvanceWidthTable::monospace(float advance, float lineHeight) {
+  AdvanceWidthTable table;
+  table.ascii.fill(advance);
+  table.fallback = advance;
+  table.wide = advance * 2;
+  table.lineHeight = lineHeight;
+  table.boldScale = 1.0f;
+  return table;
+}
+
+float AdvanceWidthTable::advance(char32_t codepoint) const {
+  if (codepoint >= 0x20 && codepoint < 0x7F) {
+    return ascii[codepoint - 0x20];
+  }
+  if (isZeroWidth(codepoint)) {
+    return 0;
+  }
+  return isWide(codepoint) ? wide : fallback;
+}
+
+void HeightEstimator::setTable(const std::string& family, const AdvanceWidthTable& table) {
+  tables_[family] = table;
+}
+
+const AdvanceWidthTable& HeightEstimator::tableFor(const TextAttributes& attributes) const {
+  auto it = tables_.find(attributes.fontFamily);
+  return it != tables_.end() ? it->second : AdvanceWidthTable::systemDefault();
+}
+
+HeightEstimate HeightEstimator::estimate(
+    const AttributedString& attributedString,
+    float width,
+    int numberOfLines) const {
+  LineBreaker breaker(width, numberOfLines);
+
+  for (const auto& fragment : attributedString.getFragments()) {
+    const auto& attributes = fragment.textAttributes;
+    const auto& table = tableFor(attributes);
+
+    float fontSize = std::isnan(attributes.fontSize) ? kDefaultFontSize : attributes.fontSize;
+    float lineHeight = !std::isnan(attributes.lineHeight) && attributes.lineHeight > 0
+        ? attributes.lineHeight
+        : fontSize * table.lineHeight;
+    float scale = fontSize;
+    if (attributes.fontWeight.has_value() && *attributes.fontWeight >= FontWeight::Bold) {
+      scale *= table.boldScale;
+    }
+    float letterSpacing = std::isnan(attributes.letterSpacing) ? 0 : attributes.letterSpacing;
+
+    const auto& text = fragment.string;
+    const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+    size_t i = 0;
+    while (i < text.size()) {
+      unsigned char lead = bytes[i];
+      size_t length = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+      if (i + length > text.size()) {
+        break;
+      }
+      char32_t codepoint = length == 1 ? lead : lead & (0x7F >> length);
+      for (size_t k = 1; k < length; ++k) {
+        codepoint = (codepoint << 6) | (bytes[i + k] & 0x3F);
+      }
+      i += length;
+
+      if (codepoint == '\n') {
+        breaker.addLineBreak(lineHeight);
+        continue;
+      }
+      float advance = table.advance(codepoint) * scale;
+      if (advance > 0) {
+        advance = std::max(advance + letterSpacing, 0.0f);
+      }
+      if (codepoint == ' ' || codepoint == '\t') {
+        breaker.addSpace(advance, lineHeight);
+      } else if (isWide(codepoint)) {
+        // East Asian text breaks between any two characters
+        breaker.commitWord();
+        breaker.addGlyph(advance, lineHeight);
+        breaker.commitWord();
+      } else {
+        breaker.addGlyph(advance, lineHeight);
+        if (codepoint == '-' || codepoint == 0x200B) {
+          breaker.commitWord();
+        }
+      }
+    }
+  }
+
+  return breaker.finish();
+}
+
+void HeightEstimateError::add(float estimated, float measured) {
+  double error = static_cast<double>(estimated) - measured;
+  double relative = measured > 0 ? std::abs(error) / measured : 0;
+  count_++;
+  absoluteSum_ += std::abs(error);
+  relativeSum_ += relative;
+  signedSum_ += error;
+  maxRelative_ = std::max(maxRelative_, relative);
+}
+
+double HeightEstimateError::meanAbsolute() const {
+  return count_ > 0 ? absoluteSum_ / count_ : 0;
+}
+
+double HeightEstimateError::meanRelative() const {
+  return count_ > 0 ? relativeSum_ / count_ : 0;
+}
+
+double HeightEstimateError::meanSigned() const {
+  return count_ > 0 ? signedSum_ / count_ : 0;
+}
+
+} // namespace facebook::react::parsing
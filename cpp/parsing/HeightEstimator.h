@@ -0,0 +1,126 @@
+/**
+ * HeightEstimator.h
+ *
+ * Platform-independent size estimate of a parse result, for list rows
+ * that need a height before they mount (getItemLayout, estimated item
+ * sizes). Lines are broken greedily at word boundaries using per-font
+ * advance width tables instead of the platform TextLayoutManager.
+ */
+
+#pragma once
+
+#include <react/renderer/attributedstring/AttributedString.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+namespace facebook::react::parsing {
+
+/**
+ * Advance widths of one font, in ems (multiples of the font size).
+ */
+struct AdvanceWidthTable {
+  // Printable ASCII, ' ' (0x20) to '~' (0x7E)
+  std::array<float, 95> ascii{};
+  // Other characters of proportional scripts
+  float fallback = 0.55f;
+  // East Asian wide characters and emoji
+  float wide = 1.0f;
+  // Line height when a fragment has none, in ems
+  float lineHeight = 1.2f;
+  // Advance multiplier for bold text
+  float boldScale = 1.06f;
+
+  /**
+   * Helvetica's widths, which San Francisco and Roboto track closely at
+   * text sizes. Used for fonts without a registered table.
+   */
+  static const AdvanceWidthTable& systemDefault();
+
+  /**
+   * Every character the same width, for monospaced fonts and tests.
+   */
+  static AdvanceWidthTable monospace(float advance, float lineHeight = 1.2f);
+
+  float advance(char32_t codepoint) const;
+};
+
+/**
+ * Size of text laid out at a width.
+ */
+struct HeightEstimate {
+  // Widest line, trailing spaces excluded
+  float width = 0;
+  // Height of the visible lines
+  float height = 0;
+  // Lines of the whole text
+  size_t lineCount = 0;
+  // Lines shown under numberOfLines
+  size_t visibleLineCount = 0;
+};
+
+/**
+ * Estimates text size from fragment attributes: fontSize, lineHeight,
+ * letterSpacing, fontWeight and fontFamily as the builder computes them.
+ *
+ * Lines break at spaces, after hyphens and around East Asian wide
+ * characters; a word wider than the line breaks between characters. A
+ * line is as tall as its tallest fragment. Kerning, ligatures and shaping
+ * are not modeled, so expect a few percent of error on Latin text.
+ *
+ * Configure tables before sharing; estimate() is const and thread-safe.
+ */
+class HeightEstimator {
+ public:
+  HeightEstimator() = default;
+
+  /**
+   * Advance widths for fragments whose fontFamily is family ("" = no family).
+   */
+  void setTable(const std::string& family, const AdvanceWidthTable& table);
+
+  /**
+   * @param width Width to wrap at (infinite = no wrapping)
+   * @param numberOfLines Lines shown (0 = unlimited)
+   */
+  HeightEstimate estimate(const AttributedString& attributedString, float width, int numberOfLines = 0) const;
+
+ private:
+  const AdvanceWidthTable& tableFor(const TextAttributes& attributes) const;
+
+  std::unordered_map<std::string, AdvanceWidthTable> tables_;
+};
+
+/**
+ * Error of estimates against measured heights, for benchmark reports.
+ */
+class HeightEstimateError {
+ public:
+  void add(float estimated, float measured);
+
+  size_t count() const {
+    return count_;
+  }
+
+  // Mean of |estimated - measured|, in points
+  double meanAbsolute() const;
+  // Mean of |estimated - measured| / measured
+  double meanRelative() const;
+  // Largest |estimated - measured| / measured
+  double maxRelative() const {
+    return maxRelative_;
+  }
+  // Mean of (estimated - measured), positive when estimates run tall
+  double meanSigned() const;
+
+ private:
+  size_t count_ = 0;
+  double absoluteSum_ = 0;
+  double relativeSum_ = 0;
+  double signedSum_ = 0;
+  double maxRelative_ = 0;
+};
+
+} // namespace facebook::react::parsing
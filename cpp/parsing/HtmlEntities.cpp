@@ -0,0 +1,201 @@
+/**
+ * HtmlEntities.cpp
+ *
+ * HTML character reference decoding implementation.
+ */
+
+#include "HtmlEntities.h"
+#include "GeneratedEntityTrie.h"
+
+#include <algorithm>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+constexpr char32_t kReplacementCharacter = 0xFFFD;
+constexpr char32_t kMaxCodePoint = 0x10FFFF;
+
+// Numeric references to C1 controls are read as Windows-1252, per HTML5.
+// 0 marks bytes that keep their code point.
+constexpr char32_t kWindows1252[32] = {
+    0x20AC, 0,      0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0,      0x017D, 0,
+    0,      0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0,      0x017E, 0x0178,
+};
+
+bool isAsciiAlphanumeric(char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+int digitValue(char c, bool hex) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (hex && c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (hex && c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+void appendUtf8(char32_t codepoint, CharacterReference& reference) {
+  char* out = reference.utf8 + reference.utf8Length;
+  if (codepoint < 0x80) {
+    out[0] = static_cast<char>(codepoint);
+    reference.utf8Length += 1;
+  } else if (codepoint < 0x800) {
+    out[0] = static_cast<char>(0xC0 | (codepoint >> 6));
+    out[1] = static_cast<char>(0x80 | (codepoint & 0x3F));
+    reference.utf8Length += 2;
+  } else if (codepoint < 0x10000) {
+    out[0] = static_cast<char>(0xE0 | (codepoint >> 12));
+    out[1] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    out[2] = static_cast<char>(0x80 | (codepoint & 0x3F));
+    reference.utf8Length += 3;
+  } else {
+    out[0] = static_cast<char>(0xF0 | (codepoint >> 18));
+    out[1] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+    out[2] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    out[3] = static_cast<char>(0x80 | (codepoint & 0x3F));
+    reference.utf8Length += 4;
+  }
+}
+
+// Index of the child of node labeled c, or 0 if there is none
+uint16_t findChild(const EntityTrieNode& node, char c) {
+  const EntityTrieNode* first = kEntityTrie + node.firstChild;
+  const EntityTrieNode* last = first + node.childCount;
+  const EntityTrieNode* it = std::lower_bound(first, last, c, [](const EntityTrieNode& child, char label) {
+    return child.label < label;
+  });
+  if (it == last || it->label != c) {
+    return 0;
+  }
+  return static_cast<uint16_t>(it - kEntityTrie);
+}
+
+bool matchNumericReference(const char* data, size_t size, bool atEnd, CharacterReference& reference) {
+  // data starts with "&#"
+  size_t k = 2;
+  bool hex = k < size && (data[k] == 'x' || data[k] == 'X');
+  if (hex) {
+    k++;
+  }
+  size_t digitsStart = k;
+  char32_t value = 0;
+  while (k < size) {
+    int digit = digitValue(data[k], hex);
+    if (digit < 0) {
+      break;
+    }
+    // Saturate above the code point range; the value only needs to be invalid
+    value = std::min<char32_t>(value * (hex ? 16 : 10) + static_cast<char32_t>(digit), kMaxCodePoint + 1);
+    k++;
+  }
+  if (k == size && !atEnd) {
+    return false;
+  }
+  if (k == digitsStart) {
+    return true;
+  }
+  if (k < size && data[k] == ';') {
+    k++;
+  }
+
+  if (value == 0 || value > kMaxCodePoint || (value >= 0xD800 && value <= 0xDFFF)) {
+    value = kReplacementCharacter;
+  } else if (value >= 0x80 && value <= 0x9F && kWindows1252[value - 0x80] != 0) {
+    value = kWindows1252[value - 0x80];
+  }
+  reference.length = k;
+  appendUtf8(value, reference);
+  return true;
+}
+
+} // namespace
+
+bool matchCharacterReference(
+    const char* data,
+    size_t size,
+    bool atEnd,
+    bool inAttribute,
+    CharacterReference& reference) {
+  reference = CharacterReference{};
+  if (size < 2) {
+    return atEnd;
+  }
+  if (data[1] == '#') {
+    return matchNumericReference(data, size, atEnd, reference);
+  }
+
+  // Longest name in the trie that prefixes the input
+  uint16_t node = 0;
+  size_t matchLength = 0;
+  uint16_t matchValue = 0;
+  for (size_t j = 1;; ++j) {
+    if (j == size) {
+      if (!atEnd && kEntityTrie[node].childCount > 0) {
+        return false;
+      }
+      break;
+    }
+    node = findChild(kEntityTrie[node], data[j]);
+    if (node == 0) {
+      break;
+    }
+    if (kEntityTrie[node].value != 0) {
+      matchLength = j + 1;
+      matchValue = kEntityTrie[node].value;
+    }
+  }
+  if (matchLength == 0) {
+    return true;
+  }
+
+  if (inAttribute && data[matchLength - 1] != ';') {
+    if (matchLength == size && !atEnd) {
+      return false;
+    }
+    if (matchLength < size && (data[matchLength] == '=' || isAsciiAlphanumeric(data[matchLength]))) {
+      return true;
+    }
+  }
+
+  reference.length = matchLength;
+  const char32_t* codepoints = kEntityValues[matchValue - 1];
+  appendUtf8(codepoints[0], reference);
+  if (codepoints[1] != 0) {
+    appendUtf8(codepoints[1], reference);
+  }
+  return true;
+}
+
+std::string decodeCharacterReferences(std::string_view text, bool inAttribute) {
+  std::string decoded;
+  decoded.reserve(text.size());
+  size_t i = 0;
+  while (i < text.size()) {
+    size_t amp = text.find('&', i);
+    if (amp == std::string_view::npos) {
+      decoded.append(text.substr(i));
+      break;
+    }
+    decoded.append(text.substr(i, amp - i));
+    CharacterReference reference;
+    matchCharacterReference(text.data() + amp, text.size() - amp, true, inAttribute, reference);
+    if (reference.length == 0) {
+      decoded += '&';
+      i = amp + 1;
+    } else {
+      decoded.append(reference.text());
+      i = amp + reference.length;
+    }
+  }
+  return decoded;
+}
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,52 @@
+/**
+ * HtmlEntities.h
+ *
+ * HTML character reference decoding for the tokenizer.
+ * Named references cover the full HTML5 table (see GeneratedEntityTrie.h);
+ * numeric references follow the HTML5 replacement rules.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace facebook::react::parsing {
+
+/**
+ * A decoded character reference. Holds at most two code points as UTF-8.
+ */
+struct CharacterReference {
+  // Input bytes consumed, including '&'. 0 if the '&' starts no reference.
+  size_t length = 0;
+  char utf8[8] = {};
+  size_t utf8Length = 0;
+
+  std::string_view text() const {
+    return std::string_view(utf8, utf8Length);
+  }
+};
+
+/**
+ * Decode the character reference starting at data[0], which must be '&'.
+ * Named references use the longest matching name, including the legacy names
+ * without ';'. In attributes, a legacy name followed by '=' or an
+ * alphanumeric is not decoded.
+ *
+ * @param atEnd Whether data holds all remaining input
+ * @return false if more input could change the result (only when !atEnd)
+ */
+bool matchCharacterReference(
+    const char* data,
+    size_t size,
+    bool atEnd,
+    bool inAttribute,
+    CharacterReference& reference);
+
+/**
+ * Decode all character references in complete text.
+ */
+std::string decodeCharacterReferences(std::string_view text, bool inAttribute = false);
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,400 @@
+/**
+ * IncrementalParseSession.cpp
+ *
+ * Incremental parsing implementation.
+ */
+
+#include "IncrementalParseSession.h"
+#include "ParallelMarkupParser.h"
+#include "ParseStats.h"
+#include "PipelineMetrics.h"
+#include "PipelinePhase.h"
+#include "TextNormalizer.h"
+#include "Utf8Validator.h"
+
+#include <algorithm>
+#include <optional>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+MarkupSegmentParser::Options sessionParserOptions() {
+  MarkupSegmentParser::Options options = renderingParserOptions();
+  options.trackBlocks = true;
+  return options;
+}
+
+std::shared_ptr<ParseSnapshot> makeSnapshot(std::string markup, MarkupSegmentParser parser) {
+  auto snapshot = std::make_shared<ParseSnapshot>();
+  snapshot->bytes = sizeof(ParseSnapshot) + markup.size() +
+      parser.blocks().size() * sizeof(BlockBoundary);
+  for (const auto& segment : parser.segments()) {
+    snapshot->bytes += sizeof(FabricRichTextSegment) + segment.text.size() + segment.linkUrl.size();
+  }
+  snapshot->markup = std::move(markup);
+  snapshot->parser = std::move(parser);
+  return snapshot;
+}
+
+void keepFragments(
+    ParseSnapshot& snapshot,
+    const StyleOptions& options,
+    FragmentBuildContext context,
+    std::vector<BuiltFragment> fragments) {
+  for (const auto& cached : fragments) {
+    snapshot.bytes += sizeof(BuiltFragment) + cached.fragment.string.size();
+  }
+  snapshot.builtOptions = options;
+  snapshot.buildContext = std::move(context);
+  snapshot.fragments = std::move(fragments);
+}
+
+} // namespace
+
+IncrementalParseSession::IncrementalParseSession()
+    : parser_(sessionParserOptions()) {}
+
+AttributedStringResult IncrementalParseSession::update(
+    const std::string& rawMarkup,
+    const StyleOptions& options) {
+  TraceScope trace("parseMarkupIncremental", TraceArgs{0, rawMarkup.size(), 0});
+  if (trace.enabled()) {
+    trace.args().hash = hashMarkup(rawMarkup);
+  }
+  std::string repairBuffer;
+  std::string_view markup;
+  {
+    PhaseTimer timer(MetricPhase::Sanitize, rawMarkup.size());
+    markup = ensureValidUtf8(rawMarkup, repairBuffer);
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  restoreAdoptedLocked();
+  std::optional<PhaseTimer> tokenizeTimer(std::in_place, MetricPhase::Tokenize, markup.size());
+
+  bool extendsPrevious = tracksMarkup_ &&
+      markup.size() >= markup_.size() &&
+      markup.compare(0, markup_.size(), markup_) == 0;
+
+  if (extendsPrevious) {
+    std::string_view tail = markup.substr(markup_.size());
+    parser_.feed(tail);
+    markup_.append(tail);
+    lastUpdateParsedBytes_ = tail.size();
+  } else if (tracksMarkup_ && reparseChangedBlocksLocked(markup)) {
+    markup_ = markup;
+  } else {
+    resetLocked();
+    parser_ = parseMarkupParallel(markup, sessionParserOptions());
+    markup_ = markup;
+    tracksMarkup_ = true;
+    lastUpdateParsedBytes_ = markup.size();
+  }
+  lastUpdateResumed_ = extendsPrevious;
+  tokenizeTimer.reset();
+  // Re-parsing every byte is a full parse, whichever path got there
+  bool parsedAll = !markup.empty() && lastUpdateParsedBytes_ >= markup.size();
+  recordParse(parsedAll ? ParseKind::Full : ParseKind::Incremental);
+
+  auto result = buildLocked(options);
+  trace.args().fragments = result.attributedString.getFragments().size();
+  return result;
+}
+
+void IncrementalParseSession::append(std::string_view chunk) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  restoreAdoptedLocked();
+  if (tracksMarkup_) {
+    // Appended input is not retained, so update() can no longer detect appends
+    markup_.clear();
+    markup_.shrink_to_fit();
+    tracksMarkup_ = false;
+  }
+
+  // A code point split between chunks is parsed once the next chunk completes it
+  std::string joined;
+  if (!utf8Carry_.empty()) {
+    joined = utf8Carry_;
+    joined.append(chunk);
+    chunk = joined;
+  }
+  size_t carry = incompleteUtf8Suffix(chunk);
+  std::string repairBuffer;
+  parser_.feed(ensureValidUtf8(chunk.substr(0, chunk.size() - carry), repairBuffer));
+  utf8Carry_.assign(chunk.substr(chunk.size() - carry));
+}
+
+AttributedStringResult IncrementalParseSession::build(const StyleOptions& options) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  restoreAdoptedLocked();
+  return buildLocked(options);
+}
+
+void IncrementalParseSession::reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  resetLocked();
+}
+
+bool IncrementalParseSession::isEmpty() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return parser_.bytesFed() == 0 && adopted_ == nullptr;
+}
+
+void IncrementalParseSession::adopt(std::shared_ptr<const ParseSnapshot> snapshot) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (parser_.bytesFed() == 0 && adopted_ == nullptr) {
+    adopted_ = std::move(snapshot);
+  }
+}
+
+std::shared_ptr<const ParseSnapshot> IncrementalParseSession::snapshot() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (adopted_ != nullptr) {
+    return adopted_;
+  }
+  if (!tracksMarkup_) {
+    return nullptr;
+  }
+  auto snapshot = makeSnapshot(markup_, parser_);
+  keepFragments(*snapshot, builtOptions_, buildContext_, fragmentCache_);
+  return snapshot;
+}
+
+AttributedStringResult IncrementalParseSession::parseWithSnapshot(
+    const std::string& markup,
+    const StyleOptions& options) {
+  if (markup.empty()) {
+    return AttributedStringResult{};
+  }
+  recordParse(ParseKind::Full);
+  TraceScope trace("parseMarkup", TraceArgs{0, markup.size(), 0});
+  if (trace.enabled()) {
+    trace.args().hash = hashMarkup(markup);
+  }
+  IncrementalParseSession session;
+  std::string repairBuffer;
+  std::string_view input;
+  {
+    PhaseTimer timer(MetricPhase::Sanitize, markup.size());
+    input = ensureValidUtf8(markup, repairBuffer);
+  }
+  {
+    PhaseTimer timer(MetricPhase::Tokenize, markup.size());
+    session.parser_ = parseMarkupParallel(input, sessionParserOptions());
+  }
+  // A local session: nothing else can reach it, so no lock is taken
+  auto result = session.buildLocked(options);
+  auto snapshot = makeSnapshot(std::string(input), std::move(session.parser_));
+  keepFragments(
+      *snapshot, session.builtOptions_, std::move(session.buildContext_), std::move(session.fragmentCache_));
+  result.snapshot = std::move(snapshot);
+  trace.args().fragments = result.attributedString.getFragments().size();
+  return result;
+}
+
+void IncrementalParseSession::restoreAdoptedLocked() {
+  if (adopted_ == nullptr) {
+    return;
+  }
+  parser_ = adopted_->parser;
+  markup_ = adopted_->markup;
+  tracksMarkup_ = true;
+  builtOptions_ = adopted_->builtOptions;
+  buildContext_ = adopted_->buildContext;
+  fragmentCache_ = adopted_->fragments;
+  adopted_.reset();
+}
+
+bool IncrementalParseSession::lastUpdateResumed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return lastUpdateResumed_;
+}
+
+size_t IncrementalParseSession::lastUpdateParsedBytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return lastUpdateParsedBytes_;
+}
+
+bool IncrementalParseSession::reparseChangedBlocksLocked(std::string_view markup) {
+  const auto& blocks = parser_.blocks();
+  if (blocks.empty()) {
+    return false;
+  }
+  const std::string_view previous = markup_;
+  const std::string_view current = markup;
+
+  // Restart after the last block whose parse only read unchanged input
+  size_t commonLength = std::min(previous.size(), current.size());
+  size_t prefixLength = static_cast<size_t>(
+      std::mismatch(previous.begin(), previous.begin() + commonLength, current.begin()).first -
+      previous.begin());
+  auto restartIt = std::partition_point(blocks.begin(), blocks.end(), [&](const BlockBoundary& block) {
+    return block.inputHorizon <= prefixLength;
+  });
+  size_t restartSource = 0;
+  size_t restartSegment = 0;
+  MarkupSegmentParser next(sessionParserOptions());
+  if (restartIt != blocks.begin()) {
+    size_t restartBlock = static_cast<size_t>(restartIt - blocks.begin()) - 1;
+    next = parser_.prefixThroughBlock(restartBlock);
+    restartSource = blocks[restartBlock].sourceEnd;
+    restartSegment = blocks[restartBlock].segmentEnd;
+  }
+
+  // Where the previous markup ended up in the new markup, if unchanged
+  auto alignedOffset = [&](size_t previousOffset) {
+    return current.size() - (previous.size() - previousOffset);
+  };
+  auto unchangedFrom = [&](size_t previousOffset) {
+    return previous.size() - previousOffset <= current.size() &&
+           alignedOffset(previousOffset) >= restartSource;
+  };
+
+  // Walk back from the end while blocks keep their source, collecting the
+  // boundaries after which the previous parse can be reused
+  std::vector<size_t> reusableBlocks;
+  size_t trailingStart = blocks.back().sourceEnd;
+  if (unchangedFrom(trailingStart) &&
+      previous.substr(trailingStart) == current.substr(alignedOffset(trailingStart))) {
+    reusableBlocks.push_back(blocks.size() - 1);
+    for (size_t k = blocks.size() - 1; k > 0; --k) {
+      size_t start = blocks[k - 1].sourceEnd;
+      if (!unchangedFrom(start)) {
+        break;
+      }
+      std::string_view candidate = current.substr(alignedOffset(start), blocks[k].sourceEnd - start);
+      if (hashMarkup(candidate) != blocks[k].sourceHash ||
+          candidate != previous.substr(start, candidate.size())) {
+        break;
+      }
+      reusableBlocks.push_back(k - 1);
+    }
+  }
+
+  // Parse the changed region, trying each reusable boundary in order
+  size_t position = restartSource;
+  for (auto it = reusableBlocks.rbegin(); it != reusableBlocks.rend(); ++it) {
+    size_t previousBlock = *it;
+    size_t previousSegment = blocks[previousBlock].segmentEnd;
+    size_t target = alignedOffset(blocks[previousBlock].sourceEnd);
+    if (target < position) {
+      continue;
+    }
+    next.feed(current.substr(position, target - position));
+    position = target;
+    if (!next.matchesBlock(parser_, previousBlock)) {
+      continue;
+    }
+
+    // Keep cached fragments for the unchanged prefix and the reused tail
+    size_t reparsedSegments = next.segments().size();
+    std::vector<BuiltFragment> cache;
+    if (fragmentCache_.size() > previousSegment) {
+      cache.reserve(reparsedSegments + fragmentCache_.size() - previousSegment);
+    }
+    for (size_t i = 0; i < std::min(restartSegment, fragmentCache_.size()); ++i) {
+      cache.push_back(std::move(fragmentCache_[i]));
+    }
+    cache.resize(reparsedSegments);
+    for (size_t i = previousSegment; i < fragmentCache_.size(); ++i) {
+      cache.push_back(std::move(fragmentCache_[i]));
+    }
+    fragmentCache_ = std::move(cache);
+
+    next.spliceTail(std::move(parser_), previousBlock);
+    parser_ = std::move(next);
+    lastUpdateParsedBytes_ = position - restartSource;
+    return true;
+  }
+
+  next.feed(current.substr(position));
+  if (fragmentCache_.size() > restartSegment) {
+    fragmentCache_.resize(restartSegment);
+  }
+  parser_ = std::move(next);
+  lastUpdateParsedBytes_ = current.size() - restartSource;
+  return true;
+}
+
+void IncrementalParseSession::resetLocked() {
+  adopted_.reset();
+  parser_ = MarkupSegmentParser(sessionParserOptions());
+  markup_.clear();
+  utf8Carry_.clear();
+  tracksMarkup_ = false;
+  lastUpdateResumed_ = false;
+  lastUpdateParsedBytes_ = 0;
+  fragmentCache_.clear();
+}
+
+AttributedStringResult IncrementalParseSession::buildLocked(const StyleOptions& options) {
+  PipelinePhaseScope phase(PipelinePhase::Build);
+  PhaseTimer timer(MetricPhase::Build, parser_.bytesFed());
+  if (options != builtOptions_) {
+    fragmentCache_.clear();
+    builtOptions_ = options;
+    buildContext_ = FragmentBuildContext(options);
+  }
+
+  // Completed segments are final; only the trailing run is re-derived
+  const auto& stable = parser_.segments();
+  ParseLimitsHit limitsHit = 0;
+  // A held-back partial UTF-8 sequence ends the input as U+FFFD, like the
+  // whole document would; it stays held back for a later append() to complete
+  std::string repairBuffer;
+  std::string_view pendingInput = utf8Carry_.empty() ? std::string_view{} : ensureValidUtf8(utf8Carry_, repairBuffer);
+  auto tail = parser_.previewFinish(&limitsHit, pendingInput);
+  auto segmentAt = [&](size_t index) -> const FabricRichTextSegment& {
+    return index < stable.size() ? stable[index] : tail[index - stable.size()];
+  };
+
+  // Trim trailing paragraph break segments
+  size_t segmentCount = stable.size() + tail.size();
+  while (segmentCount > 0 && isParagraphBreak(segmentAt(segmentCount - 1).text)) {
+    segmentCount--;
+  }
+
+  AttributedStringResult result;
+  result.limitsHit = limitsHit;
+  result.summary.addLimitsHit(limitsHit);
+  if (segmentCount == 0) {
+    return result;
+  }
+
+  fragmentCache_.resize(stable.size());
+
+  LinkTableBuilder links;
+  for (size_t segIdx = 0; segIdx < segmentCount; ++segIdx) {
+    const auto& segment = segmentAt(segIdx);
+    bool isLast = segIdx == segmentCount - 1;
+
+    if (!isLast && segIdx < stable.size()) {
+      auto& cached = fragmentCache_[segIdx];
+      if (!cached.built) {
+        cached.visible = buildFragment(segment, options, buildContext_, false, cached.fragment);
+        cached.built = true;
+      }
+      if (cached.visible) {
+        summarizeFragment(result.summary, segment, cached.fragment.string);
+        links.add(result.attributedString.getFragments().size(), segment.linkUrl);
+        result.attributedString.appendFragment(cached.fragment);
+      }
+      continue;
+    }
+
+    AttributedString::Fragment fragment;
+    if (buildFragment(segment, options, buildContext_, isLast, fragment)) {
+      summarizeFragment(result.summary, segment, fragment.string);
+      links.add(result.attributedString.getFragments().size(), segment.linkUrl);
+      result.attributedString.appendFragment(std::move(fragment));
+    }
+  }
+  result.links = std::move(links).build();
+
+  result.accessibilityPauses = findAccessibilityPauses(result.attributedString);
+  finishSummary(result);
+
+  return result;
+}
+
+} // namespace facebook::react::parsing
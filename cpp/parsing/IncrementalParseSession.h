@@ -0,0 +1,155 @@
+/**
+ * IncrementalParseSession.h
+ *
+ * Incremental parsing for streamed and edited markup.
+ * Keeps a resumable MarkupSegmentParser and the fragments built from its
+ * completed segments, so markup that grows by appends only re-parses and
+ * re-builds the new tail, and markup edited in the middle only re-parses
+ * the changed blocks, instead of the whole document.
+ */
+
+#pragma once
+
+#include "AttributedStringBuilder.h"
+#include "MarkupSegmentParser.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace facebook::react::parsing {
+
+/**
+ * Fragment built from a completed segment, kept for the next build.
+ */
+struct BuiltFragment {
+  bool built = false;
+  bool visible = false;
+  AttributedString::Fragment fragment;
+};
+
+/**
+ * Tokenizer state and built fragments after a session parsed complete
+ * markup. Results parsed ahead of time (scheduled and cached parses) keep
+ * it, so a session that picks such a result up resumes from it instead of
+ * re-parsing and re-building the whole markup on its first update.
+ */
+struct ParseSnapshot {
+  std::string markup;          // Parsed markup, after UTF-8 repair
+  MarkupSegmentParser parser;  // Not finished; tracks blocks
+  StyleOptions builtOptions;   // Options the fragments were built with
+  FragmentBuildContext buildContext;
+  std::vector<BuiltFragment> fragments;
+  size_t bytes = 0;            // Approximate heap size, as charged by ParseCache
+};
+
+/**
+ * Parse session that reuses the previous parse for unchanged input.
+ *
+ * Two ways to drive it:
+ * - update(markup, options) with the full markup each time. If the markup
+ *   has the previously parsed markup as a prefix, parsing resumes where it
+ *   stopped. Otherwise parsing restarts at the last block boundary before
+ *   the first change, and stops as soon as it reaches a block boundary
+ *   after which the previous blocks are unchanged (compared by source hash)
+ *   and the parser state matches; the segments and fragments of those
+ *   blocks are reused.
+ * - append(chunk) followed by build(options), for documents that arrive in
+ *   chunks and should never be held as one contiguous string.
+ *
+ * Results are identical to FabricMarkupParser::parseMarkupWithLinkUrls on the
+ * same markup. All methods are thread-safe.
+ */
+class IncrementalParseSession {
+ public:
+  IncrementalParseSession();
+
+  /**
+   * Parse the full markup, resuming from the previous update() when possible.
+   * @param markup Complete markup (sanitized against the allowlist while parsing)
+   * @param options Base text style
+   * @return Result for the complete markup
+   */
+  AttributedStringResult update(const std::string& markup, const StyleOptions& options);
+
+  /**
+   * Append a chunk of markup to the document. Chunks may split tags,
+   * entities, text and UTF-8 sequences anywhere; an incomplete UTF-8
+   * sequence at the end of a chunk is held back until the next chunk.
+   */
+  void append(std::string_view chunk);
+
+  /**
+   * Build the result for all markup appended so far.
+   */
+  AttributedStringResult build(const StyleOptions& options);
+
+  /**
+   * Discard all parser state and cached fragments.
+   */
+  void reset();
+
+  /**
+   * Resume from markup parsed elsewhere, as if update() had parsed
+   * snapshot->markup. The snapshot is copied by the next call that parses
+   * or builds. Does nothing if the session is not empty.
+   */
+  void adopt(std::shared_ptr<const ParseSnapshot> snapshot);
+
+  /**
+   * Copy of the parse of the last update(), or nullptr if there is none
+   * (nothing parsed, or input added through append()).
+   */
+  std::shared_ptr<const ParseSnapshot> snapshot() const;
+
+  /**
+   * Parse markup on a new session and keep its parse in result.snapshot.
+   * Same result as parseAndBuildAttributedString().
+   */
+  static AttributedStringResult parseWithSnapshot(const std::string& markup, const StyleOptions& options);
+
+  /**
+   * Whether nothing has been parsed since construction or reset().
+   */
+  bool isEmpty() const;
+
+  /**
+   * Whether the last update() extended the previously parsed markup.
+   */
+  bool lastUpdateResumed() const;
+
+  /**
+   * Number of markup bytes the last update() had to parse.
+   */
+  size_t lastUpdateParsedBytes() const;
+
+ private:
+  bool reparseChangedBlocksLocked(std::string_view markup);
+  void resetLocked();
+  void restoreAdoptedLocked();
+  AttributedStringResult buildLocked(const StyleOptions& options);
+
+  mutable std::mutex mutex_;
+  MarkupSegmentParser parser_;
+
+  // Markup parsed through update(), used to detect appends.
+  // Not retained for append(), which callers guarantee to be contiguous.
+  std::string markup_;
+  // Trailing bytes of the last append() that end inside a UTF-8 sequence
+  std::string utf8Carry_;
+  // Adopted parse, restored into parser_ and markup_ when first needed
+  std::shared_ptr<const ParseSnapshot> adopted_;
+  bool tracksMarkup_ = false;
+  bool lastUpdateResumed_ = false;
+  size_t lastUpdateParsedBytes_ = 0;
+
+  // Fragments for completed segments by segment index, valid for builtOptions_.
+  // Built as non-last fragments; the document's last fragment is always rebuilt.
+  StyleOptions builtOptions_;
+  FragmentBuildContext buildContext_;
+  std::vector<BuiltFragment> fragmentCache_;
+};
+
+} // namespace facebook::react::parsing
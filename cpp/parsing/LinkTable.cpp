@@ -0,0 +1,57 @@
+/**
+ * LinkTable.cpp
+ *
+ * Interned link table implementation.
+ */
+
+#include "LinkTable.h"
+
+#include <algorithm>
+
+namespace facebook::react::parsing {
+
+const std::string* LinkTable::urlAt(size_t fragmentIndex) const {
+  // First run starting after the fragment; the one before may contain it
+  auto it = std::upper_bound(runs_.begin(), runs_.end(), fragmentIndex, [](size_t index, const LinkRun& run) {
+    return index < run.firstFragment;
+  });
+  if (it == runs_.begin()) {
+    return nullptr;
+  }
+  --it;
+  return fragmentIndex < it->endFragment() ? &urls_[it->urlId] : nullptr;
+}
+
+size_t LinkTable::heapBytes() const {
+  size_t bytes = runs_.capacity() * sizeof(LinkRun) + urls_.capacity() * sizeof(std::string);
+  for (const auto& url : urls_) {
+    bytes += url.size();
+  }
+  return bytes;
+}
+
+void LinkTableBuilder::add(size_t fragmentIndex, const std::string& url) {
+  if (url.empty()) {
+    return;
+  }
+
+  auto& runs = table_.runs_;
+  // Fragments of one styled link arrive together: extend the last run
+  if (!runs.empty() && runs.back().endFragment() == fragmentIndex && table_.urls_[runs.back().urlId] == url) {
+    runs.back().fragmentCount++;
+    return;
+  }
+
+  auto [it, inserted] = urlIds_.try_emplace(url, static_cast<uint32_t>(table_.urls_.size()));
+  if (inserted) {
+    table_.urls_.push_back(url);
+  }
+  runs.push_back(LinkRun{fragmentIndex, 1, it->second});
+}
+
+LinkTable LinkTableBuilder::build() && {
+  urlIds_.clear();
+  return std::move(table_);
+}
+
+} // namespace facebook::react::parsing
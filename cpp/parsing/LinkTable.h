@@ -0,0 +1,96 @@
+/**
+ * LinkTable.h
+ *
+ * Links of a parse result: each distinct URL stored once, plus the runs of
+ * fragments that link to it. Size follows the number of links in the text,
+ * not the number of fragments.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react::parsing {
+
+/**
+ * Consecutive fragments [firstFragment, firstFragment + fragmentCount)
+ * linking to urls()[urlId].
+ */
+struct LinkRun {
+  size_t firstFragment = 0;
+  size_t fragmentCount = 0;
+  uint32_t urlId = 0;
+
+  size_t endFragment() const {
+    return firstFragment + fragmentCount;
+  }
+
+  bool operator==(const LinkRun& other) const = default;
+};
+
+/**
+ * Interned URL table and fragment runs sorted by firstFragment.
+ * A link split across styled fragments is one run; runs never overlap.
+ */
+class LinkTable {
+ public:
+  /**
+   * Distinct URLs, in order of first appearance.
+   */
+  const std::vector<std::string>& urls() const {
+    return urls_;
+  }
+
+  /**
+   * Runs sorted by firstFragment.
+   */
+  const std::vector<LinkRun>& runs() const {
+    return runs_;
+  }
+
+  bool empty() const {
+    return runs_.empty();
+  }
+
+  /**
+   * URL of a fragment, or nullptr if it is not part of a link.
+   */
+  const std::string* urlAt(size_t fragmentIndex) const;
+
+  /**
+   * Approximate heap footprint.
+   */
+  size_t heapBytes() const;
+
+  bool operator==(const LinkTable& other) const = default;
+
+ private:
+  friend class LinkTableBuilder;
+
+  std::vector<std::string> urls_;
+  std::vector<LinkRun> runs_;
+};
+
+/**
+ * Builds a LinkTable from the link URL of each fragment, in fragment order.
+ */
+class LinkTableBuilder {
+ public:
+  /**
+   * Record the URL of a fragment. Empty URLs are not links.
+   * Fragment indices must increase between calls.
+   */
+  void add(size_t fragmentIndex, const std::string& url);
+
+  LinkTable build() &&;
+
+ private:
+  LinkTable table_;
+  std::unordered_map<std::string, uint32_t> urlIds_;
+};
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,161 @@
+/**
+ * MarkupSanitizer.cpp
+ *
+ * Allowlist checks for the sanitizing stage of MarkupSegmentParser.
+ */
+
+#include "MarkupSanitizer.h"
+#include "GeneratedAllowlist.h"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+template <size_t N>
+bool contains(const std::array<std::string_view, N>& values, std::string_view value) {
+  return std::find(values.begin(), values.end(), value) != values.end();
+}
+
+bool isTagNameEnd(char c) {
+  return c == '/' || std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+bool isSpaceChar(char c) {
+  return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+bool equalsLowercase(std::string_view value, std::string_view lower) {
+  return value.size() == lower.size() &&
+      std::equal(lower.begin(), lower.end(), value.begin(), [](char a, char b) {
+        return a == std::tolower(static_cast<unsigned char>(b));
+      });
+}
+
+// Elements whose content is script, styling, embedded documents or raw text
+// that was never meant to be displayed.
+constexpr std::array<std::string_view, 10> kDroppedContentTags = {
+    "script", "style", "template", "iframe", "noscript",
+    "noembed", "noframes", "object", "textarea", "title",
+};
+
+} // namespace
+
+bool isAllowedTag(std::string_view tag) {
+  return contains(kAllowedTags, tag);
+}
+
+bool isAllowedAttribute(std::string_view attribute) {
+  return contains(kAllowedAttributes, attribute);
+}
+
+bool isAllowedDirValue(std::string_view value) {
+  return std::any_of(kAllowedDirValues.begin(), kAllowedDirValues.end(), [&](std::string_view allowed) {
+    return allowed.size() == value.size() &&
+        std::equal(allowed.begin(), allowed.end(), value.begin(), [](char a, char b) {
+          return a == std::tolower(static_cast<unsigned char>(b));
+        });
+  });
+}
+
+bool hasAllowedUrlProtocol(std::string_view lowerUrl) {
+  return std::any_of(kAllowedProtocols.begin(), kAllowedProtocols.end(), [&](std::string_view protocol) {
+    return lowerUrl.size() > protocol.size() &&
+        lowerUrl.compare(0, protocol.size(), protocol) == 0 &&
+        lowerUrl[protocol.size()] == ':';
+  });
+}
+
+bool isDroppedContentTag(std::string_view tag) {
+  return contains(kDroppedContentTags, tag);
+}
+
+std::string_view tagNameOf(std::string_view tagBody, std::string& lowerBuffer) {
+  size_t start = !tagBody.empty() && tagBody[0] == '/' ? 1 : 0;
+  size_t end = start;
+  while (end < tagBody.size() && !isTagNameEnd(tagBody[end])) {
+    end++;
+  }
+  lowerBuffer.assign(tagBody.substr(start, end - start));
+  for (char& c : lowerBuffer) {
+    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  }
+  return lowerBuffer;
+}
+
+std::string_view attributeValue(std::string_view tagBody, std::string_view name) {
+  size_t i = 0;
+  if (i < tagBody.size() && tagBody[i] == '/') {
+    i++;
+  }
+  while (i < tagBody.size() && !isTagNameEnd(tagBody[i])) {
+    i++;
+  }
+
+  while (i < tagBody.size()) {
+    while (i < tagBody.size() && (isSpaceChar(tagBody[i]) || tagBody[i] == '/')) {
+      i++;
+    }
+    // A name runs to whitespace, '/' or '='; a leading '=' belongs to it
+    size_t nameStart = i;
+    if (i < tagBody.size() && tagBody[i] == '=') {
+      i++;
+    }
+    while (i < tagBody.size() && !isTagNameEnd(tagBody[i]) && tagBody[i] != '=') {
+      i++;
+    }
+    std::string_view attribute = tagBody.substr(nameStart, i - nameStart);
+    if (attribute.empty()) {
+      break;
+    }
+
+    size_t afterName = i;
+    while (i < tagBody.size() && isSpaceChar(tagBody[i])) {
+      i++;
+    }
+    std::string_view value;
+    if (i < tagBody.size() && tagBody[i] == '=') {
+      i++;
+      while (i < tagBody.size() && isSpaceChar(tagBody[i])) {
+        i++;
+      }
+      if (i < tagBody.size() && (tagBody[i] == '"' || tagBody[i] == '\'')) {
+        char quote = tagBody[i++];
+        size_t valueEnd = tagBody.find(quote, i);
+        if (valueEnd == std::string_view::npos) {
+          valueEnd = tagBody.size();
+        }
+        value = tagBody.substr(i, valueEnd - i);
+        i = valueEnd < tagBody.size() ? valueEnd + 1 : valueEnd;
+      } else {
+        size_t valueStart = i;
+        while (i < tagBody.size() && !isSpaceChar(tagBody[i])) {
+          i++;
+        }
+        value = tagBody.substr(valueStart, i - valueStart);
+      }
+    } else {
+      // A name without a value; what follows is the next name
+      i = afterName;
+    }
+
+    if (equalsLowercase(attribute, name)) {
+      return value;
+    }
+  }
+  return {};
+}
+
+bool isComment(std::string_view tagBody) {
+  return tagBody.size() >= 3 && tagBody.compare(0, 3, "!--") == 0;
+}
+
+bool isUnterminatedComment(std::string_view tagBody) {
+  // "!--" and "!---" end in "--" too: "<!-->" and "<!--->" are empty comments
+  return isComment(tagBody) && tagBody.compare(tagBody.size() - 2, 2, "--") != 0;
+}
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,71 @@
+/**
+ * MarkupSanitizer.h
+ *
+ * Allowlist checks for the sanitizing stage of MarkupSegmentParser.
+ * The allowlist is generated from src/core/constants.ts
+ * (see GeneratedAllowlist.h).
+ */
+
+#pragma once
+
+#include <string_view>
+
+namespace facebook::react::parsing {
+
+/**
+ * Check if a tag is kept by the sanitizer.
+ * @param tag Lowercase tag name without '<', '/' or attributes
+ */
+bool isAllowedTag(std::string_view tag);
+
+/**
+ * Check if an attribute is read from allowed tags.
+ * @param attribute Lowercase attribute name
+ */
+bool isAllowedAttribute(std::string_view attribute);
+
+/**
+ * Check if a dir attribute value is allowed (case-insensitive).
+ */
+bool isAllowedDirValue(std::string_view value);
+
+/**
+ * Check if a URL starts with an allowed scheme followed by ':'.
+ * @param lowerUrl Lowercase URL without leading whitespace
+ */
+bool hasAllowedUrlProtocol(std::string_view lowerUrl);
+
+/**
+ * Check if an element's content is dropped along with the element
+ * (script, style and other elements whose content is not text).
+ * @param tag Lowercase tag name
+ */
+bool isDroppedContentTag(std::string_view tag);
+
+/**
+ * Extract the lowercase element name from a tag body (text between '<' and
+ * '>'), without a leading '/' and ending at whitespace or '/'.
+ */
+std::string_view tagNameOf(std::string_view tagBody, std::string& lowerBuffer);
+
+/**
+ * Raw value of the attribute named name (lowercase) in a tag body, as
+ * HTML tokenizes it: names are matched whole and case-insensitively,
+ * values are double-, single- or unquoted, and the first occurrence wins.
+ * Text inside other attributes' values never matches. Empty if absent.
+ */
+std::string_view attributeValue(std::string_view tagBody, std::string_view name);
+
+/**
+ * Whether a tag body starts a comment ("!--"). A '<' inside a comment is
+ * part of it, however short the comment is so far.
+ */
+bool isComment(std::string_view tagBody);
+
+/**
+ * Whether a tag body starts a comment ("!--") that a '>' does not end: only
+ * "-->" ends a comment, as do the empty comments "<!-->" and "<!--->".
+ */
+bool isUnterminatedComment(std::string_view tagBody);
+
+} // namespace facebook::react::parsing
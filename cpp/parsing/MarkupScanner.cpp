@@ -0,0 +1,48 @@
+/**
+ * MarkupScanner.cpp
+ *
+ * Word-at-a-time (SWAR) text run scanning.
+ */
+
+#include "MarkupScanner.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+constexpr uint64_t kOnes = 0x0101010101010101ULL;
+constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+
+// Nonzero if any byte of word equals the byte repeated in pattern
+uint64_t hasByte(uint64_t word, uint64_t pattern) {
+  uint64_t x = word ^ pattern;
+  return (x - kOnes) & ~x & kHighBits;
+}
+
+bool isTextDelimiter(char c) {
+  return c == '<' || c == '>' || c == '&';
+}
+
+} // namespace
+
+size_t findTextDelimiter(const char* data, size_t size) {
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    if (hasByte(word, kOnes * '<') | hasByte(word, kOnes * '>') | hasByte(word, kOnes * '&')) {
+      break;
+    }
+  }
+  for (; i < size; ++i) {
+    if (isTextDelimiter(data[i])) {
+      return i;
+    }
+  }
+  return size;
+}
+
+} // namespace facebook::react::parsing
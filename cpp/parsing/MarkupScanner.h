@@ -0,0 +1,20 @@
+/**
+ * MarkupScanner.h
+ *
+ * Fast scanning of markup text runs for the tokenizer.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace facebook::react::parsing {
+
+/**
+ * Find the first byte that ends a run of plain text: '<', '>' or '&'.
+ * Scans eight bytes per step, so text without markup is copied in bulk.
+ * @return Offset of the delimiter, or size if there is none
+ */
+size_t findTextDelimiter(const char* data, size_t size);
+
+} // namespace facebook::react::parsing
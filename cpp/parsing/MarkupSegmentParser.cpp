@@ -6,9 +6,18 @@
 
 #include "MarkupSegmentParser.h"
 #include "DirectionContext.h"
+#include "HtmlEntities.h"
+#include "MarkupSanitizer.h"
+#include "MarkupScanner.h"
+#include "ParallelMarkupParser.h"
+#include "PipelinePhase.h"
 #include "TextNormalizer.h"
+#include "UnicodeUtils.h"
+#include "Utf8Validator.h"
 
+#include <algorithm>
 #include <cctype>
+#include <iterator>
 
 namespace facebook::react::parsing {
 
@@ -43,12 +52,8 @@ bool isAllowedUrlScheme(const std::string& url) {
     lowerUrl = lowerUrl.substr(start);
   }
 
-  // Allowlist: only permit safe schemes
-  // http://, https://, mailto:, tel:
-  if (lowerUrl.rfind("http://", 0) == 0 ||
-      lowerUrl.rfind("https://", 0) == 0 ||
-      lowerUrl.rfind("mailto:", 0) == 0 ||
-      lowerUrl.rfind("tel:", 0) == 0) {
+  // Allowlist: only permit safe schemes (ALLOWED_PROTOCOLS in src/core/constants.ts)
+  if (hasAllowedUrlProtocol(lowerUrl)) {
     return true;
   }
 
@@ -70,205 +75,591 @@ bool isAllowedUrlScheme(const std::string& url) {
 }
 
 std::string extractHrefUrl(const std::string& fullTag) {
-  // Look for href=" or href=' in the tag
-  size_t hrefPos = fullTag.find("href=");
-  if (hrefPos == std::string::npos) {
+  std::string_view value = attributeValue(fullTag, "href");
+  if (value.empty()) {
     return "";
   }
-  // Make sure there's a value after href=
-  size_t valueStart = hrefPos + 5;
-  if (valueStart >= fullTag.size()) {
+  std::string url = decodeCharacterReferences(value, true);
+  // Validate URL scheme - reject dangerous protocols
+  if (!isAllowedUrlScheme(url)) {
     return "";
   }
-  char quote = fullTag[valueStart];
-  if (quote == '"' || quote == '\'') {
-    size_t valueEnd = fullTag.find(quote, valueStart + 1);
-    if (valueEnd != std::string::npos && valueEnd > valueStart + 1) {
-      std::string url = fullTag.substr(valueStart + 1, valueEnd - valueStart - 1);
-      // Validate URL scheme - reject dangerous protocols
-      if (!isAllowedUrlScheme(url)) {
-        return "";
-      }
-      return url;
-    }
-  }
-  return "";
+  return url;
 }
 
 std::string extractDirAttr(const std::string& fullTag) {
-  // Look for dir=" or dir=' in the tag
-  size_t dirPos = fullTag.find("dir=");
-  if (dirPos == std::string::npos) {
-    return "";
+  return std::string(attributeValue(fullTag, "dir"));
+}
+
+namespace {
+
+std::string toLowerAscii(std::string value) {
+  for (char& c : value) {
+    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
   }
-  // Make sure there's a value after dir=
-  size_t valueStart = dirPos + 4;
-  if (valueStart >= fullTag.size()) {
-    return "";
+  return value;
+}
+
+bool isSpace(char c) {
+  return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+bool isBlockContainerTag(const std::string& tag) {
+  return tag == "p" || tag == "div" ||
+         tag == "h1" || tag == "h2" || tag == "h3" ||
+         tag == "h4" || tag == "h5" || tag == "h6";
+}
+
+// Whether the tag body (text between '<' and '>') closes a block-level element,
+// using the same tag name rules as normalizeInterTagWhitespace.
+bool closesBlockLevelTag(std::string_view tagBody) {
+  if (tagBody.empty() || tagBody[0] != '/') {
+    return false;
+  }
+  size_t end = 1;
+  while (end < tagBody.size() && !isSpace(tagBody[end])) {
+    end++;
   }
-  char quote = fullTag[valueStart];
-  if (quote == '"' || quote == '\'') {
-    size_t valueEnd = fullTag.find(quote, valueStart + 1);
-    if (valueEnd != std::string::npos && valueEnd > valueStart + 1) {
-      return fullTag.substr(valueStart + 1, valueEnd - valueStart - 1);
+  return isBlockLevelTag(toLowerAscii(std::string(tagBody.substr(1, end - 1))));
+}
+
+bool startsWithIgnoreCase(const char* data, size_t size, size_t pos, const std::string& lowerPattern) {
+  if (pos + lowerPattern.size() > size) {
+    return false;
+  }
+  for (size_t k = 0; k < lowerPattern.size(); ++k) {
+    if (std::tolower(static_cast<unsigned char>(data[pos + k])) != lowerPattern[k]) {
+      return false;
     }
   }
-  return "";
+  return true;
 }
 
-// Helper to extract text content from position until the closing tag (for dir="auto" detection)
-// This looks ahead in the HTML without modifying the parse state
-static std::string extractTextForAutoDetection(
-    const std::string& html,
+// Bytes of content an element's direction is resolved from (dir="auto",
+// <bdi>). Past this the content counts as having no strong character, so
+// the lookahead for each element is bounded however the elements nest.
+constexpr size_t kMaxAutoDirectionLookahead = 4096;
+
+// Collect text content from startPos until the closing tag or the first
+// strong directional character (for dir="auto" detection), reading at most
+// kMaxAutoDirectionLookahead bytes. This looks ahead in the input without
+// modifying the parse state. When normalizeWhitespace is set, whitespace
+// that normalizeInterTagWhitespace would remove is skipped so the result
+// matches a parse of pre-normalized markup.
+//
+// Returns false if the result cannot be determined yet: neither the closing
+// tag nor a strong directional character is in the available input, the
+// lookahead limit is not reached and more input may follow. scanEnd is set
+// to the offset where the scan stopped.
+bool collectAutoDirectionText(
+    const char* data,
+    size_t size,
     size_t startPos,
-    const std::string& tagToClose) {
-  std::string textContent;
-  bool inNestedTag = false;
-  int nestedDepth = 0;
+    const std::string& tagToClose,
+    bool normalizeWhitespace,
+    bool atEnd,
+    std::string& textContent,
+    size_t& scanEnd) {
   std::string closingPattern = "</" + tagToClose;
-
-  for (size_t j = startPos; j < html.size(); ++j) {
-    char ch = html[j];
+  bool inNestedTag = false;
+  bool afterBlockClose = false;
+  bool lastClosedIsBlock = false;
+  // Text before a tag is whole characters; checkedEnd is where the search
+  // for a strong character resumes
+  size_t checkedEnd = 0;
+  // Bytes past the limit are not read, so chunked and whole input agree
+  const size_t limit = std::min(size, startPos + kMaxAutoDirectionLookahead);
+  const bool atLimit = limit == startPos + kMaxAutoDirectionLookahead;
+
+  for (size_t j = startPos; j < limit; ++j) {
+    char ch = data[j];
 
     if (ch == '<') {
+      if (findFirstStrongDirection(std::string_view(textContent).substr(checkedEnd))) {
+        scanEnd = j;
+        return true;
+      }
+      checkedEnd = textContent.size();
       inNestedTag = true;
+      afterBlockClose = false;
       // Check if this is our closing tag
-      std::string remaining = html.substr(j, closingPattern.size() + 1);
-      // Convert to lowercase for comparison
-      std::string lowerRemaining = remaining;
-      for (char& c : lowerRemaining) {
-        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+      if (startsWithIgnoreCase(data, limit, j, closingPattern)) {
+        scanEnd = j + closingPattern.size();
+        return true;
       }
-      if (lowerRemaining.find(closingPattern) == 0) {
-        // Found closing tag at our level
-        if (nestedDepth == 0) {
-          break;
+      if (normalizeWhitespace) {
+        size_t end = j + 1;
+        while (end < limit && data[end] != '>') {
+          end++;
         }
-        nestedDepth--;
+        lastClosedIsBlock = closesBlockLevelTag(std::string_view(data + j + 1, end - j - 1));
       }
       continue;
     }
 
     if (ch == '>') {
       inNestedTag = false;
+      afterBlockClose = lastClosedIsBlock;
       continue;
     }
 
     // Collect text content (not inside tags)
     if (!inNestedTag) {
+      if (normalizeWhitespace && afterBlockClose && isSpace(ch)) {
+        continue;
+      }
+      afterBlockClose = false;
+      if (ch == '&') {
+        CharacterReference reference;
+        if (!matchCharacterReference(data + j, limit - j, atEnd || atLimit, false, reference)) {
+          // The reference continues past the available input
+          break;
+        }
+        if (reference.length > 0) {
+          textContent.append(reference.text());
+          j += reference.length - 1;
+          continue;
+        }
+      }
       textContent += ch;
     }
   }
 
-  return textContent;
+  // Only the first strong character matters, so a partial run is enough once
+  // it contains one.
+  scanEnd = limit;
+  return atEnd || atLimit || findFirstStrongDirection(std::string_view(textContent).substr(checkedEnd)).has_value();
 }
 
-std::vector<FabricRichTextSegment> parseMarkupToSegments(const std::string& markup) {
-  std::vector<FabricRichTextSegment> segments;
-
-  if (markup.empty()) {
-    return segments;
-  }
-
-  std::string currentText;
-  float currentScale = 1.0f;
-  bool currentBold = false;
-  bool currentItalic = false;
-  bool currentUnderline = false;
-  bool currentStrikethrough = false;
-  bool currentLink = false;
-  std::string currentParentTag;
-  std::string currentLinkUrl;  // Track the href URL of the current link
-  bool nextFollowsInline = false;
-  std::vector<std::string> tagStack;
-  std::vector<FabricRichListContext> listStack;
-  std::vector<std::string> linkUrlStack;  // Stack of link URLs for nested <a> tags
-  int linkDepth = 0;  // Track nested depth inside <a href="..."> tags
-
-  // RTL Support: Direction context for tracking writing direction
-  DirectionContext dirContext;
-
-  bool inTag = false;
-  bool inScript = false;
-  bool inStyle = false;
-  std::string tagName;
-
-  auto flushSegment = [&](bool closingInlineElement = false) {
-    if (!currentText.empty()) {
-      FabricRichTextSegment segment;
-      segment.text = currentText;
-      segment.fontScale = currentScale;
-      segment.isBold = currentBold;
-      segment.isItalic = currentItalic;
-      segment.isUnderline = currentUnderline;
-      segment.isStrikethrough = currentStrikethrough;
-      segment.isLink = currentLink;
-      segment.followsInlineElement = nextFollowsInline;
-      segment.parentTag = currentParentTag;
-      segment.linkUrl = currentLinkUrl;
-      // RTL Support: Add direction info
-      segment.writingDirection = dirContext.getEffectiveDirection();
-      segment.isBdiIsolated = dirContext.isIsolated();
-      segment.isBdoOverride = dirContext.isOverride();
-      segments.push_back(std::move(segment));
-      currentText.clear();
+// Boundaries are not recorded with more elements than this open: each
+// copies the open element stacks, and reparsing can start from the last
+// boundary recorded before them.
+constexpr size_t kMaxBlockBoundaryDepth = 64;
+
+// Tags read between checks of the clock against ParseLimits::maxParseTime
+constexpr uint32_t kTagsPerClockCheck = 64;
+
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+uint64_t extendHash(uint64_t hash, const char* data, size_t size) {
+  for (size_t k = 0; k < size; ++k) {
+    hash = (hash ^ static_cast<unsigned char>(data[k])) * kFnvPrime;
+  }
+  return hash;
+}
+
+} // namespace
+
+uint64_t hashMarkup(std::string_view markup) {
+  // FNV-1a, updated byte by byte while parsing
+  return extendHash(14695981039346656037ULL, markup.data(), markup.size());
+}
+
+MarkupSegmentParser::MarkupSegmentParser() = default;
+
+MarkupSegmentParser::MarkupSegmentParser(Options options) : options_(options) {}
+
+MarkupSegmentParser::MarkupSegmentParser(Options options, SegmentParserState state, size_t inputOffset)
+    : options_(options), state_(std::move(state)), bytesFed_(inputOffset), inputHorizon_(inputOffset) {}
+
+SegmentParserState MarkupSegmentParser::topLevelBlockState(Options options) {
+  options.trackBlocks = false;
+  MarkupSegmentParser parser(options);
+  parser.feed("</p>");
+  return parser.state_;
+}
+
+void MarkupSegmentParser::feed(std::string_view chunk) {
+  if (finished_ || chunk.empty() || hitLimit(state_.limitsHit, ParseLimit::InputBytes)) {
+    return;
+  }
+  PipelinePhaseScope phase(PipelinePhase::Tokenize);
+  const size_t maxInputBytes = options_.limits.maxInputBytes;
+  const size_t remaining = maxInputBytes > bytesFed_ ? maxInputBytes - bytesFed_ : 0;
+  if (chunk.size() > remaining) {
+    // The rest of the document is dropped at a code point boundary
+    chunk = chunk.substr(0, remaining);
+    chunk.remove_suffix(incompleteUtf8Suffix(chunk));
+    state_.limitsHit |= static_cast<ParseLimitsHit>(ParseLimit::InputBytes);
+    if (chunk.empty()) {
+      return;
     }
-    nextFollowsInline = closingInlineElement;
-  };
+  }
+  startClock();
+  bytesFed_ += chunk.size();
 
-  auto updateStyleFromStack = [&]() {
-    currentScale = 1.0f;
-    currentBold = false;
-    currentItalic = false;
-    currentUnderline = false;
-    currentStrikethrough = false;
-    currentLink = linkDepth > 0;
-    currentLinkUrl = linkUrlStack.empty() ? "" : linkUrlStack.back();
-    currentParentTag = "";
-    for (const auto& tag : tagStack) {
-      if (tag[0] == 'h' && tag.size() == 2 && tag[1] >= '1' && tag[1] <= '6') {
-        currentScale = getHeadingScale(tag);
-        currentBold = true;
-      }
-      if (tag == "strong" || tag == "b") {
-        currentBold = true;
-      }
-      if (tag == "em" || tag == "i") {
-        currentItalic = true;
-      }
-      if (tag == "u") {
-        currentUnderline = true;
-      }
-      // Links get underline only if they have href (tracked by linkDepth)
-      if (tag == "a" && linkDepth > 0) {
-        currentUnderline = true;
-      }
-      if (tag == "s") {
-        currentStrikethrough = true;
-      }
-      if (isInlineFormattingTag(tag)) {
-        currentParentTag = tag;
-      }
+  if (pending_.empty()) {
+    size_t consumed = process(chunk.data(), chunk.size(), false);
+    if (consumed < chunk.size()) {
+      pending_.assign(chunk.substr(consumed));
+    }
+    return;
+  }
+
+  pending_.append(chunk);
+  size_t consumed = process(pending_.data(), pending_.size(), false);
+  pending_.erase(0, consumed);
+}
+
+void MarkupSegmentParser::finish() {
+  if (finished_) {
+    return;
+  }
+  PipelinePhaseScope phase(PipelinePhase::Tokenize);
+  startClock();
+  process(pending_.data(), pending_.size(), true);
+  pending_.clear();
+  flushSegment();
+  finished_ = true;
+}
+
+std::vector<FabricRichTextSegment> MarkupSegmentParser::previewFinish(
+    ParseLimitsHit* limitsHit,
+    std::string_view pendingInput) const {
+  if (finished_) {
+    if (limitsHit != nullptr) {
+      *limitsHit = state_.limitsHit;
     }
+    return {};
+  }
+  Options tailOptions = options_;
+  tailOptions.trackBlocks = false;
+  MarkupSegmentParser tail(tailOptions);
+  tail.state_ = state_;
+  tail.pending_ = pending_;
+  tail.bytesFed_ = bytesFed_;
+  tail.tagCount_ = tagCount_;
+  // Fragments count towards maxFragments from the segments already emitted
+  tail.segmentOffset_ = segments_.size();
+  if (!pendingInput.empty()) {
+    tail.feed(pendingInput);
+  }
+  tail.finish();
+  if (limitsHit != nullptr) {
+    *limitsHit = tail.state_.limitsHit;
+  }
+  return tail.takeSegments();
+}
+
+MarkupSegmentParser::Checkpoint MarkupSegmentParser::checkpoint() const {
+  return Checkpoint{
+      state_, pending_, segments_.size(), bytesFed_, blocks_.size(), tagCount_, blockHash_, inputHorizon_};
+}
+
+void MarkupSegmentParser::restore(const Checkpoint& checkpoint) {
+  state_ = checkpoint.state;
+  pending_ = checkpoint.pending;
+  if (segments_.size() > checkpoint.segmentCount) {
+    segments_.resize(checkpoint.segmentCount);
+  }
+  if (blocks_.size() > checkpoint.blockCount) {
+    blocks_.resize(checkpoint.blockCount);
+  }
+  bytesFed_ = checkpoint.bytesFed;
+  tagCount_ = checkpoint.tagCount;
+  blockHash_ = checkpoint.blockHash;
+  inputHorizon_ = checkpoint.inputHorizon;
+  finished_ = false;
+}
+
+void MarkupSegmentParser::reset() {
+  state_ = SegmentParserState{};
+  pending_.clear();
+  segments_.clear();
+  blocks_.clear();
+  bytesFed_ = 0;
+  tagCount_ = 0;
+  finished_ = false;
+  blockHash_ = hashMarkup({});
+  inputHorizon_ = 0;
+}
+
+MarkupSegmentParser MarkupSegmentParser::prefixThroughBlock(size_t blockIndex) const {
+  const auto& block = blocks_[blockIndex];
+  MarkupSegmentParser prefix(options_);
+  prefix.state_ = block.state;
+  prefix.segments_.assign(segments_.begin(), segments_.begin() + block.segmentEnd);
+  prefix.blocks_.assign(blocks_.begin(), blocks_.begin() + blockIndex + 1);
+  prefix.bytesFed_ = block.sourceEnd;
+  prefix.tagCount_ = block.tagEnd;
+  prefix.inputHorizon_ = block.inputHorizon;
+  return prefix;
+}
+
+bool MarkupSegmentParser::atBlockBoundary() const {
+  return !finished_ && pending_.empty() && !blocks_.empty() &&
+         blocks_.back().sourceEnd == bytesFed_;
+}
+
+bool MarkupSegmentParser::matchesBlock(const MarkupSegmentParser& previous, size_t blockIndex) const {
+  if (!atBlockBoundary() || blockIndex >= previous.blocks_.size() ||
+      !(state_ == previous.blocks_[blockIndex].state)) {
+    return false;
+  }
+  // The reused tail must not reach a limit from here that it did not there
+  const auto& block = previous.blocks_[blockIndex];
+  const auto& limits = options_.limits;
+  return previous.state_.limitsHit == block.state.limitsHit &&
+         tagCount_ + (previous.tagCount_ - block.tagEnd) <= limits.maxTags &&
+         segments_.size() + (previous.segments_.size() - block.segmentEnd) < limits.maxFragments &&
+         bytesFed_ + (previous.bytesFed_ - block.sourceEnd) <= limits.maxInputBytes;
+}
+
+void MarkupSegmentParser::spliceTail(MarkupSegmentParser&& previous, size_t blockIndex) {
+  const size_t fromSource = previous.blocks_[blockIndex].sourceEnd;
+  const size_t fromSegment = previous.blocks_[blockIndex].segmentEnd;
+  const size_t fromTag = previous.blocks_[blockIndex].tagEnd;
+  const size_t toSource = bytesFed_;
+  const size_t toSegment = segments_.size();
+  const size_t toTag = tagCount_;
+  auto moveOffset = [&](size_t offset) {
+    return offset >= fromSource ? offset - fromSource + toSource : toSource;
   };
 
-  for (size_t i = 0; i < markup.size(); ++i) {
-    char c = markup[i];
+  segments_.insert(
+      segments_.end(),
+      std::make_move_iterator(previous.segments_.begin() + fromSegment),
+      std::make_move_iterator(previous.segments_.end()));
+  for (size_t k = blockIndex + 1; k < previous.blocks_.size(); ++k) {
+    BlockBoundary block = std::move(previous.blocks_[k]);
+    block.sourceEnd = moveOffset(block.sourceEnd);
+    block.inputHorizon = moveOffset(block.inputHorizon);
+    block.segmentEnd = block.segmentEnd - fromSegment + toSegment;
+    block.tagEnd = block.tagEnd - fromTag + toTag;
+    blocks_.push_back(std::move(block));
+  }
+
+  state_ = std::move(previous.state_);
+  pending_ = std::move(previous.pending_);
+  bytesFed_ = moveOffset(previous.bytesFed_);
+  tagCount_ = previous.tagCount_ - fromTag + toTag;
+  blockHash_ = previous.blockHash_;
+  inputHorizon_ = std::max(inputHorizon_, moveOffset(previous.inputHorizon_));
+  finished_ = previous.finished_;
+}
+
+bool MarkupSegmentParser::canContinueWith(const SegmentParserState& startState) const {
+  if (finished_ || !pending_.empty() || !(state_ == startState)) {
+    return false;
+  }
+  // Block hashes restart at the continuation's first byte
+  return !options_.trackBlocks || bytesFed_ == 0 || atBlockBoundary();
+}
+
+bool MarkupSegmentParser::appendStaysWithinLimits(const MarkupSegmentParser& continuation) const {
+  const auto& limits = options_.limits;
+  return continuation.state_.limitsHit == 0 &&
+         tagCount_ + continuation.tagCount_ <= limits.maxTags &&
+         segments_.size() + continuation.segments_.size() < limits.maxFragments;
+}
+
+void MarkupSegmentParser::append(MarkupSegmentParser&& continuation) {
+  const size_t segmentOffset = segments_.size();
+  const size_t tagOffset = tagCount_;
+  segments_.insert(
+      segments_.end(),
+      std::make_move_iterator(continuation.segments_.begin()),
+      std::make_move_iterator(continuation.segments_.end()));
+  for (auto& block : continuation.blocks_) {
+    block.segmentEnd += segmentOffset;
+    block.tagEnd += tagOffset;
+    blocks_.push_back(std::move(block));
+  }
+
+  state_ = std::move(continuation.state_);
+  pending_ = std::move(continuation.pending_);
+  bytesFed_ = continuation.bytesFed_;
+  tagCount_ += continuation.tagCount_;
+  blockHash_ = continuation.blockHash_;
+  inputHorizon_ = std::max(inputHorizon_, continuation.inputHorizon_);
+  finished_ = continuation.finished_;
+}
+
+void MarkupSegmentParser::recordBlockBoundary(size_t sourceEnd) {
+  inputHorizon_ = std::max(inputHorizon_, sourceEnd);
+  if (state_.tagStack.size() > kMaxBlockBoundaryDepth) {
+    // The hash keeps covering the input since the last recorded boundary
+    return;
+  }
+  blocks_.push_back(BlockBoundary{sourceEnd, inputHorizon_, segments_.size(), tagCount_, blockHash_, state_});
+  blockHash_ = hashMarkup({});
+}
+
+void MarkupSegmentParser::flushSegment(bool closingInlineElement) {
+  auto& s = state_;
+  if (!s.currentText.empty()) {
+    FabricRichTextSegment segment;
+    segment.text = std::move(s.currentText);
+    segment.fontScale = s.currentScale;
+    segment.isBold = s.currentBold;
+    segment.isItalic = s.currentItalic;
+    segment.isUnderline = s.currentUnderline;
+    segment.isStrikethrough = s.currentStrikethrough;
+    segment.isLink = s.currentLink;
+    segment.followsInlineElement = s.nextFollowsInline;
+    segment.parentTag = s.currentParentTag;
+    segment.linkUrl = s.currentLinkUrl;
+    segment.headingLevel = s.currentHeadingLevel;
+    segment.hasListMarker = s.currentHasListMarker;
+    // RTL Support: Add direction info
+    segment.writingDirection = s.dirContext.getEffectiveDirection();
+    segment.isBdiIsolated = s.dirContext.isIsolated();
+    segment.isBdoOverride = s.dirContext.isOverride();
+    segments_.push_back(std::move(segment));
+    s.currentText.clear();
+    s.currentHasListMarker = false;
+    if (!s.plainText && segmentOffset_ + segments_.size() >= options_.limits.maxFragments) {
+      enterPlainText(ParseLimit::Fragments);
+    }
+  }
+  s.nextFollowsInline = closingInlineElement;
+}
+
+void MarkupSegmentParser::startClock() {
+  const auto maxParseTime = options_.limits.maxParseTime;
+  hasDeadline_ = maxParseTime.count() > 0;
+  if (hasDeadline_) {
+    deadline_ = std::chrono::steady_clock::now() + maxParseTime;
+  }
+  tagsSinceClockCheck_ = 0;
+}
+
+bool MarkupSegmentParser::pastDeadline() {
+  if (!hasDeadline_ || ++tagsSinceClockCheck_ < kTagsPerClockCheck) {
+    return false;
+  }
+  tagsSinceClockCheck_ = 0;
+  return std::chrono::steady_clock::now() >= deadline_;
+}
+
+void MarkupSegmentParser::enterPlainText(ParseLimit limit) {
+  auto& s = state_;
+  s.limitsHit |= static_cast<ParseLimitsHit>(limit);
+  s.plainText = true;
+  // Open isolates and overrides end with the styled part
+  for (int k = 0; k < s.dirContext.isolationDepth; ++k) {
+    s.currentText += "\xE2\x81\xA9";  // PDI (U+2069)
+  }
+  for (int k = 0; k < s.dirContext.overrideDepth; ++k) {
+    s.currentText += "\xE2\x80\xAC";  // PDF (U+202C)
+  }
+  flushSegment();
+  s.tagStack.clear();
+  s.listStack.clear();
+  s.linkUrlStack.clear();
+  s.linkDepth = 0;
+  s.flattenedDepth = 0;
+  s.dirContext = DirectionContext{};
+  updateStyleFromStack();
+}
+
+void MarkupSegmentParser::pushElement(const std::string& tag) {
+  auto& s = state_;
+  OpenElement element = s.tagStack.empty() ? OpenElement{} : s.tagStack.back();
+  element.tag = tag;
+  if (tag[0] == 'h' && tag.size() == 2 && tag[1] >= '1' && tag[1] <= '6') {
+    element.scale = getHeadingScale(tag);
+    element.bold = true;
+    element.headingLevel = static_cast<uint8_t>(tag[1] - '0');
+  }
+  if (tag == "strong" || tag == "b") {
+    element.bold = true;
+  }
+  if (tag == "em" || tag == "i") {
+    element.italic = true;
+  }
+  if (tag == "u") {
+    element.underline = true;
+  }
+  if (tag == "a") {
+    element.insideAnchor = true;
+  }
+  if (tag == "s") {
+    element.strikethrough = true;
+  }
+  if (isInlineFormattingTag(tag)) {
+    element.parentTag = tag;
+  }
+  s.tagStack.push_back(std::move(element));
+}
+
+void MarkupSegmentParser::updateStyleFromStack() {
+  auto& s = state_;
+  static const OpenElement kNoElement;
+  const OpenElement& top = s.tagStack.empty() ? kNoElement : s.tagStack.back();
+  s.currentScale = top.scale;
+  s.currentBold = top.bold;
+  s.currentItalic = top.italic;
+  // Links get underline only if they have href (tracked by linkDepth)
+  s.currentUnderline = top.underline || (top.insideAnchor && s.linkDepth > 0);
+  s.currentStrikethrough = top.strikethrough;
+  s.currentLink = s.linkDepth > 0;
+  s.currentHeadingLevel = top.headingLevel;
+  s.currentLinkUrl = s.linkUrlStack.empty() ? "" : s.linkUrlStack.back();
+  s.currentParentTag = top.parentTag;
+}
+
+size_t MarkupSegmentParser::process(const char* data, size_t size, bool atEnd) {
+  auto& s = state_;
+  const bool normalize = options_.normalizeWhitespace;
+  const bool trackBlocks = options_.trackBlocks;
+  const bool sanitize = options_.sanitize;
+  // Input offset of data[0]: data always holds the last `size` bytes fed
+  const size_t base = bytesFed_ - size;
+
+  for (size_t i = 0; i < size; ++i) {
+    char c = data[i];
+    const bool decodesReference =
+        c == '&' && !s.inTag && !s.inScript && !s.inStyle && s.droppedContentTag.empty();
+
+    // A '>' or '&' may be revisited after stalling, so it is hashed once handled
+    if (trackBlocks && c != '>' && !decodesReference) {
+      blockHash_ = (blockHash_ ^ static_cast<unsigned char>(c)) * kFnvPrime;
+    }
+
+    // Skip all leading whitespace before the first tag
+    if (normalize && s.beforeFirstTag && isSpace(c)) {
+      continue;
+    }
 
     if (c == '<') {
-      inTag = true;
-      tagName.clear();
+      if (sanitize && s.inTag && isComment(s.tagName)) {
+        s.tagName += c;
+        continue;
+      }
+      s.inTag = true;
+      s.tagName.clear();
+      s.beforeFirstTag = false;
+      s.afterBlockClose = false;
       continue;
     }
 
     if (c == '>') {
-      inTag = false;
-
-      std::string lowerTag = tagName;
-      for (char& ch : lowerTag) {
-        ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+      if (sanitize && s.inTag && isUnterminatedComment(s.tagName)) {
+        // Comments end at "-->", not at the first '>'
+        if (trackBlocks) {
+          blockHash_ = (blockHash_ ^ static_cast<unsigned char>(c)) * kFnvPrime;
+        }
+        s.tagName += c;
+        continue;
+      }
+      if (sanitize && !s.droppedContentTag.empty()) {
+        // Inside dropped content only its closing tag is a tag
+        std::string nameBuffer;
+        if (!s.tagName.empty() && s.tagName[0] == '/' &&
+            tagNameOf(s.tagName, nameBuffer) == s.droppedContentTag) {
+          s.droppedContentTag.clear();
+        }
+        if (trackBlocks) {
+          blockHash_ = (blockHash_ ^ static_cast<unsigned char>(c)) * kFnvPrime;
+        }
+        s.inTag = false;
+        s.tagName.clear();
+        continue;
       }
 
+      std::string lowerTag = toLowerAscii(s.tagName);
+
       // Remove attributes from tag name
       size_t spacePos = lowerTag.find(' ');
       if (spacePos != std::string::npos) {
@@ -278,97 +669,137 @@ std::vector<FabricRichTextSegment> parseMarkupToSegments(const std::string& mark
       bool isClosing = !lowerTag.empty() && lowerTag[0] == '/';
       std::string cleanTag = isClosing ? lowerTag.substr(1) : lowerTag;
 
+      // SECURITY BOUNDARY: Tags outside the allowlist are skipped, keeping
+      // their text; elements like <script> are skipped with their content.
+      if (sanitize) {
+        std::string nameBuffer;
+        std::string_view name = tagNameOf(s.tagName, nameBuffer);
+        if (!isClosing && isDroppedContentTag(name)) {
+          s.droppedContentTag = std::string(name);
+        }
+        cleanTag = isAllowedTag(name) ? std::string(name) : std::string();
+      }
+
+      // Past maxTags or the time limit the rest is read as plain text, and
+      // elements past maxNestingDepth are flattened into their parent
+      const auto& limits = options_.limits;
+      bool overLimit = !s.plainText && (tagCount_ >= limits.maxTags || pastDeadline());
+      bool isBlockOpen = !isClosing && isBlockContainerTag(cleanTag);
+      bool isInlineOpen = !isClosing && isInlineFormattingTag(cleanTag);
+      bool flatten = !s.plainText && !overLimit && (isBlockOpen || isInlineOpen || cleanTag == "ul" || cleanTag == "ol") &&
+          !isClosing && s.tagStack.size() + s.listStack.size() >= limits.maxNestingDepth;
+
+      // Elements with dir="auto" (and <bdi> without dir) take their direction
+      // from their content, which may not have arrived yet.
+      std::string dirAttr;
+      std::string textForDetection;
+      if ((isBlockOpen || isInlineOpen) && !s.plainText && !overLimit && !flatten) {
+        dirAttr = extractDirAttr(s.tagName);
+        if (sanitize && (!isAllowedAttribute("dir") || !isAllowedDirValue(dirAttr))) {
+          dirAttr.clear();
+        }
+        bool needsAutoDetection = dirAttr.empty()
+            ? (isInlineOpen && cleanTag == "bdi")
+            : (toLowerAscii(dirAttr) == "auto");
+        size_t scanEnd = i + 1;
+        if (needsAutoDetection &&
+            !collectAutoDirectionText(data, size, i + 1, cleanTag, normalize, atEnd, textForDetection, scanEnd)) {
+          // Resume at this '>' once more input is available
+          return i;
+        }
+        inputHorizon_ = std::max(inputHorizon_, base + scanEnd);
+      }
+      tagCount_++;
+      if (overLimit) {
+        enterPlainText(tagCount_ > limits.maxTags ? ParseLimit::Tags : ParseLimit::Time);
+      }
+      if (trackBlocks) {
+        blockHash_ = (blockHash_ ^ static_cast<unsigned char>(c)) * kFnvPrime;
+      }
+      bool endsBlock = false;
+
+      if (s.inTag && normalize) {
+        s.lastClosedIsBlock = closesBlockLevelTag(s.tagName);
+      }
+      s.afterBlockClose = s.lastClosedIsBlock;
+      s.inTag = false;
+
       if (cleanTag == "script") {
-        inScript = !isClosing;
+        s.inScript = !isClosing;
       } else if (cleanTag == "style") {
-        inStyle = !isClosing;
+        s.inStyle = !isClosing;
       } else if (cleanTag == "br") {
-        currentText += '\n';
-      } else if (isClosing && (cleanTag == "p" || cleanTag == "div" ||
-                               cleanTag == "h1" || cleanTag == "h2" || cleanTag == "h3" ||
-                               cleanTag == "h4" || cleanTag == "h5" || cleanTag == "h6")) {
-        currentText += '\n';
+        s.currentText += '\n';
+      } else if (s.plainText) {
+        // Blocks stay on their own lines
+        if (isClosing && isBlockLevelTag(cleanTag) && !s.currentText.empty() && s.currentText.back() != '\n') {
+          s.currentText += '\n';
+        }
+      } else if (flatten) {
+        s.flattenedDepth++;
+        s.limitsHit |= static_cast<ParseLimitsHit>(ParseLimit::NestingDepth);
+      } else if (isClosing && s.flattenedDepth > 0 &&
+                 (isBlockContainerTag(cleanTag) || isInlineFormattingTag(cleanTag) || cleanTag == "ul" ||
+                  cleanTag == "ol")) {
+        s.flattenedDepth--;
+        if (isBlockContainerTag(cleanTag)) {
+          s.currentText += '\n';
+          flushSegment();
+          // SECURITY BOUNDARY: as for any block close, unclosed links end here
+          s.linkDepth = 0;
+          s.linkUrlStack.clear();
+          updateStyleFromStack();
+        }
+      } else if (isClosing && isBlockContainerTag(cleanTag)) {
+        s.currentText += '\n';
         flushSegment();
-        if (!tagStack.empty() && tagStack.back() == cleanTag) {
-          tagStack.pop_back();
+        endsBlock = true;
+        if (!s.tagStack.empty() && s.tagStack.back().tag == cleanTag) {
+          s.tagStack.pop_back();
           // RTL Support: Exit element
-          dirContext.exitElement(cleanTag);
+          s.dirContext.exitElement(cleanTag);
           updateStyleFromStack();
         }
         // SECURITY BOUNDARY: Clear any unclosed link state when closing block elements.
         // This prevents malformed HTML like <a href="...">text</p> from making
         // subsequent text clickable. Without this cleanup, an attacker could craft
         // HTML that makes unrelated text appear as a link to a malicious URL.
-        linkDepth = 0;
-        linkUrlStack.clear();
-      } else if (!isClosing && (cleanTag == "h1" || cleanTag == "h2" || cleanTag == "h3" ||
-                                cleanTag == "h4" || cleanTag == "h5" || cleanTag == "h6" ||
-                                cleanTag == "p" || cleanTag == "div")) {
+        s.linkDepth = 0;
+        s.linkUrlStack.clear();
+      } else if (isBlockOpen) {
         flushSegment();
-        tagStack.push_back(cleanTag);
-        // RTL Support: Extract dir attribute and enter element
-        std::string dirAttr = extractDirAttr(tagName);
-        // For dir="auto", look ahead to extract text content for direction detection
-        std::string textForDetection;
-        if (!dirAttr.empty()) {
-          std::string lowerDir = dirAttr;
-          for (char& ch : lowerDir) {
-            ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
-          }
-          if (lowerDir == "auto") {
-            textForDetection = extractTextForAutoDetection(markup, i + 1, cleanTag);
-          }
-        }
-        dirContext.enterElement(cleanTag, dirAttr, textForDetection);
+        pushElement(cleanTag);
+        // RTL Support: Enter element with dir attribute (and content for dir="auto")
+        s.dirContext.enterElement(cleanTag, dirAttr, textForDetection);
         updateStyleFromStack();
-      } else if (!isClosing && isInlineFormattingTag(cleanTag)) {
+      } else if (isInlineOpen) {
         flushSegment();
-        tagStack.push_back(cleanTag);
+        pushElement(cleanTag);
         // Track links with href attribute (check original tagName which still has attributes)
-        if (cleanTag == "a") {
-          std::string url = extractHrefUrl(tagName);
+        if (cleanTag == "a" && (!sanitize || isAllowedAttribute("href"))) {
+          std::string url = extractHrefUrl(s.tagName);
           if (!url.empty()) {
-            linkDepth++;
-            linkUrlStack.push_back(url);
-          }
-        }
-        // RTL Support: Extract dir attribute and enter element
-        std::string dirAttr = extractDirAttr(tagName);
-        // For dir="auto" or <bdi> without dir, look ahead to extract text content for direction detection
-        std::string textForDetection;
-        bool needsAutoDetection = false;
-        if (!dirAttr.empty()) {
-          std::string lowerDir = dirAttr;
-          for (char& ch : lowerDir) {
-            ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+            s.linkDepth++;
+            s.linkUrlStack.push_back(url);
           }
-          needsAutoDetection = (lowerDir == "auto");
-        } else if (cleanTag == "bdi") {
-          // <bdi> defaults to dir="auto" behavior
-          needsAutoDetection = true;
-        }
-        if (needsAutoDetection) {
-          textForDetection = extractTextForAutoDetection(markup, i + 1, cleanTag);
         }
-        dirContext.enterElement(cleanTag, dirAttr, textForDetection);
+        // RTL Support: Enter element with dir attribute (and content for dir="auto"/<bdi>)
+        s.dirContext.enterElement(cleanTag, dirAttr, textForDetection);
 
         // Unicode BiDi control characters for <bdi> and <bdo>
         // Insert isolation/override control characters before content
         if (cleanTag == "bdi") {
           // FSI (U+2068) - First Strong Isolate
-          currentText += "\xE2\x81\xA8";  // UTF-8 encoding of U+2068
+          s.currentText += "\xE2\x81\xA8";  // UTF-8 encoding of U+2068
         } else if (cleanTag == "bdo") {
           // Get effective direction from context for <bdo>
-          std::string lowerDir = dirAttr;
-          for (char& ch : lowerDir) {
-            ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
-          }
+          std::string lowerDir = toLowerAscii(dirAttr);
           if (lowerDir == "rtl") {
             // RLO (U+202E) - Right-to-Left Override
-            currentText += "\xE2\x80\xAE";  // UTF-8 encoding of U+202E
+            s.currentText += "\xE2\x80\xAE";  // UTF-8 encoding of U+202E
           } else if (lowerDir == "ltr") {
             // LRO (U+202D) - Left-to-Right Override
-            currentText += "\xE2\x80\xAD";  // UTF-8 encoding of U+202D
+            s.currentText += "\xE2\x80\xAD";  // UTF-8 encoding of U+202D
           }
           // Note: <bdo> without dir attribute has no directional effect per HTML5 spec
         }
@@ -378,91 +809,141 @@ std::vector<FabricRichTextSegment> parseMarkupToSegments(const std::string& mark
         // Unicode BiDi control characters: close isolation/override before flushing
         if (cleanTag == "bdi") {
           // PDI (U+2069) - Pop Directional Isolate
-          currentText += "\xE2\x81\xA9";  // UTF-8 encoding of U+2069
+          s.currentText += "\xE2\x81\xA9";  // UTF-8 encoding of U+2069
         } else if (cleanTag == "bdo") {
-          // Check if the bdo had a dir attribute (we need to look at tag stack)
           // PDF (U+202C) - Pop Directional Format
           // We insert PDF regardless - it's harmless if no override was started
-          currentText += "\xE2\x80\xAC";  // UTF-8 encoding of U+202C
+          s.currentText += "\xE2\x80\xAC";  // UTF-8 encoding of U+202C
         }
         flushSegment(true);
-        if (!tagStack.empty() && tagStack.back() == cleanTag) {
-          tagStack.pop_back();
+        if (!s.tagStack.empty() && s.tagStack.back().tag == cleanTag) {
+          s.tagStack.pop_back();
           // Pop link URL when closing an <a> tag
-          if (cleanTag == "a" && linkDepth > 0) {
-            linkDepth--;
-            if (!linkUrlStack.empty()) {
-              linkUrlStack.pop_back();
+          if (cleanTag == "a" && s.linkDepth > 0) {
+            s.linkDepth--;
+            if (!s.linkUrlStack.empty()) {
+              s.linkUrlStack.pop_back();
             }
           }
           // RTL Support: Exit element
-          dirContext.exitElement(cleanTag);
+          s.dirContext.exitElement(cleanTag);
           updateStyleFromStack();
         }
       } else if (!isClosing && cleanTag == "li") {
-        if (!currentText.empty() && currentText.back() != '\n') {
-          currentText += '\n';
+        if (!s.currentText.empty() && s.currentText.back() != '\n') {
+          s.currentText += '\n';
         }
-        if (!listStack.empty()) {
-          auto& currentList = listStack.back();
+        if (!s.listStack.empty()) {
+          auto& currentList = s.listStack.back();
           currentList.itemCounter++;
-          int indentLevel = static_cast<int>(listStack.size()) - 1;
+          int indentLevel = static_cast<int>(s.listStack.size()) - 1;
           // Cap indent level to prevent excessive memory allocation
           if (indentLevel > 100) {
             indentLevel = 100;
           }
           if (indentLevel > 0) {
-            currentText += std::string(indentLevel * 4, ' ');
+            s.currentText += std::string(indentLevel * 4, ' ');
           }
           if (currentList.type == FabricRichListType::Ordered) {
-            currentText += std::to_string(currentList.itemCounter) + ". ";
+            s.currentText += std::to_string(currentList.itemCounter) + ". ";
           } else {
-            currentText += "• ";
+            s.currentText += "• ";
           }
         } else {
-          currentText += "• ";
+          s.currentText += "• ";
         }
+        s.currentHasListMarker = true;
       } else if (isClosing && cleanTag == "li") {
         // Add period for screen reader pause if content doesn't end with punctuation
-        if (!currentText.empty()) {
-          char lastChar = currentText.back();
+        if (!s.currentText.empty()) {
+          char lastChar = s.currentText.back();
           if (lastChar != '.' && lastChar != '!' && lastChar != '?' && lastChar != ':' && lastChar != ';') {
-            currentText += '.';
+            s.currentText += '.';
           }
         }
       } else if (!isClosing && cleanTag == "ul") {
-        int nestingLevel = static_cast<int>(listStack.size()) + 1;
-        listStack.push_back({FabricRichListType::Unordered, 0, nestingLevel});
+        int nestingLevel = static_cast<int>(s.listStack.size()) + 1;
+        s.listStack.push_back({FabricRichListType::Unordered, 0, nestingLevel});
       } else if (!isClosing && cleanTag == "ol") {
-        int nestingLevel = static_cast<int>(listStack.size()) + 1;
-        listStack.push_back({FabricRichListType::Ordered, 0, nestingLevel});
+        int nestingLevel = static_cast<int>(s.listStack.size()) + 1;
+        s.listStack.push_back({FabricRichListType::Ordered, 0, nestingLevel});
       } else if (isClosing && (cleanTag == "ul" || cleanTag == "ol")) {
-        if (!listStack.empty()) {
-          listStack.pop_back();
+        if (!s.listStack.empty()) {
+          s.listStack.pop_back();
         }
-        if (listStack.empty()) {
-          currentText += '\n';
+        if (s.listStack.empty()) {
+          s.currentText += '\n';
           flushSegment();
+          endsBlock = true;
         }
       }
 
-      tagName.clear();
+      s.tagName.clear();
+      if (trackBlocks && endsBlock) {
+        recordBlockBoundary(base + i + 1);
+      }
       continue;
     }
 
-    if (inTag) {
-      tagName += c;
+    if (s.inTag) {
+      s.tagName += c;
       continue;
     }
 
-    if (!inScript && !inStyle) {
-      currentText += c;
+    // Skip whitespace from source formatting between block elements
+    if (normalize && s.afterBlockClose && isSpace(c)) {
+      continue;
     }
+    s.beforeFirstTag = false;
+    s.afterBlockClose = false;
+
+    if (decodesReference) {
+      CharacterReference reference;
+      if (!matchCharacterReference(data + i, size - i, atEnd, false, reference)) {
+        // Resume at this '&' once the rest of the reference is available
+        return i;
+      }
+      size_t length = std::max<size_t>(reference.length, 1);
+      if (trackBlocks) {
+        blockHash_ = extendHash(blockHash_, data + i, length);
+      }
+      if (reference.length > 0) {
+        s.currentText.append(reference.text());
+      } else {
+        s.currentText += c;
+      }
+      i += length - 1;
+      continue;
+    }
+
+    // The rest of the text run up to the next '<', '>' or '&' is copied at once
+    size_t runEnd = i + 1 + findTextDelimiter(data + i + 1, size - i - 1);
+    if (trackBlocks) {
+      blockHash_ = extendHash(blockHash_, data + i + 1, runEnd - i - 1);
+    }
+    if (!s.inScript && !s.inStyle && s.droppedContentTag.empty()) {
+      s.currentText.append(data + i, runEnd - i);
+    }
+    i = runEnd - 1;
   }
 
-  flushSegment();
+  return size;
+}
 
-  return segments;
+MarkupSegmentParser::Options renderingParserOptions() {
+  MarkupSegmentParser::Options options;
+  options.normalizeWhitespace = true;
+  options.sanitize = true;
+  options.limits = parseLimits();
+  return options;
+}
+
+std::vector<FabricRichTextSegment> parseMarkupToSegments(const std::string& markup) {
+  std::string repairBuffer;
+  // Large documents are split across threads at top-level blocks
+  auto parser = parseMarkupParallel(ensureValidUtf8(markup, repairBuffer), MarkupSegmentParser::Options{});
+  parser.finish();
+  return parser.takeSegments();
 }
 
 } // namespace facebook::react::parsing
@@ -8,11 +8,16 @@
 #pragma once
 
 #include "DirectionContext.h"
+#include "ParseLimits.h"
 #include "TextNormalizer.h"
 
 #include <react/renderer/attributedstring/AttributedString.h>
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace facebook::react::parsing {
@@ -29,6 +34,8 @@ struct FabricRichTextSegment {
   bool followsInlineElement;  // True if this segment follows </strong>, </em>, etc.
   std::string parentTag;      // The innermost formatting tag (e.g., "strong", "em")
   std::string linkUrl;        // The href URL if this segment is inside an <a> tag
+  uint8_t headingLevel = 0;   // N inside <hN>, 0 outside headings
+  bool hasListMarker = false; // Text includes the marker of a list item ("• ", "1. ")
 
   // RTL Support fields
   WritingDirection writingDirection = WritingDirection::Natural;
@@ -36,6 +43,330 @@ struct FabricRichTextSegment {
   bool isBdoOverride = false;   // Content wrapped in <bdo> tag
 };
 
+/**
+ * An open element, with the style of text directly inside it folded in
+ * from its ancestors, so opening or closing an element does not re-walk
+ * the stack.
+ */
+struct OpenElement {
+  std::string tag;
+  float scale = 1.0f;
+  bool bold = false;
+  bool italic = false;
+  bool underline = false;      // Inside <u>; links are underlined while linkDepth > 0
+  bool strikethrough = false;
+  bool insideAnchor = false;   // Inside <a>, with or without href
+  uint8_t headingLevel = 0;    // N of the innermost <hN>, 0 outside headings
+  std::string parentTag;       // Innermost inline formatting tag
+
+  bool operator==(const OpenElement& other) const = default;
+};
+
+/**
+ * Resumable state of the segment parser.
+ *
+ * Holds everything needed to continue parsing from an arbitrary byte offset:
+ * the open tag/list/link stacks, direction context, the partially collected
+ * text run and the partially read tag. Copying it produces a checkpoint.
+ */
+struct SegmentParserState {
+  // Style of the text run being collected
+  std::string currentText;
+  bool currentHasListMarker = false;  // currentText includes a list item marker
+  float currentScale = 1.0f;
+  bool currentBold = false;
+  bool currentItalic = false;
+  bool currentUnderline = false;
+  bool currentStrikethrough = false;
+  bool currentLink = false;
+  uint8_t currentHeadingLevel = 0;
+  std::string currentParentTag;
+  std::string currentLinkUrl;  // Track the href URL of the current link
+  bool nextFollowsInline = false;
+
+  // Open element stacks
+  std::vector<OpenElement> tagStack;
+  std::vector<FabricRichListContext> listStack;
+  std::vector<std::string> linkUrlStack;  // Stack of link URLs for nested <a> tags
+  int linkDepth = 0;  // Track nested depth inside <a href="..."> tags
+
+  // RTL Support: Direction context for tracking writing direction
+  DirectionContext dirContext;
+
+  // Tokenizer state
+  bool inTag = false;
+  bool inScript = false;
+  bool inStyle = false;
+  std::string tagName;  // Partial tag read so far (without '<')
+  std::string droppedContentTag;  // Sanitizing: element whose content is skipped
+
+  // Inter-tag whitespace normalization (see normalizeInterTagWhitespace)
+  bool beforeFirstTag = true;
+  bool afterBlockClose = false;
+  bool lastClosedIsBlock = false;
+
+  // Bounded work (see ParseLimits)
+  size_t flattenedDepth = 0;   // Elements opened past maxNestingDepth and not closed yet
+  bool plainText = false;      // A limit was hit; the rest is read as plain text
+  ParseLimitsHit limitsHit = 0;
+
+  bool operator==(const SegmentParserState& other) const = default;
+};
+
+/**
+ * End of a block in the parsed input: a closing </p>, </div>, </h1>-</h6>,
+ * or the </ul>/</ol> closing the outermost list.
+ *
+ * All segments before a boundary are complete, so parsing can restart from
+ * any boundary whose preceding input is unchanged.
+ */
+struct BlockBoundary {
+  size_t sourceEnd = 0;     // Input offset just past the closing tag
+  size_t inputHorizon = 0;  // Furthest input offset read so far, including dir="auto" lookahead
+  size_t segmentEnd = 0;    // Number of segments emitted before the boundary
+  size_t tagEnd = 0;        // Number of tags read before the boundary
+  uint64_t sourceHash = 0;  // hashMarkup() of the input since the previous boundary
+  SegmentParserState state; // Parser state right after the closing tag
+};
+
+/**
+ * Hash of a span of markup, as stored in BlockBoundary::sourceHash.
+ */
+uint64_t hashMarkup(std::string_view markup);
+
+/**
+ * Resumable, chunk-fed markup parser producing styled text segments.
+ *
+ * With Options::sanitize, the tokenizer is also the sanitizer: tags outside
+ * the allowlist are skipped (keeping their text), the content of script,
+ * style and similar elements and of comments is dropped, and only allowed
+ * attributes and values are read. No sanitized copy of the input is built.
+ *
+ * Character references in text and in href values are decoded as they are
+ * read (see HtmlEntities.h); text between references and tags is copied a
+ * run at a time.
+ *
+ * Input must be valid UTF-8 (see ensureValidUtf8 in Utf8Validator.h).
+ * It may be supplied in arbitrary chunks; the output is identical to
+ * parsing the concatenated input in one call. Completed segments are final
+ * as soon as they are emitted, and the remaining state can be captured with
+ * checkpoint() and resumed later with restore().
+ *
+ * Elements whose direction is resolved from their content (dir="auto",
+ * <bdi>) need to see up to their closing tag. When that is not yet
+ * available the parser stops before the tag and keeps the unconsumed bytes
+ * buffered until more input arrives or finish() is called. The same applies
+ * to a character reference that may continue past the end of the input.
+ */
+class MarkupSegmentParser {
+ public:
+  struct Options {
+    // Apply normalizeInterTagWhitespace() inline instead of as a separate pass
+    bool normalizeWhitespace = false;
+    // Record a BlockBoundary at the end of every block (see blocks())
+    bool trackBlocks = false;
+    // Filter tags, attributes and URL schemes against the allowlist from
+    // src/core/constants.ts while tokenizing (see MarkupSanitizer.h)
+    bool sanitize = false;
+    // Work allowed per document; past a limit the rest degrades (see ParseLimits.h)
+    ParseLimits limits;
+  };
+
+  /**
+   * Snapshot of the parser taken between feeds.
+   */
+  struct Checkpoint {
+    SegmentParserState state;
+    std::string pending;        // Buffered bytes not yet consumed
+    size_t segmentCount = 0;    // Segments emitted before the checkpoint
+    size_t bytesFed = 0;        // Total input bytes fed before the checkpoint
+    size_t blockCount = 0;      // Block boundaries recorded before the checkpoint
+    size_t tagCount = 0;        // Tags read before the checkpoint
+    uint64_t blockHash = 0;     // Hash of the input since the last boundary
+    size_t inputHorizon = 0;
+  };
+
+  MarkupSegmentParser();
+  explicit MarkupSegmentParser(Options options);
+
+  /**
+   * Parser that resumes from `state` at input offset `inputOffset`, for
+   * parsing a document from the middle. Offsets in blocks() are relative to
+   * the start of the document.
+   */
+  MarkupSegmentParser(Options options, SegmentParserState state, size_t inputOffset);
+
+  /**
+   * State right after a closing </p> with no open elements, i.e. at a
+   * top-level block boundary of well-formed markup.
+   */
+  static SegmentParserState topLevelBlockState(Options options);
+
+  /**
+   * Feed the next chunk of input. Chunks may split tags and text anywhere.
+   */
+  void feed(std::string_view chunk);
+
+  /**
+   * Signal end of input and flush the trailing segment.
+   * No further input may be fed afterwards (until restore()).
+   */
+  void finish();
+
+  /**
+   * Segments emitted so far. Before finish() these are final; the
+   * run still being collected is not included.
+   */
+  const std::vector<FabricRichTextSegment>& segments() const { return segments_; }
+
+  /**
+   * Move the emitted segments out of the parser.
+   */
+  std::vector<FabricRichTextSegment> takeSegments() { return std::move(segments_); }
+
+  /**
+   * Segments that finish() would append to segments() given the input fed
+   * so far, computed on a copy of the state. The parser is not modified.
+   * @param limitsHit Set to the limits hit by the input fed and the preview
+   * @param pendingInput Input fed to the copy only, before it finishes
+   */
+  std::vector<FabricRichTextSegment> previewFinish(
+      ParseLimitsHit* limitsHit = nullptr,
+      std::string_view pendingInput = {}) const;
+
+  /**
+   * Capture the current state so parsing can later resume from here.
+   */
+  Checkpoint checkpoint() const;
+
+  /**
+   * Resume from a checkpoint taken on this parser. Segments emitted after
+   * the checkpoint are discarded.
+   */
+  void restore(const Checkpoint& checkpoint);
+
+  /**
+   * Start over with a new document, keeping allocated capacity.
+   */
+  void reset();
+
+  /**
+   * Total number of input bytes fed so far (consumed or buffered).
+   */
+  size_t bytesFed() const { return bytesFed_; }
+
+  /**
+   * Number of tags read so far.
+   */
+  size_t tagCount() const { return tagCount_; }
+
+  /**
+   * Limits hit so far (see ParseLimits).
+   */
+  ParseLimitsHit limitsHit() const { return state_.limitsHit; }
+
+  /**
+   * Whether finish() has been called.
+   */
+  bool isFinished() const { return finished_; }
+
+  /**
+   * Block boundaries recorded so far, in input order.
+   * Empty unless Options::trackBlocks is set.
+   */
+  const std::vector<BlockBoundary>& blocks() const { return blocks_; }
+
+  /**
+   * New parser positioned right after blocks()[blockIndex], holding the
+   * segments and boundaries up to that point. Feeding it the input that
+   * follows the boundary continues the parse from there.
+   */
+  MarkupSegmentParser prefixThroughBlock(size_t blockIndex) const;
+
+  /**
+   * Whether all input fed so far is consumed and ends exactly at a
+   * recorded block boundary.
+   */
+  bool atBlockBoundary() const;
+
+  /**
+   * Whether this parser, at a block boundary, is in the same state as
+   * previous was at previous.blocks()[blockIndex]. If the input following
+   * both points is identical, so is everything parsed from it.
+   */
+  bool matchesBlock(const MarkupSegmentParser& previous, size_t blockIndex) const;
+
+  /**
+   * Append everything previous parsed after previous.blocks()[blockIndex]
+   * (segments, boundaries and the remaining state), as if the same input
+   * had been fed to this parser. Requires matchesBlock(previous, blockIndex)
+   * and that the input following both points is identical.
+   */
+  void spliceTail(MarkupSegmentParser&& previous, size_t blockIndex);
+
+  /**
+   * Current parser state.
+   */
+  const SegmentParserState& state() const { return state_; }
+
+  /**
+   * Whether all input fed so far is consumed and the parser is in
+   * `startState`, so a parser started from `startState` on the following
+   * input can be appended with append().
+   */
+  bool canContinueWith(const SegmentParserState& startState) const;
+
+  /**
+   * Whether appending `continuation` keeps the document within the limits
+   * it would have hit had its input been fed to this parser, so append()
+   * gives the same result.
+   */
+  bool appendStaysWithinLimits(const MarkupSegmentParser& continuation) const;
+
+  /**
+   * Append the results of `continuation`, a parser started from this
+   * parser's current state at offset bytesFed() and fed the input that
+   * follows, as if that input had been fed to this parser.
+   */
+  void append(MarkupSegmentParser&& continuation);
+
+ private:
+  size_t process(const char* data, size_t size, bool atEnd);
+  void flushSegment(bool closingInlineElement = false);
+  void pushElement(const std::string& tag);
+  void updateStyleFromStack();
+  void recordBlockBoundary(size_t sourceEnd);
+  void startClock();
+  bool pastDeadline();
+  void enterPlainText(ParseLimit limit);
+
+  Options options_;
+  SegmentParserState state_;
+  std::string pending_;
+  std::vector<FabricRichTextSegment> segments_;
+  size_t bytesFed_ = 0;
+  size_t tagCount_ = 0;
+  // Fragments emitted before this parser's first, counted towards maxFragments
+  size_t segmentOffset_ = 0;
+  bool finished_ = false;
+
+  // Time limit of the current feed() or finish() call
+  std::chrono::steady_clock::time_point deadline_;
+  bool hasDeadline_ = false;
+  uint32_t tagsSinceClockCheck_ = 0;
+
+  // Block tracking (Options::trackBlocks)
+  std::vector<BlockBoundary> blocks_;
+  uint64_t blockHash_ = 14695981039346656037ULL;  // hashMarkup("")
+  size_t inputHorizon_ = 0;
+};
+
+/**
+ * Parser options for rendered results: whitespace normalized inline,
+ * markup sanitized while tokenizing and work bounded by parseLimits().
+ */
+MarkupSegmentParser::Options renderingParserOptions();
+
 /**
  * Get heading scale factor for h1-h6 tags.
  */
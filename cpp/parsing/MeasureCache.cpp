@@ -0,0 +1,96 @@
+/**
+ * MeasureCache.cpp
+ *
+ * LRU measurement cache implementation.
+ */
+
+#include "MeasureCache.h"
+
+#include <cstring>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+} // namespace
+
+size_t MeasureCache::KeyHash::operator()(const MeasureKey& key) const {
+  uint32_t width;
+  uint32_t scale;
+  std::memcpy(&width, &key.width, sizeof(width));
+  std::memcpy(&scale, &key.pointScaleFactor, sizeof(scale));
+  uint64_t hash = key.content;
+  hash = (hash ^ width) * kFnvPrime;
+  hash = (hash ^ scale) * kFnvPrime;
+  hash = (hash ^ static_cast<uint32_t>(key.numberOfLines)) * kFnvPrime;
+  hash = (hash ^ static_cast<uint8_t>(key.source)) * kFnvPrime;
+  return static_cast<size_t>(hash);
+}
+
+MeasureCache::MeasureCache(size_t maxEntries) : maxEntries_(maxEntries) {}
+
+MeasureCache& MeasureCache::shared() {
+  static MeasureCache cache;
+  return cache;
+}
+
+std::optional<MeasuredText> MeasureCache::find(const MeasureKey& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    misses_++;
+    return std::nullopt;
+  }
+  hits_++;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->second;
+}
+
+void MeasureCache::insert(const MeasureKey& key, const MeasuredText& measured) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    it->second->second = measured;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return;
+  }
+  entries_.emplace_front(key, measured);
+  index_.emplace(key, entries_.begin());
+  while (entries_.size() > maxEntries_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+}
+
+void MeasureCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+}
+
+size_t MeasureCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+size_t MeasureCache::bytes() const {
+  // A list node and a hash map node per entry, each with two pointers
+  constexpr size_t kEntryBytes = sizeof(EntryList::value_type) + sizeof(MeasureKey) +
+      sizeof(EntryList::iterator) + 4 * sizeof(void*);
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size() * kEntryBytes;
+}
+
+size_t MeasureCache::hits() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hits_;
+}
+
+size_t MeasureCache::misses() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return misses_;
+}
+
+} // namespace facebook::react::parsing
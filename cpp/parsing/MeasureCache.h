@@ -0,0 +1,98 @@
+/**
+ * MeasureCache.h
+ *
+ * LRU cache of measured text sizes keyed by content, width and line limit.
+ * Filled by batch measurement of list rows ahead of mounting, so repeated
+ * batches (and, for platform measurements, shadow nodes) skip text layout.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace facebook::react::parsing {
+
+// Default capacity of MeasureCache::shared(), in entries
+constexpr size_t kDefaultMeasureCacheEntries = 2048;
+
+/**
+ * Where a measurement came from. Only Platform measurements match what
+ * measureContent() computes, so estimates are never served to shadow nodes.
+ */
+enum class MeasureSource : uint8_t {
+  Platform = 0,  // The platform TextLayoutManager
+  Estimate = 1,  // HeightEstimator
+};
+
+/**
+ * Size of laid out text.
+ */
+struct MeasuredText {
+  float width = 0;
+  float height = 0;
+  // Lines of the text, ignoring numberOfLines (of the parsed prefix for
+  // numberOfLines previews, see ContentBudget)
+  size_t lineCount = 0;
+
+  bool operator==(const MeasuredText& other) const = default;
+};
+
+/**
+ * What a measurement depends on besides the measurer. content is
+ * hashMarkupAndStyle() of the markup and style; entries are matched on the
+ * hash alone.
+ */
+struct MeasureKey {
+  uint64_t content = 0;
+  float width = 0;
+  float pointScaleFactor = 1;
+  int32_t numberOfLines = 0;
+  MeasureSource source = MeasureSource::Platform;
+
+  bool operator==(const MeasureKey& other) const = default;
+};
+
+/**
+ * Thread-safe LRU cache of MeasuredText, bounded by entry count.
+ */
+class MeasureCache {
+ public:
+  explicit MeasureCache(size_t maxEntries = kDefaultMeasureCacheEntries);
+
+  /**
+   * Process-wide cache shared by batch measurement and shadow nodes.
+   */
+  static MeasureCache& shared();
+
+  std::optional<MeasuredText> find(const MeasureKey& key);
+
+  void insert(const MeasureKey& key, const MeasuredText& measured);
+
+  void clear();
+
+  size_t size() const;
+  // Approximate heap bytes held by the entries
+  size_t bytes() const;
+  size_t hits() const;
+  size_t misses() const;
+
+ private:
+  struct KeyHash {
+    size_t operator()(const MeasureKey& key) const;
+  };
+  using EntryList = std::list<std::pair<MeasureKey, MeasuredText>>;
+
+  mutable std::mutex mutex_;
+  size_t maxEntries_;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+  EntryList entries_;  // Most recently used first
+  std::unordered_map<MeasureKey, EntryList::iterator, KeyHash> index_;
+};
+
+} // namespace facebook::react::parsing
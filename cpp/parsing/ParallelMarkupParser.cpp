@@ -0,0 +1,144 @@
+/**
+ * ParallelMarkupParser.cpp
+ *
+ * Block-parallel parsing implementation.
+ */
+
+#include "ParallelMarkupParser.h"
+#include "PipelinePhase.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <optional>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+std::atomic<size_t> gParallelParseThreshold{kDefaultParallelParseThreshold};
+
+bool isSplittableBlockTag(std::string_view name) {
+  if (name.size() == 1) {
+    return name[0] == 'p';
+  }
+  if (name.size() == 2) {
+    return (name[0] == 'h' && name[1] >= '1' && name[1] <= '6') ||
+           name == "ul" || name == "ol";
+  }
+  return name == "div";
+}
+
+} // namespace
+
+size_t parallelParseThreshold() {
+  return gParallelParseThreshold.load(std::memory_order_relaxed);
+}
+
+void setParallelParseThreshold(size_t bytes) {
+  gParallelParseThreshold.store(bytes, std::memory_order_relaxed);
+}
+
+std::vector<size_t> findTopLevelBlockBoundaries(
+    std::string_view markup,
+    size_t maxChunks,
+    size_t minChunkBytes) {
+  std::vector<size_t> boundaries;
+  if (maxChunks < 2 || markup.empty()) {
+    return boundaries;
+  }
+  size_t chunkSize = std::max<size_t>(markup.size() / maxChunks, std::max<size_t>(minChunkBytes, 1));
+  size_t nextTarget = chunkSize;
+  int depth = 0;
+
+  const char* data = markup.data();
+  const size_t size = markup.size();
+  size_t pos = 0;
+  char name[8];
+  while (pos < size && nextTarget < size) {
+    const void* found = std::memchr(data + pos, '<', size - pos);
+    if (found == nullptr) {
+      break;
+    }
+    size_t tagStart = static_cast<const char*>(found) - data;
+    size_t i = tagStart + 1;
+    bool closing = i < size && data[i] == '/';
+    if (closing) {
+      i++;
+    }
+    size_t length = 0;
+    while (i < size && std::isalnum(static_cast<unsigned char>(data[i])) && length < sizeof(name)) {
+      name[length++] = static_cast<char>(std::tolower(static_cast<unsigned char>(data[i])));
+      i++;
+    }
+    const void* tagEnd = std::memchr(data + i, '>', size - i);
+    if (tagEnd == nullptr) {
+      break;
+    }
+    pos = static_cast<const char*>(tagEnd) - data + 1;
+
+    if (!isSplittableBlockTag(std::string_view(name, length))) {
+      continue;
+    }
+    if (!closing) {
+      depth++;
+      continue;
+    }
+    depth = std::max(depth - 1, 0);
+    if (depth == 0 && pos >= nextTarget && pos < size) {
+      boundaries.push_back(pos);
+      nextTarget = pos + chunkSize;
+      if (boundaries.size() + 1 >= maxChunks) {
+        break;
+      }
+    }
+  }
+  return boundaries;
+}
+
+MarkupSegmentParser parseMarkupParallel(
+    std::string_view markup,
+    MarkupSegmentParser::Options options,
+    const ParallelParseOptions& parallel) {
+  PipelinePhaseScope phase(PipelinePhase::Tokenize);
+  ParseThreadPool& pool = parallel.pool != nullptr ? *parallel.pool : ParseThreadPool::shared();
+  size_t threshold = parallel.minParallelBytes != 0 ? parallel.minParallelBytes : parallelParseThreshold();
+  size_t maxChunks = parallel.maxChunks != 0 ? parallel.maxChunks : pool.workerCount() + 1;
+
+  std::vector<size_t> splits;
+  if (markup.size() >= threshold && pool.workerCount() > 0) {
+    splits = findTopLevelBlockBoundaries(markup, maxChunks, parallel.minChunkBytes);
+  }
+  if (splits.empty()) {
+    MarkupSegmentParser parser(options);
+    parser.feed(markup);
+    return parser;
+  }
+
+  splits.insert(splits.begin(), 0);
+  splits.push_back(markup.size());
+  const size_t chunkCount = splits.size() - 1;
+  const SegmentParserState startState = MarkupSegmentParser::topLevelBlockState(options);
+
+  std::vector<std::optional<MarkupSegmentParser>> chunks(chunkCount);
+  pool.parallelFor(chunkCount, [&](size_t k) {
+    size_t begin = splits[k];
+    auto& parser = k == 0 ? chunks[k].emplace(options) : chunks[k].emplace(options, startState, begin);
+    parser.feed(markup.substr(begin, splits[k + 1] - begin));
+  });
+
+  MarkupSegmentParser result = std::move(*chunks[0]);
+  for (size_t k = 1; k < chunkCount; ++k) {
+    if (result.canContinueWith(startState) && result.appendStaysWithinLimits(*chunks[k])) {
+      result.append(std::move(*chunks[k]));
+    } else {
+      // Speculation failed, or the chunk would cross a parse limit: continue
+      // from the real state
+      result.feed(markup.substr(splits[k], splits[k + 1] - splits[k]));
+    }
+  }
+  return result;
+}
+
+} // namespace facebook::react::parsing
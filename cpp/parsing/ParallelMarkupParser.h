@@ -0,0 +1,79 @@
+/**
+ * ParallelMarkupParser.h
+ *
+ * Block-parallel parsing for large documents.
+ * Splits markup at top-level block boundaries, parses the pieces
+ * concurrently and stitches the results back together.
+ */
+
+#pragma once
+
+#include "MarkupSegmentParser.h"
+#include "ParseThreadPool.h"
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace facebook::react::parsing {
+
+/**
+ * Default size below which markup is parsed on the calling thread.
+ */
+constexpr size_t kDefaultParallelParseThreshold = 32 * 1024;
+
+/**
+ * Default minimum size of a piece of markup handed to one thread.
+ */
+constexpr size_t kMinParallelChunkBytes = 8 * 1024;
+
+/**
+ * Size below which parseMarkupParallel() parses on the calling thread when
+ * no explicit threshold is given. Thread-safe.
+ */
+size_t parallelParseThreshold();
+void setParallelParseThreshold(size_t bytes);
+
+struct ParallelParseOptions {
+  // Markup shorter than this is parsed on the calling thread (0 = use parallelParseThreshold())
+  size_t minParallelBytes = 0;
+  // Upper bound on pieces (0 = one per pool participant)
+  size_t maxChunks = 0;
+  // Smallest piece worth handing to a thread
+  size_t minChunkBytes = kMinParallelChunkBytes;
+  // Pool to run on (nullptr = ParseThreadPool::shared())
+  ParseThreadPool* pool = nullptr;
+};
+
+/**
+ * Offsets just past closing tags that end a top-level block, chosen so the
+ * markup splits into at most maxChunks pieces of roughly equal size and at
+ * least minChunkBytes each (except the last).
+ *
+ * This is a fast scan that only tracks the nesting of block and list tags;
+ * offsets are hints and parseMarkupParallel() verifies each of them.
+ */
+std::vector<size_t> findTopLevelBlockBoundaries(
+    std::string_view markup,
+    size_t maxChunks,
+    size_t minChunkBytes = kMinParallelChunkBytes);
+
+/**
+ * Parse markup into a MarkupSegmentParser, as if fed in one call on the
+ * calling thread, using several threads for large markup.
+ *
+ * Each piece after the first is parsed speculatively from
+ * MarkupSegmentParser::topLevelBlockState(). When the previous piece does
+ * not end in that state (an element or list left open across the split,
+ * lookahead that needs input past the split), the piece is re-parsed
+ * sequentially from the actual state, so list counters, open tags and
+ * direction context carry over exactly as in a sequential parse.
+ *
+ * The returned parser is not finished, so more input may still be fed.
+ */
+MarkupSegmentParser parseMarkupParallel(
+    std::string_view markup,
+    MarkupSegmentParser::Options options,
+    const ParallelParseOptions& parallel = {});
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,187 @@
+/**
+ * ParseCache.cpp
+ *
+ * LRU parse result cache implementation.
+ */
+
+#include "ParseCache.h"
+#include "IncrementalParseSession.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+constexpr uint64_t kFnvOffset = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+uint64_t hashBytes(uint64_t hash, const void* data, size_t size) {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * kFnvPrime;
+  }
+  return hash;
+}
+
+uint64_t hashString(uint64_t hash, const std::string& value) {
+  hash = hashBytes(hash, value.data(), value.size());
+  // Separator so adjacent fields cannot run together
+  return (hash ^ 0xFF) * kFnvPrime;
+}
+
+uint64_t hashFloat(uint64_t hash, float value) {
+  // All NaNs compare equal in StyleOptions::operator==
+  if (std::isnan(value)) {
+    value = NAN;
+  }
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return hashBytes(hash, &bits, sizeof(bits));
+}
+
+// Approximate heap footprint of a cached result
+size_t resultBytes(const AttributedStringResult& result) {
+  size_t bytes = sizeof(AttributedStringResult) +
+      result.accessibilityPauses.size() * sizeof(uint32_t);
+  for (const auto& fragment : result.attributedString.getFragments()) {
+    bytes += sizeof(AttributedString::Fragment) + fragment.string.size();
+  }
+  if (result.snapshot != nullptr) {
+    bytes += result.snapshot->bytes;
+  }
+  return bytes + result.links.heapBytes();
+}
+
+} // namespace
+
+uint64_t hashStyleOptions(const StyleOptions& options) {
+  uint64_t hash = kFnvOffset;
+  hash = hashFloat(hash, options.baseFontSize);
+  hash = hashFloat(hash, options.fontSizeMultiplier);
+  hash = hashBytes(hash, &options.allowFontScaling, sizeof(options.allowFontScaling));
+  hash = hashFloat(hash, options.maxFontSizeMultiplier);
+  hash = hashFloat(hash, options.lineHeight);
+  hash = hashString(hash, options.fontWeight);
+  hash = hashString(hash, options.fontFamily);
+  hash = hashString(hash, options.fontStyle);
+  hash = hashFloat(hash, options.letterSpacing);
+  hash = hashBytes(hash, &options.color, sizeof(options.color));
+  hash = hashString(hash, options.tagStyles);
+  return hash;
+}
+
+uint64_t hashMarkupAndStyle(std::string_view markup, const StyleOptions& options) {
+  return hashBytes(hashStyleOptions(options), markup.data(), markup.size());
+}
+
+ParseCache::ParseCache(size_t maxBytes) : maxBytes_(maxBytes) {}
+
+ParseCache& ParseCache::shared() {
+  static ParseCache cache;
+  return cache;
+}
+
+uint64_t ParseCache::keyHash(std::string_view markup, const StyleOptions& options) {
+  return hashMarkupAndStyle(markup, options);
+}
+
+ParseCache::EntryList::iterator ParseCache::findLocked(
+    uint64_t hash,
+    std::string_view markup,
+    const StyleOptions& options) {
+  auto range = index_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    const Entry& entry = *it->second;
+    if (entry.markup == markup && entry.options == options) {
+      return it->second;
+    }
+  }
+  return entries_.end();
+}
+
+std::shared_ptr<const AttributedStringResult> ParseCache::find(
+    std::string_view markup,
+    const StyleOptions& options) {
+  uint64_t hash = keyHash(markup, options);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto entry = findLocked(hash, markup, options);
+  if (entry == entries_.end()) {
+    misses_++;
+    return nullptr;
+  }
+  hits_++;
+  entries_.splice(entries_.begin(), entries_, entry);
+  return entry->result;
+}
+
+void ParseCache::insert(
+    std::string markup,
+    const StyleOptions& options,
+    std::shared_ptr<const AttributedStringResult> result) {
+  // Results cut short by the time limit depend on the device's load
+  if (!result || hitLimit(result->limitsHit, ParseLimit::Time)) {
+    return;
+  }
+  size_t bytes = sizeof(Entry) + markup.size() + options.tagStyles.size() + resultBytes(*result);
+  if (bytes > maxBytes_ / 8) {
+    return;
+  }
+  uint64_t hash = keyHash(markup, options);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto existing = findLocked(hash, markup, options);
+  if (existing != entries_.end()) {
+    entries_.splice(entries_.begin(), entries_, existing);
+    return;
+  }
+  entries_.push_front(Entry{hash, std::move(markup), options, std::move(result), bytes});
+  index_.emplace(hash, entries_.begin());
+  bytes_ += bytes;
+  evictLocked();
+}
+
+void ParseCache::evictLocked() {
+  while (bytes_ > maxBytes_ && !entries_.empty()) {
+    auto last = std::prev(entries_.end());
+    auto range = index_.equal_range(last->hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == last) {
+        index_.erase(it);
+        break;
+      }
+    }
+    bytes_ -= last->bytes;
+    entries_.erase(last);
+  }
+}
+
+void ParseCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  bytes_ = 0;
+}
+
+size_t ParseCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+size_t ParseCache::bytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_;
+}
+
+size_t ParseCache::hits() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hits_;
+}
+
+size_t ParseCache::misses() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return misses_;
+}
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,99 @@
+/**
+ * ParseCache.h
+ *
+ * Size-bounded LRU cache of parse results keyed by markup and style.
+ * Lets components that mount with markup parsed ahead of time (list rows
+ * prefetched with parseBatch, recycled rows) skip parsing entirely.
+ */
+
+#pragma once
+
+#include "AttributedStringBuilder.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace facebook::react::parsing {
+
+// Default memory budget of ParseCache::shared()
+constexpr size_t kDefaultParseCacheBytes = 4 * 1024 * 1024;
+
+/**
+ * Hash of every field of StyleOptions, consistent with its operator==.
+ */
+uint64_t hashStyleOptions(const StyleOptions& options);
+
+/**
+ * Hash of markup parsed with options, as ParseCache keys its entries.
+ */
+uint64_t hashMarkupAndStyle(std::string_view markup, const StyleOptions& options);
+
+/**
+ * Thread-safe LRU cache of AttributedStringResult keyed by (markup, options).
+ *
+ * Entries are charged by the size of their markup and result. When the
+ * budget is exceeded, least recently used entries are evicted. Results
+ * larger than an eighth of the budget are not cached.
+ */
+class ParseCache {
+ public:
+  explicit ParseCache(size_t maxBytes = kDefaultParseCacheBytes);
+
+  /**
+   * Process-wide cache shared by all components.
+   */
+  static ParseCache& shared();
+
+  /**
+   * Cached result for markup parsed with options, or nullptr.
+   */
+  std::shared_ptr<const AttributedStringResult> find(
+      std::string_view markup,
+      const StyleOptions& options);
+
+  /**
+   * Store the result of parsing markup with options. Results that hit
+   * ParseLimits::maxParseTime are not stored.
+   */
+  void insert(
+      std::string markup,
+      const StyleOptions& options,
+      std::shared_ptr<const AttributedStringResult> result);
+
+  void clear();
+
+  size_t size() const;
+  size_t bytes() const;
+  size_t hits() const;
+  size_t misses() const;
+
+ private:
+  struct Entry {
+    uint64_t hash;
+    std::string markup;
+    StyleOptions options;
+    std::shared_ptr<const AttributedStringResult> result;
+    size_t bytes;
+  };
+  using EntryList = std::list<Entry>;
+
+  static uint64_t keyHash(std::string_view markup, const StyleOptions& options);
+  EntryList::iterator findLocked(uint64_t hash, std::string_view markup, const StyleOptions& options);
+  void evictLocked();
+
+  mutable std::mutex mutex_;
+  size_t maxBytes_;
+  size_t bytes_ = 0;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+  EntryList entries_;  // Most recently used first
+  std::unordered_multimap<uint64_t, EntryList::iterator> index_;
+};
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,52 @@
+/**
+ * ParseLimits.cpp
+ *
+ * Process-wide parse limits.
+ */
+
+#include "ParseLimits.h"
+
+#include <limits>
+#include <mutex>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+std::mutex gLimitsMutex;
+ParseLimits gLimits;
+
+} // namespace
+
+const char* parseLimitName(ParseLimit limit) {
+  switch (limit) {
+    case ParseLimit::InputBytes:
+      return "input-bytes";
+    case ParseLimit::Tags:
+      return "tags";
+    case ParseLimit::NestingDepth:
+      return "nesting-depth";
+    case ParseLimit::Fragments:
+      return "fragments";
+    case ParseLimit::Time:
+      return "time";
+  }
+  return "unknown";
+}
+
+ParseLimits ParseLimits::unlimited() {
+  constexpr size_t kNoLimit = std::numeric_limits<size_t>::max();
+  return ParseLimits{kNoLimit, kNoLimit, kNoLimit, kNoLimit, std::chrono::microseconds(0)};
+}
+
+ParseLimits parseLimits() {
+  std::lock_guard<std::mutex> lock(gLimitsMutex);
+  return gLimits;
+}
+
+void setParseLimits(const ParseLimits& limits) {
+  std::lock_guard<std::mutex> lock(gLimitsMutex);
+  gLimits = limits;
+}
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,75 @@
+/**
+ * ParseLimits.h
+ *
+ * Bounds on the work one document may cost the segment parser, so huge or
+ * hostile markup degrades predictably instead of holding the layout thread.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace facebook::react::parsing {
+
+/**
+ * A limit the parser can hit, as a bit of ParseLimitsHit.
+ */
+enum class ParseLimit : uint8_t {
+  InputBytes = 1 << 0,    // Input past maxInputBytes was dropped
+  Tags = 1 << 1,          // Markup past maxTags was read as plain text
+  NestingDepth = 1 << 2,  // Elements past maxNestingDepth were flattened
+  Fragments = 1 << 3,     // Markup past maxFragments was read as plain text
+  Time = 1 << 4,          // Markup past maxParseTime was read as plain text
+};
+
+/**
+ * Set of ParseLimit bits; 0 when the document was parsed in full.
+ */
+using ParseLimitsHit = uint8_t;
+
+inline bool hitLimit(ParseLimitsHit hits, ParseLimit limit) {
+  return (hits & static_cast<ParseLimitsHit>(limit)) != 0;
+}
+
+/**
+ * Name of a limit for logs ("input-bytes", "tags", ...).
+ */
+const char* parseLimitName(ParseLimit limit);
+
+/**
+ * How a document degrades past each limit:
+ * - Elements (and lists) opened deeper than maxNestingDepth are flattened:
+ *   their text keeps the style of the deepest element kept, and their
+ *   closing tags close them.
+ * - Past maxTags or maxFragments, or once maxParseTime has passed, open
+ *   elements are closed and the rest of the document is read as plain text
+ *   with a line break per block, like stripMarkupTags(). Sanitizing and
+ *   character references still apply.
+ * - Input past maxInputBytes is dropped at a code point boundary.
+ *
+ * Limits apply to the whole document except maxParseTime, which bounds
+ * each MarkupSegmentParser::feed() and finish() call. Results that hit it
+ * depend on timing, so they are not cached.
+ */
+struct ParseLimits {
+  size_t maxInputBytes = 8 * 1024 * 1024;
+  size_t maxTags = 500000;
+  size_t maxNestingDepth = 100;
+  size_t maxFragments = 100000;
+  std::chrono::microseconds maxParseTime{0};  // 0 = no time limit
+
+  static ParseLimits unlimited();
+
+  bool operator==(const ParseLimits& other) const = default;
+};
+
+/**
+ * Limits of rendering parses (renderingParserOptions()). Thread-safe; set
+ * them before the first parse, since cached results are not re-parsed.
+ */
+ParseLimits parseLimits();
+void setParseLimits(const ParseLimits& limits);
+
+} // namespace facebook::react::parsing
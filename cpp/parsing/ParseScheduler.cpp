@@ -0,0 +1,351 @@
+/**
+ * ParseScheduler.cpp
+ *
+ * Priority-aware background parse scheduler implementation.
+ */
+
+#include "ParseScheduler.h"
+#include "IncrementalParseSession.h"
+#include "MeasureCache.h"
+
+#include <algorithm>
+
+namespace facebook::react::parsing {
+
+ParseGenerationToken ParseGenerationToken::create() {
+  ParseGenerationToken token;
+  token.counter_ = std::make_shared<std::atomic<uint64_t>>(0);
+  return token;
+}
+
+uint64_t ParseGenerationToken::generation() const {
+  return counter_ ? counter_->load() : 0;
+}
+
+void ParseGenerationToken::invalidate() const {
+  if (counter_) {
+    counter_->fetch_add(1);
+  }
+}
+
+bool ParseGenerationToken::isCurrent(uint64_t generation) const {
+  return !counter_ || counter_->load() == generation;
+}
+
+ParseScheduler::ParseScheduler(size_t threadCount)
+    : threadCount_(std::max<size_t>(threadCount, 1)), queues_(threadCount_) {
+  // Workers fill the shared caches until the destructor joins them. Statics
+  // are destroyed in reverse order of construction, so constructing the
+  // caches first keeps them alive until then.
+  ParseCache::shared();
+  MeasureCache::shared();
+}
+
+ParseScheduler::~ParseScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    stopping_ = true;
+  }
+  wakeWorkers_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+ParseScheduler& ParseScheduler::shared() {
+  static ParseScheduler scheduler([] {
+    unsigned cores = std::thread::hardware_concurrency();
+    return cores > 2 ? size_t{2} : size_t{1};
+  }());
+  return scheduler;
+}
+
+uint64_t ParseScheduler::contentKey(const std::string& markup, const StyleOptions& options) {
+  // Same content hash as the parse cache, combined with the markup hash
+  return hashStyleOptions(options) ^ (hashMarkup(markup) * 31);
+}
+
+bool ParseScheduler::isCancelledLocked(const Job& job) {
+  // A job shared by several owners runs while any of them still wants it
+  return std::none_of(job.owners.begin(), job.owners.end(), [](const Owner& owner) {
+    return !owner.counter || owner.counter->load() == owner.generation;
+  });
+}
+
+void ParseScheduler::addOwnerLocked(Job& job, Owner owner) {
+  // Owners that moved on no longer keep the job alive; dropping them keeps
+  // a job rescheduled on every commit from growing its list
+  auto& owners = job.owners;
+  owners.erase(
+      std::remove_if(owners.begin(), owners.end(), [](const Owner& existing) {
+        return existing.counter && existing.counter->load() != existing.generation;
+      }),
+      owners.end());
+  bool known = std::any_of(owners.begin(), owners.end(), [&](const Owner& existing) {
+    return existing.counter == owner.counter && existing.generation == owner.generation;
+  });
+  if (!known) {
+    owners.push_back(std::move(owner));
+  }
+}
+
+ParseScheduler::JobPtr ParseScheduler::findJobLocked(
+    uint64_t key,
+    const std::string& markup,
+    const StyleOptions& options) const {
+  auto range = inFlight_.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second->markup == markup && it->second->options == options) {
+      return it->second;
+    }
+  }
+  return nullptr;
+}
+
+void ParseScheduler::schedule(
+    std::string markup,
+    const StyleOptions& options,
+    ParseLane lane,
+    const ParseGenerationToken& token) {
+  if (markup.empty() || ParseCache::shared().find(markup, options)) {
+    return;
+  }
+  uint64_t key = contentKey(markup, options);
+  Owner owner;
+  if (token.counter_) {
+    owner.counter = token.counter_;
+    owner.generation = token.counter_->load();
+  }
+
+  JobPtr job;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    startWorkersLocked();
+
+    job = findJobLocked(key, markup, options);
+    if (job) {
+      std::lock_guard<std::mutex> jobLock(job->mutex);
+      if (job->status == Job::Status::Done) {
+        // Cancelled and on its way out of inFlight_; start over
+        job = nullptr;
+      } else {
+        addOwnerLocked(*job, std::move(owner));
+        if (job->status != Job::Status::Queued || lane >= job->lane) {
+          return;
+        }
+        // Raise priority: the entry left in the lower lane is skipped later
+        job->lane = lane;
+      }
+    }
+    if (!job) {
+      job = std::make_shared<Job>();
+      job->key = key;
+      job->markup = std::move(markup);
+      job->options = options;
+      job->lane = lane;
+      job->owners.push_back(std::move(owner));
+      job->future = job->promise.get_future().share();
+      inFlight_.emplace(key, job);
+    }
+  }
+  enqueue(std::move(job), lane);
+}
+
+void ParseScheduler::post(std::function<void()> task, ParseLane lane) {
+  auto job = std::make_shared<Job>();
+  job->lane = lane;
+  job->owners.push_back(Owner{});
+  job->task = std::move(task);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    startWorkersLocked();
+  }
+  enqueue(std::move(job), lane);
+}
+
+void ParseScheduler::enqueue(JobPtr job, ParseLane lane) {
+  auto& queues = queues_[nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size()];
+  {
+    std::lock_guard<std::mutex> lock(queues.mutex);
+    queues.lanes[static_cast<size_t>(lane)].push_back(std::move(job));
+  }
+  queuedEntries_.fetch_add(1);
+  {
+    // Pairs with the wait in workerLoop, so the wake-up is not lost
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+  }
+  wakeWorkers_.notify_one();
+}
+
+ParseScheduler::Result ParseScheduler::join(const std::string& markup, const StyleOptions& options) {
+  JobPtr job;
+  bool runHere = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job = findJobLocked(contentKey(markup, options), markup, options);
+    if (!job) {
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> jobLock(job->mutex);
+    if (job->status == Job::Status::Queued) {
+      // The caller needs the result now; don't wait behind the queue
+      job->status = Job::Status::Running;
+      runHere = true;
+    }
+  }
+  if (runHere) {
+    runJob(job);
+  }
+  return job->future.get();
+}
+
+ParseScheduler::Result ParseScheduler::parseNow(const std::string& markup, const StyleOptions& options) {
+  if (markup.empty()) {
+    return std::make_shared<const AttributedStringResult>();
+  }
+  auto& cache = ParseCache::shared();
+  if (auto cached = cache.find(markup, options)) {
+    return cached;
+  }
+  if (auto joined = join(markup, options)) {
+    return joined;
+  }
+  // The job may have finished between the two lookups
+  if (auto cached = cache.find(markup, options)) {
+    return cached;
+  }
+  auto result = std::make_shared<const AttributedStringResult>(
+      IncrementalParseSession::parseWithSnapshot(markup, options));
+  cache.insert(markup, options, result);
+  return result;
+}
+
+size_t ParseScheduler::pendingCount(ParseLane lane) const {
+  size_t count = 0;
+  for (const auto& queues : queues_) {
+    std::lock_guard<std::mutex> lock(queues.mutex);
+    for (const auto& job : queues.lanes[static_cast<size_t>(lane)]) {
+      std::lock_guard<std::mutex> jobLock(job->mutex);
+      if (job->status == Job::Status::Queued && job->lane == lane && !isCancelledLocked(*job)) {
+        count++;
+      }
+    }
+  }
+  return count;
+}
+
+void ParseScheduler::startWorkersLocked() {
+  if (!workers_.empty()) {
+    return;
+  }
+  workers_.reserve(threadCount_);
+  for (size_t i = 0; i < threadCount_; ++i) {
+    workers_.emplace_back([this, i] { workerLoop(i); });
+  }
+}
+
+ParseScheduler::JobPtr ParseScheduler::takeJob(size_t worker) {
+  const size_t workerCount = queues_.size();
+  for (size_t lane = 0; lane < kLaneCount; ++lane) {
+    // Own queue from the front, then steal from the back of the others
+    for (size_t offset = 0; offset < workerCount; ++offset) {
+      auto& queues = queues_[(worker + offset) % workerCount];
+      while (true) {
+        JobPtr job;
+        {
+          std::lock_guard<std::mutex> lock(queues.mutex);
+          auto& queue = queues.lanes[lane];
+          if (queue.empty()) {
+            break;
+          }
+          if (offset == 0) {
+            job = std::move(queue.front());
+            queue.pop_front();
+          } else {
+            job = std::move(queue.back());
+            queue.pop_back();
+          }
+        }
+        queuedEntries_.fetch_sub(1);
+
+        bool cancelled = false;
+        {
+          std::lock_guard<std::mutex> jobLock(job->mutex);
+          // Skip entries for jobs that were joined, moved to a higher lane or cancelled
+          if (job->status != Job::Status::Queued || static_cast<size_t>(job->lane) != lane) {
+            continue;
+          }
+          cancelled = isCancelledLocked(*job);
+          job->status = cancelled ? Job::Status::Done : Job::Status::Running;
+        }
+        if (cancelled) {
+          forgetJob(job);
+          job->promise.set_value(nullptr);
+          continue;
+        }
+        return job;
+      }
+    }
+  }
+  return nullptr;
+}
+
+void ParseScheduler::workerLoop(size_t worker) {
+  while (true) {
+    if (JobPtr job = takeJob(worker)) {
+      runJob(job);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleepMutex_);
+    wakeWorkers_.wait(lock, [&] { return stopping_ || queuedEntries_.load() > 0; });
+    if (stopping_) {
+      return;
+    }
+  }
+}
+
+void ParseScheduler::runJob(const JobPtr& job) {
+  if (job->task) {
+    try {
+      job->task();
+    } catch (...) {
+      // Tasks report their own errors; one that escapes must not stop the worker
+    }
+    std::lock_guard<std::mutex> jobLock(job->mutex);
+    job->status = Job::Status::Done;
+    return;
+  }
+  Result result;
+  try {
+    // Keeps its parse, so the session that picks the result up can resume
+    result = std::make_shared<const AttributedStringResult>(
+        IncrementalParseSession::parseWithSnapshot(job->markup, job->options));
+    ParseCache::shared().insert(job->markup, job->options, result);
+  } catch (...) {
+    // Joiners fall back to parsing themselves
+    result = nullptr;
+  }
+  finishJob(job, std::move(result));
+}
+
+void ParseScheduler::finishJob(const JobPtr& job, Result result) {
+  {
+    std::lock_guard<std::mutex> jobLock(job->mutex);
+    job->status = Job::Status::Done;
+  }
+  forgetJob(job);
+  job->promise.set_value(std::move(result));
+}
+
+void ParseScheduler::forgetJob(const JobPtr& job) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto range = inFlight_.equal_range(job->key);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == job) {
+      inFlight_.erase(it);
+      break;
+    }
+  }
+}
+
+} // namespace facebook::react::parsing
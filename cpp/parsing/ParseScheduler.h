@@ -0,0 +1,197 @@
+/**
+ * ParseScheduler.h
+ *
+ * Shared background parse scheduler with priority lanes, cancellation
+ * through generation tokens and de-duplication of in-flight work.
+ */
+
+#pragma once
+
+#include "AttributedStringBuilder.h"
+#include "ParseCache.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react::parsing {
+
+/**
+ * Scheduling lanes, highest priority first.
+ */
+enum class ParseLane : uint8_t {
+  Visible = 0,   // Content on screen that is about to be measured
+  Prefetch = 1,  // Content near the viewport (upcoming list rows)
+  Idle = 2,      // Warm-up work that can wait for everything else
+};
+
+/**
+ * Cancellation token shared between an owner (a component, a list row)
+ * and the jobs it schedules. Jobs remember the generation they were
+ * scheduled under; invalidate() drops every job scheduled earlier that has
+ * not started yet. Copies share the same counter. A default-constructed
+ * token is never invalidated.
+ */
+class ParseGenerationToken {
+ public:
+  ParseGenerationToken() = default;
+
+  /**
+   * Create a token that can be invalidated.
+   */
+  static ParseGenerationToken create();
+
+  uint64_t generation() const;
+
+  /**
+   * Drop work scheduled under the current generation (content unmounted
+   * or superseded by new content).
+   */
+  void invalidate() const;
+
+  bool isCurrent(uint64_t generation) const;
+
+ private:
+  friend class ParseScheduler;
+
+  std::shared_ptr<std::atomic<uint64_t>> counter_;
+};
+
+/**
+ * Runs parse jobs on a bounded number of worker threads.
+ *
+ * Each worker owns one queue per lane, behind its own lock. A worker takes
+ * the highest-priority job available, first from its own queues and
+ * otherwise by stealing from other workers, so scheduling and stealing
+ * contend only on the queue they touch. Completed results go to
+ * ParseCache::shared().
+ *
+ * Jobs are keyed by content (markup and style): scheduling content that is
+ * already queued or running joins the existing job and raises its lane if
+ * needed. parseNow() joins such a job too, running a still-queued job on the
+ * calling thread rather than waiting behind the queue.
+ */
+class ParseScheduler {
+ public:
+  using Result = std::shared_ptr<const AttributedStringResult>;
+
+  /**
+   * @param threadCount Worker threads, started on the first schedule()
+   */
+  explicit ParseScheduler(size_t threadCount);
+  ~ParseScheduler();
+
+  ParseScheduler(const ParseScheduler&) = delete;
+  ParseScheduler& operator=(const ParseScheduler&) = delete;
+
+  /**
+   * Process-wide scheduler with up to 2 worker threads.
+   */
+  static ParseScheduler& shared();
+
+  /**
+   * Parse markup in the background. The result is stored in the parse
+   * cache, where later parses of the same content pick it up.
+   * Does nothing if the result is already cached.
+   */
+  void schedule(
+      std::string markup,
+      const StyleOptions& options,
+      ParseLane lane,
+      const ParseGenerationToken& token = {});
+
+  /**
+   * Run task on a worker in lane, for background work that is not a
+   * single parse (batches of documents to parse and measure). Tasks are
+   * never cancelled or joined; an exception thrown by one is dropped.
+   */
+  void post(std::function<void()> task, ParseLane lane);
+
+  /**
+   * Result for markup, from the cache, from an in-flight job for the same
+   * content, or parsed on the calling thread.
+   */
+  Result parseNow(const std::string& markup, const StyleOptions& options);
+
+  /**
+   * Result of a queued or running job for the same content, waiting for
+   * it if needed (a queued job runs on the calling thread). Returns nullptr
+   * if no such job exists or it was cancelled.
+   */
+  Result join(const std::string& markup, const StyleOptions& options);
+
+  /**
+   * Number of jobs waiting in a lane (excluding running and cancelled jobs).
+   */
+  size_t pendingCount(ParseLane lane) const;
+
+ private:
+  static constexpr size_t kLaneCount = 3;
+
+  struct Owner {
+    std::shared_ptr<std::atomic<uint64_t>> counter;  // nullptr = never cancelled
+    uint64_t generation = 0;
+  };
+
+  struct Job {
+    enum class Status { Queued, Running, Done };
+
+    uint64_t key = 0;
+    std::string markup;
+    StyleOptions options;
+    std::mutex mutex;  // Guards lane, status and owners
+    ParseLane lane = ParseLane::Idle;
+    Status status = Status::Queued;
+    std::vector<Owner> owners;
+    std::promise<Result> promise;
+    std::shared_future<Result> future;
+    std::function<void()> task;  // Set for post()ed work instead of markup
+  };
+  using JobPtr = std::shared_ptr<Job>;
+
+  struct WorkerQueues {
+    mutable std::mutex mutex;
+    std::array<std::deque<JobPtr>, kLaneCount> lanes;
+  };
+
+  static uint64_t contentKey(const std::string& markup, const StyleOptions& options);
+  // Both called with job.mutex held
+  static bool isCancelledLocked(const Job& job);
+  static void addOwnerLocked(Job& job, Owner owner);
+
+  JobPtr findJobLocked(uint64_t key, const std::string& markup, const StyleOptions& options) const;
+  void enqueue(JobPtr job, ParseLane lane);
+  JobPtr takeJob(size_t worker);
+  void startWorkersLocked();
+  void workerLoop(size_t worker);
+  void runJob(const JobPtr& job);
+  void finishJob(const JobPtr& job, Result result);
+  void forgetJob(const JobPtr& job);
+
+  const size_t threadCount_;
+  // Guards inFlight_ and workers_; queues and jobs have their own locks
+  mutable std::mutex mutex_;
+  std::vector<WorkerQueues> queues_;
+  std::vector<std::thread> workers_;
+  std::unordered_multimap<uint64_t, JobPtr> inFlight_;
+  std::atomic<size_t> nextQueue_{0};
+
+  // Idle workers sleep until entries are queued
+  std::mutex sleepMutex_;
+  std::condition_variable wakeWorkers_;
+  std::atomic<size_t> queuedEntries_{0};  // Queue entries, including skipped ones
+  bool stopping_ = false;                 // Guarded by sleepMutex_
+};
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,42 @@
+/**
+ * ParseStats.cpp
+ *
+ * Parse counters.
+ */
+
+#include "ParseStats.h"
+
+#include <atomic>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+std::atomic<uint64_t> fullParses{0};
+std::atomic<uint64_t> incrementalParses{0};
+std::atomic<uint64_t> budgetedParses{0};
+
+} // namespace
+
+void recordParse(ParseKind kind) {
+  switch (kind) {
+    case ParseKind::Full:
+      fullParses.fetch_add(1, std::memory_order_relaxed);
+      break;
+    case ParseKind::Incremental:
+      incrementalParses.fetch_add(1, std::memory_order_relaxed);
+      break;
+    case ParseKind::Budgeted:
+      budgetedParses.fetch_add(1, std::memory_order_relaxed);
+      break;
+  }
+}
+
+ParseStats parseStats() {
+  return ParseStats{
+      fullParses.load(std::memory_order_relaxed),
+      incrementalParses.load(std::memory_order_relaxed),
+      budgetedParses.load(std::memory_order_relaxed)};
+}
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,44 @@
+/**
+ * ParseStats.h
+ *
+ * Process-wide counts of the parses that ran, by kind. Lets tests and
+ * benchmarks check that caching keeps parsing off the measure path.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::react::parsing {
+
+enum class ParseKind : uint8_t {
+  Full = 0,         // Whole document, including update()s that start over
+  Incremental = 1,  // IncrementalParseSession::update() that parsed only a change
+  Budgeted = 2,     // Prefix of a numberOfLines preview
+};
+
+struct ParseStats {
+  uint64_t full = 0;
+  uint64_t incremental = 0;
+  uint64_t budgeted = 0;
+
+  uint64_t total() const {
+    return full + incremental + budgeted;
+  }
+
+  ParseStats operator-(const ParseStats& other) const {
+    return ParseStats{full - other.full, incremental - other.incremental, budgeted - other.budgeted};
+  }
+};
+
+/**
+ * Count a parse that ran (cache hits are not parses). Thread-safe.
+ */
+void recordParse(ParseKind kind);
+
+/**
+ * Parses run since the process started.
+ */
+ParseStats parseStats();
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,162 @@
+/**
+ * ParseThreadPool.cpp
+ *
+ * Work-stealing thread pool implementation.
+ */
+
+#include "ParseThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+
+namespace facebook::react::parsing {
+
+struct ParseThreadPool::Job {
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<size_t> indices;
+  };
+
+  Job(const std::function<void(size_t)>& task, size_t count, size_t participants)
+      : task(task), queues(participants), remaining(count) {}
+
+  const std::function<void(size_t)>& task;
+  std::vector<TaskQueue> queues;
+  std::atomic<size_t> remaining;
+
+  std::mutex doneMutex;
+  std::condition_variable done;
+  std::exception_ptr error;
+};
+
+ParseThreadPool::ParseThreadPool(size_t workerCount) {
+  workers_.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; ++i) {
+    // Participant 0 is the thread calling parallelFor()
+    workers_.emplace_back([this, i] { workerLoop(i + 1); });
+  }
+}
+
+ParseThreadPool::~ParseThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wakeWorkers_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+ParseThreadPool& ParseThreadPool::shared() {
+  static ParseThreadPool pool([] {
+    unsigned cores = std::thread::hardware_concurrency();
+    return cores > 1 ? std::min<size_t>(cores - 1, 3) : 0;
+  }());
+  return pool;
+}
+
+void ParseThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& task) {
+  if (count == 0) {
+    return;
+  }
+
+  bool idle = false;
+  if (workers_.empty() || count == 1 || !busy_.compare_exchange_strong(idle, true)) {
+    for (size_t i = 0; i < count; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  size_t participants = workers_.size() + 1;
+  auto job = std::make_shared<Job>(task, count, participants);
+  for (size_t i = 0; i < count; ++i) {
+    job->queues[i % participants].indices.push_back(i);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = job;
+    jobGeneration_++;
+  }
+  wakeWorkers_.notify_all();
+
+  runTasks(*job, 0);
+
+  {
+    std::unique_lock<std::mutex> lock(job->doneMutex);
+    job->done.wait(lock, [&] { return job->remaining.load() == 0; });
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_.reset();
+  }
+  busy_.store(false);
+
+  if (job->error) {
+    std::rethrow_exception(job->error);
+  }
+}
+
+void ParseThreadPool::workerLoop(size_t participant) {
+  size_t seenGeneration = 0;
+  while (true) {
+    std::shared_ptr<Job> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wakeWorkers_.wait(lock, [&] { return stopping_ || (job_ && jobGeneration_ != seenGeneration); });
+      if (stopping_) {
+        return;
+      }
+      seenGeneration = jobGeneration_;
+      job = job_;
+    }
+    runTasks(*job, participant);
+  }
+}
+
+void ParseThreadPool::runTasks(Job& job, size_t participant) {
+  size_t participants = job.queues.size();
+  while (true) {
+    size_t index = 0;
+    bool found = false;
+
+    // Own queue first, then steal from the others
+    for (size_t offset = 0; offset < participants && !found; ++offset) {
+      auto& queue = job.queues[(participant + offset) % participants];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.indices.empty()) {
+        if (offset == 0) {
+          index = queue.indices.front();
+          queue.indices.pop_front();
+        } else {
+          index = queue.indices.back();
+          queue.indices.pop_back();
+        }
+        found = true;
+      }
+    }
+    if (!found) {
+      return;
+    }
+
+    try {
+      job.task(index);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(job.doneMutex);
+      if (!job.error) {
+        job.error = std::current_exception();
+      }
+    }
+
+    if (job.remaining.fetch_sub(1) == 1) {
+      std::lock_guard<std::mutex> lock(job.doneMutex);
+      job.done.notify_all();
+    }
+  }
+}
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,74 @@
+/**
+ * ParseThreadPool.h
+ *
+ * Small work-stealing thread pool for parsing work that can be split into
+ * independent tasks (document blocks, batches of documents).
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace facebook::react::parsing {
+
+/**
+ * Fixed set of worker threads that run one parallelFor() at a time.
+ *
+ * Task indices are dealt round-robin into one queue per participant (the
+ * workers and the calling thread). Each participant drains its own queue
+ * from the front and, once empty, steals from the back of the others, so
+ * uneven task sizes still keep every participant busy.
+ */
+class ParseThreadPool {
+ public:
+  /**
+   * @param workerCount Number of worker threads in addition to the caller.
+   *                    With 0, parallelFor() runs everything on the caller.
+   */
+  explicit ParseThreadPool(size_t workerCount);
+  ~ParseThreadPool();
+
+  ParseThreadPool(const ParseThreadPool&) = delete;
+  ParseThreadPool& operator=(const ParseThreadPool&) = delete;
+
+  /**
+   * Process-wide pool sized to the device: one worker per additional core,
+   * at most 3. Created on first use.
+   */
+  static ParseThreadPool& shared();
+
+  size_t workerCount() const { return workers_.size(); }
+
+  /**
+   * Run task(i) for every i in [0, count) and wait until all have finished.
+   * The calling thread runs tasks too. If the pool is already running
+   * another parallelFor() (including a nested call from a task), the tasks
+   * run on the calling thread instead. The first exception thrown by a task
+   * is rethrown here after all tasks have finished.
+   */
+  void parallelFor(size_t count, const std::function<void(size_t)>& task);
+
+ private:
+  struct Job;
+
+  void workerLoop(size_t participant);
+  static void runTasks(Job& job, size_t participant);
+
+  std::vector<std::thread> workers_;
+  std::atomic<bool> busy_{false};  // Set for the duration of a parallelFor()
+
+  std::mutex mutex_;
+  std::condition_variable wakeWorkers_;
+  std::shared_ptr<Job> job_;
+  size_t jobGeneration_ = 0;
+  bool stopping_ = false;
+};
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,220 @@
+/**
+ * PipelineMetrics.cpp
+ *
+ * Phase latency histograms and counters.
+ */
+
+#include "PipelineMetrics.h"
+
+#include "MeasureCache.h"
+#include "ParseCache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+// Durations at or past 2^32 ns share the last bucket
+constexpr uint64_t kMaxRecordedNanoseconds = (uint64_t{1} << 32) - 1;
+
+struct AtomicHistogram {
+  std::array<std::atomic<uint64_t>, LatencyHistogram::kBucketCount> buckets{};
+  std::atomic<uint64_t> count{0};
+  std::atomic<uint64_t> totalNanoseconds{0};
+};
+
+std::array<std::array<AtomicHistogram, kDocumentSizeCount>, kMetricPhaseCount> gLatency;
+std::array<std::atomic<uint64_t>, kMetricPhaseCount> gBytes{};
+
+// Counters at the last resetPipelineMetrics(); the caches and ParseStats
+// keep counting from process start
+std::atomic<uint64_t> gParseCacheHits{0};
+std::atomic<uint64_t> gParseCacheMisses{0};
+std::atomic<uint64_t> gMeasureCacheHits{0};
+std::atomic<uint64_t> gMeasureCacheMisses{0};
+std::atomic<uint64_t> gFullParses{0};
+std::atomic<uint64_t> gIncrementalParses{0};
+std::atomic<uint64_t> gBudgetedParses{0};
+
+} // namespace
+
+const char* metricPhaseName(MetricPhase phase) {
+  switch (phase) {
+    case MetricPhase::Sanitize:
+      return "sanitize";
+    case MetricPhase::Tokenize:
+      return "tokenize";
+    case MetricPhase::Build:
+      return "build";
+    case MetricPhase::Measure:
+      return "measure";
+    case MetricPhase::Serialize:
+      return "serialize";
+  }
+  return "unknown";
+}
+
+DocumentSize documentSizeOf(size_t bytes) {
+  if (bytes < 1024) {
+    return DocumentSize::Under1KB;
+  }
+  if (bytes < 4 * 1024) {
+    return DocumentSize::Under4KB;
+  }
+  if (bytes < 16 * 1024) {
+    return DocumentSize::Under16KB;
+  }
+  if (bytes < 64 * 1024) {
+    return DocumentSize::Under64KB;
+  }
+  if (bytes < 256 * 1024) {
+    return DocumentSize::Under256KB;
+  }
+  return DocumentSize::Larger;
+}
+
+const char* documentSizeName(DocumentSize size) {
+  switch (size) {
+    case DocumentSize::Under1KB:
+      return "1kb";
+    case DocumentSize::Under4KB:
+      return "4kb";
+    case DocumentSize::Under16KB:
+      return "16kb";
+    case DocumentSize::Under64KB:
+      return "64kb";
+    case DocumentSize::Under256KB:
+      return "256kb";
+    case DocumentSize::Larger:
+      return "larger";
+  }
+  return "unknown";
+}
+
+size_t LatencyHistogram::bucketOf(uint64_t nanoseconds) {
+  nanoseconds = std::min(nanoseconds, kMaxRecordedNanoseconds);
+  if (nanoseconds < 4) {
+    return static_cast<size_t>(nanoseconds);
+  }
+  // Octave, then the two bits below its leading one
+  int octave = std::bit_width(nanoseconds) - 1;
+  return static_cast<size_t>(octave) * 4 + ((nanoseconds >> (octave - 2)) & 3);
+}
+
+uint64_t LatencyHistogram::bucketValue(size_t bucket) {
+  if (bucket < 4) {
+    return bucket;
+  }
+  size_t octave = bucket / 4;
+  uint64_t width = uint64_t{1} << (octave - 2);
+  uint64_t lower = (4 + bucket % 4) * width;
+  return lower + width / 2;
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+  if (count == 0) {
+    return 0;
+  }
+  // Rank of the duration sought, 1-based
+  double clamped = std::clamp(p, 0.0, 1.0);
+  auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped * static_cast<double>(count))));
+  uint64_t seen = 0;
+  for (size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+    seen += buckets[bucket];
+    if (seen >= rank) {
+      return bucketValue(bucket);
+    }
+  }
+  return bucketValue(kBucketCount - 1);
+}
+
+LatencyHistogram& LatencyHistogram::operator+=(const LatencyHistogram& other) {
+  for (size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+    buckets[bucket] += other.buckets[bucket];
+  }
+  count += other.count;
+  totalNanoseconds += other.totalNanoseconds;
+  return *this;
+}
+
+LatencyHistogram PipelineMetrics::latencyOf(MetricPhase phase) const {
+  LatencyHistogram merged;
+  for (const auto& histogram : latency[static_cast<size_t>(phase)]) {
+    merged += histogram;
+  }
+  return merged;
+}
+
+void recordPhase(MetricPhase phase, size_t documentBytes, std::chrono::nanoseconds duration) {
+  auto nanoseconds = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+  auto& histogram = gLatency[static_cast<size_t>(phase)][static_cast<size_t>(documentSizeOf(documentBytes))];
+  histogram.buckets[LatencyHistogram::bucketOf(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+  histogram.count.fetch_add(1, std::memory_order_relaxed);
+  histogram.totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+  gBytes[static_cast<size_t>(phase)].fetch_add(documentBytes, std::memory_order_relaxed);
+}
+
+PipelineMetrics pipelineMetrics() {
+  PipelineMetrics metrics;
+  for (size_t phase = 0; phase < kMetricPhaseCount; ++phase) {
+    for (size_t size = 0; size < kDocumentSizeCount; ++size) {
+      const auto& source = gLatency[phase][size];
+      auto& histogram = metrics.latency[phase][size];
+      for (size_t bucket = 0; bucket < LatencyHistogram::kBucketCount; ++bucket) {
+        histogram.buckets[bucket] = source.buckets[bucket].load(std::memory_order_relaxed);
+      }
+      histogram.count = source.count.load(std::memory_order_relaxed);
+      histogram.totalNanoseconds = source.totalNanoseconds.load(std::memory_order_relaxed);
+    }
+    metrics.bytes[phase] = gBytes[phase].load(std::memory_order_relaxed);
+  }
+
+  metrics.parses = parseStats() -
+      ParseStats{
+          gFullParses.load(std::memory_order_relaxed),
+          gIncrementalParses.load(std::memory_order_relaxed),
+          gBudgetedParses.load(std::memory_order_relaxed)};
+
+  auto& parseCache = ParseCache::shared();
+  metrics.parseCache.hits = parseCache.hits() - gParseCacheHits.load(std::memory_order_relaxed);
+  metrics.parseCache.misses = parseCache.misses() - gParseCacheMisses.load(std::memory_order_relaxed);
+  metrics.parseCache.entries = parseCache.size();
+  metrics.parseCache.bytes = parseCache.bytes();
+
+  auto& measureCache = MeasureCache::shared();
+  metrics.measureCache.hits = measureCache.hits() - gMeasureCacheHits.load(std::memory_order_relaxed);
+  metrics.measureCache.misses = measureCache.misses() - gMeasureCacheMisses.load(std::memory_order_relaxed);
+  metrics.measureCache.entries = measureCache.size();
+  metrics.measureCache.bytes = measureCache.bytes();
+  return metrics;
+}
+
+void resetPipelineMetrics() {
+  for (auto& phase : gLatency) {
+    for (auto& histogram : phase) {
+      for (auto& bucket : histogram.buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+      histogram.count.store(0, std::memory_order_relaxed);
+      histogram.totalNanoseconds.store(0, std::memory_order_relaxed);
+    }
+  }
+  for (auto& bytes : gBytes) {
+    bytes.store(0, std::memory_order_relaxed);
+  }
+
+  auto parses = parseStats();
+  gFullParses.store(parses.full, std::memory_order_relaxed);
+  gIncrementalParses.store(parses.incremental, std::memory_order_relaxed);
+  gBudgetedParses.store(parses.budgeted, std::memory_order_relaxed);
+  gParseCacheHits.store(ParseCache::shared().hits(), std::memory_order_relaxed);
+  gParseCacheMisses.store(ParseCache::shared().misses(), std::memory_order_relaxed);
+  gMeasureCacheHits.store(MeasureCache::shared().hits(), std::memory_order_relaxed);
+  gMeasureCacheMisses.store(MeasureCache::shared().misses(), std::memory_order_relaxed);
+}
+
+} // namespace facebook::react::parsing
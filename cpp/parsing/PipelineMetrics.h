@@ -0,0 +1,173 @@
+/**
+ * PipelineMetrics.h
+ *
+ * Process-wide latency histograms of the parse and measure pipeline's
+ * phases, by document size, with parse counts and cache hit rates. Always
+ * compiled: recording a phase costs two clock reads and a few relaxed
+ * atomic adds, and never allocates. Read through pipelineMetrics() or,
+ * from JS, global.__fabricRichTextMetrics (FabricPipelineMetricsJSI.h).
+ */
+
+#pragma once
+
+#include "ParseStats.h"
+#include "PipelineTrace.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace facebook::react::parsing {
+
+/**
+ * Timed pipeline phase. Markup is sanitized while it is tokenized, so
+ * Sanitize times the UTF-8 validation and repair of input before it.
+ */
+enum class MetricPhase : uint8_t {
+  Sanitize = 0,   // UTF-8 validation and repair of markup
+  Tokenize = 1,   // Markup scanning into segments
+  Build = 2,      // Segments to AttributedString
+  Measure = 3,    // Platform or estimated text layout
+  Serialize = 4,  // State content hash, delta and wire encoding
+};
+
+constexpr size_t kMetricPhaseCount = 5;
+
+const char* metricPhaseName(MetricPhase phase);
+
+/**
+ * Size bucket of the markup a phase worked on, by powers of 4 from 1 KB.
+ */
+enum class DocumentSize : uint8_t {
+  Under1KB = 0,
+  Under4KB = 1,
+  Under16KB = 2,
+  Under64KB = 3,
+  Under256KB = 4,
+  Larger = 5,
+};
+
+constexpr size_t kDocumentSizeCount = 6;
+
+DocumentSize documentSizeOf(size_t bytes);
+
+/**
+ * Name of a size bucket for reports ("1kb", "4kb", ..., "larger").
+ */
+const char* documentSizeName(DocumentSize size);
+
+/**
+ * Counts of durations in log-spaced buckets: four per power of two of
+ * nanoseconds, so a percentile is within 12.5% of the true value. Durations
+ * of 2^32 ns (4.3 s) and more share the last bucket.
+ */
+struct LatencyHistogram {
+  static constexpr size_t kBucketCount = 128;
+
+  std::array<uint64_t, kBucketCount> buckets{};
+  uint64_t count = 0;
+  uint64_t totalNanoseconds = 0;
+
+  static size_t bucketOf(uint64_t nanoseconds);
+
+  /**
+   * Midpoint of a bucket's durations, in nanoseconds.
+   */
+  static uint64_t bucketValue(size_t bucket);
+
+  /**
+   * Duration below which a fraction p (0-1) of the recorded ones fall,
+   * in nanoseconds; 0 when nothing was recorded.
+   */
+  uint64_t percentile(double p) const;
+
+  uint64_t meanNanoseconds() const {
+    return count == 0 ? 0 : totalNanoseconds / count;
+  }
+
+  LatencyHistogram& operator+=(const LatencyHistogram& other);
+};
+
+/**
+ * Lookups of one of the shared caches and what it holds.
+ */
+struct CacheMetrics {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  size_t entries = 0;
+  size_t bytes = 0;
+
+  double hitRate() const {
+    uint64_t lookups = hits + misses;
+    return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+  }
+};
+
+/**
+ * Metrics recorded since the process started or resetPipelineMetrics().
+ */
+struct PipelineMetrics {
+  ParseStats parses;
+  // Latency of each phase by DocumentSize
+  std::array<std::array<LatencyHistogram, kDocumentSizeCount>, kMetricPhaseCount> latency{};
+  // Bytes of markup each phase worked on
+  std::array<uint64_t, kMetricPhaseCount> bytes{};
+  CacheMetrics parseCache;
+  CacheMetrics measureCache;
+
+  const LatencyHistogram& latencyOf(MetricPhase phase, DocumentSize size) const {
+    return latency[static_cast<size_t>(phase)][static_cast<size_t>(size)];
+  }
+
+  /**
+   * Latency of a phase over all document sizes.
+   */
+  LatencyHistogram latencyOf(MetricPhase phase) const;
+};
+
+/**
+ * Record that phase took duration on a document of documentBytes.
+ * Thread-safe and lock-free.
+ */
+void recordPhase(MetricPhase phase, size_t documentBytes, std::chrono::nanoseconds duration);
+
+/**
+ * Snapshot of the metrics. Counters are read one by one, so a snapshot
+ * taken while other threads record may be off by their last few records.
+ */
+PipelineMetrics pipelineMetrics();
+
+/**
+ * Start a new reporting window: histograms are cleared, and parse and
+ * cache counts are reported from here on.
+ */
+void resetPipelineMetrics();
+
+/**
+ * Records the time from construction to destruction as phase, and traces
+ * it as a span named after the phase (see PipelineTrace.h).
+ */
+class PhaseTimer {
+ public:
+  PhaseTimer(MetricPhase phase, size_t documentBytes)
+      : phase_(phase),
+        documentBytes_(documentBytes),
+        start_(std::chrono::steady_clock::now()),
+        trace_(metricPhaseName(phase), TraceArgs{0, documentBytes, 0}) {}
+
+  ~PhaseTimer() {
+    recordPhase(phase_, documentBytes_, std::chrono::steady_clock::now() - start_);
+  }
+
+  PhaseTimer(const PhaseTimer&) = delete;
+  PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+ private:
+  MetricPhase phase_;
+  size_t documentBytes_;
+  std::chrono::steady_clock::time_point start_;
+  TraceScope trace_;
+};
+
+} // namespace facebook::react::parsing
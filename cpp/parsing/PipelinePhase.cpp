@@ -0,0 +1,53 @@
+/**
+ * PipelinePhase.cpp
+ *
+ * Per-thread phase markers.
+ */
+
+#include "PipelinePhase.h"
+
+namespace facebook::react::parsing {
+
+const char* pipelinePhaseName(PipelinePhase phase) {
+  switch (phase) {
+    case PipelinePhase::None:
+      return "none";
+    case PipelinePhase::Normalize:
+      return "normalize";
+    case PipelinePhase::Tokenize:
+      return "tokenize";
+    case PipelinePhase::Style:
+      return "style";
+    case PipelinePhase::Build:
+      return "build";
+    case PipelinePhase::Accessibility:
+      return "accessibility";
+    case PipelinePhase::Serialize:
+      return "serialize";
+  }
+  return "none";
+}
+
+#ifdef FABRIC_RICH_TEXT_PHASE_MARKERS
+
+namespace {
+
+thread_local PipelinePhase currentPhase = PipelinePhase::None;
+
+} // namespace
+
+PipelinePhase currentPipelinePhase() {
+  return currentPhase;
+}
+
+PipelinePhaseScope::PipelinePhaseScope(PipelinePhase phase) : previous_(currentPhase) {
+  currentPhase = phase;
+}
+
+PipelinePhaseScope::~PipelinePhaseScope() {
+  currentPhase = previous_;
+}
+
+#endif
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,70 @@
+/**
+ * PipelinePhase.h
+ *
+ * Scoped markers naming the pipeline phase the current thread is in, so
+ * test builds can attribute work such as heap allocations to a phase.
+ * Markers compile to nothing unless FABRIC_RICH_TEXT_PHASE_MARKERS is
+ * defined, which must then be defined for every translation unit.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace facebook::react::parsing {
+
+enum class PipelinePhase : uint8_t {
+  None = 0,           // Outside any marked phase (caches, result copies)
+  Normalize = 1,      // Segment text whitespace and break normalization
+  Tokenize = 2,       // Markup scanning into segments
+  Style = 3,          // tagStyles compilation and text attribute resolution
+  Build = 4,          // Fragment and link table assembly
+  Accessibility = 5,  // Pause detection and accessibility labels
+  Serialize = 6,      // Compact layout, content hashes, deltas, UTF-16 index
+};
+
+constexpr size_t kPipelinePhaseCount = 7;
+
+const char* pipelinePhaseName(PipelinePhase phase);
+
+#ifdef FABRIC_RICH_TEXT_PHASE_MARKERS
+
+/**
+ * Innermost phase marked on the calling thread.
+ */
+PipelinePhase currentPipelinePhase();
+
+/**
+ * Marks the calling thread as in phase until the scope ends, then restores
+ * the enclosing phase.
+ */
+class PipelinePhaseScope {
+ public:
+  explicit PipelinePhaseScope(PipelinePhase phase);
+  ~PipelinePhaseScope();
+
+  PipelinePhaseScope(const PipelinePhaseScope&) = delete;
+  PipelinePhaseScope& operator=(const PipelinePhaseScope&) = delete;
+
+ private:
+  PipelinePhase previous_;
+};
+
+#else
+
+inline PipelinePhase currentPipelinePhase() {
+  return PipelinePhase::None;
+}
+
+class PipelinePhaseScope {
+ public:
+  explicit PipelinePhaseScope(PipelinePhase) {}
+
+  PipelinePhaseScope(const PipelinePhaseScope&) = delete;
+  PipelinePhaseScope& operator=(const PipelinePhaseScope&) = delete;
+};
+
+#endif
+
+} // namespace facebook::react::parsing
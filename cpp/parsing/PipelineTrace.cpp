@@ -0,0 +1,131 @@
+/**
+ * PipelineTrace.cpp
+ *
+ * Trace sink registry and the Chrome trace-event sink.
+ */
+
+#include "PipelineTrace.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+namespace facebook::react::parsing {
+
+namespace detail {
+std::atomic<bool> gTracing{false};
+} // namespace detail
+
+namespace {
+
+std::mutex gSinkMutex;
+std::shared_ptr<TraceSink> gSink;
+
+std::atomic<uint32_t> gNextThread{1};
+
+uint32_t currentThread() {
+  thread_local uint32_t thread = gNextThread.fetch_add(1, std::memory_order_relaxed);
+  return thread;
+}
+
+double microsecondsBetween(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+  return std::chrono::duration<double, std::micro>(to - from).count();
+}
+
+void appendEventJson(std::string& json, const TraceEvent& event) {
+  char buffer[256];
+  std::snprintf(
+      buffer, sizeof(buffer),
+      "{\"name\":\"%s\",\"cat\":\"fabric-rich-text\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,"
+      "\"args\":{",
+      event.name, event.thread, event.startMicroseconds, event.durationMicroseconds);
+  json += buffer;
+
+  // 64-bit hashes do not fit a JSON number, so they are hex strings
+  const char* separator = "";
+  if (event.args.hash != 0) {
+    std::snprintf(buffer, sizeof(buffer), "\"hash\":\"%016" PRIx64 "\"", event.args.hash);
+    json += buffer;
+    separator = ",";
+  }
+  if (event.args.bytes != 0) {
+    std::snprintf(buffer, sizeof(buffer), "%s\"bytes\":%zu", separator, event.args.bytes);
+    json += buffer;
+    separator = ",";
+  }
+  if (event.args.fragments != 0) {
+    std::snprintf(buffer, sizeof(buffer), "%s\"fragments\":%zu", separator, event.args.fragments);
+    json += buffer;
+  }
+  json += "}}";
+}
+
+} // namespace
+
+void setTraceSink(std::shared_ptr<TraceSink> sink) {
+  std::lock_guard<std::mutex> lock(gSinkMutex);
+  detail::gTracing.store(sink != nullptr, std::memory_order_relaxed);
+  gSink = std::move(sink);
+}
+
+std::shared_ptr<TraceSink> traceSink() {
+  std::lock_guard<std::mutex> lock(gSinkMutex);
+  return gSink;
+}
+
+void TraceScope::begin(const char* name, const TraceArgs& args) {
+  sink_ = traceSink();
+  if (!sink_) {
+    return;
+  }
+  span_.name = name;
+  span_.args = args;
+  span_.start = std::chrono::steady_clock::now();
+  sink_->beginSpan(span_);
+}
+
+ChromeTraceSink::ChromeTraceSink(size_t capacity)
+    : origin_(std::chrono::steady_clock::now()), capacity_(std::max<size_t>(capacity, 1)) {}
+
+void ChromeTraceSink::endSpan(const TraceSpan& span, std::chrono::steady_clock::time_point end) {
+  TraceEvent event{
+      span.name, currentThread(), microsecondsBetween(origin_, span.start), microsecondsBetween(span.start, end),
+      span.args};
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (ring_.size() < capacity_) {
+    ring_.push_back(event);
+    return;
+  }
+  ring_[next_] = event;
+  next_ = (next_ + 1) % capacity_;
+}
+
+std::vector<TraceEvent> ChromeTraceSink::events() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<TraceEvent> events;
+  events.reserve(ring_.size());
+  events.insert(events.end(), ring_.begin() + static_cast<ptrdiff_t>(next_), ring_.end());
+  events.insert(events.end(), ring_.begin(), ring_.begin() + static_cast<ptrdiff_t>(next_));
+  return events;
+}
+
+std::string ChromeTraceSink::json() const {
+  auto kept = events();
+  std::string json = "{\"traceEvents\":[";
+  for (size_t i = 0; i < kept.size(); ++i) {
+    if (i > 0) {
+      json += ",\n";
+    }
+    appendEventJson(json, kept[i]);
+  }
+  json += "],\"displayTimeUnit\":\"ms\"}\n";
+  return json;
+}
+
+void ChromeTraceSink::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ring_.clear();
+  next_ = 0;
+}
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,155 @@
+/**
+ * PipelineTrace.h
+ *
+ * Scoped trace spans around the parse and measure pipeline, handed to a
+ * pluggable TraceSink. ChromeTraceSink keeps the latest spans in a ring
+ * buffer and writes them as Chrome trace-event JSON (chrome://tracing,
+ * Perfetto). Platform tracers (ATrace, os_signpost) implement TraceSink.
+ * With no sink set, a span costs one relaxed atomic load.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace facebook::react::parsing {
+
+/**
+ * What a span worked on; 0 where not known.
+ */
+struct TraceArgs {
+  uint64_t hash = 0;      // hashMarkup() of the markup, or the state's contentHash
+  size_t bytes = 0;       // Bytes of markup
+  size_t fragments = 0;   // Fragments of the attributed string
+};
+
+/**
+ * A span in progress. name must outlive the sink's use of it (a literal).
+ */
+struct TraceSpan {
+  const char* name = "";
+  TraceArgs args;
+  std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * Receives spans. Both calls for a span happen on the thread that ran it,
+ * and spans on one thread nest, so begin/end tracers map onto it directly.
+ * Called concurrently from parsing and layout threads.
+ */
+class TraceSink {
+ public:
+  virtual ~TraceSink() = default;
+
+  virtual void beginSpan(const TraceSpan& /*span*/) {}
+
+  /**
+   * The span ended at end; args may have been filled in since it began.
+   */
+  virtual void endSpan(const TraceSpan& span, std::chrono::steady_clock::time_point end) = 0;
+};
+
+/**
+ * Sink of all spans, or nullptr (the default) to not trace. Spans already
+ * started finish on the sink they started on.
+ */
+void setTraceSink(std::shared_ptr<TraceSink> sink);
+std::shared_ptr<TraceSink> traceSink();
+
+namespace detail {
+extern std::atomic<bool> gTracing;
+} // namespace detail
+
+inline bool tracingEnabled() {
+  return detail::gTracing.load(std::memory_order_relaxed);
+}
+
+/**
+ * Traces the time from construction to destruction as a span.
+ */
+class TraceScope {
+ public:
+  explicit TraceScope(const char* name, TraceArgs args = {}) {
+    if (tracingEnabled()) {
+      begin(name, args);
+    }
+  }
+
+  ~TraceScope() {
+    if (sink_) {
+      sink_->endSpan(span_, std::chrono::steady_clock::now());
+    }
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+  /**
+   * Whether the span is recorded; compute costly args only then.
+   */
+  bool enabled() const {
+    return sink_ != nullptr;
+  }
+
+  TraceArgs& args() {
+    return span_.args;
+  }
+
+ private:
+  void begin(const char* name, const TraceArgs& args);
+
+  std::shared_ptr<TraceSink> sink_;
+  TraceSpan span_;
+};
+
+/**
+ * A finished span as kept by ChromeTraceSink. Times are microseconds
+ * since the sink was created.
+ */
+struct TraceEvent {
+  const char* name = "";
+  uint32_t thread = 0;  // Small per-thread id, in order of first span
+  double startMicroseconds = 0;
+  double durationMicroseconds = 0;
+  TraceArgs args;
+};
+
+/**
+ * Keeps the last capacity spans and writes them as Chrome trace-event JSON.
+ */
+class ChromeTraceSink : public TraceSink {
+ public:
+  static constexpr size_t kDefaultCapacity = 16384;
+
+  explicit ChromeTraceSink(size_t capacity = kDefaultCapacity);
+
+  void endSpan(const TraceSpan& span, std::chrono::steady_clock::time_point end) override;
+
+  /**
+   * Spans kept, oldest first by end time.
+   */
+  std::vector<TraceEvent> events() const;
+
+  /**
+   * { "traceEvents": [...] } with one complete ("X") event per span kept.
+   */
+  std::string json() const;
+
+  void clear();
+
+ private:
+  mutable std::mutex mutex_;
+  std::chrono::steady_clock::time_point origin_;
+  std::vector<TraceEvent> ring_;
+  size_t capacity_;
+  size_t next_ = 0;  // Slot the next span goes to once the ring is full
+};
+
+} // namespace facebook::react::parsing
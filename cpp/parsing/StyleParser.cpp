@@ -5,6 +5,8 @@
  */
 
 #include "StyleParser.h"
+#include "PipelinePhase.h"
+#include "TextNormalizer.h"
 #include <cctype>
 #include <cmath>
 #include <stdexcept>
@@ -192,4 +194,26 @@ FabricRichTagStyle getStyleFromTagStyles(
   return result;
 }
 
+CompiledTagStyles::CompiledTagStyles(const std::string& tagStyles) {
+  PipelinePhaseScope phase(PipelinePhase::Style);
+  if (tagStyles.empty()) {
+    return;
+  }
+  for (const auto& tag : INLINE_FORMATTING_TAGS) {
+    if (tagStyles.find("\"" + tag + "\"") != std::string::npos) {
+      styles_.emplace_back(tag, getStyleFromTagStyles(tagStyles, tag));
+    }
+  }
+}
+
+const FabricRichTagStyle& CompiledTagStyles::styleFor(const std::string& tagName) const {
+  static const FabricRichTagStyle unset;
+  for (const auto& [tag, style] : styles_) {
+    if (tag == tagName) {
+      return style;
+    }
+  }
+  return unset;
+}
+
 } // namespace facebook::react::parsing
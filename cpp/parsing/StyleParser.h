@@ -10,6 +10,8 @@
 #include <string>
 #include <cstdint>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 namespace facebook::react::parsing {
 
@@ -62,4 +64,24 @@ FabricRichTagStyle getStyleFromTagStyles(
     const std::string& tagStyles,
     const std::string& tagName);
 
+/**
+ * tagStyles JSON parsed once for every tag that can style a segment
+ * (the inline formatting tags), instead of once per fragment.
+ * Immutable after construction, so it can be shared between threads.
+ */
+class CompiledTagStyles {
+ public:
+  CompiledTagStyles() = default;
+  explicit CompiledTagStyles(const std::string& tagStyles);
+
+  /**
+   * Same result as getStyleFromTagStyles(tagStyles, tagName) for the
+   * inline formatting tags.
+   */
+  const FabricRichTagStyle& styleFor(const std::string& tagName) const;
+
+ private:
+  std::vector<std::pair<std::string, FabricRichTagStyle>> styles_;
+};
+
 } // namespace facebook::react::parsing
@@ -0,0 +1,127 @@
+/**
+ * TextDelta.cpp
+ *
+ * Content hashing and fragment diffing of parse results.
+ */
+
+#include "TextDelta.h"
+
+#include "CompactTextLayout.h"
+#include "PipelinePhase.h"
+#include "Utf16TextIndex.h"
+
+#include <algorithm>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+constexpr uint64_t kFnvOffset = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+uint64_t hashBytes(uint64_t hash, const void* data, size_t size) {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * kFnvPrime;
+  }
+  return hash;
+}
+
+template <typename T>
+uint64_t hashValue(uint64_t hash, T value) {
+  return hashBytes(hash, &value, sizeof(value));
+}
+
+uint64_t hashString(uint64_t hash, const std::string& value) {
+  hash = hashValue(hash, static_cast<uint64_t>(value.size()));
+  return hashBytes(hash, value.data(), value.size());
+}
+
+bool sameFragment(
+    const AttributedString::Fragment& a,
+    const std::string* aLink,
+    const AttributedString::Fragment& b,
+    const std::string* bLink) {
+  if (a.string != b.string || !(a.textAttributes == b.textAttributes)) {
+    return false;
+  }
+  if (aLink == nullptr || bLink == nullptr) {
+    return aLink == bLink;
+  }
+  return *aLink == *bLink;
+}
+
+} // namespace
+
+uint64_t contentHash(const AttributedString& attributedString, const LinkTable& links) {
+  PipelinePhaseScope phase(PipelinePhase::Serialize);
+  uint64_t hash = kFnvOffset;
+  const auto& fragments = attributedString.getFragments();
+  for (size_t i = 0; i < fragments.size(); ++i) {
+    const auto& fragment = fragments[i];
+    hash = hashString(hash, fragment.string);
+
+    // Fields of the style record are the attributes the renderers read
+    auto style = CompactTextStyle::fromTextAttributes(fragment.textAttributes);
+    hash = hashValue(hash, style.fontSize);
+    hash = hashValue(hash, style.lineHeight);
+    hash = hashValue(hash, style.letterSpacing);
+    hash = hashValue(hash, style.foregroundColor);
+    hash = hashValue(hash, style.backgroundColor);
+    hash = hashValue(hash, style.fontWeight);
+    hash = hashValue(hash, style.flags);
+    hash = hashValue(hash, style.textDecoration);
+    hash = hashString(hash, fragment.textAttributes.fontFamily);
+
+    const std::string* link = links.urlAt(i);
+    hash = hashString(hash, link ? *link : std::string());
+  }
+  return hash == 0 ? 1 : hash;
+}
+
+TextDelta diffFragments(
+    const AttributedString& base,
+    const LinkTable& baseLinks,
+    const AttributedString& target,
+    const LinkTable& targetLinks) {
+  PipelinePhaseScope phase(PipelinePhase::Serialize);
+  const auto& baseFragments = base.getFragments();
+  const auto& targetFragments = target.getFragments();
+  size_t common = std::min(baseFragments.size(), targetFragments.size());
+
+  TextDelta delta;
+  size_t prefix = 0;
+  while (prefix < common &&
+         sameFragment(
+             baseFragments[prefix], baseLinks.urlAt(prefix), targetFragments[prefix], targetLinks.urlAt(prefix))) {
+    delta.utf16Start += utf16Length(baseFragments[prefix].string);
+    prefix++;
+  }
+
+  size_t suffix = 0;
+  while (suffix < common - prefix) {
+    size_t baseIndex = baseFragments.size() - 1 - suffix;
+    size_t targetIndex = targetFragments.size() - 1 - suffix;
+    if (!sameFragment(
+            baseFragments[baseIndex],
+            baseLinks.urlAt(baseIndex),
+            targetFragments[targetIndex],
+            targetLinks.urlAt(targetIndex))) {
+      break;
+    }
+    suffix++;
+  }
+
+  delta.first = prefix;
+  delta.removed = baseFragments.size() - prefix - suffix;
+  delta.inserted = targetFragments.size() - prefix - suffix;
+  for (size_t i = prefix; i < prefix + delta.removed; ++i) {
+    delta.utf16Removed += utf16Length(baseFragments[i].string);
+  }
+  for (size_t i = prefix; i < prefix + delta.inserted; ++i) {
+    delta.utf16Inserted += utf16Length(targetFragments[i].string);
+  }
+  return delta;
+}
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,59 @@
+/**
+ * TextDelta.h
+ *
+ * Change between two versions of a parse result as one replaced range.
+ * State updates carry the content hash of the version they replace plus
+ * this delta, so a renderer still showing that version can patch the
+ * changed range in place instead of rebuilding the whole text.
+ */
+
+#pragma once
+
+#include "LinkTable.h"
+
+#include <react/renderer/attributedstring/AttributedString.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace facebook::react::parsing {
+
+/**
+ * Units [first, first + removed) of the base become units
+ * [first, first + inserted) of the target; everything before and after is
+ * shared. Units are fragments, or runs for CompactTextLayout::diff().
+ */
+struct TextDelta {
+  uint64_t baseHash = 0;       // contentHash() of the base
+  size_t first = 0;
+  size_t removed = 0;
+  size_t inserted = 0;
+  size_t utf16Start = 0;       // Replaced range in the base, in UTF-16 code units
+  size_t utf16Removed = 0;
+  size_t utf16Inserted = 0;    // Length of the replacing text in the target
+
+  bool empty() const {
+    return removed == 0 && inserted == 0;
+  }
+
+  bool operator==(const TextDelta& other) const = default;
+};
+
+/**
+ * 64-bit hash of the text, rendered attributes and links of a parse
+ * result. Never 0, so 0 can mean "no content".
+ */
+uint64_t contentHash(const AttributedString& attributedString, const LinkTable& links);
+
+/**
+ * Fragment delta from base to target: the longest common prefix and suffix
+ * of fragments (text, attributes and link) are kept. Cost is linear in the
+ * number of fragments; baseHash is left for the caller to fill in.
+ */
+TextDelta diffFragments(
+    const AttributedString& base,
+    const LinkTable& baseLinks,
+    const AttributedString& target,
+    const LinkTable& targetLinks);
+
+} // namespace facebook::react::parsing
@@ -5,6 +5,7 @@
  */
 
 #include "TextNormalizer.h"
+#include "PipelinePhase.h"
 #include <cctype>
 
 namespace facebook::react::parsing {
@@ -31,6 +32,7 @@ bool isInlineFormattingTag(const std::string& tag) {
 }
 
 std::string normalizeInterTagWhitespace(const std::string& html) {
+  PipelinePhaseScope phase(PipelinePhase::Normalize);
   std::string result;
   result.reserve(html.size());
 
@@ -80,158 +82,6 @@ std::string normalizeInterTagWhitespace(const std::string& html) {
   return result;
 }
 
-std::string stripMarkupTags(const std::string& markup) {
-  std::string result;
-  result.reserve(markup.size());
-
-  bool inTag = false;
-  bool inScript = false;
-  bool inStyle = false;
-  std::vector<FabricRichListContext> listStack;
-  std::string tagName;
-
-  for (size_t i = 0; i < markup.size(); ++i) {
-    char c = markup[i];
-
-    if (c == '<') {
-      inTag = true;
-      tagName.clear();
-      continue;
-    }
-
-    if (c == '>') {
-      inTag = false;
-
-      std::string lowerTag = tagName;
-      for (char& ch : lowerTag) {
-        ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
-      }
-
-      if (lowerTag == "script") {
-        inScript = true;
-      } else if (lowerTag == "/script") {
-        inScript = false;
-      } else if (lowerTag == "style") {
-        inStyle = true;
-      } else if (lowerTag == "/style") {
-        inStyle = false;
-      } else if (lowerTag == "br" || lowerTag == "br/" || lowerTag == "br /") {
-        result += '\n';
-      } else if (lowerTag == "/p" || lowerTag == "/div" ||
-                 lowerTag == "/h1" || lowerTag == "/h2" || lowerTag == "/h3" ||
-                 lowerTag == "/h4" || lowerTag == "/h5" || lowerTag == "/h6") {
-        result += "\n\n";
-      } else if (lowerTag == "ul") {
-        int nestingLevel = static_cast<int>(listStack.size()) + 1;
-        listStack.push_back({FabricRichListType::Unordered, 0, nestingLevel});
-      } else if (lowerTag == "ol") {
-        int nestingLevel = static_cast<int>(listStack.size()) + 1;
-        listStack.push_back({FabricRichListType::Ordered, 0, nestingLevel});
-      } else if (lowerTag == "/ul" || lowerTag == "/ol") {
-        if (!listStack.empty()) {
-          listStack.pop_back();
-        }
-        if (listStack.empty()) {
-          result += "\n\n";
-        }
-      } else if (lowerTag == "li") {
-        if (!result.empty() && result.back() != '\n') {
-          result += '\n';
-        }
-        if (!listStack.empty()) {
-          auto& currentList = listStack.back();
-          currentList.itemCounter++;
-          int indentLevel = static_cast<int>(listStack.size()) - 1;
-          if (indentLevel > 0) {
-            result += std::string(indentLevel * 4, ' ');
-          }
-          if (currentList.type == FabricRichListType::Ordered) {
-            result += std::to_string(currentList.itemCounter) + ". ";
-          } else {
-            result += "\xE2\x80\xA2 ";  // UTF-8 bullet character
-          }
-        } else {
-          result += "\xE2\x80\xA2 ";  // UTF-8 bullet character
-        }
-      }
-
-      tagName.clear();
-      continue;
-    }
-
-    if (inTag) {
-      if (!std::isspace(static_cast<unsigned char>(c))) {
-        tagName += c;
-      }
-      continue;
-    }
-
-    if (!inScript && !inStyle) {
-      result += c;
-    }
-  }
-
-  // Decode common HTML entities
-  std::string decoded;
-  decoded.reserve(result.size());
-
-  for (size_t i = 0; i < result.size(); ++i) {
-    if (result[i] == '&') {
-      size_t end = result.find(';', i);
-      if (end != std::string::npos && end - i < 10) {
-        std::string entity = result.substr(i, end - i + 1);
-        if (entity == "&amp;") {
-          decoded += '&';
-        } else if (entity == "&lt;") {
-          decoded += '<';
-        } else if (entity == "&gt;") {
-          decoded += '>';
-        } else if (entity == "&quot;") {
-          decoded += '"';
-        } else if (entity == "&apos;") {
-          decoded += '\'';
-        } else if (entity == "&nbsp;") {
-          decoded += ' ';
-        } else {
-          decoded += entity;
-        }
-        i = end;
-        continue;
-      }
-    }
-    decoded += result[i];
-  }
-
-  // Normalize whitespace
-  std::string normalized;
-  normalized.reserve(decoded.size());
-  bool lastWasSpace = true;
-
-  for (char c : decoded) {
-    if (std::isspace(static_cast<unsigned char>(c))) {
-      if (c == '\n') {
-        if (!lastWasSpace) {
-          normalized += '\n';
-          lastWasSpace = true;
-        }
-      } else if (!lastWasSpace) {
-        normalized += ' ';
-        lastWasSpace = true;
-      }
-    } else {
-      normalized += c;
-      lastWasSpace = false;
-    }
-  }
-
-  while (!normalized.empty() &&
-         std::isspace(static_cast<unsigned char>(normalized.back()))) {
-    normalized.pop_back();
-  }
-
-  return normalized;
-}
-
 bool isParagraphBreak(const std::string& text) {
   for (char c : text) {
     if (c != '\n' && !std::isspace(static_cast<unsigned char>(c))) {
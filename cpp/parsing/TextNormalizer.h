@@ -21,6 +21,8 @@ struct FabricRichListContext {
   FabricRichListType type;
   int itemCounter;
   int nestingLevel;
+
+  bool operator==(const FabricRichListContext& other) const = default;
 };
 
 // Block-level HTML tags - whitespace between these can be collapsed
@@ -48,15 +50,6 @@ bool isInlineFormattingTag(const std::string& tag);
  */
 std::string normalizeInterTagWhitespace(const std::string& html);
 
-/**
- * Strip markup tags from a string, returning plain text content.
- * Handles lists, line breaks, and basic formatting.
- * Also decodes common entities.
- * @param markup Markup string to strip
- * @return Plain text content
- */
-std::string stripMarkupTags(const std::string& markup);
-
 /**
  * Normalize a single segment's text (whitespace handling).
  * @param text Text to normalize
@@ -50,44 +50,21 @@ bool isStrongLTR(char32_t codepoint) {
   return false;
 }
 
-WritingDirection detectDirectionFromText(const std::string& text) {
-  // UTF-8 decode and check first strong directional character
+std::optional<WritingDirection> findFirstStrongDirection(std::string_view text) {
+  // Text is valid UTF-8 (see Utf8Validator.h). Lookahead text for dir="auto"
+  // may stop inside the last sequence, which ends the search.
   size_t i = 0;
   while (i < text.size()) {
-    char32_t codepoint = 0;
     unsigned char c = static_cast<unsigned char>(text[i]);
-
-    // UTF-8 decoding
-    if (c < 0x80) {
-      // ASCII
-      codepoint = c;
-      i += 1;
-    } else if ((c & 0xE0) == 0xC0) {
-      // 2-byte sequence
-      if (i + 1 >= text.size()) break;
-      codepoint = ((c & 0x1F) << 6) |
-                  (static_cast<unsigned char>(text[i + 1]) & 0x3F);
-      i += 2;
-    } else if ((c & 0xF0) == 0xE0) {
-      // 3-byte sequence
-      if (i + 2 >= text.size()) break;
-      codepoint = ((c & 0x0F) << 12) |
-                  ((static_cast<unsigned char>(text[i + 1]) & 0x3F) << 6) |
-                  (static_cast<unsigned char>(text[i + 2]) & 0x3F);
-      i += 3;
-    } else if ((c & 0xF8) == 0xF0) {
-      // 4-byte sequence
-      if (i + 3 >= text.size()) break;
-      codepoint = ((c & 0x07) << 18) |
-                  ((static_cast<unsigned char>(text[i + 1]) & 0x3F) << 12) |
-                  ((static_cast<unsigned char>(text[i + 2]) & 0x3F) << 6) |
-                  (static_cast<unsigned char>(text[i + 3]) & 0x3F);
-      i += 4;
-    } else {
-      // Invalid UTF-8, skip byte
-      i += 1;
-      continue;
+    size_t length = c < 0x80 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+    if (i + length > text.size()) {
+      break;
     }
+    char32_t codepoint = length == 1 ? c : c & (0x7F >> length);
+    for (size_t k = 1; k < length; ++k) {
+      codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[i + k]) & 0x3F);
+    }
+    i += length;
 
     // Check for strong directional character
     if (isStrongRTL(codepoint)) {
@@ -99,8 +76,44 @@ WritingDirection detectDirectionFromText(const std::string& text) {
     // Skip neutral characters (numbers, punctuation, whitespace) and continue
   }
 
+  return std::nullopt;
+}
+
+bool containsBidi(std::string_view text) {
+  size_t i = 0;
+  while (i < text.size()) {
+    unsigned char c = static_cast<unsigned char>(text[i]);
+    // Every code point below U+0590 is neither RTL nor a bidi control
+    if (c < 0xD6) {
+      ++i;
+      continue;
+    }
+    size_t length = c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+    if (i + length > text.size()) {
+      break;
+    }
+    char32_t codepoint = c & (0x7F >> length);
+    for (size_t k = 1; k < length; ++k) {
+      codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[i + k]) & 0x3F);
+    }
+    i += length;
+
+    if (isStrongRTL(codepoint) ||
+        (codepoint >= 0x0590 && codepoint <= 0x08FF) ||     // Hebrew to Arabic Extended-A
+        (codepoint >= 0x10800 && codepoint <= 0x10FFF) ||   // Cypriot to Old Uyghur
+        (codepoint >= 0x1E800 && codepoint <= 0x1EFFF) ||   // Mende Kikakui to Arabic Mathematical
+        codepoint == 0x200E || codepoint == 0x200F ||       // LRM, RLM
+        (codepoint >= 0x202A && codepoint <= 0x202E) ||     // LRE, RLE, PDF, LRO, RLO
+        (codepoint >= 0x2066 && codepoint <= 0x2069)) {     // LRI, RLI, FSI, PDI
+      return true;
+    }
+  }
+  return false;
+}
+
+WritingDirection detectDirectionFromText(const std::string& text) {
   // Default to LTR if no strong character found
-  return WritingDirection::LeftToRight;
+  return findFirstStrongDirection(text).value_or(WritingDirection::LeftToRight);
 }
 
 WritingDirection parseDirectionAttribute(const std::string& dirAttr) {
@@ -8,7 +8,9 @@
 #pragma once
 
 #include <react/renderer/attributedstring/primitives.h>
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace facebook::react::parsing {
 
@@ -28,6 +30,22 @@ bool isStrongRTL(char32_t codepoint);
  */
 bool isStrongLTR(char32_t codepoint);
 
+/**
+ * Find the direction of the first strong directional character in text.
+ * @param text Valid UTF-8 text to analyze (a truncated last sequence is ignored)
+ * @return Direction of the first strong character, or nullopt if none found
+ */
+std::optional<WritingDirection> findFirstStrongDirection(std::string_view text);
+
+/**
+ * Check if text needs bidirectional handling: it has a right-to-left
+ * character (any code point of an RTL script block) or a bidi formatting
+ * character (marks, embeddings, overrides, isolates).
+ * @param text Valid UTF-8 text
+ * @return true if any such character is found
+ */
+bool containsBidi(std::string_view text);
+
 /**
  * Detect writing direction from text content.
  * Implements first strong directional character algorithm per Unicode UAX #9.
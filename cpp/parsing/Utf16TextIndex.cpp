@@ -0,0 +1,127 @@
+/**
+ * Utf16TextIndex.cpp
+ *
+ * UTF-16 transcoding and offset index implementation.
+ */
+
+#include "Utf16TextIndex.h"
+
+#include "PipelinePhase.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+
+} // namespace
+
+size_t utf16Length(std::string_view utf8) {
+  // One code unit per sequence, two for 4-byte sequences
+  size_t length = 0;
+  for (char c : utf8) {
+    auto byte = static_cast<unsigned char>(c);
+    length += (byte & 0xC0) != 0x80;
+    length += byte >= 0xF0;
+  }
+  return length;
+}
+
+void appendUtf16(std::string_view utf8, std::u16string& out) {
+  const auto* bytes = reinterpret_cast<const unsigned char*>(utf8.data());
+  const size_t size = utf8.size();
+  out.reserve(out.size() + size);
+  size_t i = 0;
+  while (i < size) {
+    if (i + sizeof(uint64_t) <= size) {
+      uint64_t word;
+      std::memcpy(&word, bytes + i, sizeof(word));
+      if ((word & kHighBits) == 0) {
+        for (size_t k = 0; k < sizeof(uint64_t); ++k) {
+          out.push_back(static_cast<char16_t>(bytes[i + k]));
+        }
+        i += sizeof(uint64_t);
+        continue;
+      }
+    }
+
+    unsigned char lead = bytes[i];
+    size_t length = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+    if (i + length > size) {
+      break;
+    }
+    char32_t codepoint = length == 1 ? lead : lead & (0x7F >> length);
+    for (size_t k = 1; k < length; ++k) {
+      codepoint = (codepoint << 6) | (bytes[i + k] & 0x3F);
+    }
+    i += length;
+
+    if (codepoint < 0x10000) {
+      out.push_back(static_cast<char16_t>(codepoint));
+    } else {
+      codepoint -= 0x10000;
+      out.push_back(static_cast<char16_t>(0xD800 + (codepoint >> 10)));
+      out.push_back(static_cast<char16_t>(0xDC00 + (codepoint & 0x3FF)));
+    }
+  }
+}
+
+Utf16TextIndex::Utf16TextIndex(
+    const AttributedString& attributedString,
+    const LinkTable& links,
+    bool includeText) {
+  PipelinePhaseScope phase(PipelinePhase::Serialize);
+  const auto& fragments = attributedString.getFragments();
+  fragmentStarts_.reserve(fragments.size() + 1);
+
+  size_t offset = 0;
+  for (const auto& fragment : fragments) {
+    fragmentStarts_.push_back(offset);
+    const std::string& string = fragment.string;
+    size_t length = 0;
+    if (includeText) {
+      size_t before = text_.size();
+      appendUtf16(string, text_);
+      length = text_.size() - before;
+    } else {
+      length = utf16Length(string);
+    }
+    offset += length;
+  }
+  fragmentStarts_.push_back(offset);
+
+  linkRanges_.reserve(links.runs().size());
+  for (const auto& run : links.runs()) {
+    if (run.endFragment() > fragments.size()) {
+      break;
+    }
+    linkRanges_.push_back(Utf16LinkRange{
+        fragmentStarts_[run.firstFragment], fragmentStarts_[run.endFragment()], run.firstFragment, run.urlId});
+  }
+}
+
+std::optional<size_t> Utf16TextIndex::fragmentAt(size_t index) const {
+  if (index >= length()) {
+    return std::nullopt;
+  }
+  // Last fragment starting at or before index; empty fragments are skipped
+  auto it = std::upper_bound(fragmentStarts_.begin(), fragmentStarts_.end() - 1, index);
+  return static_cast<size_t>(it - fragmentStarts_.begin()) - 1;
+}
+
+const Utf16LinkRange* Utf16TextIndex::linkAt(size_t index) const {
+  auto it = std::upper_bound(linkRanges_.begin(), linkRanges_.end(), index, [](size_t value, const Utf16LinkRange& range) {
+    return value < range.start;
+  });
+  if (it == linkRanges_.begin()) {
+    return nullptr;
+  }
+  --it;
+  return index < it->end ? &*it : nullptr;
+}
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,109 @@
+/**
+ * Utf16TextIndex.h
+ *
+ * UTF-16 view of a parse result for the platform renderers.
+ * NSString and Java String index text in UTF-16 code units; this index
+ * maps those indices to fragments and links with binary searches, so the
+ * platforms do not re-transcode fragments or scan them per event.
+ */
+
+#pragma once
+
+#include "LinkTable.h"
+
+#include <react/renderer/attributedstring/AttributedString.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace facebook::react::parsing {
+
+/**
+ * A link run as a range of UTF-16 code units [start, end).
+ */
+struct Utf16LinkRange {
+  size_t start = 0;
+  size_t end = 0;
+  size_t fragmentIndex = 0;  // First fragment of the link
+  uint32_t urlId = 0;        // Index into LinkTable::urls()
+
+  bool operator==(const Utf16LinkRange& other) const = default;
+};
+
+/**
+ * Number of UTF-16 code units in valid UTF-8 text.
+ */
+size_t utf16Length(std::string_view utf8);
+
+/**
+ * Transcode valid UTF-8 text to UTF-16, appending to out.
+ * ASCII is widened eight bytes per step.
+ */
+void appendUtf16(std::string_view utf8, std::u16string& out);
+
+/**
+ * UTF-16 offsets of the fragments and links of a parse result.
+ * Immutable once built; safe to share between threads.
+ */
+class Utf16TextIndex {
+ public:
+  Utf16TextIndex() = default;
+
+  /**
+   * @param links Links of the parse result
+   * @param includeText Also keep the full text transcoded to UTF-16
+   */
+  Utf16TextIndex(
+      const AttributedString& attributedString,
+      const LinkTable& links,
+      bool includeText);
+
+  /**
+   * Total length in UTF-16 code units.
+   */
+  size_t length() const {
+    return fragmentStarts_.empty() ? 0 : fragmentStarts_.back();
+  }
+
+  /**
+   * The full text in UTF-16, empty unless built with includeText.
+   */
+  const std::u16string& text() const {
+    return text_;
+  }
+
+  /**
+   * UTF-16 start offset of each fragment, followed by length().
+   */
+  const std::vector<size_t>& fragmentStarts() const {
+    return fragmentStarts_;
+  }
+
+  /**
+   * Link ranges sorted by start offset.
+   */
+  const std::vector<Utf16LinkRange>& linkRanges() const {
+    return linkRanges_;
+  }
+
+  /**
+   * Fragment containing the UTF-16 index, or nullopt if out of range.
+   */
+  std::optional<size_t> fragmentAt(size_t index) const;
+
+  /**
+   * Link containing the UTF-16 index, or nullptr if there is none.
+   */
+  const Utf16LinkRange* linkAt(size_t index) const;
+
+ private:
+  std::u16string text_;
+  std::vector<size_t> fragmentStarts_;
+  std::vector<Utf16LinkRange> linkRanges_;
+};
+
+} // namespace facebook::react::parsing
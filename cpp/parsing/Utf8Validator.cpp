@@ -0,0 +1,142 @@
+/**
+ * Utf8Validator.cpp
+ *
+ * UTF-8 validation and repair implementation.
+ */
+
+#include "Utf8Validator.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace facebook::react::parsing {
+
+namespace {
+
+constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+constexpr std::string_view kReplacementCharacter = "\xEF\xBF\xBD";
+
+// Length of the well-formed sequence at data[0] (Unicode Table 3-7), or 0 if
+// it is ill-formed. Then subpart is the length of its maximal subpart: the
+// lead byte and the continuation bytes that were valid for it.
+size_t wellFormedSequenceLength(const unsigned char* data, size_t size, size_t& subpart) {
+  unsigned char lead = data[0];
+  if (lead < 0x80) {
+    return 1;
+  }
+  size_t length = 0;
+  unsigned char low = 0x80;
+  unsigned char high = 0xBF;
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    length = 2;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    length = 3;
+    if (lead == 0xE0) {
+      low = 0xA0;
+    } else if (lead == 0xED) {
+      high = 0x9F;  // No surrogates
+    }
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    length = 4;
+    if (lead == 0xF0) {
+      low = 0x90;
+    } else if (lead == 0xF4) {
+      high = 0x8F;  // Nothing above U+10FFFF
+    }
+  } else {
+    subpart = 1;
+    return 0;
+  }
+
+  size_t k = 1;
+  for (; k < length && k < size; ++k) {
+    if (data[k] < low || data[k] > high) {
+      break;
+    }
+    low = 0x80;
+    high = 0xBF;
+  }
+  if (k == length) {
+    return length;
+  }
+  subpart = k;
+  return 0;
+}
+
+} // namespace
+
+size_t validUtf8Prefix(const char* data, size_t size) {
+  const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+  size_t i = 0;
+  while (i < size) {
+    if (i + sizeof(uint64_t) <= size) {
+      uint64_t word;
+      std::memcpy(&word, bytes + i, sizeof(word));
+      if ((word & kHighBits) == 0) {
+        i += sizeof(uint64_t);
+        continue;
+      }
+    }
+    size_t subpart = 0;
+    size_t length = wellFormedSequenceLength(bytes + i, size - i, subpart);
+    if (length == 0) {
+      return i;
+    }
+    i += length;
+  }
+  return size;
+}
+
+bool isValidUtf8(std::string_view text) {
+  return validUtf8Prefix(text.data(), text.size()) == text.size();
+}
+
+void appendRepairedUtf8(std::string_view text, std::string& out) {
+  const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+  size_t i = 0;
+  while (i < text.size()) {
+    size_t valid = validUtf8Prefix(text.data() + i, text.size() - i);
+    out.append(text.substr(i, valid));
+    i += valid;
+    if (i == text.size()) {
+      break;
+    }
+    size_t subpart = 0;
+    wellFormedSequenceLength(bytes + i, text.size() - i, subpart);
+    out.append(kReplacementCharacter);
+    i += subpart;
+  }
+}
+
+std::string_view ensureValidUtf8(std::string_view text, std::string& repairBuffer) {
+  size_t valid = validUtf8Prefix(text.data(), text.size());
+  if (valid == text.size()) {
+    return text;
+  }
+  repairBuffer.clear();
+  repairBuffer.reserve(text.size() + kReplacementCharacter.size());
+  repairBuffer.append(text.substr(0, valid));
+  appendRepairedUtf8(text.substr(valid), repairBuffer);
+  return repairBuffer;
+}
+
+size_t incompleteUtf8Suffix(std::string_view text) {
+  const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+  // The sequence's lead byte is within the last three bytes
+  size_t limit = text.size() < 3 ? text.size() : 3;
+  for (size_t back = 1; back <= limit; ++back) {
+    size_t start = text.size() - back;
+    if ((bytes[start] & 0xC0) == 0x80) {
+      continue;
+    }
+    size_t subpart = 0;
+    if (wellFormedSequenceLength(bytes + start, back, subpart) == 0 && subpart == back &&
+        bytes[start] >= 0xC2 && bytes[start] <= 0xF4) {
+      return back;
+    }
+    return 0;
+  }
+  return 0;
+}
+
+} // namespace facebook::react::parsing
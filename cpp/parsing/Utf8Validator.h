@@ -0,0 +1,48 @@
+/**
+ * Utf8Validator.h
+ *
+ * UTF-8 validation and repair at the entry of the parsing pipeline.
+ * Markup is checked once before tokenizing; ill-formed sequences are
+ * replaced with U+FFFD, so every later stage (and every fragment string)
+ * can assume valid UTF-8.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace facebook::react::parsing {
+
+/**
+ * Length of the longest valid UTF-8 prefix of data.
+ * ASCII is checked eight bytes per step.
+ */
+size_t validUtf8Prefix(const char* data, size_t size);
+
+/**
+ * Check if text is valid UTF-8.
+ */
+bool isValidUtf8(std::string_view text);
+
+/**
+ * Append text to out, replacing each maximal ill-formed subsequence with
+ * U+FFFD (the Unicode and WHATWG decoder replacement behavior).
+ */
+void appendRepairedUtf8(std::string_view text, std::string& out);
+
+/**
+ * Return text unchanged if it is valid UTF-8; otherwise repair it into
+ * repairBuffer and return that.
+ */
+std::string_view ensureValidUtf8(std::string_view text, std::string& repairBuffer);
+
+/**
+ * Number of bytes at the end of text that start a UTF-8 sequence which is
+ * valid so far but incomplete (0 to 3). Used to carry a code point split
+ * across streamed chunks into the next chunk.
+ */
+size_t incompleteUtf8Suffix(std::string_view text);
+
+} // namespace facebook::react::parsing
@@ -0,0 +1,213 @@
+/**
+ * FabricRichBatchMeasureTests.mm
+ *
+ * Tests for batch measurement of list rows and the measure cache.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricBatchMeasure.h"
+#import "FabricRichTestHelpers.h"
+
+#include <atomic>
+
+using namespace facebook::react;
+
+/**
+ * Measurer returning one line of fixed height per call, counting calls.
+ */
+class CountingTextMeasurer : public TextMeasurer {
+ public:
+  mutable std::atomic<int> calls{0};
+
+  MeasuredText measure(const AttributedString& attributedString, float width, int numberOfLines) const override {
+    calls++;
+    size_t length = 0;
+    for (const auto& fragment : attributedString.getFragments()) {
+      length += fragment.string.size();
+    }
+    return MeasuredText{std::min(width, static_cast<float>(length)), 20, 1};
+  }
+
+  MeasureSource source() const override {
+    return MeasureSource::Platform;
+  }
+
+  float pointScaleFactor() const override {
+    return 3;
+  }
+};
+
+@interface FabricRichBatchMeasureTests : XCTestCase
+@end
+
+@implementation FabricRichBatchMeasureTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (std::vector<FabricBatchMeasure::Item>)itemsWithMarkup:(const std::vector<std::string>&)markup {
+    std::vector<FabricBatchMeasure::Item> items;
+    for (const auto& text : markup) {
+        items.push_back(FabricBatchMeasure::Item{text, 0});
+    }
+    return items;
+}
+
+#pragma mark - Batch Measurement
+
+- (void)testMeasuresEveryItemInOrder {
+    MeasureCache cache;
+    CountingTextMeasurer measurer;
+    auto items = [self itemsWithMarkup:{"<p>abc</p>", "<p>abcdef</p>", "<p>a</p>"}];
+
+    auto results = FabricBatchMeasure::measure(items, 100, FabricRichTestStyleOptions(), measurer, cache);
+
+    XCTAssertEqual(results.size(), 3u);
+    XCTAssertEqual(results[0].width, 3.0f);
+    XCTAssertEqual(results[1].width, 6.0f);
+    XCTAssertEqual(results[2].width, 1.0f);
+    XCTAssertEqual(measurer.calls.load(), 3);
+}
+
+- (void)testEmptyMarkupMeasuresZeroWithoutLayout {
+    MeasureCache cache;
+    CountingTextMeasurer measurer;
+    auto items = [self itemsWithMarkup:{"", "<p>abc</p>"}];
+
+    auto results = FabricBatchMeasure::measure(items, 100, FabricRichTestStyleOptions(), measurer, cache);
+
+    XCTAssertEqual(results[0], MeasuredText{});
+    XCTAssertEqual(results[1].width, 3.0f);
+    XCTAssertEqual(measurer.calls.load(), 1);
+    XCTAssertEqual(cache.size(), 1u);
+}
+
+- (void)testRepeatedBatchIsServedFromCache {
+    MeasureCache cache;
+    CountingTextMeasurer measurer;
+    auto items = [self itemsWithMarkup:{"<p>abc</p>", "<b>bold</b>"}];
+
+    auto first = FabricBatchMeasure::measure(items, 100, FabricRichTestStyleOptions(), measurer, cache);
+    auto second = FabricBatchMeasure::measure(items, 100, FabricRichTestStyleOptions(), measurer, cache);
+
+    XCTAssertEqual(measurer.calls.load(), 2);
+    XCTAssertEqual(first, second);
+    XCTAssertEqual(cache.hits(), 2u);
+}
+
+- (void)testWidthAndStyleAreCacheKeys {
+    MeasureCache cache;
+    CountingTextMeasurer measurer;
+    auto items = [self itemsWithMarkup:{"<p>abc</p>"}];
+    StyleOptions larger = FabricRichTestStyleOptions();
+    larger.baseFontSize = 20.0f;
+
+    FabricBatchMeasure::measure(items, 100, FabricRichTestStyleOptions(), measurer, cache);
+    FabricBatchMeasure::measure(items, 200, FabricRichTestStyleOptions(), measurer, cache);
+    FabricBatchMeasure::measure(items, 100, larger, measurer, cache);
+
+    XCTAssertEqual(measurer.calls.load(), 3);
+    XCTAssertEqual(cache.size(), 3u);
+}
+
+- (void)testMeasuringPopulatesParseCache {
+    MeasureCache cache;
+    CountingTextMeasurer measurer;
+    auto items = [self itemsWithMarkup:{"<p>row one</p>", "<p>row two</p>"}];
+
+    FabricBatchMeasure::measure(items, 100, FabricRichTestStyleOptions(), measurer, cache);
+
+    // Mounting the rows finds their parse results
+    size_t hitsBefore = ParseCache::shared().hits();
+    FabricMarkupParser::parseMarkupWithLinkUrls("<p>row one</p>", FabricRichTestStyleOptions());
+    FabricMarkupParser::parseMarkupWithLinkUrls("<p>row two</p>", FabricRichTestStyleOptions());
+    XCTAssertEqual(ParseCache::shared().hits(), hitsBefore + 2);
+}
+
+- (void)testNumberOfLinesIsPartOfTheKey {
+    MeasureCache cache;
+    CountingTextMeasurer measurer;
+    std::vector<FabricBatchMeasure::Item> items = {
+        {"<p>abc</p>", 0},
+        {"<p>abc</p>", 2},
+    };
+
+    auto results = FabricBatchMeasure::measure(items, 100, FabricRichTestStyleOptions(), measurer, cache);
+
+    XCTAssertEqual(results.size(), 2u);
+    XCTAssertEqual(measurer.calls.load(), 2);
+    XCTAssertEqual(cache.size(), 2u);
+}
+
+- (void)testNegativeNumberOfLinesMeansUnlimited {
+    auto unlimited = FabricBatchMeasure::cacheKey("<p>abc</p>", FabricRichTestStyleOptions(), 100, 0, MeasureSource::Platform, 2);
+    auto negative = FabricBatchMeasure::cacheKey("<p>abc</p>", FabricRichTestStyleOptions(), 100, -1, MeasureSource::Platform, 2);
+    XCTAssertEqual(unlimited, negative);
+}
+
+- (void)testEstimatesAreNotPlatformEntries {
+    MeasureCache cache;
+    EstimatingTextMeasurer measurer;
+    auto items = [self itemsWithMarkup:{"<p>estimated row</p>"}];
+
+    auto results = FabricBatchMeasure::measure(items, 100, FabricRichTestStyleOptions(), measurer, cache);
+    XCTAssertTrue(results[0].height > 0);
+    XCTAssertEqual(results[0].lineCount, 1u);
+
+    auto platformKey = FabricBatchMeasure::cacheKey(
+        "<p>estimated row</p>", FabricRichTestStyleOptions(), 100, 0, MeasureSource::Platform, 1);
+    auto estimateKey = FabricBatchMeasure::cacheKey(
+        "<p>estimated row</p>", FabricRichTestStyleOptions(), 100, 0, MeasureSource::Estimate, 1);
+    XCTAssertFalse(cache.find(platformKey).has_value());
+    XCTAssertTrue(cache.find(estimateKey).has_value());
+}
+
+#pragma mark - Measure Cache
+
+- (void)testCacheEvictsLeastRecentlyUsed {
+    MeasureCache cache(2);
+    MeasureKey a{1, 100}, b{2, 100}, c{3, 100};
+
+    cache.insert(a, MeasuredText{1, 1, 1});
+    cache.insert(b, MeasuredText{2, 2, 1});
+    XCTAssertTrue(cache.find(a).has_value());
+    cache.insert(c, MeasuredText{3, 3, 1});
+
+    XCTAssertEqual(cache.size(), 2u);
+    XCTAssertTrue(cache.find(a).has_value());
+    XCTAssertFalse(cache.find(b).has_value());
+    XCTAssertTrue(cache.find(c).has_value());
+}
+
+- (void)testCacheInsertReplacesEntry {
+    MeasureCache cache;
+    MeasureKey key{1, 100};
+
+    cache.insert(key, MeasuredText{1, 1, 1});
+    cache.insert(key, MeasuredText{2, 2, 2});
+
+    XCTAssertEqual(cache.size(), 1u);
+    XCTAssertEqual(cache.find(key)->height, 2.0f);
+}
+
+#pragma mark - Performance
+
+- (void)testPerformanceCachedBatch {
+    MeasureCache cache;
+    EstimatingTextMeasurer measurer;
+    std::vector<FabricBatchMeasure::Item> items;
+    for (int i = 0; i < 200; ++i) {
+        items.push_back(FabricBatchMeasure::Item{"<p>Row " + std::to_string(i) + " with <b>bold</b> text</p>", 0});
+    }
+    FabricBatchMeasure::measure(items, 320, FabricRichTestStyleOptions(), measurer, cache);
+
+    [self measureBlock:^{
+        FabricBatchMeasure::measure(items, 320, FabricRichTestStyleOptions(), measurer, cache);
+    }];
+}
+
+@end
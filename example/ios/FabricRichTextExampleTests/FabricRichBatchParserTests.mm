@@ -0,0 +1,145 @@
+/**
+ * FabricRichBatchParserTests.mm
+ *
+ * Tests for batch parsing, the parse cache and compiled tag styles.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+
+using namespace facebook::react;
+
+@interface FabricRichBatchParserTests : XCTestCase
+@end
+
+@implementation FabricRichBatchParserTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (std::vector<FabricMarkupParser::BatchItem>)listRows {
+    StyleOptions plain;
+    plain.baseFontSize = 16.0f;
+    StyleOptions styled = plain;
+    styled.tagStyles = "{\"strong\":{\"color\":\"#CC0000\",\"fontSize\":20}}";
+
+    std::vector<FabricMarkupParser::BatchItem> rows;
+    for (int i = 0; i < 40; ++i) {
+        std::string markup = "<p>Row " + std::to_string(i) + " with <strong>bold</strong> and "
+                             "<a href=\"https://example.com/" + std::to_string(i) + "\">link</a></p>";
+        rows.emplace_back(markup, i % 2 == 0 ? plain : styled);
+    }
+    rows.emplace_back("", plain);
+    return rows;
+}
+
+- (void)assertResults:(const std::vector<FabricMarkupParser::ParseResult>&)results
+          matchItems:(const std::vector<FabricMarkupParser::BatchItem>&)items {
+    XCTAssertEqual(results.size(), items.size());
+    for (size_t i = 0; i < items.size() && i < results.size(); ++i) {
+        ParseCache::shared().clear();
+        auto expected = FabricMarkupParser::parseMarkupWithLinkUrls(items[i].first, items[i].second);
+        XCTAssertTrue(results[i].attributedString == expected.attributedString, @"Row %zu differs", i);
+        XCTAssertTrue(results[i].links == expected.links, @"Row %zu links differ", i);
+        XCTAssertTrue(results[i].accessibilityPauses == expected.accessibilityPauses);
+    }
+}
+
+#pragma mark - Batch Parse Tests
+
+- (void)testBatchMatchesIndividualParses {
+    auto rows = [self listRows];
+    auto results = FabricMarkupParser::parseBatch(rows);
+    [self assertResults:results matchItems:rows];
+}
+
+- (void)testBatchOnThreadPoolKeepsOrder {
+    auto rows = [self listRows];
+    parsing::ParseThreadPool pool(3);
+    FabricMarkupParser::BatchOptions batchOptions;
+    batchOptions.pool = &pool;
+
+    auto results = FabricMarkupParser::parseBatch(rows, batchOptions);
+    [self assertResults:results matchItems:rows];
+}
+
+- (void)testBatchPopulatesCacheForLaterMeasurement {
+    auto rows = [self listRows];
+    FabricMarkupParser::parseBatch(rows);
+    size_t hitsBefore = ParseCache::shared().hits();
+
+    // A newly mounted row parses through a fresh session
+    IncrementalParseSession session;
+    FabricMarkupParser::parseMarkupIncremental(session, rows[3].first, rows[3].second);
+
+    XCTAssertEqual(ParseCache::shared().hits(), hitsBefore + 1, @"Prefetched row should be a cache hit");
+    XCTAssertTrue(session.isEmpty(), @"Cache hit should not parse");
+}
+
+- (void)testBatchWithoutCachePopulation {
+    auto rows = [self listRows];
+    FabricMarkupParser::BatchOptions batchOptions;
+    batchOptions.populateCache = false;
+
+    FabricMarkupParser::parseBatch(rows, batchOptions);
+    XCTAssertEqual(ParseCache::shared().size(), 0UL);
+}
+
+#pragma mark - Parse Cache Tests
+
+- (void)testCacheKeyIncludesStyle {
+    parsing::ParseCache cache;
+    StyleOptions options;
+    auto result = std::make_shared<parsing::AttributedStringResult>();
+    cache.insert("<p>Hi</p>", options, result);
+
+    StyleOptions larger = options;
+    larger.baseFontSize = 20.0f;
+    XCTAssertTrue(cache.find("<p>Hi</p>", options) != nullptr);
+    XCTAssertTrue(cache.find("<p>Hi</p>", larger) == nullptr, @"Different style must miss");
+    XCTAssertTrue(cache.find("<p>Hello</p>", options) == nullptr, @"Different markup must miss");
+}
+
+- (void)testCacheEvictsLeastRecentlyUsed {
+    parsing::ParseCache cache(64 * 1024);
+    StyleOptions options;
+    for (int i = 0; i < 1000; ++i) {
+        auto result = std::make_shared<parsing::AttributedStringResult>();
+        AttributedString::Fragment fragment;
+        fragment.string = std::string(100, 'x');
+        result->attributedString.appendFragment(std::move(fragment));
+        cache.insert("<p>" + std::to_string(i) + "</p>", options, result);
+        // Keep the first entry recently used
+        cache.find("<p>0</p>", options);
+    }
+
+    XCTAssertLessThanOrEqual(cache.bytes(), 64UL * 1024);
+    XCTAssertTrue(cache.find("<p>0</p>", options) != nullptr, @"Recently used entry should survive");
+    XCTAssertTrue(cache.find("<p>1</p>", options) == nullptr, @"Old entry should be evicted");
+    XCTAssertTrue(cache.find("<p>999</p>", options) != nullptr);
+}
+
+#pragma mark - Compiled Tag Styles Tests
+
+- (void)testCompiledTagStylesMatchPerTagParsing {
+    std::string tagStyles = "{\"strong\":{\"color\":\"#FF0000\",\"fontWeight\":\"normal\"},"
+                            "\"em\":{\"fontSize\":18,\"textDecorationLine\":\"underline\"},"
+                            "\"p\":{\"color\":\"#00FF00\"}}";
+    parsing::CompiledTagStyles compiled(tagStyles);
+
+    for (const auto& tag : parsing::INLINE_FORMATTING_TAGS) {
+        auto expected = parsing::getStyleFromTagStyles(tagStyles, tag);
+        const auto& actual = compiled.styleFor(tag);
+        XCTAssertEqual(actual.color, expected.color, @"Color differs for %s", tag.c_str());
+        XCTAssertTrue(actual.fontWeight == expected.fontWeight);
+        XCTAssertTrue(actual.textDecorationLine == expected.textDecorationLine);
+        XCTAssertTrue(std::isnan(actual.fontSize) == std::isnan(expected.fontSize));
+    }
+    XCTAssertEqual(compiled.styleFor("").color, 0);
+}
+
+@end
@@ -0,0 +1,114 @@
+/**
+ * FabricRichCompactTextLayoutTests.mm
+ *
+ * Tests for the compact text layout used as the Android state wire format.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+#import "FabricRichTestHelpers.h"
+
+using namespace facebook::react;
+
+@interface FabricRichCompactTextLayoutTests : XCTestCase
+@end
+
+@implementation FabricRichCompactTextLayoutTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (CompactTextLayout)layoutForMarkup:(const std::string&)markup {
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+    return CompactTextLayout(result.attributedString, result.links);
+}
+
+#pragma mark - Layout Tests
+
+- (void)testTextAndRuns {
+    auto layout = [self layoutForMarkup:"<p>plain <strong>bold</strong> plain again</p>"];
+
+    XCTAssertTrue(layout.strings()[0] == "plain bold plain again");
+    XCTAssertEqual(layout.length(), 22U);
+    XCTAssertEqual(layout.styles().size(), 2UL, @"Both plain fragments share one style");
+    XCTAssertEqual(layout.runs().size(), 3UL);
+
+    const auto& runs = layout.runs();
+    XCTAssertEqual(runs[1].start, 6U);
+    XCTAssertEqual(runs[1].length, 4U);
+    XCTAssertEqual(runs[0].style, runs[2].style);
+    XCTAssertNotEqual(runs[0].style, runs[1].style);
+    XCTAssertEqual(layout.styles()[runs[1].style].fontWeight, 700);
+}
+
+- (void)testOffsetsAreUtf16 {
+    auto layout = [self layoutForMarkup:"<p>\xF0\x9F\x98\x80 <em>caf\xC3\xA9</em></p>"];
+
+    XCTAssertEqual(layout.length(), 7U, @"Emoji is a surrogate pair");
+    XCTAssertEqual(layout.runs().back().start, 3U);
+    XCTAssertEqual(layout.runs().back().length, 4U);
+    XCTAssertTrue(layout.styles()[layout.runs().back().style].flags & parsing::CompactTextStyle::Italic);
+}
+
+- (void)testLinksReferenceStringTable {
+    auto layout = [self layoutForMarkup:
+        "<p><a href=\"https://a.example\">one</a> and <a href=\"https://a.example\">two</a></p>"];
+
+    int32_t linked = 0;
+    for (const auto& run : layout.runs()) {
+        if (run.link != -1) {
+            XCTAssertTrue(layout.strings()[run.link] == "https://a.example");
+            linked++;
+        }
+    }
+    XCTAssertEqual(linked, 2, @"Each link is its own run");
+    XCTAssertEqual(layout.strings().size(), 2UL, @"The URL is stored once");
+}
+
+#pragma mark - Wire Format Tests
+
+- (void)testRoundTrip {
+    auto layout = [self layoutForMarkup:
+        "<h1>Title</h1><p>Some <u>underlined</u>, <s>struck</s> and "
+        "<a href=\"https://example.com\">linked</a> text.</p>"];
+    auto bytes = layout.serialize();
+
+    auto decoded = CompactTextLayout::deserialize(bytes.data(), bytes.size());
+    XCTAssertTrue(decoded.has_value());
+    XCTAssertTrue(*decoded == layout);
+}
+
+- (void)testHeader {
+    auto bytes = [self layoutForMarkup:"<p>a</p>"].serialize();
+    XCTAssertTrue(bytes.size() > 12);
+    XCTAssertEqual(bytes[0], 'F');
+    XCTAssertEqual(bytes[1], 'R');
+    XCTAssertEqual(bytes[2], 'T');
+    XCTAssertEqual(bytes[3], 'L');
+    XCTAssertEqual(bytes[4], CompactTextLayout::kVersion);
+    XCTAssertEqual(bytes[5], 0);
+}
+
+- (void)testRejectsMalformedBuffers {
+    auto bytes = [self layoutForMarkup:"<p>a <b>b</b> <a href=\"https://example.com\">c</a></p>"].serialize();
+
+    for (size_t size = 0; size < bytes.size(); ++size) {
+        XCTAssertFalse(CompactTextLayout::deserialize(bytes.data(), size).has_value(),
+                       @"Truncated to %zu bytes", size);
+    }
+
+    auto otherVersion = bytes;
+    otherVersion[4] = CompactTextLayout::kVersion + 1;
+    XCTAssertFalse(CompactTextLayout::deserialize(otherVersion.data(), otherVersion.size()).has_value());
+
+    // Point the last run's style past the style table
+    auto badStyle = bytes;
+    badStyle[badStyle.size() - 8] = 0xFF;
+    XCTAssertFalse(CompactTextLayout::deserialize(badStyle.data(), badStyle.size()).has_value());
+}
+
+@end
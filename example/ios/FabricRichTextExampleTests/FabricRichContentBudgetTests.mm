@@ -0,0 +1,167 @@
+/**
+ * FabricRichContentBudgetTests.mm
+ *
+ * Tests for parsing numberOfLines previews within a line budget.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+#import "../../../cpp/FabricPreparedMarkup.h"
+#import "FabricRichTestHelpers.h"
+
+using namespace facebook::react;
+
+@interface FabricRichContentBudgetTests : XCTestCase
+@end
+
+@implementation FabricRichContentBudgetTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (std::string)articleWithParagraphs:(int)count {
+    std::string markup;
+    for (int i = 0; i < count; i++) {
+        markup += "<p>Paragraph " + std::to_string(i) +
+            " of a long article, with <strong>bold</strong> and <a href=\"https://example.com/" +
+            std::to_string(i) + "\">linked</a> text.</p>";
+    }
+    return markup;
+}
+
+#pragma mark - Budget Tests
+
+- (void)testForLinesAddsMargin {
+    auto budget = ContentBudget::forLines(3, 320);
+    XCTAssertFalse(budget.isUnlimited());
+    XCTAssertTrue(budget.lines > 3);
+    XCTAssertEqual(budget.width, 320.0f);
+
+    XCTAssertTrue(ContentBudget::forLines(0, 320).isUnlimited());
+    XCTAssertTrue(std::isinf(ContentBudget::forLines(2, NAN).width));
+}
+
+- (void)testCovers {
+    auto small = ContentBudget::forLines(2, 200);
+    auto large = ContentBudget::forLines(5, 200);
+    auto wide = ContentBudget::forLines(2, 400);
+
+    XCTAssertTrue(large.covers(small));
+    XCTAssertFalse(small.covers(large));
+    XCTAssertTrue(wide.covers(small), @"A wider view fits more per line");
+    XCTAssertFalse(small.covers(wide));
+    XCTAssertTrue(ContentBudget{}.covers(small));
+    XCTAssertFalse(small.covers(ContentBudget{}));
+}
+
+#pragma mark - Budgeted Parse Tests
+
+- (void)testLongDocumentIsTruncated {
+    auto markup = [self articleWithParagraphs:500];
+    auto preview = FabricMarkupParser::parseMarkupWithinBudget(
+        markup, FabricRichTestStyleOptions(), ContentBudget::forLines(2, 320));
+    XCTAssertTrue(preview.isTruncated);
+
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+    XCTAssertFalse(full.isTruncated);
+
+    auto previewText = preview.attributedString.getString();
+    auto fullText = full.attributedString.getString();
+    XCTAssertTrue(previewText.size() < fullText.size() / 10);
+    XCTAssertTrue(previewText.size() > 0);
+
+    // The leading lines match the full text; only the last, still open
+    // paragraph of the prefix may differ
+    auto firstBreak = fullText.find('\n');
+    XCTAssertTrue(previewText.compare(0, firstBreak + 1, fullText, 0, firstBreak + 1) == 0);
+    XCTAssertFalse(preview.links.empty());
+}
+
+- (void)testTruncatedResultIsNotCached {
+    auto markup = [self articleWithParagraphs:500];
+    FabricMarkupParser::parseMarkupWithinBudget(markup, FabricRichTestStyleOptions(), ContentBudget::forLines(2, 320));
+
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+    XCTAssertFalse(full.isTruncated);
+    XCTAssertTrue(full.attributedString.getString().find("Paragraph 499") != std::string::npos);
+}
+
+- (void)testShortDocumentIsComplete {
+    std::string markup = "<p>Short <em>text</em></p>";
+    auto preview = FabricMarkupParser::parseMarkupWithinBudget(
+        markup, FabricRichTestStyleOptions(), ContentBudget::forLines(2, 320));
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+
+    XCTAssertFalse(preview.isTruncated);
+    XCTAssertTrue(preview.attributedString == full.attributedString);
+}
+
+- (void)testUnlimitedBudgetParsesEverything {
+    auto markup = [self articleWithParagraphs:50];
+    auto result = FabricMarkupParser::parseMarkupWithinBudget(markup, FabricRichTestStyleOptions(), ContentBudget{});
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+
+    XCTAssertFalse(result.isTruncated);
+    XCTAssertTrue(result.attributedString == full.attributedString);
+}
+
+- (void)testNegativeLetterSpacingParsesMore {
+    auto markup = [self articleWithParagraphs:500];
+    auto options = FabricRichTestStyleOptions();
+    auto budget = ContentBudget{1, 50};
+    auto normal = FabricMarkupParser::parseMarkupWithinBudget(markup, options, budget);
+    options.letterSpacing = -2.0f;
+    auto tight = FabricMarkupParser::parseMarkupWithinBudget(markup, options, budget);
+
+    XCTAssertTrue(tight.isTruncated);
+    XCTAssertTrue(tight.attributedString.getString().size() >= normal.attributedString.getString().size(),
+                  @"Tighter glyphs fit more text per line");
+}
+
+- (void)testTruncatedUtf8IsRepairedLikeFullParse {
+    std::string paragraph = "<p>Caf\xC3\xA9 na\xC3\xAFve \xE2\x80\x94 stra\xC3\x9F" "e \xF0\x9F\x98\x80 bad \xC3(</p>";
+    std::string markup;
+    for (int i = 0; i < 400; i++) {
+        markup += paragraph;
+    }
+    auto preview = FabricMarkupParser::parseMarkupWithinBudget(
+        markup, FabricRichTestStyleOptions(), ContentBudget::forLines(3, 200));
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+
+    XCTAssertTrue(preview.isTruncated);
+    auto previewText = preview.attributedString.getString();
+    auto fullText = full.attributedString.getString();
+    auto lastBreak = previewText.rfind('\n');
+    XCTAssertTrue(lastBreak != std::string::npos);
+    XCTAssertTrue(previewText.compare(0, lastBreak + 1, fullText, 0, lastBreak + 1) == 0,
+                  @"Chunk boundaries don't split code points");
+}
+
+#pragma mark - Prepared Markup Tests
+
+- (void)testPreparedMarkupReparsesForLargerBudget {
+    auto markup = [self articleWithParagraphs:500];
+    auto session = std::make_shared<IncrementalParseSession>();
+    auto prepared = FabricPreparedMarkup::prepare(nullptr, session, markup, FabricRichTestStyleOptions(), 2);
+    XCTAssertTrue(prepared->matches(markup, FabricRichTestStyleOptions(), 2));
+    XCTAssertFalse(prepared->matches(markup, FabricRichTestStyleOptions(), 0));
+
+    auto preview = prepared->resolve(FabricRichTestStyleOptions(), false, ContentBudget::forLines(2, 320));
+    XCTAssertTrue(preview->isTruncated);
+
+    auto same = prepared->resolve(FabricRichTestStyleOptions(), false, ContentBudget::forLines(1, 320));
+    XCTAssertTrue(same->attributedString == preview->attributedString, @"A smaller budget reuses the prefix");
+
+    auto larger = prepared->resolve(FabricRichTestStyleOptions(), false, ContentBudget::forLines(20, 320));
+    XCTAssertTrue(larger->attributedString.getString().size() > preview->attributedString.getString().size());
+
+    auto full = prepared->resolve(FabricRichTestStyleOptions(), false, ContentBudget{});
+    XCTAssertFalse(full->isTruncated);
+    XCTAssertTrue(full->attributedString.getString().find("Paragraph 499") != std::string::npos);
+}
+
+@end
@@ -0,0 +1,121 @@
+/**
+ * FabricRichDocumentSummaryTests.mm
+ *
+ * Tests for the per-document feature summary of parse results.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+
+#include <algorithm>
+#include <string>
+
+using namespace facebook::react;
+
+@interface FabricRichDocumentSummaryTests : XCTestCase
+@end
+
+@implementation FabricRichDocumentSummaryTests {
+    ParseLimits _savedLimits;
+}
+
+- (void)setUp {
+    [super setUp];
+    _savedLimits = parsing::parseLimits();
+    ParseCache::shared().clear();
+}
+
+- (void)tearDown {
+    parsing::setParseLimits(_savedLimits);
+    ParseCache::shared().clear();
+    [super tearDown];
+}
+
+#pragma mark - Helper Methods
+
+- (DocumentSummary)summaryOf:(const std::string&)markup {
+    return FabricMarkupParser::parseMarkupWithLinkUrls(markup, StyleOptions{}).summary;
+}
+
+- (std::string)paragraphs:(int)count {
+    std::string markup;
+    for (int i = 0; i < count; i++) {
+        markup += "<p>Paragraph <b>" + std::to_string(i) + "</b> text</p>";
+    }
+    return markup;
+}
+
+#pragma mark - Feature Tests
+
+- (void)testPlainTextHasNoFeatures {
+    auto summary = [self summaryOf:"<p>Hello <b>world</b></p>"];
+    XCTAssertEqual(summary.features, 0);
+    XCTAssertEqual(summary.maxHeadingLevel, 0);
+    XCTAssertEqual(summary.linkCount, 0u);
+}
+
+- (void)testLinksAreCounted {
+    auto summary = [self summaryOf:"<p><a href=\"https://a.com\">One</a> and <a href=\"https://b.com\">two</a></p>"];
+    XCTAssertTrue(summary.has(DocumentFeature::Links));
+    XCTAssertEqual(summary.linkCount, 2u);
+}
+
+- (void)testBidiFromTextAndMarkup {
+    XCTAssertTrue([self summaryOf:"<p>שלום</p>"].has(DocumentFeature::Bidi));
+    XCTAssertTrue([self summaryOf:"<p dir=\"rtl\">Hello</p>"].has(DocumentFeature::Bidi));
+    XCTAssertTrue([self summaryOf:"<p>User <bdi>name</bdi></p>"].has(DocumentFeature::Bidi));
+    XCTAssertFalse([self summaryOf:"<p>Café naïve</p>"].has(DocumentFeature::Bidi));
+}
+
+- (void)testListsAndHeadings {
+    auto summary = [self summaryOf:"<h3>Title</h3><h2>Sub</h2><ol><li>One</li></ol>"];
+    XCTAssertTrue(summary.has(DocumentFeature::Lists));
+    XCTAssertEqual(summary.maxHeadingLevel, 3);
+}
+
+- (void)testFragmentsAndBytes {
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls("<p>Hello <b>world</b></p>", StyleOptions{});
+    XCTAssertEqual(result.summary.fragmentCount, result.attributedString.getFragments().size());
+    XCTAssertEqual(result.summary.textBytes, result.attributedString.getString().size());
+}
+
+#pragma mark - Truncation and Limits
+
+- (void)testBudgetedParseIsTruncated {
+    auto result = FabricMarkupParser::parseMarkupWithinBudget(
+        [self paragraphs:500], StyleOptions{}, ContentBudget::forLines(2, 320));
+    XCTAssertTrue(result.isTruncated);
+    XCTAssertTrue(result.summary.has(DocumentFeature::Truncated));
+}
+
+- (void)testLimitHitIsDegraded {
+    ParseLimits limits;
+    limits.maxTags = 10;
+    parsing::setParseLimits(limits);
+    auto summary = [self summaryOf:[self paragraphs:20]];
+    XCTAssertTrue(summary.has(DocumentFeature::Degraded));
+    XCTAssertFalse(summary.has(DocumentFeature::Truncated));
+}
+
+#pragma mark - Incremental Tests
+
+- (void)testStreamedSummaryMatchesFullParse {
+    std::string markup = "<h1>Chat</h1>" + [self paragraphs:40] +
+        "<ul><li><a href=\"https://a.com\">Link</a></li></ul><p>שלום</p>";
+
+    IncrementalParseSession session;
+    FabricMarkupParser::ParseResult streamed;
+    for (size_t length = 64; length < markup.size() + 64; length += 64) {
+        streamed = FabricMarkupParser::parseMarkupIncremental(
+            session, markup.substr(0, std::min(length, markup.size())), StyleOptions{});
+    }
+    ParseCache::shared().clear();
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(markup, StyleOptions{});
+    XCTAssertTrue(streamed.summary == full.summary);
+    XCTAssertTrue(full.summary.has(DocumentFeature::Links));
+    XCTAssertTrue(full.summary.has(DocumentFeature::Bidi));
+    XCTAssertTrue(full.summary.has(DocumentFeature::Lists));
+    XCTAssertEqual(full.summary.maxHeadingLevel, 1);
+}
+
+@end
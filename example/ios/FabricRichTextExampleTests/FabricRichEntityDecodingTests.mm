@@ -0,0 +1,151 @@
+/**
+ * FabricRichEntityDecodingTests.mm
+ *
+ * Tests for character reference decoding in the shared C++ tokenizer.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+#import "../../../cpp/parsing/HtmlEntities.h"
+#import "../../../cpp/parsing/MarkupScanner.h"
+
+using namespace facebook::react;
+
+@interface FabricRichEntityDecodingTests : XCTestCase
+@end
+
+@implementation FabricRichEntityDecodingTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (std::string)segmentText:(const std::string&)markup {
+    std::string text;
+    for (const auto& segment : FabricMarkupParser::parseMarkupToSegments(markup)) {
+        text += segment.text;
+    }
+    return text;
+}
+
+#pragma mark - Named Reference Tests
+
+- (void)testDecodesNamedReferences {
+    XCTAssertTrue([self segmentText:"<p>Fish &amp; chips</p>"] == "Fish & chips\n");
+    XCTAssertTrue([self segmentText:"<p>&lt;b&gt;</p>"] == "<b>\n");
+    XCTAssertTrue([self segmentText:"<p>&hearts;&rarr;&Omega;</p>"] == "\xE2\x99\xA5\xE2\x86\x92\xCE\xA9\n");
+    XCTAssertTrue([self segmentText:"<p>&nbsp;</p>"] == "\xC2\xA0\n", @"&nbsp; is U+00A0");
+}
+
+- (void)testDecodesTwoCodePointReferences {
+    // &NotEqualTilde; is U+2242 U+0338
+    XCTAssertTrue([self segmentText:"<p>&NotEqualTilde;</p>"] == "\xE2\x89\x82\xCC\xB8\n");
+}
+
+- (void)testUsesLongestMatchAndLegacyNames {
+    // "not" is a legacy name; "notin;" is a longer match
+    XCTAssertTrue([self segmentText:"<p>&notin;</p>"] == "\xE2\x88\x89\n");
+    XCTAssertTrue([self segmentText:"<p>&noti;</p>"] == "\xC2\xACi;\n");
+    XCTAssertTrue([self segmentText:"<p>&copy 2026</p>"] == "\xC2\xA9 2026\n");
+}
+
+- (void)testLeavesUnknownReferencesAsText {
+    XCTAssertTrue([self segmentText:"<p>AT&T &unknown; & &;</p>"] == "AT&T &unknown; & &;\n");
+    XCTAssertTrue([self segmentText:"<p>&Hscr</p>"] == "&Hscr\n", @"Only legacy names may omit ';'");
+}
+
+#pragma mark - Numeric Reference Tests
+
+- (void)testDecodesNumericReferences {
+    XCTAssertTrue([self segmentText:"<p>&#65;&#x42;&#X43;</p>"] == "ABC\n");
+    XCTAssertTrue([self segmentText:"<p>&#128512;</p>"] == "\xF0\x9F\x98\x80\n");
+    XCTAssertTrue([self segmentText:"<p>&#65x</p>"] == "Ax\n", @"';' is optional");
+    XCTAssertTrue([self segmentText:"<p>&#;&#x;</p>"] == "&#;&#x;\n");
+}
+
+- (void)testReplacesInvalidCodePoints {
+    std::string replacement = "\xEF\xBF\xBD";
+    XCTAssertTrue([self segmentText:"<p>&#0;</p>"] == replacement + "\n");
+    XCTAssertTrue([self segmentText:"<p>&#xD800;</p>"] == replacement + "\n");
+    XCTAssertTrue([self segmentText:"<p>&#x110000;</p>"] == replacement + "\n");
+    XCTAssertTrue([self segmentText:"<p>&#99999999999999999999;</p>"] == replacement + "\n");
+    // C1 controls are read as Windows-1252
+    XCTAssertTrue([self segmentText:"<p>&#150;&#x80;</p>"] == "\xE2\x80\x93\xE2\x82\xAC\n");
+}
+
+#pragma mark - Attribute Tests
+
+- (void)testDecodesHrefBeforeCheckingScheme {
+    auto result = FabricMarkupParser::parseMarkupToSegments(
+        "<a href=\"/search?q=1&amp;lang=en&copy=2\">link</a>");
+    XCTAssertEqual(result.size(), 1UL);
+    XCTAssertTrue(result[0].linkUrl == "/search?q=1&lang=en&copy=2",
+                  @"Legacy names followed by '=' are kept in attributes");
+
+    auto blocked = FabricMarkupParser::parseMarkupToSegments(
+        "<a href=\"javascript&colon;alert(1)\">link</a>");
+    XCTAssertTrue(blocked[0].linkUrl.empty(), @"Decoded scheme is checked against the allowlist");
+}
+
+#pragma mark - Streaming Tests
+
+- (void)testReferencesSplitAcrossChunks {
+    std::string markup = "<p dir=\"auto\">&#x5D0; &amp;&notin; &#128512;&copy</p><p>&NotEqualTilde;</p>";
+    auto expected = FabricMarkupParser::parseMarkupToSegments(markup);
+
+    for (size_t chunkSize : {1UL, 2UL, 3UL, 5UL}) {
+        parsing::MarkupSegmentParser parser;
+        for (size_t pos = 0; pos < markup.size(); pos += chunkSize) {
+            parser.feed(std::string_view(markup).substr(pos, chunkSize));
+        }
+        parser.finish();
+
+        XCTAssertEqual(parser.segments().size(), expected.size());
+        for (size_t i = 0; i < expected.size() && i < parser.segments().size(); ++i) {
+            XCTAssertTrue(parser.segments()[i].text == expected[i].text,
+                          @"Chunk size %zu segment %zu differs", chunkSize, i);
+            XCTAssertEqual(parser.segments()[i].writingDirection, expected[i].writingDirection);
+        }
+    }
+}
+
+- (void)testReferenceDecidesAutoDirection {
+    auto segments = FabricMarkupParser::parseMarkupToSegments("<p dir=\"auto\">&#x5D0;bc</p>");
+    XCTAssertEqual(segments.size(), 1UL);
+    XCTAssertEqual(segments[0].writingDirection, WritingDirection::RightToLeft);
+}
+
+- (void)testPartialReferenceNeedsMoreInput {
+    parsing::CharacterReference reference;
+    XCTAssertFalse(parsing::matchCharacterReference("&no", 3, false, false, reference));
+    XCTAssertTrue(parsing::matchCharacterReference("&no", 3, true, false, reference));
+    XCTAssertEqual(reference.length, 0UL);
+    XCTAssertTrue(parsing::matchCharacterReference("&not ", 5, false, false, reference));
+    XCTAssertEqual(reference.length, 4UL);
+}
+
+#pragma mark - Plain Text Tests
+
+- (void)testStripMarkupTagsDecodesAllReferences {
+    XCTAssertTrue(FabricMarkupParser::stripMarkupTags("<p>a &amp; b &eacute; &#x41;</p>") ==
+                  "a & b \xC3\xA9 A");
+}
+
+#pragma mark - Scanner Tests
+
+- (void)testFindTextDelimiter {
+    std::string text(100, 'a');
+    XCTAssertEqual(parsing::findTextDelimiter(text.data(), text.size()), 100UL);
+    for (char delimiter : {'<', '>', '&'}) {
+        for (size_t pos : {0UL, 7UL, 8UL, 63UL, 99UL}) {
+            std::string withDelimiter = text;
+            withDelimiter[pos] = delimiter;
+            XCTAssertEqual(parsing::findTextDelimiter(withDelimiter.data(), withDelimiter.size()), pos);
+        }
+    }
+}
+
+@end
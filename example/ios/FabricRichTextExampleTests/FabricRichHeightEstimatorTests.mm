@@ -0,0 +1,239 @@
+/**
+ * FabricRichHeightEstimatorTests.mm
+ *
+ * Tests for the platform-independent size estimator, and its error
+ * against UIKit measurements.
+ */
+
+#import <XCTest/XCTest.h>
+#import <UIKit/UIKit.h>
+#import "../../../ios/FabricRichFragmentParser.h"
+#import "../../../cpp/FabricMarkupParser.h"
+#import "FabricRichTestHelpers.h"
+
+using namespace facebook::react;
+
+@interface FabricRichHeightEstimatorTests : XCTestCase
+@end
+
+@implementation FabricRichHeightEstimatorTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+/**
+ * Estimator whose default font is monospaced at half an em, so line
+ * breaks can be worked out by hand.
+ */
+- (HeightEstimator)monospaceEstimator {
+    HeightEstimator estimator;
+    estimator.setTable("", AdvanceWidthTable::monospace(0.5f));
+    return estimator;
+}
+
+- (AttributedString)textWithFragments:(const std::vector<std::pair<std::string, float>>&)fragments {
+    return [self textWithFragments:fragments attributes:TextAttributes::defaultTextAttributes()];
+}
+
+- (AttributedString)textWithFragments:(const std::vector<std::pair<std::string, float>>&)fragments
+                           attributes:(const TextAttributes&)attributes {
+    AttributedString attributedString;
+    for (const auto& [text, fontSize] : fragments) {
+        AttributedString::Fragment fragment;
+        fragment.string = text;
+        fragment.textAttributes = attributes;
+        fragment.textAttributes.fontSize = fontSize;
+        fragment.textAttributes.lineHeight = fontSize + 4;
+        attributedString.appendFragment(std::move(fragment));
+    }
+    return attributedString;
+}
+
+/**
+ * Advance widths of the system font, read from UIKit.
+ */
+- (AdvanceWidthTable)systemFontTable {
+    UIFont *font = [UIFont systemFontOfSize:100];
+    NSDictionary *attributes = @{NSFontAttributeName: font};
+    AdvanceWidthTable table = AdvanceWidthTable::systemDefault();
+    for (unichar c = 0x20; c < 0x7F; c++) {
+        NSString *glyph = [NSString stringWithCharacters:&c length:1];
+        table.ascii[c - 0x20] = [glyph sizeWithAttributes:attributes].width / 100.0f;
+    }
+    table.lineHeight = font.lineHeight / 100.0f;
+    return table;
+}
+
+#pragma mark - Line Breaking Tests
+
+- (void)testEmptyText {
+    auto estimate = [self monospaceEstimator].estimate(AttributedString{}, 100);
+    XCTAssertEqual(estimate.lineCount, 0UL);
+    XCTAssertEqual(estimate.height, 0.0f);
+}
+
+- (void)testSingleLine {
+    // 10 characters at 16 * 0.5 = 8pt each
+    auto estimate = [self monospaceEstimator].estimate([self textWithFragments:{{"Hello text", 16}}], 100);
+    XCTAssertEqual(estimate.lineCount, 1UL);
+    XCTAssertEqual(estimate.width, 80.0f);
+    XCTAssertEqual(estimate.height, 20.0f);
+}
+
+- (void)testWrapsAtWordBoundary {
+    // "aaaa bbbb cccc" at 8pt per character: 10 characters fit in 80pt
+    auto estimate = [self monospaceEstimator].estimate([self textWithFragments:{{"aaaa bbbb cccc", 16}}], 80);
+    XCTAssertEqual(estimate.lineCount, 2UL);
+    XCTAssertEqual(estimate.width, 72.0f, @"Trailing spaces don't count");
+    XCTAssertEqual(estimate.height, 40.0f);
+}
+
+- (void)testBreaksWordsWiderThanLine {
+    auto estimate = [self monospaceEstimator].estimate([self textWithFragments:{{"abcdefghijklmnopqrst", 16}}], 80);
+    XCTAssertEqual(estimate.lineCount, 2UL);
+    XCTAssertEqual(estimate.width, 80.0f);
+}
+
+- (void)testBreaksAfterHyphen {
+    auto estimate = [self monospaceEstimator].estimate([self textWithFragments:{{"well-known words", 16}}], 48);
+    XCTAssertEqual(estimate.lineCount, 3UL, @"well- / known / words");
+}
+
+- (void)testLineBreaksStartLines {
+    auto estimate = [self monospaceEstimator].estimate(
+        [self textWithFragments:{{"One\n", 16}, {"\n", 16}, {"Two", 16}}], 1000);
+    XCTAssertEqual(estimate.lineCount, 3UL, @"An empty paragraph is a line");
+    XCTAssertEqual(estimate.height, 60.0f);
+}
+
+- (void)testLineIsAsTallAsTallestFragment {
+    auto estimate = [self monospaceEstimator].estimate(
+        [self textWithFragments:{{"Heading ", 32}, {"small\n", 12}, {"Body", 16}}], 1000);
+    XCTAssertEqual(estimate.lineCount, 2UL);
+    XCTAssertEqual(estimate.height, 36.0f + 20.0f);
+}
+
+- (void)testNumberOfLinesLimitsHeight {
+    auto text = [self textWithFragments:{{"aaaa bbbb cccc dddd eeee ffff", 16}}];
+    auto full = [self monospaceEstimator].estimate(text, 40);
+    auto limited = [self monospaceEstimator].estimate(text, 40, 2);
+
+    XCTAssertEqual(full.lineCount, 6UL);
+    XCTAssertEqual(limited.lineCount, 6UL);
+    XCTAssertEqual(limited.visibleLineCount, 2UL);
+    XCTAssertEqual(limited.height, 40.0f);
+}
+
+- (void)testLetterSpacingWidensText {
+    auto text = [self textWithFragments:{{"aaaa bbbb", 16}}];
+    auto attributes = TextAttributes::defaultTextAttributes();
+    attributes.letterSpacing = 2;
+    auto spaced = [self textWithFragments:{{"aaaa bbbb", 16}} attributes:attributes];
+    XCTAssertEqual([self monospaceEstimator].estimate(text, 80).lineCount, 1UL);
+    XCTAssertEqual([self monospaceEstimator].estimate(spaced, 80).lineCount, 2UL);
+}
+
+- (void)testEastAsianTextBreaksBetweenCharacters {
+    // Wide characters are 16pt each: five fit in 80pt
+    auto estimate = [self monospaceEstimator].estimate(
+        [self textWithFragments:{{"漢字漢字漢字漢字", 16}}], 80);
+    XCTAssertEqual(estimate.lineCount, 2UL);
+}
+
+- (void)testFontFamilyTables {
+    auto attributes = TextAttributes::defaultTextAttributes();
+    attributes.fontFamily = "Wide";
+    auto text = [self textWithFragments:{{"aaaa bbbb", 16}} attributes:attributes];
+    auto estimator = [self monospaceEstimator];
+    XCTAssertEqual(estimator.estimate(text, 80).lineCount, 1UL);
+    estimator.setTable("Wide", AdvanceWidthTable::monospace(1.0f));
+    XCTAssertEqual(estimator.estimate(text, 80).lineCount, 2UL);
+}
+
+#pragma mark - Markup Tests
+
+- (void)testEstimateSizeOfMarkup {
+    HeightEstimator estimator;
+    auto oneLine = FabricMarkupParser::estimateSize("<p>Short</p>", FabricRichTestStyleOptions(), 320, 0, estimator);
+    auto twoParagraphs = FabricMarkupParser::estimateSize(
+        "<p>Short</p><p>Second</p>", FabricRichTestStyleOptions(), 320, 0, estimator);
+    auto heading = FabricMarkupParser::estimateSize("<h1>Short</h1>", FabricRichTestStyleOptions(), 320, 0, estimator);
+
+    XCTAssertEqual(oneLine.lineCount, 1UL);
+    XCTAssertEqual(twoParagraphs.lineCount, 2UL);
+    XCTAssertTrue(heading.height > oneLine.height, @"Headings use the builder's larger font size");
+}
+
+- (void)testEstimateSizeWithNumberOfLines {
+    std::string markup;
+    for (int i = 0; i < 200; i++) {
+        markup += "<p>Paragraph " + std::to_string(i) + " of a long article.</p>";
+    }
+    HeightEstimator estimator;
+    auto preview = FabricMarkupParser::estimateSize(markup, FabricRichTestStyleOptions(), 320, 3, estimator);
+
+    XCTAssertEqual(preview.visibleLineCount, 3UL);
+    XCTAssertTrue(preview.lineCount >= 3);
+    XCTAssertEqual(preview.height, 3 * (16.0f + parsing::LINE_HEIGHT_BUFFER_DEFAULT));
+}
+
+#pragma mark - Accuracy Tests
+
+- (void)testErrorAgainstUIKit {
+    std::vector<std::string> documents = {
+        "<p>The quick brown fox jumps over the lazy dog.</p>",
+        "<p>Rich text with <strong>bold</strong>, <em>italic</em> and <a href=\"https://example.com\">links</a> "
+        "that wraps across a few lines when the column is narrow enough.</p>",
+        "<h2>Release notes</h2><p>Parsing is faster and uses less memory.</p>"
+        "<ul><li>Incremental parsing</li><li>Parse cache</li></ul>",
+        "<p>Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore "
+        "et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris.</p>",
+    };
+    HeightEstimator estimator;
+    estimator.setTable("", [self systemFontTable]);
+
+    HeightEstimateError error;
+    for (CGFloat width : {160.0, 240.0, 320.0, 414.0}) {
+        for (const auto& markup : documents) {
+            auto result = FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+            NSAttributedString *text =
+                [FabricRichFragmentParser buildAttributedStringFromCppAttributedString:result.attributedString];
+            CGRect measured = [text boundingRectWithSize:CGSizeMake(width, CGFLOAT_MAX)
+                                                 options:NSStringDrawingUsesLineFragmentOrigin
+                                                 context:nil];
+            auto estimate = estimator.estimate(result.attributedString, width);
+            error.add(estimate.height, ceil(measured.size.height));
+        }
+    }
+
+    NSLog(@"Height estimate error over %zu layouts: mean %.2fpt (%.1f%%), max %.1f%%, bias %+.2fpt",
+          error.count(), error.meanAbsolute(), error.meanRelative() * 100, error.maxRelative() * 100,
+          error.meanSigned());
+    XCTAssertLessThan(error.meanRelative(), 0.15);
+}
+
+#pragma mark - Performance Tests
+
+- (void)testPerformance_EstimateRows {
+    std::vector<AttributedString> rows;
+    for (int i = 0; i < 100; i++) {
+        rows.push_back(FabricMarkupParser::parseMarkupWithLinkUrls(
+            "<p>Row " + std::to_string(i) + " with <strong>bold</strong> and <em>italic</em> text that wraps.</p>",
+            FabricRichTestStyleOptions()).attributedString);
+    }
+    HeightEstimator estimator;
+
+    [self measureBlock:^{
+        for (int pass = 0; pass < 20; pass++) {
+            for (const auto& row : rows) {
+                estimator.estimate(row, 240);
+            }
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,250 @@
+/**
+ * FabricRichIncrementalParserTests.mm
+ *
+ * Tests for resumable and incremental parsing in the shared C++ parser.
+ * Every incremental result must match a full parse of the same markup.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+#import "FabricRichTestHelpers.h"
+
+using namespace facebook::react;
+
+@interface FabricRichIncrementalParserTests : XCTestCase
+@end
+
+@implementation FabricRichIncrementalParserTests
+
+#pragma mark - Helper Methods
+
+- (void)assertResult:(const FabricMarkupParser::ParseResult&)actual
+      matchesResult:(const FabricMarkupParser::ParseResult&)expected
+             markup:(const std::string&)markup {
+    XCTAssertTrue(actual.attributedString == expected.attributedString,
+                  @"Fragments differ for '%s'", markup.c_str());
+    XCTAssertTrue(actual.links == expected.links,
+                  @"Link URLs differ for '%s'", markup.c_str());
+    XCTAssertTrue(actual.accessibilityPauses == expected.accessibilityPauses,
+                  @"Accessibility labels differ for '%s'", markup.c_str());
+}
+
+- (std::string)streamedDocument {
+    return "<h2>Answer</h2>"
+           "<p>Use <strong>bold</strong> and <a href=\"https://example.com\">links</a>.</p>\n"
+           "<ol><li>First step</li><li>Second <em>step</em></li></ol>\n"
+           "<p dir=\"auto\">שלום <bdi>مرحبا</bdi> world</p>"
+           "<ul><li>Nested<ul><li>Inner</li></ul></li></ul>";
+}
+
+#pragma mark - Streaming Update Tests
+
+- (void)testStreamedPrefixesMatchFullParse {
+    std::string document = [self streamedDocument];
+    StyleOptions options = FabricRichTestStyleOptions();
+    IncrementalParseSession session;
+
+    for (size_t length = 1; length <= document.size(); ++length) {
+        std::string prefix = document.substr(0, length);
+        auto incremental = FabricMarkupParser::parseMarkupIncremental(session, prefix, options);
+        auto full = FabricMarkupParser::parseMarkupWithLinkUrls(prefix, options);
+        [self assertResult:incremental matchesResult:full markup:prefix];
+    }
+}
+
+- (void)testAppendResumesFromPreviousParse {
+    StyleOptions options = FabricRichTestStyleOptions();
+    IncrementalParseSession session;
+
+    FabricMarkupParser::parseMarkupIncremental(session, "<p>Hello</p>", options);
+    XCTAssertFalse(session.lastUpdateResumed(), @"First parse cannot resume");
+
+    FabricMarkupParser::parseMarkupIncremental(session, "<p>Hello</p><p>World", options);
+    XCTAssertTrue(session.lastUpdateResumed(), @"Appended text should resume");
+}
+
+- (void)testNonPrefixUpdateStartsOver {
+    StyleOptions options = FabricRichTestStyleOptions();
+    IncrementalParseSession session;
+
+    FabricMarkupParser::parseMarkupIncremental(session, "<p>Hello world</p>", options);
+    auto result = FabricMarkupParser::parseMarkupIncremental(session, "<p>Goodbye</p>", options);
+
+    XCTAssertFalse(session.lastUpdateResumed(), @"Edited text should start over");
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls("<p>Goodbye</p>", options);
+    [self assertResult:result matchesResult:full markup:"<p>Goodbye</p>"];
+}
+
+- (void)testStyleChangeRebuildsFragments {
+    StyleOptions options = FabricRichTestStyleOptions();
+    IncrementalParseSession session;
+    FabricMarkupParser::parseMarkupIncremental(session, "<p>One</p><p>Two</p>", options);
+
+    options.fontSizeMultiplier = 2.0f;
+    auto result = FabricMarkupParser::parseMarkupIncremental(session, "<p>One</p><p>Two</p><p>Three</p>", options);
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls("<p>One</p><p>Two</p><p>Three</p>", options);
+
+    [self assertResult:result matchesResult:full markup:"font scale change"];
+}
+
+#pragma mark - Block Edit Tests
+
+- (std::string)articleWithMiddle:(const std::string&)middle {
+    std::string article;
+    for (int i = 0; i < 50; ++i) {
+        article += "<p>Paragraph <strong>" + std::to_string(i) + "</strong> of the article.</p>\n";
+    }
+    article += "<p>" + middle + "</p>\n";
+    for (int i = 50; i < 100; ++i) {
+        article += "<p>Paragraph <a href=\"https://example.com/" + std::to_string(i) + "\">" +
+                   std::to_string(i) + "</a></p>\n";
+    }
+    return article;
+}
+
+- (void)testEditInMiddleOnlyReparsesChangedBlock {
+    StyleOptions options = FabricRichTestStyleOptions();
+    IncrementalParseSession session;
+    FabricMarkupParser::parseMarkupIncremental(session, [self articleWithMiddle:"Draft"], options);
+
+    std::string edited = [self articleWithMiddle:"Final <em>text</em>"];
+    auto result = FabricMarkupParser::parseMarkupIncremental(session, edited, options);
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(edited, options);
+
+    [self assertResult:result matchesResult:full markup:"middle edit"];
+    XCTAssertLessThan(session.lastUpdateParsedBytes(), 100UL,
+                      @"Only the edited paragraph should be parsed");
+}
+
+- (void)testEditChangingLaterStateReparsesUntilStateMatches {
+    // Opening a list changes how every following block is parsed
+    StyleOptions options = FabricRichTestStyleOptions();
+    IncrementalParseSession session;
+    std::string before = "<p>Intro</p><p>Body</p><ul><li>One</li></ul><p>End</p>";
+    std::string after = "<p>Intro</p><ul><li>Body</p><ul><li>One</li></ul><p>End</p>";
+    FabricMarkupParser::parseMarkupIncremental(session, before, options);
+
+    auto result = FabricMarkupParser::parseMarkupIncremental(session, after, options);
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(after, options);
+    [self assertResult:result matchesResult:full markup:after];
+}
+
+- (void)testAutoDirectionLookaheadBlocksReuse {
+    // The <p dir="auto"> direction depends on text inside a later block
+    StyleOptions options = FabricRichTestStyleOptions();
+    IncrementalParseSession session;
+    std::string before = "<p dir=\"auto\"><span dir=\"auto\">1</p><p>hello</span></p><p>x</p>";
+    std::string after = "<p dir=\"auto\"><span dir=\"auto\">1</p><p>שלום</span></p><p>x</p>";
+    FabricMarkupParser::parseMarkupIncremental(session, before, options);
+
+    auto result = FabricMarkupParser::parseMarkupIncremental(session, after, options);
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(after, options);
+    [self assertResult:result matchesResult:full markup:after];
+}
+
+- (void)testRepeatedEditsMatchFullParse {
+    StyleOptions options = FabricRichTestStyleOptions();
+    IncrementalParseSession session;
+    std::string document = [self streamedDocument];
+    FabricMarkupParser::parseMarkupIncremental(session, document, options);
+
+    const std::vector<std::pair<size_t, std::string>> edits = {
+        {20, "<p>Inserted</p>"}, {0, "<div>"}, {40, "</strong>"}, {5, "é"}, {60, "<ol><li>"},
+    };
+    for (const auto& edit : edits) {
+        document.insert(std::min(edit.first, document.size()), edit.second);
+        auto result = FabricMarkupParser::parseMarkupIncremental(session, document, options);
+        auto full = FabricMarkupParser::parseMarkupWithLinkUrls(document, options);
+        [self assertResult:result matchesResult:full markup:document];
+    }
+    document.erase(10, 30);
+    auto result = FabricMarkupParser::parseMarkupIncremental(session, document, options);
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(document, options);
+    [self assertResult:result matchesResult:full markup:document];
+}
+
+- (void)testBlockBoundariesRecordSourceHashes {
+    parsing::MarkupSegmentParser::Options parserOptions;
+    parserOptions.trackBlocks = true;
+    parsing::MarkupSegmentParser parser(parserOptions);
+    std::string markup = "<h1>Title</h1><p>Text</p><ul><li>A<ul><li>B</li></ul></li></ul><span>tail";
+    parser.feed(markup);
+
+    const auto& blocks = parser.blocks();
+    XCTAssertEqual(blocks.size(), 3UL, @"Nested lists end one block");
+    XCTAssertEqual(blocks[0].sourceEnd, markup.find("</h1>") + 5);
+    XCTAssertEqual(blocks[0].sourceHash, parsing::hashMarkup("<h1>Title</h1>"));
+    XCTAssertEqual(blocks[1].sourceHash, parsing::hashMarkup("<p>Text</p>"));
+    XCTAssertEqual(blocks[2].sourceEnd, markup.find("<span>"));
+}
+
+#pragma mark - Chunked Input Tests
+
+- (void)testChunkedAppendMatchesFullParse {
+    std::string document = [self streamedDocument];
+    StyleOptions options = FabricRichTestStyleOptions();
+
+    for (size_t chunkSize : {1UL, 3UL, 7UL, 64UL}) {
+        IncrementalParseSession session;
+        for (size_t pos = 0; pos < document.size(); pos += chunkSize) {
+            session.append(std::string_view(document).substr(pos, chunkSize));
+        }
+        auto built = session.build(options);
+        auto full = FabricMarkupParser::parseMarkupWithLinkUrls(document, options);
+
+        XCTAssertTrue(built.attributedString == full.attributedString,
+                      @"Chunk size %zu should match full parse", chunkSize);
+        XCTAssertTrue(built.links == full.links);
+    }
+}
+
+- (void)testAutoDirectionResolvedAcrossChunks {
+    // The direction of <bdi> depends on content that arrives in a later chunk
+    parsing::MarkupSegmentParser parser;
+    parser.feed("<p><bdi>");
+    parser.feed("مر");
+    parser.feed("حبا</bdi></p>");
+    parser.finish();
+
+    auto expected = FabricMarkupParser::parseMarkupToSegments(
+        "<p><bdi>مرحبا</bdi></p>");
+    XCTAssertEqual(parser.segments().size(), expected.size());
+    for (size_t i = 0; i < expected.size() && i < parser.segments().size(); ++i) {
+        XCTAssertTrue(parser.segments()[i].text == expected[i].text);
+        XCTAssertEqual(parser.segments()[i].writingDirection, expected[i].writingDirection);
+    }
+}
+
+#pragma mark - Checkpoint Tests
+
+- (void)testCheckpointRestoreDiscardsLaterInput {
+    parsing::MarkupSegmentParser parser;
+    parser.feed("<p>Keep</p><p>Partial ");
+    auto checkpoint = parser.checkpoint();
+
+    parser.feed("discarded</p><p>More</p>");
+    parser.restore(checkpoint);
+    parser.feed("text</p>");
+    parser.finish();
+
+    auto expected = FabricMarkupParser::parseMarkupToSegments("<p>Keep</p><p>Partial text</p>");
+    XCTAssertEqual(parser.segments().size(), expected.size());
+    for (size_t i = 0; i < expected.size() && i < parser.segments().size(); ++i) {
+        XCTAssertTrue(parser.segments()[i].text == expected[i].text);
+    }
+}
+
+- (void)testPreviewFinishDoesNotConsumeState {
+    parsing::MarkupSegmentParser parser;
+    parser.feed("<p>Hello <strong>wor");
+
+    auto preview = parser.previewFinish();
+    XCTAssertFalse(preview.empty(), @"Preview should include the pending run");
+
+    parser.feed("ld</strong></p>");
+    parser.finish();
+    auto expected = FabricMarkupParser::parseMarkupToSegments("<p>Hello <strong>world</strong></p>");
+    XCTAssertEqual(parser.segments().size(), expected.size());
+}
+
+@end
@@ -0,0 +1,97 @@
+/**
+ * FabricRichLinkTableTests.mm
+ *
+ * Tests for the interned link table of parse results.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+#import "FabricRichTestHelpers.h"
+
+using namespace facebook::react;
+
+@interface FabricRichLinkTableTests : XCTestCase
+@end
+
+@implementation FabricRichLinkTableTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Builder Tests
+
+- (void)testInternsRepeatedUrls {
+    parsing::LinkTableBuilder builder;
+    builder.add(0, "https://a.example");
+    builder.add(2, "https://b.example");
+    builder.add(4, "https://a.example");
+    auto links = std::move(builder).build();
+
+    XCTAssertEqual(links.urls().size(), 2UL);
+    std::vector<LinkRun> expected = {{0, 1, 0}, {2, 1, 1}, {4, 1, 0}};
+    XCTAssertTrue(links.runs() == expected);
+}
+
+- (void)testMergesConsecutiveFragmentsOfOneLink {
+    parsing::LinkTableBuilder builder;
+    builder.add(1, "https://a.example");
+    builder.add(2, "https://a.example");
+    builder.add(3, "");
+    builder.add(4, "https://a.example");
+    auto links = std::move(builder).build();
+
+    std::vector<LinkRun> expected = {{1, 2, 0}, {4, 1, 0}};
+    XCTAssertTrue(links.runs() == expected);
+}
+
+- (void)testUrlAt {
+    parsing::LinkTableBuilder builder;
+    builder.add(1, "https://a.example");
+    builder.add(2, "https://a.example");
+    builder.add(5, "https://b.example");
+    auto links = std::move(builder).build();
+
+    XCTAssertTrue(links.urlAt(0) == nullptr);
+    XCTAssertTrue(*links.urlAt(1) == "https://a.example");
+    XCTAssertTrue(*links.urlAt(2) == "https://a.example");
+    XCTAssertTrue(links.urlAt(3) == nullptr);
+    XCTAssertTrue(*links.urlAt(5) == "https://b.example");
+    XCTAssertTrue(links.urlAt(6) == nullptr);
+}
+
+- (void)testFragmentIndicesAboveUint16 {
+    parsing::LinkTableBuilder builder;
+    builder.add(70000, "https://a.example");
+    auto links = std::move(builder).build();
+    XCTAssertTrue(links.urlAt(70000) != nullptr);
+    XCTAssertTrue(links.urlAt(70000 - 65536) == nullptr, @"Indices are not truncated to 16 bits");
+}
+
+#pragma mark - Parse Result Tests
+
+- (void)testStyledLinkIsOneRun {
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls(
+        "<p>See <a href=\"https://example.com\">the <strong>bold</strong> docs</a> here</p>",
+        FabricRichTestStyleOptions());
+
+    XCTAssertEqual(result.links.urls().size(), 1UL);
+    XCTAssertEqual(result.links.runs().size(), 1UL);
+    const auto& run = result.links.runs()[0];
+    XCTAssertEqual(run.fragmentCount, 3UL, @"One run across the styled fragments of the link");
+
+    std::string linkText;
+    for (size_t i = run.firstFragment; i < run.endFragment(); ++i) {
+        linkText += result.attributedString.getFragments()[i].string;
+    }
+    XCTAssertTrue(linkText == "the bold docs");
+}
+
+- (void)testPlainTextHasNoLinks {
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls("<p>a <b>b</b> c</p>", FabricRichTestStyleOptions());
+    XCTAssertTrue(result.links.empty());
+    XCTAssertTrue(result.links.urls().empty());
+}
+
+@end
@@ -32,7 +32,7 @@ using namespace facebook::react;
 - (NSAttributedString *)parseToNSAttributedString:(NSString *)html {
     auto result = [self parseHTMLWithLinks:html];
     return [FabricRichFragmentParser buildAttributedStringFromCppAttributedString:result.attributedString
-                                                                     withLinkUrls:result.linkUrls];
+                                                                        withLinks:result.links];
 }
 
 #pragma mark - Link Parsing Tests (FR-001)
@@ -34,6 +34,12 @@ using namespace facebook::react;
     return [NSString stringWithUTF8String:fullText.c_str()];
 }
 
+- (std::string)accessibilityLabelForHTML:(NSString *)html {
+    std::string htmlStr = [html UTF8String] ?: "";
+    return FabricMarkupParser::parseMarkupWithLinkUrls(
+        htmlStr, 16.0f, 1.0f, true, 0.0f, 0.0f, "", "", "", 0.0f, 0xFF000000, "").accessibilityLabel();
+}
+
 #pragma mark - Unordered List Tests (FR-006)
 
 - (void)testUnorderedListInsertsBulletMarkers {
@@ -186,4 +192,27 @@ using namespace facebook::react;
     XCTAssertTrue([text containsString:@"Item 2"], @"Should contain Item 2 for accessibility");
 }
 
+- (void)testAccessibilityLabelPausesBeforeListItems {
+    std::string label = [self accessibilityLabelForHTML:@"<p>Intro</p><ol><li>One</li><li>Two</li></ol>"];
+
+    XCTAssertTrue(label.find("Intro.\n1") != std::string::npos, @"Pause before first item");
+    XCTAssertTrue(label.find("One.\n2") != std::string::npos, @"Pause before second item");
+}
+
+- (void)testAccessibilityLabelKeepsExistingPunctuation {
+    std::string label = [self accessibilityLabelForHTML:@"<p>Steps:</p><ul><li>Done!</li><li>Next</li></ul>"];
+
+    XCTAssertTrue(label.find(":.") == std::string::npos);
+    XCTAssertTrue(label.find("!.") == std::string::npos);
+}
+
+- (void)testAccessibilityLabelWithoutListsIsText {
+    std::string html = "<p>First</p><p>Second <b>bold</b></p>";
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls(
+        html, 16.0f, 1.0f, true, 0.0f, 0.0f, "", "", "", 0.0f, 0xFF000000, "");
+
+    XCTAssertTrue(result.accessibilityPauses.empty(), @"No pauses are stored for content without lists");
+    XCTAssertTrue(result.accessibilityLabel() == result.attributedString.getString());
+}
+
 @end
@@ -0,0 +1,151 @@
+/**
+ * FabricRichMarkupSanitizerTests.mm
+ *
+ * Tests for the allowlist sanitizer built into the shared C++ tokenizer.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+#import "../../../cpp/parsing/MarkupSanitizer.h"
+#import "FabricRichTestHelpers.h"
+
+using namespace facebook::react;
+
+@interface FabricRichMarkupSanitizerTests : XCTestCase
+@end
+
+@implementation FabricRichMarkupSanitizerTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (std::string)renderedText:(const std::string&)markup {
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+    std::string text;
+    for (const auto& fragment : result.attributedString.getFragments()) {
+        text += fragment.string;
+    }
+    return text;
+}
+
+- (std::vector<std::string>)linkUrls:(const std::string&)markup {
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+    std::vector<std::string> urls;
+    for (const auto& run : result.links.runs()) {
+        urls.push_back(result.links.urls()[run.urlId]);
+    }
+    return urls;
+}
+
+#pragma mark - Allowlist Tests
+
+- (void)testAllowlistMatchesConstants {
+    XCTAssertTrue(parsing::isAllowedTag("p"));
+    XCTAssertTrue(parsing::isAllowedTag("bdi"));
+    XCTAssertTrue(parsing::isAllowedTag("blockquote"));
+    XCTAssertFalse(parsing::isAllowedTag("script"));
+    XCTAssertFalse(parsing::isAllowedTag("img"));
+    XCTAssertTrue(parsing::isAllowedAttribute("href"));
+    XCTAssertFalse(parsing::isAllowedAttribute("onclick"));
+    XCTAssertTrue(parsing::isAllowedDirValue("RTL"));
+    XCTAssertFalse(parsing::isAllowedDirValue("sideways"));
+}
+
+- (void)testDisallowedTagsKeepText {
+    XCTAssertEqual([self renderedText:"<p>a<font color=\"red\">b</font><img src=x onerror=alert(1)>c</p>"], "abc");
+}
+
+#pragma mark - Dropped Content Tests
+
+- (void)testScriptContentIsDropped {
+    XCTAssertEqual([self renderedText:"<p>a<script>if (a<b) alert(1)</script>b</p>"], "ab");
+    XCTAssertEqual([self renderedText:"<p>a<SCRIPT type=\"x\">evil()</SCRIPT >b</p>"], "ab");
+}
+
+- (void)testEmbeddedContentIsDropped {
+    XCTAssertEqual([self renderedText:"<p>a<style>p{color:red}</style>b</p>"], "ab");
+    XCTAssertEqual([self renderedText:"<p>a<iframe src=\"x\"><b>inner</b></iframe>b</p>"], "ab");
+    XCTAssertEqual([self renderedText:"<p>a<noscript>fallback</noscript>b</p>"], "ab");
+}
+
+- (void)testUnclosedScriptDropsRemainingContent {
+    XCTAssertEqual([self renderedText:"<p>a<script>never closed <b>x</b></p>"], "a");
+}
+
+- (void)testCommentsEndAtCommentClose {
+    XCTAssertEqual([self renderedText:"<p>a<!-- x > y <b>bold</b> -->b</p>"], "ab");
+    XCTAssertEqual([self renderedText:"<p>a<!---->b<!-->c</p>"], "abc");
+    // Comments too short to have ended yet still hide '<' and '>'
+    XCTAssertEqual([self renderedText:"<!--<p>secret</p>-->"], "");
+    XCTAssertEqual([self renderedText:"<!-- <p>secret --> b"], "b");
+    XCTAssertEqual([self renderedText:"<!--x>secret--> b"], "b");
+}
+
+#pragma mark - Attribute Tests
+
+- (void)testDisallowedUrlSchemesAreDropped {
+    auto urls = [self linkUrls:"<a href=\"javascript:alert(1)\">j</a><a href=\"data:text/html,x\">d</a>"
+                               "<a href=\"https://example.com\">h</a><a href=\"tel:123\">t</a>"];
+    XCTAssertEqual(urls.size(), 2UL);
+    if (urls.size() == 2) {
+        XCTAssertEqual(urls[0], "https://example.com");
+        XCTAssertEqual(urls[1], "tel:123");
+    }
+}
+
+- (void)testOnlyWholeAttributeNamesAreRead {
+    XCTAssertEqual([self linkUrls:"<a data-href=\"https://evil.example\">x</a>"].size(), 0UL);
+    auto urls = [self linkUrls:"<a title=\"href='/x'\" href=\"https://ok.example\">x</a>"];
+    XCTAssertEqual(urls.size(), 1UL);
+    if (urls.size() == 1) {
+        XCTAssertEqual(urls[0], "https://ok.example");
+    }
+
+    StyleOptions options = FabricRichTestStyleOptions();
+    auto isRtl = [&](const std::string& markup) {
+        return FabricMarkupParser::parseMarkupWithLinkUrls(markup, options).summary.has(DocumentFeature::Bidi);
+    };
+    XCTAssertTrue(isRtl("<p dir=\"rtl\">Hello</p>"));
+    XCTAssertFalse(isRtl("<p data-dir=\"rtl\">Hello</p>"));
+    XCTAssertFalse(isRtl("<p title=\"dir='rtl'\">Hello</p>"));
+}
+
+- (void)testAttributesAreTokenizedAsHtml {
+    auto urls = [self linkUrls:"<a HREF=\"https://a.example\">a</a><a href = 'https://b.example'>b</a>"
+                               "<a href=https://c.example>c</a>"];
+    XCTAssertEqual(urls.size(), 3UL);
+    if (urls.size() == 3) {
+        XCTAssertEqual(urls[0], "https://a.example");
+        XCTAssertEqual(urls[1], "https://b.example");
+        XCTAssertEqual(urls[2], "https://c.example");
+    }
+}
+
+- (void)testInvalidDirValueIsIgnored {
+    StyleOptions options = FabricRichTestStyleOptions();
+    auto withBogus = FabricMarkupParser::parseMarkupWithLinkUrls("<p dir=\"bogus\">שלום</p>", options);
+    auto withoutDir = FabricMarkupParser::parseMarkupWithLinkUrls("<p>שלום</p>", options);
+    XCTAssertTrue(withBogus.attributedString == withoutDir.attributedString);
+}
+
+#pragma mark - Streaming Tests
+
+- (void)testChunkedInputMatchesFullParse {
+    std::string markup = "<p>a<!-- c > d --><script>x<y</script><iframe><p>z</p></iframe>"
+                         "<img src=x>b<a href=\"javascript:x\">c</a></p>";
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+
+    for (size_t split = 1; split < markup.size(); ++split) {
+        IncrementalParseSession session;
+        FabricMarkupParser::parseMarkupIncremental(session, markup.substr(0, split), FabricRichTestStyleOptions());
+        auto streamed = FabricMarkupParser::parseMarkupIncremental(session, markup, FabricRichTestStyleOptions());
+        XCTAssertTrue(streamed.attributedString == full.attributedString, @"Split at %zu differs", split);
+        XCTAssertTrue(streamed.links == full.links);
+    }
+}
+
+@end
@@ -0,0 +1,140 @@
+/**
+ * FabricRichParallelParserTests.mm
+ *
+ * Tests for block-parallel parsing and the parse thread pool.
+ * Parallel results must match a sequential parse of the same markup.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+
+#include <atomic>
+
+using namespace facebook::react;
+using namespace facebook::react::parsing;
+
+@interface FabricRichParallelParserTests : XCTestCase
+@end
+
+@implementation FabricRichParallelParserTests
+
+#pragma mark - Helper Methods
+
+- (ParallelParseOptions)optionsWithPool:(ParseThreadPool&)pool {
+    ParallelParseOptions options;
+    options.pool = &pool;
+    options.minParallelBytes = 1;
+    options.minChunkBytes = 16;
+    options.maxChunks = 8;
+    return options;
+}
+
+- (void)assertParallel:(const std::string&)markup pool:(ParseThreadPool&)pool {
+    MarkupSegmentParser::Options parserOptions;
+    parserOptions.normalizeWhitespace = true;
+
+    auto parallel = parseMarkupParallel(markup, parserOptions, [self optionsWithPool:pool]);
+    parallel.finish();
+    MarkupSegmentParser sequential(parserOptions);
+    sequential.feed(markup);
+    sequential.finish();
+
+    const auto& actual = parallel.segments();
+    const auto& expected = sequential.segments();
+    XCTAssertEqual(actual.size(), expected.size(), @"Segment count differs for '%s'", markup.c_str());
+    for (size_t i = 0; i < expected.size() && i < actual.size(); ++i) {
+        XCTAssertTrue(actual[i].text == expected[i].text, @"Segment %zu text differs", i);
+        XCTAssertEqual(actual[i].isBold, expected[i].isBold);
+        XCTAssertTrue(actual[i].linkUrl == expected[i].linkUrl);
+        XCTAssertEqual(actual[i].writingDirection, expected[i].writingDirection);
+    }
+}
+
+#pragma mark - Pre-scan Tests
+
+- (void)testPrescanSplitsOnlyAtTopLevelBlocks {
+    std::string markup = "<p>First paragraph</p><ul><li><p>In list</p></li></ul><div><p>Nested</p></div><p>Last</p>";
+    auto boundaries = findTopLevelBlockBoundaries(markup, 16, 1);
+
+    std::vector<size_t> expected = {
+        markup.find("<ul>"), markup.find("<div>"), markup.find("<p>Last"),
+    };
+    XCTAssertTrue(boundaries == expected, @"Splits should follow </p>, </ul> and </div> at the top level");
+}
+
+- (void)testPrescanRespectsMinimumChunkSize {
+    std::string markup;
+    for (int i = 0; i < 100; ++i) {
+        markup += "<p>Paragraph</p>";
+    }
+    auto boundaries = findTopLevelBlockBoundaries(markup, 4, kMinParallelChunkBytes);
+    XCTAssertTrue(boundaries.empty(), @"Small documents should not be split");
+}
+
+#pragma mark - Parallel Parse Tests
+
+- (void)testParallelParseMatchesSequential {
+    ParseThreadPool pool(3);
+    std::string markup;
+    for (int i = 0; i < 200; ++i) {
+        markup += "<h2>Section " + std::to_string(i) + "</h2>\n"
+                  "<p>Text with <strong>bold</strong> and <a href=\"https://example.com\">links</a>.</p>\n"
+                  "<ol><li>One</li><li>Two</li></ol>\n";
+    }
+    [self assertParallel:markup pool:pool];
+}
+
+- (void)testStateCarriedAcrossSplitsIsFixedUp {
+    // Unclosed elements and list items that straddle block boundaries make
+    // the speculative start state wrong; results must still match.
+    ParseThreadPool pool(3);
+    std::string markup = "<p><strong>Unclosed bold</p><p>still bold</p>"
+                         "<ol><li>One</li></ol><p>Break</p><ol><li>Counter restarts</li></ol>"
+                         "<p dir=\"rtl\">Right</p><p>Left</p>"
+                         "<p dir=\"auto\"><span dir=\"auto\">1</p><p>שלום</span></p>"
+                         "<div><a href=\"https://example.com\">Link</div><p>After link</p>";
+    [self assertParallel:markup pool:pool];
+}
+
+- (void)testSmallDocumentStaysOnCallingThread {
+    ParseThreadPool pool(3);
+    ParallelParseOptions options;
+    options.pool = &pool;
+    options.minParallelBytes = 1024;
+
+    auto parser = parseMarkupParallel("<p>One</p><p>Two</p>", MarkupSegmentParser::Options{}, options);
+    parser.finish();
+    XCTAssertEqual(parser.segments().size(), 2UL);
+}
+
+#pragma mark - Thread Pool Tests
+
+- (void)testParallelForRunsEveryTaskOnce {
+    ParseThreadPool pool(3);
+    std::vector<std::atomic<int>> counts(100);
+    pool.parallelFor(counts.size(), [&](size_t i) { counts[i]++; });
+
+    for (size_t i = 0; i < counts.size(); ++i) {
+        XCTAssertEqual(counts[i].load(), 1, @"Task %zu should run exactly once", i);
+    }
+}
+
+- (void)testNestedParallelForRunsInline {
+    ParseThreadPool pool(2);
+    std::atomic<int> total{0};
+    pool.parallelFor(4, [&](size_t) {
+        pool.parallelFor(4, [&](size_t) { total++; });
+    });
+    XCTAssertEqual(total.load(), 16);
+}
+
+- (void)testParallelForRethrowsTaskException {
+    ParseThreadPool pool(2);
+    XCTAssertThrows(pool.parallelFor(8, [](size_t i) {
+        if (i == 5) {
+            throw std::runtime_error("task failed");
+        }
+    }));
+}
+
+@end
@@ -0,0 +1,190 @@
+/**
+ * FabricRichParseLimitsTests.mm
+ *
+ * Tests for how parsing degrades at ParseLimits.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+
+using namespace facebook::react;
+
+@interface FabricRichParseLimitsTests : XCTestCase
+@end
+
+@implementation FabricRichParseLimitsTests {
+    ParseLimits _savedLimits;
+}
+
+- (void)setUp {
+    [super setUp];
+    _savedLimits = parsing::parseLimits();
+    ParseCache::shared().clear();
+}
+
+- (void)tearDown {
+    parsing::setParseLimits(_savedLimits);
+    ParseCache::shared().clear();
+    [super tearDown];
+}
+
+#pragma mark - Helper Methods
+
+- (parsing::MarkupSegmentParser)parse:(const std::string&)markup limits:(const ParseLimits&)limits chunkSize:(size_t)chunkSize {
+    auto options = parsing::renderingParserOptions();
+    options.limits = limits;
+    parsing::MarkupSegmentParser parser(options);
+    for (size_t offset = 0; offset < markup.size(); offset += chunkSize) {
+        parser.feed(std::string_view(markup).substr(offset, chunkSize));
+    }
+    parser.finish();
+    return parser;
+}
+
+- (parsing::MarkupSegmentParser)parse:(const std::string&)markup limits:(const ParseLimits&)limits {
+    return [self parse:markup limits:limits chunkSize:markup.size()];
+}
+
+- (std::string)textOf:(const parsing::MarkupSegmentParser&)parser {
+    std::string text;
+    for (const auto& segment : parser.segments()) {
+        text += segment.text;
+    }
+    return text;
+}
+
+- (std::string)paragraphs:(int)count {
+    std::string markup;
+    for (int i = 0; i < count; i++) {
+        markup += "<p>Paragraph <b>" + std::to_string(i) + "</b> text</p>";
+    }
+    return markup;
+}
+
+#pragma mark - Default Limits
+
+- (void)testOrdinaryDocumentHitsNoLimit {
+    auto parser = [self parse:[self paragraphs:100] limits:ParseLimits{}];
+    XCTAssertEqual(parser.limitsHit(), 0);
+
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls("<p>Hello <b>world</b></p>", StyleOptions{});
+    XCTAssertEqual(result.limitsHit, 0);
+}
+
+- (void)testLimitNames {
+    XCTAssertEqual(std::string(parsing::parseLimitName(ParseLimit::NestingDepth)), "nesting-depth");
+    XCTAssertEqual(std::string(parsing::parseLimitName(ParseLimit::Time)), "time");
+}
+
+#pragma mark - Nesting Depth
+
+- (void)testDeepNestingIsFlattened {
+    std::string markup;
+    for (int i = 0; i < 150; i++) {
+        markup += "<i>";
+    }
+    markup += "deep";
+    for (int i = 0; i < 150; i++) {
+        markup += "</i>";
+    }
+    markup += "<p>after</p>";
+
+    auto parser = [self parse:markup limits:ParseLimits{}];
+    XCTAssertEqual(parser.limitsHit(), static_cast<ParseLimitsHit>(ParseLimit::NestingDepth));
+    XCTAssertEqual([self textOf:parser], "deepafter\n");
+
+    // Text past the limit keeps the style of the deepest element kept
+    XCTAssertTrue(parser.segments().front().isItalic);
+}
+
+#pragma mark - Plain Text Fallback
+
+- (void)testTagsPastLimitAreReadAsPlainText {
+    ParseLimits limits;
+    limits.maxTags = 30;
+    auto parser = [self parse:[self paragraphs:40] limits:limits];
+    XCTAssertTrue(parsing::hitLimit(parser.limitsHit(), ParseLimit::Tags));
+
+    // Every paragraph is kept, each on its own line
+    auto text = [self textOf:parser];
+    XCTAssertNotEqual(text.find("Paragraph 39 text\n"), std::string::npos);
+    XCTAssertNotEqual(text.find("Paragraph 38 text\nParagraph 39"), std::string::npos);
+    XCTAssertFalse(parser.segments().back().isBold);
+}
+
+- (void)testFragmentsPastLimitAreReadAsPlainText {
+    ParseLimits limits;
+    limits.maxFragments = 20;
+    auto parser = [self parse:[self paragraphs:40] limits:limits];
+    XCTAssertTrue(parsing::hitLimit(parser.limitsHit(), ParseLimit::Fragments));
+    XCTAssertTrue(parser.segments().size() <= limits.maxFragments + 1);
+    XCTAssertNotEqual([self textOf:parser].find("Paragraph 39 text"), std::string::npos);
+}
+
+- (void)testPlainTextClosesOpenLinks {
+    ParseLimits limits;
+    limits.maxTags = 1;
+    auto parser = [self parse:"<a href=\"https://example.com\">link<b>bold</b> rest" limits:limits];
+    for (const auto& segment : parser.segments()) {
+        if (segment.text.find("rest") != std::string::npos) {
+            XCTAssertTrue(segment.linkUrl.empty());
+        }
+    }
+}
+
+- (void)testInputPastLimitIsDroppedAtCodePoint {
+    ParseLimits limits;
+    limits.maxInputBytes = 7;
+    // "<p>é" is 5 bytes; the 3 byte "€" would cross the limit
+    auto parser = [self parse:"<p>\xC3\xA9\xE2\x82\xACx</p>" limits:limits];
+    XCTAssertEqual(parser.limitsHit(), static_cast<ParseLimitsHit>(ParseLimit::InputBytes));
+    XCTAssertEqual([self textOf:parser], "\xC3\xA9");
+}
+
+#pragma mark - Streaming
+
+- (void)testChunkedParseDegradesLikeWholeParse {
+    ParseLimits limits;
+    limits.maxTags = 50;
+    limits.maxFragments = 40;
+    auto markup = [self paragraphs:60];
+    auto whole = [self parse:markup limits:limits];
+    for (size_t chunkSize : {1, 7, 256}) {
+        auto chunked = [self parse:markup limits:limits chunkSize:chunkSize];
+        XCTAssertEqual([self textOf:chunked], [self textOf:whole]);
+        XCTAssertEqual(chunked.limitsHit(), whole.limitsHit());
+    }
+}
+
+- (void)testIncrementalSessionReportsLimits {
+    ParseLimits limits;
+    limits.maxTags = 100;
+    parsing::setParseLimits(limits);
+    auto markup = [self paragraphs:60];
+
+    IncrementalParseSession session;
+    parsing::AttributedStringResult streamed;
+    for (size_t length = 512; length < markup.size() + 512; length += 512) {
+        streamed = session.update(markup.substr(0, std::min(length, markup.size())), StyleOptions{});
+    }
+    auto full = parsing::parseAndBuildAttributedString(markup, StyleOptions{});
+    XCTAssertTrue(parsing::hitLimit(full.limitsHit, ParseLimit::Tags));
+    XCTAssertEqual(streamed.limitsHit, full.limitsHit);
+    XCTAssertEqual(streamed.attributedString.getString(), full.attributedString.getString());
+}
+
+#pragma mark - Time
+
+- (void)testTimeLimitedResultIsNotCached {
+    ParseLimits limits;
+    limits.maxParseTime = std::chrono::microseconds(1);
+    parsing::setParseLimits(limits);
+    auto markup = [self paragraphs:5000];
+
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls(markup, StyleOptions{});
+    XCTAssertTrue(parsing::hitLimit(result.limitsHit, ParseLimit::Time));
+    XCTAssertNotEqual(result.attributedString.getString().find("Paragraph 4999 text"), std::string::npos);
+    XCTAssertTrue(ParseCache::shared().find(markup, StyleOptions{}) == nullptr);
+}
+
+@end
@@ -0,0 +1,201 @@
+/**
+ * FabricRichParseSchedulerTests.mm
+ *
+ * Tests for the background parse scheduler: lanes, cancellation and
+ * joining in-flight parses.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+#import "FabricRichTestHelpers.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+
+using namespace facebook::react;
+
+@interface FabricRichParseSchedulerTests : XCTestCase
+@end
+
+@implementation FabricRichParseSchedulerTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (std::string)documentWithBlocks:(int)blockCount tag:(const std::string&)tag {
+    std::string document;
+    for (int i = 0; i < blockCount; ++i) {
+        document += "<p>" + tag + " block <strong>" + std::to_string(i) + "</strong></p>";
+    }
+    return document;
+}
+
+- (void)assertResult:(const parsing::AttributedStringResult&)actual
+     matchesMarkup:(const std::string&)markup
+           options:(const StyleOptions&)options {
+    auto expected = parsing::parseAndBuildAttributedString(markup, options);
+    XCTAssertTrue(actual.attributedString == expected.attributedString,
+                  @"Fragments differ for '%s'", markup.c_str());
+    XCTAssertTrue(actual.links == expected.links);
+    XCTAssertTrue(actual.accessibilityPauses == expected.accessibilityPauses);
+}
+
+#pragma mark - Scheduling Tests
+
+- (void)testScheduledParseLandsInCache {
+    StyleOptions options = FabricRichTestStyleOptions();
+    std::string markup = "<p>Scheduled <a href=\"https://example.com\">row</a></p>";
+    ParseScheduler scheduler(1);
+
+    scheduler.schedule(markup, options, ParseLane::Prefetch);
+    auto result = scheduler.join(markup, options);
+    auto cached = ParseCache::shared().find(markup, options);
+
+    XCTAssertTrue(cached != nullptr, @"Finished jobs should populate the parse cache");
+    if (result) {
+        [self assertResult:*result matchesMarkup:markup options:options];
+    }
+}
+
+- (void)testParseNowMatchesDirectParse {
+    StyleOptions options = FabricRichTestStyleOptions();
+    std::string markup = "<h2>Title</h2><ul><li>One</li><li>Two <em>more</em></li></ul>";
+    ParseScheduler scheduler(1);
+
+    auto result = scheduler.parseNow(markup, options);
+    XCTAssertTrue(result != nullptr);
+    [self assertResult:*result matchesMarkup:markup options:options];
+}
+
+- (void)testJoinWithoutJobReturnsNull {
+    ParseScheduler scheduler(1);
+    XCTAssertTrue(scheduler.join("<p>Never scheduled</p>", FabricRichTestStyleOptions()) == nullptr);
+}
+
+- (void)testDuplicateScheduleSharesOneJob {
+    StyleOptions options = FabricRichTestStyleOptions();
+    ParseScheduler scheduler(1);
+
+    // Keep the only worker busy so the duplicates stay queued
+    scheduler.schedule([self documentWithBlocks:20000 tag:"busy"], options, ParseLane::Visible);
+    std::string markup = [self documentWithBlocks:10 tag:"row"];
+    scheduler.schedule(markup, options, ParseLane::Idle);
+    scheduler.schedule(markup, options, ParseLane::Idle);
+
+    XCTAssertLessThanOrEqual(scheduler.pendingCount(ParseLane::Idle), 1UL);
+}
+
+- (void)testDuplicateScheduleRaisesLane {
+    StyleOptions options = FabricRichTestStyleOptions();
+    ParseScheduler scheduler(1);
+
+    scheduler.schedule([self documentWithBlocks:20000 tag:"busy"], options, ParseLane::Visible);
+    std::string markup = [self documentWithBlocks:10 tag:"row"];
+    scheduler.schedule(markup, options, ParseLane::Idle);
+    scheduler.schedule(markup, options, ParseLane::Visible);
+
+    XCTAssertEqual(scheduler.pendingCount(ParseLane::Idle), 0UL, @"Job should move to the Visible lane");
+}
+
+- (void)testPostedTasksRunOnWorkers {
+    ParseScheduler scheduler(2);
+    std::atomic<int> ran{0};
+    std::promise<void> done;
+    for (int i = 0; i < 10; ++i) {
+        scheduler.post([&ran, &done] {
+            if (++ran == 10) {
+                done.set_value();
+            }
+        }, ParseLane::Prefetch);
+    }
+    scheduler.post([] { throw std::runtime_error("dropped"); }, ParseLane::Idle);
+
+    auto status = done.get_future().wait_for(std::chrono::seconds(5));
+    XCTAssertTrue(status == std::future_status::ready);
+    XCTAssertEqual(ran.load(), 10);
+
+    // A task that threw does not stop the worker
+    std::promise<void> after;
+    scheduler.post([&after] { after.set_value(); }, ParseLane::Idle);
+    XCTAssertTrue(after.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+}
+
+#pragma mark - Cancellation Tests
+
+- (void)testInvalidatedTokenDropsQueuedJobs {
+    StyleOptions options = FabricRichTestStyleOptions();
+    ParseScheduler scheduler(1);
+    auto token = ParseGenerationToken::create();
+
+    scheduler.schedule([self documentWithBlocks:20000 tag:"busy"], options, ParseLane::Visible);
+    for (int i = 0; i < 8; ++i) {
+        scheduler.schedule([self documentWithBlocks:20 tag:std::to_string(i)], options, ParseLane::Prefetch, token);
+    }
+    token.invalidate();
+
+    XCTAssertEqual(scheduler.pendingCount(ParseLane::Prefetch), 0UL,
+                   @"Superseded jobs should not count as pending");
+    XCTAssertFalse(token.isCurrent(0));
+}
+
+- (void)testSharedJobRunsWhileAnyOwnerIsCurrent {
+    StyleOptions options = FabricRichTestStyleOptions();
+    ParseScheduler scheduler(1);
+    auto unmounted = ParseGenerationToken::create();
+    auto mounted = ParseGenerationToken::create();
+
+    scheduler.schedule([self documentWithBlocks:20000 tag:"busy"], options, ParseLane::Visible);
+    std::string markup = [self documentWithBlocks:10 tag:"shared"];
+    scheduler.schedule(markup, options, ParseLane::Prefetch, unmounted);
+    scheduler.schedule(markup, options, ParseLane::Prefetch, mounted);
+    unmounted.invalidate();
+
+    XCTAssertEqual(scheduler.pendingCount(ParseLane::Prefetch), 1UL);
+}
+
+- (void)testRescheduledJobKeepsOnlyCurrentOwner {
+    StyleOptions options = FabricRichTestStyleOptions();
+    ParseScheduler scheduler(1);
+    auto token = ParseGenerationToken::create();
+
+    // A row rescheduled on every commit supersedes its earlier requests
+    scheduler.schedule([self documentWithBlocks:20000 tag:"busy"], options, ParseLane::Visible);
+    std::string markup = [self documentWithBlocks:10 tag:"row"];
+    for (int i = 0; i < 100; ++i) {
+        scheduler.schedule(markup, options, ParseLane::Prefetch, token);
+        token.invalidate();
+    }
+    XCTAssertEqual(scheduler.pendingCount(ParseLane::Prefetch), 0UL);
+
+    scheduler.schedule(markup, options, ParseLane::Prefetch, token);
+    XCTAssertEqual(scheduler.pendingCount(ParseLane::Prefetch), 1UL);
+}
+
+- (void)testDefaultTokenIsNeverCancelled {
+    ParseGenerationToken token;
+    token.invalidate();
+    XCTAssertTrue(token.isCurrent(token.generation()));
+    XCTAssertTrue(token.isCurrent(0));
+}
+
+#pragma mark - Integration Tests
+
+- (void)testIncrementalFirstParseJoinsScheduledJob {
+    StyleOptions options = FabricRichTestStyleOptions();
+    std::string markup = [self documentWithBlocks:50 tag:"visible"];
+    ParseScheduler::shared().schedule(markup, options, ParseLane::Visible);
+
+    IncrementalParseSession session;
+    auto result = FabricMarkupParser::parseMarkupIncremental(session, markup, options);
+    auto expected = parsing::parseAndBuildAttributedString(markup, options);
+    XCTAssertTrue(result.attributedString == expected.attributedString);
+    XCTAssertTrue(result.links == expected.links);
+}
+
+@end
@@ -43,6 +43,22 @@ using namespace facebook::react;
     XCTAssertTrue(result.find("Line 2") != std::string::npos, @"Should contain 'Line 2'");
 }
 
+- (void)testStripHtmlTags_MatchesParsedText {
+    std::vector<std::string> documents = {
+        "<h1>Title</h1><p>Some <b>bold</b> text<br>and more</p>",
+        "<ul><li>One<ul><li>Nested</li></ul></li><li>Two</li></ul><p>After</p>",
+        "<ol><li>First</li><li>Second</li></ol>",
+        "<p>a &amp; b</p><script>dropped()</script>",
+    };
+    for (const auto& markup : documents) {
+        auto parsed = FabricMarkupParser::parseMarkupToAttributedString(
+            markup, 16.0f, 1.0f, true, 0.0f, 0.0f, "", "", "", 0.0f, 0xFF000000, "");
+        std::string stripped = FabricMarkupParser::stripMarkupTags(markup);
+        XCTAssertTrue(stripped == parsed.getString(),
+                      @"Stripped '%s' differs from parsed '%s'", stripped.c_str(), parsed.getString().c_str());
+    }
+}
+
 #pragma mark - parseHtmlToAttributedString Tests
 
 - (void)testParseHtml_EmptyString {
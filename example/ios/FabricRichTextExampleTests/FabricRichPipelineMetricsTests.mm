@@ -0,0 +1,104 @@
+/**
+ * FabricRichPipelineMetricsTests.mm
+ *
+ * Tests for the pipeline metrics registry.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+
+#include <chrono>
+
+using namespace facebook::react;
+using parsing::DocumentSize;
+using parsing::LatencyHistogram;
+
+@interface FabricRichPipelineMetricsTests : XCTestCase
+@end
+
+@implementation FabricRichPipelineMetricsTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+    parsing::resetPipelineMetrics();
+}
+
+#pragma mark - Histogram Tests
+
+- (void)testBucketsAreWithinAnEighthOfTheirValues {
+    for (uint64_t nanoseconds : {5ull, 100ull, 1000ull, 12345ull, 1000000ull, 987654321ull}) {
+        auto value = LatencyHistogram::bucketValue(LatencyHistogram::bucketOf(nanoseconds));
+        double error = std::abs(static_cast<double>(value) - static_cast<double>(nanoseconds)) / nanoseconds;
+        XCTAssertTrue(error <= 0.125, @"%llu ns reported as %llu ns", nanoseconds, value);
+    }
+    XCTAssertEqual(LatencyHistogram::bucketOf(UINT64_MAX), LatencyHistogram::kBucketCount - 1);
+}
+
+- (void)testPercentiles {
+    LatencyHistogram histogram;
+    XCTAssertEqual(histogram.percentile(0.5), 0u);
+
+    // 98 fast samples and 2 slow ones
+    histogram.buckets[LatencyHistogram::bucketOf(1000)] = 98;
+    histogram.buckets[LatencyHistogram::bucketOf(1000000)] = 2;
+    histogram.count = 100;
+    histogram.totalNanoseconds = 98 * 1000 + 2 * 1000000;
+
+    XCTAssertEqual(histogram.percentile(0.5), LatencyHistogram::bucketValue(LatencyHistogram::bucketOf(1000)));
+    XCTAssertEqual(histogram.percentile(0.98), LatencyHistogram::bucketValue(LatencyHistogram::bucketOf(1000)));
+    XCTAssertEqual(histogram.percentile(0.99), LatencyHistogram::bucketValue(LatencyHistogram::bucketOf(1000000)));
+    XCTAssertEqual(histogram.meanNanoseconds(), 20980u);
+}
+
+- (void)testDocumentSizes {
+    XCTAssertEqual(parsing::documentSizeOf(0), DocumentSize::Under1KB);
+    XCTAssertEqual(parsing::documentSizeOf(1024), DocumentSize::Under4KB);
+    XCTAssertEqual(parsing::documentSizeOf(200 * 1024), DocumentSize::Under256KB);
+    XCTAssertEqual(parsing::documentSizeOf(1024 * 1024), DocumentSize::Larger);
+    XCTAssertEqual(std::string(parsing::documentSizeName(DocumentSize::Under16KB)), "16kb");
+}
+
+#pragma mark - Recording Tests
+
+- (void)testRecordedPhasesAreBucketedBySize {
+    parsing::recordPhase(MetricPhase::Measure, 100, std::chrono::microseconds(50));
+    parsing::recordPhase(MetricPhase::Measure, 100000, std::chrono::milliseconds(2));
+
+    auto metrics = parsing::pipelineMetrics();
+    XCTAssertEqual(metrics.latencyOf(MetricPhase::Measure, DocumentSize::Under1KB).count, 1u);
+    XCTAssertEqual(metrics.latencyOf(MetricPhase::Measure, DocumentSize::Under256KB).count, 1u);
+    XCTAssertEqual(metrics.latencyOf(MetricPhase::Measure).count, 2u);
+    XCTAssertEqual(metrics.bytes[static_cast<size_t>(MetricPhase::Measure)], 100100u);
+    XCTAssertEqual(metrics.latencyOf(MetricPhase::Build).count, 0u);
+}
+
+- (void)testParseRecordsItsPhases {
+    std::string markup = "<p>Hello <b>world</b></p>";
+    FabricMarkupParser::parseMarkupWithLinkUrls(markup, StyleOptions{});
+    FabricMarkupParser::parseMarkupWithLinkUrls(markup, StyleOptions{});
+
+    auto metrics = parsing::pipelineMetrics();
+    XCTAssertEqual(metrics.parses.full, 1u);
+    for (auto phase : {MetricPhase::Sanitize, MetricPhase::Tokenize, MetricPhase::Build}) {
+        XCTAssertEqual(metrics.latencyOf(phase, DocumentSize::Under1KB).count, 1u);
+    }
+    XCTAssertEqual(metrics.parseCache.hits, 1u);
+    XCTAssertEqual(metrics.parseCache.entries, 1u);
+    XCTAssertTrue(metrics.parseCache.bytes > markup.size());
+    XCTAssertTrue(metrics.parseCache.hitRate() > 0);
+}
+
+- (void)testResetStartsANewWindow {
+    FabricMarkupParser::parseMarkupWithLinkUrls("<p>Before</p>", StyleOptions{});
+    parsing::resetPipelineMetrics();
+
+    auto metrics = parsing::pipelineMetrics();
+    XCTAssertEqual(metrics.parses.total(), 0u);
+    XCTAssertEqual(metrics.parseCache.hits + metrics.parseCache.misses, 0u);
+    XCTAssertEqual(metrics.latencyOf(MetricPhase::Tokenize).count, 0u);
+    // What the caches hold is not reset
+    XCTAssertEqual(metrics.parseCache.entries, 1u);
+}
+
+@end
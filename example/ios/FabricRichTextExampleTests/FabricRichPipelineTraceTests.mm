@@ -0,0 +1,119 @@
+/**
+ * FabricRichPipelineTraceTests.mm
+ *
+ * Tests for pipeline trace spans and the Chrome trace-event sink.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace facebook::react;
+using parsing::TraceArgs;
+using parsing::TraceSpan;
+
+namespace {
+
+// Records begin and end calls in order, as a platform tracer sees them
+class RecordingSink : public TraceSink {
+ public:
+  void beginSpan(const TraceSpan& span) override {
+    calls.push_back(std::string("begin ") + span.name);
+  }
+
+  void endSpan(const TraceSpan& span, std::chrono::steady_clock::time_point) override {
+    calls.push_back(std::string("end ") + span.name);
+    ended.push_back(span);
+  }
+
+  std::vector<std::string> calls;
+  std::vector<TraceSpan> ended;
+};
+
+} // namespace
+
+@interface FabricRichPipelineTraceTests : XCTestCase
+@end
+
+@implementation FabricRichPipelineTraceTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+- (void)tearDown {
+    parsing::setTraceSink(nullptr);
+    [super tearDown];
+}
+
+#pragma mark - Sink Tests
+
+- (void)testNoSinkRecordsNothing {
+    XCTAssertFalse(parsing::tracingEnabled());
+    TraceScope scope("idle");
+    XCTAssertFalse(scope.enabled());
+}
+
+- (void)testSpansNestOnTheirThread {
+    auto sink = std::make_shared<RecordingSink>();
+    parsing::setTraceSink(sink);
+    {
+        TraceScope outer("outer", TraceArgs{7, 100, 0});
+        {
+            TraceScope inner("inner");
+        }
+        outer.args().fragments = 3;
+    }
+
+    std::vector<std::string> expected{"begin outer", "begin inner", "end inner", "end outer"};
+    XCTAssertTrue(sink->calls == expected);
+    XCTAssertEqual(sink->ended[1].args.hash, 7u);
+    XCTAssertEqual(sink->ended[1].args.bytes, 100u);
+    XCTAssertEqual(sink->ended[1].args.fragments, 3u, @"Args set before the span ends are reported");
+}
+
+- (void)testParseIsTracedWithHashBytesAndFragments {
+    auto sink = std::make_shared<ChromeTraceSink>();
+    parsing::setTraceSink(sink);
+    std::string markup = "<p>Hello <b>world</b></p>";
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls(markup, StyleOptions{});
+
+    auto events = sink->events();
+    auto it = std::find_if(events.begin(), events.end(), [](const auto& event) {
+        return std::string(event.name) == "parseMarkup";
+    });
+    XCTAssertTrue(it != events.end());
+    XCTAssertEqual(it->args.hash, parsing::hashMarkup(markup));
+    XCTAssertEqual(it->args.bytes, markup.size());
+    XCTAssertEqual(it->args.fragments, result.attributedString.getFragments().size());
+}
+
+- (void)testChromeSinkKeepsTheLatestSpans {
+    auto sink = std::make_shared<ChromeTraceSink>(2);
+    parsing::setTraceSink(sink);
+    { TraceScope first("first"); }
+    { TraceScope second("second"); }
+    { TraceScope third("third", TraceArgs{0xff, 10, 2}); }
+
+    auto events = sink->events();
+    XCTAssertEqual(events.size(), 2u);
+    XCTAssertEqual(std::string(events[0].name), "second");
+    XCTAssertEqual(std::string(events[1].name), "third");
+
+    auto json = sink->json();
+    XCTAssertTrue(json.rfind("{\"traceEvents\":[", 0) == 0);
+    XCTAssertTrue(json.find("\"name\":\"third\"") != std::string::npos);
+    XCTAssertTrue(json.find("\"ph\":\"X\"") != std::string::npos);
+    XCTAssertTrue(json.find("\"hash\":\"00000000000000ff\"") != std::string::npos);
+    XCTAssertTrue(json.find("\"first\"") == std::string::npos);
+
+    sink->clear();
+    XCTAssertEqual(sink->events().size(), 0u);
+}
+
+@end
@@ -0,0 +1,114 @@
+/**
+ * FabricRichPreparedMarkupTests.mm
+ *
+ * Tests for markup parsed at props-adoption time.
+ * Prepared results must match a full parse of the same markup.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricPreparedMarkup.h"
+#import "FabricRichTestHelpers.h"
+
+using namespace facebook::react;
+
+@interface FabricRichPreparedMarkupTests : XCTestCase
+@end
+
+@implementation FabricRichPreparedMarkupTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (void)assertResult:(const FabricMarkupParser::ParseResult&)actual
+       matchesMarkup:(const std::string&)markup
+             options:(const StyleOptions&)options {
+    auto expected = FabricMarkupParser::parseMarkupWithLinkUrls(markup, options);
+    XCTAssertTrue(actual.attributedString == expected.attributedString,
+                  @"Fragments differ for '%s'", markup.c_str());
+    XCTAssertTrue(actual.links == expected.links);
+    XCTAssertTrue(actual.accessibilityPauses == expected.accessibilityPauses);
+}
+
+#pragma mark - Prepare Tests
+
+- (void)testNewComponentResolvesBackgroundParse {
+    StyleOptions options = FabricRichTestStyleOptions();
+    std::string markup = "<p>First <a href=\"https://example.com\">render</a></p>";
+    auto session = std::make_shared<IncrementalParseSession>();
+
+    auto prepared = FabricPreparedMarkup::prepare(nullptr, session, markup, options);
+    [self assertResult:*prepared->resolve(options) matchesMarkup:markup options:options];
+}
+
+- (void)testTextUpdatesParseThroughSession {
+    StyleOptions options = FabricRichTestStyleOptions();
+    auto session = std::make_shared<IncrementalParseSession>();
+    std::string markup = "<p>Streaming</p>";
+    auto prepared = FabricPreparedMarkup::prepare(nullptr, session, markup, options);
+    prepared->resolve(options);
+
+    for (const char* chunk : {"<p>more", " text</p>", "<ul><li>item</li></ul>"}) {
+        markup += chunk;
+        prepared = FabricPreparedMarkup::prepare(prepared, session, markup, options);
+        [self assertResult:*prepared->resolve(options) matchesMarkup:markup options:options];
+    }
+    XCTAssertTrue(session->lastUpdateResumed(), @"Appended text should resume the session");
+}
+
+- (void)testMatchesDetectsUnchangedProps {
+    StyleOptions options = FabricRichTestStyleOptions();
+    auto session = std::make_shared<IncrementalParseSession>();
+    auto prepared = FabricPreparedMarkup::prepare(nullptr, session, "<p>Same</p>", options);
+
+    XCTAssertTrue(prepared->matches("<p>Same</p>", options));
+    XCTAssertFalse(prepared->matches("<p>Other</p>", options));
+
+    StyleOptions scaled = options;
+    scaled.fontSizeMultiplier = 2.0f;
+    XCTAssertFalse(prepared->matches("<p>Same</p>", scaled));
+}
+
+- (void)testResolveWithDifferentFontScaleReparses {
+    StyleOptions options = FabricRichTestStyleOptions();
+    auto session = std::make_shared<IncrementalParseSession>();
+    std::string markup = "<h1>Title</h1><p>Body</p>";
+    auto prepared = FabricPreparedMarkup::prepare(nullptr, session, markup, options);
+
+    StyleOptions scaled = options;
+    scaled.fontSizeMultiplier = 1.5f;
+    [self assertResult:*prepared->resolve(scaled) matchesMarkup:markup options:scaled];
+    XCTAssertEqual(FabricPreparedMarkup::predictedFontSizeMultiplier(), 1.5f,
+                   @"Layout's font scale should be used for the next prepare");
+
+    prepared->resolve(options);
+}
+
+- (void)testEmptyTextResolvesEmpty {
+    StyleOptions options = FabricRichTestStyleOptions();
+    auto session = std::make_shared<IncrementalParseSession>();
+    auto prepared = FabricPreparedMarkup::prepare(nullptr, session, "", options);
+
+    auto result = prepared->resolve(options);
+    XCTAssertTrue(result->attributedString.isEmpty());
+    XCTAssertTrue(result->links.empty());
+}
+
+- (void)testRepeatedResolveSharesResult {
+    StyleOptions options = FabricRichTestStyleOptions();
+    auto session = std::make_shared<IncrementalParseSession>();
+    auto prepared = FabricPreparedMarkup::prepare(nullptr, session, "<p>Shared <b>text</b></p>", options);
+
+    auto first = prepared->resolve(options);
+    XCTAssertEqual(prepared->resolve(options).get(), first.get(), @"Unchanged options should not copy the result");
+
+    auto indexed = prepared->resolve(options, true);
+    XCTAssertTrue(indexed->utf16Index != nullptr);
+    XCTAssertTrue(first->utf16Index == nullptr, @"A result already handed out is not mutated");
+    XCTAssertEqual(prepared->resolve(options, true).get(), indexed.get());
+}
+
+@end
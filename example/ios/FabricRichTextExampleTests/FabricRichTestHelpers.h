@@ -0,0 +1,19 @@
+/**
+ * FabricRichTestHelpers.h
+ *
+ * Setup shared by the parser test cases.
+ */
+
+#pragma once
+
+#import "../../../cpp/FabricMarkupParser.h"
+
+/**
+ * Style options the parser tests parse with: 16pt text in opaque black.
+ */
+inline facebook::react::StyleOptions FabricRichTestStyleOptions() {
+    facebook::react::StyleOptions options;
+    options.baseFontSize = 16.0f;
+    options.color = static_cast<int32_t>(0xFF000000);
+    return options;
+}
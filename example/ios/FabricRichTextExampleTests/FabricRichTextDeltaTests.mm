@@ -0,0 +1,152 @@
+/**
+ * FabricRichTextDeltaTests.mm
+ *
+ * Tests for content hashing and the deltas carried by state updates.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+#import "FabricRichTestHelpers.h"
+
+using namespace facebook::react;
+
+@interface FabricRichTextDeltaTests : XCTestCase
+@end
+
+@implementation FabricRichTextDeltaTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (FabricMarkupParser::ParseResult)parse:(const std::string&)markup {
+    return FabricMarkupParser::parseMarkupWithLinkUrls(markup, FabricRichTestStyleOptions());
+}
+
+#pragma mark - Content Hash Tests
+
+- (void)testContentHashIsStable {
+    auto a = [self parse:"<p>Hello <strong>world</strong></p>"];
+    ParseCache::shared().clear();
+    auto b = [self parse:"<p>Hello <strong>world</strong></p>"];
+
+    XCTAssertNotEqual(parsing::contentHash(a.attributedString, a.links), 0ULL);
+    XCTAssertEqual(parsing::contentHash(a.attributedString, a.links),
+                   parsing::contentHash(b.attributedString, b.links));
+}
+
+- (void)testContentHashCoversTextStyleAndLinks {
+    auto base = [self parse:"<p>Hello <a href=\"https://a.example\">world</a></p>"];
+    auto text = [self parse:"<p>Hello <a href=\"https://a.example\">World</a></p>"];
+    auto style = [self parse:"<p>Hello <a href=\"https://a.example\"><em>world</em></a></p>"];
+    auto link = [self parse:"<p>Hello <a href=\"https://b.example\">world</a></p>"];
+
+    auto hash = parsing::contentHash(base.attributedString, base.links);
+    XCTAssertNotEqual(hash, parsing::contentHash(text.attributedString, text.links));
+    XCTAssertNotEqual(hash, parsing::contentHash(style.attributedString, style.links));
+    XCTAssertNotEqual(hash, parsing::contentHash(link.attributedString, link.links));
+}
+
+#pragma mark - Fragment Delta Tests
+
+- (void)testEqualContentHasEmptyDelta {
+    auto a = [self parse:"<p>one <b>two</b></p>"];
+    auto delta = parsing::diffFragments(a.attributedString, a.links, a.attributedString, a.links);
+
+    XCTAssertTrue(delta.empty());
+    XCTAssertEqual(delta.utf16Removed, 0UL);
+    XCTAssertEqual(delta.utf16Inserted, 0UL);
+}
+
+- (void)testAppendedParagraph {
+    auto base = [self parse:"<p>First</p><p>Second</p>"];
+    auto target = [self parse:"<p>First</p><p>Second</p><p>Third <b>bold</b></p>"];
+    auto delta = parsing::diffFragments(base.attributedString, base.links, target.attributedString, target.links);
+
+    const auto& baseFragments = base.attributedString.getFragments();
+    const auto& targetFragments = target.attributedString.getFragments();
+    XCTAssertEqual(delta.first + delta.removed, baseFragments.size(), @"Only the tail changes");
+    XCTAssertEqual(delta.first + delta.inserted, targetFragments.size());
+    XCTAssertTrue(delta.inserted >= 2);
+
+    size_t baseLength = parsing::utf16Length(base.attributedString.getString());
+    size_t targetLength = parsing::utf16Length(target.attributedString.getString());
+    XCTAssertEqual(baseLength - delta.utf16Removed + delta.utf16Inserted, targetLength);
+    XCTAssertEqual(delta.utf16Start + delta.utf16Removed, baseLength);
+}
+
+- (void)testEditedMiddleParagraph {
+    auto base = [self parse:"<p>Alpha</p><p>Beta</p><p>Gamma</p>"];
+    auto target = [self parse:"<p>Alpha</p><p>Better</p><p>Gamma</p>"];
+    auto delta = parsing::diffFragments(base.attributedString, base.links, target.attributedString, target.links);
+
+    XCTAssertEqual(delta.removed, 1UL);
+    XCTAssertEqual(delta.inserted, 1UL);
+    XCTAssertEqual(delta.utf16Removed, 5UL, @"Paragraph text includes its line break");
+    XCTAssertEqual(delta.utf16Inserted, 7UL);
+
+    auto baseText = base.attributedString.getString();
+    auto targetText = target.attributedString.getString();
+    XCTAssertTrue(baseText.substr(0, delta.utf16Start) == targetText.substr(0, delta.utf16Start),
+                  @"Everything before the delta is shared");
+    XCTAssertTrue(targetText.substr(delta.utf16Start, delta.utf16Inserted) == "Better\n");
+}
+
+#pragma mark - Run Delta Tests
+
+- (void)testRunDeltaSplicesIntoBase {
+    auto base = [self parse:"<p>Alpha <b>bold</b></p><p>Beta</p><p>Gamma <i>it</i></p>"];
+    auto target = [self parse:"<p>Alpha <b>bold</b></p><p>Beta <u>new</u></p><p>Gamma <i>it</i></p>"];
+    CompactTextLayout baseLayout(base.attributedString, base.links);
+    CompactTextLayout targetLayout(target.attributedString, target.links);
+
+    auto delta = targetLayout.diff(baseLayout);
+    XCTAssertFalse(delta.empty());
+    XCTAssertTrue(delta.first > 0, @"Leading runs are shared");
+    XCTAssertTrue(delta.first + delta.inserted < targetLayout.runs().size(), @"Trailing runs are shared");
+
+    auto slice = targetLayout.slice(delta.first, delta.inserted);
+    XCTAssertEqual(slice.runs().size(), delta.inserted);
+    XCTAssertEqual(slice.runs().front().start, 0U);
+    XCTAssertEqual(slice.length(), delta.utf16Inserted);
+
+    // Same-style fragments share a run, so the delta starts at the run
+    // holding the line break before "Beta"
+    auto text = baseLayout.strings()[0];
+    XCTAssertEqual(delta.utf16Start, text.find("bold") + 4);
+
+    // Splicing the slice's text into the base text yields the target text
+    text.replace(delta.utf16Start, delta.utf16Removed, slice.strings()[0]);
+    XCTAssertTrue(text == targetLayout.strings()[0]);
+}
+
+- (void)testSliceRoundTrips {
+    auto result = [self parse:
+        "<p>Some <a href=\"https://example.com\">linked</a> and <b>bold</b> text</p>"];
+    CompactTextLayout layout(result.attributedString, result.links);
+
+    auto whole = layout.slice(0, layout.runs().size());
+    XCTAssertTrue(whole == layout);
+
+    auto empty = layout.slice(0, 0);
+    XCTAssertEqual(empty.length(), 0U);
+    XCTAssertEqual(empty.runs().size(), 0UL);
+    auto bytes = empty.serialize();
+    XCTAssertTrue(CompactTextLayout::deserialize(bytes.data(), bytes.size()).has_value());
+
+    auto linked = layout.slice(1, 1);
+    XCTAssertTrue(linked.strings()[0] == "linked");
+    XCTAssertTrue(linked.strings()[linked.runs()[0].link] == "https://example.com");
+}
+
+- (void)testEqualLayoutsHaveEmptyRunDelta {
+    auto result = [self parse:"<p>one <b>two</b> three</p>"];
+    CompactTextLayout layout(result.attributedString, result.links);
+
+    XCTAssertTrue(layout.diff(layout).empty());
+}
+
+@end
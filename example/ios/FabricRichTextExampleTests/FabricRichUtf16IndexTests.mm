@@ -0,0 +1,121 @@
+/**
+ * FabricRichUtf16IndexTests.mm
+ *
+ * Tests for the UTF-16 text and offset index attached to parse results.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+#import "FabricRichTestHelpers.h"
+
+using namespace facebook::react;
+
+@interface FabricRichUtf16IndexTests : XCTestCase
+@end
+
+@implementation FabricRichUtf16IndexTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (AttributedString)attributedStringWithFragments:(const std::vector<std::string>&)strings {
+    AttributedString attributedString;
+    for (const auto& string : strings) {
+        AttributedString::Fragment fragment;
+        fragment.string = string;
+        attributedString.appendFragment(std::move(fragment));
+    }
+    return attributedString;
+}
+
+#pragma mark - Transcoding Tests
+
+- (void)testUtf16Length {
+    XCTAssertEqual(parsing::utf16Length(""), 0UL);
+    XCTAssertEqual(parsing::utf16Length("plain"), 5UL);
+    XCTAssertEqual(parsing::utf16Length("caf\xC3\xA9 \xE2\x82\xAC"), 6UL);
+    XCTAssertEqual(parsing::utf16Length("\xF0\x9F\x98\x80"), 2UL, @"Emoji is a surrogate pair");
+}
+
+- (void)testAppendUtf16MatchesFoundation {
+    std::string text = "ASCII run longer than a word, caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 \xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D!";
+    std::u16string utf16;
+    parsing::appendUtf16(text, utf16);
+
+    NSString *expected = [[NSString alloc] initWithBytes:text.data() length:text.size() encoding:NSUTF8StringEncoding];
+    NSString *actual = [[NSString alloc] initWithCharacters:reinterpret_cast<const unichar *>(utf16.data())
+                                                     length:utf16.size()];
+    XCTAssertEqualObjects(actual, expected);
+    XCTAssertEqual(utf16.size(), parsing::utf16Length(text));
+}
+
+#pragma mark - Index Tests
+
+- (void)testFragmentStartsAndLookup {
+    auto attributedString = [self attributedStringWithFragments:{"ab", "\xF0\x9F\x98\x80", "c"}];
+    Utf16TextIndex index(attributedString, {}, true);
+
+    std::vector<size_t> expectedStarts = {0, 2, 4, 5};
+    XCTAssertTrue(index.fragmentStarts() == expectedStarts);
+    XCTAssertEqual(index.length(), 5UL);
+    XCTAssertEqual(index.text().size(), 5UL);
+
+    XCTAssertEqual(index.fragmentAt(1).value_or(99), 0UL);
+    XCTAssertEqual(index.fragmentAt(2).value_or(99), 1UL);
+    XCTAssertEqual(index.fragmentAt(3).value_or(99), 1UL, @"Low surrogate belongs to the emoji");
+    XCTAssertEqual(index.fragmentAt(4).value_or(99), 2UL);
+    XCTAssertFalse(index.fragmentAt(5).has_value());
+}
+
+- (void)testLinkRangesMergeAdjacentFragments {
+    auto attributedString = [self attributedStringWithFragments:{"see ", "one", "two", " and ", "three"}];
+    std::vector<std::string> linkUrls = {"", "https://a.example", "https://a.example", "", "https://b.example"};
+    parsing::LinkTableBuilder links;
+    for (size_t i = 0; i < linkUrls.size(); ++i) {
+        links.add(i, linkUrls[i]);
+    }
+    Utf16TextIndex index(attributedString, std::move(links).build(), false);
+
+    std::vector<Utf16LinkRange> expected = {{4, 10, 1, 0}, {15, 20, 4, 1}};
+    XCTAssertTrue(index.linkRanges() == expected);
+    XCTAssertTrue(index.text().empty(), @"Text is only kept with includeText");
+
+    XCTAssertTrue(index.linkAt(3) == nullptr);
+    XCTAssertEqual(index.linkAt(4)->fragmentIndex, 1UL);
+    XCTAssertEqual(index.linkAt(9)->fragmentIndex, 1UL);
+    XCTAssertTrue(index.linkAt(10) == nullptr);
+    XCTAssertEqual(index.linkAt(19)->fragmentIndex, 4UL);
+    XCTAssertTrue(index.linkAt(20) == nullptr);
+}
+
+#pragma mark - Parse Result Tests
+
+- (void)testBuildUtf16IndexFromParseResult {
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls(
+        "<p>\xF0\x9F\x98\x80 <a href=\"https://example.com\">link</a> tail</p>", FabricRichTestStyleOptions());
+    XCTAssertTrue(result.utf16Index == nullptr, @"The index is built on request");
+
+    FabricMarkupParser::buildUtf16Index(result);
+    XCTAssertTrue(result.utf16Index != nullptr);
+    auto index = result.utf16Index;
+
+    std::string text;
+    for (const auto& fragment : result.attributedString.getFragments()) {
+        text += fragment.string;
+    }
+    XCTAssertEqual(index->length(), parsing::utf16Length(text));
+    XCTAssertEqual(index->linkRanges().size(), 1UL);
+    const auto& link = index->linkRanges()[0];
+    XCTAssertTrue(result.links.urls()[link.urlId] == "https://example.com");
+    XCTAssertEqual(link.start, 3UL, @"Emoji and space are three code units");
+    XCTAssertEqual(link.end, 7UL);
+
+    FabricMarkupParser::buildUtf16Index(result);
+    XCTAssertEqual(result.utf16Index.get(), index.get(), @"An existing index is kept");
+}
+
+@end
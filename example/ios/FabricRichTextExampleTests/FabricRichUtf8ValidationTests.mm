@@ -0,0 +1,136 @@
+/**
+ * FabricRichUtf8ValidationTests.mm
+ *
+ * Tests for UTF-8 validation and repair at the entry of the shared C++ parser.
+ */
+
+#import <XCTest/XCTest.h>
+#import "../../../cpp/FabricMarkupParser.h"
+#import "../../../cpp/parsing/Utf8Validator.h"
+#import "FabricRichTestHelpers.h"
+
+using namespace facebook::react;
+
+@interface FabricRichUtf8ValidationTests : XCTestCase
+@end
+
+@implementation FabricRichUtf8ValidationTests
+
+- (void)setUp {
+    [super setUp];
+    ParseCache::shared().clear();
+}
+
+#pragma mark - Helper Methods
+
+- (std::string)repaired:(const std::string&)text {
+    std::string out;
+    parsing::appendRepairedUtf8(text, out);
+    return out;
+}
+
+#pragma mark - Validation Tests
+
+- (void)testValidInput {
+    XCTAssertTrue(parsing::isValidUtf8(""));
+    XCTAssertTrue(parsing::isValidUtf8("plain ASCII text that is longer than one word"));
+    XCTAssertTrue(parsing::isValidUtf8("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 \xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D"));
+    XCTAssertTrue(parsing::isValidUtf8("\xF4\x8F\xBF\xBF"), @"U+10FFFF is valid");
+}
+
+- (void)testInvalidInput {
+    XCTAssertFalse(parsing::isValidUtf8("\x80"), @"Lone continuation byte");
+    XCTAssertFalse(parsing::isValidUtf8("\xC0\xAF"), @"Overlong encoding");
+    XCTAssertFalse(parsing::isValidUtf8("\xED\xA0\x80"), @"Surrogate");
+    XCTAssertFalse(parsing::isValidUtf8("\xF4\x90\x80\x80"), @"Above U+10FFFF");
+    XCTAssertFalse(parsing::isValidUtf8("abc\xC3"), @"Truncated sequence");
+    XCTAssertEqual(parsing::validUtf8Prefix("abcdefghij\xFF", 11), 10UL);
+}
+
+#pragma mark - Repair Tests
+
+- (void)testRepairReplacesMaximalSubparts {
+    std::string replacement = "\xEF\xBF\xBD";
+    XCTAssertTrue([self repaired:"a\xFF" "b"] == "a" + replacement + "b");
+    // A truncated sequence is one maximal subpart
+    XCTAssertTrue([self repaired:"\xE2\x82" "a"] == replacement + "a");
+    // Each byte of an overlong or surrogate sequence is replaced separately
+    XCTAssertTrue([self repaired:"\xC0\xAF"] == replacement + replacement);
+    XCTAssertTrue([self repaired:"\xED\xA0\x80"] == replacement + replacement + replacement);
+}
+
+- (void)testEnsureValidUtf8OnlyCopiesInvalidInput {
+    std::string buffer;
+    std::string valid = "caf\xC3\xA9";
+    XCTAssertEqual(parsing::ensureValidUtf8(valid, buffer).data(), valid.data());
+    XCTAssertTrue(buffer.empty());
+
+    std::string invalid = "caf\xC3";
+    XCTAssertTrue(parsing::ensureValidUtf8(invalid, buffer) == "caf\xEF\xBF\xBD");
+}
+
+- (void)testIncompleteSuffix {
+    XCTAssertEqual(parsing::incompleteUtf8Suffix("abc"), 0UL);
+    XCTAssertEqual(parsing::incompleteUtf8Suffix("ab\xC3"), 1UL);
+    XCTAssertEqual(parsing::incompleteUtf8Suffix("ab\xF0\x9F\x98"), 3UL);
+    XCTAssertEqual(parsing::incompleteUtf8Suffix("ab\xF0\x9F\x98\x80"), 0UL);
+    XCTAssertEqual(parsing::incompleteUtf8Suffix("ab\xFF"), 0UL, @"Invalid bytes are not carried");
+}
+
+#pragma mark - Pipeline Tests
+
+- (void)testInvalidMarkupKeepsAllFragments {
+    auto result = FabricMarkupParser::parseMarkupWithLinkUrls(
+        "<p>Before \xFF<strong>bold \xC3</strong> after</p>", FabricRichTestStyleOptions());
+    std::string text;
+    for (const auto& fragment : result.attributedString.getFragments()) {
+        XCTAssertTrue(parsing::isValidUtf8(fragment.string));
+        text += fragment.string;
+    }
+    XCTAssertTrue(text == "Before \xEF\xBF\xBD" "bold \xEF\xBF\xBD after");
+}
+
+- (void)testFragmentBoundaryNeverSplitsCodePoint {
+    // The tag splits the bytes of one code point
+    auto segments = FabricMarkupParser::parseMarkupToSegments("<p>\xC3<b>\xA9</b></p>");
+    for (const auto& segment : segments) {
+        XCTAssertTrue(parsing::isValidUtf8(segment.text));
+    }
+}
+
+- (void)testChunkedAppendCarriesSplitCodePoints {
+    std::string document = "<p>caf\xC3\xA9 \xF0\x9F\x98\x80 \xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D</p>";
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(document, FabricRichTestStyleOptions());
+
+    for (size_t chunkSize : {1UL, 2UL, 3UL}) {
+        IncrementalParseSession session;
+        for (size_t pos = 0; pos < document.size(); pos += chunkSize) {
+            session.append(std::string_view(document).substr(pos, chunkSize));
+        }
+        auto built = session.build(FabricRichTestStyleOptions());
+        XCTAssertTrue(built.attributedString == full.attributedString,
+                      @"Chunk size %zu should match full parse", chunkSize);
+    }
+}
+
+- (void)testBuildAfterTruncatedSequenceMatchesFullParse {
+    // The last chunk stops inside a code point: built now, the document ends
+    // in U+FFFD as a full parse does; a later chunk still completes it
+    std::string prefix = "<p>caf\xC3\xA9 \xF0\x9F";
+    IncrementalParseSession session;
+    session.append(prefix);
+    auto built = session.build(FabricRichTestStyleOptions());
+    auto full = FabricMarkupParser::parseMarkupWithLinkUrls(prefix, FabricRichTestStyleOptions());
+    XCTAssertTrue(built.attributedString == full.attributedString);
+    XCTAssertTrue(built.attributedString.getString() == "caf\xC3\xA9 \xEF\xBF\xBD");
+
+    session.append("\x98\x80</p>");
+    built = session.build(FabricRichTestStyleOptions());
+    XCTAssertTrue(built.attributedString.getString() == "caf\xC3\xA9 \xF0\x9F\x98\x80");
+}
+
+- (void)testStripMarkupTagsRepairsInput {
+    XCTAssertTrue(FabricMarkupParser::stripMarkupTags("<p>a\xFF</p>") == "a\xEF\xBF\xBD");
+}
+
+@end
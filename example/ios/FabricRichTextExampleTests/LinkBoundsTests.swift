@@ -210,6 +210,37 @@ final class LinkBoundsTests: XCTestCase {
         XCTAssertEqual(count, 0, "View with no links should have count of 0")
     }
 
+    // MARK: - In-Place Text Patch Tests
+
+    func testPatchedLinkHasBounds() {
+        // Given: A view without links
+        coreTextView.attributedText = NSAttributedString(string: "Visit the site today.")
+        coreTextView.layoutIfNeeded()
+        XCTAssertEqual(coreTextView.visibleLinkCount, 0)
+
+        // When: A link is spliced into the text in place
+        let link = NSAttributedString(string: "the site",
+                                      attributes: [.link: URL(string: "https://example.com")!])
+        XCTAssertTrue(coreTextView.replaceText(in: NSRange(location: 6, length: 8), with: link))
+        coreTextView.layoutIfNeeded()
+
+        // Then: The view lays out the patched text
+        XCTAssertEqual(coreTextView.attributedText?.string, "Visit the site today.")
+        XCTAssertEqual(coreTextView.visibleLinkCount, 1)
+        XCTAssertFalse(coreTextView.boundsForLink(at: 0).isEmpty)
+    }
+
+    func testPatchOutsideTextIsRejected() {
+        coreTextView.attributedText = NSAttributedString(string: "Short")
+        XCTAssertFalse(coreTextView.replaceText(in: NSRange(location: 3, length: 10),
+                                                with: NSAttributedString(string: "x")))
+        XCTAssertEqual(coreTextView.attributedText?.string, "Short")
+
+        coreTextView.attributedText = nil
+        XCTAssertFalse(coreTextView.replaceText(in: NSRange(location: 0, length: 0),
+                                                with: NSAttributedString(string: "x")))
+    }
+
     // MARK: - Helper Methods
 
     private func createAttributedString(from html: String) -> NSAttributedString {
@@ -59,6 +59,19 @@ NS_ASSUME_NONNULL_BEGIN
 /// Can be overridden by passing accessibilityLabel prop from React.
 @property (nonatomic, copy, nullable) NSString *resolvedAccessibilityLabel;
 
+/// Whether the text may contain markup links, from the parsed document summary.
+/// When NO and no detection is enabled, the link scan for accessibility is skipped. Defaults to YES.
+@property (nonatomic, assign) BOOL mayHaveLinks;
+
+/**
+ * Replaces the characters in range of attributedText in place, without the
+ * comparison and copy of the whole text that setting attributedText does.
+ * Link detection reruns only if enabled.
+ *
+ * @return NO if there is no text or range is outside it; nothing changes then
+ */
+- (BOOL)replaceTextInRange:(NSRange)range withAttributedString:(NSAttributedString *)replacement;
+
 #pragma mark - Accessibility Link Support
 
 /**
@@ -32,6 +32,8 @@
     // CoreText frame management
     CTFrameRef _ctFrame;
     NSAttributedString *_processedAttributedText;
+    // Mutable copy behind _attributedText, patched by replaceTextInRange:
+    NSMutableAttributedString *_textStorage;
 
     // Height animation
     CGFloat _previousContentHeight;
@@ -62,6 +64,7 @@
         _previousContentHeight = 0;
         _hasInitializedHeight = NO;
         _animationDuration = 0.2;
+        _mayHaveLinks = YES;
         _lastReportedMeasuredLineCount = -1;
         _lastReportedVisibleLineCount = -1;
 
@@ -88,12 +91,25 @@
         [_attributedText isEqualToAttributedString:attributedText]) {
         return;
     }
-    _attributedText = [attributedText copy];
+    _textStorage = [attributedText mutableCopy];
+    _attributedText = _textStorage;
     _processedAttributedText = [_linkDetectionManager processAttributedText:_attributedText];
     [self invalidateFrame];
     [self setNeedsDisplay];
 }
 
+- (BOOL)replaceTextInRange:(NSRange)range withAttributedString:(NSAttributedString *)replacement {
+    if (!_textStorage || NSMaxRange(range) > _textStorage.length) {
+        return NO;
+    }
+    [_textStorage replaceCharactersInRange:range withAttributedString:replacement];
+    // Without detection, the processed text is the storage itself
+    _processedAttributedText = [_linkDetectionManager processAttributedText:_attributedText];
+    [self invalidateFrame];
+    [self setNeedsDisplay];
+    return YES;
+}
+
 - (void)setDetectLinks:(BOOL)detectLinks {
     if (_detectLinks == detectLinks) {
         return;
@@ -179,6 +195,9 @@
 }
 
 - (NSInteger)visibleLinkCount {
+    if (!_mayHaveLinks && !_detectLinks && !_detectPhoneNumbers && !_detectEmails) {
+        return 0;
+    }
     return [_accessibilityHelper visibleLinkCountWithFrame:[self ctFrame]
                                              numberOfLines:_numberOfLines
                                             attributedText:_processedAttributedText ?: _attributedText];
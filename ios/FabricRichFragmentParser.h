@@ -15,6 +15,8 @@
 
 #ifdef __cplusplus
 #include <react/renderer/attributedstring/AttributedString.h>
+#include "../cpp/parsing/LinkTable.h"
+#include "../cpp/parsing/Utf16TextIndex.h"
 #include <vector>
 #include <string>
 
@@ -39,15 +41,45 @@ NS_ASSUME_NONNULL_BEGIN
     (const facebook::react::AttributedString &)attributedString;
 
 /**
- * Build an NSAttributedString from a C++ AttributedString with link URLs.
+ * Build an NSAttributedString from a C++ AttributedString with links.
  *
  * @param attributedString The C++ AttributedString from state
- * @param linkUrls Vector of link URLs indexed by fragment position (empty string for non-links)
+ * @param links Link URLs by fragment range
  * @return NSAttributedString with equivalent styling and clickable links
  */
 + (NSAttributedString *)buildAttributedStringFromCppAttributedString:
     (const facebook::react::AttributedString &)attributedString
-    withLinkUrls:(const std::vector<std::string> &)linkUrls;
+    withLinks:(const facebook::react::parsing::LinkTable &)links;
+
+/**
+ * Build an NSAttributedString from a range of fragments of a C++
+ * AttributedString, such as the fragments a TextDelta inserts.
+ *
+ * @param attributedString The C++ AttributedString from state
+ * @param links Link URLs by fragment range
+ * @param fragmentRange Indices of the fragments to include
+ * @return NSAttributedString of those fragments alone
+ */
++ (NSAttributedString *)buildAttributedStringFromCppAttributedString:
+    (const facebook::react::AttributedString &)attributedString
+    withLinks:(const facebook::react::parsing::LinkTable &)links
+    fragmentRange:(NSRange)fragmentRange;
+
+/**
+ * Build an NSAttributedString from a C++ AttributedString and its UTF-16 index.
+ * Creates the string once from the index's UTF-16 text and applies each
+ * fragment's attributes over its range, instead of transcoding each fragment.
+ * Falls back to the per-fragment build if the index has no text.
+ *
+ * @param attributedString The C++ AttributedString from state
+ * @param links Link URLs by fragment range
+ * @param utf16Index Index built for attributedString with includeText
+ * @return NSAttributedString with equivalent styling and clickable links
+ */
++ (NSAttributedString *)buildAttributedStringFromCppAttributedString:
+    (const facebook::react::AttributedString &)attributedString
+    withLinks:(const facebook::react::parsing::LinkTable &)links
+    utf16Index:(const facebook::react::parsing::Utf16TextIndex &)utf16Index;
 
 @end
 
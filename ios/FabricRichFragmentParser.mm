@@ -7,6 +7,8 @@
 #import "FabricRichFragmentParser.h"
 #import <CoreText/CoreText.h>
 
+#include <algorithm>
+
 #if __has_include(<FabricHtmlText/FabricHtmlText-Swift.h>)
 #import <FabricHtmlText/FabricHtmlText-Swift.h>
 #elif __has_include("NativeTestHarness-Swift.h")
@@ -21,153 +23,215 @@ using namespace facebook::react;
 
 + (NSAttributedString *)buildAttributedStringFromCppAttributedString:
     (const AttributedString &)attributedString {
-    // Call the version with empty link URLs for backwards compatibility
+    // Call the version with no links for backwards compatibility
+    return [self buildAttributedStringFromCppAttributedString:attributedString
+                                                    withLinks:parsing::LinkTable()];
+}
+
+/**
+ * Attributes for one fragment, without its link.
+ */
++ (NSMutableDictionary *)attributesForFragment:(const AttributedString::Fragment &)fragment {
+    NSMutableDictionary *attributes = [NSMutableDictionary dictionary];
+    const auto& textAttrs = fragment.textAttributes;
+
+    // Font size
+    CGFloat fontSize = textAttrs.fontSize > 0 ? textAttrs.fontSize : FabricGeneratedConstants.defaultFontSize;
+
+    // Font weight and style
+    BOOL isBold = textAttrs.fontWeight == FontWeight::Bold ||
+                  textAttrs.fontWeight == FontWeight::Black ||
+                  textAttrs.fontWeight == FontWeight::Heavy ||
+                  textAttrs.fontWeight == FontWeight::Semibold;
+
+    BOOL isItalic = textAttrs.fontStyle == FontStyle::Italic;
+
+    // Build font with weight and style
+    UIFont *font;
+    if (isBold && isItalic) {
+        UIFontDescriptor *descriptor = [[UIFontDescriptor preferredFontDescriptorWithTextStyle:UIFontTextStyleBody]
+            fontDescriptorWithSymbolicTraits:UIFontDescriptorTraitBold | UIFontDescriptorTraitItalic];
+        font = [UIFont fontWithDescriptor:descriptor size:fontSize];
+        if (!font) {
+            // Fallback if combined traits not available
+            font = [UIFont boldSystemFontOfSize:fontSize];
+        }
+    } else if (isBold) {
+        font = [UIFont boldSystemFontOfSize:fontSize];
+    } else if (isItalic) {
+        font = [UIFont italicSystemFontOfSize:fontSize];
+    } else {
+        font = [UIFont systemFontOfSize:fontSize];
+    }
+    attributes[NSFontAttributeName] = font;
+
+    // Foreground color
+    if (textAttrs.foregroundColor) {
+        auto colorValue = *textAttrs.foregroundColor;
+        // Extract RGBA components (SharedColor is a 32-bit ARGB value)
+        CGFloat alpha = ((colorValue >> 24) & 0xFF) / 255.0;
+        CGFloat red = ((colorValue >> 16) & 0xFF) / 255.0;
+        CGFloat green = ((colorValue >> 8) & 0xFF) / 255.0;
+        CGFloat blue = (colorValue & 0xFF) / 255.0;
+        UIColor *color = [UIColor colorWithRed:red green:green blue:blue alpha:alpha];
+        attributes[NSForegroundColorAttributeName] = color;
+    }
+
+    // Background color
+    if (textAttrs.backgroundColor) {
+        auto colorValue = *textAttrs.backgroundColor;
+        CGFloat alpha = ((colorValue >> 24) & 0xFF) / 255.0;
+        CGFloat red = ((colorValue >> 16) & 0xFF) / 255.0;
+        CGFloat green = ((colorValue >> 8) & 0xFF) / 255.0;
+        CGFloat blue = (colorValue & 0xFF) / 255.0;
+        UIColor *color = [UIColor colorWithRed:red green:green blue:blue alpha:alpha];
+        attributes[NSBackgroundColorAttributeName] = color;
+    }
+
+    // Text decoration (underline, strikethrough)
+    if (textAttrs.textDecorationLineType.has_value()) {
+        switch (*textAttrs.textDecorationLineType) {
+            case TextDecorationLineType::Underline:
+                attributes[NSUnderlineStyleAttributeName] = @(NSUnderlineStyleSingle);
+                break;
+            case TextDecorationLineType::Strikethrough:
+                attributes[NSStrikethroughStyleAttributeName] = @(NSUnderlineStyleSingle);
+                break;
+            case TextDecorationLineType::UnderlineStrikethrough:
+                attributes[NSUnderlineStyleAttributeName] = @(NSUnderlineStyleSingle);
+                attributes[NSStrikethroughStyleAttributeName] = @(NSUnderlineStyleSingle);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Letter spacing
+    if (!std::isnan(textAttrs.letterSpacing) && textAttrs.letterSpacing != 0) {
+        attributes[NSKernAttributeName] = @(textAttrs.letterSpacing);
+    }
+
+    // Line height via paragraph style
+    if (!std::isnan(textAttrs.lineHeight) && textAttrs.lineHeight > 0) {
+        NSMutableParagraphStyle *paragraphStyle = [[NSMutableParagraphStyle alloc] init];
+        paragraphStyle.minimumLineHeight = textAttrs.lineHeight;
+        paragraphStyle.maximumLineHeight = textAttrs.lineHeight;
+        attributes[NSParagraphStyleAttributeName] = paragraphStyle;
+    }
+
+    return attributes;
+}
+
+/**
+ * URL for NSLinkAttributeName, or nil if it is not a URL or its scheme is not allowed.
+ * Validates the scheme to prevent XSS (e.g., javascript: URLs).
+ */
++ (nullable NSURL *)safeLinkUrl:(const std::string &)linkUrl {
+    NSString *urlString = [[NSString alloc] initWithBytes:linkUrl.data()
+                                                   length:linkUrl.size()
+                                                 encoding:NSUTF8StringEncoding];
+    if (!urlString) {
+        return nil;
+    }
+    NSURL *url = [NSURL URLWithString:urlString];
+    if (!url) {
+        return nil;
+    }
+
+    // Only allow safe URL schemes: http, https, mailto, tel
+    static NSSet *allowedSchemes = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        allowedSchemes = [NSSet setWithObjects:@"http", @"https", @"mailto", @"tel", nil];
+    });
+
+    // Skip potentially dangerous URLs (javascript:, data:, vbscript:, etc.)
+    NSString *scheme = url.scheme.lowercaseString;
+    return [allowedSchemes containsObject:scheme] ? url : nil;
+}
+
++ (NSAttributedString *)buildAttributedStringFromCppAttributedString:
+    (const AttributedString &)attributedString
+    withLinks:(const parsing::LinkTable &)links {
+
     return [self buildAttributedStringFromCppAttributedString:attributedString
-                                                 withLinkUrls:std::vector<std::string>()];
+                                                    withLinks:links
+                                                fragmentRange:NSMakeRange(0, attributedString.getFragments().size())];
 }
 
 + (NSAttributedString *)buildAttributedStringFromCppAttributedString:
     (const AttributedString &)attributedString
-    withLinkUrls:(const std::vector<std::string> &)linkUrls {
+    withLinks:(const parsing::LinkTable &)links
+    fragmentRange:(NSRange)fragmentRange {
 
     NSMutableAttributedString *result = [[NSMutableAttributedString alloc] init];
 
     const auto& fragments = attributedString.getFragments();
-    size_t fragmentIndex = 0;
+    size_t end = std::min<size_t>(NSMaxRange(fragmentRange), fragments.size());
 
-    for (const auto& fragment : fragments) {
+    for (size_t fragmentIndex = fragmentRange.location; fragmentIndex < end; fragmentIndex++) {
+        const auto& fragment = fragments[fragmentIndex];
         if (fragment.string.empty()) {
-            fragmentIndex++;
-            continue;
-        }
-
-        NSString *text = [[NSString alloc] initWithUTF8String:fragment.string.c_str()];
-        if (!text) {
-            fragmentIndex++;
             continue;
         }
 
-        NSMutableDictionary *attributes = [NSMutableDictionary dictionary];
-        const auto& textAttrs = fragment.textAttributes;
-
-        // Font size
-        CGFloat fontSize = textAttrs.fontSize > 0 ? textAttrs.fontSize : FabricGeneratedConstants.defaultFontSize;
-
-        // Font weight and style
-        BOOL isBold = textAttrs.fontWeight == FontWeight::Bold ||
-                      textAttrs.fontWeight == FontWeight::Black ||
-                      textAttrs.fontWeight == FontWeight::Heavy ||
-                      textAttrs.fontWeight == FontWeight::Semibold;
-
-        BOOL isItalic = textAttrs.fontStyle == FontStyle::Italic;
-
-        // Build font with weight and style
-        UIFont *font;
-        if (isBold && isItalic) {
-            UIFontDescriptor *descriptor = [[UIFontDescriptor preferredFontDescriptorWithTextStyle:UIFontTextStyleBody]
-                fontDescriptorWithSymbolicTraits:UIFontDescriptorTraitBold | UIFontDescriptorTraitItalic];
-            font = [UIFont fontWithDescriptor:descriptor size:fontSize];
-            if (!font) {
-                // Fallback if combined traits not available
-                font = [UIFont boldSystemFontOfSize:fontSize];
-            }
-        } else if (isBold) {
-            font = [UIFont boldSystemFontOfSize:fontSize];
-        } else if (isItalic) {
-            font = [UIFont italicSystemFontOfSize:fontSize];
-        } else {
-            font = [UIFont systemFontOfSize:fontSize];
-        }
-        attributes[NSFontAttributeName] = font;
-
-        // Foreground color
-        if (textAttrs.foregroundColor) {
-            auto colorValue = *textAttrs.foregroundColor;
-            // Extract RGBA components (SharedColor is a 32-bit ARGB value)
-            CGFloat alpha = ((colorValue >> 24) & 0xFF) / 255.0;
-            CGFloat red = ((colorValue >> 16) & 0xFF) / 255.0;
-            CGFloat green = ((colorValue >> 8) & 0xFF) / 255.0;
-            CGFloat blue = (colorValue & 0xFF) / 255.0;
-            UIColor *color = [UIColor colorWithRed:red green:green blue:blue alpha:alpha];
-            attributes[NSForegroundColorAttributeName] = color;
-        }
-
-        // Background color
-        if (textAttrs.backgroundColor) {
-            auto colorValue = *textAttrs.backgroundColor;
-            CGFloat alpha = ((colorValue >> 24) & 0xFF) / 255.0;
-            CGFloat red = ((colorValue >> 16) & 0xFF) / 255.0;
-            CGFloat green = ((colorValue >> 8) & 0xFF) / 255.0;
-            CGFloat blue = (colorValue & 0xFF) / 255.0;
-            UIColor *color = [UIColor colorWithRed:red green:green blue:blue alpha:alpha];
-            attributes[NSBackgroundColorAttributeName] = color;
-        }
-
-        // Text decoration (underline, strikethrough)
-        if (textAttrs.textDecorationLineType.has_value()) {
-            switch (*textAttrs.textDecorationLineType) {
-                case TextDecorationLineType::Underline:
-                    attributes[NSUnderlineStyleAttributeName] = @(NSUnderlineStyleSingle);
-                    break;
-                case TextDecorationLineType::Strikethrough:
-                    attributes[NSStrikethroughStyleAttributeName] = @(NSUnderlineStyleSingle);
-                    break;
-                case TextDecorationLineType::UnderlineStrikethrough:
-                    attributes[NSUnderlineStyleAttributeName] = @(NSUnderlineStyleSingle);
-                    attributes[NSStrikethroughStyleAttributeName] = @(NSUnderlineStyleSingle);
-                    break;
-                default:
-                    break;
-            }
-        }
-
-        // Letter spacing
-        if (!std::isnan(textAttrs.letterSpacing) && textAttrs.letterSpacing != 0) {
-            attributes[NSKernAttributeName] = @(textAttrs.letterSpacing);
-        }
-
-        // Line height via paragraph style
-        if (!std::isnan(textAttrs.lineHeight) && textAttrs.lineHeight > 0) {
-            NSMutableParagraphStyle *paragraphStyle = [[NSMutableParagraphStyle alloc] init];
-            paragraphStyle.minimumLineHeight = textAttrs.lineHeight;
-            paragraphStyle.maximumLineHeight = textAttrs.lineHeight;
-            attributes[NSParagraphStyleAttributeName] = paragraphStyle;
-        }
+        // Fragment strings are valid UTF-8: markup is repaired before parsing
+        NSString *text = [[NSString alloc] initWithBytes:fragment.string.data()
+                                                  length:fragment.string.size()
+                                                encoding:NSUTF8StringEncoding];
 
+        NSMutableDictionary *attributes = [self attributesForFragment:fragment];
         // Link URL - set NSLinkAttributeName for clickable links
-        // Validate URL scheme to prevent XSS (e.g., javascript: URLs)
-        if (fragmentIndex < linkUrls.size()) {
-            const std::string& linkUrl = linkUrls[fragmentIndex];
-            if (!linkUrl.empty()) {
-                NSString *urlString = [[NSString alloc] initWithUTF8String:linkUrl.c_str()];
-                if (urlString) {
-                    NSURL *url = [NSURL URLWithString:urlString];
-                    if (url) {
-                        // Only allow safe URL schemes: http, https, mailto, tel
-                        static NSSet *allowedSchemes = nil;
-                        static dispatch_once_t onceToken;
-                        dispatch_once(&onceToken, ^{
-                            allowedSchemes = [NSSet setWithObjects:@"http", @"https", @"mailto", @"tel", nil];
-                        });
-
-                        NSString *scheme = url.scheme.lowercaseString;
-                        if ([allowedSchemes containsObject:scheme]) {
-                            attributes[NSLinkAttributeName] = url;
-                        }
-                        // Skip potentially dangerous URLs (javascript:, data:, vbscript:, etc.)
-                    }
-                }
-            }
+        const std::string *linkUrl = links.urlAt(fragmentIndex);
+        NSURL *url = linkUrl ? [self safeLinkUrl:*linkUrl] : nil;
+        if (url) {
+            attributes[NSLinkAttributeName] = url;
         }
 
         NSAttributedString *fragmentString = [[NSAttributedString alloc]
             initWithString:text
                 attributes:attributes];
         [result appendAttributedString:fragmentString];
-        fragmentIndex++;
     }
 
     return result;
 }
 
++ (NSAttributedString *)buildAttributedStringFromCppAttributedString:
+    (const AttributedString &)attributedString
+    withLinks:(const parsing::LinkTable &)links
+    utf16Index:(const parsing::Utf16TextIndex &)utf16Index {
+
+    const auto& fragments = attributedString.getFragments();
+    const auto& starts = utf16Index.fragmentStarts();
+    const auto& text = utf16Index.text();
+    if (starts.size() != fragments.size() + 1 || text.size() != utf16Index.length()) {
+        // Index built without text, or for another string
+        return [self buildAttributedStringFromCppAttributedString:attributedString withLinks:links];
+    }
+
+    // One string for the whole text; fragments only set attributes over their ranges
+    NSString *string = [[NSString alloc] initWithCharacters:reinterpret_cast<const unichar *>(text.data())
+                                                     length:text.size()];
+    NSMutableAttributedString *result = [[NSMutableAttributedString alloc] initWithString:string];
+
+    [result beginEditing];
+    for (size_t fragmentIndex = 0; fragmentIndex < fragments.size(); fragmentIndex++) {
+        NSRange range = NSMakeRange(starts[fragmentIndex], starts[fragmentIndex + 1] - starts[fragmentIndex]);
+        if (range.length > 0) {
+            [result setAttributes:[self attributesForFragment:fragments[fragmentIndex]] range:range];
+        }
+    }
+    // One NSURL per link, however many styled fragments it spans
+    for (const auto& link : utf16Index.linkRanges()) {
+        NSURL *url = [self safeLinkUrl:links.urls()[link.urlId]];
+        if (url && link.end > link.start) {
+            [result addAttribute:NSLinkAttributeName value:url range:NSMakeRange(link.start, link.end - link.start)];
+        }
+    }
+    [result endEditing];
+
+    return result;
+}
+
 @end
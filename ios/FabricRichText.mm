@@ -2,6 +2,7 @@
 #import "FabricRichCoreTextView.h"
 #import "FabricRichFragmentParser.h"
 #import "FabricRichTextShadowNode.h"
+#import "../cpp/parsing/AttributedStringBuilder.h"
 
 #import "FabricRichTextComponentDescriptor.h"
 #import <react/renderer/components/FabricRichTextSpec/EventEmitters.h>
@@ -33,6 +34,9 @@ using namespace facebook::react;
     FabricRichCoreTextView *_coreTextView;
     CGFloat _previousHeight;
     BOOL _hasInitializedLayout;
+    // Content hash of the state the core text view's text was built from;
+    // state deltas against that hash are patched into its text in place
+    uint64_t _stateContentHash;
 }
 
 + (ComponentDescriptorProvider)componentDescriptorProvider
@@ -104,28 +108,50 @@ using namespace facebook::react;
 
     const auto& stateData = htmlState->getData();
     const auto& attributedString = stateData.attributedString;
-    const auto& linkUrls = stateData.linkUrls;
+    const auto& links = stateData.links;
 
     if (attributedString.isEmpty()) {
         _coreTextView.attributedText = nil;
+        _stateContentHash = 0;
         return;
     }
 
-    // Convert C++ AttributedString to NSAttributedString using fragment parser
-    // Pass link URLs so NSLinkAttributeName can be set for clickable links
-    NSAttributedString *nsAttributedString = [FabricRichFragmentParser
-        buildAttributedStringFromCppAttributedString:attributedString
-                                        withLinkUrls:linkUrls];
+    const auto& delta = stateData.delta;
+    bool patched = delta && _stateContentHash != 0 && delta->baseHash == _stateContentHash;
+    if (patched && !delta->empty()) {
+        // Still showing the delta's base: only build the changed fragments
+        // and splice them into the view's text
+        NSAttributedString *inserted =
+            [FabricRichFragmentParser buildAttributedStringFromCppAttributedString:attributedString
+                                                                         withLinks:links
+                                                                     fragmentRange:NSMakeRange(delta->first, delta->inserted)];
+        patched = [_coreTextView replaceTextInRange:NSMakeRange(delta->utf16Start, delta->utf16Removed)
+                               withAttributedString:inserted];
+    }
+    if (!patched) {
+        // Convert C++ AttributedString to NSAttributedString using fragment parser
+        // Pass links so NSLinkAttributeName can be set for clickable links
+        NSAttributedString *nsAttributedString = stateData.utf16Index
+            ? [FabricRichFragmentParser buildAttributedStringFromCppAttributedString:attributedString
+                                                                           withLinks:links
+                                                                          utf16Index:*stateData.utf16Index]
+            : [FabricRichFragmentParser buildAttributedStringFromCppAttributedString:attributedString
+                                                                           withLinks:links];
+        _coreTextView.attributedText = nsAttributedString;
+    }
+    _stateContentHash = stateData.contentHash;
 
     // Extract numberOfLines, animationDuration, and writingDirection from state
     int numberOfLines = stateData.numberOfLines;
     Float animationDuration = stateData.animationDuration;
     bool isRTL = (stateData.writingDirection == WritingDirectionState::RTL);
 
-    // Extract accessibility label from state (built by C++ parser with proper pauses)
+    // Accessibility label with pauses between list items. Without pauses it
+    // is the text itself, which the view falls back to when it is nil.
     NSString *a11yLabel = nil;
-    if (!stateData.accessibilityLabel.empty()) {
-        a11yLabel = [[NSString alloc] initWithUTF8String:stateData.accessibilityLabel.c_str()];
+    if (!stateData.accessibilityPauses.empty()) {
+        auto label = parsing::buildAccessibilityLabel(attributedString, stateData.accessibilityPauses);
+        a11yLabel = [[NSString alloc] initWithUTF8String:label.c_str()];
     }
 
     // Update CoreText view properties
@@ -133,7 +159,7 @@ using namespace facebook::react;
     _coreTextView.animationDuration = animationDuration;
     _coreTextView.isRTL = isRTL;
     _coreTextView.resolvedAccessibilityLabel = a11yLabel;
-    _coreTextView.attributedText = nsAttributedString;
+    _coreTextView.mayHaveLinks = stateData.summary.has(parsing::DocumentFeature::Links);
 }
 
 - (void)updateProps:(Props::Shared const &)props oldProps:(Props::Shared const &)oldProps
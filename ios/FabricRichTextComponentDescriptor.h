@@ -13,8 +13,22 @@ namespace facebook::react {
  * This descriptor uses our custom FabricRichTextShadowNode instead of
  * the default codegen-generated ShadowNode. This enables proper Yoga
  * layout measurement for HTML text content.
+ *
+ * adopt() runs for every new or cloned shadow node before layout. Parsing
+ * starts there, so measureContent() inside Yoga's layout pass only picks
+ * up the result. Clones with unchanged text and style do no parsing.
  */
-using FabricRichTextComponentDescriptor =
-    ConcreteComponentDescriptor<FabricRichTextShadowNode>;
+class FabricRichTextComponentDescriptor final
+    : public ConcreteComponentDescriptor<FabricRichTextShadowNode> {
+ public:
+  using ConcreteComponentDescriptor::ConcreteComponentDescriptor;
+
+  void adopt(ShadowNode& shadowNode) const override {
+    ConcreteComponentDescriptor::adopt(shadowNode);
+
+    auto& richTextShadowNode = static_cast<FabricRichTextShadowNode&>(shadowNode);
+    richTextShadowNode.prepareContent();
+  }
+};
 
 } // namespace facebook::react
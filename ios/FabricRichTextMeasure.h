@@ -0,0 +1,24 @@
+#import <Foundation/Foundation.h>
+
+#ifdef __cplusplus
+#import <FabricRichTextSpec/FabricRichTextSpec.h>
+#import <ReactCommon/RCTTurboModuleWithJSIBindings.h>
+#endif
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * TurboModule that installs measureRichTextBatch()'s JSI function.
+ *
+ * Batches are measured with the same TextLayoutManager as the shadow
+ * node, so their sizes also serve rows measured after mounting.
+ */
+#ifdef __cplusplus
+@interface FabricRichTextMeasure : NSObject <NativeFabricRichTextMeasureSpec, RCTTurboModuleWithJSIBindings>
+#else
+@interface FabricRichTextMeasure : NSObject
+#endif
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,85 @@
+#import "FabricRichTextMeasure.h"
+
+#import <React/RCTUtils.h>
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+
+#include "../cpp/FabricBatchMeasureJSI.h"
+#include "../cpp/FabricPipelineMetricsJSI.h"
+
+#include <limits>
+
+using namespace facebook::react;
+
+namespace {
+
+/**
+ * Measures like FabricRichTextShadowNode::measureContent() at a width.
+ */
+class PlatformTextMeasurer : public TextMeasurer {
+ public:
+  explicit PlatformTextMeasurer(Float pointScaleFactor)
+      : textLayoutManager_(std::make_shared<const TextLayoutManager>(nullptr)),
+        pointScaleFactor_(pointScaleFactor) {}
+
+  MeasuredText measure(const AttributedString& attributedString, float width, int numberOfLines) const override {
+    auto paragraphAttributes = ParagraphAttributes{};
+    paragraphAttributes.maximumNumberOfLines = (numberOfLines > 0) ? numberOfLines : 0;
+    paragraphAttributes.ellipsizeMode = EllipsizeMode::Tail;
+
+    TextLayoutContext textLayoutContext{};
+    textLayoutContext.pointScaleFactor = pointScaleFactor_;
+
+    Size maximumSize{width, std::numeric_limits<Float>::infinity()};
+    auto measurement = textLayoutManager_->measure(
+        AttributedStringBox{attributedString},
+        paragraphAttributes,
+        textLayoutContext,
+        LayoutConstraints{Size{0, 0}, maximumSize});
+    auto lines = textLayoutManager_->measureLines(
+        AttributedStringBox{attributedString}, ParagraphAttributes{}, maximumSize);
+
+    return MeasuredText{
+        static_cast<float>(measurement.size.width),
+        static_cast<float>(measurement.size.height),
+        lines.size()};
+  }
+
+  MeasureSource source() const override {
+    return MeasureSource::Platform;
+  }
+
+  float pointScaleFactor() const override {
+    return pointScaleFactor_;
+  }
+
+ private:
+  std::shared_ptr<const TextLayoutManager> textLayoutManager_;
+  Float pointScaleFactor_;
+};
+
+} // namespace
+
+@implementation FabricRichTextMeasure
+
+RCT_EXPORT_MODULE(FabricRichTextMeasure)
+
+- (void)installJSIBindingsWithRuntime:(facebook::jsi::Runtime &)runtime
+                          callInvoker:(const std::shared_ptr<facebook::react::CallInvoker> &)callInvoker
+{
+    installFabricBatchMeasure(runtime, callInvoker, std::make_shared<PlatformTextMeasurer>(RCTScreenScale()));
+    installFabricPipelineMetrics(runtime);
+}
+
+- (NSNumber *)install
+{
+    // The function is installed when the module is created, before JS can call this
+    return @YES;
+}
+
+- (std::shared_ptr<facebook::react::TurboModule>)getTurboModule:
+    (const facebook::react::ObjCTurboModule::InitParams &)params
+{
+    return std::make_shared<facebook::react::NativeFabricRichTextMeasureSpecJSI>(params);
+}
+
+@end
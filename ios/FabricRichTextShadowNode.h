@@ -7,6 +7,18 @@
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/ShadowNode.h>
 
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "../cpp/FabricPreparedMarkup.h"
+#include "../cpp/parsing/DocumentSummary.h"
+#include "../cpp/parsing/IncrementalParseSession.h"
+#include "../cpp/parsing/LinkTable.h"
+#include "../cpp/parsing/TextDelta.h"
+#include "../cpp/parsing/Utf16TextIndex.h"
+
 namespace facebook::react {
 
 extern const char FabricRichTextComponentName[];
@@ -27,16 +39,25 @@ enum class WritingDirectionState {
 class FabricRichTextStateData final {
  public:
   AttributedString attributedString;
-  // Link URLs indexed by fragment position (empty string for non-links)
-  std::vector<std::string> linkUrls;
+  // Link URLs by fragment range
+  parsing::LinkTable links;
   // Maximum number of lines to display (0 = no limit)
   int numberOfLines{0};
   // Animation duration for height changes in seconds (0 = instant)
   Float animationDuration{0.2f};
   // Base writing direction for text content
   WritingDirectionState writingDirection{WritingDirectionState::LTR};
-  // Screen reader friendly version of text with pauses between list items
-  std::string accessibilityLabel;
+  // Where the screen reader label pauses between list items; the label is
+  // built from attributedString only when there are pauses
+  std::vector<uint32_t> accessibilityPauses;
+  // UTF-16 text and offsets of attributedString, shared with the parse result
+  std::shared_ptr<const parsing::Utf16TextIndex> utf16Index;
+  // What attributedString contains, so the view can skip link and bidi work
+  parsing::DocumentSummary summary;
+  // parsing::contentHash() of attributedString and links (0 = none yet)
+  uint64_t contentHash{0};
+  // Fragments changed since the previous state, for views still showing it
+  std::optional<parsing::TextDelta> delta;
 };
 
 /**
@@ -48,6 +69,9 @@ class FabricRichTextStateData final {
  * 3. Overriding measureContent() to measure HTML text content
  * 4. Using TextLayoutManager for platform-specific text measurement
  *
+ * Markup is parsed (and sanitized while tokenizing) when props are adopted
+ * (see prepareContent()), so measureContent() only picks up the result.
+ *
  * Based on the pattern from:
  * - React Native's ParagraphShadowNode
  * - Bluesky's react-native-uitextview
@@ -73,29 +97,57 @@ class FabricRichTextShadowNode final : public ConcreteViewShadowNode<
 
   void layout(LayoutContext layoutContext) override;
 
+  /**
+   * Start parsing props.text for the current props.
+   * Called by FabricRichTextComponentDescriptor::adopt(); does nothing
+   * when text and style are unchanged from the source node.
+   */
+  void prepareContent();
+
   Size measureContent(
       const LayoutContext& layoutContext,
       const LayoutConstraints& layoutConstraints) const override;
 
  private:
   /**
-   * Parses HTML string and builds an AttributedString for measurement.
-   * This is a simplified parser that extracts text and basic styling
-   * for layout measurement. The native view uses the full HTML parser
-   * for actual rendering.
+   * Parses HTML string into the AttributedString, links and UTF-16 index
+   * used for measurement and passed to the view through state.
+   * Prepared markup shares its result rather than copying it per measure.
+   * @param budget Lines to parse for a numberOfLines preview (unlimited = all)
    */
-  AttributedString parseHtmlToAttributedString(
+  FabricPreparedMarkup::ParseResultPtr parseHtml(
       const std::string& html,
-      Float fontSizeMultiplier) const;
+      Float fontSizeMultiplier,
+      const ContentBudget& budget = {}) const;
+
+  /**
+   * Style options for the shared parser from the current props.
+   */
+  StyleOptions styleOptions(Float fontSizeMultiplier) const;
 
   /**
    * Strips HTML tags from a string, returning plain text content.
    */
   static std::string stripHtmlTags(const std::string& html);
 
-  mutable AttributedString _attributedString;
-  mutable std::vector<std::string> _linkUrls;
-  mutable std::string _accessibilityLabel;
+  // Mutex protecting mutable members from concurrent access.
+  // measureContent() may be called concurrently by Fabric's layout system.
+  mutable std::mutex _mutex;
+  // Last measured result, read by layout(); null until measured
+  mutable FabricPreparedMarkup::ParseResultPtr _parseResult;
+
+  /**
+   * Incremental parser shared with clones of this node. When props.text
+   * grows by appends (streamed content), only the new tail is parsed.
+   */
+  std::shared_ptr<parsing::IncrementalParseSession> _parseSession =
+      std::make_shared<parsing::IncrementalParseSession>();
+
+  /**
+   * Parse started by prepareContent(), shared with clones while text and
+   * style are unchanged.
+   */
+  std::shared_ptr<FabricPreparedMarkup> _preparedMarkup;
 };
 
 } // namespace facebook::react
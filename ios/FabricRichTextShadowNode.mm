@@ -7,18 +7,11 @@
 
 #import "FabricRichTextShadowNode.h"
 #import "../cpp/FabricMarkupParser.h"
+#import "../cpp/FabricBatchMeasure.h"
 
 #import <react/renderer/components/view/ViewShadowNode.h>
 #import <react/renderer/textlayoutmanager/TextLayoutManager.h>
 
-#if __has_include(<FabricRichText/FabricRichText-Swift.h>)
-#import <FabricRichText/FabricRichText-Swift.h>
-#elif __has_include("NativeTestHarness-Swift.h")
-#import "NativeTestHarness-Swift.h"
-#else
-#import "FabricRichText-Swift.h"
-#endif
-
 namespace facebook::react {
 
 extern const char FabricRichTextComponentName[] = "FabricRichText";
@@ -26,60 +19,75 @@ extern const char FabricRichTextComponentName[] = "FabricRichText";
 FabricRichTextShadowNode::FabricRichTextShadowNode(
     const ShadowNode& sourceShadowNode,
     const ShadowNodeFragment& fragment)
-    : ConcreteViewShadowNode(sourceShadowNode, fragment) {}
+    : ConcreteViewShadowNode(sourceShadowNode, fragment),
+      _parseSession(static_cast<const FabricRichTextShadowNode&>(sourceShadowNode)._parseSession),
+      _preparedMarkup(static_cast<const FabricRichTextShadowNode&>(sourceShadowNode)._preparedMarkup) {}
 
 std::string FabricRichTextShadowNode::stripHtmlTags(const std::string& html) {
     // Delegate to shared parser
     return FabricMarkupParser::stripMarkupTags(html);
 }
 
-AttributedString FabricRichTextShadowNode::parseHtmlToAttributedString(
-    const std::string& html,
-    Float fontSizeMultiplier) const {
-
-    if (html.empty()) {
-        _linkUrls.clear();
-        _accessibilityLabel.clear();
-        return AttributedString{};
-    }
-
+StyleOptions FabricRichTextShadowNode::styleOptions(Float fontSizeMultiplier) const {
     const auto& props = getConcreteProps();
 
-    // Sanitize HTML using Swift bridge to SwiftSoup
-    NSString *rawHtml = [[NSString alloc] initWithUTF8String:html.c_str()];
-    FabricRichSanitizer *sanitizer = [[FabricRichSanitizer alloc] init];
-    NSString *sanitizedHtml = [sanitizer sanitize:rawHtml];
-    std::string sanitizedHtmlStr = [sanitizedHtml UTF8String] ?: "";
-
     // Extract props for the shared parser
     Float baseFontSize = 14.0f;
     if (!std::isnan(props.fontSize) && props.fontSize > 0) {
         baseFontSize = props.fontSize;
     }
 
-    bool allowFontScaling = props.allowFontScaling;
-    Float maxFontSizeMultiplier = props.maxFontSizeMultiplier;
-    Float lineHeight = props.lineHeight;
-    int32_t color = props.color;
-
-    // Call parser with all props - get link URLs too
-    auto parseResult = FabricMarkupParser::parseMarkupWithLinkUrls(
-        sanitizedHtmlStr,
-        baseFontSize,
-        fontSizeMultiplier,
-        allowFontScaling,
-        maxFontSizeMultiplier,
-        lineHeight,
-        props.fontWeight,
-        props.fontFamily,
-        props.fontStyle,
-        props.letterSpacing,
-        color,
-        props.tagStyles);
-
-    _linkUrls = std::move(parseResult.linkUrls);
-    _accessibilityLabel = std::move(parseResult.accessibilityLabel);
-    return parseResult.attributedString;
+    StyleOptions options;
+    options.baseFontSize = baseFontSize;
+    options.fontSizeMultiplier = fontSizeMultiplier;
+    options.allowFontScaling = props.allowFontScaling;
+    options.maxFontSizeMultiplier = props.maxFontSizeMultiplier;
+    options.lineHeight = props.lineHeight;
+    options.fontWeight = props.fontWeight;
+    options.fontFamily = props.fontFamily;
+    options.fontStyle = props.fontStyle;
+    options.letterSpacing = props.letterSpacing;
+    options.color = props.color;
+    options.tagStyles = props.tagStyles;
+    return options;
+}
+
+void FabricRichTextShadowNode::prepareContent() {
+    const auto& props = getConcreteProps();
+    auto options = styleOptions(FabricPreparedMarkup::predictedFontSizeMultiplier());
+
+    if (_preparedMarkup && _preparedMarkup->matches(props.text, options, props.numberOfLines)) {
+        return;
+    }
+
+    // The shared parser sanitizes against the allowlist while tokenizing
+    _preparedMarkup = FabricPreparedMarkup::prepare(
+        _preparedMarkup, _parseSession, props.text, options, props.numberOfLines);
+}
+
+FabricPreparedMarkup::ParseResultPtr FabricRichTextShadowNode::parseHtml(
+    const std::string& html,
+    Float fontSizeMultiplier,
+    const ContentBudget& budget) const {
+
+    if (html.empty()) {
+        static const auto empty = std::make_shared<const FabricMarkupParser::ParseResult>();
+        return empty;
+    }
+
+    auto options = styleOptions(fontSizeMultiplier);
+
+    // Pick up the result prepared when props were adopted. Nodes that were
+    // never adopted parse here, through the same incremental session.
+    // The view builds its NSAttributedString from the UTF-16 index; prepared
+    // markup keeps it with the result, so repeated measures don't rebuild it.
+    if (_preparedMarkup) {
+        return _preparedMarkup->resolve(options, true, budget);
+    }
+    auto parseResult = std::make_shared<FabricMarkupParser::ParseResult>(
+        FabricMarkupParser::parseMarkupIncremental(*_parseSession, html, options));
+    FabricMarkupParser::buildUtf16Index(*parseResult);
+    return parseResult;
 }
 
 Size FabricRichTextShadowNode::measureContent(
@@ -92,16 +100,30 @@ Size FabricRichTextShadowNode::measureContent(
         return Size{0, 0};
     }
 
+    TraceScope trace("measureContent", parsing::TraceArgs{0, props.text.size(), 0});
+
     // Calculate font size multiplier for accessibility scaling
     Float fontSizeMultiplier = 1.0;
     if (layoutContext.fontSizeMultiplier > 0) {
         fontSizeMultiplier = layoutContext.fontSizeMultiplier;
     }
 
-    // Parse HTML to AttributedString using shared parser
-    _attributedString = parseHtmlToAttributedString(props.text, fontSizeMultiplier);
+    // Take the result prepared when props were adopted and keep it for
+    // layout() under the mutex; the result is immutable, so measure it
+    // outside of the mutex without copying.
+    // With numberOfLines, only the text the visible lines can hold at this
+    // width is parsed.
+    auto budget = ContentBudget::forLines(props.numberOfLines, layoutConstraints.maximumSize.width);
+    FabricPreparedMarkup::ParseResultPtr parsed;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        parsed = parseHtml(props.text, fontSizeMultiplier, budget);
+        _parseResult = parsed;
+    }
+    const auto& attributedString = parsed->attributedString;
+    trace.args().fragments = attributedString.getFragments().size();
 
-    if (_attributedString.isEmpty()) {
+    if (attributedString.isEmpty()) {
         return Size{0, 0};
     }
 
@@ -112,6 +134,18 @@ Size FabricRichTextShadowNode::measureContent(
     paragraphAttributes.maximumNumberOfLines = (numberOfLines > 0) ? numberOfLines : 0;
     paragraphAttributes.ellipsizeMode = EllipsizeMode::Tail;
 
+    // Rows measured at this width by measureRichTextBatch() before mounting
+    bool widthOnly = layoutConstraints.minimumSize.width == 0 && layoutConstraints.minimumSize.height == 0 &&
+        std::isinf(layoutConstraints.maximumSize.height);
+    if (widthOnly) {
+        auto key = FabricBatchMeasure::cacheKey(
+            props.text, styleOptions(fontSizeMultiplier), layoutConstraints.maximumSize.width,
+            numberOfLines, MeasureSource::Platform, layoutContext.pointScaleFactor);
+        if (auto measured = MeasureCache::shared().find(key)) {
+            return Size{measured->width, measured->height};
+        }
+    }
+
     // Set up text layout context
     TextLayoutContext textLayoutContext{};
     textLayoutContext.pointScaleFactor = layoutContext.pointScaleFactor;
@@ -120,8 +154,9 @@ Size FabricRichTextShadowNode::measureContent(
     const auto textLayoutManager = std::make_shared<const TextLayoutManager>(
         getContextContainer());
 
+    PhaseTimer timer(MetricPhase::Measure, props.text.size());
     auto measuredSize = textLayoutManager->measure(
-        AttributedStringBox{_attributedString},
+        AttributedStringBox{attributedString},
         paragraphAttributes,
         textLayoutContext,
         layoutConstraints);
@@ -133,6 +168,7 @@ void FabricRichTextShadowNode::layout(LayoutContext layoutContext) {
     ensureUnsealed();
 
     const auto& props = getConcreteProps();
+    TraceScope trace("layout", parsing::TraceArgs{0, props.text.size(), 0});
 
     // Create paragraph attributes for state
     auto paragraphAttributes = ParagraphAttributes{};
@@ -155,7 +191,42 @@ void FabricRichTextShadowNode::layout(LayoutContext layoutContext) {
         // "ltr" or any other value defaults to LTR
     }
 
-    setStateData(FabricRichTextStateData{_attributedString, _linkUrls, effectiveNumberOfLines, animationDuration, writingDirection, _accessibilityLabel});
+    // Take the measured result under mutex protection to avoid data races;
+    // state copies its fields once, here
+    FabricPreparedMarkup::ParseResultPtr parsed;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        parsed = _parseResult;
+    }
+    static const FabricMarkupParser::ParseResult kUnmeasured;
+    const auto& result = parsed ? *parsed : kUnmeasured;
+    const auto& localAttributedString = result.attributedString;
+    const auto& localLinks = result.links;
+
+    FabricRichTextStateData stateData{localAttributedString, localLinks, effectiveNumberOfLines, animationDuration, writingDirection, result.accessibilityPauses, result.utf16Index, result.summary};
+
+    // Describe the change from the previous state's content, so a view
+    // still showing it can patch the changed fragments instead of rebuilding
+    const auto& previous = getStateData();
+    if (previous.contentHash != 0 && previous.attributedString == localAttributedString && previous.links == localLinks) {
+        stateData.contentHash = previous.contentHash;
+        stateData.delta = parsing::TextDelta{previous.contentHash};
+    } else {
+        PhaseTimer timer(MetricPhase::Serialize, props.text.size());
+        stateData.contentHash = parsing::contentHash(localAttributedString, localLinks);
+        if (previous.contentHash != 0) {
+            stateData.delta = parsing::diffFragments(previous.attributedString, previous.links, localAttributedString, localLinks);
+            stateData.delta->baseHash = previous.contentHash;
+        }
+    }
+
+    {
+        TraceScope stateTrace("setStateData", parsing::TraceArgs{
+            stateData.contentHash, props.text.size(), stateData.attributedString.getFragments().size()});
+        trace.args().hash = stateData.contentHash;
+        trace.args().fragments = stateData.attributedString.getFragments().size();
+        setStateData(std::move(stateData));
+    }
 
     ConcreteViewShadowNode::layout(layoutContext);
 }
@@ -0,0 +1,87 @@
+/**
+ * Generates cpp/parsing/GeneratedAllowlist.h from src/core/constants.ts.
+ *
+ * The shared C++ sanitizer filters tags, attributes and URL schemes while
+ * tokenizing. Its allowlist must match the one used on web and by the
+ * platform sanitizers, so it is generated from the same source of truth.
+ *
+ * Usage: node scripts/codegen-allowlist.js [--check]
+ *   --check  Exit with status 1 if the generated header is out of date
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+const rootDir = path.join(__dirname, '..');
+const constantsPath = path.join(rootDir, 'src/core/constants.ts');
+const outputPath = path.join(rootDir, 'cpp/parsing/GeneratedAllowlist.h');
+
+const LISTS = [
+  { name: 'ALLOWED_TAGS', cppName: 'kAllowedTags', doc: 'Tags kept by the sanitizer' },
+  { name: 'ALLOWED_ATTRIBUTES', cppName: 'kAllowedAttributes', doc: 'Attributes read from allowed tags' },
+  { name: 'ALLOWED_PROTOCOLS', cppName: 'kAllowedProtocols', doc: 'URL schemes allowed in href' },
+  { name: 'ALLOWED_DIR_VALUES', cppName: 'kAllowedDirValues', doc: 'Values allowed for the dir attribute' },
+];
+
+/**
+ * Extract the string literals of `export const NAME = [ ... ] as const;`.
+ */
+function readStringArray(source, name) {
+  const match = source.match(
+    new RegExp(`export const ${name} = \\[([\\s\\S]*?)\\] as const;`)
+  );
+  if (!match) {
+    throw new Error(`${name} not found in ${constantsPath}`);
+  }
+  const body = match[1].replace(/\/\/.*$/gm, '');
+  return [...body.matchAll(/'([^']*)'/g)].map((m) => m[1]);
+}
+
+function generate() {
+  const source = fs.readFileSync(constantsPath, 'utf8');
+  const lines = [
+    '// DO NOT EDIT - Generated by scripts/codegen-allowlist.js',
+    '// Source of truth: src/core/constants.ts',
+    '// Run: yarn codegen:allowlist',
+    '',
+    '#pragma once',
+    '',
+    '#include <array>',
+    '#include <string_view>',
+    '',
+    'namespace facebook::react::parsing {',
+  ];
+  for (const list of LISTS) {
+    const values = readStringArray(source, list.name);
+    lines.push('');
+    lines.push(`// ${list.doc} (${list.name})`);
+    lines.push(
+      `inline constexpr std::array<std::string_view, ${values.length}> ${list.cppName} = {`
+    );
+    for (const value of values) {
+      lines.push(`    "${value}",`);
+    }
+    lines.push('};');
+  }
+  lines.push('');
+  lines.push('} // namespace facebook::react::parsing');
+  lines.push('');
+  return lines.join('\n');
+}
+
+const generated = generate();
+if (process.argv.includes('--check')) {
+  const current = fs.existsSync(outputPath)
+    ? fs.readFileSync(outputPath, 'utf8')
+    : '';
+  if (current !== generated) {
+    console.error(
+      'cpp/parsing/GeneratedAllowlist.h is out of date. Run: yarn codegen:allowlist'
+    );
+    process.exit(1);
+  }
+  console.log('cpp/parsing/GeneratedAllowlist.h is up to date');
+} else {
+  fs.writeFileSync(outputPath, generated);
+  console.log(`Wrote ${path.relative(rootDir, outputPath)}`);
+}
@@ -0,0 +1,148 @@
+/**
+ * Generates cpp/parsing/GeneratedEntityTrie.h from scripts/data/html-entities.json.
+ *
+ * The shared C++ tokenizer decodes named character references while it
+ * scans text, so the HTML5 entity table is compiled into a constexpr trie
+ * that can be walked byte by byte without allocating.
+ *
+ * The data file is the WHATWG table (https://html.spec.whatwg.org/entities.json),
+ * reduced to the code points of each entity.
+ *
+ * Usage: node scripts/codegen-entities.js [--check]
+ *   --check  Exit with status 1 if the generated header is out of date
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+const rootDir = path.join(__dirname, '..');
+const entitiesPath = path.join(rootDir, 'scripts/data/html-entities.json');
+const outputPath = path.join(rootDir, 'cpp/parsing/GeneratedEntityTrie.h');
+
+const ENTRIES_PER_LINE = 6;
+
+/**
+ * Build the trie with each node's children stored contiguously and sorted
+ * by label, numbering nodes breadth-first from the root (node 0).
+ */
+function buildTrie(entities) {
+  const root = { label: '', children: new Map(), value: 0 };
+  const values = [];
+  for (const name of Object.keys(entities).sort()) {
+    let node = root;
+    for (const ch of name.slice(1)) {
+      if (!node.children.has(ch)) {
+        node.children.set(ch, { label: ch, children: new Map(), value: 0 });
+      }
+      node = node.children.get(ch);
+    }
+    values.push(entities[name].codepoints);
+    node.value = values.length;
+  }
+
+  const nodes = [root];
+  for (let i = 0; i < nodes.length; i++) {
+    const node = nodes[i];
+    const children = [...node.children.values()].sort((a, b) =>
+      a.label < b.label ? -1 : a.label > b.label ? 1 : 0
+    );
+    node.firstChild = nodes.length;
+    node.childCount = children.length;
+    nodes.push(...children);
+  }
+  return { nodes, values };
+}
+
+function charLiteral(label) {
+  if (label === '') {
+    return "'\\0'";
+  }
+  return label === "'" || label === '\\' ? `'\\${label}'` : `'${label}'`;
+}
+
+function hex(codepoint) {
+  return `0x${codepoint.toString(16).toUpperCase()}`;
+}
+
+function generate() {
+  const entities = JSON.parse(fs.readFileSync(entitiesPath, 'utf8'));
+  const { nodes, values } = buildTrie(entities);
+  if (nodes.length > 0xffff) {
+    throw new Error(`Entity trie has ${nodes.length} nodes, more than uint16_t can index`);
+  }
+  const maxChildren = Math.max(...nodes.map((node) => node.childCount));
+  const maxNameLength = Math.max(...Object.keys(entities).map((name) => name.length - 1));
+
+  const lines = [
+    '// DO NOT EDIT - Generated by scripts/codegen-entities.js',
+    '// Source of truth: scripts/data/html-entities.json (WHATWG named character references)',
+    '// Run: yarn codegen:entities',
+    '',
+    '#pragma once',
+    '',
+    '#include <cstddef>',
+    '#include <cstdint>',
+    '',
+    'namespace facebook::react::parsing {',
+    '',
+    '// One trie node per entity name prefix. Children of a node are stored',
+    '// contiguously from firstChild, sorted by label. value is a 1-based index',
+    '// into kEntityValues for names ending at this node, 0 otherwise.',
+    'struct EntityTrieNode {',
+    '  char label;',
+    '  uint8_t childCount;',
+    '  uint16_t firstChild;',
+    '  uint16_t value;',
+    '};',
+    '',
+    `// Longest entity name, excluding the leading '&' (${Object.keys(entities).length} names)`,
+    `inline constexpr size_t kMaxEntityNameLength = ${maxNameLength};`,
+    '',
+    `// Most children of any node (${maxChildren})`,
+    `inline constexpr size_t kMaxEntityTrieChildren = ${maxChildren};`,
+    '',
+    '// Code points of each entity; the second is 0 for single code point entities',
+    `inline constexpr char32_t kEntityValues[${values.length}][2] = {`,
+  ];
+  for (let i = 0; i < values.length; i += ENTRIES_PER_LINE) {
+    const row = values
+      .slice(i, i + ENTRIES_PER_LINE)
+      .map((codepoints) => `{${hex(codepoints[0])}, ${hex(codepoints[1] || 0)}}`);
+    lines.push(`    ${row.join(', ')},`);
+  }
+  lines.push('};');
+  lines.push('');
+  lines.push('// Node 0 is the root');
+  lines.push(`inline constexpr EntityTrieNode kEntityTrie[${nodes.length}] = {`);
+  for (let i = 0; i < nodes.length; i += ENTRIES_PER_LINE) {
+    const row = nodes
+      .slice(i, i + ENTRIES_PER_LINE)
+      .map(
+        (node) =>
+          `{${charLiteral(node.label)}, ${node.childCount}, ${node.firstChild}, ${node.value}}`
+      );
+    lines.push(`    ${row.join(', ')},`);
+  }
+  lines.push('};');
+  lines.push('');
+  lines.push('} // namespace facebook::react::parsing');
+  lines.push('');
+  return lines.join('\n');
+}
+
+const generated = generate();
+if (process.argv.includes('--check')) {
+  const current = fs.existsSync(outputPath)
+    ? fs.readFileSync(outputPath, 'utf8')
+    : '';
+  if (current !== generated) {
+    console.error(
+      'cpp/parsing/GeneratedEntityTrie.h is out of date. Run: yarn codegen:entities'
+    );
+    process.exit(1);
+  }
+  console.log('cpp/parsing/GeneratedEntityTrie.h is up to date');
+} else {
+  fs.writeFileSync(outputPath, generated);
+  console.log(`Wrote ${path.relative(rootDir, outputPath)}`);
+}
@@ -0,0 +1,12 @@
+import { TurboModuleRegistry, type TurboModule } from 'react-native';
+
+export interface Spec extends TurboModule {
+  /**
+   * Installs the batch measurement and metrics JSI functions into the JS
+   * runtime.
+   * Returns false if the runtime is not reachable.
+   */
+  install(): boolean;
+}
+
+export default TurboModuleRegistry.get<Spec>('FabricRichTextMeasure');
@@ -0,0 +1,32 @@
+import { getRichTextMetrics } from '../getRichTextMetrics';
+
+describe('getRichTextMetrics', () => {
+  afterEach(() => {
+    global.__fabricRichTextMetrics = undefined;
+  });
+
+  it('returns null when the native function is not installed', () => {
+    expect(getRichTextMetrics()).toBeNull();
+  });
+
+  it('returns the native metrics without resetting them', () => {
+    const metrics = {
+      parses: { full: 1, incremental: 0, budgeted: 0 },
+      phases: {},
+      caches: {},
+    };
+    const nativeGetMetrics = jest.fn().mockReturnValue(metrics);
+    global.__fabricRichTextMetrics = nativeGetMetrics;
+
+    expect(getRichTextMetrics()).toBe(metrics);
+    expect(nativeGetMetrics).toHaveBeenCalledWith(false);
+  });
+
+  it('passes reset to the native function', () => {
+    const nativeGetMetrics = jest.fn().mockReturnValue({});
+    global.__fabricRichTextMetrics = nativeGetMetrics;
+
+    getRichTextMetrics({ reset: true });
+    expect(nativeGetMetrics).toHaveBeenCalledWith(true);
+  });
+});
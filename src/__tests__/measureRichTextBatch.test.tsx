@@ -0,0 +1,58 @@
+import { measureRichTextBatch } from '../measureRichTextBatch';
+
+describe('measureRichTextBatch', () => {
+  afterEach(() => {
+    global.__fabricRichTextMeasureBatch = undefined;
+  });
+
+  it('rejects when the native function is not installed', async () => {
+    await expect(measureRichTextBatch(['<p>Row</p>'], 320)).rejects.toThrow(
+      'measureRichTextBatch is not available'
+    );
+  });
+
+  it('passes items and width to the native function', async () => {
+    const sizes = [{ width: 100, height: 20, lineCount: 1 }];
+    const nativeMeasure = jest.fn().mockResolvedValue(sizes);
+    global.__fabricRichTextMeasureBatch = nativeMeasure;
+
+    const items = ['<p>Row</p>', { text: '<p>Preview</p>', numberOfLines: 2 }];
+    await expect(measureRichTextBatch(items, 320)).resolves.toBe(sizes);
+
+    expect(nativeMeasure).toHaveBeenCalledWith(
+      items,
+      320,
+      expect.objectContaining({ allowFontScaling: true })
+    );
+  });
+
+  it('flattens style and serializes tagStyles', async () => {
+    const nativeMeasure = jest.fn().mockResolvedValue([]);
+    global.__fabricRichTextMeasureBatch = nativeMeasure;
+
+    await measureRichTextBatch(['<p>Row</p>'], 320, {
+      style: [{ fontSize: 14 }, { lineHeight: 20 }],
+      tagStyles: { b: { fontWeight: '700' } },
+      allowFontScaling: false,
+    });
+
+    const style = nativeMeasure.mock.calls[0][2];
+    expect(style).toEqual(
+      expect.objectContaining({
+        fontSize: 14,
+        lineHeight: 20,
+        tagStyles: '{"b":{"fontWeight":"700"}}',
+        allowFontScaling: false,
+      })
+    );
+  });
+
+  it('omits empty tagStyles', async () => {
+    const nativeMeasure = jest.fn().mockResolvedValue([]);
+    global.__fabricRichTextMeasureBatch = nativeMeasure;
+
+    await measureRichTextBatch(['<p>Row</p>'], 320, { tagStyles: {} });
+
+    expect(nativeMeasure.mock.calls[0][2].tagStyles).toBeUndefined();
+  });
+});
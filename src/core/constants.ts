@@ -7,6 +7,7 @@
  * This file is used to generate:
  * - android/src/main/java/com/htmlrenderer/GeneratedConstants.kt
  * - ios/GeneratedConstants.swift
+ * - cpp/parsing/GeneratedAllowlist.h (allowlists only; run: yarn codegen:allowlist)
  */
 
 // =============================================================================
@@ -0,0 +1,63 @@
+import NativeFabricRichTextMeasure from './NativeFabricRichTextMeasure';
+
+/**
+ * Latency of a pipeline phase, in milliseconds.
+ */
+export interface RichTextLatency {
+  count: number;
+  meanMs: number;
+  p50Ms: number;
+  p99Ms: number;
+}
+
+export interface RichTextPhaseMetrics extends RichTextLatency {
+  /** Bytes of markup the phase worked on */
+  bytes: number;
+  /** Latency by document size: "1kb", "4kb", "16kb", "64kb", "256kb", "larger" */
+  bySize: Record<string, RichTextLatency>;
+}
+
+export interface RichTextCacheMetrics {
+  hits: number;
+  misses: number;
+  hitRate: number;
+  entries: number;
+  bytes: number;
+}
+
+export interface RichTextMetrics {
+  parses: { full: number; incremental: number; budgeted: number };
+  phases: Record<
+    'sanitize' | 'tokenize' | 'build' | 'measure' | 'serialize',
+    RichTextPhaseMetrics
+  >;
+  caches: { parse: RichTextCacheMetrics; measure: RichTextCacheMetrics };
+}
+
+type NativeGetMetrics = (reset: boolean) => RichTextMetrics;
+
+declare global {
+  // Installed by the FabricRichTextMeasure native module
+  var __fabricRichTextMetrics: NativeGetMetrics | undefined;
+}
+
+function nativeGetMetrics(): NativeGetMetrics | undefined {
+  if (!global.__fabricRichTextMetrics) {
+    NativeFabricRichTextMeasure?.install();
+  }
+  return global.__fabricRichTextMetrics;
+}
+
+/**
+ * Parse and measure pipeline metrics recorded natively since the last
+ * reset: parse counts, p50/p99 latency of each phase by document size, and
+ * cache hit rates. With reset, the next call reports from here on, so
+ * telemetry can sample fixed windows. Returns null where native rendering
+ * is not available.
+ */
+export function getRichTextMetrics(
+  options: { reset?: boolean } = {}
+): RichTextMetrics | null {
+  const getMetrics = nativeGetMetrics();
+  return getMetrics ? getMetrics(options.reset ?? false) : null;
+}
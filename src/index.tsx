@@ -5,6 +5,19 @@ export {
 
 export { default as RichText, type RichTextProps } from './components/RichText';
 export { sanitize, ALLOWED_TAGS, ALLOWED_ATTR } from './core/sanitize';
+export {
+  measureRichTextBatch,
+  type RichTextMeasureItem,
+  type RichTextMeasureOptions,
+  type RichTextSize,
+} from './measureRichTextBatch';
+export {
+  getRichTextMetrics,
+  type RichTextCacheMetrics,
+  type RichTextLatency,
+  type RichTextMetrics,
+  type RichTextPhaseMetrics,
+} from './getRichTextMetrics';
 export type { WritingDirection } from './types/RichTextNativeProps';
 
 // Accessibility link focus types
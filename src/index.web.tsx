@@ -18,6 +18,24 @@ export type {
   RichTextMeasurementData,
 } from './types/RichTextNativeProps';
 
+// Batch measurement needs the native text layout
+export type {
+  RichTextMeasureItem,
+  RichTextMeasureOptions,
+  RichTextSize,
+} from './measureRichTextBatch';
+export const measureRichTextBatch = (): Promise<never> =>
+  Promise.reject(new Error('measureRichTextBatch is not available on web.'));
+
+// Metrics are recorded by the native pipeline
+export type {
+  RichTextCacheMetrics,
+  RichTextLatency,
+  RichTextMetrics,
+  RichTextPhaseMetrics,
+} from './getRichTextMetrics';
+export const getRichTextMetrics = (): null => null;
+
 // FabricRichText is not available on web - provide a helpful error if accessed
 export const FabricRichText = (): never => {
   throw new Error(
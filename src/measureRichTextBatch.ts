@@ -0,0 +1,98 @@
+import {
+  PixelRatio,
+  processColor,
+  StyleSheet,
+  type StyleProp,
+  type TextStyle,
+} from 'react-native';
+import NativeFabricRichTextMeasure from './NativeFabricRichTextMeasure';
+
+/**
+ * A document to measure: markup, optionally limited to numberOfLines.
+ */
+export interface RichTextMeasureItem {
+  text: string;
+  numberOfLines?: number;
+}
+
+/**
+ * Style shared by every item of a batch, as passed to RichText.
+ */
+export interface RichTextMeasureOptions {
+  style?: StyleProp<TextStyle>;
+  tagStyles?: Record<string, TextStyle>;
+  allowFontScaling?: boolean;
+  maxFontSizeMultiplier?: number;
+}
+
+export interface RichTextSize {
+  width: number;
+  height: number;
+  lineCount: number;
+}
+
+type NativeMeasureBatch = (
+  items: ReadonlyArray<string | RichTextMeasureItem>,
+  width: number,
+  style: object
+) => Promise<RichTextSize[]>;
+
+declare global {
+  // Installed by the FabricRichTextMeasure native module
+  var __fabricRichTextMeasureBatch: NativeMeasureBatch | undefined;
+}
+
+function nativeMeasureBatch(): NativeMeasureBatch | undefined {
+  if (!global.__fabricRichTextMeasureBatch) {
+    NativeFabricRichTextMeasure?.install();
+  }
+  return global.__fabricRichTextMeasureBatch;
+}
+
+/**
+ * Measure rich text documents laid out at width before they are rendered,
+ * e.g. for FlatList's getItemLayout.
+ *
+ * Parsing and measuring run off the JS thread. Parse results go to the
+ * shared parse cache, so rows rendered afterwards skip parsing. iOS
+ * measures with the same text layout as RichText; Android estimates sizes
+ * from font metrics, which can differ from the rendered size by a few
+ * percent.
+ */
+export function measureRichTextBatch(
+  items: ReadonlyArray<string | RichTextMeasureItem>,
+  width: number,
+  options: RichTextMeasureOptions = {}
+): Promise<RichTextSize[]> {
+  const measureBatch = nativeMeasureBatch();
+  if (!measureBatch) {
+    return Promise.reject(
+      new Error('measureRichTextBatch is not available on this platform.')
+    );
+  }
+
+  // Same style mapping as the native adapter applies to RichText props
+  const textStyle = options.style
+    ? (StyleSheet.flatten(options.style) as TextStyle)
+    : undefined;
+  const tagStyles =
+    options.tagStyles && Object.keys(options.tagStyles).length > 0
+      ? JSON.stringify(options.tagStyles)
+      : undefined;
+
+  return measureBatch(items, width, {
+    fontSize: textStyle?.fontSize,
+    lineHeight: textStyle?.lineHeight,
+    fontWeight: textStyle?.fontWeight,
+    fontFamily: textStyle?.fontFamily,
+    fontStyle: textStyle?.fontStyle,
+    letterSpacing: textStyle?.letterSpacing,
+    color: textStyle?.color
+      ? (processColor(textStyle.color) as number)
+      : undefined,
+    tagStyles,
+    allowFontScaling: options.allowFontScaling ?? true,
+    maxFontSizeMultiplier: options.maxFontSizeMultiplier,
+    fontScale: PixelRatio.getFontScale(),
+  });
+}